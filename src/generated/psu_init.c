@@ -15,13 +15,16 @@
 #include <xil_io.h>
 #include <sleep.h>
 #include "psu_init.h"
+#include "psu_init_table.h"
 #define    DPLL_CFG_LOCK_DLY        63
 #define    DPLL_CFG_LOCK_CNT        625
 #define    DPLL_CFG_LFHF            3
 #define    DPLL_CFG_CP              3
 #define    DPLL_CFG_RES             2
 
+#ifndef PSU_INIT_TABLE
 static int mask_pollOnValue(u32 add, u32 mask, u32 value);
+#endif /* PSU_INIT_TABLE */
 
 static int mask_poll(u32 add, u32 mask);
 
@@ -68,8 +71,11 @@ void PSU_Mask_Write(unsigned long offset, unsigned long mask,
 	    Xil_Out32(addr, rdata);
 	    }
 
-unsigned long psu_pll_init_data(void)
+unsigned long psu_rpll_start_data(void)
 {
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_rpll_start_data_table);
+#else
     /*
     * RPLL INIT
     */
@@ -171,20 +177,14 @@ unsigned long psu_pll_init_data(void)
 	PSU_Mask_Write(CRL_APB_RPLL_CTRL_OFFSET, 0x00000001U, 0x00000000U);
 /*##################################################################### */
 
-    /*
-    * CHECK PLL STATUS
-    */
-    /*
-    * Register : PLL_STATUS @ 0XFF5E0040
-
-    * RPLL is locked
-    *  PSU_CRL_APB_PLL_STATUS_RPLL_LOCK                            1
-    * (OFFSET, MASK, VALUE)      (0XFF5E0040, 0x00000002U ,0x00000002U)
-		*/
-	mask_poll(CRL_APB_PLL_STATUS_OFFSET, 0x00000002U);
-
-/*##################################################################### */
-
+	return 1;
+#endif /* PSU_INIT_TABLE */
+}
+unsigned long psu_rpll_finish_data(void)
+{
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_rpll_finish_data_table);
+#else
     /*
     * REMOVE PLL BY PASS
     */
@@ -248,6 +248,14 @@ unsigned long psu_pll_init_data(void)
 		0x013F3F07U, 0x01012300U);
 /*##################################################################### */
 
+	return 1;
+#endif /* PSU_INIT_TABLE */
+}
+unsigned long psu_iopll_start_data(void)
+{
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_iopll_start_data_table);
+#else
 	/*
 	* IOPLL INIT
 	*/
@@ -349,20 +357,14 @@ unsigned long psu_pll_init_data(void)
 	PSU_Mask_Write(CRL_APB_IOPLL_CTRL_OFFSET, 0x00000001U, 0x00000000U);
 /*##################################################################### */
 
-    /*
-    * CHECK PLL STATUS
-    */
-    /*
-    * Register : PLL_STATUS @ 0XFF5E0040
-
-    * IOPLL is locked
-    *  PSU_CRL_APB_PLL_STATUS_IOPLL_LOCK                           1
-    * (OFFSET, MASK, VALUE)      (0XFF5E0040, 0x00000001U ,0x00000001U)
-		*/
-	mask_poll(CRL_APB_PLL_STATUS_OFFSET, 0x00000001U);
-
-/*##################################################################### */
-
+	return 1;
+#endif /* PSU_INIT_TABLE */
+}
+unsigned long psu_iopll_finish_data(void)
+{
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_iopll_finish_data_table);
+#else
     /*
     * REMOVE PLL BY PASS
     */
@@ -398,6 +400,15 @@ unsigned long psu_pll_init_data(void)
     /*
     * IOPLL FRAC CFG
     */
+
+	return 1;
+#endif /* PSU_INIT_TABLE */
+}
+unsigned long psu_apll_start_data(void)
+{
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_apll_start_data_table);
+#else
     /*
     * APU_PLL INIT
     */
@@ -499,20 +510,14 @@ unsigned long psu_pll_init_data(void)
 	PSU_Mask_Write(CRF_APB_APLL_CTRL_OFFSET, 0x00000001U, 0x00000000U);
 /*##################################################################### */
 
-    /*
-    * CHECK PLL STATUS
-    */
-    /*
-    * Register : PLL_STATUS @ 0XFD1A0044
-
-    * APLL is locked
-    *  PSU_CRF_APB_PLL_STATUS_APLL_LOCK                            1
-    * (OFFSET, MASK, VALUE)      (0XFD1A0044, 0x00000001U ,0x00000001U)
-		*/
-	mask_poll(CRF_APB_PLL_STATUS_OFFSET, 0x00000001U);
-
-/*##################################################################### */
-
+	return 1;
+#endif /* PSU_INIT_TABLE */
+}
+unsigned long psu_apll_finish_data(void)
+{
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_apll_finish_data_table);
+#else
     /*
     * REMOVE PLL BY PASS
     */
@@ -548,6 +553,15 @@ unsigned long psu_pll_init_data(void)
     /*
     * APLL FRAC CFG
     */
+
+	return 1;
+#endif /* PSU_INIT_TABLE */
+}
+unsigned long psu_dpll_start_data(void)
+{
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_dpll_start_data_table);
+#else
     /*
     * DDR_PLL INIT
     */
@@ -649,20 +663,14 @@ unsigned long psu_pll_init_data(void)
 	PSU_Mask_Write(CRF_APB_DPLL_CTRL_OFFSET, 0x00000001U, 0x00000000U);
 /*##################################################################### */
 
-    /*
-    * CHECK PLL STATUS
-    */
-    /*
-    * Register : PLL_STATUS @ 0XFD1A0044
-
-    * DPLL is locked
-    *  PSU_CRF_APB_PLL_STATUS_DPLL_LOCK                            1
-    * (OFFSET, MASK, VALUE)      (0XFD1A0044, 0x00000002U ,0x00000002U)
-		*/
-	mask_poll(CRF_APB_PLL_STATUS_OFFSET, 0x00000002U);
-
-/*##################################################################### */
-
+	return 1;
+#endif /* PSU_INIT_TABLE */
+}
+unsigned long psu_dpll_finish_data(void)
+{
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_dpll_finish_data_table);
+#else
     /*
     * REMOVE PLL BY PASS
     */
@@ -698,6 +706,15 @@ unsigned long psu_pll_init_data(void)
     /*
     * DPLL FRAC CFG
     */
+
+	return 1;
+#endif /* PSU_INIT_TABLE */
+}
+unsigned long psu_vpll_start_data(void)
+{
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_vpll_start_data_table);
+#else
     /*
     * VIDEO_PLL INIT
     */
@@ -799,20 +816,14 @@ unsigned long psu_pll_init_data(void)
 	PSU_Mask_Write(CRF_APB_VPLL_CTRL_OFFSET, 0x00000001U, 0x00000000U);
 /*##################################################################### */
 
-    /*
-    * CHECK PLL STATUS
-    */
-    /*
-    * Register : PLL_STATUS @ 0XFD1A0044
-
-    * VPLL is locked
-    *  PSU_CRF_APB_PLL_STATUS_VPLL_LOCK                            1
-    * (OFFSET, MASK, VALUE)      (0XFD1A0044, 0x00000004U ,0x00000004U)
-		*/
-	mask_poll(CRF_APB_PLL_STATUS_OFFSET, 0x00000004U);
-
-/*##################################################################### */
-
+	return 1;
+#endif /* PSU_INIT_TABLE */
+}
+unsigned long psu_vpll_finish_data(void)
+{
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_vpll_finish_data_table);
+#else
     /*
     * REMOVE PLL BY PASS
     */
@@ -850,1853 +861,2649 @@ unsigned long psu_pll_init_data(void)
     */
 
 	return 1;
+#endif /* PSU_INIT_TABLE */
 }
-unsigned long psu_clock_init_data(void)
+unsigned long psu_pll_init_data(void)
 {
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_pll_init_data_table);
+#else
     /*
-    * CLOCK CONTROL SLCR REGISTER
+    * RPLL INIT
     */
     /*
-    * Register : GEM3_REF_CTRL @ 0XFF5E005C
+    * Register : RPLL_CFG @ 0XFF5E0034
 
-    * Clock active for the RX channel
-    *  PSU_CRL_APB_GEM3_REF_CTRL_RX_CLKACT                         0x1
+    * PLL loop filter resistor control
+    *  PSU_CRL_APB_RPLL_CFG_RES                                    0xc
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_GEM3_REF_CTRL_CLKACT                            0x1
+    * PLL charge pump control
+    *  PSU_CRL_APB_RPLL_CFG_CP                                     0x3
 
-    * 6 bit divider
-    *  PSU_CRL_APB_GEM3_REF_CTRL_DIVISOR1                          0x1
+    * PLL loop filter high frequency capacitor control
+    *  PSU_CRL_APB_RPLL_CFG_LFHF                                   0x3
 
-    * 6 bit divider
-    *  PSU_CRL_APB_GEM3_REF_CTRL_DIVISOR0                          0xc
+    * Lock circuit counter setting
+    *  PSU_CRL_APB_RPLL_CFG_LOCK_CNT                               0x339
 
-    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_GEM3_REF_CTRL_SRCSEL                            0x0
+    * Lock circuit configuration settings for lock windowsize
+    *  PSU_CRL_APB_RPLL_CFG_LOCK_DLY                               0x3f
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E005C, 0x063F3F07U ,0x06010C00U)
+    * Helper data. Values are to be looked up in a table from Data Sheet
+    * (OFFSET, MASK, VALUE)      (0XFF5E0034, 0xFE7FEDEFU ,0x7E672C6CU)
     */
-	PSU_Mask_Write(CRL_APB_GEM3_REF_CTRL_OFFSET,
-		0x063F3F07U, 0x06010C00U);
+	PSU_Mask_Write(CRL_APB_RPLL_CFG_OFFSET, 0xFE7FEDEFU, 0x7E672C6CU);
 /*##################################################################### */
 
     /*
-    * Register : GEM_TSU_REF_CTRL @ 0XFF5E0100
-
-    * 6 bit divider
-    *  PSU_CRL_APB_GEM_TSU_REF_CTRL_DIVISOR0                       0x6
+    * UPDATE FB_DIV
+    */
+    /*
+    * Register : RPLL_CTRL @ 0XFF5E0030
 
-    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_GEM_TSU_REF_CTRL_SRCSEL                         0x0
+    * Mux select for determining which clock feeds this PLL. 0XX pss_ref_clk i
+    * s the source 100 video clk is the source 101 pss_alt_ref_clk is the sour
+    * ce 110 aux_refclk[X] is the source 111 gt_crx_ref_clk is the source
+    *  PSU_CRL_APB_RPLL_CTRL_PRE_SRC                               0x0
 
-    * 6 bit divider
-    *  PSU_CRL_APB_GEM_TSU_REF_CTRL_DIVISOR1                       0x1
+    * The integer portion of the feedback divider to the PLL
+    *  PSU_CRL_APB_RPLL_CTRL_FBDIV                                 0x2d
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_GEM_TSU_REF_CTRL_CLKACT                         0x1
+    * This turns on the divide by 2 that is inside of the PLL. This does not c
+    * hange the VCO frequency, just the output frequency
+    *  PSU_CRL_APB_RPLL_CTRL_DIV2                                  0x1
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E0100, 0x013F3F07U ,0x01010600U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFF5E0030, 0x00717F00U ,0x00012D00U)
     */
-	PSU_Mask_Write(CRL_APB_GEM_TSU_REF_CTRL_OFFSET,
-		0x013F3F07U, 0x01010600U);
+	PSU_Mask_Write(CRL_APB_RPLL_CTRL_OFFSET, 0x00717F00U, 0x00012D00U);
 /*##################################################################### */
 
     /*
-    * Register : USB0_BUS_REF_CTRL @ 0XFF5E0060
-
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_USB0_BUS_REF_CTRL_CLKACT                        0x1
-
-    * 6 bit divider
-    *  PSU_CRL_APB_USB0_BUS_REF_CTRL_DIVISOR1                      0x1
-
-    * 6 bit divider
-    *  PSU_CRL_APB_USB0_BUS_REF_CTRL_DIVISOR0                      0x6
+    * BY PASS PLL
+    */
+    /*
+    * Register : RPLL_CTRL @ 0XFF5E0030
 
-    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_USB0_BUS_REF_CTRL_SRCSEL                        0x0
+    * Bypasses the PLL clock. The usable clock will be determined from the POS
+    * T_SRC field. (This signal may only be toggled after 4 cycles of the old
+    * clock and 4 cycles of the new clock. This is not usually an issue, but d
+    * esigners must be aware.)
+    *  PSU_CRL_APB_RPLL_CTRL_BYPASS                                1
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E0060, 0x023F3F07U ,0x02010600U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFF5E0030, 0x00000008U ,0x00000008U)
     */
-	PSU_Mask_Write(CRL_APB_USB0_BUS_REF_CTRL_OFFSET,
-		0x023F3F07U, 0x02010600U);
+	PSU_Mask_Write(CRL_APB_RPLL_CTRL_OFFSET, 0x00000008U, 0x00000008U);
 /*##################################################################### */
 
     /*
-    * Register : USB3_DUAL_REF_CTRL @ 0XFF5E004C
-
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_USB3_DUAL_REF_CTRL_CLKACT                       0x1
-
-    * 6 bit divider
-    *  PSU_CRL_APB_USB3_DUAL_REF_CTRL_DIVISOR1                     0x3
-
-    * 6 bit divider
-    *  PSU_CRL_APB_USB3_DUAL_REF_CTRL_DIVISOR0                     0x19
+    * ASSERT RESET
+    */
+    /*
+    * Register : RPLL_CTRL @ 0XFF5E0030
 
-    * 000 = IOPLL; 010 = RPLL; 011 = DPLL. (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_USB3_DUAL_REF_CTRL_SRCSEL                       0x0
+    * Asserts Reset to the PLL. When asserting reset, the PLL must already be
+    * in BYPASS.
+    *  PSU_CRL_APB_RPLL_CTRL_RESET                                 1
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E004C, 0x023F3F07U ,0x02031900U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFF5E0030, 0x00000001U ,0x00000001U)
     */
-	PSU_Mask_Write(CRL_APB_USB3_DUAL_REF_CTRL_OFFSET,
-		0x023F3F07U, 0x02031900U);
+	PSU_Mask_Write(CRL_APB_RPLL_CTRL_OFFSET, 0x00000001U, 0x00000001U);
 /*##################################################################### */
 
     /*
-    * Register : QSPI_REF_CTRL @ 0XFF5E0068
-
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_QSPI_REF_CTRL_CLKACT                            0x1
-
-    * 6 bit divider
-    *  PSU_CRL_APB_QSPI_REF_CTRL_DIVISOR1                          0x1
-
-    * 6 bit divider
-    *  PSU_CRL_APB_QSPI_REF_CTRL_DIVISOR0                          0xc
+    * DEASSERT RESET
+    */
+    /*
+    * Register : RPLL_CTRL @ 0XFF5E0030
 
-    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_QSPI_REF_CTRL_SRCSEL                            0x0
+    * Asserts Reset to the PLL. When asserting reset, the PLL must already be
+    * in BYPASS.
+    *  PSU_CRL_APB_RPLL_CTRL_RESET                                 0
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E0068, 0x013F3F07U ,0x01010C00U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFF5E0030, 0x00000001U ,0x00000000U)
     */
-	PSU_Mask_Write(CRL_APB_QSPI_REF_CTRL_OFFSET,
-		0x013F3F07U, 0x01010C00U);
+	PSU_Mask_Write(CRL_APB_RPLL_CTRL_OFFSET, 0x00000001U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : SDIO1_REF_CTRL @ 0XFF5E0070
-
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_SDIO1_REF_CTRL_CLKACT                           0x1
+    * CHECK PLL STATUS
+    */
+    /*
+    * Register : PLL_STATUS @ 0XFF5E0040
 
-    * 6 bit divider
-    *  PSU_CRL_APB_SDIO1_REF_CTRL_DIVISOR1                         0x1
+    * RPLL is locked
+    *  PSU_CRL_APB_PLL_STATUS_RPLL_LOCK                            1
+    * (OFFSET, MASK, VALUE)      (0XFF5E0040, 0x00000002U ,0x00000002U)
+		*/
+	mask_poll(CRL_APB_PLL_STATUS_OFFSET, 0x00000002U);
 
-    * 6 bit divider
-    *  PSU_CRL_APB_SDIO1_REF_CTRL_DIVISOR0                         0x8
+/*##################################################################### */
 
-    * 000 = IOPLL; 010 = RPLL; 011 = VPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_SDIO1_REF_CTRL_SRCSEL                           0x0
+    /*
+    * REMOVE PLL BY PASS
+    */
+    /*
+    * Register : RPLL_CTRL @ 0XFF5E0030
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E0070, 0x013F3F07U ,0x01010800U)
+    * Bypasses the PLL clock. The usable clock will be determined from the POS
+    * T_SRC field. (This signal may only be toggled after 4 cycles of the old
+    * clock and 4 cycles of the new clock. This is not usually an issue, but d
+    * esigners must be aware.)
+    *  PSU_CRL_APB_RPLL_CTRL_BYPASS                                0
+
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFF5E0030, 0x00000008U ,0x00000000U)
     */
-	PSU_Mask_Write(CRL_APB_SDIO1_REF_CTRL_OFFSET,
-		0x013F3F07U, 0x01010800U);
+	PSU_Mask_Write(CRL_APB_RPLL_CTRL_OFFSET, 0x00000008U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : SDIO_CLK_CTRL @ 0XFF18030C
+    * Register : RPLL_TO_FPD_CTRL @ 0XFF5E0048
 
-    * MIO pad selection for sdio1_rx_clk (feedback clock from the PAD) 0: MIO
-    * [51] 1: MIO [76]
-    *  PSU_IOU_SLCR_SDIO_CLK_CTRL_SDIO1_RX_SRC_SEL                 0
+    * Divisor value for this clock.
+    *  PSU_CRL_APB_RPLL_TO_FPD_CTRL_DIVISOR0                       0x2
 
-    * SoC Debug Clock Control
-    * (OFFSET, MASK, VALUE)      (0XFF18030C, 0x00020000U ,0x00000000U)
+    * Control for a clock that will be generated in the LPD, but used in the F
+    * PD as a clock source for the peripheral clock muxes.
+    * (OFFSET, MASK, VALUE)      (0XFF5E0048, 0x00003F00U ,0x00000200U)
     */
-	PSU_Mask_Write(IOU_SLCR_SDIO_CLK_CTRL_OFFSET,
-		0x00020000U, 0x00000000U);
+	PSU_Mask_Write(CRL_APB_RPLL_TO_FPD_CTRL_OFFSET,
+		0x00003F00U, 0x00000200U);
 /*##################################################################### */
 
-    /*
-    * Register : UART0_REF_CTRL @ 0XFF5E0074
+	/*
+	* RPLL FRAC CFG
+	*/
+	/*
+	* SYSMON CLOCK PRESET TO RPLL AGAIN TO AVOID GLITCH WHEN NEXT IOPLL WILL B
+	* E PUT IN BYPASS MODE
+	*/
+	/*
+	* Register : AMS_REF_CTRL @ 0XFF5E0108
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_UART0_REF_CTRL_CLKACT                           0x1
+	* 6 bit divider
+	*  PSU_CRL_APB_AMS_REF_CTRL_DIVISOR1                           1
 
-    * 6 bit divider
-    *  PSU_CRL_APB_UART0_REF_CTRL_DIVISOR1                         0x1
+	* 6 bit divider
+	*  PSU_CRL_APB_AMS_REF_CTRL_DIVISOR0                           35
 
-    * 6 bit divider
-    *  PSU_CRL_APB_UART0_REF_CTRL_DIVISOR0                         0xf
+	* 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
+	* ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+	*  usually an issue, but designers must be aware.)
+	*  PSU_CRL_APB_AMS_REF_CTRL_SRCSEL                             0
 
-    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_UART0_REF_CTRL_SRCSEL                           0x0
+	* Clock active signal. Switch to 0 to disable the clock
+	*  PSU_CRL_APB_AMS_REF_CTRL_CLKACT                             1
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E0074, 0x013F3F07U ,0x01010F00U)
-    */
-	PSU_Mask_Write(CRL_APB_UART0_REF_CTRL_OFFSET,
-		0x013F3F07U, 0x01010F00U);
+	* This register controls this reference clock
+	* (OFFSET, MASK, VALUE)      (0XFF5E0108, 0x013F3F07U ,0x01012300U)
+	*/
+	PSU_Mask_Write(CRL_APB_AMS_REF_CTRL_OFFSET,
+		0x013F3F07U, 0x01012300U);
 /*##################################################################### */
 
-    /*
-    * Register : UART1_REF_CTRL @ 0XFF5E0078
+	/*
+	* IOPLL INIT
+	*/
+	/*
+	* Register : IOPLL_CFG @ 0XFF5E0024
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_UART1_REF_CTRL_CLKACT                           0x1
+    * PLL loop filter resistor control
+    *  PSU_CRL_APB_IOPLL_CFG_RES                                   0x2
 
-    * 6 bit divider
-    *  PSU_CRL_APB_UART1_REF_CTRL_DIVISOR1                         0x1
+    * PLL charge pump control
+    *  PSU_CRL_APB_IOPLL_CFG_CP                                    0x4
 
-    * 6 bit divider
-    *  PSU_CRL_APB_UART1_REF_CTRL_DIVISOR0                         0xf
+    * PLL loop filter high frequency capacitor control
+    *  PSU_CRL_APB_IOPLL_CFG_LFHF                                  0x3
 
-    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_UART1_REF_CTRL_SRCSEL                           0x0
+    * Lock circuit counter setting
+    *  PSU_CRL_APB_IOPLL_CFG_LOCK_CNT                              0x258
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E0078, 0x013F3F07U ,0x01010F00U)
+    * Lock circuit configuration settings for lock windowsize
+    *  PSU_CRL_APB_IOPLL_CFG_LOCK_DLY                              0x3f
+
+    * Helper data. Values are to be looked up in a table from Data Sheet
+    * (OFFSET, MASK, VALUE)      (0XFF5E0024, 0xFE7FEDEFU ,0x7E4B0C82U)
     */
-	PSU_Mask_Write(CRL_APB_UART1_REF_CTRL_OFFSET,
-		0x013F3F07U, 0x01010F00U);
+	PSU_Mask_Write(CRL_APB_IOPLL_CFG_OFFSET, 0xFE7FEDEFU, 0x7E4B0C82U);
 /*##################################################################### */
 
     /*
-    * Register : I2C0_REF_CTRL @ 0XFF5E0120
-
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_I2C0_REF_CTRL_CLKACT                            0x1
+    * UPDATE FB_DIV
+    */
+    /*
+    * Register : IOPLL_CTRL @ 0XFF5E0020
 
-    * 6 bit divider
-    *  PSU_CRL_APB_I2C0_REF_CTRL_DIVISOR1                          0x1
+    * Mux select for determining which clock feeds this PLL. 0XX pss_ref_clk i
+    * s the source 100 video clk is the source 101 pss_alt_ref_clk is the sour
+    * ce 110 aux_refclk[X] is the source 111 gt_crx_ref_clk is the source
+    *  PSU_CRL_APB_IOPLL_CTRL_PRE_SRC                              0x0
 
-    * 6 bit divider
-    *  PSU_CRL_APB_I2C0_REF_CTRL_DIVISOR0                          0xf
+    * The integer portion of the feedback divider to the PLL
+    *  PSU_CRL_APB_IOPLL_CTRL_FBDIV                                0x5a
 
-    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_I2C0_REF_CTRL_SRCSEL                            0x0
+    * This turns on the divide by 2 that is inside of the PLL. This does not c
+    * hange the VCO frequency, just the output frequency
+    *  PSU_CRL_APB_IOPLL_CTRL_DIV2                                 0x1
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E0120, 0x013F3F07U ,0x01010F00U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFF5E0020, 0x00717F00U ,0x00015A00U)
     */
-	PSU_Mask_Write(CRL_APB_I2C0_REF_CTRL_OFFSET,
-		0x013F3F07U, 0x01010F00U);
+	PSU_Mask_Write(CRL_APB_IOPLL_CTRL_OFFSET, 0x00717F00U, 0x00015A00U);
 /*##################################################################### */
 
     /*
-    * Register : I2C1_REF_CTRL @ 0XFF5E0124
-
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_I2C1_REF_CTRL_CLKACT                            0x1
-
-    * 6 bit divider
-    *  PSU_CRL_APB_I2C1_REF_CTRL_DIVISOR1                          0x1
-
-    * 6 bit divider
-    *  PSU_CRL_APB_I2C1_REF_CTRL_DIVISOR0                          0xf
+    * BY PASS PLL
+    */
+    /*
+    * Register : IOPLL_CTRL @ 0XFF5E0020
 
-    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_I2C1_REF_CTRL_SRCSEL                            0x0
+    * Bypasses the PLL clock. The usable clock will be determined from the POS
+    * T_SRC field. (This signal may only be toggled after 4 cycles of the old
+    * clock and 4 cycles of the new clock. This is not usually an issue, but d
+    * esigners must be aware.)
+    *  PSU_CRL_APB_IOPLL_CTRL_BYPASS                               1
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E0124, 0x013F3F07U ,0x01010F00U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFF5E0020, 0x00000008U ,0x00000008U)
     */
-	PSU_Mask_Write(CRL_APB_I2C1_REF_CTRL_OFFSET,
-		0x013F3F07U, 0x01010F00U);
+	PSU_Mask_Write(CRL_APB_IOPLL_CTRL_OFFSET, 0x00000008U, 0x00000008U);
 /*##################################################################### */
 
     /*
-    * Register : CAN1_REF_CTRL @ 0XFF5E0088
+    * ASSERT RESET
+    */
+    /*
+    * Register : IOPLL_CTRL @ 0XFF5E0020
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_CAN1_REF_CTRL_CLKACT                            0x1
+    * Asserts Reset to the PLL. When asserting reset, the PLL must already be
+    * in BYPASS.
+    *  PSU_CRL_APB_IOPLL_CTRL_RESET                                1
 
-    * 6 bit divider
-    *  PSU_CRL_APB_CAN1_REF_CTRL_DIVISOR1                          0x1
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFF5E0020, 0x00000001U ,0x00000001U)
+    */
+	PSU_Mask_Write(CRL_APB_IOPLL_CTRL_OFFSET, 0x00000001U, 0x00000001U);
+/*##################################################################### */
 
-    * 6 bit divider
-    *  PSU_CRL_APB_CAN1_REF_CTRL_DIVISOR0                          0xf
+    /*
+    * DEASSERT RESET
+    */
+    /*
+    * Register : IOPLL_CTRL @ 0XFF5E0020
 
-    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_CAN1_REF_CTRL_SRCSEL                            0x0
+    * Asserts Reset to the PLL. When asserting reset, the PLL must already be
+    * in BYPASS.
+    *  PSU_CRL_APB_IOPLL_CTRL_RESET                                0
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E0088, 0x013F3F07U ,0x01010F00U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFF5E0020, 0x00000001U ,0x00000000U)
     */
-	PSU_Mask_Write(CRL_APB_CAN1_REF_CTRL_OFFSET,
-		0x013F3F07U, 0x01010F00U);
+	PSU_Mask_Write(CRL_APB_IOPLL_CTRL_OFFSET, 0x00000001U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : CPU_R5_CTRL @ 0XFF5E0090
-
-    * Turing this off will shut down the OCM, some parts of the APM, and preve
-    * nt transactions going from the FPD to the LPD and could lead to system h
-    * ang
-    *  PSU_CRL_APB_CPU_R5_CTRL_CLKACT                              0x1
-
-    * 6 bit divider
-    *  PSU_CRL_APB_CPU_R5_CTRL_DIVISOR0                            0x3
+    * CHECK PLL STATUS
+    */
+    /*
+    * Register : PLL_STATUS @ 0XFF5E0040
 
-    * 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_CPU_R5_CTRL_SRCSEL                              0x2
+    * IOPLL is locked
+    *  PSU_CRL_APB_PLL_STATUS_IOPLL_LOCK                           1
+    * (OFFSET, MASK, VALUE)      (0XFF5E0040, 0x00000001U ,0x00000001U)
+		*/
+	mask_poll(CRL_APB_PLL_STATUS_OFFSET, 0x00000001U);
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E0090, 0x01003F07U ,0x01000302U)
-    */
-	PSU_Mask_Write(CRL_APB_CPU_R5_CTRL_OFFSET, 0x01003F07U, 0x01000302U);
 /*##################################################################### */
 
     /*
-    * Register : IOU_SWITCH_CTRL @ 0XFF5E009C
-
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_IOU_SWITCH_CTRL_CLKACT                          0x1
-
-    * 6 bit divider
-    *  PSU_CRL_APB_IOU_SWITCH_CTRL_DIVISOR0                        0x6
+    * REMOVE PLL BY PASS
+    */
+    /*
+    * Register : IOPLL_CTRL @ 0XFF5E0020
 
-    * 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_IOU_SWITCH_CTRL_SRCSEL                          0x2
+    * Bypasses the PLL clock. The usable clock will be determined from the POS
+    * T_SRC field. (This signal may only be toggled after 4 cycles of the old
+    * clock and 4 cycles of the new clock. This is not usually an issue, but d
+    * esigners must be aware.)
+    *  PSU_CRL_APB_IOPLL_CTRL_BYPASS                               0
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E009C, 0x01003F07U ,0x01000602U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFF5E0020, 0x00000008U ,0x00000000U)
     */
-	PSU_Mask_Write(CRL_APB_IOU_SWITCH_CTRL_OFFSET,
-		0x01003F07U, 0x01000602U);
+	PSU_Mask_Write(CRL_APB_IOPLL_CTRL_OFFSET, 0x00000008U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : PCAP_CTRL @ 0XFF5E00A4
-
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_PCAP_CTRL_CLKACT                                0x1
-
-    * 6 bit divider
-    *  PSU_CRL_APB_PCAP_CTRL_DIVISOR0                              0x8
+    * Register : IOPLL_TO_FPD_CTRL @ 0XFF5E0044
 
-    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_PCAP_CTRL_SRCSEL                                0x0
+    * Divisor value for this clock.
+    *  PSU_CRL_APB_IOPLL_TO_FPD_CTRL_DIVISOR0                      0x3
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E00A4, 0x01003F07U ,0x01000800U)
+    * Control for a clock that will be generated in the LPD, but used in the F
+    * PD as a clock source for the peripheral clock muxes.
+    * (OFFSET, MASK, VALUE)      (0XFF5E0044, 0x00003F00U ,0x00000300U)
     */
-	PSU_Mask_Write(CRL_APB_PCAP_CTRL_OFFSET, 0x01003F07U, 0x01000800U);
+	PSU_Mask_Write(CRL_APB_IOPLL_TO_FPD_CTRL_OFFSET,
+		0x00003F00U, 0x00000300U);
 /*##################################################################### */
 
     /*
-    * Register : LPD_SWITCH_CTRL @ 0XFF5E00A8
+    * IOPLL FRAC CFG
+    */
+    /*
+    * APU_PLL INIT
+    */
+    /*
+    * Register : APLL_CFG @ 0XFD1A0024
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_LPD_SWITCH_CTRL_CLKACT                          0x1
+    * PLL loop filter resistor control
+    *  PSU_CRF_APB_APLL_CFG_RES                                    0x2
 
-    * 6 bit divider
-    *  PSU_CRL_APB_LPD_SWITCH_CTRL_DIVISOR0                        0x3
+    * PLL charge pump control
+    *  PSU_CRF_APB_APLL_CFG_CP                                     0x3
 
-    * 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_LPD_SWITCH_CTRL_SRCSEL                          0x2
+    * PLL loop filter high frequency capacitor control
+    *  PSU_CRF_APB_APLL_CFG_LFHF                                   0x3
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E00A8, 0x01003F07U ,0x01000302U)
+    * Lock circuit counter setting
+    *  PSU_CRF_APB_APLL_CFG_LOCK_CNT                               0x258
+
+    * Lock circuit configuration settings for lock windowsize
+    *  PSU_CRF_APB_APLL_CFG_LOCK_DLY                               0x3f
+
+    * Helper data. Values are to be looked up in a table from Data Sheet
+    * (OFFSET, MASK, VALUE)      (0XFD1A0024, 0xFE7FEDEFU ,0x7E4B0C62U)
     */
-	PSU_Mask_Write(CRL_APB_LPD_SWITCH_CTRL_OFFSET,
-		0x01003F07U, 0x01000302U);
+	PSU_Mask_Write(CRF_APB_APLL_CFG_OFFSET, 0xFE7FEDEFU, 0x7E4B0C62U);
 /*##################################################################### */
 
     /*
-    * Register : LPD_LSBUS_CTRL @ 0XFF5E00AC
+    * UPDATE FB_DIV
+    */
+    /*
+    * Register : APLL_CTRL @ 0XFD1A0020
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_LPD_LSBUS_CTRL_CLKACT                           0x1
+    * Mux select for determining which clock feeds this PLL. 0XX pss_ref_clk i
+    * s the source 100 video clk is the source 101 pss_alt_ref_clk is the sour
+    * ce 110 aux_refclk[X] is the source 111 gt_crx_ref_clk is the source
+    *  PSU_CRF_APB_APLL_CTRL_PRE_SRC                               0x0
 
-    * 6 bit divider
-    *  PSU_CRL_APB_LPD_LSBUS_CTRL_DIVISOR0                         0xf
+    * The integer portion of the feedback divider to the PLL
+    *  PSU_CRF_APB_APLL_CTRL_FBDIV                                 0x48
 
-    * 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_LPD_LSBUS_CTRL_SRCSEL                           0x2
+    * This turns on the divide by 2 that is inside of the PLL. This does not c
+    * hange the VCO frequency, just the output frequency
+    *  PSU_CRF_APB_APLL_CTRL_DIV2                                  0x1
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E00AC, 0x01003F07U ,0x01000F02U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A0020, 0x00717F00U ,0x00014800U)
     */
-	PSU_Mask_Write(CRL_APB_LPD_LSBUS_CTRL_OFFSET,
-		0x01003F07U, 0x01000F02U);
+	PSU_Mask_Write(CRF_APB_APLL_CTRL_OFFSET, 0x00717F00U, 0x00014800U);
 /*##################################################################### */
 
     /*
-    * Register : DBG_LPD_CTRL @ 0XFF5E00B0
-
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_DBG_LPD_CTRL_CLKACT                             0x1
-
-    * 6 bit divider
-    *  PSU_CRL_APB_DBG_LPD_CTRL_DIVISOR0                           0x6
+    * BY PASS PLL
+    */
+    /*
+    * Register : APLL_CTRL @ 0XFD1A0020
 
-    * 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_DBG_LPD_CTRL_SRCSEL                             0x2
+    * Bypasses the PLL clock. The usable clock will be determined from the POS
+    * T_SRC field. (This signal may only be toggled after 4 cycles of the old
+    * clock and 4 cycles of the new clock. This is not usually an issue, but d
+    * esigners must be aware.)
+    *  PSU_CRF_APB_APLL_CTRL_BYPASS                                1
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E00B0, 0x01003F07U ,0x01000602U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A0020, 0x00000008U ,0x00000008U)
     */
-	PSU_Mask_Write(CRL_APB_DBG_LPD_CTRL_OFFSET,
-		0x01003F07U, 0x01000602U);
+	PSU_Mask_Write(CRF_APB_APLL_CTRL_OFFSET, 0x00000008U, 0x00000008U);
 /*##################################################################### */
 
     /*
-    * Register : ADMA_REF_CTRL @ 0XFF5E00B8
-
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_ADMA_REF_CTRL_CLKACT                            0x1
-
-    * 6 bit divider
-    *  PSU_CRL_APB_ADMA_REF_CTRL_DIVISOR0                          0x3
+    * ASSERT RESET
+    */
+    /*
+    * Register : APLL_CTRL @ 0XFD1A0020
 
-    * 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_ADMA_REF_CTRL_SRCSEL                            0x2
+    * Asserts Reset to the PLL. When asserting reset, the PLL must already be
+    * in BYPASS.
+    *  PSU_CRF_APB_APLL_CTRL_RESET                                 1
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E00B8, 0x01003F07U ,0x01000302U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A0020, 0x00000001U ,0x00000001U)
     */
-	PSU_Mask_Write(CRL_APB_ADMA_REF_CTRL_OFFSET,
-		0x01003F07U, 0x01000302U);
+	PSU_Mask_Write(CRF_APB_APLL_CTRL_OFFSET, 0x00000001U, 0x00000001U);
 /*##################################################################### */
 
     /*
-    * Register : PL0_REF_CTRL @ 0XFF5E00C0
-
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_PL0_REF_CTRL_CLKACT                             0x1
-
-    * 6 bit divider
-    *  PSU_CRL_APB_PL0_REF_CTRL_DIVISOR1                           0x1
-
-    * 6 bit divider
-    *  PSU_CRL_APB_PL0_REF_CTRL_DIVISOR0                           0xf
+    * DEASSERT RESET
+    */
+    /*
+    * Register : APLL_CTRL @ 0XFD1A0020
 
-    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_PL0_REF_CTRL_SRCSEL                             0x0
+    * Asserts Reset to the PLL. When asserting reset, the PLL must already be
+    * in BYPASS.
+    *  PSU_CRF_APB_APLL_CTRL_RESET                                 0
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E00C0, 0x013F3F07U ,0x01010F00U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A0020, 0x00000001U ,0x00000000U)
     */
-	PSU_Mask_Write(CRL_APB_PL0_REF_CTRL_OFFSET,
-		0x013F3F07U, 0x01010F00U);
+	PSU_Mask_Write(CRF_APB_APLL_CTRL_OFFSET, 0x00000001U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : AMS_REF_CTRL @ 0XFF5E0108
+    * CHECK PLL STATUS
+    */
+    /*
+    * Register : PLL_STATUS @ 0XFD1A0044
 
-    * 6 bit divider
-    *  PSU_CRL_APB_AMS_REF_CTRL_DIVISOR1                           0x1
+    * APLL is locked
+    *  PSU_CRF_APB_PLL_STATUS_APLL_LOCK                            1
+    * (OFFSET, MASK, VALUE)      (0XFD1A0044, 0x00000001U ,0x00000001U)
+		*/
+	mask_poll(CRF_APB_PLL_STATUS_OFFSET, 0x00000001U);
 
-    * 6 bit divider
-    *  PSU_CRL_APB_AMS_REF_CTRL_DIVISOR0                           0x1e
+/*##################################################################### */
 
-    * 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
-    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    *  usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_AMS_REF_CTRL_SRCSEL                             0x2
+    /*
+    * REMOVE PLL BY PASS
+    */
+    /*
+    * Register : APLL_CTRL @ 0XFD1A0020
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_AMS_REF_CTRL_CLKACT                             0x1
+    * Bypasses the PLL clock. The usable clock will be determined from the POS
+    * T_SRC field. (This signal may only be toggled after 4 cycles of the old
+    * clock and 4 cycles of the new clock. This is not usually an issue, but d
+    * esigners must be aware.)
+    *  PSU_CRF_APB_APLL_CTRL_BYPASS                                0
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E0108, 0x013F3F07U ,0x01011E02U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A0020, 0x00000008U ,0x00000000U)
     */
-	PSU_Mask_Write(CRL_APB_AMS_REF_CTRL_OFFSET,
-		0x013F3F07U, 0x01011E02U);
+	PSU_Mask_Write(CRF_APB_APLL_CTRL_OFFSET, 0x00000008U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : DLL_REF_CTRL @ 0XFF5E0104
+    * Register : APLL_TO_LPD_CTRL @ 0XFD1A0048
 
-    * 000 = IOPLL; 001 = RPLL; (This signal may only be toggled after 4 cycles
-    *  of the old clock and 4 cycles of the new clock. This is not usually an
-    * issue, but designers must be aware.)
-    *  PSU_CRL_APB_DLL_REF_CTRL_SRCSEL                             0
+    * Divisor value for this clock.
+    *  PSU_CRF_APB_APLL_TO_LPD_CTRL_DIVISOR0                       0x3
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E0104, 0x00000007U ,0x00000000U)
+    * Control for a clock that will be generated in the FPD, but used in the L
+    * PD as a clock source for the peripheral clock muxes.
+    * (OFFSET, MASK, VALUE)      (0XFD1A0048, 0x00003F00U ,0x00000300U)
     */
-	PSU_Mask_Write(CRL_APB_DLL_REF_CTRL_OFFSET,
-		0x00000007U, 0x00000000U);
+	PSU_Mask_Write(CRF_APB_APLL_TO_LPD_CTRL_OFFSET,
+		0x00003F00U, 0x00000300U);
 /*##################################################################### */
 
     /*
-    * Register : TIMESTAMP_REF_CTRL @ 0XFF5E0128
+    * APLL FRAC CFG
+    */
+    /*
+    * DDR_PLL INIT
+    */
+    /*
+    * Register : DPLL_CFG @ 0XFD1A0030
 
-    * 6 bit divider
-    *  PSU_CRL_APB_TIMESTAMP_REF_CTRL_DIVISOR0                     0xf
+    * PLL loop filter resistor control
+    *  PSU_CRF_APB_DPLL_CFG_RES                                    0x2
 
-    * 1XX = pss_ref_clk; 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may
-    *  only be toggled after 4 cycles of the old clock and 4 cycles of the new
-    *  clock. This is not usually an issue, but designers must be aware.)
-    *  PSU_CRL_APB_TIMESTAMP_REF_CTRL_SRCSEL                       0x0
+    * PLL charge pump control
+    *  PSU_CRF_APB_DPLL_CFG_CP                                     0x3
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRL_APB_TIMESTAMP_REF_CTRL_CLKACT                       0x1
+    * PLL loop filter high frequency capacitor control
+    *  PSU_CRF_APB_DPLL_CFG_LFHF                                   0x3
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFF5E0128, 0x01003F07U ,0x01000F00U)
+    * Lock circuit counter setting
+    *  PSU_CRF_APB_DPLL_CFG_LOCK_CNT                               0x258
+
+    * Lock circuit configuration settings for lock windowsize
+    *  PSU_CRF_APB_DPLL_CFG_LOCK_DLY                               0x3f
+
+    * Helper data. Values are to be looked up in a table from Data Sheet
+    * (OFFSET, MASK, VALUE)      (0XFD1A0030, 0xFE7FEDEFU ,0x7E4B0C62U)
     */
-	PSU_Mask_Write(CRL_APB_TIMESTAMP_REF_CTRL_OFFSET,
-		0x01003F07U, 0x01000F00U);
+	PSU_Mask_Write(CRF_APB_DPLL_CFG_OFFSET, 0xFE7FEDEFU, 0x7E4B0C62U);
 /*##################################################################### */
 
     /*
-    * Register : SATA_REF_CTRL @ 0XFD1A00A0
+    * UPDATE FB_DIV
+    */
+    /*
+    * Register : DPLL_CTRL @ 0XFD1A002C
 
-    * 000 = IOPLL_TO_FPD; 010 = APLL; 011 = DPLL; (This signal may only be tog
-    * gled after 4 cycles of the old clock and 4 cycles of the new clock. This
-    *  is not usually an issue, but designers must be aware.)
-    *  PSU_CRF_APB_SATA_REF_CTRL_SRCSEL                            0x0
+    * Mux select for determining which clock feeds this PLL. 0XX pss_ref_clk i
+    * s the source 100 video clk is the source 101 pss_alt_ref_clk is the sour
+    * ce 110 aux_refclk[X] is the source 111 gt_crx_ref_clk is the source
+    *  PSU_CRF_APB_DPLL_CTRL_PRE_SRC                               0x0
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRF_APB_SATA_REF_CTRL_CLKACT                            0x1
+    * The integer portion of the feedback divider to the PLL
+    *  PSU_CRF_APB_DPLL_CTRL_FBDIV                                 0x40
 
-    * 6 bit divider
-    *  PSU_CRF_APB_SATA_REF_CTRL_DIVISOR0                          0x2
+    * This turns on the divide by 2 that is inside of the PLL. This does not c
+    * hange the VCO frequency, just the output frequency
+    *  PSU_CRF_APB_DPLL_CTRL_DIV2                                  0x1
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFD1A00A0, 0x01003F07U ,0x01000200U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A002C, 0x00717F00U ,0x00014000U)
     */
-	PSU_Mask_Write(CRF_APB_SATA_REF_CTRL_OFFSET,
-		0x01003F07U, 0x01000200U);
+	PSU_Mask_Write(CRF_APB_DPLL_CTRL_OFFSET, 0x00717F00U, 0x00014000U);
 /*##################################################################### */
 
     /*
-    * Register : PCIE_REF_CTRL @ 0XFD1A00B4
-
-    * 000 = IOPLL_TO_FPD; 010 = RPLL_TO_FPD; 011 = DPLL; (This signal may only
-    *  be toggled after 4 cycles of the old clock and 4 cycles of the new cloc
-    * k. This is not usually an issue, but designers must be aware.)
-    *  PSU_CRF_APB_PCIE_REF_CTRL_SRCSEL                            0x0
-
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRF_APB_PCIE_REF_CTRL_CLKACT                            0x1
+    * BY PASS PLL
+    */
+    /*
+    * Register : DPLL_CTRL @ 0XFD1A002C
 
-    * 6 bit divider
-    *  PSU_CRF_APB_PCIE_REF_CTRL_DIVISOR0                          0x2
+    * Bypasses the PLL clock. The usable clock will be determined from the POS
+    * T_SRC field. (This signal may only be toggled after 4 cycles of the old
+    * clock and 4 cycles of the new clock. This is not usually an issue, but d
+    * esigners must be aware.)
+    *  PSU_CRF_APB_DPLL_CTRL_BYPASS                                1
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFD1A00B4, 0x01003F07U ,0x01000200U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A002C, 0x00000008U ,0x00000008U)
     */
-	PSU_Mask_Write(CRF_APB_PCIE_REF_CTRL_OFFSET,
-		0x01003F07U, 0x01000200U);
+	PSU_Mask_Write(CRF_APB_DPLL_CTRL_OFFSET, 0x00000008U, 0x00000008U);
 /*##################################################################### */
 
     /*
-    * Register : DP_VIDEO_REF_CTRL @ 0XFD1A0070
+    * ASSERT RESET
+    */
+    /*
+    * Register : DPLL_CTRL @ 0XFD1A002C
 
-    * 6 bit divider
-    *  PSU_CRF_APB_DP_VIDEO_REF_CTRL_DIVISOR1                      0x1
+    * Asserts Reset to the PLL. When asserting reset, the PLL must already be
+    * in BYPASS.
+    *  PSU_CRF_APB_DPLL_CTRL_RESET                                 1
 
-    * 6 bit divider
-    *  PSU_CRF_APB_DP_VIDEO_REF_CTRL_DIVISOR0                      0x5
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A002C, 0x00000001U ,0x00000001U)
+    */
+	PSU_Mask_Write(CRF_APB_DPLL_CTRL_OFFSET, 0x00000001U, 0x00000001U);
+/*##################################################################### */
 
-    * 000 = VPLL; 010 = DPLL; 011 = RPLL_TO_FPD - might be using extra mux; (T
-    * his signal may only be toggled after 4 cycles of the old clock and 4 cyc
-    * les of the new clock. This is not usually an issue, but designers must b
-    * e aware.)
-    *  PSU_CRF_APB_DP_VIDEO_REF_CTRL_SRCSEL                        0x0
+    /*
+    * DEASSERT RESET
+    */
+    /*
+    * Register : DPLL_CTRL @ 0XFD1A002C
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRF_APB_DP_VIDEO_REF_CTRL_CLKACT                        0x1
+    * Asserts Reset to the PLL. When asserting reset, the PLL must already be
+    * in BYPASS.
+    *  PSU_CRF_APB_DPLL_CTRL_RESET                                 0
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFD1A0070, 0x013F3F07U ,0x01010500U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A002C, 0x00000001U ,0x00000000U)
     */
-	PSU_Mask_Write(CRF_APB_DP_VIDEO_REF_CTRL_OFFSET,
-		0x013F3F07U, 0x01010500U);
+	PSU_Mask_Write(CRF_APB_DPLL_CTRL_OFFSET, 0x00000001U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : DP_AUDIO_REF_CTRL @ 0XFD1A0074
+    * CHECK PLL STATUS
+    */
+    /*
+    * Register : PLL_STATUS @ 0XFD1A0044
 
-    * 6 bit divider
-    *  PSU_CRF_APB_DP_AUDIO_REF_CTRL_DIVISOR1                      0x1
+    * DPLL is locked
+    *  PSU_CRF_APB_PLL_STATUS_DPLL_LOCK                            1
+    * (OFFSET, MASK, VALUE)      (0XFD1A0044, 0x00000002U ,0x00000002U)
+		*/
+	mask_poll(CRF_APB_PLL_STATUS_OFFSET, 0x00000002U);
 
-    * 6 bit divider
-    *  PSU_CRF_APB_DP_AUDIO_REF_CTRL_DIVISOR0                      0xf
+/*##################################################################### */
 
-    * 000 = VPLL; 010 = DPLL; 011 = RPLL_TO_FPD - might be using extra mux; (T
-    * his signal may only be toggled after 4 cycles of the old clock and 4 cyc
-    * les of the new clock. This is not usually an issue, but designers must b
-    * e aware.)
-    *  PSU_CRF_APB_DP_AUDIO_REF_CTRL_SRCSEL                        0x3
+    /*
+    * REMOVE PLL BY PASS
+    */
+    /*
+    * Register : DPLL_CTRL @ 0XFD1A002C
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRF_APB_DP_AUDIO_REF_CTRL_CLKACT                        0x1
+    * Bypasses the PLL clock. The usable clock will be determined from the POS
+    * T_SRC field. (This signal may only be toggled after 4 cycles of the old
+    * clock and 4 cycles of the new clock. This is not usually an issue, but d
+    * esigners must be aware.)
+    *  PSU_CRF_APB_DPLL_CTRL_BYPASS                                0
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFD1A0074, 0x013F3F07U ,0x01010F03U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A002C, 0x00000008U ,0x00000000U)
     */
-	PSU_Mask_Write(CRF_APB_DP_AUDIO_REF_CTRL_OFFSET,
-		0x013F3F07U, 0x01010F03U);
+	PSU_Mask_Write(CRF_APB_DPLL_CTRL_OFFSET, 0x00000008U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : DP_STC_REF_CTRL @ 0XFD1A007C
-
-    * 6 bit divider
-    *  PSU_CRF_APB_DP_STC_REF_CTRL_DIVISOR1                        0x1
-
-    * 6 bit divider
-    *  PSU_CRF_APB_DP_STC_REF_CTRL_DIVISOR0                        0xe
-
-    * 000 = VPLL; 010 = DPLL; 011 = RPLL_TO_FPD; (This signal may only be togg
-    * led after 4 cycles of the old clock and 4 cycles of the new clock. This
-    * is not usually an issue, but designers must be aware.)
-    *  PSU_CRF_APB_DP_STC_REF_CTRL_SRCSEL                          0x3
+    * Register : DPLL_TO_LPD_CTRL @ 0XFD1A004C
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRF_APB_DP_STC_REF_CTRL_CLKACT                          0x1
+    * Divisor value for this clock.
+    *  PSU_CRF_APB_DPLL_TO_LPD_CTRL_DIVISOR0                       0x2
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFD1A007C, 0x013F3F07U ,0x01010E03U)
+    * Control for a clock that will be generated in the FPD, but used in the L
+    * PD as a clock source for the peripheral clock muxes.
+    * (OFFSET, MASK, VALUE)      (0XFD1A004C, 0x00003F00U ,0x00000200U)
     */
-	PSU_Mask_Write(CRF_APB_DP_STC_REF_CTRL_OFFSET,
-		0x013F3F07U, 0x01010E03U);
+	PSU_Mask_Write(CRF_APB_DPLL_TO_LPD_CTRL_OFFSET,
+		0x00003F00U, 0x00000200U);
 /*##################################################################### */
 
     /*
-    * Register : ACPU_CTRL @ 0XFD1A0060
+    * DPLL FRAC CFG
+    */
+    /*
+    * VIDEO_PLL INIT
+    */
+    /*
+    * Register : VPLL_CFG @ 0XFD1A003C
 
-    * 6 bit divider
-    *  PSU_CRF_APB_ACPU_CTRL_DIVISOR0                              0x1
+    * PLL loop filter resistor control
+    *  PSU_CRF_APB_VPLL_CFG_RES                                    0x2
 
-    * 000 = APLL; 010 = DPLL; 011 = VPLL; (This signal may only be toggled aft
-    * er 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    * usually an issue, but designers must be aware.)
-    *  PSU_CRF_APB_ACPU_CTRL_SRCSEL                                0x0
+    * PLL charge pump control
+    *  PSU_CRF_APB_VPLL_CFG_CP                                     0x4
 
-    * Clock active signal. Switch to 0 to disable the clock. For the half spee
-    * d APU Clock
-    *  PSU_CRF_APB_ACPU_CTRL_CLKACT_HALF                           0x1
+    * PLL loop filter high frequency capacitor control
+    *  PSU_CRF_APB_VPLL_CFG_LFHF                                   0x3
 
-    * Clock active signal. Switch to 0 to disable the clock. For the full spee
-    * d ACPUX Clock. This will shut off the high speed clock to the entire APU
-    *  PSU_CRF_APB_ACPU_CTRL_CLKACT_FULL                           0x1
+    * Lock circuit counter setting
+    *  PSU_CRF_APB_VPLL_CFG_LOCK_CNT                               0x258
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFD1A0060, 0x03003F07U ,0x03000100U)
+    * Lock circuit configuration settings for lock windowsize
+    *  PSU_CRF_APB_VPLL_CFG_LOCK_DLY                               0x3f
+
+    * Helper data. Values are to be looked up in a table from Data Sheet
+    * (OFFSET, MASK, VALUE)      (0XFD1A003C, 0xFE7FEDEFU ,0x7E4B0C82U)
     */
-	PSU_Mask_Write(CRF_APB_ACPU_CTRL_OFFSET, 0x03003F07U, 0x03000100U);
+	PSU_Mask_Write(CRF_APB_VPLL_CFG_OFFSET, 0xFE7FEDEFU, 0x7E4B0C82U);
 /*##################################################################### */
 
     /*
-    * Register : DBG_FPD_CTRL @ 0XFD1A0068
+    * UPDATE FB_DIV
+    */
+    /*
+    * Register : VPLL_CTRL @ 0XFD1A0038
 
-    * 6 bit divider
-    *  PSU_CRF_APB_DBG_FPD_CTRL_DIVISOR0                           0x2
+    * Mux select for determining which clock feeds this PLL. 0XX pss_ref_clk i
+    * s the source 100 video clk is the source 101 pss_alt_ref_clk is the sour
+    * ce 110 aux_refclk[X] is the source 111 gt_crx_ref_clk is the source
+    *  PSU_CRF_APB_VPLL_CTRL_PRE_SRC                               0x0
 
-    * 000 = IOPLL_TO_FPD; 010 = DPLL; 011 = APLL; (This signal may only be tog
-    * gled after 4 cycles of the old clock and 4 cycles of the new clock. This
-    *  is not usually an issue, but designers must be aware.)
-    *  PSU_CRF_APB_DBG_FPD_CTRL_SRCSEL                             0x0
+    * The integer portion of the feedback divider to the PLL
+    *  PSU_CRF_APB_VPLL_CTRL_FBDIV                                 0x5a
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRF_APB_DBG_FPD_CTRL_CLKACT                             0x1
+    * This turns on the divide by 2 that is inside of the PLL. This does not c
+    * hange the VCO frequency, just the output frequency
+    *  PSU_CRF_APB_VPLL_CTRL_DIV2                                  0x1
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFD1A0068, 0x01003F07U ,0x01000200U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A0038, 0x00717F00U ,0x00015A00U)
     */
-	PSU_Mask_Write(CRF_APB_DBG_FPD_CTRL_OFFSET,
-		0x01003F07U, 0x01000200U);
+	PSU_Mask_Write(CRF_APB_VPLL_CTRL_OFFSET, 0x00717F00U, 0x00015A00U);
 /*##################################################################### */
 
     /*
-    * Register : DDR_CTRL @ 0XFD1A0080
-
-    * 6 bit divider
-    *  PSU_CRF_APB_DDR_CTRL_DIVISOR0                               0x2
+    * BY PASS PLL
+    */
+    /*
+    * Register : VPLL_CTRL @ 0XFD1A0038
 
-    * 000 = DPLL; 001 = VPLL; (This signal may only be toggled after 4 cycles
-    * of the old clock and 4 cycles of the new clock. This is not usually an i
-    * ssue, but designers must be aware.)
-    *  PSU_CRF_APB_DDR_CTRL_SRCSEL                                 0x0
+    * Bypasses the PLL clock. The usable clock will be determined from the POS
+    * T_SRC field. (This signal may only be toggled after 4 cycles of the old
+    * clock and 4 cycles of the new clock. This is not usually an issue, but d
+    * esigners must be aware.)
+    *  PSU_CRF_APB_VPLL_CTRL_BYPASS                                1
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFD1A0080, 0x00003F07U ,0x00000200U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A0038, 0x00000008U ,0x00000008U)
     */
-	PSU_Mask_Write(CRF_APB_DDR_CTRL_OFFSET, 0x00003F07U, 0x00000200U);
+	PSU_Mask_Write(CRF_APB_VPLL_CTRL_OFFSET, 0x00000008U, 0x00000008U);
 /*##################################################################### */
 
     /*
-    * Register : GPU_REF_CTRL @ 0XFD1A0084
-
-    * 6 bit divider
-    *  PSU_CRF_APB_GPU_REF_CTRL_DIVISOR0                           0x1
+    * ASSERT RESET
+    */
+    /*
+    * Register : VPLL_CTRL @ 0XFD1A0038
 
-    * 000 = IOPLL_TO_FPD; 010 = VPLL; 011 = DPLL; (This signal may only be tog
-    * gled after 4 cycles of the old clock and 4 cycles of the new clock. This
-    *  is not usually an issue, but designers must be aware.)
-    *  PSU_CRF_APB_GPU_REF_CTRL_SRCSEL                             0x0
+    * Asserts Reset to the PLL. When asserting reset, the PLL must already be
+    * in BYPASS.
+    *  PSU_CRF_APB_VPLL_CTRL_RESET                                 1
 
-    * Clock active signal. Switch to 0 to disable the clock, which will stop c
-    * lock for GPU (and both Pixel Processors).
-    *  PSU_CRF_APB_GPU_REF_CTRL_CLKACT                             0x1
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A0038, 0x00000001U ,0x00000001U)
+    */
+	PSU_Mask_Write(CRF_APB_VPLL_CTRL_OFFSET, 0x00000001U, 0x00000001U);
+/*##################################################################### */
 
-    * Clock active signal for Pixel Processor. Switch to 0 to disable the cloc
-    * k only to this Pixel Processor
-    *  PSU_CRF_APB_GPU_REF_CTRL_PP0_CLKACT                         0x1
+    /*
+    * DEASSERT RESET
+    */
+    /*
+    * Register : VPLL_CTRL @ 0XFD1A0038
 
-    * Clock active signal for Pixel Processor. Switch to 0 to disable the cloc
-    * k only to this Pixel Processor
-    *  PSU_CRF_APB_GPU_REF_CTRL_PP1_CLKACT                         0x1
+    * Asserts Reset to the PLL. When asserting reset, the PLL must already be
+    * in BYPASS.
+    *  PSU_CRF_APB_VPLL_CTRL_RESET                                 0
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFD1A0084, 0x07003F07U ,0x07000100U)
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A0038, 0x00000001U ,0x00000000U)
     */
-	PSU_Mask_Write(CRF_APB_GPU_REF_CTRL_OFFSET,
-		0x07003F07U, 0x07000100U);
+	PSU_Mask_Write(CRF_APB_VPLL_CTRL_OFFSET, 0x00000001U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : GDMA_REF_CTRL @ 0XFD1A00B8
+    * CHECK PLL STATUS
+    */
+    /*
+    * Register : PLL_STATUS @ 0XFD1A0044
 
-    * 6 bit divider
-    *  PSU_CRF_APB_GDMA_REF_CTRL_DIVISOR0                          0x2
+    * VPLL is locked
+    *  PSU_CRF_APB_PLL_STATUS_VPLL_LOCK                            1
+    * (OFFSET, MASK, VALUE)      (0XFD1A0044, 0x00000004U ,0x00000004U)
+		*/
+	mask_poll(CRF_APB_PLL_STATUS_OFFSET, 0x00000004U);
 
-    * 000 = APLL; 010 = VPLL; 011 = DPLL; (This signal may only be toggled aft
-    * er 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    * usually an issue, but designers must be aware.)
-    *  PSU_CRF_APB_GDMA_REF_CTRL_SRCSEL                            0x0
+/*##################################################################### */
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRF_APB_GDMA_REF_CTRL_CLKACT                            0x1
+    /*
+    * REMOVE PLL BY PASS
+    */
+    /*
+    * Register : VPLL_CTRL @ 0XFD1A0038
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFD1A00B8, 0x01003F07U ,0x01000200U)
+    * Bypasses the PLL clock. The usable clock will be determined from the POS
+    * T_SRC field. (This signal may only be toggled after 4 cycles of the old
+    * clock and 4 cycles of the new clock. This is not usually an issue, but d
+    * esigners must be aware.)
+    *  PSU_CRF_APB_VPLL_CTRL_BYPASS                                0
+
+    * PLL Basic Control
+    * (OFFSET, MASK, VALUE)      (0XFD1A0038, 0x00000008U ,0x00000000U)
     */
-	PSU_Mask_Write(CRF_APB_GDMA_REF_CTRL_OFFSET,
-		0x01003F07U, 0x01000200U);
+	PSU_Mask_Write(CRF_APB_VPLL_CTRL_OFFSET, 0x00000008U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : DPDMA_REF_CTRL @ 0XFD1A00BC
-
-    * 6 bit divider
-    *  PSU_CRF_APB_DPDMA_REF_CTRL_DIVISOR0                         0x2
-
-    * 000 = APLL; 010 = VPLL; 011 = DPLL; (This signal may only be toggled aft
-    * er 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    * usually an issue, but designers must be aware.)
-    *  PSU_CRF_APB_DPDMA_REF_CTRL_SRCSEL                           0x0
+    * Register : VPLL_TO_LPD_CTRL @ 0XFD1A0050
 
-    * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRF_APB_DPDMA_REF_CTRL_CLKACT                           0x1
+    * Divisor value for this clock.
+    *  PSU_CRF_APB_VPLL_TO_LPD_CTRL_DIVISOR0                       0x3
 
-    * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFD1A00BC, 0x01003F07U ,0x01000200U)
+    * Control for a clock that will be generated in the FPD, but used in the L
+    * PD as a clock source for the peripheral clock muxes.
+    * (OFFSET, MASK, VALUE)      (0XFD1A0050, 0x00003F00U ,0x00000300U)
     */
-	PSU_Mask_Write(CRF_APB_DPDMA_REF_CTRL_OFFSET,
-		0x01003F07U, 0x01000200U);
+	PSU_Mask_Write(CRF_APB_VPLL_TO_LPD_CTRL_OFFSET,
+		0x00003F00U, 0x00000300U);
 /*##################################################################### */
 
     /*
-    * Register : TOPSW_MAIN_CTRL @ 0XFD1A00C0
+    * VIDEO FRAC CFG
+    */
 
-    * 6 bit divider
-    *  PSU_CRF_APB_TOPSW_MAIN_CTRL_DIVISOR0                        0x2
+	return 1;
+#endif /* PSU_INIT_TABLE */
+}
 
-    * 000 = APLL; 010 = VPLL; 011 = DPLL; (This signal may only be toggled aft
-    * er 4 cycles of the old clock and 4 cycles of the new clock. This is not
-    * usually an issue, but designers must be aware.)
-    *  PSU_CRF_APB_TOPSW_MAIN_CTRL_SRCSEL                          0x3
+unsigned long psu_clock_init_data(void)
+{
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_clock_init_data_table);
+#else
+    /*
+    * CLOCK CONTROL SLCR REGISTER
+    */
+    /*
+    * Register : GEM3_REF_CTRL @ 0XFF5E005C
+
+    * Clock active for the RX channel
+    *  PSU_CRL_APB_GEM3_REF_CTRL_RX_CLKACT                         0x1
 
     * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRF_APB_TOPSW_MAIN_CTRL_CLKACT                          0x1
+    *  PSU_CRL_APB_GEM3_REF_CTRL_CLKACT                            0x1
+
+    * 6 bit divider
+    *  PSU_CRL_APB_GEM3_REF_CTRL_DIVISOR1                          0x1
+
+    * 6 bit divider
+    *  PSU_CRL_APB_GEM3_REF_CTRL_DIVISOR0                          0xc
+
+    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_GEM3_REF_CTRL_SRCSEL                            0x0
 
     * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFD1A00C0, 0x01003F07U ,0x01000203U)
+    * (OFFSET, MASK, VALUE)      (0XFF5E005C, 0x063F3F07U ,0x06010C00U)
     */
-	PSU_Mask_Write(CRF_APB_TOPSW_MAIN_CTRL_OFFSET,
-		0x01003F07U, 0x01000203U);
+	PSU_Mask_Write(CRL_APB_GEM3_REF_CTRL_OFFSET,
+		0x063F3F07U, 0x06010C00U);
 /*##################################################################### */
 
     /*
-    * Register : TOPSW_LSBUS_CTRL @ 0XFD1A00C4
+    * Register : GEM_TSU_REF_CTRL @ 0XFF5E0100
 
     * 6 bit divider
-    *  PSU_CRF_APB_TOPSW_LSBUS_CTRL_DIVISOR0                       0x5
+    *  PSU_CRL_APB_GEM_TSU_REF_CTRL_DIVISOR0                       0x6
 
-    * 000 = APLL; 010 = IOPLL_TO_FPD; 011 = DPLL; (This signal may only be tog
-    * gled after 4 cycles of the old clock and 4 cycles of the new clock. This
-    *  is not usually an issue, but designers must be aware.)
-    *  PSU_CRF_APB_TOPSW_LSBUS_CTRL_SRCSEL                         0x2
+    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_GEM_TSU_REF_CTRL_SRCSEL                         0x0
+
+    * 6 bit divider
+    *  PSU_CRL_APB_GEM_TSU_REF_CTRL_DIVISOR1                       0x1
 
     * Clock active signal. Switch to 0 to disable the clock
-    *  PSU_CRF_APB_TOPSW_LSBUS_CTRL_CLKACT                         0x1
+    *  PSU_CRL_APB_GEM_TSU_REF_CTRL_CLKACT                         0x1
 
     * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFD1A00C4, 0x01003F07U ,0x01000502U)
+    * (OFFSET, MASK, VALUE)      (0XFF5E0100, 0x013F3F07U ,0x01010600U)
     */
-	PSU_Mask_Write(CRF_APB_TOPSW_LSBUS_CTRL_OFFSET,
-		0x01003F07U, 0x01000502U);
+	PSU_Mask_Write(CRL_APB_GEM_TSU_REF_CTRL_OFFSET,
+		0x013F3F07U, 0x01010600U);
 /*##################################################################### */
 
     /*
-    * Register : DBG_TSTMP_CTRL @ 0XFD1A00F8
+    * Register : USB0_BUS_REF_CTRL @ 0XFF5E0060
+
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_USB0_BUS_REF_CTRL_CLKACT                        0x1
 
     * 6 bit divider
-    *  PSU_CRF_APB_DBG_TSTMP_CTRL_DIVISOR0                         0x2
+    *  PSU_CRL_APB_USB0_BUS_REF_CTRL_DIVISOR1                      0x1
 
-    * 000 = IOPLL_TO_FPD; 010 = DPLL; 011 = APLL; (This signal may only be tog
-    * gled after 4 cycles of the old clock and 4 cycles of the new clock. This
-    *  is not usually an issue, but designers must be aware.)
-    *  PSU_CRF_APB_DBG_TSTMP_CTRL_SRCSEL                           0x0
+    * 6 bit divider
+    *  PSU_CRL_APB_USB0_BUS_REF_CTRL_DIVISOR0                      0x6
+
+    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_USB0_BUS_REF_CTRL_SRCSEL                        0x0
 
     * This register controls this reference clock
-    * (OFFSET, MASK, VALUE)      (0XFD1A00F8, 0x00003F07U ,0x00000200U)
+    * (OFFSET, MASK, VALUE)      (0XFF5E0060, 0x023F3F07U ,0x02010600U)
     */
-	PSU_Mask_Write(CRF_APB_DBG_TSTMP_CTRL_OFFSET,
-		0x00003F07U, 0x00000200U);
+	PSU_Mask_Write(CRL_APB_USB0_BUS_REF_CTRL_OFFSET,
+		0x023F3F07U, 0x02010600U);
 /*##################################################################### */
 
     /*
-    * Register : IOU_TTC_APB_CLK @ 0XFF180380
+    * Register : USB3_DUAL_REF_CTRL @ 0XFF5E004C
 
-    * 00" = Select the APB switch clock for the APB interface of TTC0'01" = Se
-    * lect the PLL ref clock for the APB interface of TTC0'10" = Select the R5
-    *  clock for the APB interface of TTC0
-    *  PSU_IOU_SLCR_IOU_TTC_APB_CLK_TTC0_SEL                       0
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_USB3_DUAL_REF_CTRL_CLKACT                       0x1
 
-    * 00" = Select the APB switch clock for the APB interface of TTC1'01" = Se
-    * lect the PLL ref clock for the APB interface of TTC1'10" = Select the R5
-    *  clock for the APB interface of TTC1
-    *  PSU_IOU_SLCR_IOU_TTC_APB_CLK_TTC1_SEL                       0
+    * 6 bit divider
+    *  PSU_CRL_APB_USB3_DUAL_REF_CTRL_DIVISOR1                     0x3
 
-    * 00" = Select the APB switch clock for the APB interface of TTC2'01" = Se
-    * lect the PLL ref clock for the APB interface of TTC2'10" = Select the R5
-    *  clock for the APB interface of TTC2
-    *  PSU_IOU_SLCR_IOU_TTC_APB_CLK_TTC2_SEL                       0
+    * 6 bit divider
+    *  PSU_CRL_APB_USB3_DUAL_REF_CTRL_DIVISOR0                     0x19
 
-    * 00" = Select the APB switch clock for the APB interface of TTC3'01" = Se
-    * lect the PLL ref clock for the APB interface of TTC3'10" = Select the R5
-    *  clock for the APB interface of TTC3
-    *  PSU_IOU_SLCR_IOU_TTC_APB_CLK_TTC3_SEL                       0
+    * 000 = IOPLL; 010 = RPLL; 011 = DPLL. (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_USB3_DUAL_REF_CTRL_SRCSEL                       0x0
 
-    * TTC APB clock select
-    * (OFFSET, MASK, VALUE)      (0XFF180380, 0x000000FFU ,0x00000000U)
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E004C, 0x023F3F07U ,0x02031900U)
     */
-	PSU_Mask_Write(IOU_SLCR_IOU_TTC_APB_CLK_OFFSET,
-		0x000000FFU, 0x00000000U);
+	PSU_Mask_Write(CRL_APB_USB3_DUAL_REF_CTRL_OFFSET,
+		0x023F3F07U, 0x02031900U);
 /*##################################################################### */
 
     /*
-    * Register : WDT_CLK_SEL @ 0XFD610100
+    * Register : QSPI_REF_CTRL @ 0XFF5E0068
 
-    * System watchdog timer clock source selection: 0: Internal APB clock 1: E
-    * xternal (PL clock via EMIO or Pinout clock via MIO)
-    *  PSU_FPD_SLCR_WDT_CLK_SEL_SELECT                             0
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_QSPI_REF_CTRL_CLKACT                            0x1
 
-    * SWDT clock source select
-    * (OFFSET, MASK, VALUE)      (0XFD610100, 0x00000001U ,0x00000000U)
+    * 6 bit divider
+    *  PSU_CRL_APB_QSPI_REF_CTRL_DIVISOR1                          0x1
+
+    * 6 bit divider
+    *  PSU_CRL_APB_QSPI_REF_CTRL_DIVISOR0                          0xc
+
+    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_QSPI_REF_CTRL_SRCSEL                            0x0
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E0068, 0x013F3F07U ,0x01010C00U)
     */
-	PSU_Mask_Write(FPD_SLCR_WDT_CLK_SEL_OFFSET,
-		0x00000001U, 0x00000000U);
+	PSU_Mask_Write(CRL_APB_QSPI_REF_CTRL_OFFSET,
+		0x013F3F07U, 0x01010C00U);
 /*##################################################################### */
 
     /*
-    * Register : WDT_CLK_SEL @ 0XFF180300
+    * Register : SDIO1_REF_CTRL @ 0XFF5E0070
 
-    * System watchdog timer clock source selection: 0: internal clock APB cloc
-    * k 1: external clock from PL via EMIO, or from pinout via MIO
-    *  PSU_IOU_SLCR_WDT_CLK_SEL_SELECT                             0
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_SDIO1_REF_CTRL_CLKACT                           0x1
 
-    * SWDT clock source select
-    * (OFFSET, MASK, VALUE)      (0XFF180300, 0x00000001U ,0x00000000U)
+    * 6 bit divider
+    *  PSU_CRL_APB_SDIO1_REF_CTRL_DIVISOR1                         0x1
+
+    * 6 bit divider
+    *  PSU_CRL_APB_SDIO1_REF_CTRL_DIVISOR0                         0x8
+
+    * 000 = IOPLL; 010 = RPLL; 011 = VPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_SDIO1_REF_CTRL_SRCSEL                           0x0
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E0070, 0x013F3F07U ,0x01010800U)
     */
-	PSU_Mask_Write(IOU_SLCR_WDT_CLK_SEL_OFFSET,
-		0x00000001U, 0x00000000U);
+	PSU_Mask_Write(CRL_APB_SDIO1_REF_CTRL_OFFSET,
+		0x013F3F07U, 0x01010800U);
 /*##################################################################### */
 
     /*
-    * Register : CSUPMU_WDT_CLK_SEL @ 0XFF410050
+    * Register : SDIO_CLK_CTRL @ 0XFF18030C
 
-    * System watchdog timer clock source selection: 0: internal clock APB cloc
-    * k 1: external clock pss_ref_clk
-    *  PSU_LPD_SLCR_CSUPMU_WDT_CLK_SEL_SELECT                      0
+    * MIO pad selection for sdio1_rx_clk (feedback clock from the PAD) 0: MIO
+    * [51] 1: MIO [76]
+    *  PSU_IOU_SLCR_SDIO_CLK_CTRL_SDIO1_RX_SRC_SEL                 0
 
-    * SWDT clock source select
-    * (OFFSET, MASK, VALUE)      (0XFF410050, 0x00000001U ,0x00000000U)
+    * SoC Debug Clock Control
+    * (OFFSET, MASK, VALUE)      (0XFF18030C, 0x00020000U ,0x00000000U)
     */
-	PSU_Mask_Write(LPD_SLCR_CSUPMU_WDT_CLK_SEL_OFFSET,
-		0x00000001U, 0x00000000U);
+	PSU_Mask_Write(IOU_SLCR_SDIO_CLK_CTRL_OFFSET,
+		0x00020000U, 0x00000000U);
 /*##################################################################### */
 
-
-	return 1;
-}
-unsigned long psu_ddr_init_data(void)
-{
     /*
-    * DDR INITIALIZATION
-    */
-    /*
-    * DDR CONTROLLER RESET
+    * Register : UART0_REF_CTRL @ 0XFF5E0074
+
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_UART0_REF_CTRL_CLKACT                           0x1
+
+    * 6 bit divider
+    *  PSU_CRL_APB_UART0_REF_CTRL_DIVISOR1                         0x1
+
+    * 6 bit divider
+    *  PSU_CRL_APB_UART0_REF_CTRL_DIVISOR0                         0xf
+
+    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_UART0_REF_CTRL_SRCSEL                           0x0
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E0074, 0x013F3F07U ,0x01010F00U)
     */
+	PSU_Mask_Write(CRL_APB_UART0_REF_CTRL_OFFSET,
+		0x013F3F07U, 0x01010F00U);
+/*##################################################################### */
+
     /*
-    * Register : RST_DDR_SS @ 0XFD1A0108
+    * Register : UART1_REF_CTRL @ 0XFF5E0078
 
-    * DDR block level reset inside of the DDR Sub System
-    *  PSU_CRF_APB_RST_DDR_SS_DDR_RESET                            0X1
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_UART1_REF_CTRL_CLKACT                           0x1
 
-    * DDR sub system block level reset
-    * (OFFSET, MASK, VALUE)      (0XFD1A0108, 0x00000008U ,0x00000008U)
+    * 6 bit divider
+    *  PSU_CRL_APB_UART1_REF_CTRL_DIVISOR1                         0x1
+
+    * 6 bit divider
+    *  PSU_CRL_APB_UART1_REF_CTRL_DIVISOR0                         0xf
+
+    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_UART1_REF_CTRL_SRCSEL                           0x0
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E0078, 0x013F3F07U ,0x01010F00U)
     */
-	PSU_Mask_Write(CRF_APB_RST_DDR_SS_OFFSET, 0x00000008U, 0x00000008U);
+	PSU_Mask_Write(CRL_APB_UART1_REF_CTRL_OFFSET,
+		0x013F3F07U, 0x01010F00U);
 /*##################################################################### */
 
     /*
-    * Register : MSTR @ 0XFD070000
+    * Register : I2C0_REF_CTRL @ 0XFF5E0120
 
-    * Indicates the configuration of the device used in the system. - 00 - x4
-    * device - 01 - x8 device - 10 - x16 device - 11 - x32 device
-    *  PSU_DDRC_MSTR_DEVICE_CONFIG                                 0x1
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_I2C0_REF_CTRL_CLKACT                            0x1
 
-    * Choose which registers are used. - 0 - Original registers - 1 - Shadow r
-    * egisters
-    *  PSU_DDRC_MSTR_FREQUENCY_MODE                                0x0
+    * 6 bit divider
+    *  PSU_CRL_APB_I2C0_REF_CTRL_DIVISOR1                          0x1
 
-    * Only present for multi-rank configurations. Each bit represents one rank
-    * . For two-rank configurations, only bits[25:24] are present. - 1 - popul
-    * ated - 0 - unpopulated LSB is the lowest rank number. For 2 ranks follow
-    * ing combinations are legal: - 01 - One rank - 11 - Two ranks - Others -
-    * Reserved. For 4 ranks following combinations are legal: - 0001 - One ran
-    * k - 0011 - Two ranks - 1111 - Four ranks
-    *  PSU_DDRC_MSTR_ACTIVE_RANKS                                  0x1
+    * 6 bit divider
+    *  PSU_CRL_APB_I2C0_REF_CTRL_DIVISOR0                          0xf
 
-    * SDRAM burst length used: - 0001 - Burst length of 2 (only supported for
-    * mDDR) - 0010 - Burst length of 4 - 0100 - Burst length of 8 - 1000 - Bur
-    * st length of 16 (only supported for mDDR, LPDDR2, and LPDDR4) All other
-    * values are reserved. This controls the burst size used to access the SDR
-    * AM. This must match the burst length mode register setting in the SDRAM.
-    *  (For BC4/8 on-the-fly mode of DDR3 and DDR4, set this field to 0x0100)
-    * Burst length of 2 is not supported with AXI ports when MEMC_BURST_LENGTH
-    *  is 8. Burst length of 2 is only supported with MEMC_FREQ_RATIO = 1
-    *  PSU_DDRC_MSTR_BURST_RDWR                                    0x4
+    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_I2C0_REF_CTRL_SRCSEL                            0x0
 
-    * Set to 1 when the uMCTL2 and DRAM has to be put in DLL-off mode for low
-    * frequency operation. Set to 0 to put uMCTL2 and DRAM in DLL-on mode for
-    * normal frequency operation. If DDR4 CRC/parity retry is enabled (CRCPARC
-    * TL1.crc_parity_retry_enable = 1), dll_off_mode is not supported, and thi
-    * s bit must be set to '0'.
-    *  PSU_DDRC_MSTR_DLL_OFF_MODE                                  0x0
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E0120, 0x013F3F07U ,0x01010F00U)
+    */
+	PSU_Mask_Write(CRL_APB_I2C0_REF_CTRL_OFFSET,
+		0x013F3F07U, 0x01010F00U);
+/*##################################################################### */
 
-    * Selects proportion of DQ bus width that is used by the SDRAM - 00 - Full
-    *  DQ bus width to SDRAM - 01 - Half DQ bus width to SDRAM - 10 - Quarter
-    * DQ bus width to SDRAM - 11 - Reserved. Note that half bus width mode is
-    * only supported when the SDRAM bus width is a multiple of 16, and quarter
-    *  bus width mode is only supported when the SDRAM bus width is a multiple
-    *  of 32 and the configuration parameter MEMC_QBUS_SUPPORT is set. Bus wid
-    * th refers to DQ bus width (excluding any ECC width).
-    *  PSU_DDRC_MSTR_DATA_BUS_WIDTH                                0x0
+    /*
+    * Register : I2C1_REF_CTRL @ 0XFF5E0124
 
-    * 1 indicates put the DRAM in geardown mode (2N) and 0 indicates put the D
-    * RAM in normal mode (1N). This register can be changed, only when the Con
-    * troller is in self-refresh mode. This signal must be set the same value
-    * as MR3 bit A3. Note: Geardown mode is not supported if the configuration
-    *  parameter MEMC_CMD_RTN2IDLE is set
-    *  PSU_DDRC_MSTR_GEARDOWN_MODE                                 0x0
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_I2C1_REF_CTRL_CLKACT                            0x1
 
-    * If 1, then uMCTL2 uses 2T timing. Otherwise, uses 1T timing. In 2T timin
-    * g, all command signals (except chip select) are held for 2 clocks on the
-    *  SDRAM bus. Chip select is asserted on the second cycle of the command N
-    * ote: 2T timing is not supported in LPDDR2/LPDDR3/LPDDR4 mode Note: 2T ti
-    * ming is not supported if the configuration parameter MEMC_CMD_RTN2IDLE i
-    * s set Note: 2T timing is not supported in DDR4 geardown mode.
-    *  PSU_DDRC_MSTR_EN_2T_TIMING_MODE                             0x0
+    * 6 bit divider
+    *  PSU_CRL_APB_I2C1_REF_CTRL_DIVISOR1                          0x1
 
-    * When set, enable burst-chop in DDR3/DDR4. Burst Chop for Reads is exerci
-    * sed only in HIF configurations (UMCTL2_INCL_ARB not set) and if in full
-    * bus width mode (MSTR.data_bus_width = 00). Burst Chop for Writes is exer
-    * cised only if Partial Writes enabled (UMCTL2_PARTIAL_WR=1) and if CRC is
-    *  disabled (CRCPARCTL1.crc_enable = 0). If DDR4 CRC/parity retry is enabl
-    * ed (CRCPARCTL1.crc_parity_retry_enable = 1), burst chop is not supported
-    * , and this bit must be set to '0'
-    *  PSU_DDRC_MSTR_BURSTCHOP                                     0x0
+    * 6 bit divider
+    *  PSU_CRL_APB_I2C1_REF_CTRL_DIVISOR0                          0xf
 
-    * Select LPDDR4 SDRAM - 1 - LPDDR4 SDRAM device in use. - 0 - non-LPDDR4 d
-    * evice in use Present only in designs configured to support LPDDR4.
-    *  PSU_DDRC_MSTR_LPDDR4                                        0x0
+    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_I2C1_REF_CTRL_SRCSEL                            0x0
 
-    * Select DDR4 SDRAM - 1 - DDR4 SDRAM device in use. - 0 - non-DDR4 device
-    * in use Present only in designs configured to support DDR4.
-    *  PSU_DDRC_MSTR_DDR4                                          0x1
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E0124, 0x013F3F07U ,0x01010F00U)
+    */
+	PSU_Mask_Write(CRL_APB_I2C1_REF_CTRL_OFFSET,
+		0x013F3F07U, 0x01010F00U);
+/*##################################################################### */
 
-    * Select LPDDR3 SDRAM - 1 - LPDDR3 SDRAM device in use. - 0 - non-LPDDR3 d
-    * evice in use Present only in designs configured to support LPDDR3.
-    *  PSU_DDRC_MSTR_LPDDR3                                        0x0
+    /*
+    * Register : CAN1_REF_CTRL @ 0XFF5E0088
 
-    * Select LPDDR2 SDRAM - 1 - LPDDR2 SDRAM device in use. - 0 - non-LPDDR2 d
-    * evice in use Present only in designs configured to support LPDDR2.
-    *  PSU_DDRC_MSTR_LPDDR2                                        0x0
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_CAN1_REF_CTRL_CLKACT                            0x1
 
-    * Select DDR3 SDRAM - 1 - DDR3 SDRAM device in use - 0 - non-DDR3 SDRAM de
-    * vice in use Only present in designs that support DDR3.
-    *  PSU_DDRC_MSTR_DDR3                                          0x0
+    * 6 bit divider
+    *  PSU_CRL_APB_CAN1_REF_CTRL_DIVISOR1                          0x1
 
-    * Master Register
-    * (OFFSET, MASK, VALUE)      (0XFD070000, 0xE30FBE3DU ,0x41040010U)
+    * 6 bit divider
+    *  PSU_CRL_APB_CAN1_REF_CTRL_DIVISOR0                          0xf
+
+    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_CAN1_REF_CTRL_SRCSEL                            0x0
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E0088, 0x013F3F07U ,0x01010F00U)
     */
-	PSU_Mask_Write(DDRC_MSTR_OFFSET, 0xE30FBE3DU, 0x41040010U);
+	PSU_Mask_Write(CRL_APB_CAN1_REF_CTRL_OFFSET,
+		0x013F3F07U, 0x01010F00U);
 /*##################################################################### */
 
     /*
-    * Register : MRCTRL0 @ 0XFD070010
+    * Register : CPU_R5_CTRL @ 0XFF5E0090
 
-    * Setting this register bit to 1 triggers a mode register read or write op
-    * eration. When the MR operation is complete, the uMCTL2 automatically cle
-    * ars this bit. The other register fields of this register must be written
-    *  in a separate APB transaction, before setting this mr_wr bit. It is rec
-    * ommended NOT to set this signal if in Init, Deep power-down or MPSM oper
-    * ating modes.
-    *  PSU_DDRC_MRCTRL0_MR_WR                                      0x0
+    * Turing this off will shut down the OCM, some parts of the APM, and preve
+    * nt transactions going from the FPD to the LPD and could lead to system h
+    * ang
+    *  PSU_CRL_APB_CPU_R5_CTRL_CLKACT                              0x1
 
-    * Address of the mode register that is to be written to. - 0000 - MR0 - 00
-    * 01 - MR1 - 0010 - MR2 - 0011 - MR3 - 0100 - MR4 - 0101 - MR5 - 0110 - MR
-    * 6 - 0111 - MR7 Don't Care for LPDDR2/LPDDR3/LPDDR4 (see MRCTRL1.mr_data
-    * for mode register addressing in LPDDR2/LPDDR3/LPDDR4) This signal is als
-    * o used for writing to control words of RDIMMs. In that case, it correspo
-    * nds to the bank address bits sent to the RDIMM In case of DDR4, the bit[
-    * 3:2] corresponds to the bank group bits. Therefore, the bit[3] as well a
-    * s the bit[2:0] must be set to an appropriate value which is considered b
-    * oth the Address Mirroring of UDIMMs/RDIMMs and the Output Inversion of R
-    * DIMMs.
-    *  PSU_DDRC_MRCTRL0_MR_ADDR                                    0x0
+    * 6 bit divider
+    *  PSU_CRL_APB_CPU_R5_CTRL_DIVISOR0                            0x3
 
-    * Controls which rank is accessed by MRCTRL0.mr_wr. Normally, it is desire
-    * d to access all ranks, so all bits should be set to 1. However, for mult
-    * i-rank UDIMMs/RDIMMs which implement address mirroring, it may be necess
-    * ary to access ranks individually. Examples (assume uMCTL2 is configured
-    * for 4 ranks): - 0x1 - select rank 0 only - 0x2 - select rank 1 only - 0x
-    * 5 - select ranks 0 and 2 - 0xA - select ranks 1 and 3 - 0xF - select ran
-    * ks 0, 1, 2 and 3
-    *  PSU_DDRC_MRCTRL0_MR_RANK                                    0x3
+    * 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_CPU_R5_CTRL_SRCSEL                              0x2
 
-    * Indicates whether Software intervention is allowed via MRCTRL0/MRCTRL1 b
-    * efore automatic SDRAM initialization routine or not. For DDR4, this bit
-    * can be used to initialize the DDR4 RCD (MR7) before automatic SDRAM init
-    * ialization. For LPDDR4, this bit can be used to program additional mode
-    * registers before automatic SDRAM initialization if necessary. Note: This
-    *  must be cleared to 0 after completing Software operation. Otherwise, SD
-    * RAM initialization routine will not re-start. - 0 - Software interventio
-    * n is not allowed - 1 - Software intervention is allowed
-    *  PSU_DDRC_MRCTRL0_SW_INIT_INT                                0x0
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E0090, 0x01003F07U ,0x01000302U)
+    */
+	PSU_Mask_Write(CRL_APB_CPU_R5_CTRL_OFFSET, 0x01003F07U, 0x01000302U);
+/*##################################################################### */
 
-    * Indicates whether the mode register operation is MRS in PDA mode or not
-    * - 0 - MRS - 1 - MRS in Per DRAM Addressability mode
-    *  PSU_DDRC_MRCTRL0_PDA_EN                                     0x0
+    /*
+    * Register : IOU_SWITCH_CTRL @ 0XFF5E009C
 
-    * Indicates whether the mode register operation is MRS or WR/RD for MPR (o
-    * nly supported for DDR4) - 0 - MRS - 1 - WR/RD for MPR
-    *  PSU_DDRC_MRCTRL0_MPR_EN                                     0x0
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_IOU_SWITCH_CTRL_CLKACT                          0x1
 
-    * Indicates whether the mode register operation is read or write. Only use
-    * d for LPDDR2/LPDDR3/LPDDR4/DDR4. - 0 - Write - 1 - Read
-    *  PSU_DDRC_MRCTRL0_MR_TYPE                                    0x0
+    * 6 bit divider
+    *  PSU_CRL_APB_IOU_SWITCH_CTRL_DIVISOR0                        0x6
 
-    * Mode Register Read/Write Control Register 0. Note: Do not enable more th
-    * an one of the following fields simultaneously: - sw_init_int - pda_en -
-    * mpr_en
-    * (OFFSET, MASK, VALUE)      (0XFD070010, 0x8000F03FU ,0x00000030U)
+    * 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_IOU_SWITCH_CTRL_SRCSEL                          0x2
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E009C, 0x01003F07U ,0x01000602U)
     */
-	PSU_Mask_Write(DDRC_MRCTRL0_OFFSET, 0x8000F03FU, 0x00000030U);
+	PSU_Mask_Write(CRL_APB_IOU_SWITCH_CTRL_OFFSET,
+		0x01003F07U, 0x01000602U);
 /*##################################################################### */
 
     /*
-    * Register : DERATEEN @ 0XFD070020
-
-    * Derate value of tRC for LPDDR4 - 0 - Derating uses +1. - 1 - Derating us
-    * es +2. - 2 - Derating uses +3. - 3 - Derating uses +4. Present only in d
-    * esigns configured to support LPDDR4. The required number of cycles for d
-    * erating can be determined by dividing 3.75ns by the core_ddrc_core_clk p
-    * eriod, and rounding up the next integer.
-    *  PSU_DDRC_DERATEEN_RC_DERATE_VALUE                           0x2
+    * Register : PCAP_CTRL @ 0XFF5E00A4
 
-    * Derate byte Present only in designs configured to support LPDDR2/LPDDR3/
-    * LPDDR4 Indicates which byte of the MRR data is used for derating. The ma
-    * ximum valid value depends on MEMC_DRAM_TOTAL_DATA_WIDTH.
-    *  PSU_DDRC_DERATEEN_DERATE_BYTE                               0x0
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_PCAP_CTRL_CLKACT                                0x1
 
-    * Derate value - 0 - Derating uses +1. - 1 - Derating uses +2. Present onl
-    * y in designs configured to support LPDDR2/LPDDR3/LPDDR4 Set to 0 for all
-    *  LPDDR2 speed grades as derating value of +1.875 ns is less than a core_
-    * ddrc_core_clk period. Can be 0 or 1 for LPDDR3/LPDDR4, depending if +1.8
-    * 75 ns is less than a core_ddrc_core_clk period or not.
-    *  PSU_DDRC_DERATEEN_DERATE_VALUE                              0x0
+    * 6 bit divider
+    *  PSU_CRL_APB_PCAP_CTRL_DIVISOR0                              0x8
 
-    * Enables derating - 0 - Timing parameter derating is disabled - 1 - Timin
-    * g parameter derating is enabled using MR4 read value. Present only in de
-    * signs configured to support LPDDR2/LPDDR3/LPDDR4 This field must be set
-    * to '0' for non-LPDDR2/LPDDR3/LPDDR4 mode.
-    *  PSU_DDRC_DERATEEN_DERATE_ENABLE                             0x0
+    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_PCAP_CTRL_SRCSEL                                0x0
 
-    * Temperature Derate Enable Register
-    * (OFFSET, MASK, VALUE)      (0XFD070020, 0x000003F3U ,0x00000200U)
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E00A4, 0x01003F07U ,0x01000800U)
     */
-	PSU_Mask_Write(DDRC_DERATEEN_OFFSET, 0x000003F3U, 0x00000200U);
+	PSU_Mask_Write(CRL_APB_PCAP_CTRL_OFFSET, 0x01003F07U, 0x01000800U);
 /*##################################################################### */
 
     /*
-    * Register : DERATEINT @ 0XFD070024
+    * Register : LPD_SWITCH_CTRL @ 0XFF5E00A8
 
-    * Interval between two MR4 reads, used to derate the timing parameters. Pr
-    * esent only in designs configured to support LPDDR2/LPDDR3/LPDDR4. This r
-    * egister must not be set to zero
-    *  PSU_DDRC_DERATEINT_MR4_READ_INTERVAL                        0x800000
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_LPD_SWITCH_CTRL_CLKACT                          0x1
 
-    * Temperature Derate Interval Register
-    * (OFFSET, MASK, VALUE)      (0XFD070024, 0xFFFFFFFFU ,0x00800000U)
+    * 6 bit divider
+    *  PSU_CRL_APB_LPD_SWITCH_CTRL_DIVISOR0                        0x3
+
+    * 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_LPD_SWITCH_CTRL_SRCSEL                          0x2
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E00A8, 0x01003F07U ,0x01000302U)
     */
-	PSU_Mask_Write(DDRC_DERATEINT_OFFSET, 0xFFFFFFFFU, 0x00800000U);
+	PSU_Mask_Write(CRL_APB_LPD_SWITCH_CTRL_OFFSET,
+		0x01003F07U, 0x01000302U);
 /*##################################################################### */
 
     /*
-    * Register : PWRCTL @ 0XFD070030
+    * Register : LPD_LSBUS_CTRL @ 0XFF5E00AC
 
-    * Self refresh state is an intermediate state to enter to Self refresh pow
-    * er down state or exit Self refresh power down state for LPDDR4. This reg
-    * ister controls transition from the Self refresh state. - 1 - Prohibit tr
-    * ansition from Self refresh state - 0 - Allow transition from Self refres
-    * h state
-    *  PSU_DDRC_PWRCTL_STAY_IN_SELFREF                             0x0
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_LPD_LSBUS_CTRL_CLKACT                           0x1
 
-    * A value of 1 to this register causes system to move to Self Refresh stat
-    * e immediately, as long as it is not in INIT or DPD/MPSM operating_mode.
-    * This is referred to as Software Entry/Exit to Self Refresh. - 1 - Softwa
-    * re Entry to Self Refresh - 0 - Software Exit from Self Refresh
-    *  PSU_DDRC_PWRCTL_SELFREF_SW                                  0x0
+    * 6 bit divider
+    *  PSU_CRL_APB_LPD_LSBUS_CTRL_DIVISOR0                         0xf
 
-    * When this is 1, the uMCTL2 puts the SDRAM into maximum power saving mode
-    *  when the transaction store is empty. This register must be reset to '0'
-    *  to bring uMCTL2 out of maximum power saving mode. Present only in desig
-    * ns configured to support DDR4. For non-DDR4, this register should not be
-    *  set to 1. Note that MPSM is not supported when using a DWC DDR PHY, if
-    * the PHY parameter DWC_AC_CS_USE is disabled, as the MPSM exit sequence r
-    * equires the chip-select signal to toggle. FOR PERFORMANCE ONLY.
-    *  PSU_DDRC_PWRCTL_MPSM_EN                                     0x0
+    * 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_LPD_LSBUS_CTRL_SRCSEL                           0x2
 
-    * Enable the assertion of dfi_dram_clk_disable whenever a clock is not req
-    * uired by the SDRAM. If set to 0, dfi_dram_clk_disable is never asserted.
-    *  Assertion of dfi_dram_clk_disable is as follows: In DDR2/DDR3, can only
-    *  be asserted in Self Refresh. In DDR4, can be asserted in following: - i
-    * n Self Refresh. - in Maximum Power Saving Mode In mDDR/LPDDR2/LPDDR3, ca
-    * n be asserted in following: - in Self Refresh - in Power Down - in Deep
-    * Power Down - during Normal operation (Clock Stop) In LPDDR4, can be asse
-    * rted in following: - in Self Refresh Power Down - in Power Down - during
-    *  Normal operation (Clock Stop)
-    *  PSU_DDRC_PWRCTL_EN_DFI_DRAM_CLK_DISABLE                     0x0
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E00AC, 0x01003F07U ,0x01000F02U)
+    */
+	PSU_Mask_Write(CRL_APB_LPD_LSBUS_CTRL_OFFSET,
+		0x01003F07U, 0x01000F02U);
+/*##################################################################### */
 
-    * When this is 1, uMCTL2 puts the SDRAM into deep power-down mode when the
-    *  transaction store is empty. This register must be reset to '0' to bring
-    *  uMCTL2 out of deep power-down mode. Controller performs automatic SDRAM
-    *  initialization on deep power-down exit. Present only in designs configu
-    * red to support mDDR or LPDDR2 or LPDDR3. For non-mDDR/non-LPDDR2/non-LPD
-    * DR3, this register should not be set to 1. FOR PERFORMANCE ONLY.
-    *  PSU_DDRC_PWRCTL_DEEPPOWERDOWN_EN                            0x0
+    /*
+    * Register : DBG_LPD_CTRL @ 0XFF5E00B0
 
-    * If true then the uMCTL2 goes into power-down after a programmable number
-    *  of cycles 'maximum idle clocks before power down' (PWRTMG.powerdown_to_
-    * x32). This register bit may be re-programmed during the course of normal
-    *  operation.
-    *  PSU_DDRC_PWRCTL_POWERDOWN_EN                                0x0
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_DBG_LPD_CTRL_CLKACT                             0x1
 
-    * If true then the uMCTL2 puts the SDRAM into Self Refresh after a program
-    * mable number of cycles 'maximum idle clocks before Self Refresh (PWRTMG.
-    * selfref_to_x32)'. This register bit may be re-programmed during the cour
-    * se of normal operation.
-    *  PSU_DDRC_PWRCTL_SELFREF_EN                                  0x0
+    * 6 bit divider
+    *  PSU_CRL_APB_DBG_LPD_CTRL_DIVISOR0                           0x6
 
-    * Low Power Control Register
-    * (OFFSET, MASK, VALUE)      (0XFD070030, 0x0000007FU ,0x00000000U)
+    * 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_DBG_LPD_CTRL_SRCSEL                             0x2
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E00B0, 0x01003F07U ,0x01000602U)
     */
-	PSU_Mask_Write(DDRC_PWRCTL_OFFSET, 0x0000007FU, 0x00000000U);
+	PSU_Mask_Write(CRL_APB_DBG_LPD_CTRL_OFFSET,
+		0x01003F07U, 0x01000602U);
 /*##################################################################### */
 
     /*
-    * Register : PWRTMG @ 0XFD070034
+    * Register : ADMA_REF_CTRL @ 0XFF5E00B8
 
-    * After this many clocks of NOP or deselect the uMCTL2 automatically puts
-    * the SDRAM into Self Refresh. This must be enabled in the PWRCTL.selfref_
-    * en. Unit: Multiples of 32 clocks. FOR PERFORMANCE ONLY.
-    *  PSU_DDRC_PWRTMG_SELFREF_TO_X32                              0x40
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_ADMA_REF_CTRL_CLKACT                            0x1
 
-    * Minimum deep power-down time. For mDDR, value from the JEDEC specificati
-    * on is 0 as mDDR exits from deep power-down mode immediately after PWRCTL
-    * .deeppowerdown_en is de-asserted. For LPDDR2/LPDDR3, value from the JEDE
-    * C specification is 500us. Unit: Multiples of 4096 clocks. Present only i
-    * n designs configured to support mDDR, LPDDR2 or LPDDR3. FOR PERFORMANCE
-    * ONLY.
-    *  PSU_DDRC_PWRTMG_T_DPD_X4096                                 0x84
+    * 6 bit divider
+    *  PSU_CRL_APB_ADMA_REF_CTRL_DIVISOR0                          0x3
 
-    * After this many clocks of NOP or deselect the uMCTL2 automatically puts
-    * the SDRAM into power-down. This must be enabled in the PWRCTL.powerdown_
-    * en. Unit: Multiples of 32 clocks FOR PERFORMANCE ONLY.
-    *  PSU_DDRC_PWRTMG_POWERDOWN_TO_X32                            0x10
+    * 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_ADMA_REF_CTRL_SRCSEL                            0x2
 
-    * Low Power Timing Register
-    * (OFFSET, MASK, VALUE)      (0XFD070034, 0x00FFFF1FU ,0x00408410U)
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E00B8, 0x01003F07U ,0x01000302U)
     */
-	PSU_Mask_Write(DDRC_PWRTMG_OFFSET, 0x00FFFF1FU, 0x00408410U);
+	PSU_Mask_Write(CRL_APB_ADMA_REF_CTRL_OFFSET,
+		0x01003F07U, 0x01000302U);
 /*##################################################################### */
 
     /*
-    * Register : RFSHCTL0 @ 0XFD070050
+    * Register : PL0_REF_CTRL @ 0XFF5E00C0
 
-    * Threshold value in number of clock cycles before the critical refresh or
-    *  page timer expires. A critical refresh is to be issued before this thre
-    * shold is reached. It is recommended that this not be changed from the de
-    * fault value, currently shown as 0x2. It must always be less than interna
-    * lly used t_rfc_nom_x32. Note that, in LPDDR2/LPDDR3/LPDDR4, internally u
-    * sed t_rfc_nom_x32 may be equal to RFSHTMG.t_rfc_nom_x32>>2 if derating i
-    * s enabled (DERATEEN.derate_enable=1). Otherwise, internally used t_rfc_n
-    * om_x32 will be equal to RFSHTMG.t_rfc_nom_x32. Unit: Multiples of 32 clo
-    * cks.
-    *  PSU_DDRC_RFSHCTL0_REFRESH_MARGIN                            0x2
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_PL0_REF_CTRL_CLKACT                             0x1
 
-    * If the refresh timer (tRFCnom, also known as tREFI) has expired at least
-    *  once, but it has not expired (RFSHCTL0.refresh_burst+1) times yet, then
-    *  a speculative refresh may be performed. A speculative refresh is a refr
-    * esh performed at a time when refresh would be useful, but before it is a
-    * bsolutely required. When the SDRAM bus is idle for a period of time dete
-    * rmined by this RFSHCTL0.refresh_to_x32 and the refresh timer has expired
-    *  at least once since the last refresh, then a speculative refresh is per
-    * formed. Speculative refreshes continues successively until there are no
-    * refreshes pending or until new reads or writes are issued to the uMCTL2.
-    *  FOR PERFORMANCE ONLY.
-    *  PSU_DDRC_RFSHCTL0_REFRESH_TO_X32                            0x10
+    * 6 bit divider
+    *  PSU_CRL_APB_PL0_REF_CTRL_DIVISOR1                           0x1
 
-    * The programmed value + 1 is the number of refresh timeouts that is allow
-    * ed to accumulate before traffic is blocked and the refreshes are forced
-    * to execute. Closing pages to perform a refresh is a one-time penalty tha
-    * t must be paid for each group of refreshes. Therefore, performing refres
-    * hes in a burst reduces the per-refresh penalty of these page closings. H
-    * igher numbers for RFSHCTL.refresh_burst slightly increases utilization;
-    * lower numbers decreases the worst-case latency associated with refreshes
-    * . - 0 - single refresh - 1 - burst-of-2 refresh - 7 - burst-of-8 refresh
-    *  For information on burst refresh feature refer to section 3.9 of DDR2 J
-    * EDEC specification - JESD79-2F.pdf. For DDR2/3, the refresh is always pe
-    * r-rank and not per-bank. The rank refresh can be accumulated over 8*tREF
-    * I cycles using the burst refresh feature. In DDR4 mode, according to Fin
-    * e Granularity feature, 8 refreshes can be postponed in 1X mode, 16 refre
-    * shes in 2X mode and 32 refreshes in 4X mode. If using PHY-initiated upda
-    * tes, care must be taken in the setting of RFSHCTL0.refresh_burst, to ens
-    * ure that tRFCmax is not violated due to a PHY-initiated update occurring
-    *  shortly before a refresh burst was due. In this situation, the refresh
-    * burst will be delayed until the PHY-initiated update is complete.
-    *  PSU_DDRC_RFSHCTL0_REFRESH_BURST                             0x0
+    * 6 bit divider
+    *  PSU_CRL_APB_PL0_REF_CTRL_DIVISOR0                           0xf
 
-    * - 1 - Per bank refresh; - 0 - All bank refresh. Per bank refresh allows
-    * traffic to flow to other banks. Per bank refresh is not supported by all
-    *  LPDDR2 devices but should be supported by all LPDDR3/LPDDR4 devices. Pr
-    * esent only in designs configured to support LPDDR2/LPDDR3/LPDDR4
-    *  PSU_DDRC_RFSHCTL0_PER_BANK_REFRESH                          0x0
+    * 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_PL0_REF_CTRL_SRCSEL                             0x0
 
-    * Refresh Control Register 0
-    * (OFFSET, MASK, VALUE)      (0XFD070050, 0x00F1F1F4U ,0x00210000U)
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E00C0, 0x013F3F07U ,0x01010F00U)
     */
-	PSU_Mask_Write(DDRC_RFSHCTL0_OFFSET, 0x00F1F1F4U, 0x00210000U);
+	PSU_Mask_Write(CRL_APB_PL0_REF_CTRL_OFFSET,
+		0x013F3F07U, 0x01010F00U);
 /*##################################################################### */
 
     /*
-    * Register : RFSHCTL1 @ 0XFD070054
+    * Register : AMS_REF_CTRL @ 0XFF5E0108
 
-    * Refresh timer start for rank 1 (only present in multi-rank configuration
-    * s). This is useful in staggering the refreshes to multiple ranks to help
-    *  traffic to proceed. This is explained in Refresh Controls section of ar
-    * chitecture chapter. Unit: Multiples of 32 clocks. FOR PERFORMANCE ONLY.
-    *  PSU_DDRC_RFSHCTL1_REFRESH_TIMER1_START_VALUE_X32            0x0
+    * 6 bit divider
+    *  PSU_CRL_APB_AMS_REF_CTRL_DIVISOR1                           0x1
 
-    * Refresh timer start for rank 0 (only present in multi-rank configuration
-    * s). This is useful in staggering the refreshes to multiple ranks to help
-    *  traffic to proceed. This is explained in Refresh Controls section of ar
-    * chitecture chapter. Unit: Multiples of 32 clocks. FOR PERFORMANCE ONLY.
-    *  PSU_DDRC_RFSHCTL1_REFRESH_TIMER0_START_VALUE_X32            0x0
+    * 6 bit divider
+    *  PSU_CRL_APB_AMS_REF_CTRL_DIVISOR0                           0x1e
 
-    * Refresh Control Register 1
-    * (OFFSET, MASK, VALUE)      (0XFD070054, 0x0FFF0FFFU ,0x00000000U)
+    * 000 = RPLL; 010 = IOPLL; 011 = DPLL; (This signal may only be toggled af
+    * ter 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    *  usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_AMS_REF_CTRL_SRCSEL                             0x2
+
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_AMS_REF_CTRL_CLKACT                             0x1
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E0108, 0x013F3F07U ,0x01011E02U)
     */
-	PSU_Mask_Write(DDRC_RFSHCTL1_OFFSET, 0x0FFF0FFFU, 0x00000000U);
+	PSU_Mask_Write(CRL_APB_AMS_REF_CTRL_OFFSET,
+		0x013F3F07U, 0x01011E02U);
 /*##################################################################### */
 
     /*
-    * Register : RFSHCTL3 @ 0XFD070060
+    * Register : DLL_REF_CTRL @ 0XFF5E0104
 
-    * Fine Granularity Refresh Mode - 000 - Fixed 1x (Normal mode) - 001 - Fix
-    * ed 2x - 010 - Fixed 4x - 101 - Enable on the fly 2x (not supported) - 11
-    * 0 - Enable on the fly 4x (not supported) - Everything else - reserved No
-    * te: The on-the-fly modes is not supported in this version of the uMCTL2.
-    *  Note: This must be set up while the Controller is in reset or while the
-    *  Controller is in self-refresh mode. Changing this during normal operati
-    * on is not allowed. Making this a dynamic register will be supported in f
-    * uture version of the uMCTL2.
-    *  PSU_DDRC_RFSHCTL3_REFRESH_MODE                              0x0
+    * 000 = IOPLL; 001 = RPLL; (This signal may only be toggled after 4 cycles
+    *  of the old clock and 4 cycles of the new clock. This is not usually an
+    * issue, but designers must be aware.)
+    *  PSU_CRL_APB_DLL_REF_CTRL_SRCSEL                             0
 
-    * Toggle this signal (either from 0 to 1 or from 1 to 0) to indicate that
-    * the refresh register(s) have been updated. The value is automatically up
-    * dated when exiting reset, so it does not need to be toggled initially.
-    *  PSU_DDRC_RFSHCTL3_REFRESH_UPDATE_LEVEL                      0x0
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E0104, 0x00000007U ,0x00000000U)
+    */
+	PSU_Mask_Write(CRL_APB_DLL_REF_CTRL_OFFSET,
+		0x00000007U, 0x00000000U);
+/*##################################################################### */
 
-    * When '1', disable auto-refresh generated by the uMCTL2. When auto-refres
-    * h is disabled, the SoC core must generate refreshes using the registers
-    * reg_ddrc_rank0_refresh, reg_ddrc_rank1_refresh, reg_ddrc_rank2_refresh a
-    * nd reg_ddrc_rank3_refresh. When dis_auto_refresh transitions from 0 to 1
-    * , any pending refreshes are immediately scheduled by the uMCTL2. If DDR4
-    *  CRC/parity retry is enabled (CRCPARCTL1.crc_parity_retry_enable = 1), d
-    * isable auto-refresh is not supported, and this bit must be set to '0'. T
-    * his register field is changeable on the fly.
-    *  PSU_DDRC_RFSHCTL3_DIS_AUTO_REFRESH                          0x1
+    /*
+    * Register : TIMESTAMP_REF_CTRL @ 0XFF5E0128
 
-    * Refresh Control Register 3
-    * (OFFSET, MASK, VALUE)      (0XFD070060, 0x00000073U ,0x00000001U)
+    * 6 bit divider
+    *  PSU_CRL_APB_TIMESTAMP_REF_CTRL_DIVISOR0                     0xf
+
+    * 1XX = pss_ref_clk; 000 = IOPLL; 010 = RPLL; 011 = DPLL; (This signal may
+    *  only be toggled after 4 cycles of the old clock and 4 cycles of the new
+    *  clock. This is not usually an issue, but designers must be aware.)
+    *  PSU_CRL_APB_TIMESTAMP_REF_CTRL_SRCSEL                       0x0
+
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRL_APB_TIMESTAMP_REF_CTRL_CLKACT                       0x1
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFF5E0128, 0x01003F07U ,0x01000F00U)
     */
-	PSU_Mask_Write(DDRC_RFSHCTL3_OFFSET, 0x00000073U, 0x00000001U);
+	PSU_Mask_Write(CRL_APB_TIMESTAMP_REF_CTRL_OFFSET,
+		0x01003F07U, 0x01000F00U);
 /*##################################################################### */
 
     /*
-    * Register : RFSHTMG @ 0XFD070064
+    * Register : SATA_REF_CTRL @ 0XFD1A00A0
 
-    * tREFI: Average time interval between refreshes per rank (Specification:
-    * 7.8us for DDR2, DDR3 and DDR4. See JEDEC specification for mDDR, LPDDR2,
-    *  LPDDR3 and LPDDR4). For LPDDR2/LPDDR3/LPDDR4: - if using all-bank refre
-    * shes (RFSHCTL0.per_bank_refresh = 0), this register should be set to tRE
-    * FIab - if using per-bank refreshes (RFSHCTL0.per_bank_refresh = 1), this
-    *  register should be set to tREFIpb For configurations with MEMC_FREQ_RAT
-    * IO=2, program this to (tREFI/2), no rounding up. In DDR4 mode, tREFI val
-    * ue is different depending on the refresh mode. The user should program t
-    * he appropriate value from the spec based on the value programmed in the
-    * refresh mode register. Note that RFSHTMG.t_rfc_nom_x32 * 32 must be grea
-    * ter than RFSHTMG.t_rfc_min, and RFSHTMG.t_rfc_nom_x32 must be greater th
-    * an 0x1. Unit: Multiples of 32 clocks.
-    *  PSU_DDRC_RFSHTMG_T_RFC_NOM_X32                              0x81
+    * 000 = IOPLL_TO_FPD; 010 = APLL; 011 = DPLL; (This signal may only be tog
+    * gled after 4 cycles of the old clock and 4 cycles of the new clock. This
+    *  is not usually an issue, but designers must be aware.)
+    *  PSU_CRF_APB_SATA_REF_CTRL_SRCSEL                            0x0
 
-    * Used only when LPDDR3 memory type is connected. Should only be changed w
-    * hen uMCTL2 is in reset. Specifies whether to use the tREFBW parameter (r
-    * equired by some LPDDR3 devices which comply with earlier versions of the
-    *  LPDDR3 JEDEC specification) or not: - 0 - tREFBW parameter not used - 1
-    *  - tREFBW parameter used
-    *  PSU_DDRC_RFSHTMG_LPDDR3_TREFBW_EN                           0x1
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRF_APB_SATA_REF_CTRL_CLKACT                            0x1
 
-    * tRFC (min): Minimum time from refresh to refresh or activate. For MEMC_F
-    * REQ_RATIO=1 configurations, t_rfc_min should be set to RoundUp(tRFCmin/t
-    * CK). For MEMC_FREQ_RATIO=2 configurations, t_rfc_min should be set to Ro
-    * undUp(RoundUp(tRFCmin/tCK)/2). In LPDDR2/LPDDR3/LPDDR4 mode: - if using
-    * all-bank refreshes, the tRFCmin value in the above equations is equal to
-    *  tRFCab - if using per-bank refreshes, the tRFCmin value in the above eq
-    * uations is equal to tRFCpb In DDR4 mode, the tRFCmin value in the above
-    * equations is different depending on the refresh mode (fixed 1X,2X,4X) an
-    * d the device density. The user should program the appropriate value from
-    *  the spec based on the 'refresh_mode' and the device density that is use
-    * d. Unit: Clocks.
-    *  PSU_DDRC_RFSHTMG_T_RFC_MIN                                  0x8b
+    * 6 bit divider
+    *  PSU_CRF_APB_SATA_REF_CTRL_DIVISOR0                          0x2
 
-    * Refresh Timing Register
-    * (OFFSET, MASK, VALUE)      (0XFD070064, 0x0FFF83FFU ,0x0081808BU)
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFD1A00A0, 0x01003F07U ,0x01000200U)
     */
-	PSU_Mask_Write(DDRC_RFSHTMG_OFFSET, 0x0FFF83FFU, 0x0081808BU);
+	PSU_Mask_Write(CRF_APB_SATA_REF_CTRL_OFFSET,
+		0x01003F07U, 0x01000200U);
 /*##################################################################### */
 
     /*
-    * Register : ECCCFG0 @ 0XFD070070
+    * Register : PCIE_REF_CTRL @ 0XFD1A00B4
 
-    * Disable ECC scrubs. Valid only when ECCCFG0.ecc_mode = 3'b100 and MEMC_U
-    * SE_RMW is defined
-    *  PSU_DDRC_ECCCFG0_DIS_SCRUB                                  0x1
+    * 000 = IOPLL_TO_FPD; 010 = RPLL_TO_FPD; 011 = DPLL; (This signal may only
+    *  be toggled after 4 cycles of the old clock and 4 cycles of the new cloc
+    * k. This is not usually an issue, but designers must be aware.)
+    *  PSU_CRF_APB_PCIE_REF_CTRL_SRCSEL                            0x0
 
-    * ECC mode indicator - 000 - ECC disabled - 100 - ECC enabled - SEC/DED ov
-    * er 1 beat - all other settings are reserved for future use
-    *  PSU_DDRC_ECCCFG0_ECC_MODE                                   0x0
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRF_APB_PCIE_REF_CTRL_CLKACT                            0x1
 
-    * ECC Configuration Register 0
-    * (OFFSET, MASK, VALUE)      (0XFD070070, 0x00000017U ,0x00000010U)
+    * 6 bit divider
+    *  PSU_CRF_APB_PCIE_REF_CTRL_DIVISOR0                          0x2
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFD1A00B4, 0x01003F07U ,0x01000200U)
     */
-	PSU_Mask_Write(DDRC_ECCCFG0_OFFSET, 0x00000017U, 0x00000010U);
+	PSU_Mask_Write(CRF_APB_PCIE_REF_CTRL_OFFSET,
+		0x01003F07U, 0x01000200U);
 /*##################################################################### */
 
     /*
-    * Register : ECCCFG1 @ 0XFD070074
+    * Register : DP_VIDEO_REF_CTRL @ 0XFD1A0070
 
-    * Selects whether to poison 1 or 2 bits - if 0 -> 2-bit (uncorrectable) da
-    * ta poisoning, if 1 -> 1-bit (correctable) data poisoning, if ECCCFG1.dat
-    * a_poison_en=1
-    *  PSU_DDRC_ECCCFG1_DATA_POISON_BIT                            0x0
+    * 6 bit divider
+    *  PSU_CRF_APB_DP_VIDEO_REF_CTRL_DIVISOR1                      0x1
 
-    * Enable ECC data poisoning - introduces ECC errors on writes to address s
-    * pecified by the ECCPOISONADDR0/1 registers
-    *  PSU_DDRC_ECCCFG1_DATA_POISON_EN                             0x0
+    * 6 bit divider
+    *  PSU_CRF_APB_DP_VIDEO_REF_CTRL_DIVISOR0                      0x5
 
-    * ECC Configuration Register 1
-    * (OFFSET, MASK, VALUE)      (0XFD070074, 0x00000003U ,0x00000000U)
+    * 000 = VPLL; 010 = DPLL; 011 = RPLL_TO_FPD - might be using extra mux; (T
+    * his signal may only be toggled after 4 cycles of the old clock and 4 cyc
+    * les of the new clock. This is not usually an issue, but designers must b
+    * e aware.)
+    *  PSU_CRF_APB_DP_VIDEO_REF_CTRL_SRCSEL                        0x0
+
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRF_APB_DP_VIDEO_REF_CTRL_CLKACT                        0x1
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFD1A0070, 0x013F3F07U ,0x01010500U)
     */
-	PSU_Mask_Write(DDRC_ECCCFG1_OFFSET, 0x00000003U, 0x00000000U);
+	PSU_Mask_Write(CRF_APB_DP_VIDEO_REF_CTRL_OFFSET,
+		0x013F3F07U, 0x01010500U);
 /*##################################################################### */
 
     /*
-    * Register : CRCPARCTL1 @ 0XFD0700C4
+    * Register : DP_AUDIO_REF_CTRL @ 0XFD1A0074
 
-    * The maximum number of DFI PHY clock cycles allowed from the assertion of
-    *  the dfi_rddata_en signal to the assertion of each of the corresponding
-    * bits of the dfi_rddata_valid signal. This corresponds to the DFI timing
-    * parameter tphy_rdlat. Refer to PHY specification for correct value. This
-    *  value it only used for detecting read data timeout when DDR4 retry is e
-    * nabled by CRCPARCTL1.crc_parity_retry_enable=1. Maximum supported value:
-    *  - 1:1 Frequency mode : DFITMG0.dfi_t_rddata_en + CRCPARCTL1.dfi_t_phy_r
-    * dlat < 'd114 - 1:2 Frequency mode ANDAND DFITMG0.dfi_rddata_use_sdr == 1
-    *  : CRCPARCTL1.dfi_t_phy_rdlat < 64 - 1:2 Frequency mode ANDAND DFITMG0.d
-    * fi_rddata_use_sdr == 0 : DFITMG0.dfi_t_rddata_en + CRCPARCTL1.dfi_t_phy_
-    * rdlat < 'd114 Unit: DFI Clocks
-    *  PSU_DDRC_CRCPARCTL1_DFI_T_PHY_RDLAT                         0x10
+    * 6 bit divider
+    *  PSU_CRF_APB_DP_AUDIO_REF_CTRL_DIVISOR1                      0x1
 
-    * After a Parity or CRC error is flagged on dfi_alert_n signal, the softwa
-    * re has an option to read the mode registers in the DRAM before the hardw
-    * are begins the retry process - 1: Wait for software to read/write the mo
-    * de registers before hardware begins the retry. After software is done wi
-    * th its operations, it will clear the alert interrupt register bit - 0: H
-    * ardware can begin the retry right away after the dfi_alert_n pulse goes
-    * away. The value on this register is valid only when retry is enabled (PA
-    * RCTRL.crc_parity_retry_enable = 1) If this register is set to 1 and if t
-    * he software doesn't clear the interrupt register after handling the pari
-    * ty/CRC error, then the hardware will not begin the retry process and the
-    *  system will hang. In the case of Parity/CRC error, there are two possib
-    * ilities when the software doesn't reset MR5[4] to 0. - (i) If 'Persisten
-    * t parity' mode register bit is NOT set: the commands sent during retry a
-    * nd normal operation are executed without parity checking. The value in t
-    * he Parity error log register MPR Page 1 is valid. - (ii) If 'Persistent
-    * parity' mode register bit is SET: Parity checking is done for commands s
-    * ent during retry and normal operation. If multiple errors occur before M
-    * R5[4] is cleared, the error log in MPR Page 1 should be treated as 'Don'
-    * t care'.
-    *  PSU_DDRC_CRCPARCTL1_ALERT_WAIT_FOR_SW                       0x1
-
-    * - 1: Enable command retry mechanism in case of C/A Parity or CRC error -
-    *  0: Disable command retry mechanism when C/A Parity or CRC features are
-    * enabled. Note that retry functionality is not supported if burst chop is
-    *  enabled (MSTR.burstchop = 1) and/or disable auto-refresh is enabled (RF
-    * SHCTL3.dis_auto_refresh = 1)
-    *  PSU_DDRC_CRCPARCTL1_CRC_PARITY_RETRY_ENABLE                 0x0
-
-    * CRC Calculation setting register - 1: CRC includes DM signal - 0: CRC no
-    * t includes DM signal Present only in designs configured to support DDR4.
-    *  PSU_DDRC_CRCPARCTL1_CRC_INC_DM                              0x0
+    * 6 bit divider
+    *  PSU_CRF_APB_DP_AUDIO_REF_CTRL_DIVISOR0                      0xf
 
-    * CRC enable Register - 1: Enable generation of CRC - 0: Disable generatio
-    * n of CRC The setting of this register should match the CRC mode register
-    *  setting in the DRAM.
-    *  PSU_DDRC_CRCPARCTL1_CRC_ENABLE                              0x0
+    * 000 = VPLL; 010 = DPLL; 011 = RPLL_TO_FPD - might be using extra mux; (T
+    * his signal may only be toggled after 4 cycles of the old clock and 4 cyc
+    * les of the new clock. This is not usually an issue, but designers must b
+    * e aware.)
+    *  PSU_CRF_APB_DP_AUDIO_REF_CTRL_SRCSEL                        0x3
 
-    * C/A Parity enable register - 1: Enable generation of C/A parity and dete
-    * ction of C/A parity error - 0: Disable generation of C/A parity and disa
-    * ble detection of C/A parity error If RCD's parity error detection or SDR
-    * AM's parity detection is enabled, this register should be 1.
-    *  PSU_DDRC_CRCPARCTL1_PARITY_ENABLE                           0x0
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRF_APB_DP_AUDIO_REF_CTRL_CLKACT                        0x1
 
-    * CRC Parity Control Register1
-    * (OFFSET, MASK, VALUE)      (0XFD0700C4, 0x3F000391U ,0x10000200U)
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFD1A0074, 0x013F3F07U ,0x01010F03U)
     */
-	PSU_Mask_Write(DDRC_CRCPARCTL1_OFFSET, 0x3F000391U, 0x10000200U);
+	PSU_Mask_Write(CRF_APB_DP_AUDIO_REF_CTRL_OFFSET,
+		0x013F3F07U, 0x01010F03U);
 /*##################################################################### */
 
     /*
-    * Register : CRCPARCTL2 @ 0XFD0700C8
+    * Register : DP_STC_REF_CTRL @ 0XFD1A007C
 
-    * Value from the DRAM spec indicating the maximum width of the dfi_alert_n
-    *  pulse when a parity error occurs. Recommended values: - tPAR_ALERT_PW.M
-    * AX For configurations with MEMC_FREQ_RATIO=2, program this to tPAR_ALERT
-    * _PW.MAX/2 and round up to next integer value. Values of 0, 1 and 2 are i
-    * llegal. This value must be greater than CRCPARCTL2.t_crc_alert_pw_max.
-    *  PSU_DDRC_CRCPARCTL2_T_PAR_ALERT_PW_MAX                      0x40
+    * 6 bit divider
+    *  PSU_CRF_APB_DP_STC_REF_CTRL_DIVISOR1                        0x1
 
-    * Value from the DRAM spec indicating the maximum width of the dfi_alert_n
-    *  pulse when a CRC error occurs. Recommended values: - tCRC_ALERT_PW.MAX
-    * For configurations with MEMC_FREQ_RATIO=2, program this to tCRC_ALERT_PW
-    * .MAX/2 and round up to next integer value. Values of 0, 1 and 2 are ille
-    * gal. This value must be less than CRCPARCTL2.t_par_alert_pw_max.
-    *  PSU_DDRC_CRCPARCTL2_T_CRC_ALERT_PW_MAX                      0x5
+    * 6 bit divider
+    *  PSU_CRF_APB_DP_STC_REF_CTRL_DIVISOR0                        0xe
 
-    * Indicates the maximum duration in number of DRAM clock cycles for which
-    * a command should be held in the Command Retry FIFO before it is popped o
-    * ut. Every location in the Command Retry FIFO has an associated down coun
-    * ting timer that will use this register as the start value. The down coun
-    * ting starts when a command is loaded into the FIFO. The timer counts dow
-    * n every 4 DRAM cycles. When the counter reaches zero, the entry is poppe
-    * d from the FIFO. All the counters are frozen, if a C/A Parity or CRC err
-    * or occurs before the counter reaches zero. The counter is reset to 0, af
-    * ter all the commands in the FIFO are retried. Recommended(minimum) value
-    * s: - Only C/A Parity is enabled. RoundUp((PHY Command Latency(DRAM CLK)
-    * + CAL + RDIMM delay + tPAR_ALERT_ON.max + tPAR_UNKNOWN + PHY Alert Laten
-    * cy(DRAM CLK) + board delay) / 4) + 2 - Both C/A Parity and CRC is enable
-    * d/ Only CRC is enabled. RoundUp((PHY Command Latency(DRAM CLK) + CAL + R
-    * DIMM delay + WL + 5(BL10)+ tCRC_ALERT.max + PHY Alert Latency(DRAM CLK)
-    * + board delay) / 4) + 2 Note 1: All value (e.g. tPAR_ALERT_ON) should be
-    *  in terms of DRAM Clock and round up Note 2: Board delay(Command/Alert_n
-    * ) should be considered. Note 3: Use the worst case(longer) value for PHY
-    *  Latencies/Board delay Note 4: The Recommended values are minimum value
-    * to be set. For mode detail, See 'Calculation of FIFO Depth' section. Max
-    *  value can be set to this register is defined below: - MEMC_BURST_LENGTH
-    *  == 16 Full bus Mode (CRC=OFF) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-2
-    *  Full bus Mode (CRC=ON) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-3 Half b
-    * us Mode (CRC=OFF) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-4 Half bus Mod
-    * e (CRC=ON) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-6 Quarter bus Mode (C
-    * RC=OFF) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-8 Quarter bus Mode (CRC=
-    * ON) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-12 - MEMC_BURST_LENGTH != 16
-    *  Full bus Mode (CRC=OFF) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-1 Full
-    * bus Mode (CRC=ON) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-2 Half bus Mod
-    * e (CRC=OFF) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-2 Half bus Mode (CRC
-    * =ON) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-3 Quarter bus Mode (CRC=OFF
-    * ) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-4 Quarter bus Mode (CRC=ON) Ma
-    * x value = UMCTL2_RETRY_CMD_FIFO_DEPTH-6 Values of 0, 1 and 2 are illegal
-    * .
-    *  PSU_DDRC_CRCPARCTL2_RETRY_FIFO_MAX_HOLD_TIMER_X4            0x1f
+    * 000 = VPLL; 010 = DPLL; 011 = RPLL_TO_FPD; (This signal may only be togg
+    * led after 4 cycles of the old clock and 4 cycles of the new clock. This
+    * is not usually an issue, but designers must be aware.)
+    *  PSU_CRF_APB_DP_STC_REF_CTRL_SRCSEL                          0x3
 
-    * CRC Parity Control Register2
-    * (OFFSET, MASK, VALUE)      (0XFD0700C8, 0x01FF1F3FU ,0x0040051FU)
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRF_APB_DP_STC_REF_CTRL_CLKACT                          0x1
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFD1A007C, 0x013F3F07U ,0x01010E03U)
     */
-	PSU_Mask_Write(DDRC_CRCPARCTL2_OFFSET, 0x01FF1F3FU, 0x0040051FU);
+	PSU_Mask_Write(CRF_APB_DP_STC_REF_CTRL_OFFSET,
+		0x013F3F07U, 0x01010E03U);
 /*##################################################################### */
 
     /*
-    * Register : INIT0 @ 0XFD0700D0
+    * Register : ACPU_CTRL @ 0XFD1A0060
 
-    * If lower bit is enabled the SDRAM initialization routine is skipped. The
-    *  upper bit decides what state the controller starts up in when reset is
-    * removed - 00 - SDRAM Intialization routine is run after power-up - 01 -
-    * SDRAM Intialization routine is skipped after power-up. Controller starts
-    *  up in Normal Mode - 11 - SDRAM Intialization routine is skipped after p
-    * ower-up. Controller starts up in Self-refresh Mode - 10 - SDRAM Intializ
-    * ation routine is run after power-up. Note: The only 2'b00 is supported f
-    * or LPDDR4 in this version of the uMCTL2.
-    *  PSU_DDRC_INIT0_SKIP_DRAM_INIT                               0x0
+    * 6 bit divider
+    *  PSU_CRF_APB_ACPU_CTRL_DIVISOR0                              0x1
 
-    * Cycles to wait after driving CKE high to start the SDRAM initialization
-    * sequence. Unit: 1024 clocks. DDR2 typically requires a 400 ns delay, req
-    * uiring this value to be programmed to 2 at all clock speeds. LPDDR2/LPDD
-    * R3 typically requires this to be programmed for a delay of 200 us. LPDDR
-    * 4 typically requires this to be programmed for a delay of 2 us. For conf
-    * igurations with MEMC_FREQ_RATIO=2, program this to JEDEC spec value divi
-    * ded by 2, and round it up to next integer value.
-    *  PSU_DDRC_INIT0_POST_CKE_X1024                               0x2
+    * 000 = APLL; 010 = DPLL; 011 = VPLL; (This signal may only be toggled aft
+    * er 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    * usually an issue, but designers must be aware.)
+    *  PSU_CRF_APB_ACPU_CTRL_SRCSEL                                0x0
 
-    * Cycles to wait after reset before driving CKE high to start the SDRAM in
-    * itialization sequence. Unit: 1024 clock cycles. DDR2 specifications typi
-    * cally require this to be programmed for a delay of >= 200 us. LPDDR2/LPD
-    * DR3: tINIT1 of 100 ns (min) LPDDR4: tINIT3 of 2 ms (min) For configurati
-    * ons with MEMC_FREQ_RATIO=2, program this to JEDEC spec value divided by
-    * 2, and round it up to next integer value.
-    *  PSU_DDRC_INIT0_PRE_CKE_X1024                                0x106
+    * Clock active signal. Switch to 0 to disable the clock. For the half spee
+    * d APU Clock
+    *  PSU_CRF_APB_ACPU_CTRL_CLKACT_HALF                           0x1
 
-    * SDRAM Initialization Register 0
-    * (OFFSET, MASK, VALUE)      (0XFD0700D0, 0xC3FF0FFFU ,0x00020106U)
+    * Clock active signal. Switch to 0 to disable the clock. For the full spee
+    * d ACPUX Clock. This will shut off the high speed clock to the entire APU
+    *  PSU_CRF_APB_ACPU_CTRL_CLKACT_FULL                           0x1
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFD1A0060, 0x03003F07U ,0x03000100U)
     */
-	PSU_Mask_Write(DDRC_INIT0_OFFSET, 0xC3FF0FFFU, 0x00020106U);
+	PSU_Mask_Write(CRF_APB_ACPU_CTRL_OFFSET, 0x03003F07U, 0x03000100U);
 /*##################################################################### */
 
     /*
-    * Register : INIT1 @ 0XFD0700D4
+    * Register : DBG_FPD_CTRL @ 0XFD1A0068
 
-    * Number of cycles to assert SDRAM reset signal during init sequence. This
-    *  is only present for designs supporting DDR3, DDR4 or LPDDR4 devices. Fo
-    * r use with a DDR PHY, this should be set to a minimum of 1
-    *  PSU_DDRC_INIT1_DRAM_RSTN_X1024                              0x2
+    * 6 bit divider
+    *  PSU_CRF_APB_DBG_FPD_CTRL_DIVISOR0                           0x2
 
-    * Cycles to wait after completing the SDRAM initialization sequence before
-    *  starting the dynamic scheduler. Unit: Counts of a global timer that pul
-    * ses every 32 clock cycles. There is no known specific requirement for th
-    * is; it may be set to zero.
-    *  PSU_DDRC_INIT1_FINAL_WAIT_X32                               0x0
+    * 000 = IOPLL_TO_FPD; 010 = DPLL; 011 = APLL; (This signal may only be tog
+    * gled after 4 cycles of the old clock and 4 cycles of the new clock. This
+    *  is not usually an issue, but designers must be aware.)
+    *  PSU_CRF_APB_DBG_FPD_CTRL_SRCSEL                             0x0
 
-    * Wait period before driving the OCD complete command to SDRAM. Unit: Coun
-    * ts of a global timer that pulses every 32 clock cycles. There is no know
-    * n specific requirement for this; it may be set to zero.
-    *  PSU_DDRC_INIT1_PRE_OCD_X32                                  0x0
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRF_APB_DBG_FPD_CTRL_CLKACT                             0x1
 
-    * SDRAM Initialization Register 1
-    * (OFFSET, MASK, VALUE)      (0XFD0700D4, 0x01FF7F0FU ,0x00020000U)
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFD1A0068, 0x01003F07U ,0x01000200U)
     */
-	PSU_Mask_Write(DDRC_INIT1_OFFSET, 0x01FF7F0FU, 0x00020000U);
+	PSU_Mask_Write(CRF_APB_DBG_FPD_CTRL_OFFSET,
+		0x01003F07U, 0x01000200U);
 /*##################################################################### */
 
     /*
-    * Register : INIT2 @ 0XFD0700D8
+    * Register : DDR_CTRL @ 0XFD1A0080
 
-    * Idle time after the reset command, tINIT4. Present only in designs confi
-    * gured to support LPDDR2. Unit: 32 clock cycles.
-    *  PSU_DDRC_INIT2_IDLE_AFTER_RESET_X32                         0x23
+    * 6 bit divider
+    *  PSU_CRF_APB_DDR_CTRL_DIVISOR0                               0x2
 
-    * Time to wait after the first CKE high, tINIT2. Present only in designs c
-    * onfigured to support LPDDR2/LPDDR3. Unit: 1 clock cycle. LPDDR2/LPDDR3 t
-    * ypically requires 5 x tCK delay.
-    *  PSU_DDRC_INIT2_MIN_STABLE_CLOCK_X1                          0x5
+    * 000 = DPLL; 001 = VPLL; (This signal may only be toggled after 4 cycles
+    * of the old clock and 4 cycles of the new clock. This is not usually an i
+    * ssue, but designers must be aware.)
+    *  PSU_CRF_APB_DDR_CTRL_SRCSEL                                 0x0
 
-    * SDRAM Initialization Register 2
-    * (OFFSET, MASK, VALUE)      (0XFD0700D8, 0x0000FF0FU ,0x00002305U)
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFD1A0080, 0x00003F07U ,0x00000200U)
     */
-	PSU_Mask_Write(DDRC_INIT2_OFFSET, 0x0000FF0FU, 0x00002305U);
+	PSU_Mask_Write(CRF_APB_DDR_CTRL_OFFSET, 0x00003F07U, 0x00000200U);
 /*##################################################################### */
 
     /*
-    * Register : INIT3 @ 0XFD0700DC
+    * Register : GPU_REF_CTRL @ 0XFD1A0084
 
-    * DDR2: Value to write to MR register. Bit 8 is for DLL and the setting he
-    * re is ignored. The uMCTL2 sets this bit appropriately. DDR3/DDR4: Value
-    * loaded into MR0 register. mDDR: Value to write to MR register. LPDDR2/LP
-    * DDR3/LPDDR4 - Value to write to MR1 register
-    *  PSU_DDRC_INIT3_MR                                           0x730
+    * 6 bit divider
+    *  PSU_CRF_APB_GPU_REF_CTRL_DIVISOR0                           0x1
 
-    * DDR2: Value to write to EMR register. Bits 9:7 are for OCD and the setti
-    * ng in this register is ignored. The uMCTL2 sets those bits appropriately
-    * . DDR3/DDR4: Value to write to MR1 register Set bit 7 to 0. If PHY-evalu
-    * ation mode training is enabled, this bit is set appropriately by the uMC
-    * TL2 during write leveling. mDDR: Value to write to EMR register. LPDDR2/
-    * LPDDR3/LPDDR4 - Value to write to MR2 register
-    *  PSU_DDRC_INIT3_EMR                                          0x301
+    * 000 = IOPLL_TO_FPD; 010 = VPLL; 011 = DPLL; (This signal may only be tog
+    * gled after 4 cycles of the old clock and 4 cycles of the new clock. This
+    *  is not usually an issue, but designers must be aware.)
+    *  PSU_CRF_APB_GPU_REF_CTRL_SRCSEL                             0x0
 
-    * SDRAM Initialization Register 3
-    * (OFFSET, MASK, VALUE)      (0XFD0700DC, 0xFFFFFFFFU ,0x07300301U)
+    * Clock active signal. Switch to 0 to disable the clock, which will stop c
+    * lock for GPU (and both Pixel Processors).
+    *  PSU_CRF_APB_GPU_REF_CTRL_CLKACT                             0x1
+
+    * Clock active signal for Pixel Processor. Switch to 0 to disable the cloc
+    * k only to this Pixel Processor
+    *  PSU_CRF_APB_GPU_REF_CTRL_PP0_CLKACT                         0x1
+
+    * Clock active signal for Pixel Processor. Switch to 0 to disable the cloc
+    * k only to this Pixel Processor
+    *  PSU_CRF_APB_GPU_REF_CTRL_PP1_CLKACT                         0x1
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFD1A0084, 0x07003F07U ,0x07000100U)
     */
-	PSU_Mask_Write(DDRC_INIT3_OFFSET, 0xFFFFFFFFU, 0x07300301U);
+	PSU_Mask_Write(CRF_APB_GPU_REF_CTRL_OFFSET,
+		0x07003F07U, 0x07000100U);
 /*##################################################################### */
 
     /*
-    * Register : INIT4 @ 0XFD0700E0
+    * Register : GDMA_REF_CTRL @ 0XFD1A00B8
 
-    * DDR2: Value to write to EMR2 register. DDR3/DDR4: Value to write to MR2
-    * register LPDDR2/LPDDR3/LPDDR4: Value to write to MR3 register mDDR: Unus
-    * ed
-    *  PSU_DDRC_INIT4_EMR2                                         0x20
+    * 6 bit divider
+    *  PSU_CRF_APB_GDMA_REF_CTRL_DIVISOR0                          0x2
 
-    * DDR2: Value to write to EMR3 register. DDR3/DDR4: Value to write to MR3
-    * register mDDR/LPDDR2/LPDDR3: Unused LPDDR4: Value to write to MR13 regis
-    * ter
-    *  PSU_DDRC_INIT4_EMR3                                         0x200
+    * 000 = APLL; 010 = VPLL; 011 = DPLL; (This signal may only be toggled aft
+    * er 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    * usually an issue, but designers must be aware.)
+    *  PSU_CRF_APB_GDMA_REF_CTRL_SRCSEL                            0x0
 
-    * SDRAM Initialization Register 4
-    * (OFFSET, MASK, VALUE)      (0XFD0700E0, 0xFFFFFFFFU ,0x00200200U)
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRF_APB_GDMA_REF_CTRL_CLKACT                            0x1
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFD1A00B8, 0x01003F07U ,0x01000200U)
     */
-	PSU_Mask_Write(DDRC_INIT4_OFFSET, 0xFFFFFFFFU, 0x00200200U);
+	PSU_Mask_Write(CRF_APB_GDMA_REF_CTRL_OFFSET,
+		0x01003F07U, 0x01000200U);
 /*##################################################################### */
 
     /*
-    * Register : INIT5 @ 0XFD0700E4
+    * Register : DPDMA_REF_CTRL @ 0XFD1A00BC
 
-    * ZQ initial calibration, tZQINIT. Present only in designs configured to s
-    * upport DDR3 or DDR4 or LPDDR2/LPDDR3. Unit: 32 clock cycles. DDR3 typica
-    * lly requires 512 clocks. DDR4 requires 1024 clocks. LPDDR2/LPDDR3 requir
-    * es 1 us.
-    *  PSU_DDRC_INIT5_DEV_ZQINIT_X32                               0x21
+    * 6 bit divider
+    *  PSU_CRF_APB_DPDMA_REF_CTRL_DIVISOR0                         0x2
 
-    * Maximum duration of the auto initialization, tINIT5. Present only in des
-    * igns configured to support LPDDR2/LPDDR3. LPDDR2/LPDDR3 typically requir
-    * es 10 us.
-    *  PSU_DDRC_INIT5_MAX_AUTO_INIT_X1024                          0x4
+    * 000 = APLL; 010 = VPLL; 011 = DPLL; (This signal may only be toggled aft
+    * er 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    * usually an issue, but designers must be aware.)
+    *  PSU_CRF_APB_DPDMA_REF_CTRL_SRCSEL                           0x0
 
-    * SDRAM Initialization Register 5
-    * (OFFSET, MASK, VALUE)      (0XFD0700E4, 0x00FF03FFU ,0x00210004U)
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRF_APB_DPDMA_REF_CTRL_CLKACT                           0x1
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFD1A00BC, 0x01003F07U ,0x01000200U)
     */
-	PSU_Mask_Write(DDRC_INIT5_OFFSET, 0x00FF03FFU, 0x00210004U);
+	PSU_Mask_Write(CRF_APB_DPDMA_REF_CTRL_OFFSET,
+		0x01003F07U, 0x01000200U);
 /*##################################################################### */
 
     /*
-    * Register : INIT6 @ 0XFD0700E8
+    * Register : TOPSW_MAIN_CTRL @ 0XFD1A00C0
 
-    * DDR4- Value to be loaded into SDRAM MR4 registers. Used in DDR4 designs
-    * only.
-    *  PSU_DDRC_INIT6_MR4                                          0x0
+    * 6 bit divider
+    *  PSU_CRF_APB_TOPSW_MAIN_CTRL_DIVISOR0                        0x2
 
-    * DDR4- Value to be loaded into SDRAM MR5 registers. Used in DDR4 designs
-    * only.
-    *  PSU_DDRC_INIT6_MR5                                          0x6c0
+    * 000 = APLL; 010 = VPLL; 011 = DPLL; (This signal may only be toggled aft
+    * er 4 cycles of the old clock and 4 cycles of the new clock. This is not
+    * usually an issue, but designers must be aware.)
+    *  PSU_CRF_APB_TOPSW_MAIN_CTRL_SRCSEL                          0x3
 
-    * SDRAM Initialization Register 6
-    * (OFFSET, MASK, VALUE)      (0XFD0700E8, 0xFFFFFFFFU ,0x000006C0U)
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRF_APB_TOPSW_MAIN_CTRL_CLKACT                          0x1
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFD1A00C0, 0x01003F07U ,0x01000203U)
     */
-	PSU_Mask_Write(DDRC_INIT6_OFFSET, 0xFFFFFFFFU, 0x000006C0U);
+	PSU_Mask_Write(CRF_APB_TOPSW_MAIN_CTRL_OFFSET,
+		0x01003F07U, 0x01000203U);
 /*##################################################################### */
 
     /*
-    * Register : INIT7 @ 0XFD0700EC
+    * Register : TOPSW_LSBUS_CTRL @ 0XFD1A00C4
 
-    * DDR4- Value to be loaded into SDRAM MR6 registers. Used in DDR4 designs
-    * only.
-    *  PSU_DDRC_INIT7_MR6                                          0x819
+    * 6 bit divider
+    *  PSU_CRF_APB_TOPSW_LSBUS_CTRL_DIVISOR0                       0x5
 
-    * SDRAM Initialization Register 7
-    * (OFFSET, MASK, VALUE)      (0XFD0700EC, 0xFFFF0000U ,0x08190000U)
+    * 000 = APLL; 010 = IOPLL_TO_FPD; 011 = DPLL; (This signal may only be tog
+    * gled after 4 cycles of the old clock and 4 cycles of the new clock. This
+    *  is not usually an issue, but designers must be aware.)
+    *  PSU_CRF_APB_TOPSW_LSBUS_CTRL_SRCSEL                         0x2
+
+    * Clock active signal. Switch to 0 to disable the clock
+    *  PSU_CRF_APB_TOPSW_LSBUS_CTRL_CLKACT                         0x1
+
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFD1A00C4, 0x01003F07U ,0x01000502U)
     */
-	PSU_Mask_Write(DDRC_INIT7_OFFSET, 0xFFFF0000U, 0x08190000U);
+	PSU_Mask_Write(CRF_APB_TOPSW_LSBUS_CTRL_OFFSET,
+		0x01003F07U, 0x01000502U);
 /*##################################################################### */
 
     /*
-    * Register : DIMMCTL @ 0XFD0700F0
-
-    * Disabling Address Mirroring for BG bits. When this is set to 1, BG0 and
-    * BG1 are NOT swapped even if Address Mirroring is enabled. This will be r
-    * equired for DDR4 DIMMs with x16 devices. - 1 - BG0 and BG1 are NOT swapp
-    * ed. - 0 - BG0 and BG1 are swapped if address mirroring is enabled.
-    *  PSU_DDRC_DIMMCTL_DIMM_DIS_BG_MIRRORING                      0x0
-
-    * Enable for BG1 bit of MRS command. BG1 bit of the mode register address
-    * is specified as RFU (Reserved for Future Use) and must be programmed to
-    * 0 during MRS. In case where DRAMs which do not have BG1 are attached and
-    *  both the CA parity and the Output Inversion are enabled, this must be s
-    * et to 0, so that the calculation of CA parity will not include BG1 bit.
-    * Note: This has no effect on the address of any other memory accesses, or
-    *  of software-driven mode register accesses. If address mirroring is enab
-    * led, this is applied to BG1 of even ranks and BG0 of odd ranks. - 1 - En
-    * abled - 0 - Disabled
-    *  PSU_DDRC_DIMMCTL_MRS_BG1_EN                                 0x1
-
-    * Enable for A17 bit of MRS command. A17 bit of the mode register address
-    * is specified as RFU (Reserved for Future Use) and must be programmed to
-    * 0 during MRS. In case where DRAMs which do not have A17 are attached and
-    *  the Output Inversion are enabled, this must be set to 0, so that the ca
-    * lculation of CA parity will not include A17 bit. Note: This has no effec
-    * t on the address of any other memory accesses, or of software-driven mod
-    * e register accesses. - 1 - Enabled - 0 - Disabled
-    *  PSU_DDRC_DIMMCTL_MRS_A17_EN                                 0x0
-
-    * Output Inversion Enable (for DDR4 RDIMM implementations only). DDR4 RDIM
-    * M implements the Output Inversion feature by default, which means that t
-    * he following address, bank address and bank group bits of B-side DRAMs a
-    * re inverted: A3-A9, A11, A13, A17, BA0-BA1, BG0-BG1. Setting this bit en
-    * sures that, for mode register accesses generated by the uMCTL2 during th
-    * e automatic initialization routine and enabling of a particular DDR4 fea
-    * ture, separate A-side and B-side mode register accesses are generated. F
-    * or B-side mode register accesses, these bits are inverted within the uMC
-    * TL2 to compensate for this RDIMM inversion. Note: This has no effect on
-    * the address of any other memory accesses, or of software-driven mode reg
-    * ister accesses. - 1 - Implement output inversion for B-side DRAMs. - 0 -
-    *  Do not implement output inversion for B-side DRAMs.
-    *  PSU_DDRC_DIMMCTL_DIMM_OUTPUT_INV_EN                         0x0
+    * Register : DBG_TSTMP_CTRL @ 0XFD1A00F8
 
-    * Address Mirroring Enable (for multi-rank UDIMM implementations and multi
-    * -rank DDR4 RDIMM implementations). Some UDIMMs and DDR4 RDIMMs implement
-    *  address mirroring for odd ranks, which means that the following address
-    * , bank address and bank group bits are swapped: (A3, A4), (A5, A6), (A7,
-    *  A8), (BA0, BA1) and also (A11, A13), (BG0, BG1) for the DDR4. Setting t
-    * his bit ensures that, for mode register accesses during the automatic in
-    * itialization routine, these bits are swapped within the uMCTL2 to compen
-    * sate for this UDIMM/RDIMM swapping. In addition to the automatic initial
-    * ization routine, in case of DDR4 UDIMM/RDIMM, they are swapped during th
-    * e automatic MRS access to enable/disable of a particular DDR4 feature. N
-    * ote: This has no effect on the address of any other memory accesses, or
-    * of software-driven mode register accesses. This is not supported for mDD
-    * R, LPDDR2, LPDDR3 or LPDDR4 SDRAMs. Note: In case of x16 DDR4 DIMMs, BG1
-    *  output of MRS for the odd ranks is same as BG0 because BG1 is invalid,
-    * hence dimm_dis_bg_mirroring register must be set to 1. - 1 - For odd ran
-    * ks, implement address mirroring for MRS commands to during initializatio
-    * n and for any automatic DDR4 MRS commands (to be used if UDIMM/RDIMM imp
-    * lements address mirroring) - 0 - Do not implement address mirroring
-    *  PSU_DDRC_DIMMCTL_DIMM_ADDR_MIRR_EN                          0x0
+    * 6 bit divider
+    *  PSU_CRF_APB_DBG_TSTMP_CTRL_DIVISOR0                         0x2
 
-    * Staggering enable for multi-rank accesses (for multi-rank UDIMM and RDIM
-    * M implementations only). This is not supported for mDDR, LPDDR2, LPDDR3
-    * or LPDDR4 SDRAMs. Note: Even if this bit is set it does not take care of
-    *  software driven MR commands (via MRCTRL0/MRCTRL1), where software is re
-    * sponsible to send them to seperate ranks as appropriate. - 1 - (DDR4) Se
-    * nd MRS commands to each ranks seperately - 1 - (non-DDR4) Send all comma
-    * nds to even and odd ranks seperately - 0 - Do not stagger accesses
-    *  PSU_DDRC_DIMMCTL_DIMM_STAGGER_CS_EN                         0x0
+    * 000 = IOPLL_TO_FPD; 010 = DPLL; 011 = APLL; (This signal may only be tog
+    * gled after 4 cycles of the old clock and 4 cycles of the new clock. This
+    *  is not usually an issue, but designers must be aware.)
+    *  PSU_CRF_APB_DBG_TSTMP_CTRL_SRCSEL                           0x0
 
-    * DIMM Control Register
-    * (OFFSET, MASK, VALUE)      (0XFD0700F0, 0x0000003FU ,0x00000010U)
+    * This register controls this reference clock
+    * (OFFSET, MASK, VALUE)      (0XFD1A00F8, 0x00003F07U ,0x00000200U)
     */
-	PSU_Mask_Write(DDRC_DIMMCTL_OFFSET, 0x0000003FU, 0x00000010U);
+	PSU_Mask_Write(CRF_APB_DBG_TSTMP_CTRL_OFFSET,
+		0x00003F07U, 0x00000200U);
 /*##################################################################### */
 
     /*
-    * Register : RANKCTL @ 0XFD0700F4
+    * Register : IOU_TTC_APB_CLK @ 0XFF180380
 
-    * Only present for multi-rank configurations. Indicates the number of cloc
-    * ks of gap in data responses when performing consecutive writes to differ
-    * ent ranks. This is used to switch the delays in the PHY to match the ran
-    * k requirements. This value should consider both PHY requirement and ODT
-    * requirement. - PHY requirement: tphy_wrcsgap + 1 (see PHY databook for v
-    * alue of tphy_wrcsgap) If CRC feature is enabled, should be increased by
-    * 1. If write preamble is set to 2tCK(DDR4/LPDDR4 only), should be increas
-    * ed by 1. If write postamble is set to 1.5tCK(LPDDR4 only), should be inc
-    * reased by 1. - ODT requirement: The value programmed in this register ta
-    * kes care of the ODT switch off timing requirement when switching ranks d
-    * uring writes. For LPDDR4, the requirement is ODTLoff - ODTLon - BL/2 + 1
-    *  For configurations with MEMC_FREQ_RATIO=1, program this to the larger o
-    * f PHY requirement or ODT requirement. For configurations with MEMC_FREQ_
-    * RATIO=2, program this to the larger value divided by two and round it up
-    *  to the next integer.
-    *  PSU_DDRC_RANKCTL_DIFF_RANK_WR_GAP                           0x6
+    * 00" = Select the APB switch clock for the APB interface of TTC0'01" = Se
+    * lect the PLL ref clock for the APB interface of TTC0'10" = Select the R5
+    *  clock for the APB interface of TTC0
+    *  PSU_IOU_SLCR_IOU_TTC_APB_CLK_TTC0_SEL                       0
 
-    * Only present for multi-rank configurations. Indicates the number of cloc
-    * ks of gap in data responses when performing consecutive reads to differe
-    * nt ranks. This is used to switch the delays in the PHY to match the rank
-    *  requirements. This value should consider both PHY requirement and ODT r
-    * equirement. - PHY requirement: tphy_rdcsgap + 1 (see PHY databook for va
-    * lue of tphy_rdcsgap) If read preamble is set to 2tCK(DDR4/LPDDR4 only),
-    * should be increased by 1. If read postamble is set to 1.5tCK(LPDDR4 only
-    * ), should be increased by 1. - ODT requirement: The value programmed in
-    * this register takes care of the ODT switch off timing requirement when s
-    * witching ranks during reads. For configurations with MEMC_FREQ_RATIO=1,
-    * program this to the larger of PHY requirement or ODT requirement. For co
-    * nfigurations with MEMC_FREQ_RATIO=2, program this to the larger value di
-    * vided by two and round it up to the next integer.
-    *  PSU_DDRC_RANKCTL_DIFF_RANK_RD_GAP                           0x6
+    * 00" = Select the APB switch clock for the APB interface of TTC1'01" = Se
+    * lect the PLL ref clock for the APB interface of TTC1'10" = Select the R5
+    *  clock for the APB interface of TTC1
+    *  PSU_IOU_SLCR_IOU_TTC_APB_CLK_TTC1_SEL                       0
 
-    * Only present for multi-rank configurations. Background: Reads to the sam
-    * e rank can be performed back-to-back. Reads to different ranks require a
-    * dditional gap dictated by the register RANKCTL.diff_rank_rd_gap. This is
-    *  to avoid possible data bus contention as well as to give PHY enough tim
-    * e to switch the delay when changing ranks. The uMCTL2 arbitrates for bus
-    *  access on a cycle-by-cycle basis; therefore after a read is scheduled,
-    * there are few clock cycles (determined by the value on RANKCTL.diff_rank
-    * _rd_gap register) in which only reads from the same rank are eligible to
-    *  be scheduled. This prevents reads from other ranks from having fair acc
-    * ess to the data bus. This parameter represents the maximum number of rea
-    * ds that can be scheduled consecutively to the same rank. After this numb
-    * er is reached, a delay equal to RANKCTL.diff_rank_rd_gap is inserted by
-    * the scheduler to allow all ranks a fair opportunity to be scheduled. Hig
-    * her numbers increase bandwidth utilization, lower numbers increase fairn
-    * ess. This feature can be DISABLED by setting this register to 0. When se
-    * t to 0, the Controller will stay on the same rank as long as commands ar
-    * e available for it. Minimum programmable value is 0 (feature disabled) a
-    * nd maximum programmable value is 0xF. FOR PERFORMANCE ONLY.
-    *  PSU_DDRC_RANKCTL_MAX_RANK_RD                                0xf
+    * 00" = Select the APB switch clock for the APB interface of TTC2'01" = Se
+    * lect the PLL ref clock for the APB interface of TTC2'10" = Select the R5
+    *  clock for the APB interface of TTC2
+    *  PSU_IOU_SLCR_IOU_TTC_APB_CLK_TTC2_SEL                       0
 
-    * Rank Control Register
-    * (OFFSET, MASK, VALUE)      (0XFD0700F4, 0x00000FFFU ,0x0000066FU)
+    * 00" = Select the APB switch clock for the APB interface of TTC3'01" = Se
+    * lect the PLL ref clock for the APB interface of TTC3'10" = Select the R5
+    *  clock for the APB interface of TTC3
+    *  PSU_IOU_SLCR_IOU_TTC_APB_CLK_TTC3_SEL                       0
+
+    * TTC APB clock select
+    * (OFFSET, MASK, VALUE)      (0XFF180380, 0x000000FFU ,0x00000000U)
     */
-	PSU_Mask_Write(DDRC_RANKCTL_OFFSET, 0x00000FFFU, 0x0000066FU);
+	PSU_Mask_Write(IOU_SLCR_IOU_TTC_APB_CLK_OFFSET,
+		0x000000FFU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : DRAMTMG0 @ 0XFD070100
+    * Register : WDT_CLK_SEL @ 0XFD610100
 
-    * Minimum time between write and precharge to same bank. Unit: Clocks Spec
-    * ifications: WL + BL/2 + tWR = approximately 8 cycles + 15 ns = 14 clocks
+    * System watchdog timer clock source selection: 0: Internal APB clock 1: E
+    * xternal (PL clock via EMIO or Pinout clock via MIO)
+    *  PSU_FPD_SLCR_WDT_CLK_SEL_SELECT                             0
+
+    * SWDT clock source select
+    * (OFFSET, MASK, VALUE)      (0XFD610100, 0x00000001U ,0x00000000U)
+    */
+	PSU_Mask_Write(FPD_SLCR_WDT_CLK_SEL_OFFSET,
+		0x00000001U, 0x00000000U);
+/*##################################################################### */
+
+    /*
+    * Register : WDT_CLK_SEL @ 0XFF180300
+
+    * System watchdog timer clock source selection: 0: internal clock APB cloc
+    * k 1: external clock from PL via EMIO, or from pinout via MIO
+    *  PSU_IOU_SLCR_WDT_CLK_SEL_SELECT                             0
+
+    * SWDT clock source select
+    * (OFFSET, MASK, VALUE)      (0XFF180300, 0x00000001U ,0x00000000U)
+    */
+	PSU_Mask_Write(IOU_SLCR_WDT_CLK_SEL_OFFSET,
+		0x00000001U, 0x00000000U);
+/*##################################################################### */
+
+    /*
+    * Register : CSUPMU_WDT_CLK_SEL @ 0XFF410050
+
+    * System watchdog timer clock source selection: 0: internal clock APB cloc
+    * k 1: external clock pss_ref_clk
+    *  PSU_LPD_SLCR_CSUPMU_WDT_CLK_SEL_SELECT                      0
+
+    * SWDT clock source select
+    * (OFFSET, MASK, VALUE)      (0XFF410050, 0x00000001U ,0x00000000U)
+    */
+	PSU_Mask_Write(LPD_SLCR_CSUPMU_WDT_CLK_SEL_OFFSET,
+		0x00000001U, 0x00000000U);
+/*##################################################################### */
+
+
+	return 1;
+#endif /* PSU_INIT_TABLE */
+}
+unsigned long psu_ddr_init_data(void)
+{
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_ddr_init_data_table);
+#else
+    /*
+    * DDR INITIALIZATION
+    */
+    /*
+    * DDR CONTROLLER RESET
+    */
+    /*
+    * Register : RST_DDR_SS @ 0XFD1A0108
+
+    * DDR block level reset inside of the DDR Sub System
+    *  PSU_CRF_APB_RST_DDR_SS_DDR_RESET                            0X1
+
+    * DDR sub system block level reset
+    * (OFFSET, MASK, VALUE)      (0XFD1A0108, 0x00000008U ,0x00000008U)
+    */
+	PSU_Mask_Write(CRF_APB_RST_DDR_SS_OFFSET, 0x00000008U, 0x00000008U);
+/*##################################################################### */
+
+    /*
+    * Register : MSTR @ 0XFD070000
+
+    * Indicates the configuration of the device used in the system. - 00 - x4
+    * device - 01 - x8 device - 10 - x16 device - 11 - x32 device
+    *  PSU_DDRC_MSTR_DEVICE_CONFIG                                 0x1
+
+    * Choose which registers are used. - 0 - Original registers - 1 - Shadow r
+    * egisters
+    *  PSU_DDRC_MSTR_FREQUENCY_MODE                                0x0
+
+    * Only present for multi-rank configurations. Each bit represents one rank
+    * . For two-rank configurations, only bits[25:24] are present. - 1 - popul
+    * ated - 0 - unpopulated LSB is the lowest rank number. For 2 ranks follow
+    * ing combinations are legal: - 01 - One rank - 11 - Two ranks - Others -
+    * Reserved. For 4 ranks following combinations are legal: - 0001 - One ran
+    * k - 0011 - Two ranks - 1111 - Four ranks
+    *  PSU_DDRC_MSTR_ACTIVE_RANKS                                  0x1
+
+    * SDRAM burst length used: - 0001 - Burst length of 2 (only supported for
+    * mDDR) - 0010 - Burst length of 4 - 0100 - Burst length of 8 - 1000 - Bur
+    * st length of 16 (only supported for mDDR, LPDDR2, and LPDDR4) All other
+    * values are reserved. This controls the burst size used to access the SDR
+    * AM. This must match the burst length mode register setting in the SDRAM.
+    *  (For BC4/8 on-the-fly mode of DDR3 and DDR4, set this field to 0x0100)
+    * Burst length of 2 is not supported with AXI ports when MEMC_BURST_LENGTH
+    *  is 8. Burst length of 2 is only supported with MEMC_FREQ_RATIO = 1
+    *  PSU_DDRC_MSTR_BURST_RDWR                                    0x4
+
+    * Set to 1 when the uMCTL2 and DRAM has to be put in DLL-off mode for low
+    * frequency operation. Set to 0 to put uMCTL2 and DRAM in DLL-on mode for
+    * normal frequency operation. If DDR4 CRC/parity retry is enabled (CRCPARC
+    * TL1.crc_parity_retry_enable = 1), dll_off_mode is not supported, and thi
+    * s bit must be set to '0'.
+    *  PSU_DDRC_MSTR_DLL_OFF_MODE                                  0x0
+
+    * Selects proportion of DQ bus width that is used by the SDRAM - 00 - Full
+    *  DQ bus width to SDRAM - 01 - Half DQ bus width to SDRAM - 10 - Quarter
+    * DQ bus width to SDRAM - 11 - Reserved. Note that half bus width mode is
+    * only supported when the SDRAM bus width is a multiple of 16, and quarter
+    *  bus width mode is only supported when the SDRAM bus width is a multiple
+    *  of 32 and the configuration parameter MEMC_QBUS_SUPPORT is set. Bus wid
+    * th refers to DQ bus width (excluding any ECC width).
+    *  PSU_DDRC_MSTR_DATA_BUS_WIDTH                                0x0
+
+    * 1 indicates put the DRAM in geardown mode (2N) and 0 indicates put the D
+    * RAM in normal mode (1N). This register can be changed, only when the Con
+    * troller is in self-refresh mode. This signal must be set the same value
+    * as MR3 bit A3. Note: Geardown mode is not supported if the configuration
+    *  parameter MEMC_CMD_RTN2IDLE is set
+    *  PSU_DDRC_MSTR_GEARDOWN_MODE                                 0x0
+
+    * If 1, then uMCTL2 uses 2T timing. Otherwise, uses 1T timing. In 2T timin
+    * g, all command signals (except chip select) are held for 2 clocks on the
+    *  SDRAM bus. Chip select is asserted on the second cycle of the command N
+    * ote: 2T timing is not supported in LPDDR2/LPDDR3/LPDDR4 mode Note: 2T ti
+    * ming is not supported if the configuration parameter MEMC_CMD_RTN2IDLE i
+    * s set Note: 2T timing is not supported in DDR4 geardown mode.
+    *  PSU_DDRC_MSTR_EN_2T_TIMING_MODE                             0x0
+
+    * When set, enable burst-chop in DDR3/DDR4. Burst Chop for Reads is exerci
+    * sed only in HIF configurations (UMCTL2_INCL_ARB not set) and if in full
+    * bus width mode (MSTR.data_bus_width = 00). Burst Chop for Writes is exer
+    * cised only if Partial Writes enabled (UMCTL2_PARTIAL_WR=1) and if CRC is
+    *  disabled (CRCPARCTL1.crc_enable = 0). If DDR4 CRC/parity retry is enabl
+    * ed (CRCPARCTL1.crc_parity_retry_enable = 1), burst chop is not supported
+    * , and this bit must be set to '0'
+    *  PSU_DDRC_MSTR_BURSTCHOP                                     0x0
+
+    * Select LPDDR4 SDRAM - 1 - LPDDR4 SDRAM device in use. - 0 - non-LPDDR4 d
+    * evice in use Present only in designs configured to support LPDDR4.
+    *  PSU_DDRC_MSTR_LPDDR4                                        0x0
+
+    * Select DDR4 SDRAM - 1 - DDR4 SDRAM device in use. - 0 - non-DDR4 device
+    * in use Present only in designs configured to support DDR4.
+    *  PSU_DDRC_MSTR_DDR4                                          0x1
+
+    * Select LPDDR3 SDRAM - 1 - LPDDR3 SDRAM device in use. - 0 - non-LPDDR3 d
+    * evice in use Present only in designs configured to support LPDDR3.
+    *  PSU_DDRC_MSTR_LPDDR3                                        0x0
+
+    * Select LPDDR2 SDRAM - 1 - LPDDR2 SDRAM device in use. - 0 - non-LPDDR2 d
+    * evice in use Present only in designs configured to support LPDDR2.
+    *  PSU_DDRC_MSTR_LPDDR2                                        0x0
+
+    * Select DDR3 SDRAM - 1 - DDR3 SDRAM device in use - 0 - non-DDR3 SDRAM de
+    * vice in use Only present in designs that support DDR3.
+    *  PSU_DDRC_MSTR_DDR3                                          0x0
+
+    * Master Register
+    * (OFFSET, MASK, VALUE)      (0XFD070000, 0xE30FBE3DU ,0x41040010U)
+    */
+	PSU_Mask_Write(DDRC_MSTR_OFFSET, 0xE30FBE3DU, 0x41040010U);
+/*##################################################################### */
+
+    /*
+    * Register : MRCTRL0 @ 0XFD070010
+
+    * Setting this register bit to 1 triggers a mode register read or write op
+    * eration. When the MR operation is complete, the uMCTL2 automatically cle
+    * ars this bit. The other register fields of this register must be written
+    *  in a separate APB transaction, before setting this mr_wr bit. It is rec
+    * ommended NOT to set this signal if in Init, Deep power-down or MPSM oper
+    * ating modes.
+    *  PSU_DDRC_MRCTRL0_MR_WR                                      0x0
+
+    * Address of the mode register that is to be written to. - 0000 - MR0 - 00
+    * 01 - MR1 - 0010 - MR2 - 0011 - MR3 - 0100 - MR4 - 0101 - MR5 - 0110 - MR
+    * 6 - 0111 - MR7 Don't Care for LPDDR2/LPDDR3/LPDDR4 (see MRCTRL1.mr_data
+    * for mode register addressing in LPDDR2/LPDDR3/LPDDR4) This signal is als
+    * o used for writing to control words of RDIMMs. In that case, it correspo
+    * nds to the bank address bits sent to the RDIMM In case of DDR4, the bit[
+    * 3:2] corresponds to the bank group bits. Therefore, the bit[3] as well a
+    * s the bit[2:0] must be set to an appropriate value which is considered b
+    * oth the Address Mirroring of UDIMMs/RDIMMs and the Output Inversion of R
+    * DIMMs.
+    *  PSU_DDRC_MRCTRL0_MR_ADDR                                    0x0
+
+    * Controls which rank is accessed by MRCTRL0.mr_wr. Normally, it is desire
+    * d to access all ranks, so all bits should be set to 1. However, for mult
+    * i-rank UDIMMs/RDIMMs which implement address mirroring, it may be necess
+    * ary to access ranks individually. Examples (assume uMCTL2 is configured
+    * for 4 ranks): - 0x1 - select rank 0 only - 0x2 - select rank 1 only - 0x
+    * 5 - select ranks 0 and 2 - 0xA - select ranks 1 and 3 - 0xF - select ran
+    * ks 0, 1, 2 and 3
+    *  PSU_DDRC_MRCTRL0_MR_RANK                                    0x3
+
+    * Indicates whether Software intervention is allowed via MRCTRL0/MRCTRL1 b
+    * efore automatic SDRAM initialization routine or not. For DDR4, this bit
+    * can be used to initialize the DDR4 RCD (MR7) before automatic SDRAM init
+    * ialization. For LPDDR4, this bit can be used to program additional mode
+    * registers before automatic SDRAM initialization if necessary. Note: This
+    *  must be cleared to 0 after completing Software operation. Otherwise, SD
+    * RAM initialization routine will not re-start. - 0 - Software interventio
+    * n is not allowed - 1 - Software intervention is allowed
+    *  PSU_DDRC_MRCTRL0_SW_INIT_INT                                0x0
+
+    * Indicates whether the mode register operation is MRS in PDA mode or not
+    * - 0 - MRS - 1 - MRS in Per DRAM Addressability mode
+    *  PSU_DDRC_MRCTRL0_PDA_EN                                     0x0
+
+    * Indicates whether the mode register operation is MRS or WR/RD for MPR (o
+    * nly supported for DDR4) - 0 - MRS - 1 - WR/RD for MPR
+    *  PSU_DDRC_MRCTRL0_MPR_EN                                     0x0
+
+    * Indicates whether the mode register operation is read or write. Only use
+    * d for LPDDR2/LPDDR3/LPDDR4/DDR4. - 0 - Write - 1 - Read
+    *  PSU_DDRC_MRCTRL0_MR_TYPE                                    0x0
+
+    * Mode Register Read/Write Control Register 0. Note: Do not enable more th
+    * an one of the following fields simultaneously: - sw_init_int - pda_en -
+    * mpr_en
+    * (OFFSET, MASK, VALUE)      (0XFD070010, 0x8000F03FU ,0x00000030U)
+    */
+	PSU_Mask_Write(DDRC_MRCTRL0_OFFSET, 0x8000F03FU, 0x00000030U);
+/*##################################################################### */
+
+    /*
+    * Register : DERATEEN @ 0XFD070020
+
+    * Derate value of tRC for LPDDR4 - 0 - Derating uses +1. - 1 - Derating us
+    * es +2. - 2 - Derating uses +3. - 3 - Derating uses +4. Present only in d
+    * esigns configured to support LPDDR4. The required number of cycles for d
+    * erating can be determined by dividing 3.75ns by the core_ddrc_core_clk p
+    * eriod, and rounding up the next integer.
+    *  PSU_DDRC_DERATEEN_RC_DERATE_VALUE                           0x2
+
+    * Derate byte Present only in designs configured to support LPDDR2/LPDDR3/
+    * LPDDR4 Indicates which byte of the MRR data is used for derating. The ma
+    * ximum valid value depends on MEMC_DRAM_TOTAL_DATA_WIDTH.
+    *  PSU_DDRC_DERATEEN_DERATE_BYTE                               0x0
+
+    * Derate value - 0 - Derating uses +1. - 1 - Derating uses +2. Present onl
+    * y in designs configured to support LPDDR2/LPDDR3/LPDDR4 Set to 0 for all
+    *  LPDDR2 speed grades as derating value of +1.875 ns is less than a core_
+    * ddrc_core_clk period. Can be 0 or 1 for LPDDR3/LPDDR4, depending if +1.8
+    * 75 ns is less than a core_ddrc_core_clk period or not.
+    *  PSU_DDRC_DERATEEN_DERATE_VALUE                              0x0
+
+    * Enables derating - 0 - Timing parameter derating is disabled - 1 - Timin
+    * g parameter derating is enabled using MR4 read value. Present only in de
+    * signs configured to support LPDDR2/LPDDR3/LPDDR4 This field must be set
+    * to '0' for non-LPDDR2/LPDDR3/LPDDR4 mode.
+    *  PSU_DDRC_DERATEEN_DERATE_ENABLE                             0x0
+
+    * Temperature Derate Enable Register
+    * (OFFSET, MASK, VALUE)      (0XFD070020, 0x000003F3U ,0x00000200U)
+    */
+	PSU_Mask_Write(DDRC_DERATEEN_OFFSET, 0x000003F3U, 0x00000200U);
+/*##################################################################### */
+
+    /*
+    * Register : DERATEINT @ 0XFD070024
+
+    * Interval between two MR4 reads, used to derate the timing parameters. Pr
+    * esent only in designs configured to support LPDDR2/LPDDR3/LPDDR4. This r
+    * egister must not be set to zero
+    *  PSU_DDRC_DERATEINT_MR4_READ_INTERVAL                        0x800000
+
+    * Temperature Derate Interval Register
+    * (OFFSET, MASK, VALUE)      (0XFD070024, 0xFFFFFFFFU ,0x00800000U)
+    */
+	PSU_Mask_Write(DDRC_DERATEINT_OFFSET, 0xFFFFFFFFU, 0x00800000U);
+/*##################################################################### */
+
+    /*
+    * Register : PWRCTL @ 0XFD070030
+
+    * Self refresh state is an intermediate state to enter to Self refresh pow
+    * er down state or exit Self refresh power down state for LPDDR4. This reg
+    * ister controls transition from the Self refresh state. - 1 - Prohibit tr
+    * ansition from Self refresh state - 0 - Allow transition from Self refres
+    * h state
+    *  PSU_DDRC_PWRCTL_STAY_IN_SELFREF                             0x0
+
+    * A value of 1 to this register causes system to move to Self Refresh stat
+    * e immediately, as long as it is not in INIT or DPD/MPSM operating_mode.
+    * This is referred to as Software Entry/Exit to Self Refresh. - 1 - Softwa
+    * re Entry to Self Refresh - 0 - Software Exit from Self Refresh
+    *  PSU_DDRC_PWRCTL_SELFREF_SW                                  0x0
+
+    * When this is 1, the uMCTL2 puts the SDRAM into maximum power saving mode
+    *  when the transaction store is empty. This register must be reset to '0'
+    *  to bring uMCTL2 out of maximum power saving mode. Present only in desig
+    * ns configured to support DDR4. For non-DDR4, this register should not be
+    *  set to 1. Note that MPSM is not supported when using a DWC DDR PHY, if
+    * the PHY parameter DWC_AC_CS_USE is disabled, as the MPSM exit sequence r
+    * equires the chip-select signal to toggle. FOR PERFORMANCE ONLY.
+    *  PSU_DDRC_PWRCTL_MPSM_EN                                     0x0
+
+    * Enable the assertion of dfi_dram_clk_disable whenever a clock is not req
+    * uired by the SDRAM. If set to 0, dfi_dram_clk_disable is never asserted.
+    *  Assertion of dfi_dram_clk_disable is as follows: In DDR2/DDR3, can only
+    *  be asserted in Self Refresh. In DDR4, can be asserted in following: - i
+    * n Self Refresh. - in Maximum Power Saving Mode In mDDR/LPDDR2/LPDDR3, ca
+    * n be asserted in following: - in Self Refresh - in Power Down - in Deep
+    * Power Down - during Normal operation (Clock Stop) In LPDDR4, can be asse
+    * rted in following: - in Self Refresh Power Down - in Power Down - during
+    *  Normal operation (Clock Stop)
+    *  PSU_DDRC_PWRCTL_EN_DFI_DRAM_CLK_DISABLE                     0x0
+
+    * When this is 1, uMCTL2 puts the SDRAM into deep power-down mode when the
+    *  transaction store is empty. This register must be reset to '0' to bring
+    *  uMCTL2 out of deep power-down mode. Controller performs automatic SDRAM
+    *  initialization on deep power-down exit. Present only in designs configu
+    * red to support mDDR or LPDDR2 or LPDDR3. For non-mDDR/non-LPDDR2/non-LPD
+    * DR3, this register should not be set to 1. FOR PERFORMANCE ONLY.
+    *  PSU_DDRC_PWRCTL_DEEPPOWERDOWN_EN                            0x0
+
+    * If true then the uMCTL2 goes into power-down after a programmable number
+    *  of cycles 'maximum idle clocks before power down' (PWRTMG.powerdown_to_
+    * x32). This register bit may be re-programmed during the course of normal
+    *  operation.
+    *  PSU_DDRC_PWRCTL_POWERDOWN_EN                                0x0
+
+    * If true then the uMCTL2 puts the SDRAM into Self Refresh after a program
+    * mable number of cycles 'maximum idle clocks before Self Refresh (PWRTMG.
+    * selfref_to_x32)'. This register bit may be re-programmed during the cour
+    * se of normal operation.
+    *  PSU_DDRC_PWRCTL_SELFREF_EN                                  0x0
+
+    * Low Power Control Register
+    * (OFFSET, MASK, VALUE)      (0XFD070030, 0x0000007FU ,0x00000000U)
+    */
+	PSU_Mask_Write(DDRC_PWRCTL_OFFSET, 0x0000007FU, 0x00000000U);
+/*##################################################################### */
+
+    /*
+    * Register : PWRTMG @ 0XFD070034
+
+    * After this many clocks of NOP or deselect the uMCTL2 automatically puts
+    * the SDRAM into Self Refresh. This must be enabled in the PWRCTL.selfref_
+    * en. Unit: Multiples of 32 clocks. FOR PERFORMANCE ONLY.
+    *  PSU_DDRC_PWRTMG_SELFREF_TO_X32                              0x40
+
+    * Minimum deep power-down time. For mDDR, value from the JEDEC specificati
+    * on is 0 as mDDR exits from deep power-down mode immediately after PWRCTL
+    * .deeppowerdown_en is de-asserted. For LPDDR2/LPDDR3, value from the JEDE
+    * C specification is 500us. Unit: Multiples of 4096 clocks. Present only i
+    * n designs configured to support mDDR, LPDDR2 or LPDDR3. FOR PERFORMANCE
+    * ONLY.
+    *  PSU_DDRC_PWRTMG_T_DPD_X4096                                 0x84
+
+    * After this many clocks of NOP or deselect the uMCTL2 automatically puts
+    * the SDRAM into power-down. This must be enabled in the PWRCTL.powerdown_
+    * en. Unit: Multiples of 32 clocks FOR PERFORMANCE ONLY.
+    *  PSU_DDRC_PWRTMG_POWERDOWN_TO_X32                            0x10
+
+    * Low Power Timing Register
+    * (OFFSET, MASK, VALUE)      (0XFD070034, 0x00FFFF1FU ,0x00408410U)
+    */
+	PSU_Mask_Write(DDRC_PWRTMG_OFFSET, 0x00FFFF1FU, 0x00408410U);
+/*##################################################################### */
+
+    /*
+    * Register : RFSHCTL0 @ 0XFD070050
+
+    * Threshold value in number of clock cycles before the critical refresh or
+    *  page timer expires. A critical refresh is to be issued before this thre
+    * shold is reached. It is recommended that this not be changed from the de
+    * fault value, currently shown as 0x2. It must always be less than interna
+    * lly used t_rfc_nom_x32. Note that, in LPDDR2/LPDDR3/LPDDR4, internally u
+    * sed t_rfc_nom_x32 may be equal to RFSHTMG.t_rfc_nom_x32>>2 if derating i
+    * s enabled (DERATEEN.derate_enable=1). Otherwise, internally used t_rfc_n
+    * om_x32 will be equal to RFSHTMG.t_rfc_nom_x32. Unit: Multiples of 32 clo
+    * cks.
+    *  PSU_DDRC_RFSHCTL0_REFRESH_MARGIN                            0x2
+
+    * If the refresh timer (tRFCnom, also known as tREFI) has expired at least
+    *  once, but it has not expired (RFSHCTL0.refresh_burst+1) times yet, then
+    *  a speculative refresh may be performed. A speculative refresh is a refr
+    * esh performed at a time when refresh would be useful, but before it is a
+    * bsolutely required. When the SDRAM bus is idle for a period of time dete
+    * rmined by this RFSHCTL0.refresh_to_x32 and the refresh timer has expired
+    *  at least once since the last refresh, then a speculative refresh is per
+    * formed. Speculative refreshes continues successively until there are no
+    * refreshes pending or until new reads or writes are issued to the uMCTL2.
+    *  FOR PERFORMANCE ONLY.
+    *  PSU_DDRC_RFSHCTL0_REFRESH_TO_X32                            0x10
+
+    * The programmed value + 1 is the number of refresh timeouts that is allow
+    * ed to accumulate before traffic is blocked and the refreshes are forced
+    * to execute. Closing pages to perform a refresh is a one-time penalty tha
+    * t must be paid for each group of refreshes. Therefore, performing refres
+    * hes in a burst reduces the per-refresh penalty of these page closings. H
+    * igher numbers for RFSHCTL.refresh_burst slightly increases utilization;
+    * lower numbers decreases the worst-case latency associated with refreshes
+    * . - 0 - single refresh - 1 - burst-of-2 refresh - 7 - burst-of-8 refresh
+    *  For information on burst refresh feature refer to section 3.9 of DDR2 J
+    * EDEC specification - JESD79-2F.pdf. For DDR2/3, the refresh is always pe
+    * r-rank and not per-bank. The rank refresh can be accumulated over 8*tREF
+    * I cycles using the burst refresh feature. In DDR4 mode, according to Fin
+    * e Granularity feature, 8 refreshes can be postponed in 1X mode, 16 refre
+    * shes in 2X mode and 32 refreshes in 4X mode. If using PHY-initiated upda
+    * tes, care must be taken in the setting of RFSHCTL0.refresh_burst, to ens
+    * ure that tRFCmax is not violated due to a PHY-initiated update occurring
+    *  shortly before a refresh burst was due. In this situation, the refresh
+    * burst will be delayed until the PHY-initiated update is complete.
+    *  PSU_DDRC_RFSHCTL0_REFRESH_BURST                             0x0
+
+    * - 1 - Per bank refresh; - 0 - All bank refresh. Per bank refresh allows
+    * traffic to flow to other banks. Per bank refresh is not supported by all
+    *  LPDDR2 devices but should be supported by all LPDDR3/LPDDR4 devices. Pr
+    * esent only in designs configured to support LPDDR2/LPDDR3/LPDDR4
+    *  PSU_DDRC_RFSHCTL0_PER_BANK_REFRESH                          0x0
+
+    * Refresh Control Register 0
+    * (OFFSET, MASK, VALUE)      (0XFD070050, 0x00F1F1F4U ,0x00210000U)
+    */
+	PSU_Mask_Write(DDRC_RFSHCTL0_OFFSET, 0x00F1F1F4U, 0x00210000U);
+/*##################################################################### */
+
+    /*
+    * Register : RFSHCTL1 @ 0XFD070054
+
+    * Refresh timer start for rank 1 (only present in multi-rank configuration
+    * s). This is useful in staggering the refreshes to multiple ranks to help
+    *  traffic to proceed. This is explained in Refresh Controls section of ar
+    * chitecture chapter. Unit: Multiples of 32 clocks. FOR PERFORMANCE ONLY.
+    *  PSU_DDRC_RFSHCTL1_REFRESH_TIMER1_START_VALUE_X32            0x0
+
+    * Refresh timer start for rank 0 (only present in multi-rank configuration
+    * s). This is useful in staggering the refreshes to multiple ranks to help
+    *  traffic to proceed. This is explained in Refresh Controls section of ar
+    * chitecture chapter. Unit: Multiples of 32 clocks. FOR PERFORMANCE ONLY.
+    *  PSU_DDRC_RFSHCTL1_REFRESH_TIMER0_START_VALUE_X32            0x0
+
+    * Refresh Control Register 1
+    * (OFFSET, MASK, VALUE)      (0XFD070054, 0x0FFF0FFFU ,0x00000000U)
+    */
+	PSU_Mask_Write(DDRC_RFSHCTL1_OFFSET, 0x0FFF0FFFU, 0x00000000U);
+/*##################################################################### */
+
+    /*
+    * Register : RFSHCTL3 @ 0XFD070060
+
+    * Fine Granularity Refresh Mode - 000 - Fixed 1x (Normal mode) - 001 - Fix
+    * ed 2x - 010 - Fixed 4x - 101 - Enable on the fly 2x (not supported) - 11
+    * 0 - Enable on the fly 4x (not supported) - Everything else - reserved No
+    * te: The on-the-fly modes is not supported in this version of the uMCTL2.
+    *  Note: This must be set up while the Controller is in reset or while the
+    *  Controller is in self-refresh mode. Changing this during normal operati
+    * on is not allowed. Making this a dynamic register will be supported in f
+    * uture version of the uMCTL2.
+    *  PSU_DDRC_RFSHCTL3_REFRESH_MODE                              0x0
+
+    * Toggle this signal (either from 0 to 1 or from 1 to 0) to indicate that
+    * the refresh register(s) have been updated. The value is automatically up
+    * dated when exiting reset, so it does not need to be toggled initially.
+    *  PSU_DDRC_RFSHCTL3_REFRESH_UPDATE_LEVEL                      0x0
+
+    * When '1', disable auto-refresh generated by the uMCTL2. When auto-refres
+    * h is disabled, the SoC core must generate refreshes using the registers
+    * reg_ddrc_rank0_refresh, reg_ddrc_rank1_refresh, reg_ddrc_rank2_refresh a
+    * nd reg_ddrc_rank3_refresh. When dis_auto_refresh transitions from 0 to 1
+    * , any pending refreshes are immediately scheduled by the uMCTL2. If DDR4
+    *  CRC/parity retry is enabled (CRCPARCTL1.crc_parity_retry_enable = 1), d
+    * isable auto-refresh is not supported, and this bit must be set to '0'. T
+    * his register field is changeable on the fly.
+    *  PSU_DDRC_RFSHCTL3_DIS_AUTO_REFRESH                          0x1
+
+    * Refresh Control Register 3
+    * (OFFSET, MASK, VALUE)      (0XFD070060, 0x00000073U ,0x00000001U)
+    */
+	PSU_Mask_Write(DDRC_RFSHCTL3_OFFSET, 0x00000073U, 0x00000001U);
+/*##################################################################### */
+
+    /*
+    * Register : RFSHTMG @ 0XFD070064
+
+    * tREFI: Average time interval between refreshes per rank (Specification:
+    * 7.8us for DDR2, DDR3 and DDR4. See JEDEC specification for mDDR, LPDDR2,
+    *  LPDDR3 and LPDDR4). For LPDDR2/LPDDR3/LPDDR4: - if using all-bank refre
+    * shes (RFSHCTL0.per_bank_refresh = 0), this register should be set to tRE
+    * FIab - if using per-bank refreshes (RFSHCTL0.per_bank_refresh = 1), this
+    *  register should be set to tREFIpb For configurations with MEMC_FREQ_RAT
+    * IO=2, program this to (tREFI/2), no rounding up. In DDR4 mode, tREFI val
+    * ue is different depending on the refresh mode. The user should program t
+    * he appropriate value from the spec based on the value programmed in the
+    * refresh mode register. Note that RFSHTMG.t_rfc_nom_x32 * 32 must be grea
+    * ter than RFSHTMG.t_rfc_min, and RFSHTMG.t_rfc_nom_x32 must be greater th
+    * an 0x1. Unit: Multiples of 32 clocks.
+    *  PSU_DDRC_RFSHTMG_T_RFC_NOM_X32                              0x81
+
+    * Used only when LPDDR3 memory type is connected. Should only be changed w
+    * hen uMCTL2 is in reset. Specifies whether to use the tREFBW parameter (r
+    * equired by some LPDDR3 devices which comply with earlier versions of the
+    *  LPDDR3 JEDEC specification) or not: - 0 - tREFBW parameter not used - 1
+    *  - tREFBW parameter used
+    *  PSU_DDRC_RFSHTMG_LPDDR3_TREFBW_EN                           0x1
+
+    * tRFC (min): Minimum time from refresh to refresh or activate. For MEMC_F
+    * REQ_RATIO=1 configurations, t_rfc_min should be set to RoundUp(tRFCmin/t
+    * CK). For MEMC_FREQ_RATIO=2 configurations, t_rfc_min should be set to Ro
+    * undUp(RoundUp(tRFCmin/tCK)/2). In LPDDR2/LPDDR3/LPDDR4 mode: - if using
+    * all-bank refreshes, the tRFCmin value in the above equations is equal to
+    *  tRFCab - if using per-bank refreshes, the tRFCmin value in the above eq
+    * uations is equal to tRFCpb In DDR4 mode, the tRFCmin value in the above
+    * equations is different depending on the refresh mode (fixed 1X,2X,4X) an
+    * d the device density. The user should program the appropriate value from
+    *  the spec based on the 'refresh_mode' and the device density that is use
+    * d. Unit: Clocks.
+    *  PSU_DDRC_RFSHTMG_T_RFC_MIN                                  0x8b
+
+    * Refresh Timing Register
+    * (OFFSET, MASK, VALUE)      (0XFD070064, 0x0FFF83FFU ,0x0081808BU)
+    */
+	PSU_Mask_Write(DDRC_RFSHTMG_OFFSET, 0x0FFF83FFU, 0x0081808BU);
+/*##################################################################### */
+
+    /*
+    * Register : ECCCFG0 @ 0XFD070070
+
+    * Disable ECC scrubs. Valid only when ECCCFG0.ecc_mode = 3'b100 and MEMC_U
+    * SE_RMW is defined
+    *  PSU_DDRC_ECCCFG0_DIS_SCRUB                                  0x1
+
+    * ECC mode indicator - 000 - ECC disabled - 100 - ECC enabled - SEC/DED ov
+    * er 1 beat - all other settings are reserved for future use
+    *  PSU_DDRC_ECCCFG0_ECC_MODE                                   0x0
+
+    * ECC Configuration Register 0
+    * (OFFSET, MASK, VALUE)      (0XFD070070, 0x00000017U ,0x00000010U)
+    */
+	PSU_Mask_Write(DDRC_ECCCFG0_OFFSET, 0x00000017U, 0x00000010U);
+/*##################################################################### */
+
+    /*
+    * Register : ECCCFG1 @ 0XFD070074
+
+    * Selects whether to poison 1 or 2 bits - if 0 -> 2-bit (uncorrectable) da
+    * ta poisoning, if 1 -> 1-bit (correctable) data poisoning, if ECCCFG1.dat
+    * a_poison_en=1
+    *  PSU_DDRC_ECCCFG1_DATA_POISON_BIT                            0x0
+
+    * Enable ECC data poisoning - introduces ECC errors on writes to address s
+    * pecified by the ECCPOISONADDR0/1 registers
+    *  PSU_DDRC_ECCCFG1_DATA_POISON_EN                             0x0
+
+    * ECC Configuration Register 1
+    * (OFFSET, MASK, VALUE)      (0XFD070074, 0x00000003U ,0x00000000U)
+    */
+	PSU_Mask_Write(DDRC_ECCCFG1_OFFSET, 0x00000003U, 0x00000000U);
+/*##################################################################### */
+
+    /*
+    * Register : CRCPARCTL1 @ 0XFD0700C4
+
+    * The maximum number of DFI PHY clock cycles allowed from the assertion of
+    *  the dfi_rddata_en signal to the assertion of each of the corresponding
+    * bits of the dfi_rddata_valid signal. This corresponds to the DFI timing
+    * parameter tphy_rdlat. Refer to PHY specification for correct value. This
+    *  value it only used for detecting read data timeout when DDR4 retry is e
+    * nabled by CRCPARCTL1.crc_parity_retry_enable=1. Maximum supported value:
+    *  - 1:1 Frequency mode : DFITMG0.dfi_t_rddata_en + CRCPARCTL1.dfi_t_phy_r
+    * dlat < 'd114 - 1:2 Frequency mode ANDAND DFITMG0.dfi_rddata_use_sdr == 1
+    *  : CRCPARCTL1.dfi_t_phy_rdlat < 64 - 1:2 Frequency mode ANDAND DFITMG0.d
+    * fi_rddata_use_sdr == 0 : DFITMG0.dfi_t_rddata_en + CRCPARCTL1.dfi_t_phy_
+    * rdlat < 'd114 Unit: DFI Clocks
+    *  PSU_DDRC_CRCPARCTL1_DFI_T_PHY_RDLAT                         0x10
+
+    * After a Parity or CRC error is flagged on dfi_alert_n signal, the softwa
+    * re has an option to read the mode registers in the DRAM before the hardw
+    * are begins the retry process - 1: Wait for software to read/write the mo
+    * de registers before hardware begins the retry. After software is done wi
+    * th its operations, it will clear the alert interrupt register bit - 0: H
+    * ardware can begin the retry right away after the dfi_alert_n pulse goes
+    * away. The value on this register is valid only when retry is enabled (PA
+    * RCTRL.crc_parity_retry_enable = 1) If this register is set to 1 and if t
+    * he software doesn't clear the interrupt register after handling the pari
+    * ty/CRC error, then the hardware will not begin the retry process and the
+    *  system will hang. In the case of Parity/CRC error, there are two possib
+    * ilities when the software doesn't reset MR5[4] to 0. - (i) If 'Persisten
+    * t parity' mode register bit is NOT set: the commands sent during retry a
+    * nd normal operation are executed without parity checking. The value in t
+    * he Parity error log register MPR Page 1 is valid. - (ii) If 'Persistent
+    * parity' mode register bit is SET: Parity checking is done for commands s
+    * ent during retry and normal operation. If multiple errors occur before M
+    * R5[4] is cleared, the error log in MPR Page 1 should be treated as 'Don'
+    * t care'.
+    *  PSU_DDRC_CRCPARCTL1_ALERT_WAIT_FOR_SW                       0x1
+
+    * - 1: Enable command retry mechanism in case of C/A Parity or CRC error -
+    *  0: Disable command retry mechanism when C/A Parity or CRC features are
+    * enabled. Note that retry functionality is not supported if burst chop is
+    *  enabled (MSTR.burstchop = 1) and/or disable auto-refresh is enabled (RF
+    * SHCTL3.dis_auto_refresh = 1)
+    *  PSU_DDRC_CRCPARCTL1_CRC_PARITY_RETRY_ENABLE                 0x0
+
+    * CRC Calculation setting register - 1: CRC includes DM signal - 0: CRC no
+    * t includes DM signal Present only in designs configured to support DDR4.
+    *  PSU_DDRC_CRCPARCTL1_CRC_INC_DM                              0x0
+
+    * CRC enable Register - 1: Enable generation of CRC - 0: Disable generatio
+    * n of CRC The setting of this register should match the CRC mode register
+    *  setting in the DRAM.
+    *  PSU_DDRC_CRCPARCTL1_CRC_ENABLE                              0x0
+
+    * C/A Parity enable register - 1: Enable generation of C/A parity and dete
+    * ction of C/A parity error - 0: Disable generation of C/A parity and disa
+    * ble detection of C/A parity error If RCD's parity error detection or SDR
+    * AM's parity detection is enabled, this register should be 1.
+    *  PSU_DDRC_CRCPARCTL1_PARITY_ENABLE                           0x0
+
+    * CRC Parity Control Register1
+    * (OFFSET, MASK, VALUE)      (0XFD0700C4, 0x3F000391U ,0x10000200U)
+    */
+	PSU_Mask_Write(DDRC_CRCPARCTL1_OFFSET, 0x3F000391U, 0x10000200U);
+/*##################################################################### */
+
+    /*
+    * Register : CRCPARCTL2 @ 0XFD0700C8
+
+    * Value from the DRAM spec indicating the maximum width of the dfi_alert_n
+    *  pulse when a parity error occurs. Recommended values: - tPAR_ALERT_PW.M
+    * AX For configurations with MEMC_FREQ_RATIO=2, program this to tPAR_ALERT
+    * _PW.MAX/2 and round up to next integer value. Values of 0, 1 and 2 are i
+    * llegal. This value must be greater than CRCPARCTL2.t_crc_alert_pw_max.
+    *  PSU_DDRC_CRCPARCTL2_T_PAR_ALERT_PW_MAX                      0x40
+
+    * Value from the DRAM spec indicating the maximum width of the dfi_alert_n
+    *  pulse when a CRC error occurs. Recommended values: - tCRC_ALERT_PW.MAX
+    * For configurations with MEMC_FREQ_RATIO=2, program this to tCRC_ALERT_PW
+    * .MAX/2 and round up to next integer value. Values of 0, 1 and 2 are ille
+    * gal. This value must be less than CRCPARCTL2.t_par_alert_pw_max.
+    *  PSU_DDRC_CRCPARCTL2_T_CRC_ALERT_PW_MAX                      0x5
+
+    * Indicates the maximum duration in number of DRAM clock cycles for which
+    * a command should be held in the Command Retry FIFO before it is popped o
+    * ut. Every location in the Command Retry FIFO has an associated down coun
+    * ting timer that will use this register as the start value. The down coun
+    * ting starts when a command is loaded into the FIFO. The timer counts dow
+    * n every 4 DRAM cycles. When the counter reaches zero, the entry is poppe
+    * d from the FIFO. All the counters are frozen, if a C/A Parity or CRC err
+    * or occurs before the counter reaches zero. The counter is reset to 0, af
+    * ter all the commands in the FIFO are retried. Recommended(minimum) value
+    * s: - Only C/A Parity is enabled. RoundUp((PHY Command Latency(DRAM CLK)
+    * + CAL + RDIMM delay + tPAR_ALERT_ON.max + tPAR_UNKNOWN + PHY Alert Laten
+    * cy(DRAM CLK) + board delay) / 4) + 2 - Both C/A Parity and CRC is enable
+    * d/ Only CRC is enabled. RoundUp((PHY Command Latency(DRAM CLK) + CAL + R
+    * DIMM delay + WL + 5(BL10)+ tCRC_ALERT.max + PHY Alert Latency(DRAM CLK)
+    * + board delay) / 4) + 2 Note 1: All value (e.g. tPAR_ALERT_ON) should be
+    *  in terms of DRAM Clock and round up Note 2: Board delay(Command/Alert_n
+    * ) should be considered. Note 3: Use the worst case(longer) value for PHY
+    *  Latencies/Board delay Note 4: The Recommended values are minimum value
+    * to be set. For mode detail, See 'Calculation of FIFO Depth' section. Max
+    *  value can be set to this register is defined below: - MEMC_BURST_LENGTH
+    *  == 16 Full bus Mode (CRC=OFF) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-2
+    *  Full bus Mode (CRC=ON) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-3 Half b
+    * us Mode (CRC=OFF) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-4 Half bus Mod
+    * e (CRC=ON) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-6 Quarter bus Mode (C
+    * RC=OFF) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-8 Quarter bus Mode (CRC=
+    * ON) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-12 - MEMC_BURST_LENGTH != 16
+    *  Full bus Mode (CRC=OFF) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-1 Full
+    * bus Mode (CRC=ON) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-2 Half bus Mod
+    * e (CRC=OFF) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-2 Half bus Mode (CRC
+    * =ON) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-3 Quarter bus Mode (CRC=OFF
+    * ) Max value = UMCTL2_RETRY_CMD_FIFO_DEPTH-4 Quarter bus Mode (CRC=ON) Ma
+    * x value = UMCTL2_RETRY_CMD_FIFO_DEPTH-6 Values of 0, 1 and 2 are illegal
+    * .
+    *  PSU_DDRC_CRCPARCTL2_RETRY_FIFO_MAX_HOLD_TIMER_X4            0x1f
+
+    * CRC Parity Control Register2
+    * (OFFSET, MASK, VALUE)      (0XFD0700C8, 0x01FF1F3FU ,0x0040051FU)
+    */
+	PSU_Mask_Write(DDRC_CRCPARCTL2_OFFSET, 0x01FF1F3FU, 0x0040051FU);
+/*##################################################################### */
+
+    /*
+    * Register : INIT0 @ 0XFD0700D0
+
+    * If lower bit is enabled the SDRAM initialization routine is skipped. The
+    *  upper bit decides what state the controller starts up in when reset is
+    * removed - 00 - SDRAM Intialization routine is run after power-up - 01 -
+    * SDRAM Intialization routine is skipped after power-up. Controller starts
+    *  up in Normal Mode - 11 - SDRAM Intialization routine is skipped after p
+    * ower-up. Controller starts up in Self-refresh Mode - 10 - SDRAM Intializ
+    * ation routine is run after power-up. Note: The only 2'b00 is supported f
+    * or LPDDR4 in this version of the uMCTL2.
+    *  PSU_DDRC_INIT0_SKIP_DRAM_INIT                               0x0
+
+    * Cycles to wait after driving CKE high to start the SDRAM initialization
+    * sequence. Unit: 1024 clocks. DDR2 typically requires a 400 ns delay, req
+    * uiring this value to be programmed to 2 at all clock speeds. LPDDR2/LPDD
+    * R3 typically requires this to be programmed for a delay of 200 us. LPDDR
+    * 4 typically requires this to be programmed for a delay of 2 us. For conf
+    * igurations with MEMC_FREQ_RATIO=2, program this to JEDEC spec value divi
+    * ded by 2, and round it up to next integer value.
+    *  PSU_DDRC_INIT0_POST_CKE_X1024                               0x2
+
+    * Cycles to wait after reset before driving CKE high to start the SDRAM in
+    * itialization sequence. Unit: 1024 clock cycles. DDR2 specifications typi
+    * cally require this to be programmed for a delay of >= 200 us. LPDDR2/LPD
+    * DR3: tINIT1 of 100 ns (min) LPDDR4: tINIT3 of 2 ms (min) For configurati
+    * ons with MEMC_FREQ_RATIO=2, program this to JEDEC spec value divided by
+    * 2, and round it up to next integer value.
+    *  PSU_DDRC_INIT0_PRE_CKE_X1024                                0x106
+
+    * SDRAM Initialization Register 0
+    * (OFFSET, MASK, VALUE)      (0XFD0700D0, 0xC3FF0FFFU ,0x00020106U)
+    */
+	PSU_Mask_Write(DDRC_INIT0_OFFSET, 0xC3FF0FFFU, 0x00020106U);
+/*##################################################################### */
+
+    /*
+    * Register : INIT1 @ 0XFD0700D4
+
+    * Number of cycles to assert SDRAM reset signal during init sequence. This
+    *  is only present for designs supporting DDR3, DDR4 or LPDDR4 devices. Fo
+    * r use with a DDR PHY, this should be set to a minimum of 1
+    *  PSU_DDRC_INIT1_DRAM_RSTN_X1024                              0x2
+
+    * Cycles to wait after completing the SDRAM initialization sequence before
+    *  starting the dynamic scheduler. Unit: Counts of a global timer that pul
+    * ses every 32 clock cycles. There is no known specific requirement for th
+    * is; it may be set to zero.
+    *  PSU_DDRC_INIT1_FINAL_WAIT_X32                               0x0
+
+    * Wait period before driving the OCD complete command to SDRAM. Unit: Coun
+    * ts of a global timer that pulses every 32 clock cycles. There is no know
+    * n specific requirement for this; it may be set to zero.
+    *  PSU_DDRC_INIT1_PRE_OCD_X32                                  0x0
+
+    * SDRAM Initialization Register 1
+    * (OFFSET, MASK, VALUE)      (0XFD0700D4, 0x01FF7F0FU ,0x00020000U)
+    */
+	PSU_Mask_Write(DDRC_INIT1_OFFSET, 0x01FF7F0FU, 0x00020000U);
+/*##################################################################### */
+
+    /*
+    * Register : INIT2 @ 0XFD0700D8
+
+    * Idle time after the reset command, tINIT4. Present only in designs confi
+    * gured to support LPDDR2. Unit: 32 clock cycles.
+    *  PSU_DDRC_INIT2_IDLE_AFTER_RESET_X32                         0x23
+
+    * Time to wait after the first CKE high, tINIT2. Present only in designs c
+    * onfigured to support LPDDR2/LPDDR3. Unit: 1 clock cycle. LPDDR2/LPDDR3 t
+    * ypically requires 5 x tCK delay.
+    *  PSU_DDRC_INIT2_MIN_STABLE_CLOCK_X1                          0x5
+
+    * SDRAM Initialization Register 2
+    * (OFFSET, MASK, VALUE)      (0XFD0700D8, 0x0000FF0FU ,0x00002305U)
+    */
+	PSU_Mask_Write(DDRC_INIT2_OFFSET, 0x0000FF0FU, 0x00002305U);
+/*##################################################################### */
+
+    /*
+    * Register : INIT3 @ 0XFD0700DC
+
+    * DDR2: Value to write to MR register. Bit 8 is for DLL and the setting he
+    * re is ignored. The uMCTL2 sets this bit appropriately. DDR3/DDR4: Value
+    * loaded into MR0 register. mDDR: Value to write to MR register. LPDDR2/LP
+    * DDR3/LPDDR4 - Value to write to MR1 register
+    *  PSU_DDRC_INIT3_MR                                           0x730
+
+    * DDR2: Value to write to EMR register. Bits 9:7 are for OCD and the setti
+    * ng in this register is ignored. The uMCTL2 sets those bits appropriately
+    * . DDR3/DDR4: Value to write to MR1 register Set bit 7 to 0. If PHY-evalu
+    * ation mode training is enabled, this bit is set appropriately by the uMC
+    * TL2 during write leveling. mDDR: Value to write to EMR register. LPDDR2/
+    * LPDDR3/LPDDR4 - Value to write to MR2 register
+    *  PSU_DDRC_INIT3_EMR                                          0x301
+
+    * SDRAM Initialization Register 3
+    * (OFFSET, MASK, VALUE)      (0XFD0700DC, 0xFFFFFFFFU ,0x07300301U)
+    */
+	PSU_Mask_Write(DDRC_INIT3_OFFSET, 0xFFFFFFFFU, 0x07300301U);
+/*##################################################################### */
+
+    /*
+    * Register : INIT4 @ 0XFD0700E0
+
+    * DDR2: Value to write to EMR2 register. DDR3/DDR4: Value to write to MR2
+    * register LPDDR2/LPDDR3/LPDDR4: Value to write to MR3 register mDDR: Unus
+    * ed
+    *  PSU_DDRC_INIT4_EMR2                                         0x20
+
+    * DDR2: Value to write to EMR3 register. DDR3/DDR4: Value to write to MR3
+    * register mDDR/LPDDR2/LPDDR3: Unused LPDDR4: Value to write to MR13 regis
+    * ter
+    *  PSU_DDRC_INIT4_EMR3                                         0x200
+
+    * SDRAM Initialization Register 4
+    * (OFFSET, MASK, VALUE)      (0XFD0700E0, 0xFFFFFFFFU ,0x00200200U)
+    */
+	PSU_Mask_Write(DDRC_INIT4_OFFSET, 0xFFFFFFFFU, 0x00200200U);
+/*##################################################################### */
+
+    /*
+    * Register : INIT5 @ 0XFD0700E4
+
+    * ZQ initial calibration, tZQINIT. Present only in designs configured to s
+    * upport DDR3 or DDR4 or LPDDR2/LPDDR3. Unit: 32 clock cycles. DDR3 typica
+    * lly requires 512 clocks. DDR4 requires 1024 clocks. LPDDR2/LPDDR3 requir
+    * es 1 us.
+    *  PSU_DDRC_INIT5_DEV_ZQINIT_X32                               0x21
+
+    * Maximum duration of the auto initialization, tINIT5. Present only in des
+    * igns configured to support LPDDR2/LPDDR3. LPDDR2/LPDDR3 typically requir
+    * es 10 us.
+    *  PSU_DDRC_INIT5_MAX_AUTO_INIT_X1024                          0x4
+
+    * SDRAM Initialization Register 5
+    * (OFFSET, MASK, VALUE)      (0XFD0700E4, 0x00FF03FFU ,0x00210004U)
+    */
+	PSU_Mask_Write(DDRC_INIT5_OFFSET, 0x00FF03FFU, 0x00210004U);
+/*##################################################################### */
+
+    /*
+    * Register : INIT6 @ 0XFD0700E8
+
+    * DDR4- Value to be loaded into SDRAM MR4 registers. Used in DDR4 designs
+    * only.
+    *  PSU_DDRC_INIT6_MR4                                          0x0
+
+    * DDR4- Value to be loaded into SDRAM MR5 registers. Used in DDR4 designs
+    * only.
+    *  PSU_DDRC_INIT6_MR5                                          0x6c0
+
+    * SDRAM Initialization Register 6
+    * (OFFSET, MASK, VALUE)      (0XFD0700E8, 0xFFFFFFFFU ,0x000006C0U)
+    */
+	PSU_Mask_Write(DDRC_INIT6_OFFSET, 0xFFFFFFFFU, 0x000006C0U);
+/*##################################################################### */
+
+    /*
+    * Register : INIT7 @ 0XFD0700EC
+
+    * DDR4- Value to be loaded into SDRAM MR6 registers. Used in DDR4 designs
+    * only.
+    *  PSU_DDRC_INIT7_MR6                                          0x819
+
+    * SDRAM Initialization Register 7
+    * (OFFSET, MASK, VALUE)      (0XFD0700EC, 0xFFFF0000U ,0x08190000U)
+    */
+	PSU_Mask_Write(DDRC_INIT7_OFFSET, 0xFFFF0000U, 0x08190000U);
+/*##################################################################### */
+
+    /*
+    * Register : DIMMCTL @ 0XFD0700F0
+
+    * Disabling Address Mirroring for BG bits. When this is set to 1, BG0 and
+    * BG1 are NOT swapped even if Address Mirroring is enabled. This will be r
+    * equired for DDR4 DIMMs with x16 devices. - 1 - BG0 and BG1 are NOT swapp
+    * ed. - 0 - BG0 and BG1 are swapped if address mirroring is enabled.
+    *  PSU_DDRC_DIMMCTL_DIMM_DIS_BG_MIRRORING                      0x0
+
+    * Enable for BG1 bit of MRS command. BG1 bit of the mode register address
+    * is specified as RFU (Reserved for Future Use) and must be programmed to
+    * 0 during MRS. In case where DRAMs which do not have BG1 are attached and
+    *  both the CA parity and the Output Inversion are enabled, this must be s
+    * et to 0, so that the calculation of CA parity will not include BG1 bit.
+    * Note: This has no effect on the address of any other memory accesses, or
+    *  of software-driven mode register accesses. If address mirroring is enab
+    * led, this is applied to BG1 of even ranks and BG0 of odd ranks. - 1 - En
+    * abled - 0 - Disabled
+    *  PSU_DDRC_DIMMCTL_MRS_BG1_EN                                 0x1
+
+    * Enable for A17 bit of MRS command. A17 bit of the mode register address
+    * is specified as RFU (Reserved for Future Use) and must be programmed to
+    * 0 during MRS. In case where DRAMs which do not have A17 are attached and
+    *  the Output Inversion are enabled, this must be set to 0, so that the ca
+    * lculation of CA parity will not include A17 bit. Note: This has no effec
+    * t on the address of any other memory accesses, or of software-driven mod
+    * e register accesses. - 1 - Enabled - 0 - Disabled
+    *  PSU_DDRC_DIMMCTL_MRS_A17_EN                                 0x0
+
+    * Output Inversion Enable (for DDR4 RDIMM implementations only). DDR4 RDIM
+    * M implements the Output Inversion feature by default, which means that t
+    * he following address, bank address and bank group bits of B-side DRAMs a
+    * re inverted: A3-A9, A11, A13, A17, BA0-BA1, BG0-BG1. Setting this bit en
+    * sures that, for mode register accesses generated by the uMCTL2 during th
+    * e automatic initialization routine and enabling of a particular DDR4 fea
+    * ture, separate A-side and B-side mode register accesses are generated. F
+    * or B-side mode register accesses, these bits are inverted within the uMC
+    * TL2 to compensate for this RDIMM inversion. Note: This has no effect on
+    * the address of any other memory accesses, or of software-driven mode reg
+    * ister accesses. - 1 - Implement output inversion for B-side DRAMs. - 0 -
+    *  Do not implement output inversion for B-side DRAMs.
+    *  PSU_DDRC_DIMMCTL_DIMM_OUTPUT_INV_EN                         0x0
+
+    * Address Mirroring Enable (for multi-rank UDIMM implementations and multi
+    * -rank DDR4 RDIMM implementations). Some UDIMMs and DDR4 RDIMMs implement
+    *  address mirroring for odd ranks, which means that the following address
+    * , bank address and bank group bits are swapped: (A3, A4), (A5, A6), (A7,
+    *  A8), (BA0, BA1) and also (A11, A13), (BG0, BG1) for the DDR4. Setting t
+    * his bit ensures that, for mode register accesses during the automatic in
+    * itialization routine, these bits are swapped within the uMCTL2 to compen
+    * sate for this UDIMM/RDIMM swapping. In addition to the automatic initial
+    * ization routine, in case of DDR4 UDIMM/RDIMM, they are swapped during th
+    * e automatic MRS access to enable/disable of a particular DDR4 feature. N
+    * ote: This has no effect on the address of any other memory accesses, or
+    * of software-driven mode register accesses. This is not supported for mDD
+    * R, LPDDR2, LPDDR3 or LPDDR4 SDRAMs. Note: In case of x16 DDR4 DIMMs, BG1
+    *  output of MRS for the odd ranks is same as BG0 because BG1 is invalid,
+    * hence dimm_dis_bg_mirroring register must be set to 1. - 1 - For odd ran
+    * ks, implement address mirroring for MRS commands to during initializatio
+    * n and for any automatic DDR4 MRS commands (to be used if UDIMM/RDIMM imp
+    * lements address mirroring) - 0 - Do not implement address mirroring
+    *  PSU_DDRC_DIMMCTL_DIMM_ADDR_MIRR_EN                          0x0
+
+    * Staggering enable for multi-rank accesses (for multi-rank UDIMM and RDIM
+    * M implementations only). This is not supported for mDDR, LPDDR2, LPDDR3
+    * or LPDDR4 SDRAMs. Note: Even if this bit is set it does not take care of
+    *  software driven MR commands (via MRCTRL0/MRCTRL1), where software is re
+    * sponsible to send them to seperate ranks as appropriate. - 1 - (DDR4) Se
+    * nd MRS commands to each ranks seperately - 1 - (non-DDR4) Send all comma
+    * nds to even and odd ranks seperately - 0 - Do not stagger accesses
+    *  PSU_DDRC_DIMMCTL_DIMM_STAGGER_CS_EN                         0x0
+
+    * DIMM Control Register
+    * (OFFSET, MASK, VALUE)      (0XFD0700F0, 0x0000003FU ,0x00000010U)
+    */
+	PSU_Mask_Write(DDRC_DIMMCTL_OFFSET, 0x0000003FU, 0x00000010U);
+/*##################################################################### */
+
+    /*
+    * Register : RANKCTL @ 0XFD0700F4
+
+    * Only present for multi-rank configurations. Indicates the number of cloc
+    * ks of gap in data responses when performing consecutive writes to differ
+    * ent ranks. This is used to switch the delays in the PHY to match the ran
+    * k requirements. This value should consider both PHY requirement and ODT
+    * requirement. - PHY requirement: tphy_wrcsgap + 1 (see PHY databook for v
+    * alue of tphy_wrcsgap) If CRC feature is enabled, should be increased by
+    * 1. If write preamble is set to 2tCK(DDR4/LPDDR4 only), should be increas
+    * ed by 1. If write postamble is set to 1.5tCK(LPDDR4 only), should be inc
+    * reased by 1. - ODT requirement: The value programmed in this register ta
+    * kes care of the ODT switch off timing requirement when switching ranks d
+    * uring writes. For LPDDR4, the requirement is ODTLoff - ODTLon - BL/2 + 1
+    *  For configurations with MEMC_FREQ_RATIO=1, program this to the larger o
+    * f PHY requirement or ODT requirement. For configurations with MEMC_FREQ_
+    * RATIO=2, program this to the larger value divided by two and round it up
+    *  to the next integer.
+    *  PSU_DDRC_RANKCTL_DIFF_RANK_WR_GAP                           0x6
+
+    * Only present for multi-rank configurations. Indicates the number of cloc
+    * ks of gap in data responses when performing consecutive reads to differe
+    * nt ranks. This is used to switch the delays in the PHY to match the rank
+    *  requirements. This value should consider both PHY requirement and ODT r
+    * equirement. - PHY requirement: tphy_rdcsgap + 1 (see PHY databook for va
+    * lue of tphy_rdcsgap) If read preamble is set to 2tCK(DDR4/LPDDR4 only),
+    * should be increased by 1. If read postamble is set to 1.5tCK(LPDDR4 only
+    * ), should be increased by 1. - ODT requirement: The value programmed in
+    * this register takes care of the ODT switch off timing requirement when s
+    * witching ranks during reads. For configurations with MEMC_FREQ_RATIO=1,
+    * program this to the larger of PHY requirement or ODT requirement. For co
+    * nfigurations with MEMC_FREQ_RATIO=2, program this to the larger value di
+    * vided by two and round it up to the next integer.
+    *  PSU_DDRC_RANKCTL_DIFF_RANK_RD_GAP                           0x6
+
+    * Only present for multi-rank configurations. Background: Reads to the sam
+    * e rank can be performed back-to-back. Reads to different ranks require a
+    * dditional gap dictated by the register RANKCTL.diff_rank_rd_gap. This is
+    *  to avoid possible data bus contention as well as to give PHY enough tim
+    * e to switch the delay when changing ranks. The uMCTL2 arbitrates for bus
+    *  access on a cycle-by-cycle basis; therefore after a read is scheduled,
+    * there are few clock cycles (determined by the value on RANKCTL.diff_rank
+    * _rd_gap register) in which only reads from the same rank are eligible to
+    *  be scheduled. This prevents reads from other ranks from having fair acc
+    * ess to the data bus. This parameter represents the maximum number of rea
+    * ds that can be scheduled consecutively to the same rank. After this numb
+    * er is reached, a delay equal to RANKCTL.diff_rank_rd_gap is inserted by
+    * the scheduler to allow all ranks a fair opportunity to be scheduled. Hig
+    * her numbers increase bandwidth utilization, lower numbers increase fairn
+    * ess. This feature can be DISABLED by setting this register to 0. When se
+    * t to 0, the Controller will stay on the same rank as long as commands ar
+    * e available for it. Minimum programmable value is 0 (feature disabled) a
+    * nd maximum programmable value is 0xF. FOR PERFORMANCE ONLY.
+    *  PSU_DDRC_RANKCTL_MAX_RANK_RD                                0xf
+
+    * Rank Control Register
+    * (OFFSET, MASK, VALUE)      (0XFD0700F4, 0x00000FFFU ,0x0000066FU)
+    */
+	PSU_Mask_Write(DDRC_RANKCTL_OFFSET, 0x00000FFFU, 0x0000066FU);
+/*##################################################################### */
+
+    /*
+    * Register : DRAMTMG0 @ 0XFD070100
+
+    * Minimum time between write and precharge to same bank. Unit: Clocks Spec
+    * ifications: WL + BL/2 + tWR = approximately 8 cycles + 15 ns = 14 clocks
     *  @400MHz and less for lower frequencies where: - WL = write latency - BL
     *  = burst length. This must match the value programmed in the BL bit of t
     * he mode register to the SDRAM. BST (burst terminate) is not supported at
@@ -11476,9 +12283,13 @@ unsigned long psu_ddr_init_data(void)
 
 
 	return 1;
+#endif /* PSU_INIT_TABLE */
 }
 unsigned long psu_ddr_qos_init_data(void)
 {
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_ddr_qos_init_data_table);
+#else
     /*
     * AFI INTERCONNECT QOS CONFIGURATION
     */
@@ -11666,9 +12477,13 @@ unsigned long psu_ddr_qos_init_data(void)
 
 
 	return 1;
+#endif /* PSU_INIT_TABLE */
 }
 unsigned long psu_mio_init_data(void)
 {
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_mio_init_data_table);
+#else
     /*
     * MIO PROGRAMMING
     */
@@ -15909,9 +16724,13 @@ unsigned long psu_mio_init_data(void)
 
 
 	return 1;
+#endif /* PSU_INIT_TABLE */
 }
 unsigned long psu_peripherals_pre_init_data(void)
 {
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_peripherals_pre_init_data_table);
+#else
     /*
     * SYSMON CLOCK PRESET TO IOPLL AT 1500 MHZ FROM PBR TO MAKE AMS CLOCK UNDE
     * R RANGE
@@ -15959,9 +16778,13 @@ unsigned long psu_peripherals_pre_init_data(void)
 
 
     return 1;
+#endif /* PSU_INIT_TABLE */
 }
 unsigned long psu_peripherals_init_data(void)
 {
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_peripherals_init_data_table);
+#else
     /*
     * COHERENCY
     */
@@ -16986,6 +17809,7 @@ unsigned long psu_peripherals_init_data(void)
 
 
 	return 1;
+#endif /* PSU_INIT_TABLE */
 }
 unsigned long psu_post_config_data(void)
 {
@@ -17854,2598 +18678,4018 @@ unsigned long psu_lpd_xppu_data(void)
     * FFF
     */
     /*
-    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
-    * FFF
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
+    * FFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_15, START ADDRESS: FFFD0000, END ADDRESS: FFFF
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_15, START ADDRESS: FFFD0000, END ADDRESS: FFFF
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: LPD_UNUSED_15, START ADDRESS: FFFD0000, END ADDRESS: FFFF
+    * FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    */
+    /*
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
-    * FFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
-    * FFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
-    * FFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
-    * FFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: LPD_UNUSED_9, START ADDRESS: FFEE0000, END ADDRESS: FFFBF
-    * FFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: LPD_UNUSED_15, START ADDRESS: FFFD0000, END ADDRESS: FFFF
-    * FFFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: LPD_UNUSED_15, START ADDRESS: FFFD0000, END ADDRESS: FFFF
-    * FFFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: LPD_UNUSED_15, START ADDRESS: FFFD0000, END ADDRESS: FFFF
-    * FFFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_1, START ADDRESS: FF310000, END ADDRESS: FF31FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_2, START ADDRESS: FF320000, END ADDRESS: FF32FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_0, START ADDRESS: FF300000, END ADDRESS: FF30FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: IOU_GPV, START ADDRESS: FE000000, END ADDRESS: FE0FFFFF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: LPD_GPV, START ADDRESS: FE100000, END ADDRESS: FE1FFFFF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: USB3_0_XHCI, START ADDRESS: FE200000, END ADDRESS: FE2FFF
+    * FF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: USB3_1_XHCI, START ADDRESS: FE300000, END ADDRESS: FE3FFF
+    * FF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: LPD_UNUSED_13, START ADDRESS: FE400000, END ADDRESS: FE7F
+    * FFFF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: LPD_UNUSED_13, START ADDRESS: FE400000, END ADDRESS: FE7F
+    * FFFF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: LPD_UNUSED_13, START ADDRESS: FE400000, END ADDRESS: FE7F
+    * FFFF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: LPD_UNUSED_13, START ADDRESS: FE400000, END ADDRESS: FE7F
+    * FFFF
     */
     /*
-    * APERTURE NAME: IPI_7, START ADDRESS: FF340000, END ADDRESS: FF34FFFF
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
     */
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
     */
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
     */
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
     */
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
     */
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
     */
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
     */
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
     */
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * APERTURE NAME: QSPI_LINEAR_ADDRESS, START ADDRESS: C0000000, END ADDRESS
+    * : DFFFFFFF
     */
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * XPPU CONTROL
     */
+
+	return 1;
+}
+unsigned long psu_ddr_xmpu0_data(void)
+{
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * DDR XMPU0
     */
+
+	return 1;
+}
+unsigned long psu_ddr_xmpu1_data(void)
+{
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * DDR XMPU1
     */
+
+	return 1;
+}
+unsigned long psu_ddr_xmpu2_data(void)
+{
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * DDR XMPU2
     */
+
+	return 1;
+}
+unsigned long psu_ddr_xmpu3_data(void)
+{
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * DDR XMPU3
     */
+
+	return 1;
+}
+unsigned long psu_ddr_xmpu4_data(void)
+{
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * DDR XMPU4
     */
+
+	return 1;
+}
+unsigned long psu_ddr_xmpu5_data(void)
+{
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * DDR XMPU5
     */
+
+	return 1;
+}
+unsigned long psu_ocm_xmpu_data(void)
+{
     /*
-    * APERTURE NAME: IPI_8, START ADDRESS: FF350000, END ADDRESS: FF35FFFF
+    * OCM XMPU
     */
+
+	return 1;
+}
+unsigned long psu_fpd_xmpu_data(void)
+{
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * FPD XMPU
     */
+
+	return 1;
+}
+unsigned long psu_protection_lock_data(void)
+{
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * LOCKING PROTECTION MODULE
     */
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * XPPU LOCK
     */
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * APERTURE NAME: LPD_XPPU, START ADDRESS: FF980000, END ADDRESS: FF99FFFF
     */
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * XMPU LOCK
     */
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * LOCK OCM XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
     */
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * LOCK FPD XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
     */
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
     */
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
     */
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
     */
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
     */
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
     */
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
     */
+
+	return 1;
+}
+unsigned long psu_apply_master_tz(void)
+{
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_apply_master_tz_table);
+#else
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * RPU
     */
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * DP TZ
     */
     /*
-    * APERTURE NAME: IPI_9, START ADDRESS: FF360000, END ADDRESS: FF36FFFF
+    * Register : slcr_dpdma @ 0XFD690040
+
+    * TrustZone classification for DisplayPort DMA
+    *  PSU_FPD_SLCR_SECURE_SLCR_DPDMA_TZ                           1
+
+    * DPDMA TrustZone Settings
+    * (OFFSET, MASK, VALUE)      (0XFD690040, 0x00000001U ,0x00000001U)
     */
+	PSU_Mask_Write(FPD_SLCR_SECURE_SLCR_DPDMA_OFFSET,
+		0x00000001U, 0x00000001U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * SATA TZ
     */
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * PCIE TZ
     */
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * Register : slcr_pcie @ 0XFD690030
+
+    * TrustZone classification for DMA Channel 0
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_DMA_0                      1
+
+    * TrustZone classification for DMA Channel 1
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_DMA_1                      1
+
+    * TrustZone classification for DMA Channel 2
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_DMA_2                      1
+
+    * TrustZone classification for DMA Channel 3
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_DMA_3                      1
+
+    * TrustZone classification for Ingress Address Translation 0
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_0                  1
+
+    * TrustZone classification for Ingress Address Translation 1
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_1                  1
+
+    * TrustZone classification for Ingress Address Translation 2
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_2                  1
+
+    * TrustZone classification for Ingress Address Translation 3
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_3                  1
+
+    * TrustZone classification for Ingress Address Translation 4
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_4                  1
+
+    * TrustZone classification for Ingress Address Translation 5
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_5                  1
+
+    * TrustZone classification for Ingress Address Translation 6
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_6                  1
+
+    * TrustZone classification for Ingress Address Translation 7
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_7                  1
+
+    * TrustZone classification for Egress Address Translation 0
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_0                   1
+
+    * TrustZone classification for Egress Address Translation 1
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_1                   1
+
+    * TrustZone classification for Egress Address Translation 2
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_2                   1
+
+    * TrustZone classification for Egress Address Translation 3
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_3                   1
+
+    * TrustZone classification for Egress Address Translation 4
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_4                   1
+
+    * TrustZone classification for Egress Address Translation 5
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_5                   1
+
+    * TrustZone classification for Egress Address Translation 6
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_6                   1
+
+    * TrustZone classification for Egress Address Translation 7
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_7                   1
+
+    * TrustZone classification for DMA Registers
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_DMA_REGS                   1
+
+    * TrustZone classification for MSIx Table
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_MSIX_TABLE                 1
+
+    * TrustZone classification for MSIx PBA
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_MSIX_PBA                   1
+
+    * TrustZone classification for ECAM
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_ECAM                       1
+
+    * TrustZone classification for Bridge Common Registers
+    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_BRIDGE_REGS                1
+
+    * PCIe TrustZone settings. This register may only be modified during bootu
+    * p (while PCIe block is disabled)
+    * (OFFSET, MASK, VALUE)      (0XFD690030, 0x01FFFFFFU ,0x01FFFFFFU)
     */
+	PSU_Mask_Write(FPD_SLCR_SECURE_SLCR_PCIE_OFFSET,
+		0x01FFFFFFU, 0x01FFFFFFU);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * USB TZ
     */
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * Register : slcr_usb @ 0XFF4B0034
+
+    * TrustZone Classification for USB3_0
+    *  PSU_LPD_SLCR_SECURE_SLCR_USB_TZ_USB3_0                      1
+
+    * TrustZone Classification for USB3_1
+    *  PSU_LPD_SLCR_SECURE_SLCR_USB_TZ_USB3_1                      1
+
+    * USB3 TrustZone settings
+    * (OFFSET, MASK, VALUE)      (0XFF4B0034, 0x00000003U ,0x00000003U)
     */
+	PSU_Mask_Write(LPD_SLCR_SECURE_SLCR_USB_OFFSET,
+		0x00000003U, 0x00000003U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * SD TZ
     */
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * Register : IOU_AXI_RPRTCN @ 0XFF240004
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_RPRTCN_SD0_AXI_ARPROT           2
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_RPRTCN_SD1_AXI_ARPROT           2
+
+    * AXI read protection type selection
+    * (OFFSET, MASK, VALUE)      (0XFF240004, 0x003F0000U ,0x00120000U)
     */
+	PSU_Mask_Write(IOU_SECURE_SLCR_IOU_AXI_RPRTCN_OFFSET,
+		0x003F0000U, 0x00120000U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * Register : IOU_AXI_WPRTCN @ 0XFF240000
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_SD0_AXI_AWPROT           2
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_SD1_AXI_AWPROT           2
+
+    * AXI write protection type selection
+    * (OFFSET, MASK, VALUE)      (0XFF240000, 0x003F0000U ,0x00120000U)
     */
+	PSU_Mask_Write(IOU_SECURE_SLCR_IOU_AXI_WPRTCN_OFFSET,
+		0x003F0000U, 0x00120000U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * GEM TZ
     */
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * Register : IOU_AXI_RPRTCN @ 0XFF240004
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_RPRTCN_GEM0_AXI_ARPROT          2
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_RPRTCN_GEM1_AXI_ARPROT          2
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_RPRTCN_GEM2_AXI_ARPROT          2
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_RPRTCN_GEM3_AXI_ARPROT          2
+
+    * AXI read protection type selection
+    * (OFFSET, MASK, VALUE)      (0XFF240004, 0x00000FFFU ,0x00000492U)
     */
+	PSU_Mask_Write(IOU_SECURE_SLCR_IOU_AXI_RPRTCN_OFFSET,
+		0x00000FFFU, 0x00000492U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * Register : IOU_AXI_WPRTCN @ 0XFF240000
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_GEM0_AXI_AWPROT          2
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_GEM1_AXI_AWPROT          2
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_GEM2_AXI_AWPROT          2
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_GEM3_AXI_AWPROT          2
+
+    * AXI write protection type selection
+    * (OFFSET, MASK, VALUE)      (0XFF240000, 0x00000FFFU ,0x00000492U)
     */
+	PSU_Mask_Write(IOU_SECURE_SLCR_IOU_AXI_WPRTCN_OFFSET,
+		0x00000FFFU, 0x00000492U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * QSPI TZ
     */
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * Register : IOU_AXI_WPRTCN @ 0XFF240000
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_QSPI_AXI_AWPROT          2
+
+    * AXI write protection type selection
+    * (OFFSET, MASK, VALUE)      (0XFF240000, 0x0E000000U ,0x04000000U)
     */
+	PSU_Mask_Write(IOU_SECURE_SLCR_IOU_AXI_WPRTCN_OFFSET,
+		0x0E000000U, 0x04000000U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * NAND TZ
     */
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * Register : IOU_AXI_RPRTCN @ 0XFF240004
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_RPRTCN_NAND_AXI_ARPROT          2
+
+    * AXI read protection type selection
+    * (OFFSET, MASK, VALUE)      (0XFF240004, 0x01C00000U ,0x00800000U)
     */
+	PSU_Mask_Write(IOU_SECURE_SLCR_IOU_AXI_RPRTCN_OFFSET,
+		0x01C00000U, 0x00800000U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_10, START ADDRESS: FF370000, END ADDRESS: FF37FFFF
+    * Register : IOU_AXI_WPRTCN @ 0XFF240000
+
+    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
+    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
+    * ccess [2] = '1'' : Instruction access
+    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_NAND_AXI_AWPROT          2
+
+    * AXI write protection type selection
+    * (OFFSET, MASK, VALUE)      (0XFF240000, 0x01C00000U ,0x00800000U)
     */
+	PSU_Mask_Write(IOU_SECURE_SLCR_IOU_AXI_WPRTCN_OFFSET,
+		0x01C00000U, 0x00800000U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * DMA TZ
     */
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * Register : slcr_adma @ 0XFF4B0024
+
+    * TrustZone Classification for ADMA
+    *  PSU_LPD_SLCR_SECURE_SLCR_ADMA_TZ                            0xFF
+
+    * RPU TrustZone settings
+    * (OFFSET, MASK, VALUE)      (0XFF4B0024, 0x000000FFU ,0x000000FFU)
     */
+	PSU_Mask_Write(LPD_SLCR_SECURE_SLCR_ADMA_OFFSET,
+		0x000000FFU, 0x000000FFU);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * Register : slcr_gdma @ 0XFD690050
+
+    * TrustZone Classification for GDMA
+    *  PSU_FPD_SLCR_SECURE_SLCR_GDMA_TZ                            0xFF
+
+    * GDMA Trustzone Settings
+    * (OFFSET, MASK, VALUE)      (0XFD690050, 0x000000FFU ,0x000000FFU)
     */
+	PSU_Mask_Write(FPD_SLCR_SECURE_SLCR_GDMA_OFFSET,
+		0x000000FFU, 0x000000FFU);
+/*##################################################################### */
+
+
+	return 1;
+#endif /* PSU_INIT_TABLE */
+}
+unsigned long psu_serdes_init_data(void)
+{
+#ifdef PSU_INIT_TABLE
+	psu_table_run(psu_serdes_init_data_table);
+	serdes_illcalib(2,3,3,0,4,0,1,1);
+	return psu_table_run(psu_serdes_init_data_table1);
+#else
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * SERDES INITIALIZATION
     */
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * GT REFERENCE CLOCK SOURCE SELECTION
     */
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * Register : PLL_REF_SEL0 @ 0XFD410000
+
+    * PLL0 Reference Selection. 0x0 - 5MHz, 0x1 - 9.6MHz, 0x2 - 10MHz, 0x3 - 1
+    * 2MHz, 0x4 - 13MHz, 0x5 - 19.2MHz, 0x6 - 20MHz, 0x7 - 24MHz, 0x8 - 26MHz,
+    *  0x9 - 27MHz, 0xA - 38.4MHz, 0xB - 40MHz, 0xC - 52MHz, 0xD - 100MHz, 0xE
+    *  - 108MHz, 0xF - 125MHz, 0x10 - 135MHz, 0x11 - 150 MHz. 0x12 to 0x1F - R
+    * eserved
+    *  PSU_SERDES_PLL_REF_SEL0_PLLREFSEL0                          0xD
+
+    * PLL0 Reference Selection Register
+    * (OFFSET, MASK, VALUE)      (0XFD410000, 0x0000001FU ,0x0000000DU)
     */
+	PSU_Mask_Write(SERDES_PLL_REF_SEL0_OFFSET, 0x0000001FU, 0x0000000DU);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * Register : PLL_REF_SEL1 @ 0XFD410004
+
+    * PLL1 Reference Selection. 0x0 - 5MHz, 0x1 - 9.6MHz, 0x2 - 10MHz, 0x3 - 1
+    * 2MHz, 0x4 - 13MHz, 0x5 - 19.2MHz, 0x6 - 20MHz, 0x7 - 24MHz, 0x8 - 26MHz,
+    *  0x9 - 27MHz, 0xA - 38.4MHz, 0xB - 40MHz, 0xC - 52MHz, 0xD - 100MHz, 0xE
+    *  - 108MHz, 0xF - 125MHz, 0x10 - 135MHz, 0x11 - 150 MHz. 0x12 to 0x1F - R
+    * eserved
+    *  PSU_SERDES_PLL_REF_SEL1_PLLREFSEL1                          0x9
+
+    * PLL1 Reference Selection Register
+    * (OFFSET, MASK, VALUE)      (0XFD410004, 0x0000001FU ,0x00000009U)
     */
+	PSU_Mask_Write(SERDES_PLL_REF_SEL1_OFFSET, 0x0000001FU, 0x00000009U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * Register : PLL_REF_SEL2 @ 0XFD410008
+
+    * PLL2 Reference Selection. 0x0 - 5MHz, 0x1 - 9.6MHz, 0x2 - 10MHz, 0x3 - 1
+    * 2MHz, 0x4 - 13MHz, 0x5 - 19.2MHz, 0x6 - 20MHz, 0x7 - 24MHz, 0x8 - 26MHz,
+    *  0x9 - 27MHz, 0xA - 38.4MHz, 0xB - 40MHz, 0xC - 52MHz, 0xD - 100MHz, 0xE
+    *  - 108MHz, 0xF - 125MHz, 0x10 - 135MHz, 0x11 - 150 MHz. 0x12 to 0x1F - R
+    * eserved
+    *  PSU_SERDES_PLL_REF_SEL2_PLLREFSEL2                          0x8
+
+    * PLL2 Reference Selection Register
+    * (OFFSET, MASK, VALUE)      (0XFD410008, 0x0000001FU ,0x00000008U)
     */
+	PSU_Mask_Write(SERDES_PLL_REF_SEL2_OFFSET, 0x0000001FU, 0x00000008U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * Register : PLL_REF_SEL3 @ 0XFD41000C
+
+    * PLL3 Reference Selection. 0x0 - 5MHz, 0x1 - 9.6MHz, 0x2 - 10MHz, 0x3 - 1
+    * 2MHz, 0x4 - 13MHz, 0x5 - 19.2MHz, 0x6 - 20MHz, 0x7 - 24MHz, 0x8 - 26MHz,
+    *  0x9 - 27MHz, 0xA - 38.4MHz, 0xB - 40MHz, 0xC - 52MHz, 0xD - 100MHz, 0xE
+    *  - 108MHz, 0xF - 125MHz, 0x10 - 135MHz, 0x11 - 150 MHz. 0x12 to 0x1F - R
+    * eserved
+    *  PSU_SERDES_PLL_REF_SEL3_PLLREFSEL3                          0xF
+
+    * PLL3 Reference Selection Register
+    * (OFFSET, MASK, VALUE)      (0XFD41000C, 0x0000001FU ,0x0000000FU)
     */
+	PSU_Mask_Write(SERDES_PLL_REF_SEL3_OFFSET, 0x0000001FU, 0x0000000FU);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * GT REFERENCE CLOCK FREQUENCY SELECTION
     */
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * Register : L0_L0_REF_CLK_SEL @ 0XFD402860
+
+    * Sel of lane 0 ref clock local mux. Set to 1 to select lane 0 slicer outp
+    * ut. Set to 0 to select lane0 ref clock mux output.
+    *  PSU_SERDES_L0_L0_REF_CLK_SEL_L0_REF_CLK_LCL_SEL             0x1
+
+    * Lane0 Ref Clock Selection Register
+    * (OFFSET, MASK, VALUE)      (0XFD402860, 0x00000080U ,0x00000080U)
     */
+	PSU_Mask_Write(SERDES_L0_L0_REF_CLK_SEL_OFFSET,
+		0x00000080U, 0x00000080U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * Register : L0_L1_REF_CLK_SEL @ 0XFD402864
+
+    * Sel of lane 1 ref clock local mux. Set to 1 to select lane 1 slicer outp
+    * ut. Set to 0 to select lane1 ref clock mux output.
+    *  PSU_SERDES_L0_L1_REF_CLK_SEL_L1_REF_CLK_LCL_SEL             0x0
+
+    * Bit 3 of lane 1 ref clock mux one hot sel. Set to 1 to select lane 3 sli
+    * cer output from ref clock network
+    *  PSU_SERDES_L0_L1_REF_CLK_SEL_L1_REF_CLK_SEL_3               0x1
+
+    * Lane1 Ref Clock Selection Register
+    * (OFFSET, MASK, VALUE)      (0XFD402864, 0x00000088U ,0x00000008U)
     */
+	PSU_Mask_Write(SERDES_L0_L1_REF_CLK_SEL_OFFSET,
+		0x00000088U, 0x00000008U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * Register : L0_L2_REF_CLK_SEL @ 0XFD402868
+
+    * Sel of lane 2 ref clock local mux. Set to 1 to select lane 1 slicer outp
+    * ut. Set to 0 to select lane2 ref clock mux output.
+    *  PSU_SERDES_L0_L2_REF_CLK_SEL_L2_REF_CLK_LCL_SEL             0x1
+
+    * Lane2 Ref Clock Selection Register
+    * (OFFSET, MASK, VALUE)      (0XFD402868, 0x00000080U ,0x00000080U)
     */
+	PSU_Mask_Write(SERDES_L0_L2_REF_CLK_SEL_OFFSET,
+		0x00000080U, 0x00000080U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * Register : L0_L3_REF_CLK_SEL @ 0XFD40286C
+
+    * Sel of lane 3 ref clock local mux. Set to 1 to select lane 3 slicer outp
+    * ut. Set to 0 to select lane3 ref clock mux output.
+    *  PSU_SERDES_L0_L3_REF_CLK_SEL_L3_REF_CLK_LCL_SEL             0x0
+
+    * Bit 1 of lane 3 ref clock mux one hot sel. Set to 1 to select lane 1 sli
+    * cer output from ref clock network
+    *  PSU_SERDES_L0_L3_REF_CLK_SEL_L3_REF_CLK_SEL_1               0x1
+
+    * Lane3 Ref Clock Selection Register
+    * (OFFSET, MASK, VALUE)      (0XFD40286C, 0x00000082U ,0x00000002U)
     */
+	PSU_Mask_Write(SERDES_L0_L3_REF_CLK_SEL_OFFSET,
+		0x00000082U, 0x00000002U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * ENABLE SPREAD SPECTRUM
     */
     /*
-    * APERTURE NAME: IPI_PMU, START ADDRESS: FF330000, END ADDRESS: FF33FFFF
+    * Register : L2_TM_PLL_DIG_37 @ 0XFD40A094
+
+    * Enable/Disable coarse code satureation limiting logic
+    *  PSU_SERDES_L2_TM_PLL_DIG_37_TM_ENABLE_COARSE_SATURATION     0x1
+
+    * Test mode register 37
+    * (OFFSET, MASK, VALUE)      (0XFD40A094, 0x00000010U ,0x00000010U)
     */
+	PSU_Mask_Write(SERDES_L2_TM_PLL_DIG_37_OFFSET,
+		0x00000010U, 0x00000010U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: IOU_GPV, START ADDRESS: FE000000, END ADDRESS: FE0FFFFF
+    * Register : L2_PLL_SS_STEPS_0_LSB @ 0XFD40A368
+
+    * Spread Spectrum No of Steps [7:0]
+    *  PSU_SERDES_L2_PLL_SS_STEPS_0_LSB_SS_NUM_OF_STEPS_0_LSB      0x38
+
+    * Spread Spectrum No of Steps bits 7:0
+    * (OFFSET, MASK, VALUE)      (0XFD40A368, 0x000000FFU ,0x00000038U)
     */
+	PSU_Mask_Write(SERDES_L2_PLL_SS_STEPS_0_LSB_OFFSET,
+		0x000000FFU, 0x00000038U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: LPD_GPV, START ADDRESS: FE100000, END ADDRESS: FE1FFFFF
+    * Register : L2_PLL_SS_STEPS_1_MSB @ 0XFD40A36C
+
+    * Spread Spectrum No of Steps [10:8]
+    *  PSU_SERDES_L2_PLL_SS_STEPS_1_MSB_SS_NUM_OF_STEPS_1_MSB      0x03
+
+    * Spread Spectrum No of Steps bits 10:8
+    * (OFFSET, MASK, VALUE)      (0XFD40A36C, 0x00000007U ,0x00000003U)
     */
+	PSU_Mask_Write(SERDES_L2_PLL_SS_STEPS_1_MSB_OFFSET,
+		0x00000007U, 0x00000003U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: USB3_0_XHCI, START ADDRESS: FE200000, END ADDRESS: FE2FFF
-    * FF
+    * Register : L3_PLL_SS_STEPS_0_LSB @ 0XFD40E368
+
+    * Spread Spectrum No of Steps [7:0]
+    *  PSU_SERDES_L3_PLL_SS_STEPS_0_LSB_SS_NUM_OF_STEPS_0_LSB      0xE0
+
+    * Spread Spectrum No of Steps bits 7:0
+    * (OFFSET, MASK, VALUE)      (0XFD40E368, 0x000000FFU ,0x000000E0U)
     */
+	PSU_Mask_Write(SERDES_L3_PLL_SS_STEPS_0_LSB_OFFSET,
+		0x000000FFU, 0x000000E0U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: USB3_1_XHCI, START ADDRESS: FE300000, END ADDRESS: FE3FFF
-    * FF
+    * Register : L3_PLL_SS_STEPS_1_MSB @ 0XFD40E36C
+
+    * Spread Spectrum No of Steps [10:8]
+    *  PSU_SERDES_L3_PLL_SS_STEPS_1_MSB_SS_NUM_OF_STEPS_1_MSB      0x3
+
+    * Spread Spectrum No of Steps bits 10:8
+    * (OFFSET, MASK, VALUE)      (0XFD40E36C, 0x00000007U ,0x00000003U)
     */
+	PSU_Mask_Write(SERDES_L3_PLL_SS_STEPS_1_MSB_OFFSET,
+		0x00000007U, 0x00000003U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: LPD_UNUSED_13, START ADDRESS: FE400000, END ADDRESS: FE7F
-    * FFFF
+    * Register : L1_PLL_SS_STEPS_0_LSB @ 0XFD406368
+
+    * Spread Spectrum No of Steps [7:0]
+    *  PSU_SERDES_L1_PLL_SS_STEPS_0_LSB_SS_NUM_OF_STEPS_0_LSB      0x58
+
+    * Spread Spectrum No of Steps bits 7:0
+    * (OFFSET, MASK, VALUE)      (0XFD406368, 0x000000FFU ,0x00000058U)
     */
+	PSU_Mask_Write(SERDES_L1_PLL_SS_STEPS_0_LSB_OFFSET,
+		0x000000FFU, 0x00000058U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: LPD_UNUSED_13, START ADDRESS: FE400000, END ADDRESS: FE7F
-    * FFFF
+    * Register : L1_PLL_SS_STEPS_1_MSB @ 0XFD40636C
+
+    * Spread Spectrum No of Steps [10:8]
+    *  PSU_SERDES_L1_PLL_SS_STEPS_1_MSB_SS_NUM_OF_STEPS_1_MSB      0x3
+
+    * Spread Spectrum No of Steps bits 10:8
+    * (OFFSET, MASK, VALUE)      (0XFD40636C, 0x00000007U ,0x00000003U)
     */
+	PSU_Mask_Write(SERDES_L1_PLL_SS_STEPS_1_MSB_OFFSET,
+		0x00000007U, 0x00000003U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: LPD_UNUSED_13, START ADDRESS: FE400000, END ADDRESS: FE7F
-    * FFFF
+    * Register : L1_PLL_SS_STEP_SIZE_0_LSB @ 0XFD406370
+
+    * Step Size for Spread Spectrum [7:0]
+    *  PSU_SERDES_L1_PLL_SS_STEP_SIZE_0_LSB_SS_STEP_SIZE_0_LSB     0x7C
+
+    * Step Size for Spread Spectrum LSB
+    * (OFFSET, MASK, VALUE)      (0XFD406370, 0x000000FFU ,0x0000007CU)
     */
+	PSU_Mask_Write(SERDES_L1_PLL_SS_STEP_SIZE_0_LSB_OFFSET,
+		0x000000FFU, 0x0000007CU);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: LPD_UNUSED_13, START ADDRESS: FE400000, END ADDRESS: FE7F
-    * FFFF
+    * Register : L1_PLL_SS_STEP_SIZE_1 @ 0XFD406374
+
+    * Step Size for Spread Spectrum [15:8]
+    *  PSU_SERDES_L1_PLL_SS_STEP_SIZE_1_SS_STEP_SIZE_1             0x33
+
+    * Step Size for Spread Spectrum 1
+    * (OFFSET, MASK, VALUE)      (0XFD406374, 0x000000FFU ,0x00000033U)
     */
+	PSU_Mask_Write(SERDES_L1_PLL_SS_STEP_SIZE_1_OFFSET,
+		0x000000FFU, 0x00000033U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    * Register : L1_PLL_SS_STEP_SIZE_2 @ 0XFD406378
+
+    * Step Size for Spread Spectrum [23:16]
+    *  PSU_SERDES_L1_PLL_SS_STEP_SIZE_2_SS_STEP_SIZE_2             0x2
+
+    * Step Size for Spread Spectrum 2
+    * (OFFSET, MASK, VALUE)      (0XFD406378, 0x000000FFU ,0x00000002U)
     */
+	PSU_Mask_Write(SERDES_L1_PLL_SS_STEP_SIZE_2_OFFSET,
+		0x000000FFU, 0x00000002U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    * Register : L1_PLL_SS_STEP_SIZE_3_MSB @ 0XFD40637C
+
+    * Step Size for Spread Spectrum [25:24]
+    *  PSU_SERDES_L1_PLL_SS_STEP_SIZE_3_MSB_SS_STEP_SIZE_3_MSB     0x0
+
+    * Enable/Disable test mode force on SS step size
+    *  PSU_SERDES_L1_PLL_SS_STEP_SIZE_3_MSB_FORCE_SS_STEP_SIZE     0x1
+
+    * Enable/Disable test mode force on SS no of steps
+    *  PSU_SERDES_L1_PLL_SS_STEP_SIZE_3_MSB_FORCE_SS_NUM_OF_STEPS  0x1
+
+    * Enable force on enable Spread Spectrum
+    * (OFFSET, MASK, VALUE)      (0XFD40637C, 0x00000033U ,0x00000030U)
     */
+	PSU_Mask_Write(SERDES_L1_PLL_SS_STEP_SIZE_3_MSB_OFFSET,
+		0x00000033U, 0x00000030U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    * Register : L2_PLL_SS_STEP_SIZE_0_LSB @ 0XFD40A370
+
+    * Step Size for Spread Spectrum [7:0]
+    *  PSU_SERDES_L2_PLL_SS_STEP_SIZE_0_LSB_SS_STEP_SIZE_0_LSB     0xF4
+
+    * Step Size for Spread Spectrum LSB
+    * (OFFSET, MASK, VALUE)      (0XFD40A370, 0x000000FFU ,0x000000F4U)
     */
+	PSU_Mask_Write(SERDES_L2_PLL_SS_STEP_SIZE_0_LSB_OFFSET,
+		0x000000FFU, 0x000000F4U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    * Register : L2_PLL_SS_STEP_SIZE_1 @ 0XFD40A374
+
+    * Step Size for Spread Spectrum [15:8]
+    *  PSU_SERDES_L2_PLL_SS_STEP_SIZE_1_SS_STEP_SIZE_1             0x31
+
+    * Step Size for Spread Spectrum 1
+    * (OFFSET, MASK, VALUE)      (0XFD40A374, 0x000000FFU ,0x00000031U)
     */
+	PSU_Mask_Write(SERDES_L2_PLL_SS_STEP_SIZE_1_OFFSET,
+		0x000000FFU, 0x00000031U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    * Register : L2_PLL_SS_STEP_SIZE_2 @ 0XFD40A378
+
+    * Step Size for Spread Spectrum [23:16]
+    *  PSU_SERDES_L2_PLL_SS_STEP_SIZE_2_SS_STEP_SIZE_2             0x2
+
+    * Step Size for Spread Spectrum 2
+    * (OFFSET, MASK, VALUE)      (0XFD40A378, 0x000000FFU ,0x00000002U)
     */
+	PSU_Mask_Write(SERDES_L2_PLL_SS_STEP_SIZE_2_OFFSET,
+		0x000000FFU, 0x00000002U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    * Register : L2_PLL_SS_STEP_SIZE_3_MSB @ 0XFD40A37C
+
+    * Step Size for Spread Spectrum [25:24]
+    *  PSU_SERDES_L2_PLL_SS_STEP_SIZE_3_MSB_SS_STEP_SIZE_3_MSB     0x0
+
+    * Enable/Disable test mode force on SS step size
+    *  PSU_SERDES_L2_PLL_SS_STEP_SIZE_3_MSB_FORCE_SS_STEP_SIZE     0x1
+
+    * Enable/Disable test mode force on SS no of steps
+    *  PSU_SERDES_L2_PLL_SS_STEP_SIZE_3_MSB_FORCE_SS_NUM_OF_STEPS  0x1
+
+    * Enable force on enable Spread Spectrum
+    * (OFFSET, MASK, VALUE)      (0XFD40A37C, 0x00000033U ,0x00000030U)
     */
+	PSU_Mask_Write(SERDES_L2_PLL_SS_STEP_SIZE_3_MSB_OFFSET,
+		0x00000033U, 0x00000030U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    * Register : L3_PLL_SS_STEP_SIZE_0_LSB @ 0XFD40E370
+
+    * Step Size for Spread Spectrum [7:0]
+    *  PSU_SERDES_L3_PLL_SS_STEP_SIZE_0_LSB_SS_STEP_SIZE_0_LSB     0xC9
+
+    * Step Size for Spread Spectrum LSB
+    * (OFFSET, MASK, VALUE)      (0XFD40E370, 0x000000FFU ,0x000000C9U)
     */
+	PSU_Mask_Write(SERDES_L3_PLL_SS_STEP_SIZE_0_LSB_OFFSET,
+		0x000000FFU, 0x000000C9U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: CORESIGHT, START ADDRESS: FE800000, END ADDRESS: FEFFFFFF
+    * Register : L3_PLL_SS_STEP_SIZE_1 @ 0XFD40E374
+
+    * Step Size for Spread Spectrum [15:8]
+    *  PSU_SERDES_L3_PLL_SS_STEP_SIZE_1_SS_STEP_SIZE_1             0xD2
+
+    * Step Size for Spread Spectrum 1
+    * (OFFSET, MASK, VALUE)      (0XFD40E374, 0x000000FFU ,0x000000D2U)
     */
+	PSU_Mask_Write(SERDES_L3_PLL_SS_STEP_SIZE_1_OFFSET,
+		0x000000FFU, 0x000000D2U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: QSPI_LINEAR_ADDRESS, START ADDRESS: C0000000, END ADDRESS
-    * : DFFFFFFF
+    * Register : L3_PLL_SS_STEP_SIZE_2 @ 0XFD40E378
+
+    * Step Size for Spread Spectrum [23:16]
+    *  PSU_SERDES_L3_PLL_SS_STEP_SIZE_2_SS_STEP_SIZE_2             0x1
+
+    * Step Size for Spread Spectrum 2
+    * (OFFSET, MASK, VALUE)      (0XFD40E378, 0x000000FFU ,0x00000001U)
     */
+	PSU_Mask_Write(SERDES_L3_PLL_SS_STEP_SIZE_2_OFFSET,
+		0x000000FFU, 0x00000001U);
+/*##################################################################### */
+
     /*
-    * XPPU CONTROL
+    * Register : L3_PLL_SS_STEP_SIZE_3_MSB @ 0XFD40E37C
+
+    * Step Size for Spread Spectrum [25:24]
+    *  PSU_SERDES_L3_PLL_SS_STEP_SIZE_3_MSB_SS_STEP_SIZE_3_MSB     0x0
+
+    * Enable/Disable test mode force on SS step size
+    *  PSU_SERDES_L3_PLL_SS_STEP_SIZE_3_MSB_FORCE_SS_STEP_SIZE     0x1
+
+    * Enable/Disable test mode force on SS no of steps
+    *  PSU_SERDES_L3_PLL_SS_STEP_SIZE_3_MSB_FORCE_SS_NUM_OF_STEPS  0x1
+
+    * Enable test mode forcing on enable Spread Spectrum
+    *  PSU_SERDES_L3_PLL_SS_STEP_SIZE_3_MSB_TM_FORCE_EN_SS         0x1
+
+    * Enable force on enable Spread Spectrum
+    * (OFFSET, MASK, VALUE)      (0XFD40E37C, 0x000000B3U ,0x000000B0U)
     */
+	PSU_Mask_Write(SERDES_L3_PLL_SS_STEP_SIZE_3_MSB_OFFSET,
+		0x000000B3U, 0x000000B0U);
+/*##################################################################### */
 
-	return 1;
-}
-unsigned long psu_ddr_xmpu0_data(void)
-{
     /*
-    * DDR XMPU0
+    * Register : L2_TM_DIG_6 @ 0XFD40906C
+
+    * Bypass Descrambler
+    *  PSU_SERDES_L2_TM_DIG_6_BYPASS_DESCRAM                       0x1
+
+    * Enable Bypass for <1> TM_DIG_CTRL_6
+    *  PSU_SERDES_L2_TM_DIG_6_FORCE_BYPASS_DESCRAM                 0x1
+
+    * Data path test modes in decoder and descram
+    * (OFFSET, MASK, VALUE)      (0XFD40906C, 0x00000003U ,0x00000003U)
     */
+	PSU_Mask_Write(SERDES_L2_TM_DIG_6_OFFSET, 0x00000003U, 0x00000003U);
+/*##################################################################### */
 
-	return 1;
-}
-unsigned long psu_ddr_xmpu1_data(void)
-{
     /*
-    * DDR XMPU1
+    * Register : L2_TX_DIG_TM_61 @ 0XFD4080F4
+
+    * Bypass scrambler signal
+    *  PSU_SERDES_L2_TX_DIG_TM_61_BYPASS_SCRAM                     0x1
+
+    * Enable/disable scrambler bypass signal
+    *  PSU_SERDES_L2_TX_DIG_TM_61_FORCE_BYPASS_SCRAM               0x1
+
+    * MPHY PLL Gear and bypass scrambler
+    * (OFFSET, MASK, VALUE)      (0XFD4080F4, 0x00000003U ,0x00000003U)
     */
+	PSU_Mask_Write(SERDES_L2_TX_DIG_TM_61_OFFSET,
+		0x00000003U, 0x00000003U);
+/*##################################################################### */
 
-	return 1;
-}
-unsigned long psu_ddr_xmpu2_data(void)
-{
     /*
-    * DDR XMPU2
+    * Register : L3_PLL_FBDIV_FRAC_3_MSB @ 0XFD40E360
+
+    * Enable test mode force on fractional mode enable
+    *  PSU_SERDES_L3_PLL_FBDIV_FRAC_3_MSB_TM_FORCE_EN_FRAC         0x1
+
+    * Fractional feedback division control and fractional value for feedback d
+    * ivision bits 26:24
+    * (OFFSET, MASK, VALUE)      (0XFD40E360, 0x00000040U ,0x00000040U)
     */
+	PSU_Mask_Write(SERDES_L3_PLL_FBDIV_FRAC_3_MSB_OFFSET,
+		0x00000040U, 0x00000040U);
+/*##################################################################### */
 
-	return 1;
-}
-unsigned long psu_ddr_xmpu3_data(void)
-{
     /*
-    * DDR XMPU3
+    * Register : L3_TM_DIG_6 @ 0XFD40D06C
+
+    * Bypass 8b10b decoder
+    *  PSU_SERDES_L3_TM_DIG_6_BYPASS_DECODER                       0x1
+
+    * Enable Bypass for <3> TM_DIG_CTRL_6
+    *  PSU_SERDES_L3_TM_DIG_6_FORCE_BYPASS_DEC                     0x1
+
+    * Bypass Descrambler
+    *  PSU_SERDES_L3_TM_DIG_6_BYPASS_DESCRAM                       0x1
+
+    * Enable Bypass for <1> TM_DIG_CTRL_6
+    *  PSU_SERDES_L3_TM_DIG_6_FORCE_BYPASS_DESCRAM                 0x1
+
+    * Data path test modes in decoder and descram
+    * (OFFSET, MASK, VALUE)      (0XFD40D06C, 0x0000000FU ,0x0000000FU)
     */
+	PSU_Mask_Write(SERDES_L3_TM_DIG_6_OFFSET, 0x0000000FU, 0x0000000FU);
+/*##################################################################### */
 
-	return 1;
-}
-unsigned long psu_ddr_xmpu4_data(void)
-{
     /*
-    * DDR XMPU4
-    */
+    * Register : L3_TX_DIG_TM_61 @ 0XFD40C0F4
 
-	return 1;
-}
-unsigned long psu_ddr_xmpu5_data(void)
-{
-    /*
-    * DDR XMPU5
-    */
+    * Enable/disable encoder bypass signal
+    *  PSU_SERDES_L3_TX_DIG_TM_61_BYPASS_ENC                       0x1
 
-	return 1;
-}
-unsigned long psu_ocm_xmpu_data(void)
-{
-    /*
-    * OCM XMPU
-    */
+    * Bypass scrambler signal
+    *  PSU_SERDES_L3_TX_DIG_TM_61_BYPASS_SCRAM                     0x1
 
-	return 1;
-}
-unsigned long psu_fpd_xmpu_data(void)
-{
-    /*
-    * FPD XMPU
+    * Enable/disable scrambler bypass signal
+    *  PSU_SERDES_L3_TX_DIG_TM_61_FORCE_BYPASS_SCRAM               0x1
+
+    * MPHY PLL Gear and bypass scrambler
+    * (OFFSET, MASK, VALUE)      (0XFD40C0F4, 0x0000000BU ,0x0000000BU)
     */
+	PSU_Mask_Write(SERDES_L3_TX_DIG_TM_61_OFFSET,
+		0x0000000BU, 0x0000000BU);
+/*##################################################################### */
 
-	return 1;
-}
-unsigned long psu_protection_lock_data(void)
-{
     /*
-    * LOCKING PROTECTION MODULE
+    * ENABLE CHICKEN BIT FOR PCIE AND USB
     */
     /*
-    * XPPU LOCK
+    * Register : L0_TM_AUX_0 @ 0XFD4010CC
+
+    * Spare- not used
+    *  PSU_SERDES_L0_TM_AUX_0_BIT_2                                1
+
+    * Spare registers
+    * (OFFSET, MASK, VALUE)      (0XFD4010CC, 0x00000020U ,0x00000020U)
     */
+	PSU_Mask_Write(SERDES_L0_TM_AUX_0_OFFSET, 0x00000020U, 0x00000020U);
+/*##################################################################### */
+
     /*
-    * APERTURE NAME: LPD_XPPU, START ADDRESS: FF980000, END ADDRESS: FF99FFFF
+    * Register : L2_TM_AUX_0 @ 0XFD4090CC
+
+    * Spare- not used
+    *  PSU_SERDES_L2_TM_AUX_0_BIT_2                                1
+
+    * Spare registers
+    * (OFFSET, MASK, VALUE)      (0XFD4090CC, 0x00000020U ,0x00000020U)
     */
+	PSU_Mask_Write(SERDES_L2_TM_AUX_0_OFFSET, 0x00000020U, 0x00000020U);
+/*##################################################################### */
+
     /*
-    * XMPU LOCK
+    * ENABLING EYE SURF
     */
     /*
-    * LOCK OCM XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    * Register : L0_TM_DIG_8 @ 0XFD401074
+
+    * Enable Eye Surf
+    *  PSU_SERDES_L0_TM_DIG_8_EYESURF_ENABLE                       0x1
+
+    * Test modes for Elastic buffer and enabling Eye Surf
+    * (OFFSET, MASK, VALUE)      (0XFD401074, 0x00000010U ,0x00000010U)
     */
+	PSU_Mask_Write(SERDES_L0_TM_DIG_8_OFFSET, 0x00000010U, 0x00000010U);
+/*##################################################################### */
+
     /*
-    * LOCK FPD XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    * Register : L1_TM_DIG_8 @ 0XFD405074
+
+    * Enable Eye Surf
+    *  PSU_SERDES_L1_TM_DIG_8_EYESURF_ENABLE                       0x1
+
+    * Test modes for Elastic buffer and enabling Eye Surf
+    * (OFFSET, MASK, VALUE)      (0XFD405074, 0x00000010U ,0x00000010U)
     */
+	PSU_Mask_Write(SERDES_L1_TM_DIG_8_OFFSET, 0x00000010U, 0x00000010U);
+/*##################################################################### */
+
     /*
-    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    * Register : L2_TM_DIG_8 @ 0XFD409074
+
+    * Enable Eye Surf
+    *  PSU_SERDES_L2_TM_DIG_8_EYESURF_ENABLE                       0x1
+
+    * Test modes for Elastic buffer and enabling Eye Surf
+    * (OFFSET, MASK, VALUE)      (0XFD409074, 0x00000010U ,0x00000010U)
     */
+	PSU_Mask_Write(SERDES_L2_TM_DIG_8_OFFSET, 0x00000010U, 0x00000010U);
+/*##################################################################### */
+
     /*
-    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    * Register : L3_TM_DIG_8 @ 0XFD40D074
+
+    * Enable Eye Surf
+    *  PSU_SERDES_L3_TM_DIG_8_EYESURF_ENABLE                       0x1
+
+    * Test modes for Elastic buffer and enabling Eye Surf
+    * (OFFSET, MASK, VALUE)      (0XFD40D074, 0x00000010U ,0x00000010U)
     */
+	PSU_Mask_Write(SERDES_L3_TM_DIG_8_OFFSET, 0x00000010U, 0x00000010U);
+/*##################################################################### */
+
     /*
-    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    * ILL SETTINGS FOR GAIN AND LOCK SETTINGS
     */
     /*
-    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    * Register : L0_TM_MISC2 @ 0XFD40189C
+
+    * ILL calib counts BYPASSED with calcode bits
+    *  PSU_SERDES_L0_TM_MISC2_ILL_CAL_BYPASS_COUNTS                0x1
+
+    * sampler cal
+    * (OFFSET, MASK, VALUE)      (0XFD40189C, 0x00000080U ,0x00000080U)
     */
+	PSU_Mask_Write(SERDES_L0_TM_MISC2_OFFSET, 0x00000080U, 0x00000080U);
+/*##################################################################### */
+
     /*
-    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    * Register : L0_TM_IQ_ILL1 @ 0XFD4018F8
+
+    * IQ ILL F0 CALCODE bypass value. MPHY : G1a, PCIE : Gen 1, SATA : Gen1 ,
+    * USB3 : SS
+    *  PSU_SERDES_L0_TM_IQ_ILL1_ILL_BYPASS_IQ_CALCODE_F0           0x64
+
+    * iqpi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD4018F8, 0x000000FFU ,0x00000064U)
     */
+	PSU_Mask_Write(SERDES_L0_TM_IQ_ILL1_OFFSET,
+		0x000000FFU, 0x00000064U);
+/*##################################################################### */
+
     /*
-    * LOCK DDR XMPU ONLY IF IT IS NOT PROTECTED BY ANY MASTER
+    * Register : L0_TM_IQ_ILL2 @ 0XFD4018FC
+
+    * IQ ILL F1 CALCODE bypass value. MPHY : G1b, PCIE : Gen2, SATA: Gen2
+    *  PSU_SERDES_L0_TM_IQ_ILL2_ILL_BYPASS_IQ_CALCODE_F1           0x64
+
+    * iqpi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD4018FC, 0x000000FFU ,0x00000064U)
     */
+	PSU_Mask_Write(SERDES_L0_TM_IQ_ILL2_OFFSET,
+		0x000000FFU, 0x00000064U);
+/*##################################################################### */
 
-	return 1;
-}
-unsigned long psu_apply_master_tz(void)
-{
     /*
-    * RPU
+    * Register : L0_TM_ILL12 @ 0XFD401990
+
+    * G1A pll ctr bypass value
+    *  PSU_SERDES_L0_TM_ILL12_G1A_PLL_CTR_BYP_VAL                  0x11
+
+    * ill pll counter values
+    * (OFFSET, MASK, VALUE)      (0XFD401990, 0x000000FFU ,0x00000011U)
     */
+	PSU_Mask_Write(SERDES_L0_TM_ILL12_OFFSET, 0x000000FFU, 0x00000011U);
+/*##################################################################### */
+
     /*
-    * DP TZ
+    * Register : L0_TM_E_ILL1 @ 0XFD401924
+
+    * E ILL F0 CALCODE bypass value. MPHY : G1a, PCIE : Gen 1, SATA : Gen1 , U
+    * SB3 : SS
+    *  PSU_SERDES_L0_TM_E_ILL1_ILL_BYPASS_E_CALCODE_F0             0x4
+
+    * epi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD401924, 0x000000FFU ,0x00000004U)
     */
+	PSU_Mask_Write(SERDES_L0_TM_E_ILL1_OFFSET, 0x000000FFU, 0x00000004U);
+/*##################################################################### */
+
     /*
-    * Register : slcr_dpdma @ 0XFD690040
+    * Register : L0_TM_E_ILL2 @ 0XFD401928
 
-    * TrustZone classification for DisplayPort DMA
-    *  PSU_FPD_SLCR_SECURE_SLCR_DPDMA_TZ                           1
+    * E ILL F1 CALCODE bypass value. MPHY : G1b, PCIE : Gen2, SATA: Gen2
+    *  PSU_SERDES_L0_TM_E_ILL2_ILL_BYPASS_E_CALCODE_F1             0xFE
 
-    * DPDMA TrustZone Settings
-    * (OFFSET, MASK, VALUE)      (0XFD690040, 0x00000001U ,0x00000001U)
+    * epi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD401928, 0x000000FFU ,0x000000FEU)
     */
-	PSU_Mask_Write(FPD_SLCR_SECURE_SLCR_DPDMA_OFFSET,
-		0x00000001U, 0x00000001U);
+	PSU_Mask_Write(SERDES_L0_TM_E_ILL2_OFFSET, 0x000000FFU, 0x000000FEU);
 /*##################################################################### */
 
     /*
-    * SATA TZ
+    * Register : L0_TM_IQ_ILL3 @ 0XFD401900
+
+    * IQ ILL F2CALCODE bypass value. MPHY : G2a, SATA : Gen3
+    *  PSU_SERDES_L0_TM_IQ_ILL3_ILL_BYPASS_IQ_CALCODE_F2           0x64
+
+    * iqpi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD401900, 0x000000FFU ,0x00000064U)
     */
+	PSU_Mask_Write(SERDES_L0_TM_IQ_ILL3_OFFSET,
+		0x000000FFU, 0x00000064U);
+/*##################################################################### */
+
     /*
-    * PCIE TZ
+    * Register : L0_TM_E_ILL3 @ 0XFD40192C
+
+    * E ILL F2CALCODE bypass value. MPHY : G2a, SATA : Gen3
+    *  PSU_SERDES_L0_TM_E_ILL3_ILL_BYPASS_E_CALCODE_F2             0x0
+
+    * epi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD40192C, 0x000000FFU ,0x00000000U)
     */
+	PSU_Mask_Write(SERDES_L0_TM_E_ILL3_OFFSET, 0x000000FFU, 0x00000000U);
+/*##################################################################### */
+
     /*
-    * Register : slcr_pcie @ 0XFD690030
+    * Register : L0_TM_ILL8 @ 0XFD401980
 
-    * TrustZone classification for DMA Channel 0
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_DMA_0                      1
+    * ILL calibration code change wait time
+    *  PSU_SERDES_L0_TM_ILL8_ILL_CAL_ITER_WAIT                     0xFF
 
-    * TrustZone classification for DMA Channel 1
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_DMA_1                      1
+    * ILL cal routine control
+    * (OFFSET, MASK, VALUE)      (0XFD401980, 0x000000FFU ,0x000000FFU)
+    */
+	PSU_Mask_Write(SERDES_L0_TM_ILL8_OFFSET, 0x000000FFU, 0x000000FFU);
+/*##################################################################### */
 
-    * TrustZone classification for DMA Channel 2
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_DMA_2                      1
+    /*
+    * Register : L0_TM_IQ_ILL8 @ 0XFD401914
 
-    * TrustZone classification for DMA Channel 3
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_DMA_3                      1
+    * IQ ILL polytrim bypass value
+    *  PSU_SERDES_L0_TM_IQ_ILL8_ILL_BYPASS_IQ_POLYTRIM_VAL         0xF7
 
-    * TrustZone classification for Ingress Address Translation 0
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_0                  1
+    * iqpi polytrim
+    * (OFFSET, MASK, VALUE)      (0XFD401914, 0x000000FFU ,0x000000F7U)
+    */
+	PSU_Mask_Write(SERDES_L0_TM_IQ_ILL8_OFFSET,
+		0x000000FFU, 0x000000F7U);
+/*##################################################################### */
 
-    * TrustZone classification for Ingress Address Translation 1
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_1                  1
+    /*
+    * Register : L0_TM_IQ_ILL9 @ 0XFD401918
 
-    * TrustZone classification for Ingress Address Translation 2
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_2                  1
+    * bypass IQ polytrim
+    *  PSU_SERDES_L0_TM_IQ_ILL9_ILL_BYPASS_IQ_POLYTIM              0x1
 
-    * TrustZone classification for Ingress Address Translation 3
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_3                  1
+    * enables for lf,constant gm trim and polytirm
+    * (OFFSET, MASK, VALUE)      (0XFD401918, 0x00000001U ,0x00000001U)
+    */
+	PSU_Mask_Write(SERDES_L0_TM_IQ_ILL9_OFFSET,
+		0x00000001U, 0x00000001U);
+/*##################################################################### */
 
-    * TrustZone classification for Ingress Address Translation 4
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_4                  1
+    /*
+    * Register : L0_TM_E_ILL8 @ 0XFD401940
 
-    * TrustZone classification for Ingress Address Translation 5
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_5                  1
+    * E ILL polytrim bypass value
+    *  PSU_SERDES_L0_TM_E_ILL8_ILL_BYPASS_E_POLYTRIM_VAL           0xF7
 
-    * TrustZone classification for Ingress Address Translation 6
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_6                  1
+    * epi polytrim
+    * (OFFSET, MASK, VALUE)      (0XFD401940, 0x000000FFU ,0x000000F7U)
+    */
+	PSU_Mask_Write(SERDES_L0_TM_E_ILL8_OFFSET, 0x000000FFU, 0x000000F7U);
+/*##################################################################### */
 
-    * TrustZone classification for Ingress Address Translation 7
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_INGR_7                  1
+    /*
+    * Register : L0_TM_E_ILL9 @ 0XFD401944
 
-    * TrustZone classification for Egress Address Translation 0
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_0                   1
+    * bypass E polytrim
+    *  PSU_SERDES_L0_TM_E_ILL9_ILL_BYPASS_E_POLYTIM                0x1
 
-    * TrustZone classification for Egress Address Translation 1
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_1                   1
+    * enables for lf,constant gm trim and polytirm
+    * (OFFSET, MASK, VALUE)      (0XFD401944, 0x00000001U ,0x00000001U)
+    */
+	PSU_Mask_Write(SERDES_L0_TM_E_ILL9_OFFSET, 0x00000001U, 0x00000001U);
+/*##################################################################### */
 
-    * TrustZone classification for Egress Address Translation 2
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_2                   1
+    /*
+    * Register : L0_TM_ILL13 @ 0XFD401994
 
-    * TrustZone classification for Egress Address Translation 3
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_3                   1
+    * ILL cal idle val refcnt
+    *  PSU_SERDES_L0_TM_ILL13_ILL_CAL_IDLE_VAL_REFCNT              0x7
 
-    * TrustZone classification for Egress Address Translation 4
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_4                   1
+    * ill cal idle value count
+    * (OFFSET, MASK, VALUE)      (0XFD401994, 0x00000007U ,0x00000007U)
+    */
+	PSU_Mask_Write(SERDES_L0_TM_ILL13_OFFSET, 0x00000007U, 0x00000007U);
+/*##################################################################### */
 
-    * TrustZone classification for Egress Address Translation 5
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_5                   1
+    /*
+    * Register : L1_TM_ILL13 @ 0XFD405994
 
-    * TrustZone classification for Egress Address Translation 6
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_6                   1
+    * ILL cal idle val refcnt
+    *  PSU_SERDES_L1_TM_ILL13_ILL_CAL_IDLE_VAL_REFCNT              0x7
 
-    * TrustZone classification for Egress Address Translation 7
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_AT_EGR_7                   1
+    * ill cal idle value count
+    * (OFFSET, MASK, VALUE)      (0XFD405994, 0x00000007U ,0x00000007U)
+    */
+	PSU_Mask_Write(SERDES_L1_TM_ILL13_OFFSET, 0x00000007U, 0x00000007U);
+/*##################################################################### */
 
-    * TrustZone classification for DMA Registers
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_DMA_REGS                   1
+    /*
+    * Register : L2_TM_MISC2 @ 0XFD40989C
 
-    * TrustZone classification for MSIx Table
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_MSIX_TABLE                 1
+    * ILL calib counts BYPASSED with calcode bits
+    *  PSU_SERDES_L2_TM_MISC2_ILL_CAL_BYPASS_COUNTS                0x1
 
-    * TrustZone classification for MSIx PBA
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_MSIX_PBA                   1
+    * sampler cal
+    * (OFFSET, MASK, VALUE)      (0XFD40989C, 0x00000080U ,0x00000080U)
+    */
+	PSU_Mask_Write(SERDES_L2_TM_MISC2_OFFSET, 0x00000080U, 0x00000080U);
+/*##################################################################### */
 
-    * TrustZone classification for ECAM
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_ECAM                       1
+    /*
+    * Register : L2_TM_IQ_ILL1 @ 0XFD4098F8
 
-    * TrustZone classification for Bridge Common Registers
-    *  PSU_FPD_SLCR_SECURE_SLCR_PCIE_TZ_BRIDGE_REGS                1
+    * IQ ILL F0 CALCODE bypass value. MPHY : G1a, PCIE : Gen 1, SATA : Gen1 ,
+    * USB3 : SS
+    *  PSU_SERDES_L2_TM_IQ_ILL1_ILL_BYPASS_IQ_CALCODE_F0           0x1A
 
-    * PCIe TrustZone settings. This register may only be modified during bootu
-    * p (while PCIe block is disabled)
-    * (OFFSET, MASK, VALUE)      (0XFD690030, 0x01FFFFFFU ,0x01FFFFFFU)
+    * iqpi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD4098F8, 0x000000FFU ,0x0000001AU)
     */
-	PSU_Mask_Write(FPD_SLCR_SECURE_SLCR_PCIE_OFFSET,
-		0x01FFFFFFU, 0x01FFFFFFU);
+	PSU_Mask_Write(SERDES_L2_TM_IQ_ILL1_OFFSET,
+		0x000000FFU, 0x0000001AU);
 /*##################################################################### */
 
     /*
-    * USB TZ
+    * Register : L2_TM_IQ_ILL2 @ 0XFD4098FC
+
+    * IQ ILL F1 CALCODE bypass value. MPHY : G1b, PCIE : Gen2, SATA: Gen2
+    *  PSU_SERDES_L2_TM_IQ_ILL2_ILL_BYPASS_IQ_CALCODE_F1           0x1A
+
+    * iqpi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD4098FC, 0x000000FFU ,0x0000001AU)
     */
-    /*
-    * Register : slcr_usb @ 0XFF4B0034
+	PSU_Mask_Write(SERDES_L2_TM_IQ_ILL2_OFFSET,
+		0x000000FFU, 0x0000001AU);
+/*##################################################################### */
 
-    * TrustZone Classification for USB3_0
-    *  PSU_LPD_SLCR_SECURE_SLCR_USB_TZ_USB3_0                      1
+    /*
+    * Register : L2_TM_ILL12 @ 0XFD409990
 
-    * TrustZone Classification for USB3_1
-    *  PSU_LPD_SLCR_SECURE_SLCR_USB_TZ_USB3_1                      1
+    * G1A pll ctr bypass value
+    *  PSU_SERDES_L2_TM_ILL12_G1A_PLL_CTR_BYP_VAL                  0x10
 
-    * USB3 TrustZone settings
-    * (OFFSET, MASK, VALUE)      (0XFF4B0034, 0x00000003U ,0x00000003U)
+    * ill pll counter values
+    * (OFFSET, MASK, VALUE)      (0XFD409990, 0x000000FFU ,0x00000010U)
     */
-	PSU_Mask_Write(LPD_SLCR_SECURE_SLCR_USB_OFFSET,
-		0x00000003U, 0x00000003U);
+	PSU_Mask_Write(SERDES_L2_TM_ILL12_OFFSET, 0x000000FFU, 0x00000010U);
 /*##################################################################### */
 
     /*
-    * SD TZ
+    * Register : L2_TM_E_ILL1 @ 0XFD409924
+
+    * E ILL F0 CALCODE bypass value. MPHY : G1a, PCIE : Gen 1, SATA : Gen1 , U
+    * SB3 : SS
+    *  PSU_SERDES_L2_TM_E_ILL1_ILL_BYPASS_E_CALCODE_F0             0xFE
+
+    * epi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD409924, 0x000000FFU ,0x000000FEU)
     */
-    /*
-    * Register : IOU_AXI_RPRTCN @ 0XFF240004
+	PSU_Mask_Write(SERDES_L2_TM_E_ILL1_OFFSET, 0x000000FFU, 0x000000FEU);
+/*##################################################################### */
 
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_RPRTCN_SD0_AXI_ARPROT           2
+    /*
+    * Register : L2_TM_E_ILL2 @ 0XFD409928
 
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_RPRTCN_SD1_AXI_ARPROT           2
+    * E ILL F1 CALCODE bypass value. MPHY : G1b, PCIE : Gen2, SATA: Gen2
+    *  PSU_SERDES_L2_TM_E_ILL2_ILL_BYPASS_E_CALCODE_F1             0x0
 
-    * AXI read protection type selection
-    * (OFFSET, MASK, VALUE)      (0XFF240004, 0x003F0000U ,0x00120000U)
+    * epi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD409928, 0x000000FFU ,0x00000000U)
     */
-	PSU_Mask_Write(IOU_SECURE_SLCR_IOU_AXI_RPRTCN_OFFSET,
-		0x003F0000U, 0x00120000U);
+	PSU_Mask_Write(SERDES_L2_TM_E_ILL2_OFFSET, 0x000000FFU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : IOU_AXI_WPRTCN @ 0XFF240000
-
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_SD0_AXI_AWPROT           2
+    * Register : L2_TM_IQ_ILL3 @ 0XFD409900
 
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_SD1_AXI_AWPROT           2
+    * IQ ILL F2CALCODE bypass value. MPHY : G2a, SATA : Gen3
+    *  PSU_SERDES_L2_TM_IQ_ILL3_ILL_BYPASS_IQ_CALCODE_F2           0x1A
 
-    * AXI write protection type selection
-    * (OFFSET, MASK, VALUE)      (0XFF240000, 0x003F0000U ,0x00120000U)
+    * iqpi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD409900, 0x000000FFU ,0x0000001AU)
     */
-	PSU_Mask_Write(IOU_SECURE_SLCR_IOU_AXI_WPRTCN_OFFSET,
-		0x003F0000U, 0x00120000U);
+	PSU_Mask_Write(SERDES_L2_TM_IQ_ILL3_OFFSET,
+		0x000000FFU, 0x0000001AU);
 /*##################################################################### */
 
     /*
-    * GEM TZ
+    * Register : L2_TM_E_ILL3 @ 0XFD40992C
+
+    * E ILL F2CALCODE bypass value. MPHY : G2a, SATA : Gen3
+    *  PSU_SERDES_L2_TM_E_ILL3_ILL_BYPASS_E_CALCODE_F2             0x0
+
+    * epi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD40992C, 0x000000FFU ,0x00000000U)
     */
+	PSU_Mask_Write(SERDES_L2_TM_E_ILL3_OFFSET, 0x000000FFU, 0x00000000U);
+/*##################################################################### */
+
     /*
-    * Register : IOU_AXI_RPRTCN @ 0XFF240004
+    * Register : L2_TM_ILL8 @ 0XFD409980
 
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_RPRTCN_GEM0_AXI_ARPROT          2
+    * ILL calibration code change wait time
+    *  PSU_SERDES_L2_TM_ILL8_ILL_CAL_ITER_WAIT                     0xFF
 
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_RPRTCN_GEM1_AXI_ARPROT          2
+    * ILL cal routine control
+    * (OFFSET, MASK, VALUE)      (0XFD409980, 0x000000FFU ,0x000000FFU)
+    */
+	PSU_Mask_Write(SERDES_L2_TM_ILL8_OFFSET, 0x000000FFU, 0x000000FFU);
+/*##################################################################### */
 
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_RPRTCN_GEM2_AXI_ARPROT          2
+    /*
+    * Register : L2_TM_IQ_ILL8 @ 0XFD409914
 
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_RPRTCN_GEM3_AXI_ARPROT          2
+    * IQ ILL polytrim bypass value
+    *  PSU_SERDES_L2_TM_IQ_ILL8_ILL_BYPASS_IQ_POLYTRIM_VAL         0xF7
 
-    * AXI read protection type selection
-    * (OFFSET, MASK, VALUE)      (0XFF240004, 0x00000FFFU ,0x00000492U)
+    * iqpi polytrim
+    * (OFFSET, MASK, VALUE)      (0XFD409914, 0x000000FFU ,0x000000F7U)
     */
-	PSU_Mask_Write(IOU_SECURE_SLCR_IOU_AXI_RPRTCN_OFFSET,
-		0x00000FFFU, 0x00000492U);
+	PSU_Mask_Write(SERDES_L2_TM_IQ_ILL8_OFFSET,
+		0x000000FFU, 0x000000F7U);
 /*##################################################################### */
 
     /*
-    * Register : IOU_AXI_WPRTCN @ 0XFF240000
+    * Register : L2_TM_IQ_ILL9 @ 0XFD409918
 
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_GEM0_AXI_AWPROT          2
+    * bypass IQ polytrim
+    *  PSU_SERDES_L2_TM_IQ_ILL9_ILL_BYPASS_IQ_POLYTIM              0x1
 
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_GEM1_AXI_AWPROT          2
+    * enables for lf,constant gm trim and polytirm
+    * (OFFSET, MASK, VALUE)      (0XFD409918, 0x00000001U ,0x00000001U)
+    */
+	PSU_Mask_Write(SERDES_L2_TM_IQ_ILL9_OFFSET,
+		0x00000001U, 0x00000001U);
+/*##################################################################### */
 
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_GEM2_AXI_AWPROT          2
+    /*
+    * Register : L2_TM_E_ILL8 @ 0XFD409940
 
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_GEM3_AXI_AWPROT          2
+    * E ILL polytrim bypass value
+    *  PSU_SERDES_L2_TM_E_ILL8_ILL_BYPASS_E_POLYTRIM_VAL           0xF7
 
-    * AXI write protection type selection
-    * (OFFSET, MASK, VALUE)      (0XFF240000, 0x00000FFFU ,0x00000492U)
+    * epi polytrim
+    * (OFFSET, MASK, VALUE)      (0XFD409940, 0x000000FFU ,0x000000F7U)
     */
-	PSU_Mask_Write(IOU_SECURE_SLCR_IOU_AXI_WPRTCN_OFFSET,
-		0x00000FFFU, 0x00000492U);
+	PSU_Mask_Write(SERDES_L2_TM_E_ILL8_OFFSET, 0x000000FFU, 0x000000F7U);
 /*##################################################################### */
 
     /*
-    * QSPI TZ
-    */
-    /*
-    * Register : IOU_AXI_WPRTCN @ 0XFF240000
+    * Register : L2_TM_E_ILL9 @ 0XFD409944
 
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_QSPI_AXI_AWPROT          2
+    * bypass E polytrim
+    *  PSU_SERDES_L2_TM_E_ILL9_ILL_BYPASS_E_POLYTIM                0x1
 
-    * AXI write protection type selection
-    * (OFFSET, MASK, VALUE)      (0XFF240000, 0x0E000000U ,0x04000000U)
+    * enables for lf,constant gm trim and polytirm
+    * (OFFSET, MASK, VALUE)      (0XFD409944, 0x00000001U ,0x00000001U)
     */
-	PSU_Mask_Write(IOU_SECURE_SLCR_IOU_AXI_WPRTCN_OFFSET,
-		0x0E000000U, 0x04000000U);
+	PSU_Mask_Write(SERDES_L2_TM_E_ILL9_OFFSET, 0x00000001U, 0x00000001U);
 /*##################################################################### */
 
     /*
-    * NAND TZ
-    */
-    /*
-    * Register : IOU_AXI_RPRTCN @ 0XFF240004
+    * Register : L2_TM_ILL13 @ 0XFD409994
 
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_RPRTCN_NAND_AXI_ARPROT          2
+    * ILL cal idle val refcnt
+    *  PSU_SERDES_L2_TM_ILL13_ILL_CAL_IDLE_VAL_REFCNT              0x7
 
-    * AXI read protection type selection
-    * (OFFSET, MASK, VALUE)      (0XFF240004, 0x01C00000U ,0x00800000U)
+    * ill cal idle value count
+    * (OFFSET, MASK, VALUE)      (0XFD409994, 0x00000007U ,0x00000007U)
     */
-	PSU_Mask_Write(IOU_SECURE_SLCR_IOU_AXI_RPRTCN_OFFSET,
-		0x01C00000U, 0x00800000U);
+	PSU_Mask_Write(SERDES_L2_TM_ILL13_OFFSET, 0x00000007U, 0x00000007U);
 /*##################################################################### */
 
     /*
-    * Register : IOU_AXI_WPRTCN @ 0XFF240000
+    * Register : L3_TM_MISC2 @ 0XFD40D89C
 
-    * AXI protection [0] = '0' : Normal access [0] = '1' : Previleged access [
-    * 1] = '0' : Secure access [1] = '1' : No secure access [2] = '0' : Data a
-    * ccess [2] = '1'' : Instruction access
-    *  PSU_IOU_SECURE_SLCR_IOU_AXI_WPRTCN_NAND_AXI_AWPROT          2
+    * ILL calib counts BYPASSED with calcode bits
+    *  PSU_SERDES_L3_TM_MISC2_ILL_CAL_BYPASS_COUNTS                0x1
 
-    * AXI write protection type selection
-    * (OFFSET, MASK, VALUE)      (0XFF240000, 0x01C00000U ,0x00800000U)
+    * sampler cal
+    * (OFFSET, MASK, VALUE)      (0XFD40D89C, 0x00000080U ,0x00000080U)
     */
-	PSU_Mask_Write(IOU_SECURE_SLCR_IOU_AXI_WPRTCN_OFFSET,
-		0x01C00000U, 0x00800000U);
+	PSU_Mask_Write(SERDES_L3_TM_MISC2_OFFSET, 0x00000080U, 0x00000080U);
 /*##################################################################### */
 
     /*
-    * DMA TZ
+    * Register : L3_TM_IQ_ILL1 @ 0XFD40D8F8
+
+    * IQ ILL F0 CALCODE bypass value. MPHY : G1a, PCIE : Gen 1, SATA : Gen1 ,
+    * USB3 : SS
+    *  PSU_SERDES_L3_TM_IQ_ILL1_ILL_BYPASS_IQ_CALCODE_F0           0x7D
+
+    * iqpi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD40D8F8, 0x000000FFU ,0x0000007DU)
     */
+	PSU_Mask_Write(SERDES_L3_TM_IQ_ILL1_OFFSET,
+		0x000000FFU, 0x0000007DU);
+/*##################################################################### */
+
     /*
-    * Register : slcr_adma @ 0XFF4B0024
+    * Register : L3_TM_IQ_ILL2 @ 0XFD40D8FC
 
-    * TrustZone Classification for ADMA
-    *  PSU_LPD_SLCR_SECURE_SLCR_ADMA_TZ                            0xFF
+    * IQ ILL F1 CALCODE bypass value. MPHY : G1b, PCIE : Gen2, SATA: Gen2
+    *  PSU_SERDES_L3_TM_IQ_ILL2_ILL_BYPASS_IQ_CALCODE_F1           0x7D
 
-    * RPU TrustZone settings
-    * (OFFSET, MASK, VALUE)      (0XFF4B0024, 0x000000FFU ,0x000000FFU)
+    * iqpi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD40D8FC, 0x000000FFU ,0x0000007DU)
     */
-	PSU_Mask_Write(LPD_SLCR_SECURE_SLCR_ADMA_OFFSET,
-		0x000000FFU, 0x000000FFU);
+	PSU_Mask_Write(SERDES_L3_TM_IQ_ILL2_OFFSET,
+		0x000000FFU, 0x0000007DU);
 /*##################################################################### */
 
     /*
-    * Register : slcr_gdma @ 0XFD690050
+    * Register : L3_TM_ILL12 @ 0XFD40D990
 
-    * TrustZone Classification for GDMA
-    *  PSU_FPD_SLCR_SECURE_SLCR_GDMA_TZ                            0xFF
+    * G1A pll ctr bypass value
+    *  PSU_SERDES_L3_TM_ILL12_G1A_PLL_CTR_BYP_VAL                  0x1
 
-    * GDMA Trustzone Settings
-    * (OFFSET, MASK, VALUE)      (0XFD690050, 0x000000FFU ,0x000000FFU)
+    * ill pll counter values
+    * (OFFSET, MASK, VALUE)      (0XFD40D990, 0x000000FFU ,0x00000001U)
     */
-	PSU_Mask_Write(FPD_SLCR_SECURE_SLCR_GDMA_OFFSET,
-		0x000000FFU, 0x000000FFU);
+	PSU_Mask_Write(SERDES_L3_TM_ILL12_OFFSET, 0x000000FFU, 0x00000001U);
 /*##################################################################### */
 
-
-	return 1;
-}
-unsigned long psu_serdes_init_data(void)
-{
     /*
-    * SERDES INITIALIZATION
+    * Register : L3_TM_E_ILL1 @ 0XFD40D924
+
+    * E ILL F0 CALCODE bypass value. MPHY : G1a, PCIE : Gen 1, SATA : Gen1 , U
+    * SB3 : SS
+    *  PSU_SERDES_L3_TM_E_ILL1_ILL_BYPASS_E_CALCODE_F0             0x9C
+
+    * epi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD40D924, 0x000000FFU ,0x0000009CU)
     */
+	PSU_Mask_Write(SERDES_L3_TM_E_ILL1_OFFSET, 0x000000FFU, 0x0000009CU);
+/*##################################################################### */
+
     /*
-    * GT REFERENCE CLOCK SOURCE SELECTION
+    * Register : L3_TM_E_ILL2 @ 0XFD40D928
+
+    * E ILL F1 CALCODE bypass value. MPHY : G1b, PCIE : Gen2, SATA: Gen2
+    *  PSU_SERDES_L3_TM_E_ILL2_ILL_BYPASS_E_CALCODE_F1             0x39
+
+    * epi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD40D928, 0x000000FFU ,0x00000039U)
     */
+	PSU_Mask_Write(SERDES_L3_TM_E_ILL2_OFFSET, 0x000000FFU, 0x00000039U);
+/*##################################################################### */
+
     /*
-    * Register : PLL_REF_SEL0 @ 0XFD410000
+    * Register : L3_TM_ILL11 @ 0XFD40D98C
 
-    * PLL0 Reference Selection. 0x0 - 5MHz, 0x1 - 9.6MHz, 0x2 - 10MHz, 0x3 - 1
-    * 2MHz, 0x4 - 13MHz, 0x5 - 19.2MHz, 0x6 - 20MHz, 0x7 - 24MHz, 0x8 - 26MHz,
-    *  0x9 - 27MHz, 0xA - 38.4MHz, 0xB - 40MHz, 0xC - 52MHz, 0xD - 100MHz, 0xE
-    *  - 108MHz, 0xF - 125MHz, 0x10 - 135MHz, 0x11 - 150 MHz. 0x12 to 0x1F - R
-    * eserved
-    *  PSU_SERDES_PLL_REF_SEL0_PLLREFSEL0                          0xD
+    * G2A_PCIe1 PLL ctr bypass value
+    *  PSU_SERDES_L3_TM_ILL11_G2A_PCIEG1_PLL_CTR_11_8_BYP_VAL      0x2
 
-    * PLL0 Reference Selection Register
-    * (OFFSET, MASK, VALUE)      (0XFD410000, 0x0000001FU ,0x0000000DU)
+    * ill pll counter values
+    * (OFFSET, MASK, VALUE)      (0XFD40D98C, 0x000000F0U ,0x00000020U)
     */
-	PSU_Mask_Write(SERDES_PLL_REF_SEL0_OFFSET, 0x0000001FU, 0x0000000DU);
+	PSU_Mask_Write(SERDES_L3_TM_ILL11_OFFSET, 0x000000F0U, 0x00000020U);
 /*##################################################################### */
 
     /*
-    * Register : PLL_REF_SEL1 @ 0XFD410004
+    * Register : L3_TM_IQ_ILL3 @ 0XFD40D900
 
-    * PLL1 Reference Selection. 0x0 - 5MHz, 0x1 - 9.6MHz, 0x2 - 10MHz, 0x3 - 1
-    * 2MHz, 0x4 - 13MHz, 0x5 - 19.2MHz, 0x6 - 20MHz, 0x7 - 24MHz, 0x8 - 26MHz,
-    *  0x9 - 27MHz, 0xA - 38.4MHz, 0xB - 40MHz, 0xC - 52MHz, 0xD - 100MHz, 0xE
-    *  - 108MHz, 0xF - 125MHz, 0x10 - 135MHz, 0x11 - 150 MHz. 0x12 to 0x1F - R
-    * eserved
-    *  PSU_SERDES_PLL_REF_SEL1_PLLREFSEL1                          0x9
+    * IQ ILL F2CALCODE bypass value. MPHY : G2a, SATA : Gen3
+    *  PSU_SERDES_L3_TM_IQ_ILL3_ILL_BYPASS_IQ_CALCODE_F2           0x7D
 
-    * PLL1 Reference Selection Register
-    * (OFFSET, MASK, VALUE)      (0XFD410004, 0x0000001FU ,0x00000009U)
+    * iqpi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD40D900, 0x000000FFU ,0x0000007DU)
     */
-	PSU_Mask_Write(SERDES_PLL_REF_SEL1_OFFSET, 0x0000001FU, 0x00000009U);
+	PSU_Mask_Write(SERDES_L3_TM_IQ_ILL3_OFFSET,
+		0x000000FFU, 0x0000007DU);
 /*##################################################################### */
 
     /*
-    * Register : PLL_REF_SEL2 @ 0XFD410008
+    * Register : L3_TM_E_ILL3 @ 0XFD40D92C
 
-    * PLL2 Reference Selection. 0x0 - 5MHz, 0x1 - 9.6MHz, 0x2 - 10MHz, 0x3 - 1
-    * 2MHz, 0x4 - 13MHz, 0x5 - 19.2MHz, 0x6 - 20MHz, 0x7 - 24MHz, 0x8 - 26MHz,
-    *  0x9 - 27MHz, 0xA - 38.4MHz, 0xB - 40MHz, 0xC - 52MHz, 0xD - 100MHz, 0xE
-    *  - 108MHz, 0xF - 125MHz, 0x10 - 135MHz, 0x11 - 150 MHz. 0x12 to 0x1F - R
-    * eserved
-    *  PSU_SERDES_PLL_REF_SEL2_PLLREFSEL2                          0x8
+    * E ILL F2CALCODE bypass value. MPHY : G2a, SATA : Gen3
+    *  PSU_SERDES_L3_TM_E_ILL3_ILL_BYPASS_E_CALCODE_F2             0x64
 
-    * PLL2 Reference Selection Register
-    * (OFFSET, MASK, VALUE)      (0XFD410008, 0x0000001FU ,0x00000008U)
+    * epi cal code
+    * (OFFSET, MASK, VALUE)      (0XFD40D92C, 0x000000FFU ,0x00000064U)
     */
-	PSU_Mask_Write(SERDES_PLL_REF_SEL2_OFFSET, 0x0000001FU, 0x00000008U);
+	PSU_Mask_Write(SERDES_L3_TM_E_ILL3_OFFSET, 0x000000FFU, 0x00000064U);
 /*##################################################################### */
 
     /*
-    * Register : PLL_REF_SEL3 @ 0XFD41000C
+    * Register : L3_TM_ILL8 @ 0XFD40D980
 
-    * PLL3 Reference Selection. 0x0 - 5MHz, 0x1 - 9.6MHz, 0x2 - 10MHz, 0x3 - 1
-    * 2MHz, 0x4 - 13MHz, 0x5 - 19.2MHz, 0x6 - 20MHz, 0x7 - 24MHz, 0x8 - 26MHz,
-    *  0x9 - 27MHz, 0xA - 38.4MHz, 0xB - 40MHz, 0xC - 52MHz, 0xD - 100MHz, 0xE
-    *  - 108MHz, 0xF - 125MHz, 0x10 - 135MHz, 0x11 - 150 MHz. 0x12 to 0x1F - R
-    * eserved
-    *  PSU_SERDES_PLL_REF_SEL3_PLLREFSEL3                          0xF
+    * ILL calibration code change wait time
+    *  PSU_SERDES_L3_TM_ILL8_ILL_CAL_ITER_WAIT                     0xFF
 
-    * PLL3 Reference Selection Register
-    * (OFFSET, MASK, VALUE)      (0XFD41000C, 0x0000001FU ,0x0000000FU)
+    * ILL cal routine control
+    * (OFFSET, MASK, VALUE)      (0XFD40D980, 0x000000FFU ,0x000000FFU)
     */
-	PSU_Mask_Write(SERDES_PLL_REF_SEL3_OFFSET, 0x0000001FU, 0x0000000FU);
+	PSU_Mask_Write(SERDES_L3_TM_ILL8_OFFSET, 0x000000FFU, 0x000000FFU);
 /*##################################################################### */
 
     /*
-    * GT REFERENCE CLOCK FREQUENCY SELECTION
+    * Register : L3_TM_IQ_ILL8 @ 0XFD40D914
+
+    * IQ ILL polytrim bypass value
+    *  PSU_SERDES_L3_TM_IQ_ILL8_ILL_BYPASS_IQ_POLYTRIM_VAL         0xF7
+
+    * iqpi polytrim
+    * (OFFSET, MASK, VALUE)      (0XFD40D914, 0x000000FFU ,0x000000F7U)
     */
+	PSU_Mask_Write(SERDES_L3_TM_IQ_ILL8_OFFSET,
+		0x000000FFU, 0x000000F7U);
+/*##################################################################### */
+
     /*
-    * Register : L0_L0_REF_CLK_SEL @ 0XFD402860
+    * Register : L3_TM_IQ_ILL9 @ 0XFD40D918
 
-    * Sel of lane 0 ref clock local mux. Set to 1 to select lane 0 slicer outp
-    * ut. Set to 0 to select lane0 ref clock mux output.
-    *  PSU_SERDES_L0_L0_REF_CLK_SEL_L0_REF_CLK_LCL_SEL             0x1
+    * bypass IQ polytrim
+    *  PSU_SERDES_L3_TM_IQ_ILL9_ILL_BYPASS_IQ_POLYTIM              0x1
 
-    * Lane0 Ref Clock Selection Register
-    * (OFFSET, MASK, VALUE)      (0XFD402860, 0x00000080U ,0x00000080U)
+    * enables for lf,constant gm trim and polytirm
+    * (OFFSET, MASK, VALUE)      (0XFD40D918, 0x00000001U ,0x00000001U)
     */
-	PSU_Mask_Write(SERDES_L0_L0_REF_CLK_SEL_OFFSET,
-		0x00000080U, 0x00000080U);
+	PSU_Mask_Write(SERDES_L3_TM_IQ_ILL9_OFFSET,
+		0x00000001U, 0x00000001U);
 /*##################################################################### */
 
     /*
-    * Register : L0_L1_REF_CLK_SEL @ 0XFD402864
-
-    * Sel of lane 1 ref clock local mux. Set to 1 to select lane 1 slicer outp
-    * ut. Set to 0 to select lane1 ref clock mux output.
-    *  PSU_SERDES_L0_L1_REF_CLK_SEL_L1_REF_CLK_LCL_SEL             0x0
+    * Register : L3_TM_E_ILL8 @ 0XFD40D940
 
-    * Bit 3 of lane 1 ref clock mux one hot sel. Set to 1 to select lane 3 sli
-    * cer output from ref clock network
-    *  PSU_SERDES_L0_L1_REF_CLK_SEL_L1_REF_CLK_SEL_3               0x1
+    * E ILL polytrim bypass value
+    *  PSU_SERDES_L3_TM_E_ILL8_ILL_BYPASS_E_POLYTRIM_VAL           0xF7
 
-    * Lane1 Ref Clock Selection Register
-    * (OFFSET, MASK, VALUE)      (0XFD402864, 0x00000088U ,0x00000008U)
+    * epi polytrim
+    * (OFFSET, MASK, VALUE)      (0XFD40D940, 0x000000FFU ,0x000000F7U)
     */
-	PSU_Mask_Write(SERDES_L0_L1_REF_CLK_SEL_OFFSET,
-		0x00000088U, 0x00000008U);
+	PSU_Mask_Write(SERDES_L3_TM_E_ILL8_OFFSET, 0x000000FFU, 0x000000F7U);
 /*##################################################################### */
 
     /*
-    * Register : L0_L2_REF_CLK_SEL @ 0XFD402868
+    * Register : L3_TM_E_ILL9 @ 0XFD40D944
 
-    * Sel of lane 2 ref clock local mux. Set to 1 to select lane 1 slicer outp
-    * ut. Set to 0 to select lane2 ref clock mux output.
-    *  PSU_SERDES_L0_L2_REF_CLK_SEL_L2_REF_CLK_LCL_SEL             0x1
+    * bypass E polytrim
+    *  PSU_SERDES_L3_TM_E_ILL9_ILL_BYPASS_E_POLYTIM                0x1
 
-    * Lane2 Ref Clock Selection Register
-    * (OFFSET, MASK, VALUE)      (0XFD402868, 0x00000080U ,0x00000080U)
+    * enables for lf,constant gm trim and polytirm
+    * (OFFSET, MASK, VALUE)      (0XFD40D944, 0x00000001U ,0x00000001U)
     */
-	PSU_Mask_Write(SERDES_L0_L2_REF_CLK_SEL_OFFSET,
-		0x00000080U, 0x00000080U);
+	PSU_Mask_Write(SERDES_L3_TM_E_ILL9_OFFSET, 0x00000001U, 0x00000001U);
 /*##################################################################### */
 
     /*
-    * Register : L0_L3_REF_CLK_SEL @ 0XFD40286C
-
-    * Sel of lane 3 ref clock local mux. Set to 1 to select lane 3 slicer outp
-    * ut. Set to 0 to select lane3 ref clock mux output.
-    *  PSU_SERDES_L0_L3_REF_CLK_SEL_L3_REF_CLK_LCL_SEL             0x0
+    * Register : L3_TM_ILL13 @ 0XFD40D994
 
-    * Bit 1 of lane 3 ref clock mux one hot sel. Set to 1 to select lane 1 sli
-    * cer output from ref clock network
-    *  PSU_SERDES_L0_L3_REF_CLK_SEL_L3_REF_CLK_SEL_1               0x1
+    * ILL cal idle val refcnt
+    *  PSU_SERDES_L3_TM_ILL13_ILL_CAL_IDLE_VAL_REFCNT              0x7
 
-    * Lane3 Ref Clock Selection Register
-    * (OFFSET, MASK, VALUE)      (0XFD40286C, 0x00000082U ,0x00000002U)
+    * ill cal idle value count
+    * (OFFSET, MASK, VALUE)      (0XFD40D994, 0x00000007U ,0x00000007U)
     */
-	PSU_Mask_Write(SERDES_L0_L3_REF_CLK_SEL_OFFSET,
-		0x00000082U, 0x00000002U);
+	PSU_Mask_Write(SERDES_L3_TM_ILL13_OFFSET, 0x00000007U, 0x00000007U);
 /*##################################################################### */
 
     /*
-    * ENABLE SPREAD SPECTRUM
+    * SYMBOL LOCK AND WAIT
     */
     /*
-    * Register : L2_TM_PLL_DIG_37 @ 0XFD40A094
+    * Register : L0_TM_DIG_10 @ 0XFD40107C
 
-    * Enable/Disable coarse code satureation limiting logic
-    *  PSU_SERDES_L2_TM_PLL_DIG_37_TM_ENABLE_COARSE_SATURATION     0x1
+    * CDR lock wait time. (1-16 us). cdr_lock_wait_time = 4'b xxxx + 4'b 0001
+    *  PSU_SERDES_L0_TM_DIG_10_CDR_BIT_LOCK_TIME                   0x1
 
-    * Test mode register 37
-    * (OFFSET, MASK, VALUE)      (0XFD40A094, 0x00000010U ,0x00000010U)
+    * test control for changing cdr lock wait time
+    * (OFFSET, MASK, VALUE)      (0XFD40107C, 0x0000000FU ,0x00000001U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_PLL_DIG_37_OFFSET,
-		0x00000010U, 0x00000010U);
+	PSU_Mask_Write(SERDES_L0_TM_DIG_10_OFFSET, 0x0000000FU, 0x00000001U);
 /*##################################################################### */
 
     /*
-    * Register : L2_PLL_SS_STEPS_0_LSB @ 0XFD40A368
+    * Register : L1_TM_DIG_10 @ 0XFD40507C
 
-    * Spread Spectrum No of Steps [7:0]
-    *  PSU_SERDES_L2_PLL_SS_STEPS_0_LSB_SS_NUM_OF_STEPS_0_LSB      0x38
+    * CDR lock wait time. (1-16 us). cdr_lock_wait_time = 4'b xxxx + 4'b 0001
+    *  PSU_SERDES_L1_TM_DIG_10_CDR_BIT_LOCK_TIME                   0x1
 
-    * Spread Spectrum No of Steps bits 7:0
-    * (OFFSET, MASK, VALUE)      (0XFD40A368, 0x000000FFU ,0x00000038U)
+    * test control for changing cdr lock wait time
+    * (OFFSET, MASK, VALUE)      (0XFD40507C, 0x0000000FU ,0x00000001U)
     */
-	PSU_Mask_Write(SERDES_L2_PLL_SS_STEPS_0_LSB_OFFSET,
-		0x000000FFU, 0x00000038U);
+	PSU_Mask_Write(SERDES_L1_TM_DIG_10_OFFSET, 0x0000000FU, 0x00000001U);
 /*##################################################################### */
 
     /*
-    * Register : L2_PLL_SS_STEPS_1_MSB @ 0XFD40A36C
+    * Register : L2_TM_DIG_10 @ 0XFD40907C
 
-    * Spread Spectrum No of Steps [10:8]
-    *  PSU_SERDES_L2_PLL_SS_STEPS_1_MSB_SS_NUM_OF_STEPS_1_MSB      0x03
+    * CDR lock wait time. (1-16 us). cdr_lock_wait_time = 4'b xxxx + 4'b 0001
+    *  PSU_SERDES_L2_TM_DIG_10_CDR_BIT_LOCK_TIME                   0x1
 
-    * Spread Spectrum No of Steps bits 10:8
-    * (OFFSET, MASK, VALUE)      (0XFD40A36C, 0x00000007U ,0x00000003U)
+    * test control for changing cdr lock wait time
+    * (OFFSET, MASK, VALUE)      (0XFD40907C, 0x0000000FU ,0x00000001U)
     */
-	PSU_Mask_Write(SERDES_L2_PLL_SS_STEPS_1_MSB_OFFSET,
-		0x00000007U, 0x00000003U);
+	PSU_Mask_Write(SERDES_L2_TM_DIG_10_OFFSET, 0x0000000FU, 0x00000001U);
 /*##################################################################### */
 
     /*
-    * Register : L3_PLL_SS_STEPS_0_LSB @ 0XFD40E368
+    * Register : L3_TM_DIG_10 @ 0XFD40D07C
 
-    * Spread Spectrum No of Steps [7:0]
-    *  PSU_SERDES_L3_PLL_SS_STEPS_0_LSB_SS_NUM_OF_STEPS_0_LSB      0xE0
+    * CDR lock wait time. (1-16 us). cdr_lock_wait_time = 4'b xxxx + 4'b 0001
+    *  PSU_SERDES_L3_TM_DIG_10_CDR_BIT_LOCK_TIME                   0x1
 
-    * Spread Spectrum No of Steps bits 7:0
-    * (OFFSET, MASK, VALUE)      (0XFD40E368, 0x000000FFU ,0x000000E0U)
+    * test control for changing cdr lock wait time
+    * (OFFSET, MASK, VALUE)      (0XFD40D07C, 0x0000000FU ,0x00000001U)
     */
-	PSU_Mask_Write(SERDES_L3_PLL_SS_STEPS_0_LSB_OFFSET,
-		0x000000FFU, 0x000000E0U);
+	PSU_Mask_Write(SERDES_L3_TM_DIG_10_OFFSET, 0x0000000FU, 0x00000001U);
 /*##################################################################### */
 
     /*
-    * Register : L3_PLL_SS_STEPS_1_MSB @ 0XFD40E36C
+    * SIOU SETTINGS FOR BYPASS CONTROL,HSRX-DIG
+    */
+    /*
+    * Register : L0_TM_RST_DLY @ 0XFD4019A4
 
-    * Spread Spectrum No of Steps [10:8]
-    *  PSU_SERDES_L3_PLL_SS_STEPS_1_MSB_SS_NUM_OF_STEPS_1_MSB      0x3
+    * Delay apb reset by specified amount
+    *  PSU_SERDES_L0_TM_RST_DLY_APB_RST_DLY                        0xFF
 
-    * Spread Spectrum No of Steps bits 10:8
-    * (OFFSET, MASK, VALUE)      (0XFD40E36C, 0x00000007U ,0x00000003U)
+    * reset delay for apb reset w.r.t pso of hsrx
+    * (OFFSET, MASK, VALUE)      (0XFD4019A4, 0x000000FFU ,0x000000FFU)
     */
-	PSU_Mask_Write(SERDES_L3_PLL_SS_STEPS_1_MSB_OFFSET,
-		0x00000007U, 0x00000003U);
+	PSU_Mask_Write(SERDES_L0_TM_RST_DLY_OFFSET,
+		0x000000FFU, 0x000000FFU);
 /*##################################################################### */
 
     /*
-    * Register : L1_PLL_SS_STEPS_0_LSB @ 0XFD406368
+    * Register : L0_TM_ANA_BYP_15 @ 0XFD401038
 
-    * Spread Spectrum No of Steps [7:0]
-    *  PSU_SERDES_L1_PLL_SS_STEPS_0_LSB_SS_NUM_OF_STEPS_0_LSB      0x58
+    * Enable Bypass for <7> of TM_ANA_BYPS_15
+    *  PSU_SERDES_L0_TM_ANA_BYP_15_FORCE_UPHY_ENABLE_LOW_LEAKAGE   0x1
 
-    * Spread Spectrum No of Steps bits 7:0
-    * (OFFSET, MASK, VALUE)      (0XFD406368, 0x000000FFU ,0x00000058U)
+    * Bypass control for pcs-pma interface. EQ supplies, main master supply an
+    * d ps for samp c2c
+    * (OFFSET, MASK, VALUE)      (0XFD401038, 0x00000040U ,0x00000040U)
     */
-	PSU_Mask_Write(SERDES_L1_PLL_SS_STEPS_0_LSB_OFFSET,
-		0x000000FFU, 0x00000058U);
+	PSU_Mask_Write(SERDES_L0_TM_ANA_BYP_15_OFFSET,
+		0x00000040U, 0x00000040U);
 /*##################################################################### */
 
     /*
-    * Register : L1_PLL_SS_STEPS_1_MSB @ 0XFD40636C
+    * Register : L0_TM_ANA_BYP_12 @ 0XFD40102C
 
-    * Spread Spectrum No of Steps [10:8]
-    *  PSU_SERDES_L1_PLL_SS_STEPS_1_MSB_SS_NUM_OF_STEPS_1_MSB      0x3
+    * Enable Bypass for <7> of TM_ANA_BYPS_12
+    *  PSU_SERDES_L0_TM_ANA_BYP_12_FORCE_UPHY_PSO_HSRXDIG          0x1
 
-    * Spread Spectrum No of Steps bits 10:8
-    * (OFFSET, MASK, VALUE)      (0XFD40636C, 0x00000007U ,0x00000003U)
+    * Bypass control for pcs-pma interface. Hsrx supply, hsrx des, and cdr ena
+    * ble controls
+    * (OFFSET, MASK, VALUE)      (0XFD40102C, 0x00000040U ,0x00000040U)
     */
-	PSU_Mask_Write(SERDES_L1_PLL_SS_STEPS_1_MSB_OFFSET,
-		0x00000007U, 0x00000003U);
+	PSU_Mask_Write(SERDES_L0_TM_ANA_BYP_12_OFFSET,
+		0x00000040U, 0x00000040U);
 /*##################################################################### */
 
     /*
-    * Register : L1_PLL_SS_STEP_SIZE_0_LSB @ 0XFD406370
+    * Register : L1_TM_RST_DLY @ 0XFD4059A4
 
-    * Step Size for Spread Spectrum [7:0]
-    *  PSU_SERDES_L1_PLL_SS_STEP_SIZE_0_LSB_SS_STEP_SIZE_0_LSB     0x7C
+    * Delay apb reset by specified amount
+    *  PSU_SERDES_L1_TM_RST_DLY_APB_RST_DLY                        0xFF
 
-    * Step Size for Spread Spectrum LSB
-    * (OFFSET, MASK, VALUE)      (0XFD406370, 0x000000FFU ,0x0000007CU)
+    * reset delay for apb reset w.r.t pso of hsrx
+    * (OFFSET, MASK, VALUE)      (0XFD4059A4, 0x000000FFU ,0x000000FFU)
     */
-	PSU_Mask_Write(SERDES_L1_PLL_SS_STEP_SIZE_0_LSB_OFFSET,
-		0x000000FFU, 0x0000007CU);
+	PSU_Mask_Write(SERDES_L1_TM_RST_DLY_OFFSET,
+		0x000000FFU, 0x000000FFU);
 /*##################################################################### */
 
     /*
-    * Register : L1_PLL_SS_STEP_SIZE_1 @ 0XFD406374
+    * Register : L1_TM_ANA_BYP_15 @ 0XFD405038
 
-    * Step Size for Spread Spectrum [15:8]
-    *  PSU_SERDES_L1_PLL_SS_STEP_SIZE_1_SS_STEP_SIZE_1             0x33
+    * Enable Bypass for <7> of TM_ANA_BYPS_15
+    *  PSU_SERDES_L1_TM_ANA_BYP_15_FORCE_UPHY_ENABLE_LOW_LEAKAGE   0x1
 
-    * Step Size for Spread Spectrum 1
-    * (OFFSET, MASK, VALUE)      (0XFD406374, 0x000000FFU ,0x00000033U)
+    * Bypass control for pcs-pma interface. EQ supplies, main master supply an
+    * d ps for samp c2c
+    * (OFFSET, MASK, VALUE)      (0XFD405038, 0x00000040U ,0x00000040U)
     */
-	PSU_Mask_Write(SERDES_L1_PLL_SS_STEP_SIZE_1_OFFSET,
-		0x000000FFU, 0x00000033U);
+	PSU_Mask_Write(SERDES_L1_TM_ANA_BYP_15_OFFSET,
+		0x00000040U, 0x00000040U);
 /*##################################################################### */
 
     /*
-    * Register : L1_PLL_SS_STEP_SIZE_2 @ 0XFD406378
+    * Register : L1_TM_ANA_BYP_12 @ 0XFD40502C
 
-    * Step Size for Spread Spectrum [23:16]
-    *  PSU_SERDES_L1_PLL_SS_STEP_SIZE_2_SS_STEP_SIZE_2             0x2
+    * Enable Bypass for <7> of TM_ANA_BYPS_12
+    *  PSU_SERDES_L1_TM_ANA_BYP_12_FORCE_UPHY_PSO_HSRXDIG          0x1
 
-    * Step Size for Spread Spectrum 2
-    * (OFFSET, MASK, VALUE)      (0XFD406378, 0x000000FFU ,0x00000002U)
+    * Bypass control for pcs-pma interface. Hsrx supply, hsrx des, and cdr ena
+    * ble controls
+    * (OFFSET, MASK, VALUE)      (0XFD40502C, 0x00000040U ,0x00000040U)
     */
-	PSU_Mask_Write(SERDES_L1_PLL_SS_STEP_SIZE_2_OFFSET,
-		0x000000FFU, 0x00000002U);
+	PSU_Mask_Write(SERDES_L1_TM_ANA_BYP_12_OFFSET,
+		0x00000040U, 0x00000040U);
 /*##################################################################### */
 
     /*
-    * Register : L1_PLL_SS_STEP_SIZE_3_MSB @ 0XFD40637C
-
-    * Step Size for Spread Spectrum [25:24]
-    *  PSU_SERDES_L1_PLL_SS_STEP_SIZE_3_MSB_SS_STEP_SIZE_3_MSB     0x0
-
-    * Enable/Disable test mode force on SS step size
-    *  PSU_SERDES_L1_PLL_SS_STEP_SIZE_3_MSB_FORCE_SS_STEP_SIZE     0x1
+    * Register : L2_TM_RST_DLY @ 0XFD4099A4
 
-    * Enable/Disable test mode force on SS no of steps
-    *  PSU_SERDES_L1_PLL_SS_STEP_SIZE_3_MSB_FORCE_SS_NUM_OF_STEPS  0x1
+    * Delay apb reset by specified amount
+    *  PSU_SERDES_L2_TM_RST_DLY_APB_RST_DLY                        0xFF
 
-    * Enable force on enable Spread Spectrum
-    * (OFFSET, MASK, VALUE)      (0XFD40637C, 0x00000033U ,0x00000030U)
+    * reset delay for apb reset w.r.t pso of hsrx
+    * (OFFSET, MASK, VALUE)      (0XFD4099A4, 0x000000FFU ,0x000000FFU)
     */
-	PSU_Mask_Write(SERDES_L1_PLL_SS_STEP_SIZE_3_MSB_OFFSET,
-		0x00000033U, 0x00000030U);
+	PSU_Mask_Write(SERDES_L2_TM_RST_DLY_OFFSET,
+		0x000000FFU, 0x000000FFU);
 /*##################################################################### */
 
     /*
-    * Register : L2_PLL_SS_STEP_SIZE_0_LSB @ 0XFD40A370
+    * Register : L2_TM_ANA_BYP_15 @ 0XFD409038
 
-    * Step Size for Spread Spectrum [7:0]
-    *  PSU_SERDES_L2_PLL_SS_STEP_SIZE_0_LSB_SS_STEP_SIZE_0_LSB     0xF4
+    * Enable Bypass for <7> of TM_ANA_BYPS_15
+    *  PSU_SERDES_L2_TM_ANA_BYP_15_FORCE_UPHY_ENABLE_LOW_LEAKAGE   0x1
 
-    * Step Size for Spread Spectrum LSB
-    * (OFFSET, MASK, VALUE)      (0XFD40A370, 0x000000FFU ,0x000000F4U)
+    * Bypass control for pcs-pma interface. EQ supplies, main master supply an
+    * d ps for samp c2c
+    * (OFFSET, MASK, VALUE)      (0XFD409038, 0x00000040U ,0x00000040U)
     */
-	PSU_Mask_Write(SERDES_L2_PLL_SS_STEP_SIZE_0_LSB_OFFSET,
-		0x000000FFU, 0x000000F4U);
+	PSU_Mask_Write(SERDES_L2_TM_ANA_BYP_15_OFFSET,
+		0x00000040U, 0x00000040U);
 /*##################################################################### */
 
     /*
-    * Register : L2_PLL_SS_STEP_SIZE_1 @ 0XFD40A374
+    * Register : L2_TM_ANA_BYP_12 @ 0XFD40902C
 
-    * Step Size for Spread Spectrum [15:8]
-    *  PSU_SERDES_L2_PLL_SS_STEP_SIZE_1_SS_STEP_SIZE_1             0x31
+    * Enable Bypass for <7> of TM_ANA_BYPS_12
+    *  PSU_SERDES_L2_TM_ANA_BYP_12_FORCE_UPHY_PSO_HSRXDIG          0x1
 
-    * Step Size for Spread Spectrum 1
-    * (OFFSET, MASK, VALUE)      (0XFD40A374, 0x000000FFU ,0x00000031U)
+    * Bypass control for pcs-pma interface. Hsrx supply, hsrx des, and cdr ena
+    * ble controls
+    * (OFFSET, MASK, VALUE)      (0XFD40902C, 0x00000040U ,0x00000040U)
     */
-	PSU_Mask_Write(SERDES_L2_PLL_SS_STEP_SIZE_1_OFFSET,
-		0x000000FFU, 0x00000031U);
+	PSU_Mask_Write(SERDES_L2_TM_ANA_BYP_12_OFFSET,
+		0x00000040U, 0x00000040U);
 /*##################################################################### */
 
     /*
-    * Register : L2_PLL_SS_STEP_SIZE_2 @ 0XFD40A378
+    * Register : L3_TM_RST_DLY @ 0XFD40D9A4
 
-    * Step Size for Spread Spectrum [23:16]
-    *  PSU_SERDES_L2_PLL_SS_STEP_SIZE_2_SS_STEP_SIZE_2             0x2
+    * Delay apb reset by specified amount
+    *  PSU_SERDES_L3_TM_RST_DLY_APB_RST_DLY                        0xFF
 
-    * Step Size for Spread Spectrum 2
-    * (OFFSET, MASK, VALUE)      (0XFD40A378, 0x000000FFU ,0x00000002U)
+    * reset delay for apb reset w.r.t pso of hsrx
+    * (OFFSET, MASK, VALUE)      (0XFD40D9A4, 0x000000FFU ,0x000000FFU)
     */
-	PSU_Mask_Write(SERDES_L2_PLL_SS_STEP_SIZE_2_OFFSET,
-		0x000000FFU, 0x00000002U);
+	PSU_Mask_Write(SERDES_L3_TM_RST_DLY_OFFSET,
+		0x000000FFU, 0x000000FFU);
 /*##################################################################### */
 
     /*
-    * Register : L2_PLL_SS_STEP_SIZE_3_MSB @ 0XFD40A37C
-
-    * Step Size for Spread Spectrum [25:24]
-    *  PSU_SERDES_L2_PLL_SS_STEP_SIZE_3_MSB_SS_STEP_SIZE_3_MSB     0x0
-
-    * Enable/Disable test mode force on SS step size
-    *  PSU_SERDES_L2_PLL_SS_STEP_SIZE_3_MSB_FORCE_SS_STEP_SIZE     0x1
+    * Register : L3_TM_ANA_BYP_15 @ 0XFD40D038
 
-    * Enable/Disable test mode force on SS no of steps
-    *  PSU_SERDES_L2_PLL_SS_STEP_SIZE_3_MSB_FORCE_SS_NUM_OF_STEPS  0x1
+    * Enable Bypass for <7> of TM_ANA_BYPS_15
+    *  PSU_SERDES_L3_TM_ANA_BYP_15_FORCE_UPHY_ENABLE_LOW_LEAKAGE   0x1
 
-    * Enable force on enable Spread Spectrum
-    * (OFFSET, MASK, VALUE)      (0XFD40A37C, 0x00000033U ,0x00000030U)
+    * Bypass control for pcs-pma interface. EQ supplies, main master supply an
+    * d ps for samp c2c
+    * (OFFSET, MASK, VALUE)      (0XFD40D038, 0x00000040U ,0x00000040U)
     */
-	PSU_Mask_Write(SERDES_L2_PLL_SS_STEP_SIZE_3_MSB_OFFSET,
-		0x00000033U, 0x00000030U);
+	PSU_Mask_Write(SERDES_L3_TM_ANA_BYP_15_OFFSET,
+		0x00000040U, 0x00000040U);
 /*##################################################################### */
 
     /*
-    * Register : L3_PLL_SS_STEP_SIZE_0_LSB @ 0XFD40E370
+    * Register : L3_TM_ANA_BYP_12 @ 0XFD40D02C
 
-    * Step Size for Spread Spectrum [7:0]
-    *  PSU_SERDES_L3_PLL_SS_STEP_SIZE_0_LSB_SS_STEP_SIZE_0_LSB     0xC9
+    * Enable Bypass for <7> of TM_ANA_BYPS_12
+    *  PSU_SERDES_L3_TM_ANA_BYP_12_FORCE_UPHY_PSO_HSRXDIG          0x1
 
-    * Step Size for Spread Spectrum LSB
-    * (OFFSET, MASK, VALUE)      (0XFD40E370, 0x000000FFU ,0x000000C9U)
-    */
-	PSU_Mask_Write(SERDES_L3_PLL_SS_STEP_SIZE_0_LSB_OFFSET,
-		0x000000FFU, 0x000000C9U);
+    * Bypass control for pcs-pma interface. Hsrx supply, hsrx des, and cdr ena
+    * ble controls
+    * (OFFSET, MASK, VALUE)      (0XFD40D02C, 0x00000040U ,0x00000040U)
+    */
+	PSU_Mask_Write(SERDES_L3_TM_ANA_BYP_12_OFFSET,
+		0x00000040U, 0x00000040U);
 /*##################################################################### */
 
     /*
-    * Register : L3_PLL_SS_STEP_SIZE_1 @ 0XFD40E374
+    * DISABLE FPL/FFL
+    */
+    /*
+    * Register : L0_TM_MISC3 @ 0XFD4019AC
 
-    * Step Size for Spread Spectrum [15:8]
-    *  PSU_SERDES_L3_PLL_SS_STEP_SIZE_1_SS_STEP_SIZE_1             0xD2
+    * CDR fast phase lock control
+    *  PSU_SERDES_L0_TM_MISC3_CDR_EN_FPL                           0x0
 
-    * Step Size for Spread Spectrum 1
-    * (OFFSET, MASK, VALUE)      (0XFD40E374, 0x000000FFU ,0x000000D2U)
+    * CDR fast frequency lock control
+    *  PSU_SERDES_L0_TM_MISC3_CDR_EN_FFL                           0x0
+
+    * debug bus selection bit, cdr fast phase and freq controls
+    * (OFFSET, MASK, VALUE)      (0XFD4019AC, 0x00000003U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L3_PLL_SS_STEP_SIZE_1_OFFSET,
-		0x000000FFU, 0x000000D2U);
+	PSU_Mask_Write(SERDES_L0_TM_MISC3_OFFSET, 0x00000003U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L3_PLL_SS_STEP_SIZE_2 @ 0XFD40E378
+    * Register : L1_TM_MISC3 @ 0XFD4059AC
 
-    * Step Size for Spread Spectrum [23:16]
-    *  PSU_SERDES_L3_PLL_SS_STEP_SIZE_2_SS_STEP_SIZE_2             0x1
+    * CDR fast phase lock control
+    *  PSU_SERDES_L1_TM_MISC3_CDR_EN_FPL                           0x0
 
-    * Step Size for Spread Spectrum 2
-    * (OFFSET, MASK, VALUE)      (0XFD40E378, 0x000000FFU ,0x00000001U)
+    * CDR fast frequency lock control
+    *  PSU_SERDES_L1_TM_MISC3_CDR_EN_FFL                           0x0
+
+    * debug bus selection bit, cdr fast phase and freq controls
+    * (OFFSET, MASK, VALUE)      (0XFD4059AC, 0x00000003U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L3_PLL_SS_STEP_SIZE_2_OFFSET,
-		0x000000FFU, 0x00000001U);
+	PSU_Mask_Write(SERDES_L1_TM_MISC3_OFFSET, 0x00000003U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L3_PLL_SS_STEP_SIZE_3_MSB @ 0XFD40E37C
-
-    * Step Size for Spread Spectrum [25:24]
-    *  PSU_SERDES_L3_PLL_SS_STEP_SIZE_3_MSB_SS_STEP_SIZE_3_MSB     0x0
-
-    * Enable/Disable test mode force on SS step size
-    *  PSU_SERDES_L3_PLL_SS_STEP_SIZE_3_MSB_FORCE_SS_STEP_SIZE     0x1
+    * Register : L2_TM_MISC3 @ 0XFD4099AC
 
-    * Enable/Disable test mode force on SS no of steps
-    *  PSU_SERDES_L3_PLL_SS_STEP_SIZE_3_MSB_FORCE_SS_NUM_OF_STEPS  0x1
+    * CDR fast phase lock control
+    *  PSU_SERDES_L2_TM_MISC3_CDR_EN_FPL                           0x0
 
-    * Enable test mode forcing on enable Spread Spectrum
-    *  PSU_SERDES_L3_PLL_SS_STEP_SIZE_3_MSB_TM_FORCE_EN_SS         0x1
+    * CDR fast frequency lock control
+    *  PSU_SERDES_L2_TM_MISC3_CDR_EN_FFL                           0x0
 
-    * Enable force on enable Spread Spectrum
-    * (OFFSET, MASK, VALUE)      (0XFD40E37C, 0x000000B3U ,0x000000B0U)
+    * debug bus selection bit, cdr fast phase and freq controls
+    * (OFFSET, MASK, VALUE)      (0XFD4099AC, 0x00000003U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L3_PLL_SS_STEP_SIZE_3_MSB_OFFSET,
-		0x000000B3U, 0x000000B0U);
+	PSU_Mask_Write(SERDES_L2_TM_MISC3_OFFSET, 0x00000003U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_DIG_6 @ 0XFD40906C
+    * Register : L3_TM_MISC3 @ 0XFD40D9AC
 
-    * Bypass Descrambler
-    *  PSU_SERDES_L2_TM_DIG_6_BYPASS_DESCRAM                       0x1
+    * CDR fast phase lock control
+    *  PSU_SERDES_L3_TM_MISC3_CDR_EN_FPL                           0x0
 
-    * Enable Bypass for <1> TM_DIG_CTRL_6
-    *  PSU_SERDES_L2_TM_DIG_6_FORCE_BYPASS_DESCRAM                 0x1
+    * CDR fast frequency lock control
+    *  PSU_SERDES_L3_TM_MISC3_CDR_EN_FFL                           0x0
 
-    * Data path test modes in decoder and descram
-    * (OFFSET, MASK, VALUE)      (0XFD40906C, 0x00000003U ,0x00000003U)
+    * debug bus selection bit, cdr fast phase and freq controls
+    * (OFFSET, MASK, VALUE)      (0XFD40D9AC, 0x00000003U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_DIG_6_OFFSET, 0x00000003U, 0x00000003U);
+	PSU_Mask_Write(SERDES_L3_TM_MISC3_OFFSET, 0x00000003U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TX_DIG_TM_61 @ 0XFD4080F4
-
-    * Bypass scrambler signal
-    *  PSU_SERDES_L2_TX_DIG_TM_61_BYPASS_SCRAM                     0x1
+    * DISABLE DYNAMIC OFFSET CALIBRATION
+    */
+    /*
+    * Register : L0_TM_EQ11 @ 0XFD401978
 
-    * Enable/disable scrambler bypass signal
-    *  PSU_SERDES_L2_TX_DIG_TM_61_FORCE_BYPASS_SCRAM               0x1
+    * Force EQ offset correction algo off if not forced on
+    *  PSU_SERDES_L0_TM_EQ11_FORCE_EQ_OFFS_OFF                     0x1
 
-    * MPHY PLL Gear and bypass scrambler
-    * (OFFSET, MASK, VALUE)      (0XFD4080F4, 0x00000003U ,0x00000003U)
+    * eq dynamic offset correction
+    * (OFFSET, MASK, VALUE)      (0XFD401978, 0x00000010U ,0x00000010U)
     */
-	PSU_Mask_Write(SERDES_L2_TX_DIG_TM_61_OFFSET,
-		0x00000003U, 0x00000003U);
+	PSU_Mask_Write(SERDES_L0_TM_EQ11_OFFSET, 0x00000010U, 0x00000010U);
 /*##################################################################### */
 
     /*
-    * Register : L3_PLL_FBDIV_FRAC_3_MSB @ 0XFD40E360
+    * Register : L1_TM_EQ11 @ 0XFD405978
 
-    * Enable test mode force on fractional mode enable
-    *  PSU_SERDES_L3_PLL_FBDIV_FRAC_3_MSB_TM_FORCE_EN_FRAC         0x1
+    * Force EQ offset correction algo off if not forced on
+    *  PSU_SERDES_L1_TM_EQ11_FORCE_EQ_OFFS_OFF                     0x1
 
-    * Fractional feedback division control and fractional value for feedback d
-    * ivision bits 26:24
-    * (OFFSET, MASK, VALUE)      (0XFD40E360, 0x00000040U ,0x00000040U)
+    * eq dynamic offset correction
+    * (OFFSET, MASK, VALUE)      (0XFD405978, 0x00000010U ,0x00000010U)
     */
-	PSU_Mask_Write(SERDES_L3_PLL_FBDIV_FRAC_3_MSB_OFFSET,
-		0x00000040U, 0x00000040U);
+	PSU_Mask_Write(SERDES_L1_TM_EQ11_OFFSET, 0x00000010U, 0x00000010U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_DIG_6 @ 0XFD40D06C
+    * Register : L2_TM_EQ11 @ 0XFD409978
 
-    * Bypass 8b10b decoder
-    *  PSU_SERDES_L3_TM_DIG_6_BYPASS_DECODER                       0x1
+    * Force EQ offset correction algo off if not forced on
+    *  PSU_SERDES_L2_TM_EQ11_FORCE_EQ_OFFS_OFF                     0x1
 
-    * Enable Bypass for <3> TM_DIG_CTRL_6
-    *  PSU_SERDES_L3_TM_DIG_6_FORCE_BYPASS_DEC                     0x1
+    * eq dynamic offset correction
+    * (OFFSET, MASK, VALUE)      (0XFD409978, 0x00000010U ,0x00000010U)
+    */
+	PSU_Mask_Write(SERDES_L2_TM_EQ11_OFFSET, 0x00000010U, 0x00000010U);
+/*##################################################################### */
 
-    * Bypass Descrambler
-    *  PSU_SERDES_L3_TM_DIG_6_BYPASS_DESCRAM                       0x1
+    /*
+    * Register : L3_TM_EQ11 @ 0XFD40D978
 
-    * Enable Bypass for <1> TM_DIG_CTRL_6
-    *  PSU_SERDES_L3_TM_DIG_6_FORCE_BYPASS_DESCRAM                 0x1
+    * Force EQ offset correction algo off if not forced on
+    *  PSU_SERDES_L3_TM_EQ11_FORCE_EQ_OFFS_OFF                     0x1
 
-    * Data path test modes in decoder and descram
-    * (OFFSET, MASK, VALUE)      (0XFD40D06C, 0x0000000FU ,0x0000000FU)
+    * eq dynamic offset correction
+    * (OFFSET, MASK, VALUE)      (0XFD40D978, 0x00000010U ,0x00000010U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_DIG_6_OFFSET, 0x0000000FU, 0x0000000FU);
+	PSU_Mask_Write(SERDES_L3_TM_EQ11_OFFSET, 0x00000010U, 0x00000010U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TX_DIG_TM_61 @ 0XFD40C0F4
+    * SERDES ILL CALIB
+    */
+		serdes_illcalib(2,3,3,0,4,0,1,1);
 
-    * Enable/disable encoder bypass signal
-    *  PSU_SERDES_L3_TX_DIG_TM_61_BYPASS_ENC                       0x1
+/*##################################################################### */
 
-    * Bypass scrambler signal
-    *  PSU_SERDES_L3_TX_DIG_TM_61_BYPASS_SCRAM                     0x1
+    /*
+    * DISABLE ECO FOR PCIE
+    */
+    /*
+    * Register : eco_0 @ 0XFD3D001C
 
-    * Enable/disable scrambler bypass signal
-    *  PSU_SERDES_L3_TX_DIG_TM_61_FORCE_BYPASS_SCRAM               0x1
+    * For future use
+    *  PSU_SIOU_ECO_0_FIELD                                        0x1
 
-    * MPHY PLL Gear and bypass scrambler
-    * (OFFSET, MASK, VALUE)      (0XFD40C0F4, 0x0000000BU ,0x0000000BU)
+    * ECO Register for future use
+    * (OFFSET, MASK, VALUE)      (0XFD3D001C, 0xFFFFFFFFU ,0x00000001U)
     */
-	PSU_Mask_Write(SERDES_L3_TX_DIG_TM_61_OFFSET,
-		0x0000000BU, 0x0000000BU);
+	PSU_Mask_Write(SIOU_ECO_0_OFFSET, 0xFFFFFFFFU, 0x00000001U);
 /*##################################################################### */
 
     /*
-    * ENABLE CHICKEN BIT FOR PCIE AND USB
+    * GT LANE SETTINGS
     */
     /*
-    * Register : L0_TM_AUX_0 @ 0XFD4010CC
+    * Register : ICM_CFG0 @ 0XFD410010
 
-    * Spare- not used
-    *  PSU_SERDES_L0_TM_AUX_0_BIT_2                                1
+    * Controls UPHY Lane 0 protocol configuration. 0 - PowerDown, 1 - PCIe .0,
+    *  2 - Sata0, 3 - USB0, 4 - DP.1, 5 - SGMII0, 6 - Unused, 7 - Unused
+    *  PSU_SERDES_ICM_CFG0_L0_ICM_CFG                              1
 
-    * Spare registers
-    * (OFFSET, MASK, VALUE)      (0XFD4010CC, 0x00000020U ,0x00000020U)
+    * Controls UPHY Lane 1 protocol configuration. 0 - PowerDown, 1 - PCIe.1,
+    * 2 - Sata1, 3 - USB0, 4 - DP.0, 5 - SGMII1, 6 - Unused, 7 - Unused
+    *  PSU_SERDES_ICM_CFG0_L1_ICM_CFG                              4
+
+    * ICM Configuration Register 0
+    * (OFFSET, MASK, VALUE)      (0XFD410010, 0x00000077U ,0x00000041U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_AUX_0_OFFSET, 0x00000020U, 0x00000020U);
+	PSU_Mask_Write(SERDES_ICM_CFG0_OFFSET, 0x00000077U, 0x00000041U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_AUX_0 @ 0XFD4090CC
+    * Register : ICM_CFG1 @ 0XFD410014
 
-    * Spare- not used
-    *  PSU_SERDES_L2_TM_AUX_0_BIT_2                                1
+    * Controls UPHY Lane 2 protocol configuration. 0 - PowerDown, 1 - PCIe.1,
+    * 2 - Sata0, 3 - USB0, 4 - DP.1, 5 - SGMII2, 6 - Unused, 7 - Unused
+    *  PSU_SERDES_ICM_CFG1_L2_ICM_CFG                              3
 
-    * Spare registers
-    * (OFFSET, MASK, VALUE)      (0XFD4090CC, 0x00000020U ,0x00000020U)
+    * Controls UPHY Lane 3 protocol configuration. 0 - PowerDown, 1 - PCIe.3,
+    * 2 - Sata1, 3 - USB1, 4 - DP.0, 5 - SGMII3, 6 - Unused, 7 - Unused
+    *  PSU_SERDES_ICM_CFG1_L3_ICM_CFG                              2
+
+    * ICM Configuration Register 1
+    * (OFFSET, MASK, VALUE)      (0XFD410014, 0x00000077U ,0x00000023U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_AUX_0_OFFSET, 0x00000020U, 0x00000020U);
+	PSU_Mask_Write(SERDES_ICM_CFG1_OFFSET, 0x00000077U, 0x00000023U);
 /*##################################################################### */
 
     /*
-    * ENABLING EYE SURF
+    * CHECKING PLL LOCK
     */
     /*
-    * Register : L0_TM_DIG_8 @ 0XFD401074
+    * ENABLE SERIAL DATA MUX DEEMPH
+    */
+    /*
+    * Register : L1_TXPMD_TM_45 @ 0XFD404CB4
 
-    * Enable Eye Surf
-    *  PSU_SERDES_L0_TM_DIG_8_EYESURF_ENABLE                       0x1
+    * Enable/disable DP post2 path
+    *  PSU_SERDES_L1_TXPMD_TM_45_DP_TM_TX_DP_ENABLE_POST2_PATH     0x1
 
-    * Test modes for Elastic buffer and enabling Eye Surf
-    * (OFFSET, MASK, VALUE)      (0XFD401074, 0x00000010U ,0x00000010U)
+    * Override enable/disable of DP post2 path
+    *  PSU_SERDES_L1_TXPMD_TM_45_DP_TM_TX_OVRD_DP_ENABLE_POST2_PATH 0x1
+
+    * Override enable/disable of DP post1 path
+    *  PSU_SERDES_L1_TXPMD_TM_45_DP_TM_TX_OVRD_DP_ENABLE_POST1_PATH 0x1
+
+    * Enable/disable DP main path
+    *  PSU_SERDES_L1_TXPMD_TM_45_DP_TM_TX_DP_ENABLE_MAIN_PATH      0x1
+
+    * Override enable/disable of DP main path
+    *  PSU_SERDES_L1_TXPMD_TM_45_DP_TM_TX_OVRD_DP_ENABLE_MAIN_PATH 0x1
+
+    * Post or pre or main DP path selection
+    * (OFFSET, MASK, VALUE)      (0XFD404CB4, 0x00000037U ,0x00000037U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_DIG_8_OFFSET, 0x00000010U, 0x00000010U);
+	PSU_Mask_Write(SERDES_L1_TXPMD_TM_45_OFFSET,
+		0x00000037U, 0x00000037U);
 /*##################################################################### */
 
     /*
-    * Register : L1_TM_DIG_8 @ 0XFD405074
+    * Register : L1_TX_ANA_TM_118 @ 0XFD4041D8
 
-    * Enable Eye Surf
-    *  PSU_SERDES_L1_TM_DIG_8_EYESURF_ENABLE                       0x1
+    * Test register force for enabling/disablign TX deemphasis bits <17:0>
+    *  PSU_SERDES_L1_TX_ANA_TM_118_FORCE_TX_DEEMPH_17_0            0x1
 
-    * Test modes for Elastic buffer and enabling Eye Surf
-    * (OFFSET, MASK, VALUE)      (0XFD405074, 0x00000010U ,0x00000010U)
+    * Enable Override of TX deemphasis
+    * (OFFSET, MASK, VALUE)      (0XFD4041D8, 0x00000001U ,0x00000001U)
     */
-	PSU_Mask_Write(SERDES_L1_TM_DIG_8_OFFSET, 0x00000010U, 0x00000010U);
+	PSU_Mask_Write(SERDES_L1_TX_ANA_TM_118_OFFSET,
+		0x00000001U, 0x00000001U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_DIG_8 @ 0XFD409074
+    * Register : L3_TX_ANA_TM_118 @ 0XFD40C1D8
 
-    * Enable Eye Surf
-    *  PSU_SERDES_L2_TM_DIG_8_EYESURF_ENABLE                       0x1
+    * Test register force for enabling/disablign TX deemphasis bits <17:0>
+    *  PSU_SERDES_L3_TX_ANA_TM_118_FORCE_TX_DEEMPH_17_0            0x1
 
-    * Test modes for Elastic buffer and enabling Eye Surf
-    * (OFFSET, MASK, VALUE)      (0XFD409074, 0x00000010U ,0x00000010U)
+    * Enable Override of TX deemphasis
+    * (OFFSET, MASK, VALUE)      (0XFD40C1D8, 0x00000001U ,0x00000001U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_DIG_8_OFFSET, 0x00000010U, 0x00000010U);
+	PSU_Mask_Write(SERDES_L3_TX_ANA_TM_118_OFFSET,
+		0x00000001U, 0x00000001U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_DIG_8 @ 0XFD40D074
+    * CDR AND RX EQUALIZATION SETTINGS
+    */
+    /*
+    * Register : L3_TM_CDR5 @ 0XFD40DC14
 
-    * Enable Eye Surf
-    *  PSU_SERDES_L3_TM_DIG_8_EYESURF_ENABLE                       0x1
+    * FPHL FSM accumulate cycles
+    *  PSU_SERDES_L3_TM_CDR5_FPHL_FSM_ACC_CYCLES                   0x7
 
-    * Test modes for Elastic buffer and enabling Eye Surf
-    * (OFFSET, MASK, VALUE)      (0XFD40D074, 0x00000010U ,0x00000010U)
+    * FFL Phase0 int gain aka 2ol SD update rate
+    *  PSU_SERDES_L3_TM_CDR5_FFL_PH0_INT_GAIN                      0x6
+
+    * Fast phase lock controls -- FSM accumulator cycle control and phase 0 in
+    * t gain control.
+    * (OFFSET, MASK, VALUE)      (0XFD40DC14, 0x000000FFU ,0x000000E6U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_DIG_8_OFFSET, 0x00000010U, 0x00000010U);
+	PSU_Mask_Write(SERDES_L3_TM_CDR5_OFFSET, 0x000000FFU, 0x000000E6U);
 /*##################################################################### */
 
     /*
-    * ILL SETTINGS FOR GAIN AND LOCK SETTINGS
-    */
-    /*
-    * Register : L0_TM_MISC2 @ 0XFD40189C
+    * Register : L3_TM_CDR16 @ 0XFD40DC40
 
-    * ILL calib counts BYPASSED with calcode bits
-    *  PSU_SERDES_L0_TM_MISC2_ILL_CAL_BYPASS_COUNTS                0x1
+    * FFL Phase0 prop gain aka 1ol SD update rate
+    *  PSU_SERDES_L3_TM_CDR16_FFL_PH0_PROP_GAIN                    0xC
 
-    * sampler cal
-    * (OFFSET, MASK, VALUE)      (0XFD40189C, 0x00000080U ,0x00000080U)
+    * Fast phase lock controls -- phase 0 prop gain
+    * (OFFSET, MASK, VALUE)      (0XFD40DC40, 0x0000001FU ,0x0000000CU)
     */
-	PSU_Mask_Write(SERDES_L0_TM_MISC2_OFFSET, 0x00000080U, 0x00000080U);
+	PSU_Mask_Write(SERDES_L3_TM_CDR16_OFFSET, 0x0000001FU, 0x0000000CU);
 /*##################################################################### */
 
     /*
-    * Register : L0_TM_IQ_ILL1 @ 0XFD4018F8
+    * Register : L3_TM_EQ0 @ 0XFD40D94C
 
-    * IQ ILL F0 CALCODE bypass value. MPHY : G1a, PCIE : Gen 1, SATA : Gen1 ,
-    * USB3 : SS
-    *  PSU_SERDES_L0_TM_IQ_ILL1_ILL_BYPASS_IQ_CALCODE_F0           0x64
+    * EQ stg 2 controls BYPASSED
+    *  PSU_SERDES_L3_TM_EQ0_EQ_STG2_CTRL_BYP                       1
 
-    * iqpi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD4018F8, 0x000000FFU ,0x00000064U)
+    * eq stg1 and stg2 controls
+    * (OFFSET, MASK, VALUE)      (0XFD40D94C, 0x00000020U ,0x00000020U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_IQ_ILL1_OFFSET,
-		0x000000FFU, 0x00000064U);
+	PSU_Mask_Write(SERDES_L3_TM_EQ0_OFFSET, 0x00000020U, 0x00000020U);
 /*##################################################################### */
 
     /*
-    * Register : L0_TM_IQ_ILL2 @ 0XFD4018FC
+    * Register : L3_TM_EQ1 @ 0XFD40D950
 
-    * IQ ILL F1 CALCODE bypass value. MPHY : G1b, PCIE : Gen2, SATA: Gen2
-    *  PSU_SERDES_L0_TM_IQ_ILL2_ILL_BYPASS_IQ_CALCODE_F1           0x64
+    * EQ STG2 RL PROG
+    *  PSU_SERDES_L3_TM_EQ1_EQ_STG2_RL_PROG                        0x2
 
-    * iqpi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD4018FC, 0x000000FFU ,0x00000064U)
+    * EQ stg 2 preamp mode val
+    *  PSU_SERDES_L3_TM_EQ1_EQ_STG2_PREAMP_MODE_VAL                0x1
+
+    * eq stg1 and stg2 controls
+    * (OFFSET, MASK, VALUE)      (0XFD40D950, 0x00000007U ,0x00000006U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_IQ_ILL2_OFFSET,
-		0x000000FFU, 0x00000064U);
+	PSU_Mask_Write(SERDES_L3_TM_EQ1_OFFSET, 0x00000007U, 0x00000006U);
 /*##################################################################### */
 
     /*
-    * Register : L0_TM_ILL12 @ 0XFD401990
+    * GEM SERDES SETTINGS
+    */
+    /*
+    * ENABLE PRE EMPHAIS AND VOLTAGE SWING
+    */
+    /*
+    * Register : L1_TXPMD_TM_48 @ 0XFD404CC0
 
-    * G1A pll ctr bypass value
-    *  PSU_SERDES_L0_TM_ILL12_G1A_PLL_CTR_BYP_VAL                  0x11
+    * Margining factor value
+    *  PSU_SERDES_L1_TXPMD_TM_48_TM_RESULTANT_MARGINING_FACTOR     0
 
-    * ill pll counter values
-    * (OFFSET, MASK, VALUE)      (0XFD401990, 0x000000FFU ,0x00000011U)
+    * Margining factor
+    * (OFFSET, MASK, VALUE)      (0XFD404CC0, 0x0000001FU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_ILL12_OFFSET, 0x000000FFU, 0x00000011U);
+	PSU_Mask_Write(SERDES_L1_TXPMD_TM_48_OFFSET,
+		0x0000001FU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L0_TM_E_ILL1 @ 0XFD401924
+    * Register : L1_TX_ANA_TM_18 @ 0XFD404048
 
-    * E ILL F0 CALCODE bypass value. MPHY : G1a, PCIE : Gen 1, SATA : Gen1 , U
-    * SB3 : SS
-    *  PSU_SERDES_L0_TM_E_ILL1_ILL_BYPASS_E_CALCODE_F0             0x4
+    * pipe_TX_Deemph. 0: -6dB de-emphasis, 1: -3.5dB de-emphasis, 2 : No de-em
+    * phasis, Others: reserved
+    *  PSU_SERDES_L1_TX_ANA_TM_18_PIPE_TX_DEEMPH_7_0               0
 
-    * epi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD401924, 0x000000FFU ,0x00000004U)
+    * Override for PIPE TX de-emphasis
+    * (OFFSET, MASK, VALUE)      (0XFD404048, 0x000000FFU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_E_ILL1_OFFSET, 0x000000FFU, 0x00000004U);
+	PSU_Mask_Write(SERDES_L1_TX_ANA_TM_18_OFFSET,
+		0x000000FFU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L0_TM_E_ILL2 @ 0XFD401928
+    * Register : L3_TX_ANA_TM_18 @ 0XFD40C048
 
-    * E ILL F1 CALCODE bypass value. MPHY : G1b, PCIE : Gen2, SATA: Gen2
-    *  PSU_SERDES_L0_TM_E_ILL2_ILL_BYPASS_E_CALCODE_F1             0xFE
+    * pipe_TX_Deemph. 0: -6dB de-emphasis, 1: -3.5dB de-emphasis, 2 : No de-em
+    * phasis, Others: reserved
+    *  PSU_SERDES_L3_TX_ANA_TM_18_PIPE_TX_DEEMPH_7_0               0x1
 
-    * epi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD401928, 0x000000FFU ,0x000000FEU)
+    * Override for PIPE TX de-emphasis
+    * (OFFSET, MASK, VALUE)      (0XFD40C048, 0x000000FFU ,0x00000001U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_E_ILL2_OFFSET, 0x000000FFU, 0x000000FEU);
+	PSU_Mask_Write(SERDES_L3_TX_ANA_TM_18_OFFSET,
+		0x000000FFU, 0x00000001U);
 /*##################################################################### */
 
+
+	return 1;
+#endif /* PSU_INIT_TABLE */
+}
+unsigned long psu_resetout_start_data(void)
+{
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_resetout_start_data_table);
+#else
     /*
-    * Register : L0_TM_IQ_ILL3 @ 0XFD401900
+    * TAKING SERDES PERIPHERAL OUT OF RESET RESET
+    */
+    /*
+    * PUTTING USB0 IN RESET
+    */
+    /*
+    * Register : RST_LPD_TOP @ 0XFF5E023C
 
-    * IQ ILL F2CALCODE bypass value. MPHY : G2a, SATA : Gen3
-    *  PSU_SERDES_L0_TM_IQ_ILL3_ILL_BYPASS_IQ_CALCODE_F2           0x64
+    * USB 0 reset for control registers
+    *  PSU_CRL_APB_RST_LPD_TOP_USB0_APB_RESET                      0X0
 
-    * iqpi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD401900, 0x000000FFU ,0x00000064U)
+    * Software control register for the LPD block.
+    * (OFFSET, MASK, VALUE)      (0XFF5E023C, 0x00000400U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_IQ_ILL3_OFFSET,
-		0x000000FFU, 0x00000064U);
+	PSU_Mask_Write(CRL_APB_RST_LPD_TOP_OFFSET, 0x00000400U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L0_TM_E_ILL3 @ 0XFD40192C
+    * USB0 PIPE POWER PRESENT
+    */
+    /*
+    * Register : fpd_power_prsnt @ 0XFF9D0080
 
-    * E ILL F2CALCODE bypass value. MPHY : G2a, SATA : Gen3
-    *  PSU_SERDES_L0_TM_E_ILL3_ILL_BYPASS_E_CALCODE_F2             0x0
+    * This bit is used to choose between PIPE power present and 1'b1
+    *  PSU_USB3_0_FPD_POWER_PRSNT_OPTION                           0X1
 
-    * epi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD40192C, 0x000000FFU ,0x00000000U)
+    * fpd_power_prsnt
+    * (OFFSET, MASK, VALUE)      (0XFF9D0080, 0x00000001U ,0x00000001U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_E_ILL3_OFFSET, 0x000000FFU, 0x00000000U);
+    PSU_Mask_Write(USB3_0_FPD_POWER_PRSNT_OFFSET,
+        0x00000001U, 0x00000001U);
 /*##################################################################### */
 
     /*
-    * Register : L0_TM_ILL8 @ 0XFD401980
+    * Register : fpd_pipe_clk @ 0XFF9D007C
 
-    * ILL calibration code change wait time
-    *  PSU_SERDES_L0_TM_ILL8_ILL_CAL_ITER_WAIT                     0xFF
+    * This bit is used to choose between PIPE clock coming from SerDes and the
+    *  suspend clk
+    *  PSU_USB3_0_FPD_PIPE_CLK_OPTION                              0x0
 
-    * ILL cal routine control
-    * (OFFSET, MASK, VALUE)      (0XFD401980, 0x000000FFU ,0x000000FFU)
+    * fpd_pipe_clk
+    * (OFFSET, MASK, VALUE)      (0XFF9D007C, 0x00000001U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_ILL8_OFFSET, 0x000000FFU, 0x000000FFU);
+    PSU_Mask_Write(USB3_0_FPD_PIPE_CLK_OFFSET, 0x00000001U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L0_TM_IQ_ILL8 @ 0XFD401914
+    * HIBERREST
+    */
+    /*
+    * Register : RST_LPD_TOP @ 0XFF5E023C
 
-    * IQ ILL polytrim bypass value
-    *  PSU_SERDES_L0_TM_IQ_ILL8_ILL_BYPASS_IQ_POLYTRIM_VAL         0xF7
+    * USB 0 sleep circuit reset
+    *  PSU_CRL_APB_RST_LPD_TOP_USB0_HIBERRESET                     0X0
 
-    * iqpi polytrim
-    * (OFFSET, MASK, VALUE)      (0XFD401914, 0x000000FFU ,0x000000F7U)
+    * USB 0 reset
+    *  PSU_CRL_APB_RST_LPD_TOP_USB0_CORERESET                      0X0
+
+    * Software control register for the LPD block.
+    * (OFFSET, MASK, VALUE)      (0XFF5E023C, 0x00000140U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_IQ_ILL8_OFFSET,
-		0x000000FFU, 0x000000F7U);
+	PSU_Mask_Write(CRL_APB_RST_LPD_TOP_OFFSET, 0x00000140U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L0_TM_IQ_ILL9 @ 0XFD401918
+    * PUTTING GEM0 IN RESET
+    */
+    /*
+    * Register : RST_LPD_IOU0 @ 0XFF5E0230
 
-    * bypass IQ polytrim
-    *  PSU_SERDES_L0_TM_IQ_ILL9_ILL_BYPASS_IQ_POLYTIM              0x1
+    * GEM 3 reset
+    *  PSU_CRL_APB_RST_LPD_IOU0_GEM3_RESET                         0X0
 
-    * enables for lf,constant gm trim and polytirm
-    * (OFFSET, MASK, VALUE)      (0XFD401918, 0x00000001U ,0x00000001U)
+    * Software controlled reset for the GEMs
+    * (OFFSET, MASK, VALUE)      (0XFF5E0230, 0x00000008U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_IQ_ILL9_OFFSET,
-		0x00000001U, 0x00000001U);
+	PSU_Mask_Write(CRL_APB_RST_LPD_IOU0_OFFSET,
+		0x00000008U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L0_TM_E_ILL8 @ 0XFD401940
+    * PUTTING SATA IN RESET
+    */
+    /*
+    * Register : sata_misc_ctrl @ 0XFD3D0100
 
-    * E ILL polytrim bypass value
-    *  PSU_SERDES_L0_TM_E_ILL8_ILL_BYPASS_E_POLYTRIM_VAL           0xF7
+    * Sata PM clock control select
+    *  PSU_SIOU_SATA_MISC_CTRL_SATA_PM_CLK_SEL                     0x3
 
-    * epi polytrim
-    * (OFFSET, MASK, VALUE)      (0XFD401940, 0x000000FFU ,0x000000F7U)
+    * Misc Contorls for SATA.This register may only be modified during bootup
+    * (while SATA block is disabled)
+    * (OFFSET, MASK, VALUE)      (0XFD3D0100, 0x00000003U ,0x00000003U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_E_ILL8_OFFSET, 0x000000FFU, 0x000000F7U);
+	PSU_Mask_Write(SIOU_SATA_MISC_CTRL_OFFSET, 0x00000003U, 0x00000003U);
 /*##################################################################### */
 
     /*
-    * Register : L0_TM_E_ILL9 @ 0XFD401944
+    * Register : RST_FPD_TOP @ 0XFD1A0100
 
-    * bypass E polytrim
-    *  PSU_SERDES_L0_TM_E_ILL9_ILL_BYPASS_E_POLYTIM                0x1
+    * Sata block level reset
+    *  PSU_CRF_APB_RST_FPD_TOP_SATA_RESET                          0X0
 
-    * enables for lf,constant gm trim and polytirm
-    * (OFFSET, MASK, VALUE)      (0XFD401944, 0x00000001U ,0x00000001U)
+    * FPD Block level software controlled reset
+    * (OFFSET, MASK, VALUE)      (0XFD1A0100, 0x00000002U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_E_ILL9_OFFSET, 0x00000001U, 0x00000001U);
+	PSU_Mask_Write(CRF_APB_RST_FPD_TOP_OFFSET, 0x00000002U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L0_TM_ILL13 @ 0XFD401994
+    * PUTTING PCIE CFG AND BRIDGE IN RESET
+    */
+    /*
+    * Register : RST_FPD_TOP @ 0XFD1A0100
 
-    * ILL cal idle val refcnt
-    *  PSU_SERDES_L0_TM_ILL13_ILL_CAL_IDLE_VAL_REFCNT              0x7
+    * PCIE config reset
+    *  PSU_CRF_APB_RST_FPD_TOP_PCIE_CFG_RESET                      0X0
 
-    * ill cal idle value count
-    * (OFFSET, MASK, VALUE)      (0XFD401994, 0x00000007U ,0x00000007U)
+    * PCIE bridge block level reset (AXI interface)
+    *  PSU_CRF_APB_RST_FPD_TOP_PCIE_BRIDGE_RESET                   0X0
+
+    * FPD Block level software controlled reset
+    * (OFFSET, MASK, VALUE)      (0XFD1A0100, 0x000C0000U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_ILL13_OFFSET, 0x00000007U, 0x00000007U);
+	PSU_Mask_Write(CRF_APB_RST_FPD_TOP_OFFSET, 0x000C0000U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L1_TM_ILL13 @ 0XFD405994
+    * PUTTING DP IN RESET
+    */
+    /*
+    * Register : RST_FPD_TOP @ 0XFD1A0100
 
-    * ILL cal idle val refcnt
-    *  PSU_SERDES_L1_TM_ILL13_ILL_CAL_IDLE_VAL_REFCNT              0x7
+    * Display Port block level reset (includes DPDMA)
+    *  PSU_CRF_APB_RST_FPD_TOP_DP_RESET                            0X0
 
-    * ill cal idle value count
-    * (OFFSET, MASK, VALUE)      (0XFD405994, 0x00000007U ,0x00000007U)
+    * FPD Block level software controlled reset
+    * (OFFSET, MASK, VALUE)      (0XFD1A0100, 0x00010000U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L1_TM_ILL13_OFFSET, 0x00000007U, 0x00000007U);
+	PSU_Mask_Write(CRF_APB_RST_FPD_TOP_OFFSET, 0x00010000U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_MISC2 @ 0XFD40989C
+    * Register : DP_PHY_RESET @ 0XFD4A0200
 
-    * ILL calib counts BYPASSED with calcode bits
-    *  PSU_SERDES_L2_TM_MISC2_ILL_CAL_BYPASS_COUNTS                0x1
+    * Set to '1' to hold the GT in reset. Clear to release.
+    *  PSU_DP_DP_PHY_RESET_GT_RESET                                0X0
 
-    * sampler cal
-    * (OFFSET, MASK, VALUE)      (0XFD40989C, 0x00000080U ,0x00000080U)
+    * Reset the transmitter PHY.
+    * (OFFSET, MASK, VALUE)      (0XFD4A0200, 0x00000002U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_MISC2_OFFSET, 0x00000080U, 0x00000080U);
+	PSU_Mask_Write(DP_DP_PHY_RESET_OFFSET, 0x00000002U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_IQ_ILL1 @ 0XFD4098F8
+    * Register : DP_TX_PHY_POWER_DOWN @ 0XFD4A0238
 
-    * IQ ILL F0 CALCODE bypass value. MPHY : G1a, PCIE : Gen 1, SATA : Gen1 ,
-    * USB3 : SS
-    *  PSU_SERDES_L2_TM_IQ_ILL1_ILL_BYPASS_IQ_CALCODE_F0           0x1A
+    * Two bits per lane. When set to 11, moves the GT to power down mode. When
+    *  set to 00, GT will be in active state. bits [1:0] - lane0 Bits [3:2] -
+    * lane 1
+    *  PSU_DP_DP_TX_PHY_POWER_DOWN_POWER_DWN                       0X0
 
-    * iqpi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD4098F8, 0x000000FFU ,0x0000001AU)
+    * Control PHY Power down
+    * (OFFSET, MASK, VALUE)      (0XFD4A0238, 0x0000000FU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_IQ_ILL1_OFFSET,
-		0x000000FFU, 0x0000001AU);
+	PSU_Mask_Write(DP_DP_TX_PHY_POWER_DOWN_OFFSET,
+		0x0000000FU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_IQ_ILL2 @ 0XFD4098FC
+    * USB0 GFLADJ
+    */
+    /*
+    * Register : GUSB2PHYCFG @ 0XFE20C200
 
-    * IQ ILL F1 CALCODE bypass value. MPHY : G1b, PCIE : Gen2, SATA: Gen2
-    *  PSU_SERDES_L2_TM_IQ_ILL2_ILL_BYPASS_IQ_CALCODE_F1           0x1A
+    * USB 2.0 Turnaround Time (USBTrdTim) Sets the turnaround time in PHY cloc
+    * ks. Specifies the response time for a MAC request to the Packet FIFO Con
+    * troller (PFC) to fetch data from the DFIFO (SPRAM). The following are th
+    * e required values for the minimum SoC bus frequency of 60 MHz. USB turna
+    * round time is a critical certification criteria when using long cables a
+    * nd five hub levels. The required values for this field: - 4'h5: When the
+    *  MAC interface is 16-bit UTMI+. - 4'h9: When the MAC interface is 8-bit
+    * UTMI+/ULPI. If SoC bus clock is less than 60 MHz, and USB turnaround tim
+    * e is not critical, this field can be set to a larger value. Note: This f
+    * ield is valid only in device mode.
+    *  PSU_USB3_0_XHCI_GUSB2PHYCFG_USBTRDTIM                       0x9
 
-    * iqpi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD4098FC, 0x000000FFU ,0x0000001AU)
-    */
-	PSU_Mask_Write(SERDES_L2_TM_IQ_ILL2_OFFSET,
-		0x000000FFU, 0x0000001AU);
-/*##################################################################### */
+    * Transceiver Delay: Enables a delay between the assertion of the UTMI/ULP
+    * I Transceiver Select signal (for HS) and the assertion of the TxValid si
+    * gnal during a HS Chirp. When this bit is set to 1, a delay (of approxima
+    * tely 2.5 us) is introduced from the time when the Transceiver Select is
+    * set to 2'b00 (HS) to the time the TxValid is driven to 0 for sending the
+    *  chirp-K. This delay is required for some UTMI/ULPI PHYs. Note: - If you
+    *  enable the hibernation feature when the device core comes out of power-
+    * off, you must re-initialize this bit with the appropriate value because
+    * the core does not save and restore this bit value during hibernation. -
+    * This bit is valid only in device mode.
+    *  PSU_USB3_0_XHCI_GUSB2PHYCFG_XCVRDLY                         0x0
 
-    /*
-    * Register : L2_TM_ILL12 @ 0XFD409990
+    * Enable utmi_sleep_n and utmi_l1_suspend_n (EnblSlpM) The application use
+    * s this bit to control utmi_sleep_n and utmi_l1_suspend_n assertion to th
+    * e PHY in the L1 state. - 1'b0: utmi_sleep_n and utmi_l1_suspend_n assert
+    * ion from the core is not transferred to the external PHY. - 1'b1: utmi_s
+    * leep_n and utmi_l1_suspend_n assertion from the core is transferred to t
+    * he external PHY. Note: This bit must be set high for Port0 if PHY is use
+    * d. Note: In Device mode - Before issuing any device endpoint command whe
+    * n operating in 2.0 speeds, disable this bit and enable it after the comm
+    * and completes. Without disabling this bit, if a command is issued when t
+    * he device is in L1 state and if mac2_clk (utmi_clk/ulpi_clk) is gated of
+    * f, the command will not get completed.
+    *  PSU_USB3_0_XHCI_GUSB2PHYCFG_ENBLSLPM                        0x0
 
-    * G1A pll ctr bypass value
-    *  PSU_SERDES_L2_TM_ILL12_G1A_PLL_CTR_BYP_VAL                  0x10
+    * USB 2.0 High-Speed PHY or USB 1.1 Full-Speed Serial Transceiver Select T
+    * he application uses this bit to select a high-speed PHY or a full-speed
+    * transceiver. - 1'b0: USB 2.0 high-speed UTMI+ or ULPI PHY. This bit is a
+    * lways 0, with Write Only access. - 1'b1: USB 1.1 full-speed serial trans
+    * ceiver. This bit is always 1, with Write Only access. If both interface
+    * types are selected in coreConsultant (that is, parameters' values are no
+    * t zero), the application uses this bit to select the active interface is
+    *  active, with Read-Write bit access. Note: USB 1.1 full-serial transceiv
+    * er is not supported. This bit always reads as 1'b0.
+    *  PSU_USB3_0_XHCI_GUSB2PHYCFG_PHYSEL                          0x0
 
-    * ill pll counter values
-    * (OFFSET, MASK, VALUE)      (0XFD409990, 0x000000FFU ,0x00000010U)
-    */
-	PSU_Mask_Write(SERDES_L2_TM_ILL12_OFFSET, 0x000000FFU, 0x00000010U);
-/*##################################################################### */
+    * Suspend USB2.0 HS/FS/LS PHY (SusPHY) When set, USB2.0 PHY enters Suspend
+    *  mode if Suspend conditions are valid. For DRD/OTG configurations, it is
+    *  recommended that this bit is set to 0 during coreConsultant configurati
+    * on. If it is set to 1, then the application must clear this bit after po
+    * wer-on reset. Application needs to set it to 1 after the core initializa
+    * tion completes. For all other configurations, this bit can be set to 1 d
+    * uring core configuration. Note: - In host mode, on reset, this bit is se
+    * t to 1. Software can override this bit after reset. - In device mode, be
+    * fore issuing any device endpoint command when operating in 2.0 speeds, d
+    * isable this bit and enable it after the command completes. If you issue
+    * a command without disabling this bit when the device is in L2 state and
+    * if mac2_clk (utmi_clk/ulpi_clk) is gated off, the command will not get c
+    * ompleted.
+    *  PSU_USB3_0_XHCI_GUSB2PHYCFG_SUSPENDUSB20                    0x1
 
-    /*
-    * Register : L2_TM_E_ILL1 @ 0XFD409924
+    * Full-Speed Serial Interface Select (FSIntf) The application uses this bi
+    * t to select a unidirectional or bidirectional USB 1.1 full-speed serial
+    * transceiver interface. - 1'b0: 6-pin unidirectional full-speed serial in
+    * terface. This bit is set to 0 with Read Only access. - 1'b1: 3-pin bidir
+    * ectional full-speed serial interface. This bit is set to 0 with Read Onl
+    * y access. Note: USB 1.1 full-speed serial interface is not supported. Th
+    * is bit always reads as 1'b0.
+    *  PSU_USB3_0_XHCI_GUSB2PHYCFG_FSINTF                          0x0
 
-    * E ILL F0 CALCODE bypass value. MPHY : G1a, PCIE : Gen 1, SATA : Gen1 , U
-    * SB3 : SS
-    *  PSU_SERDES_L2_TM_E_ILL1_ILL_BYPASS_E_CALCODE_F0             0xFE
+    * ULPI or UTMI+ Select (ULPI_UTMI_Sel) The application uses this bit to se
+    * lect a UTMI+ or ULPI Interface. - 1'b0: UTMI+ Interface - 1'b1: ULPI Int
+    * erface This bit is writable only if UTMI+ and ULPI is specified for High
+    * -Speed PHY Interface(s) in coreConsultant configuration (DWC_USB3_HSPHY_
+    * INTERFACE = 3). Otherwise, this bit is read-only and the value depends o
+    * n the interface selected through DWC_USB3_HSPHY_INTERFACE.
+    *  PSU_USB3_0_XHCI_GUSB2PHYCFG_ULPI_UTMI_SEL                   0x1
 
-    * epi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD409924, 0x000000FFU ,0x000000FEU)
+    * PHY Interface (PHYIf) If UTMI+ is selected, the application uses this bi
+    * t to configure the core to support a UTMI+ PHY with an 8- or 16-bit inte
+    * rface. - 1'b0: 8 bits - 1'b1: 16 bits ULPI Mode: 1'b0 Note: - All the en
+    * abled 2.0 ports must have the same clock frequency as Port0 clock freque
+    * ncy (utmi_clk[0]). - The UTMI 8-bit and 16-bit modes cannot be used toge
+    * ther for different ports at the same time (that is, all the ports must b
+    * e in 8-bit mode, or all of them must be in 16-bit mode, at a time). - If
+    *  any of the USB 2.0 ports is selected as ULPI port for operation, then a
+    * ll the USB 2.0 ports must be operating at 60 MHz.
+    *  PSU_USB3_0_XHCI_GUSB2PHYCFG_PHYIF                           0x0
+
+    * HS/FS Timeout Calibration (TOutCal) The number of PHY clocks, as indicat
+    * ed by the application in this field, is multiplied by a bit-time factor;
+    *  this factor is added to the high-speed/full-speed interpacket timeout d
+    * uration in the core to account for additional delays introduced by the P
+    * HY. This may be required, since the delay introduced by the PHY in gener
+    * ating the linestate condition may vary among PHYs. The USB standard time
+    * out value for high-speed operation is 736 to 816 (inclusive) bit times.
+    * The USB standard timeout value for full-speed operation is 16 to 18 (inc
+    * lusive) bit times. The application must program this field based on the
+    * speed of connection. The number of bit times added per PHY clock are: Hi
+    * gh-speed operation: - One 30-MHz PHY clock = 16 bit times - One 60-MHz P
+    * HY clock = 8 bit times Full-speed operation: - One 30-MHz PHY clock = 0.
+    * 4 bit times - One 60-MHz PHY clock = 0.2 bit times - One 48-MHz PHY cloc
+    * k = 0.25 bit times
+    *  PSU_USB3_0_XHCI_GUSB2PHYCFG_TOUTCAL                         0x7
+
+    * ULPI External VBUS Drive (ULPIExtVbusDrv) Selects supply source to drive
+    *  5V on VBUS, in the ULPI PHY. - 1'b0: PHY drives VBUS with internal char
+    * ge pump (default). - 1'b1: PHY drives VBUS with an external supply. (Onl
+    * y when RTL parameter DWC_USB3_HSPHY_INTERFACE = 2 or 3)
+    *  PSU_USB3_0_XHCI_GUSB2PHYCFG_ULPIEXTVBUSDRV                  0x1
+
+    * Global USB2 PHY Configuration Register The application must program this
+    *  register before starting any transactions on either the SoC bus or the
+    * USB. In Device-only configurations, only one register is needed. In Host
+    *  mode, per-port registers are implemented.
+    * (OFFSET, MASK, VALUE)      (0XFE20C200, 0x00023FFFU ,0x00022457U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_E_ILL1_OFFSET, 0x000000FFU, 0x000000FEU);
+	PSU_Mask_Write(USB3_0_XHCI_GUSB2PHYCFG_OFFSET,
+		0x00023FFFU, 0x00022457U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_E_ILL2 @ 0XFD409928
+    * Register : GFLADJ @ 0XFE20C630
 
-    * E ILL F1 CALCODE bypass value. MPHY : G1b, PCIE : Gen2, SATA: Gen2
-    *  PSU_SERDES_L2_TM_E_ILL2_ILL_BYPASS_E_CALCODE_F1             0x0
+    * This field indicates the frame length adjustment to be applied when SOF/
+    * ITP counter is running on the ref_clk. This register value is used to ad
+    * just the ITP interval when GCTL[SOFITPSYNC] is set to '1'; SOF and ITP i
+    * nterval when GLADJ.GFLADJ_REFCLK_LPM_SEL is set to '1'. This field must
+    * be programmed to a non-zero value only if GFLADJ_REFCLK_LPM_SEL is set t
+    * o '1' or GCTL.SOFITPSYNC is set to '1'. The value is derived as follows:
+    *  FLADJ_REF_CLK_FLADJ=((125000/ref_clk_period_integer)-(125000/ref_clk_pe
+    * riod)) * ref_clk_period where - the ref_clk_period_integer is the intege
+    * r value of the ref_clk period got by truncating the decimal (fractional)
+    *  value that is programmed in the GUCTL.REF_CLK_PERIOD field. - the ref_c
+    * lk_period is the ref_clk period including the fractional value. Examples
+    * : If the ref_clk is 24 MHz then - GUCTL.REF_CLK_PERIOD = 41 - GFLADJ.GLA
+    * DJ_REFCLK_FLADJ = ((125000/41)-(125000/41.6666))*41.6666 = 2032 (ignorin
+    * g the fractional value) If the ref_clk is 48 MHz then - GUCTL.REF_CLK_PE
+    * RIOD = 20 - GFLADJ.GLADJ_REFCLK_FLADJ = ((125000/20)-(125000/20.8333))*2
+    * 0.8333 = 5208 (ignoring the fractional value)
+    *  PSU_USB3_0_XHCI_GFLADJ_GFLADJ_REFCLK_FLADJ                  0x0
 
-    * epi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD409928, 0x000000FFU ,0x00000000U)
+    * Global Frame Length Adjustment Register This register provides options f
+    * or the software to control the core behavior with respect to SOF (Start
+    * of Frame) and ITP (Isochronous Timestamp Packet) timers and frame timer
+    * functionality. It provides an option to override the fladj_30mhz_reg sid
+    * eband signal. In addition, it enables running SOF or ITP frame timer cou
+    * nters completely from the ref_clk. This facilitates hardware LPM in host
+    *  mode with the SOF or ITP counters being run from the ref_clk signal.
+    * (OFFSET, MASK, VALUE)      (0XFE20C630, 0x003FFF00U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_E_ILL2_OFFSET, 0x000000FFU, 0x00000000U);
+	PSU_Mask_Write(USB3_0_XHCI_GFLADJ_OFFSET, 0x003FFF00U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_IQ_ILL3 @ 0XFD409900
+    * Register : GUCTL1 @ 0XFE20C11C
 
-    * IQ ILL F2CALCODE bypass value. MPHY : G2a, SATA : Gen3
-    *  PSU_SERDES_L2_TM_IQ_ILL3_ILL_BYPASS_IQ_CALCODE_F2           0x1A
+    * When this bit is set to '0', termsel, xcvrsel will become 0 during end o
+    * f resume while the opmode will become 0 once controller completes end of
+    *  resume and enters U0 state (2 separate commandswill be issued). When th
+    * is bit is set to '1', all the termsel, xcvrsel, opmode becomes 0 during
+    * end of resume itself (only 1 command will be issued)
+    *  PSU_USB3_0_XHCI_GUCTL1_RESUME_TERMSEL_XCVRSEL_UNIFY         0x1
 
-    * iqpi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD409900, 0x000000FFU ,0x0000001AU)
+    * Reserved
+    *  PSU_USB3_0_XHCI_GUCTL1_RESERVED_9                           0x1
+
+    * Global User Control Register 1
+    * (OFFSET, MASK, VALUE)      (0XFE20C11C, 0x00000600U ,0x00000600U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_IQ_ILL3_OFFSET,
-		0x000000FFU, 0x0000001AU);
+	PSU_Mask_Write(USB3_0_XHCI_GUCTL1_OFFSET, 0x00000600U, 0x00000600U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_E_ILL3 @ 0XFD40992C
+    * Register : GUCTL @ 0XFE20C12C
 
-    * E ILL F2CALCODE bypass value. MPHY : G2a, SATA : Gen3
-    *  PSU_SERDES_L2_TM_E_ILL3_ILL_BYPASS_E_CALCODE_F2             0x0
+    * Host IN Auto Retry (USBHstInAutoRetryEn) When set, this field enables th
+    * e Auto Retry feature. For IN transfers (non-isochronous) that encounter
+    * data packets with CRC errors or internal overrun scenarios, the auto ret
+    * ry feature causes the Host core to reply to the device with a non-termin
+    * ating retry ACK (that is, an ACK transaction packet with Retry = 1 and N
+    * umP != 0). If the Auto Retry feature is disabled (default), the core wil
+    * l respond with a terminating retry ACK (that is, an ACK transaction pack
+    * et with Retry = 1 and NumP = 0). - 1'b0: Auto Retry Disabled - 1'b1: Aut
+    * o Retry Enabled Note: This bit is also applicable to the device mode.
+    *  PSU_USB3_0_XHCI_GUCTL_USBHSTINAUTORETRYEN                   0x1
 
-    * epi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD40992C, 0x000000FFU ,0x00000000U)
+    * Global User Control Register: This register provides a few options for t
+    * he software to control the core behavior in the Host mode. Most of the o
+    * ptions are used to improve host inter-operability with different devices
+    * .
+    * (OFFSET, MASK, VALUE)      (0XFE20C12C, 0x00004000U ,0x00004000U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_E_ILL3_OFFSET, 0x000000FFU, 0x00000000U);
+	PSU_Mask_Write(USB3_0_XHCI_GUCTL_OFFSET, 0x00004000U, 0x00004000U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_ILL8 @ 0XFD409980
+    * UPDATING TWO PCIE REGISTERS DEFAULT VALUES, AS THESE REGISTERS HAVE INCO
+    * RRECT RESET VALUES IN SILICON.
+    */
+    /*
+    * Register : ATTR_25 @ 0XFD480064
 
-    * ILL calibration code change wait time
-    *  PSU_SERDES_L2_TM_ILL8_ILL_CAL_ITER_WAIT                     0xFF
+    * If TRUE Completion Timeout Disable is supported. This is required to be
+    * TRUE for Endpoint and either setting allowed for Root ports. Drives Devi
+    * ce Capability 2 [4]; EP=0x0001; RP=0x0001
+    *  PSU_PCIE_ATTRIB_ATTR_25_ATTR_CPL_TIMEOUT_DISABLE_SUPPORTED  0X1
 
-    * ILL cal routine control
-    * (OFFSET, MASK, VALUE)      (0XFD409980, 0x000000FFU ,0x000000FFU)
+    * ATTR_25
+    * (OFFSET, MASK, VALUE)      (0XFD480064, 0x00000200U ,0x00000200U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_ILL8_OFFSET, 0x000000FFU, 0x000000FFU);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_25_OFFSET, 0x00000200U, 0x00000200U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_IQ_ILL8 @ 0XFD409914
+    * PCIE SETTINGS
+    */
+    /*
+    * Register : ATTR_7 @ 0XFD48001C
 
-    * IQ ILL polytrim bypass value
-    *  PSU_SERDES_L2_TM_IQ_ILL8_ILL_BYPASS_IQ_POLYTRIM_VAL         0xF7
+    * Specifies mask/settings for Base Address Register (BAR) 0. If BAR is not
+    *  to be implemented, set to 32'h00000000. Bits are defined as follows: Me
+    * mory Space BAR [0] = Mem Space Indicator (set to 0) [2:1] = Type field (
+    * 10 for 64-bit, 00 for 32-bit) [3] = Prefetchable (0 or 1) [31:4] = Mask
+    * for writable bits of BAR; if 32-bit BAR, set uppermost 31:n bits to 1, w
+    * here 2^n=memory aperture size in bytes. If 64-bit BAR, set uppermost 63:
+    * n bits of \'7bBAR1,BAR0\'7d to 1. IO Space BAR 0] = IO Space Indicator (
+    * set to 1) [1] = Reserved (set to 0) [31:2] = Mask for writable bits of B
+    * AR; set uppermost 31:n bits to 1, where 2^n=i/o aperture size in bytes.;
+    *  EP=0x0004; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_7_ATTR_BAR0                            0x0
 
-    * iqpi polytrim
-    * (OFFSET, MASK, VALUE)      (0XFD409914, 0x000000FFU ,0x000000F7U)
+    * ATTR_7
+    * (OFFSET, MASK, VALUE)      (0XFD48001C, 0x0000FFFFU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_IQ_ILL8_OFFSET,
-		0x000000FFU, 0x000000F7U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_7_OFFSET, 0x0000FFFFU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_IQ_ILL9 @ 0XFD409918
+    * Register : ATTR_8 @ 0XFD480020
 
-    * bypass IQ polytrim
-    *  PSU_SERDES_L2_TM_IQ_ILL9_ILL_BYPASS_IQ_POLYTIM              0x1
+    * Specifies mask/settings for Base Address Register (BAR) 0. If BAR is not
+    *  to be implemented, set to 32'h00000000. Bits are defined as follows: Me
+    * mory Space BAR [0] = Mem Space Indicator (set to 0) [2:1] = Type field (
+    * 10 for 64-bit, 00 for 32-bit) [3] = Prefetchable (0 or 1) [31:4] = Mask
+    * for writable bits of BAR; if 32-bit BAR, set uppermost 31:n bits to 1, w
+    * here 2^n=memory aperture size in bytes. If 64-bit BAR, set uppermost 63:
+    * n bits of \'7bBAR1,BAR0\'7d to 1. IO Space BAR 0] = IO Space Indicator (
+    * set to 1) [1] = Reserved (set to 0) [31:2] = Mask for writable bits of B
+    * AR; set uppermost 31:n bits to 1, where 2^n=i/o aperture size in bytes.;
+    *  EP=0xFFF0; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_8_ATTR_BAR0                            0x0
 
-    * enables for lf,constant gm trim and polytirm
-    * (OFFSET, MASK, VALUE)      (0XFD409918, 0x00000001U ,0x00000001U)
+    * ATTR_8
+    * (OFFSET, MASK, VALUE)      (0XFD480020, 0x0000FFFFU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_IQ_ILL9_OFFSET,
-		0x00000001U, 0x00000001U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_8_OFFSET, 0x0000FFFFU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_E_ILL8 @ 0XFD409940
+    * Register : ATTR_9 @ 0XFD480024
 
-    * E ILL polytrim bypass value
-    *  PSU_SERDES_L2_TM_E_ILL8_ILL_BYPASS_E_POLYTRIM_VAL           0xF7
+    * Specifies mask/settings for Base Address Register (BAR) 1 if BAR0 is a 3
+    * 2-bit BAR, or the upper bits of \'7bBAR1,BAR0\'7d if BAR0 is a 64-bit BA
+    * R. If BAR is not to be implemented, set to 32'h00000000. See BAR0 descri
+    * ption if this functions as the upper bits of a 64-bit BAR. Bits are defi
+    * ned as follows: Memory Space BAR (not upper bits of BAR0) [0] = Mem Spac
+    * e Indicator (set to 0) [2:1] = Type field (10 for 64-bit, 00 for 32-bit)
+    *  [3] = Prefetchable (0 or 1) [31:4] = Mask for writable bits of BAR; if
+    * 32-bit BAR, set uppermost 31:n bits to 1, where 2^n=memory aperture size
+    *  in bytes. If 64-bit BAR, set uppermost 63:n bits of \'7bBAR2,BAR1\'7d t
+    * o 1. IO Space BAR 0] = IO Space Indicator (set to 1) [1] = Reserved (set
+    *  to 0) [31:2] = Mask for writable bits of BAR; set uppermost 31:n bits t
+    * o 1, where 2^n=i/o aperture size in bytes.; EP=0xFFFF; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_9_ATTR_BAR1                            0x0
 
-    * epi polytrim
-    * (OFFSET, MASK, VALUE)      (0XFD409940, 0x000000FFU ,0x000000F7U)
+    * ATTR_9
+    * (OFFSET, MASK, VALUE)      (0XFD480024, 0x0000FFFFU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_E_ILL8_OFFSET, 0x000000FFU, 0x000000F7U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_9_OFFSET, 0x0000FFFFU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_E_ILL9 @ 0XFD409944
+    * Register : ATTR_10 @ 0XFD480028
 
-    * bypass E polytrim
-    *  PSU_SERDES_L2_TM_E_ILL9_ILL_BYPASS_E_POLYTIM                0x1
+    * Specifies mask/settings for Base Address Register (BAR) 1 if BAR0 is a 3
+    * 2-bit BAR, or the upper bits of \'7bBAR1,BAR0\'7d if BAR0 is a 64-bit BA
+    * R. If BAR is not to be implemented, set to 32'h00000000. See BAR0 descri
+    * ption if this functions as the upper bits of a 64-bit BAR. Bits are defi
+    * ned as follows: Memory Space BAR (not upper bits of BAR0) [0] = Mem Spac
+    * e Indicator (set to 0) [2:1] = Type field (10 for 64-bit, 00 for 32-bit)
+    *  [3] = Prefetchable (0 or 1) [31:4] = Mask for writable bits of BAR; if
+    * 32-bit BAR, set uppermost 31:n bits to 1, where 2^n=memory aperture size
+    *  in bytes. If 64-bit BAR, set uppermost 63:n bits of \'7bBAR2,BAR1\'7d t
+    * o 1. IO Space BAR 0] = IO Space Indicator (set to 1) [1] = Reserved (set
+    *  to 0) [31:2] = Mask for writable bits of BAR; set uppermost 31:n bits t
+    * o 1, where 2^n=i/o aperture size in bytes.; EP=0xFFFF; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_10_ATTR_BAR1                           0x0
 
-    * enables for lf,constant gm trim and polytirm
-    * (OFFSET, MASK, VALUE)      (0XFD409944, 0x00000001U ,0x00000001U)
+    * ATTR_10
+    * (OFFSET, MASK, VALUE)      (0XFD480028, 0x0000FFFFU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_E_ILL9_OFFSET, 0x00000001U, 0x00000001U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_10_OFFSET, 0x0000FFFFU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_ILL13 @ 0XFD409994
+    * Register : ATTR_11 @ 0XFD48002C
 
-    * ILL cal idle val refcnt
-    *  PSU_SERDES_L2_TM_ILL13_ILL_CAL_IDLE_VAL_REFCNT              0x7
+    * For an endpoint, specifies mask/settings for Base Address Register (BAR)
+    *  2 if BAR1 is a 32-bit BAR, or the upper bits of \'7bBAR2,BAR1\'7d if BA
+    * R1 is the lower part of a 64-bit BAR. If BAR is not to be implemented, s
+    * et to 32'h00000000. See BAR1 description if this functions as the upper
+    * bits of a 64-bit BAR. For a switch or root: This must be set to 00FF_FFF
+    * F. For an endpoint, bits are defined as follows: Memory Space BAR (not u
+    * pper bits of BAR1) [0] = Mem Space Indicator (set to 0) [2:1] = Type fie
+    * ld (10 for 64-bit, 00 for 32-bit) [3] = Prefetchable (0 or 1) [31:4] = M
+    * ask for writable bits of BAR; if 32-bit BAR, set uppermost 31:n bits to
+    * 1, where 2^n=memory aperture size in bytes. If 64-bit BAR, set uppermost
+    *  63:n bits of \'7bBAR3,BAR2\'7d to 1. IO Space BAR 0] = IO Space Indicat
+    * or (set to 1) [1] = Reserved (set to 0) [31:2] = Mask for writable bits
+    * of BAR; set uppermost 31:n bits to 1, where 2^n=i/o aperture size in byt
+    * es.; EP=0x0004; RP=0xFFFF
+    *  PSU_PCIE_ATTRIB_ATTR_11_ATTR_BAR2                           0xFFFF
 
-    * ill cal idle value count
-    * (OFFSET, MASK, VALUE)      (0XFD409994, 0x00000007U ,0x00000007U)
+    * ATTR_11
+    * (OFFSET, MASK, VALUE)      (0XFD48002C, 0x0000FFFFU ,0x0000FFFFU)
     */
-	PSU_Mask_Write(SERDES_L2_TM_ILL13_OFFSET, 0x00000007U, 0x00000007U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_11_OFFSET, 0x0000FFFFU, 0x0000FFFFU);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_MISC2 @ 0XFD40D89C
+    * Register : ATTR_12 @ 0XFD480030
 
-    * ILL calib counts BYPASSED with calcode bits
-    *  PSU_SERDES_L3_TM_MISC2_ILL_CAL_BYPASS_COUNTS                0x1
+    * For an endpoint, specifies mask/settings for Base Address Register (BAR)
+    *  2 if BAR1 is a 32-bit BAR, or the upper bits of \'7bBAR2,BAR1\'7d if BA
+    * R1 is the lower part of a 64-bit BAR. If BAR is not to be implemented, s
+    * et to 32'h00000000. See BAR1 description if this functions as the upper
+    * bits of a 64-bit BAR. For a switch or root: This must be set to 00FF_FFF
+    * F. For an endpoint, bits are defined as follows: Memory Space BAR (not u
+    * pper bits of BAR1) [0] = Mem Space Indicator (set to 0) [2:1] = Type fie
+    * ld (10 for 64-bit, 00 for 32-bit) [3] = Prefetchable (0 or 1) [31:4] = M
+    * ask for writable bits of BAR; if 32-bit BAR, set uppermost 31:n bits to
+    * 1, where 2^n=memory aperture size in bytes. If 64-bit BAR, set uppermost
+    *  63:n bits of \'7bBAR3,BAR2\'7d to 1. IO Space BAR 0] = IO Space Indicat
+    * or (set to 1) [1] = Reserved (set to 0) [31:2] = Mask for writable bits
+    * of BAR; set uppermost 31:n bits to 1, where 2^n=i/o aperture size in byt
+    * es.; EP=0xFFF0; RP=0x00FF
+    *  PSU_PCIE_ATTRIB_ATTR_12_ATTR_BAR2                           0xFF
 
-    * sampler cal
-    * (OFFSET, MASK, VALUE)      (0XFD40D89C, 0x00000080U ,0x00000080U)
+    * ATTR_12
+    * (OFFSET, MASK, VALUE)      (0XFD480030, 0x0000FFFFU ,0x000000FFU)
     */
-	PSU_Mask_Write(SERDES_L3_TM_MISC2_OFFSET, 0x00000080U, 0x00000080U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_12_OFFSET, 0x0000FFFFU, 0x000000FFU);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_IQ_ILL1 @ 0XFD40D8F8
+    * Register : ATTR_13 @ 0XFD480034
 
-    * IQ ILL F0 CALCODE bypass value. MPHY : G1a, PCIE : Gen 1, SATA : Gen1 ,
-    * USB3 : SS
-    *  PSU_SERDES_L3_TM_IQ_ILL1_ILL_BYPASS_IQ_CALCODE_F0           0x7D
+    * For an endpoint, specifies mask/settings for Base Address Register (BAR)
+    *  3 if BAR2 is a 32-bit BAR, or the upper bits of \'7bBAR3,BAR2\'7d if BA
+    * R2 is the lower part of a 64-bit BAR. If BAR is not to be implemented, s
+    * et to 32'h00000000. See BAR2 description if this functions as the upper
+    * bits of a 64-bit BAR. For a switch or root, this must be set to: FFFF_00
+    * 00 = IO Limit/Base Registers not implemented FFFF_F0F0 = IO Limit/Base R
+    * egisters use 16-bit decode FFFF_F1F1 = IO Limit/Base Registers use 32-bi
+    * t decode For an endpoint, bits are defined as follows: Memory Space BAR
+    * (not upper bits of BAR2) [0] = Mem Space Indicator (set to 0) [2:1] = Ty
+    * pe field (10 for 64-bit, 00 for 32-bit) [3] = Prefetchable (0 or 1) [31:
+    * 4] = Mask for writable bits of BAR; if 32-bit BAR, set uppermost 31:n bi
+    * ts to 1, where 2^n=memory aperture size in bytes. If 64-bit BAR, set upp
+    * ermost 63:n bits of \'7bBAR4,BAR3\'7d to 1. IO Space BAR 0] = IO Space I
+    * ndicator (set to 1) [1] = Reserved (set to 0) [31:2] = Mask for writable
+    *  bits of BAR; set uppermost 31:n bits to 1, where 2^n=i/o aperture size
+    * in bytes.; EP=0xFFFF; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_13_ATTR_BAR3                           0x0
 
-    * iqpi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD40D8F8, 0x000000FFU ,0x0000007DU)
+    * ATTR_13
+    * (OFFSET, MASK, VALUE)      (0XFD480034, 0x0000FFFFU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_IQ_ILL1_OFFSET,
-		0x000000FFU, 0x0000007DU);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_13_OFFSET, 0x0000FFFFU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_IQ_ILL2 @ 0XFD40D8FC
+    * Register : ATTR_14 @ 0XFD480038
 
-    * IQ ILL F1 CALCODE bypass value. MPHY : G1b, PCIE : Gen2, SATA: Gen2
-    *  PSU_SERDES_L3_TM_IQ_ILL2_ILL_BYPASS_IQ_CALCODE_F1           0x7D
+    * For an endpoint, specifies mask/settings for Base Address Register (BAR)
+    *  3 if BAR2 is a 32-bit BAR, or the upper bits of \'7bBAR3,BAR2\'7d if BA
+    * R2 is the lower part of a 64-bit BAR. If BAR is not to be implemented, s
+    * et to 32'h00000000. See BAR2 description if this functions as the upper
+    * bits of a 64-bit BAR. For a switch or root, this must be set to: FFFF_00
+    * 00 = IO Limit/Base Registers not implemented FFFF_F0F0 = IO Limit/Base R
+    * egisters use 16-bit decode FFFF_F1F1 = IO Limit/Base Registers use 32-bi
+    * t decode For an endpoint, bits are defined as follows: Memory Space BAR
+    * (not upper bits of BAR2) [0] = Mem Space Indicator (set to 0) [2:1] = Ty
+    * pe field (10 for 64-bit, 00 for 32-bit) [3] = Prefetchable (0 or 1) [31:
+    * 4] = Mask for writable bits of BAR; if 32-bit BAR, set uppermost 31:n bi
+    * ts to 1, where 2^n=memory aperture size in bytes. If 64-bit BAR, set upp
+    * ermost 63:n bits of \'7bBAR4,BAR3\'7d to 1. IO Space BAR 0] = IO Space I
+    * ndicator (set to 1) [1] = Reserved (set to 0) [31:2] = Mask for writable
+    *  bits of BAR; set uppermost 31:n bits to 1, where 2^n=i/o aperture size
+    * in bytes.; EP=0xFFFF; RP=0xFFFF
+    *  PSU_PCIE_ATTRIB_ATTR_14_ATTR_BAR3                           0xFFFF
 
-    * iqpi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD40D8FC, 0x000000FFU ,0x0000007DU)
+    * ATTR_14
+    * (OFFSET, MASK, VALUE)      (0XFD480038, 0x0000FFFFU ,0x0000FFFFU)
     */
-	PSU_Mask_Write(SERDES_L3_TM_IQ_ILL2_OFFSET,
-		0x000000FFU, 0x0000007DU);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_14_OFFSET, 0x0000FFFFU, 0x0000FFFFU);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_ILL12 @ 0XFD40D990
+    * Register : ATTR_15 @ 0XFD48003C
 
-    * G1A pll ctr bypass value
-    *  PSU_SERDES_L3_TM_ILL12_G1A_PLL_CTR_BYP_VAL                  0x1
+    * For an endpoint, specifies mask/settings for Base Address Register (BAR)
+    *  4 if BAR3 is a 32-bit BAR, or the upper bits of \'7bBAR4,BAR3\'7d if BA
+    * R3 is the lower part of a 64-bit BAR. If BAR is not to be implemented, s
+    * et to 32'h00000000. See BAR3 description if this functions as the upper
+    * bits of a 64-bit BAR. For a switch or root: This must be set to FFF0_FFF
+    * 0. For an endpoint, bits are defined as follows: Memory Space BAR (not u
+    * pper bits of BAR3) [0] = Mem Space Indicator (set to 0) [2:1] = Type fie
+    * ld (10 for 64-bit, 00 for 32-bit) [3] = Prefetchable (0 or 1) [31:4] = M
+    * ask for writable bits of BAR; if 32-bit BAR, set uppermost 31:n bits to
+    * 1, where 2^n=memory aperture size in bytes. If 64-bit BAR, set uppermost
+    *  63:n bits of \'7bBAR5,BAR4\'7d to 1. IO Space BAR 0] = IO Space Indicat
+    * or (set to 1) [1] = Reserved (set to 0) [31:2] = Mask for writable bits
+    * of BAR; set uppermost 31:n bits to 1, where 2^n=i/o aperture size in byt
+    * es.; EP=0x0004; RP=0xFFF0
+    *  PSU_PCIE_ATTRIB_ATTR_15_ATTR_BAR4                           0xFFF0
 
-    * ill pll counter values
-    * (OFFSET, MASK, VALUE)      (0XFD40D990, 0x000000FFU ,0x00000001U)
+    * ATTR_15
+    * (OFFSET, MASK, VALUE)      (0XFD48003C, 0x0000FFFFU ,0x0000FFF0U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_ILL12_OFFSET, 0x000000FFU, 0x00000001U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_15_OFFSET, 0x0000FFFFU, 0x0000FFF0U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_E_ILL1 @ 0XFD40D924
+    * Register : ATTR_16 @ 0XFD480040
 
-    * E ILL F0 CALCODE bypass value. MPHY : G1a, PCIE : Gen 1, SATA : Gen1 , U
-    * SB3 : SS
-    *  PSU_SERDES_L3_TM_E_ILL1_ILL_BYPASS_E_CALCODE_F0             0x9C
+    * For an endpoint, specifies mask/settings for Base Address Register (BAR)
+    *  4 if BAR3 is a 32-bit BAR, or the upper bits of \'7bBAR4,BAR3\'7d if BA
+    * R3 is the lower part of a 64-bit BAR. If BAR is not to be implemented, s
+    * et to 32'h00000000. See BAR3 description if this functions as the upper
+    * bits of a 64-bit BAR. For a switch or root: This must be set to FFF0_FFF
+    * 0. For an endpoint, bits are defined as follows: Memory Space BAR (not u
+    * pper bits of BAR3) [0] = Mem Space Indicator (set to 0) [2:1] = Type fie
+    * ld (10 for 64-bit, 00 for 32-bit) [3] = Prefetchable (0 or 1) [31:4] = M
+    * ask for writable bits of BAR; if 32-bit BAR, set uppermost 31:n bits to
+    * 1, where 2^n=memory aperture size in bytes. If 64-bit BAR, set uppermost
+    *  63:n bits of \'7bBAR5,BAR4\'7d to 1. IO Space BAR 0] = IO Space Indicat
+    * or (set to 1) [1] = Reserved (set to 0) [31:2] = Mask for writable bits
+    * of BAR; set uppermost 31:n bits to 1, where 2^n=i/o aperture size in byt
+    * es.; EP=0xFFF0; RP=0xFFF0
+    *  PSU_PCIE_ATTRIB_ATTR_16_ATTR_BAR4                           0xFFF0
 
-    * epi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD40D924, 0x000000FFU ,0x0000009CU)
+    * ATTR_16
+    * (OFFSET, MASK, VALUE)      (0XFD480040, 0x0000FFFFU ,0x0000FFF0U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_E_ILL1_OFFSET, 0x000000FFU, 0x0000009CU);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_16_OFFSET, 0x0000FFFFU, 0x0000FFF0U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_E_ILL2 @ 0XFD40D928
+    * Register : ATTR_17 @ 0XFD480044
 
-    * E ILL F1 CALCODE bypass value. MPHY : G1b, PCIE : Gen2, SATA: Gen2
-    *  PSU_SERDES_L3_TM_E_ILL2_ILL_BYPASS_E_CALCODE_F1             0x39
+    * For an endpoint, specifies mask/settings for Base Address Register (BAR)
+    *  5 if BAR4 is a 32-bit BAR, or the upper bits of \'7bBAR5,BAR4\'7d if BA
+    * R4 is the lower part of a 64-bit BAR. If BAR is not to be implemented, s
+    * et to 32'h00000000. See BAR4 description if this functions as the upper
+    * bits of a 64-bit BAR. For a switch or root, this must be set to: 0000_00
+    * 00 = Prefetchable Memory Limit/Base Registers not implemented FFF0_FFF0
+    * = 32-bit Prefetchable Memory Limit/Base implemented FFF1_FFF1 = 64-bit P
+    * refetchable Memory Limit/Base implemented For an endpoint, bits are defi
+    * ned as follows: Memory Space BAR (not upper bits of BAR4) [0] = Mem Spac
+    * e Indicator (set to 0) [2:1] = Type field (00 for 32-bit; BAR5 cannot be
+    *  lower part of a 64-bit BAR) [3] = Prefetchable (0 or 1) [31:4] = Mask f
+    * or writable bits of BAR; set uppermost 31:n bits to 1, where 2^n=memory
+    * aperture size in bytes. IO Space BAR 0] = IO Space Indicator (set to 1)
+    * [1] = Reserved (set to 0) [31:2] = Mask for writable bits of BAR; set up
+    * permost 31:n bits to 1, where 2^n=i/o aperture size in bytes.; EP=0xFFFF
+    * ; RP=0xFFF1
+    *  PSU_PCIE_ATTRIB_ATTR_17_ATTR_BAR5                           0xFFF1
 
-    * epi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD40D928, 0x000000FFU ,0x00000039U)
+    * ATTR_17
+    * (OFFSET, MASK, VALUE)      (0XFD480044, 0x0000FFFFU ,0x0000FFF1U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_E_ILL2_OFFSET, 0x000000FFU, 0x00000039U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_17_OFFSET, 0x0000FFFFU, 0x0000FFF1U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_ILL11 @ 0XFD40D98C
+    * Register : ATTR_18 @ 0XFD480048
 
-    * G2A_PCIe1 PLL ctr bypass value
-    *  PSU_SERDES_L3_TM_ILL11_G2A_PCIEG1_PLL_CTR_11_8_BYP_VAL      0x2
+    * For an endpoint, specifies mask/settings for Base Address Register (BAR)
+    *  5 if BAR4 is a 32-bit BAR, or the upper bits of \'7bBAR5,BAR4\'7d if BA
+    * R4 is the lower part of a 64-bit BAR. If BAR is not to be implemented, s
+    * et to 32'h00000000. See BAR4 description if this functions as the upper
+    * bits of a 64-bit BAR. For a switch or root, this must be set to: 0000_00
+    * 00 = Prefetchable Memory Limit/Base Registers not implemented FFF0_FFF0
+    * = 32-bit Prefetchable Memory Limit/Base implemented FFF1_FFF1 = 64-bit P
+    * refetchable Memory Limit/Base implemented For an endpoint, bits are defi
+    * ned as follows: Memory Space BAR (not upper bits of BAR4) [0] = Mem Spac
+    * e Indicator (set to 0) [2:1] = Type field (00 for 32-bit; BAR5 cannot be
+    *  lower part of a 64-bit BAR) [3] = Prefetchable (0 or 1) [31:4] = Mask f
+    * or writable bits of BAR; set uppermost 31:n bits to 1, where 2^n=memory
+    * aperture size in bytes. IO Space BAR 0] = IO Space Indicator (set to 1)
+    * [1] = Reserved (set to 0) [31:2] = Mask for writable bits of BAR; set up
+    * permost 31:n bits to 1, where 2^n=i/o aperture size in bytes.; EP=0xFFFF
+    * ; RP=0xFFF1
+    *  PSU_PCIE_ATTRIB_ATTR_18_ATTR_BAR5                           0xFFF1
 
-    * ill pll counter values
-    * (OFFSET, MASK, VALUE)      (0XFD40D98C, 0x000000F0U ,0x00000020U)
+    * ATTR_18
+    * (OFFSET, MASK, VALUE)      (0XFD480048, 0x0000FFFFU ,0x0000FFF1U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_ILL11_OFFSET, 0x000000F0U, 0x00000020U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_18_OFFSET, 0x0000FFFFU, 0x0000FFF1U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_IQ_ILL3 @ 0XFD40D900
-
-    * IQ ILL F2CALCODE bypass value. MPHY : G2a, SATA : Gen3
-    *  PSU_SERDES_L3_TM_IQ_ILL3_ILL_BYPASS_IQ_CALCODE_F2           0x7D
-
-    * iqpi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD40D900, 0x000000FFU ,0x0000007DU)
-    */
-	PSU_Mask_Write(SERDES_L3_TM_IQ_ILL3_OFFSET,
-		0x000000FFU, 0x0000007DU);
-/*##################################################################### */
+    * Register : ATTR_27 @ 0XFD48006C
 
-    /*
-    * Register : L3_TM_E_ILL3 @ 0XFD40D92C
+    * Specifies maximum payload supported. Valid settings are: 0- 128 bytes, 1
+    * - 256 bytes, 2- 512 bytes, 3- 1024 bytes. Transferred to the Device Capa
+    * bilities register. The values: 4-2048 bytes, 5- 4096 bytes are not suppo
+    * rted; EP=0x0001; RP=0x0001
+    *  PSU_PCIE_ATTRIB_ATTR_27_ATTR_DEV_CAP_MAX_PAYLOAD_SUPPORTED  1
 
-    * E ILL F2CALCODE bypass value. MPHY : G2a, SATA : Gen3
-    *  PSU_SERDES_L3_TM_E_ILL3_ILL_BYPASS_E_CALCODE_F2             0x64
+    * Endpoint L1 Acceptable Latency. Records the latency that the endpoint ca
+    * n withstand on transitions from L1 state to L0 (if L1 state supported).
+    * Valid settings are: 0h less than 1us, 1h 1 to 2us, 2h 2 to 4us, 3h 4 to
+    * 8us, 4h 8 to 16us, 5h 16 to 32us, 6h 32 to 64us, 7h more than 64us. For
+    * Endpoints only. Must be 0h for other devices.; EP=0x0007; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_27_ATTR_DEV_CAP_ENDPOINT_L1_LATENCY    0x0
 
-    * epi cal code
-    * (OFFSET, MASK, VALUE)      (0XFD40D92C, 0x000000FFU ,0x00000064U)
+    * ATTR_27
+    * (OFFSET, MASK, VALUE)      (0XFD48006C, 0x00000738U ,0x00000100U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_E_ILL3_OFFSET, 0x000000FFU, 0x00000064U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_27_OFFSET, 0x00000738U, 0x00000100U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_ILL8 @ 0XFD40D980
+    * Register : ATTR_50 @ 0XFD4800C8
 
-    * ILL calibration code change wait time
-    *  PSU_SERDES_L3_TM_ILL8_ILL_CAL_ITER_WAIT                     0xFF
+    * Identifies the type of device/port as follows: 0000b PCI Express Endpoin
+    * t device, 0001b Legacy PCI Express Endpoint device, 0100b Root Port of P
+    * CI Express Root Complex, 0101b Upstream Port of PCI Express Switch, 0110
+    * b Downstream Port of PCI Express Switch, 0111b PCIE Express to PCI/PCI-X
+    *  Bridge, 1000b PCI/PCI-X to PCI Express Bridge. Transferred to PCI Expre
+    * ss Capabilities register. Must be consistent with IS_SWITCH and UPSTREAM
+    * _FACING settings.; EP=0x0000; RP=0x0004
+    *  PSU_PCIE_ATTRIB_ATTR_50_ATTR_PCIE_CAP_DEVICE_PORT_TYPE      4
 
-    * ILL cal routine control
-    * (OFFSET, MASK, VALUE)      (0XFD40D980, 0x000000FFU ,0x000000FFU)
+    * PCIe Capability's Next Capability Offset pointer to the next item in the
+    *  capabilities list, or 00h if this is the final capability.; EP=0x009C;
+    * RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_50_ATTR_PCIE_CAP_NEXTPTR               0
+
+    * ATTR_50
+    * (OFFSET, MASK, VALUE)      (0XFD4800C8, 0x0000FFF0U ,0x00000040U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_ILL8_OFFSET, 0x000000FFU, 0x000000FFU);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_50_OFFSET, 0x0000FFF0U, 0x00000040U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_IQ_ILL8 @ 0XFD40D914
+    * Register : ATTR_105 @ 0XFD4801A4
 
-    * IQ ILL polytrim bypass value
-    *  PSU_SERDES_L3_TM_IQ_ILL8_ILL_BYPASS_IQ_POLYTRIM_VAL         0xF7
+    * Number of credits that should be advertised for Completion data received
+    *  on Virtual Channel 0. The bytes advertised must be less than or equal t
+    * o the bram bytes available. See VC0_RX_RAM_LIMIT; EP=0x0172; RP=0x00CD
+    *  PSU_PCIE_ATTRIB_ATTR_105_ATTR_VC0_TOTAL_CREDITS_CD          0xCD
 
-    * iqpi polytrim
-    * (OFFSET, MASK, VALUE)      (0XFD40D914, 0x000000FFU ,0x000000F7U)
+    * ATTR_105
+    * (OFFSET, MASK, VALUE)      (0XFD4801A4, 0x000007FFU ,0x000000CDU)
     */
-	PSU_Mask_Write(SERDES_L3_TM_IQ_ILL8_OFFSET,
-		0x000000FFU, 0x000000F7U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_105_OFFSET,
+		0x000007FFU, 0x000000CDU);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_IQ_ILL9 @ 0XFD40D918
+    * Register : ATTR_106 @ 0XFD4801A8
 
-    * bypass IQ polytrim
-    *  PSU_SERDES_L3_TM_IQ_ILL9_ILL_BYPASS_IQ_POLYTIM              0x1
+    * Number of credits that should be advertised for Completion headers recei
+    * ved on Virtual Channel 0. The sum of the posted, non posted, and complet
+    * ion header credits must be <= 80; EP=0x0048; RP=0x0024
+    *  PSU_PCIE_ATTRIB_ATTR_106_ATTR_VC0_TOTAL_CREDITS_CH          0x24
 
-    * enables for lf,constant gm trim and polytirm
-    * (OFFSET, MASK, VALUE)      (0XFD40D918, 0x00000001U ,0x00000001U)
+    * Number of credits that should be advertised for Non-Posted headers recei
+    * ved on Virtual Channel 0. The number of non posted data credits advertis
+    * ed by the block is equal to the number of non posted header credits. The
+    *  sum of the posted, non posted, and completion header credits must be <=
+    *  80; EP=0x0004; RP=0x000C
+    *  PSU_PCIE_ATTRIB_ATTR_106_ATTR_VC0_TOTAL_CREDITS_NPH         0xC
+
+    * ATTR_106
+    * (OFFSET, MASK, VALUE)      (0XFD4801A8, 0x00003FFFU ,0x00000624U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_IQ_ILL9_OFFSET,
-		0x00000001U, 0x00000001U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_106_OFFSET,
+		0x00003FFFU, 0x00000624U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_E_ILL8 @ 0XFD40D940
+    * Register : ATTR_107 @ 0XFD4801AC
 
-    * E ILL polytrim bypass value
-    *  PSU_SERDES_L3_TM_E_ILL8_ILL_BYPASS_E_POLYTRIM_VAL           0xF7
+    * Number of credits that should be advertised for Non-Posted data received
+    *  on Virtual Channel 0. The number of non posted data credits advertised
+    * by the block is equal to two times the number of non posted header credi
+    * ts if atomic operations are supported or is equal to the number of non p
+    * osted header credits if atomic operations are not supported. The bytes a
+    * dvertised must be less than or equal to the bram bytes available. See VC
+    * 0_RX_RAM_LIMIT; EP=0x0008; RP=0x0018
+    *  PSU_PCIE_ATTRIB_ATTR_107_ATTR_VC0_TOTAL_CREDITS_NPD         0x18
 
-    * epi polytrim
-    * (OFFSET, MASK, VALUE)      (0XFD40D940, 0x000000FFU ,0x000000F7U)
+    * ATTR_107
+    * (OFFSET, MASK, VALUE)      (0XFD4801AC, 0x000007FFU ,0x00000018U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_E_ILL8_OFFSET, 0x000000FFU, 0x000000F7U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_107_OFFSET,
+		0x000007FFU, 0x00000018U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_E_ILL9 @ 0XFD40D944
+    * Register : ATTR_108 @ 0XFD4801B0
 
-    * bypass E polytrim
-    *  PSU_SERDES_L3_TM_E_ILL9_ILL_BYPASS_E_POLYTIM                0x1
+    * Number of credits that should be advertised for Posted data received on
+    * Virtual Channel 0. The bytes advertised must be less than or equal to th
+    * e bram bytes available. See VC0_RX_RAM_LIMIT; EP=0x0020; RP=0x00B5
+    *  PSU_PCIE_ATTRIB_ATTR_108_ATTR_VC0_TOTAL_CREDITS_PD          0xB5
 
-    * enables for lf,constant gm trim and polytirm
-    * (OFFSET, MASK, VALUE)      (0XFD40D944, 0x00000001U ,0x00000001U)
+    * ATTR_108
+    * (OFFSET, MASK, VALUE)      (0XFD4801B0, 0x000007FFU ,0x000000B5U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_E_ILL9_OFFSET, 0x00000001U, 0x00000001U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_108_OFFSET,
+		0x000007FFU, 0x000000B5U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_ILL13 @ 0XFD40D994
+    * Register : ATTR_109 @ 0XFD4801B4
 
-    * ILL cal idle val refcnt
-    *  PSU_SERDES_L3_TM_ILL13_ILL_CAL_IDLE_VAL_REFCNT              0x7
+    * Not currently in use. Invert ECRC generated by block when trn_tecrc_gen_
+    * n and trn_terrfwd_n are asserted.; EP=0x0000; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_109_ATTR_TECRC_EP_INV                  0x0
 
-    * ill cal idle value count
-    * (OFFSET, MASK, VALUE)      (0XFD40D994, 0x00000007U ,0x00000007U)
-    */
-	PSU_Mask_Write(SERDES_L3_TM_ILL13_OFFSET, 0x00000007U, 0x00000007U);
-/*##################################################################### */
+    * Enables td bit clear and ECRC trim on received TLP's FALSE == don't trim
+    *  TRUE == trim.; EP=0x0001; RP=0x0001
+    *  PSU_PCIE_ATTRIB_ATTR_109_ATTR_RECRC_CHK_TRIM                0x1
 
-    /*
-    * SYMBOL LOCK AND WAIT
-    */
-    /*
-    * Register : L0_TM_DIG_10 @ 0XFD40107C
+    * Enables ECRC check on received TLP's 0 == don't check 1 == always check
+    * 3 == check if enabled by ECRC check enable bit of AER cap structure; EP=
+    * 0x0003; RP=0x0003
+    *  PSU_PCIE_ATTRIB_ATTR_109_ATTR_RECRC_CHK                     0x3
 
-    * CDR lock wait time. (1-16 us). cdr_lock_wait_time = 4'b xxxx + 4'b 0001
-    *  PSU_SERDES_L0_TM_DIG_10_CDR_BIT_LOCK_TIME                   0x1
+    * Index of last packet buffer used by TX TLM (i.e. number of buffers - 1).
+    *  Calculated from max payload size supported and the number of brams conf
+    * igured for transmit; EP=0x001C; RP=0x001C
+    *  PSU_PCIE_ATTRIB_ATTR_109_ATTR_VC0_TX_LASTPACKET             0x1c
 
-    * test control for changing cdr lock wait time
-    * (OFFSET, MASK, VALUE)      (0XFD40107C, 0x0000000FU ,0x00000001U)
+    * Number of credits that should be advertised for Posted headers received
+    * on Virtual Channel 0. The sum of the posted, non posted, and completion
+    * header credits must be <= 80; EP=0x0004; RP=0x0020
+    *  PSU_PCIE_ATTRIB_ATTR_109_ATTR_VC0_TOTAL_CREDITS_PH          0x20
+
+    * ATTR_109
+    * (OFFSET, MASK, VALUE)      (0XFD4801B4, 0x0000FFFFU ,0x00007E20U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_DIG_10_OFFSET, 0x0000000FU, 0x00000001U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_109_OFFSET,
+		0x0000FFFFU, 0x00007E20U);
 /*##################################################################### */
 
     /*
-    * Register : L1_TM_DIG_10 @ 0XFD40507C
+    * Register : ATTR_34 @ 0XFD480088
 
-    * CDR lock wait time. (1-16 us). cdr_lock_wait_time = 4'b xxxx + 4'b 0001
-    *  PSU_SERDES_L1_TM_DIG_10_CDR_BIT_LOCK_TIME                   0x1
+    * Specifies values to be transferred to Header Type register. Bit 7 should
+    *  be set to '0' indicating single-function device. Bit 0 identifies heade
+    * r as Type 0 or Type 1, with '0' indicating a Type 0 header.; EP=0x0000;
+    * RP=0x0001
+    *  PSU_PCIE_ATTRIB_ATTR_34_ATTR_HEADER_TYPE                    0x1
 
-    * test control for changing cdr lock wait time
-    * (OFFSET, MASK, VALUE)      (0XFD40507C, 0x0000000FU ,0x00000001U)
+    * ATTR_34
+    * (OFFSET, MASK, VALUE)      (0XFD480088, 0x000000FFU ,0x00000001U)
     */
-	PSU_Mask_Write(SERDES_L1_TM_DIG_10_OFFSET, 0x0000000FU, 0x00000001U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_34_OFFSET, 0x000000FFU, 0x00000001U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_DIG_10 @ 0XFD40907C
+    * Register : ATTR_53 @ 0XFD4800D4
 
-    * CDR lock wait time. (1-16 us). cdr_lock_wait_time = 4'b xxxx + 4'b 0001
-    *  PSU_SERDES_L2_TM_DIG_10_CDR_BIT_LOCK_TIME                   0x1
+    * PM Capability's Next Capability Offset pointer to the next item in the c
+    * apabilities list, or 00h if this is the final capability.; EP=0x0048; RP
+    * =0x0060
+    *  PSU_PCIE_ATTRIB_ATTR_53_ATTR_PM_CAP_NEXTPTR                 0x60
 
-    * test control for changing cdr lock wait time
-    * (OFFSET, MASK, VALUE)      (0XFD40907C, 0x0000000FU ,0x00000001U)
+    * ATTR_53
+    * (OFFSET, MASK, VALUE)      (0XFD4800D4, 0x000000FFU ,0x00000060U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_DIG_10_OFFSET, 0x0000000FU, 0x00000001U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_53_OFFSET, 0x000000FFU, 0x00000060U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_DIG_10 @ 0XFD40D07C
+    * Register : ATTR_41 @ 0XFD4800A4
 
-    * CDR lock wait time. (1-16 us). cdr_lock_wait_time = 4'b xxxx + 4'b 0001
-    *  PSU_SERDES_L3_TM_DIG_10_CDR_BIT_LOCK_TIME                   0x1
+    * MSI Per-Vector Masking Capable. The value is transferred to the MSI Cont
+    * rol Register[8]. When set, adds Mask and Pending Dword to Cap structure;
+    *  EP=0x0000; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_41_ATTR_MSI_CAP_PER_VECTOR_MASKING_CAPABLE 0x0
 
-    * test control for changing cdr lock wait time
-    * (OFFSET, MASK, VALUE)      (0XFD40D07C, 0x0000000FU ,0x00000001U)
-    */
-	PSU_Mask_Write(SERDES_L3_TM_DIG_10_OFFSET, 0x0000000FU, 0x00000001U);
-/*##################################################################### */
+    * Indicates that the MSI structures exists. If this is FALSE, then the MSI
+    *  structure cannot be accessed via either the link or the management port
+    * .; EP=0x0001; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_41_ATTR_MSI_CAP_ON                     0
 
-    /*
-    * SIOU SETTINGS FOR BYPASS CONTROL,HSRX-DIG
-    */
-    /*
-    * Register : L0_TM_RST_DLY @ 0XFD4019A4
+    * MSI Capability's Next Capability Offset pointer to the next item in the
+    * capabilities list, or 00h if this is the final capability.; EP=0x0060; R
+    * P=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_41_ATTR_MSI_CAP_NEXTPTR                0x0
 
-    * Delay apb reset by specified amount
-    *  PSU_SERDES_L0_TM_RST_DLY_APB_RST_DLY                        0xFF
+    * Indicates that the MSI structures exists. If this is FALSE, then the MSI
+    *  structure cannot be accessed via either the link or the management port
+    * .; EP=0x0001; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_41_ATTR_MSI_CAP_ON                     0
 
-    * reset delay for apb reset w.r.t pso of hsrx
-    * (OFFSET, MASK, VALUE)      (0XFD4019A4, 0x000000FFU ,0x000000FFU)
+    * ATTR_41
+    * (OFFSET, MASK, VALUE)      (0XFD4800A4, 0x000003FFU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_RST_DLY_OFFSET,
-		0x000000FFU, 0x000000FFU);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_41_OFFSET, 0x000003FFU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L0_TM_ANA_BYP_15 @ 0XFD401038
+    * Register : ATTR_97 @ 0XFD480184
 
-    * Enable Bypass for <7> of TM_ANA_BYPS_15
-    *  PSU_SERDES_L0_TM_ANA_BYP_15_FORCE_UPHY_ENABLE_LOW_LEAKAGE   0x1
+    * Maximum Link Width. Valid settings are: 000001b x1, 000010b x2, 000100b
+    * x4, 001000b x8.; EP=0x0004; RP=0x0004
+    *  PSU_PCIE_ATTRIB_ATTR_97_ATTR_LINK_CAP_MAX_LINK_WIDTH        0x1
 
-    * Bypass control for pcs-pma interface. EQ supplies, main master supply an
-    * d ps for samp c2c
-    * (OFFSET, MASK, VALUE)      (0XFD401038, 0x00000040U ,0x00000040U)
+    * Used by LTSSM to set Maximum Link Width. Valid settings are: 000001b [x1
+    * ], 000010b [x2], 000100b [x4], 001000b [x8].; EP=0x0004; RP=0x0004
+    *  PSU_PCIE_ATTRIB_ATTR_97_ATTR_LTSSM_MAX_LINK_WIDTH           0x1
+
+    * ATTR_97
+    * (OFFSET, MASK, VALUE)      (0XFD480184, 0x00000FFFU ,0x00000041U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_ANA_BYP_15_OFFSET,
-		0x00000040U, 0x00000040U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_97_OFFSET, 0x00000FFFU, 0x00000041U);
 /*##################################################################### */
 
     /*
-    * Register : L0_TM_ANA_BYP_12 @ 0XFD40102C
+    * Register : ATTR_100 @ 0XFD480190
 
-    * Enable Bypass for <7> of TM_ANA_BYPS_12
-    *  PSU_SERDES_L0_TM_ANA_BYP_12_FORCE_UPHY_PSO_HSRXDIG          0x1
+    * TRUE specifies upstream-facing port. FALSE specifies downstream-facing p
+    * ort.; EP=0x0001; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_100_ATTR_UPSTREAM_FACING               0x0
 
-    * Bypass control for pcs-pma interface. Hsrx supply, hsrx des, and cdr ena
-    * ble controls
-    * (OFFSET, MASK, VALUE)      (0XFD40102C, 0x00000040U ,0x00000040U)
+    * ATTR_100
+    * (OFFSET, MASK, VALUE)      (0XFD480190, 0x00000040U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_ANA_BYP_12_OFFSET,
-		0x00000040U, 0x00000040U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_100_OFFSET,
+		0x00000040U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L1_TM_RST_DLY @ 0XFD4059A4
+    * Register : ATTR_101 @ 0XFD480194
 
-    * Delay apb reset by specified amount
-    *  PSU_SERDES_L1_TM_RST_DLY_APB_RST_DLY                        0xFF
+    * Enable the routing of message TLPs to the user through the TRN RX interf
+    * ace. A bit value of 1 enables routing of the message TLP to the user. Me
+    * ssages are always decoded by the message decoder. Bit 0 - ERR COR, Bit 1
+    *  - ERR NONFATAL, Bit 2 - ERR FATAL, Bit 3 - INTA Bit 4 - INTB, Bit 5 - I
+    * NTC, Bit 6 - INTD, Bit 7 PM_PME, Bit 8 - PME_TO_ACK, Bit 9 - unlock, Bit
+    *  10 PME_Turn_Off; EP=0x0000; RP=0x07FF
+    *  PSU_PCIE_ATTRIB_ATTR_101_ATTR_ENABLE_MSG_ROUTE              0x7FF
 
-    * reset delay for apb reset w.r.t pso of hsrx
-    * (OFFSET, MASK, VALUE)      (0XFD4059A4, 0x000000FFU ,0x000000FFU)
+    * Disable BAR filtering. Does not change the behavior of the bar hit outpu
+    * ts; EP=0x0000; RP=0x0001
+    *  PSU_PCIE_ATTRIB_ATTR_101_ATTR_DISABLE_BAR_FILTERING         0x1
+
+    * ATTR_101
+    * (OFFSET, MASK, VALUE)      (0XFD480194, 0x0000FFE2U ,0x0000FFE2U)
     */
-	PSU_Mask_Write(SERDES_L1_TM_RST_DLY_OFFSET,
-		0x000000FFU, 0x000000FFU);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_101_OFFSET,
+		0x0000FFE2U, 0x0000FFE2U);
 /*##################################################################### */
 
     /*
-    * Register : L1_TM_ANA_BYP_15 @ 0XFD405038
+    * Register : ATTR_37 @ 0XFD480094
 
-    * Enable Bypass for <7> of TM_ANA_BYPS_15
-    *  PSU_SERDES_L1_TM_ANA_BYP_15_FORCE_UPHY_ENABLE_LOW_LEAKAGE   0x1
+    * Link Bandwidth notification capability. Indicates support for the link b
+    * andwidth notification status and interrupt mechanism. Required for Root.
+    * ; EP=0x0000; RP=0x0001
+    *  PSU_PCIE_ATTRIB_ATTR_37_ATTR_LINK_CAP_LINK_BANDWIDTH_NOTIFICATION_CAP 0x1
 
-    * Bypass control for pcs-pma interface. EQ supplies, main master supply an
-    * d ps for samp c2c
-    * (OFFSET, MASK, VALUE)      (0XFD405038, 0x00000040U ,0x00000040U)
+    * Maximum Link Speed. Valid settings are: 0001b [2.5 GT/s], 0010b [5.0 GT/
+    * s and 2.5 GT/s].; EP=0x0002; RP=0x0002
+    *  PSU_PCIE_ATTRIB_ATTR_37_ATTR_LINK_CAP_MAX_LINK_SPEED        0x2
+
+    * Sets the ASPM Optionality Compliance bit, to comply with the 2.1 ASPM Op
+    * tionality ECN. Transferred to the Link Capabilities register.; EP=0x0001
+    * ; RP=0x0001
+    *  PSU_PCIE_ATTRIB_ATTR_37_ATTR_LINK_CAP_ASPM_OPTIONALITY      0x1
+
+    * ATTR_37
+    * (OFFSET, MASK, VALUE)      (0XFD480094, 0x00007E00U ,0x00004A00U)
     */
-	PSU_Mask_Write(SERDES_L1_TM_ANA_BYP_15_OFFSET,
-		0x00000040U, 0x00000040U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_37_OFFSET, 0x00007E00U, 0x00004A00U);
 /*##################################################################### */
 
     /*
-    * Register : L1_TM_ANA_BYP_12 @ 0XFD40502C
+    * Register : ATTR_93 @ 0XFD480174
 
-    * Enable Bypass for <7> of TM_ANA_BYPS_12
-    *  PSU_SERDES_L1_TM_ANA_BYP_12_FORCE_UPHY_PSO_HSRXDIG          0x1
+    * Enables the Replay Timer to use the user-defined LL_REPLAY_TIMEOUT value
+    *  (or combined with the built-in value, depending on LL_REPLAY_TIMEOUT_FU
+    * NC). If FALSE, the built-in value is used.; EP=0x0000; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_93_ATTR_LL_REPLAY_TIMEOUT_EN           0x1
 
-    * Bypass control for pcs-pma interface. Hsrx supply, hsrx des, and cdr ena
-    * ble controls
-    * (OFFSET, MASK, VALUE)      (0XFD40502C, 0x00000040U ,0x00000040U)
+    * Sets a user-defined timeout for the Replay Timer to force cause the retr
+    * ansmission of unacknowledged TLPs; refer to LL_REPLAY_TIMEOUT_EN and LL_
+    * REPLAY_TIMEOUT_FUNC to see how this value is used. The unit for this att
+    * ribute is in symbol times, which is 4ns at GEN1 speeds and 2ns at GEN2.;
+    *  EP=0x0000; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_93_ATTR_LL_REPLAY_TIMEOUT              0x1000
+
+    * ATTR_93
+    * (OFFSET, MASK, VALUE)      (0XFD480174, 0x0000FFFFU ,0x00009000U)
     */
-	PSU_Mask_Write(SERDES_L1_TM_ANA_BYP_12_OFFSET,
-		0x00000040U, 0x00000040U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_93_OFFSET, 0x0000FFFFU, 0x00009000U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_RST_DLY @ 0XFD4099A4
+    * Register : ID @ 0XFD480200
 
-    * Delay apb reset by specified amount
-    *  PSU_SERDES_L2_TM_RST_DLY_APB_RST_DLY                        0xFF
+    * Device ID for the the PCIe Cap Structure Device ID field
+    *  PSU_PCIE_ATTRIB_ID_CFG_DEV_ID                               0xd021
 
-    * reset delay for apb reset w.r.t pso of hsrx
-    * (OFFSET, MASK, VALUE)      (0XFD4099A4, 0x000000FFU ,0x000000FFU)
+    * Vendor ID for the PCIe Cap Structure Vendor ID field
+    *  PSU_PCIE_ATTRIB_ID_CFG_VEND_ID                              0x10ee
+
+    * ID
+    * (OFFSET, MASK, VALUE)      (0XFD480200, 0xFFFFFFFFU ,0x10EED021U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_RST_DLY_OFFSET,
-		0x000000FFU, 0x000000FFU);
+	PSU_Mask_Write(PCIE_ATTRIB_ID_OFFSET, 0xFFFFFFFFU, 0x10EED021U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_ANA_BYP_15 @ 0XFD409038
+    * Register : SUBSYS_ID @ 0XFD480204
 
-    * Enable Bypass for <7> of TM_ANA_BYPS_15
-    *  PSU_SERDES_L2_TM_ANA_BYP_15_FORCE_UPHY_ENABLE_LOW_LEAKAGE   0x1
+    * Subsystem ID for the the PCIe Cap Structure Subsystem ID field
+    *  PSU_PCIE_ATTRIB_SUBSYS_ID_CFG_SUBSYS_ID                     0x7
 
-    * Bypass control for pcs-pma interface. EQ supplies, main master supply an
-    * d ps for samp c2c
-    * (OFFSET, MASK, VALUE)      (0XFD409038, 0x00000040U ,0x00000040U)
+    * Subsystem Vendor ID for the PCIe Cap Structure Subsystem Vendor ID field
+    *  PSU_PCIE_ATTRIB_SUBSYS_ID_CFG_SUBSYS_VEND_ID                0x10ee
+
+    * SUBSYS_ID
+    * (OFFSET, MASK, VALUE)      (0XFD480204, 0xFFFFFFFFU ,0x10EE0007U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_ANA_BYP_15_OFFSET,
-		0x00000040U, 0x00000040U);
+	PSU_Mask_Write(PCIE_ATTRIB_SUBSYS_ID_OFFSET,
+		0xFFFFFFFFU, 0x10EE0007U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_ANA_BYP_12 @ 0XFD40902C
+    * Register : REV_ID @ 0XFD480208
 
-    * Enable Bypass for <7> of TM_ANA_BYPS_12
-    *  PSU_SERDES_L2_TM_ANA_BYP_12_FORCE_UPHY_PSO_HSRXDIG          0x1
+    * Revision ID for the the PCIe Cap Structure
+    *  PSU_PCIE_ATTRIB_REV_ID_CFG_REV_ID                           0x0
 
-    * Bypass control for pcs-pma interface. Hsrx supply, hsrx des, and cdr ena
-    * ble controls
-    * (OFFSET, MASK, VALUE)      (0XFD40902C, 0x00000040U ,0x00000040U)
+    * REV_ID
+    * (OFFSET, MASK, VALUE)      (0XFD480208, 0x000000FFU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_ANA_BYP_12_OFFSET,
-		0x00000040U, 0x00000040U);
+	PSU_Mask_Write(PCIE_ATTRIB_REV_ID_OFFSET, 0x000000FFU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_RST_DLY @ 0XFD40D9A4
+    * Register : ATTR_24 @ 0XFD480060
 
-    * Delay apb reset by specified amount
-    *  PSU_SERDES_L3_TM_RST_DLY_APB_RST_DLY                        0xFF
+    * Code identifying basic function, subclass and applicable programming int
+    * erface. Transferred to the Class Code register.; EP=0x8000; RP=0x8000
+    *  PSU_PCIE_ATTRIB_ATTR_24_ATTR_CLASS_CODE                     0x400
 
-    * reset delay for apb reset w.r.t pso of hsrx
-    * (OFFSET, MASK, VALUE)      (0XFD40D9A4, 0x000000FFU ,0x000000FFU)
+    * ATTR_24
+    * (OFFSET, MASK, VALUE)      (0XFD480060, 0x0000FFFFU ,0x00000400U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_RST_DLY_OFFSET,
-		0x000000FFU, 0x000000FFU);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_24_OFFSET, 0x0000FFFFU, 0x00000400U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_ANA_BYP_15 @ 0XFD40D038
+    * Register : ATTR_25 @ 0XFD480064
 
-    * Enable Bypass for <7> of TM_ANA_BYPS_15
-    *  PSU_SERDES_L3_TM_ANA_BYP_15_FORCE_UPHY_ENABLE_LOW_LEAKAGE   0x1
+    * Code identifying basic function, subclass and applicable programming int
+    * erface. Transferred to the Class Code register.; EP=0x0005; RP=0x0006
+    *  PSU_PCIE_ATTRIB_ATTR_25_ATTR_CLASS_CODE                     0x6
 
-    * Bypass control for pcs-pma interface. EQ supplies, main master supply an
-    * d ps for samp c2c
-    * (OFFSET, MASK, VALUE)      (0XFD40D038, 0x00000040U ,0x00000040U)
+    * INTX Interrupt Generation Capable. If FALSE, this will cause Command[10]
+    *  to be hardwired to 0.; EP=0x0001; RP=0x0001
+    *  PSU_PCIE_ATTRIB_ATTR_25_ATTR_CMD_INTX_IMPLEMENTED           0
+
+    * ATTR_25
+    * (OFFSET, MASK, VALUE)      (0XFD480064, 0x000001FFU ,0x00000006U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_ANA_BYP_15_OFFSET,
-		0x00000040U, 0x00000040U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_25_OFFSET, 0x000001FFU, 0x00000006U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_ANA_BYP_12 @ 0XFD40D02C
+    * Register : ATTR_4 @ 0XFD480010
 
-    * Enable Bypass for <7> of TM_ANA_BYPS_12
-    *  PSU_SERDES_L3_TM_ANA_BYP_12_FORCE_UPHY_PSO_HSRXDIG          0x1
+    * Indicates that the AER structures exists. If this is FALSE, then the AER
+    *  structure cannot be accessed via either the link or the management port
+    * , and AER will be considered to not be present for error management task
+    * s (such as what types of error messages are sent if an error is detected
+    * ).; EP=0x0001; RP=0x0001
+    *  PSU_PCIE_ATTRIB_ATTR_4_ATTR_AER_CAP_ON                      0
 
-    * Bypass control for pcs-pma interface. Hsrx supply, hsrx des, and cdr ena
-    * ble controls
-    * (OFFSET, MASK, VALUE)      (0XFD40D02C, 0x00000040U ,0x00000040U)
+    * Indicates that the AER structures exists. If this is FALSE, then the AER
+    *  structure cannot be accessed via either the link or the management port
+    * , and AER will be considered to not be present for error management task
+    * s (such as what types of error messages are sent if an error is detected
+    * ).; EP=0x0001; RP=0x0001
+    *  PSU_PCIE_ATTRIB_ATTR_4_ATTR_AER_CAP_ON                      0
+
+    * ATTR_4
+    * (OFFSET, MASK, VALUE)      (0XFD480010, 0x00001000U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_ANA_BYP_12_OFFSET,
-		0x00000040U, 0x00000040U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_4_OFFSET, 0x00001000U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * DISABLE FPL/FFL
-    */
-    /*
-    * Register : L0_TM_MISC3 @ 0XFD4019AC
-
-    * CDR fast phase lock control
-    *  PSU_SERDES_L0_TM_MISC3_CDR_EN_FPL                           0x0
+    * Register : ATTR_89 @ 0XFD480164
 
-    * CDR fast frequency lock control
-    *  PSU_SERDES_L0_TM_MISC3_CDR_EN_FFL                           0x0
+    * VSEC's Next Capability Offset pointer to the next item in the capabiliti
+    * es list, or 000h if this is the final capability.; EP=0x0140; RP=0x0140
+    *  PSU_PCIE_ATTRIB_ATTR_89_ATTR_VSEC_CAP_NEXTPTR               0
 
-    * debug bus selection bit, cdr fast phase and freq controls
-    * (OFFSET, MASK, VALUE)      (0XFD4019AC, 0x00000003U ,0x00000000U)
+    * ATTR_89
+    * (OFFSET, MASK, VALUE)      (0XFD480164, 0x00001FFEU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_MISC3_OFFSET, 0x00000003U, 0x00000000U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_89_OFFSET, 0x00001FFEU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L1_TM_MISC3 @ 0XFD4059AC
-
-    * CDR fast phase lock control
-    *  PSU_SERDES_L1_TM_MISC3_CDR_EN_FPL                           0x0
+    * Register : ATTR_79 @ 0XFD48013C
 
-    * CDR fast frequency lock control
-    *  PSU_SERDES_L1_TM_MISC3_CDR_EN_FFL                           0x0
+    * CRS SW Visibility. Indicates RC can return CRS to SW. Transferred to the
+    *  Root Capabilities register.; EP=0x0000; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_79_ATTR_ROOT_CAP_CRS_SW_VISIBILITY     1
 
-    * debug bus selection bit, cdr fast phase and freq controls
-    * (OFFSET, MASK, VALUE)      (0XFD4059AC, 0x00000003U ,0x00000000U)
+    * ATTR_79
+    * (OFFSET, MASK, VALUE)      (0XFD48013C, 0x00000020U ,0x00000020U)
     */
-	PSU_Mask_Write(SERDES_L1_TM_MISC3_OFFSET, 0x00000003U, 0x00000000U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_79_OFFSET, 0x00000020U, 0x00000020U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_MISC3 @ 0XFD4099AC
-
-    * CDR fast phase lock control
-    *  PSU_SERDES_L2_TM_MISC3_CDR_EN_FPL                           0x0
+    * Register : ATTR_43 @ 0XFD4800AC
 
-    * CDR fast frequency lock control
-    *  PSU_SERDES_L2_TM_MISC3_CDR_EN_FFL                           0x0
+    * Indicates that the MSIX structures exists. If this is FALSE, then the MS
+    * IX structure cannot be accessed via either the link or the management po
+    * rt.; EP=0x0001; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_43_ATTR_MSIX_CAP_ON                    0
 
-    * debug bus selection bit, cdr fast phase and freq controls
-    * (OFFSET, MASK, VALUE)      (0XFD4099AC, 0x00000003U ,0x00000000U)
+    * ATTR_43
+    * (OFFSET, MASK, VALUE)      (0XFD4800AC, 0x00000100U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_MISC3_OFFSET, 0x00000003U, 0x00000000U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_43_OFFSET, 0x00000100U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_MISC3 @ 0XFD40D9AC
-
-    * CDR fast phase lock control
-    *  PSU_SERDES_L3_TM_MISC3_CDR_EN_FPL                           0x0
+    * Register : ATTR_48 @ 0XFD4800C0
 
-    * CDR fast frequency lock control
-    *  PSU_SERDES_L3_TM_MISC3_CDR_EN_FFL                           0x0
+    * MSI-X Table Size. This value is transferred to the MSI-X Message Control
+    * [10:0] field. Set to 0 if MSI-X is not enabled. Note that the core does
+    * not implement the table; that must be implemented in user logic.; EP=0x0
+    * 003; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_48_ATTR_MSIX_CAP_TABLE_SIZE            0
 
-    * debug bus selection bit, cdr fast phase and freq controls
-    * (OFFSET, MASK, VALUE)      (0XFD40D9AC, 0x00000003U ,0x00000000U)
+    * ATTR_48
+    * (OFFSET, MASK, VALUE)      (0XFD4800C0, 0x000007FFU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_MISC3_OFFSET, 0x00000003U, 0x00000000U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_48_OFFSET, 0x000007FFU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * DISABLE DYNAMIC OFFSET CALIBRATION
-    */
-    /*
-    * Register : L0_TM_EQ11 @ 0XFD401978
+    * Register : ATTR_46 @ 0XFD4800B8
 
-    * Force EQ offset correction algo off if not forced on
-    *  PSU_SERDES_L0_TM_EQ11_FORCE_EQ_OFFS_OFF                     0x1
+    * MSI-X Table Offset. This value is transferred to the MSI-X Table Offset
+    * field. Set to 0 if MSI-X is not enabled.; EP=0x0001; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_46_ATTR_MSIX_CAP_TABLE_OFFSET          0
 
-    * eq dynamic offset correction
-    * (OFFSET, MASK, VALUE)      (0XFD401978, 0x00000010U ,0x00000010U)
+    * ATTR_46
+    * (OFFSET, MASK, VALUE)      (0XFD4800B8, 0x0000FFFFU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L0_TM_EQ11_OFFSET, 0x00000010U, 0x00000010U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_46_OFFSET, 0x0000FFFFU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L1_TM_EQ11 @ 0XFD405978
+    * Register : ATTR_47 @ 0XFD4800BC
 
-    * Force EQ offset correction algo off if not forced on
-    *  PSU_SERDES_L1_TM_EQ11_FORCE_EQ_OFFS_OFF                     0x1
+    * MSI-X Table Offset. This value is transferred to the MSI-X Table Offset
+    * field. Set to 0 if MSI-X is not enabled.; EP=0x0000; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_47_ATTR_MSIX_CAP_TABLE_OFFSET          0
 
-    * eq dynamic offset correction
-    * (OFFSET, MASK, VALUE)      (0XFD405978, 0x00000010U ,0x00000010U)
+    * ATTR_47
+    * (OFFSET, MASK, VALUE)      (0XFD4800BC, 0x00001FFFU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L1_TM_EQ11_OFFSET, 0x00000010U, 0x00000010U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_47_OFFSET, 0x00001FFFU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L2_TM_EQ11 @ 0XFD409978
+    * Register : ATTR_44 @ 0XFD4800B0
 
-    * Force EQ offset correction algo off if not forced on
-    *  PSU_SERDES_L2_TM_EQ11_FORCE_EQ_OFFS_OFF                     0x1
+    * MSI-X Pending Bit Array Offset This value is transferred to the MSI-X PB
+    * A Offset field. Set to 0 if MSI-X is not enabled.; EP=0x0001; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_44_ATTR_MSIX_CAP_PBA_OFFSET            0
 
-    * eq dynamic offset correction
-    * (OFFSET, MASK, VALUE)      (0XFD409978, 0x00000010U ,0x00000010U)
+    * ATTR_44
+    * (OFFSET, MASK, VALUE)      (0XFD4800B0, 0x0000FFFFU ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L2_TM_EQ11_OFFSET, 0x00000010U, 0x00000010U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_44_OFFSET, 0x0000FFFFU, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_EQ11 @ 0XFD40D978
+    * Register : ATTR_45 @ 0XFD4800B4
 
-    * Force EQ offset correction algo off if not forced on
-    *  PSU_SERDES_L3_TM_EQ11_FORCE_EQ_OFFS_OFF                     0x1
+    * MSI-X Pending Bit Array Offset This value is transferred to the MSI-X PB
+    * A Offset field. Set to 0 if MSI-X is not enabled.; EP=0x1000; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_45_ATTR_MSIX_CAP_PBA_OFFSET            0
 
-    * eq dynamic offset correction
-    * (OFFSET, MASK, VALUE)      (0XFD40D978, 0x00000010U ,0x00000010U)
+    * ATTR_45
+    * (OFFSET, MASK, VALUE)      (0XFD4800B4, 0x0000FFF8U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_EQ11_OFFSET, 0x00000010U, 0x00000010U);
+	PSU_Mask_Write(PCIE_ATTRIB_ATTR_45_OFFSET, 0x0000FFF8U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * SERDES ILL CALIB
-    */
-		serdes_illcalib(2,3,3,0,4,0,1,1);
+    * Register : CB @ 0XFD48031C
 
-/*##################################################################### */
+    * DT837748 Enable
+    *  PSU_PCIE_ATTRIB_CB_CB1                                      0x0
 
-    /*
-    * DISABLE ECO FOR PCIE
+    * ECO Register 1
+    * (OFFSET, MASK, VALUE)      (0XFD48031C, 0x00000002U ,0x00000000U)
     */
+	PSU_Mask_Write(PCIE_ATTRIB_CB_OFFSET, 0x00000002U, 0x00000000U);
+/*##################################################################### */
+
     /*
-    * Register : eco_0 @ 0XFD3D001C
+    * Register : ATTR_35 @ 0XFD48008C
 
-    * For future use
-    *  PSU_SIOU_ECO_0_FIELD                                        0x1
+    * Active State PM Support. Indicates the level of active state power manag
+    * ement supported by the selected PCI Express Link, encoded as follows: 0
+    * Reserved, 1 L0s entry supported, 2 Reserved, 3 L0s and L1 entry supporte
+    * d.; EP=0x0001; RP=0x0001
+    *  PSU_PCIE_ATTRIB_ATTR_35_ATTR_LINK_CAP_ASPM_SUPPORT          0x0
 
-    * ECO Register for future use
-    * (OFFSET, MASK, VALUE)      (0XFD3D001C, 0xFFFFFFFFU ,0x00000001U)
+    * Data Link Layer Link Active status notification is supported. This is op
+    * tional for Upstream ports.; EP=0x0000; RP=0x0000
+    *  PSU_PCIE_ATTRIB_ATTR_35_ATTR_LINK_CAP_DLL_LINK_ACTIVE_REPORTING_CAP 1
+
+    * ATTR_35
+    * (OFFSET, MASK, VALUE)      (0XFD48008C, 0x0000B000U ,0x00008000U)
     */
-	PSU_Mask_Write(SIOU_ECO_0_OFFSET, 0xFFFFFFFFU, 0x00000001U);
+    PSU_Mask_Write(PCIE_ATTRIB_ATTR_35_OFFSET, 0x0000B000U, 0x00008000U);
 /*##################################################################### */
 
     /*
-    * GT LANE SETTINGS
+    * PUTTING PCIE CONTROL IN RESET
     */
     /*
-    * Register : ICM_CFG0 @ 0XFD410010
-
-    * Controls UPHY Lane 0 protocol configuration. 0 - PowerDown, 1 - PCIe .0,
-    *  2 - Sata0, 3 - USB0, 4 - DP.1, 5 - SGMII0, 6 - Unused, 7 - Unused
-    *  PSU_SERDES_ICM_CFG0_L0_ICM_CFG                              1
+    * Register : RST_FPD_TOP @ 0XFD1A0100
 
-    * Controls UPHY Lane 1 protocol configuration. 0 - PowerDown, 1 - PCIe.1,
-    * 2 - Sata1, 3 - USB0, 4 - DP.0, 5 - SGMII1, 6 - Unused, 7 - Unused
-    *  PSU_SERDES_ICM_CFG0_L1_ICM_CFG                              4
+    * PCIE control block level reset
+    *  PSU_CRF_APB_RST_FPD_TOP_PCIE_CTRL_RESET                     0X0
 
-    * ICM Configuration Register 0
-    * (OFFSET, MASK, VALUE)      (0XFD410010, 0x00000077U ,0x00000041U)
+    * FPD Block level software controlled reset
+    * (OFFSET, MASK, VALUE)      (0XFD1A0100, 0x00020000U ,0x00000000U)
     */
-	PSU_Mask_Write(SERDES_ICM_CFG0_OFFSET, 0x00000077U, 0x00000041U);
+	PSU_Mask_Write(CRF_APB_RST_FPD_TOP_OFFSET, 0x00020000U, 0x00000000U);
 /*##################################################################### */
 
     /*
-    * Register : ICM_CFG1 @ 0XFD410014
-
-    * Controls UPHY Lane 2 protocol configuration. 0 - PowerDown, 1 - PCIe.1,
-    * 2 - Sata0, 3 - USB0, 4 - DP.1, 5 - SGMII2, 6 - Unused, 7 - Unused
-    *  PSU_SERDES_ICM_CFG1_L2_ICM_CFG                              3
-
-    * Controls UPHY Lane 3 protocol configuration. 0 - PowerDown, 1 - PCIe.3,
-    * 2 - Sata1, 3 - USB1, 4 - DP.0, 5 - SGMII3, 6 - Unused, 7 - Unused
-    *  PSU_SERDES_ICM_CFG1_L3_ICM_CFG                              2
-
-    * ICM Configuration Register 1
-    * (OFFSET, MASK, VALUE)      (0XFD410014, 0x00000077U ,0x00000023U)
+    * PCIE GPIO RESET
     */
-	PSU_Mask_Write(SERDES_ICM_CFG1_OFFSET, 0x00000077U, 0x00000023U);
-/*##################################################################### */
-
     /*
-    * CHECKING PLL LOCK
+    * MASK_DATA_0_LSW LOW BANK [15:0]
     */
     /*
-    * ENABLE SERIAL DATA MUX DEEMPH
+    * MASK_DATA_0_MSW LOW BANK [25:16]
     */
     /*
-    * Register : L1_TXPMD_TM_45 @ 0XFD404CB4
-
-    * Enable/disable DP post2 path
-    *  PSU_SERDES_L1_TXPMD_TM_45_DP_TM_TX_DP_ENABLE_POST2_PATH     0x1
-
-    * Override enable/disable of DP post2 path
-    *  PSU_SERDES_L1_TXPMD_TM_45_DP_TM_TX_OVRD_DP_ENABLE_POST2_PATH 0x1
-
-    * Override enable/disable of DP post1 path
-    *  PSU_SERDES_L1_TXPMD_TM_45_DP_TM_TX_OVRD_DP_ENABLE_POST1_PATH 0x1
+    * MASK_DATA_1_LSW LOW BANK [41:26]
+    */
+    /*
+    * Register : MASK_DATA_1_LSW @ 0XFF0A0008
 
-    * Enable/disable DP main path
-    *  PSU_SERDES_L1_TXPMD_TM_45_DP_TM_TX_DP_ENABLE_MAIN_PATH      0x1
+    * Operation is the same as MASK_DATA_0_LSW[MASK_0_LSW]
+    *  PSU_GPIO_MASK_DATA_1_LSW_MASK_1_LSW                         0xffdf
 
-    * Override enable/disable of DP main path
-    *  PSU_SERDES_L1_TXPMD_TM_45_DP_TM_TX_OVRD_DP_ENABLE_MAIN_PATH 0x1
+    * Operation is the same as MASK_DATA_0_LSW[DATA_0_LSW]
+    *  PSU_GPIO_MASK_DATA_1_LSW_DATA_1_LSW                         0x20
 
-    * Post or pre or main DP path selection
-    * (OFFSET, MASK, VALUE)      (0XFD404CB4, 0x00000037U ,0x00000037U)
+    * Maskable Output Data (GPIO Bank1, MIO, Lower 16bits)
+    * (OFFSET, MASK, VALUE)      (0XFF0A0008, 0xFFFFFFFFU ,0xFFDF0020U)
     */
-	PSU_Mask_Write(SERDES_L1_TXPMD_TM_45_OFFSET,
-		0x00000037U, 0x00000037U);
+	PSU_Mask_Write(GPIO_MASK_DATA_1_LSW_OFFSET,
+		0xFFFFFFFFU, 0xFFDF0020U);
 /*##################################################################### */
 
     /*
-    * Register : L1_TX_ANA_TM_118 @ 0XFD4041D8
-
-    * Test register force for enabling/disablign TX deemphasis bits <17:0>
-    *  PSU_SERDES_L1_TX_ANA_TM_118_FORCE_TX_DEEMPH_17_0            0x1
-
-    * Enable Override of TX deemphasis
-    * (OFFSET, MASK, VALUE)      (0XFD4041D8, 0x00000001U ,0x00000001U)
+    * MASK_DATA_1_MSW HIGH BANK [51:42]
     */
-	PSU_Mask_Write(SERDES_L1_TX_ANA_TM_118_OFFSET,
-		0x00000001U, 0x00000001U);
-/*##################################################################### */
-
     /*
-    * Register : L3_TX_ANA_TM_118 @ 0XFD40C1D8
-
-    * Test register force for enabling/disablign TX deemphasis bits <17:0>
-    *  PSU_SERDES_L3_TX_ANA_TM_118_FORCE_TX_DEEMPH_17_0            0x1
-
-    * Enable Override of TX deemphasis
-    * (OFFSET, MASK, VALUE)      (0XFD40C1D8, 0x00000001U ,0x00000001U)
+    * MASK_DATA_1_LSW HIGH BANK [67:52]
     */
-	PSU_Mask_Write(SERDES_L3_TX_ANA_TM_118_OFFSET,
-		0x00000001U, 0x00000001U);
+    /*
+    * MASK_DATA_1_LSW HIGH BANK [77:68]
+    */
+    return 1;
+#endif /* PSU_INIT_TABLE */
+}
+unsigned long psu_resetout_finish_data(void)
+{
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_resetout_finish_data_table);
+#else
 /*##################################################################### */
 
     /*
-    * CDR AND RX EQUALIZATION SETTINGS
+    * SATA AHCI VENDOR SETTING
     */
     /*
-    * Register : L3_TM_CDR5 @ 0XFD40DC14
-
-    * FPHL FSM accumulate cycles
-    *  PSU_SERDES_L3_TM_CDR5_FPHL_FSM_ACC_CYCLES                   0x7
+    * Register : PP2C @ 0XFD0C00AC
 
-    * FFL Phase0 int gain aka 2ol SD update rate
-    *  PSU_SERDES_L3_TM_CDR5_FFL_PH0_INT_GAIN                      0x6
+    * CIBGMN: COMINIT Burst Gap Minimum.
+    *  PSU_SATA_AHCI_VENDOR_PP2C_CIBGMN                            0x18
 
-    * Fast phase lock controls -- FSM accumulator cycle control and phase 0 in
-    * t gain control.
-    * (OFFSET, MASK, VALUE)      (0XFD40DC14, 0x000000FFU ,0x000000E6U)
-    */
-	PSU_Mask_Write(SERDES_L3_TM_CDR5_OFFSET, 0x000000FFU, 0x000000E6U);
-/*##################################################################### */
+    * CIBGMX: COMINIT Burst Gap Maximum.
+    *  PSU_SATA_AHCI_VENDOR_PP2C_CIBGMX                            0x40
 
-    /*
-    * Register : L3_TM_CDR16 @ 0XFD40DC40
+    * CIBGN: COMINIT Burst Gap Nominal.
+    *  PSU_SATA_AHCI_VENDOR_PP2C_CIBGN                             0x18
 
-    * FFL Phase0 prop gain aka 1ol SD update rate
-    *  PSU_SERDES_L3_TM_CDR16_FFL_PH0_PROP_GAIN                    0xC
+    * CINMP: COMINIT Negate Minimum Period.
+    *  PSU_SATA_AHCI_VENDOR_PP2C_CINMP                             0x28
 
-    * Fast phase lock controls -- phase 0 prop gain
-    * (OFFSET, MASK, VALUE)      (0XFD40DC40, 0x0000001FU ,0x0000000CU)
+    * PP2C - Port Phy2Cfg Register. This register controls the configuration o
+    * f the Phy Control OOB timing for the COMINIT parameters for either Port
+    * 0 or Port 1. The Port configured is controlled by the value programmed i
+    * nto the Port Config Register.
+    * (OFFSET, MASK, VALUE)      (0XFD0C00AC, 0xFFFFFFFFU ,0x28184018U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_CDR16_OFFSET, 0x0000001FU, 0x0000000CU);
+	PSU_Mask_Write(SATA_AHCI_VENDOR_PP2C_OFFSET,
+		0xFFFFFFFFU, 0x28184018U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TM_EQ0 @ 0XFD40D94C
-
-    * EQ stg 2 controls BYPASSED
-    *  PSU_SERDES_L3_TM_EQ0_EQ_STG2_CTRL_BYP                       1
+    * Register : PP3C @ 0XFD0C00B0
 
-    * eq stg1 and stg2 controls
-    * (OFFSET, MASK, VALUE)      (0XFD40D94C, 0x00000020U ,0x00000020U)
-    */
-	PSU_Mask_Write(SERDES_L3_TM_EQ0_OFFSET, 0x00000020U, 0x00000020U);
-/*##################################################################### */
+    * CWBGMN: COMWAKE Burst Gap Minimum.
+    *  PSU_SATA_AHCI_VENDOR_PP3C_CWBGMN                            0x06
 
-    /*
-    * Register : L3_TM_EQ1 @ 0XFD40D950
+    * CWBGMX: COMWAKE Burst Gap Maximum.
+    *  PSU_SATA_AHCI_VENDOR_PP3C_CWBGMX                            0x14
 
-    * EQ STG2 RL PROG
-    *  PSU_SERDES_L3_TM_EQ1_EQ_STG2_RL_PROG                        0x2
+    * CWBGN: COMWAKE Burst Gap Nominal.
+    *  PSU_SATA_AHCI_VENDOR_PP3C_CWBGN                             0x08
 
-    * EQ stg 2 preamp mode val
-    *  PSU_SERDES_L3_TM_EQ1_EQ_STG2_PREAMP_MODE_VAL                0x1
+    * CWNMP: COMWAKE Negate Minimum Period.
+    *  PSU_SATA_AHCI_VENDOR_PP3C_CWNMP                             0x0E
 
-    * eq stg1 and stg2 controls
-    * (OFFSET, MASK, VALUE)      (0XFD40D950, 0x00000007U ,0x00000006U)
+    * PP3C - Port Phy3CfgRegister. This register controls the configuration of
+    *  the Phy Control OOB timing for the COMWAKE parameters for either Port 0
+    *  or Port 1. The Port configured is controlled by the value programmed in
+    * to the Port Config Register.
+    * (OFFSET, MASK, VALUE)      (0XFD0C00B0, 0xFFFFFFFFU ,0x0E081406U)
     */
-	PSU_Mask_Write(SERDES_L3_TM_EQ1_OFFSET, 0x00000007U, 0x00000006U);
+	PSU_Mask_Write(SATA_AHCI_VENDOR_PP3C_OFFSET,
+		0xFFFFFFFFU, 0x0E081406U);
 /*##################################################################### */
 
     /*
-    * GEM SERDES SETTINGS
-    */
-    /*
-    * ENABLE PRE EMPHAIS AND VOLTAGE SWING
-    */
-    /*
-    * Register : L1_TXPMD_TM_48 @ 0XFD404CC0
+    * Register : PP4C @ 0XFD0C00B4
 
-    * Margining factor value
-    *  PSU_SERDES_L1_TXPMD_TM_48_TM_RESULTANT_MARGINING_FACTOR     0
+    * BMX: COM Burst Maximum.
+    *  PSU_SATA_AHCI_VENDOR_PP4C_BMX                               0x13
 
-    * Margining factor
-    * (OFFSET, MASK, VALUE)      (0XFD404CC0, 0x0000001FU ,0x00000000U)
-    */
-	PSU_Mask_Write(SERDES_L1_TXPMD_TM_48_OFFSET,
-		0x0000001FU, 0x00000000U);
-/*##################################################################### */
+    * BNM: COM Burst Nominal.
+    *  PSU_SATA_AHCI_VENDOR_PP4C_BNM                               0x08
 
-    /*
-    * Register : L1_TX_ANA_TM_18 @ 0XFD404048
+    * SFD: Signal Failure Detection, if the signal detection de-asserts for a
+    * time greater than this then the OOB detector will determine this is a li
+    * ne idle and cause the PhyInit state machine to exit the Phy Ready State.
+    *  A value of zero disables the Signal Failure Detector. The value is base
+    * d on the OOB Detector Clock typically (PMCLK Clock Period) * SFD giving
+    * a nominal time of 500ns based on a 150MHz PMCLK.
+    *  PSU_SATA_AHCI_VENDOR_PP4C_SFD                               0x4A
 
-    * pipe_TX_Deemph. 0: -6dB de-emphasis, 1: -3.5dB de-emphasis, 2 : No de-em
-    * phasis, Others: reserved
-    *  PSU_SERDES_L1_TX_ANA_TM_18_PIPE_TX_DEEMPH_7_0               0
+    * PTST: Partial to Slumber timer value, specific delay the controller shou
+    * ld apply while in partial before entering slumber. The value is bases on
+    *  the system clock divided by 128, total delay = (Sys Clock Period) * PTS
+    * T * 128
+    *  PSU_SATA_AHCI_VENDOR_PP4C_PTST                              0x06
 
-    * Override for PIPE TX de-emphasis
-    * (OFFSET, MASK, VALUE)      (0XFD404048, 0x000000FFU ,0x00000000U)
+    * PP4C - Port Phy4Cfg Register. This register controls the configuration o
+    * f the Phy Control Burst timing for the COM parameters for either Port 0
+    * or Port 1. The Port configured is controlled by the value programmed int
+    * o the Port Config Register.
+    * (OFFSET, MASK, VALUE)      (0XFD0C00B4, 0xFFFFFFFFU ,0x064A0813U)
     */
-	PSU_Mask_Write(SERDES_L1_TX_ANA_TM_18_OFFSET,
-		0x000000FFU, 0x00000000U);
+	PSU_Mask_Write(SATA_AHCI_VENDOR_PP4C_OFFSET,
+		0xFFFFFFFFU, 0x064A0813U);
 /*##################################################################### */
 
     /*
-    * Register : L3_TX_ANA_TM_18 @ 0XFD40C048
+    * Register : PP5C @ 0XFD0C00B8
 
-    * pipe_TX_Deemph. 0: -6dB de-emphasis, 1: -3.5dB de-emphasis, 2 : No de-em
-    * phasis, Others: reserved
-    *  PSU_SERDES_L3_TX_ANA_TM_18_PIPE_TX_DEEMPH_7_0               0x1
+    * RIT: Retry Interval Timer. The calculated value divided by two, the lowe
+    * r digit of precision is not needed.
+    *  PSU_SATA_AHCI_VENDOR_PP5C_RIT                               0xC96A4
 
-    * Override for PIPE TX de-emphasis
-    * (OFFSET, MASK, VALUE)      (0XFD40C048, 0x000000FFU ,0x00000001U)
+    * RCT: Rate Change Timer, a value based on the 54.2us for which a SATA dev
+    * ice will transmit at a fixed rate ALIGNp after OOB has completed, for a
+    * fast SERDES it is suggested that this value be 54.2us / 4
+    *  PSU_SATA_AHCI_VENDOR_PP5C_RCT                               0x3FF
+
+    * PP5C - Port Phy5Cfg Register. This register controls the configuration o
+    * f the Phy Control Retry Interval timing for either Port 0 or Port 1. The
+    *  Port configured is controlled by the value programmed into the Port Con
+    * fig Register.
+    * (OFFSET, MASK, VALUE)      (0XFD0C00B8, 0xFFFFFFFFU ,0x3FFC96A4U)
     */
-	PSU_Mask_Write(SERDES_L3_TX_ANA_TM_18_OFFSET,
-		0x000000FFU, 0x00000001U);
+	PSU_Mask_Write(SATA_AHCI_VENDOR_PP5C_OFFSET,
+		0xFFFFFFFFU, 0x3FFC96A4U);
 /*##################################################################### */
 
 
-	return 1;
+    return 1;
+#endif /* PSU_INIT_TABLE */
 }
 unsigned long psu_resetout_init_data(void)
 {
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_resetout_init_data_table);
+#else
     /*
     * TAKING SERDES PERIPHERAL OUT OF RESET RESET
     */
@@ -21892,9 +24136,13 @@ unsigned long psu_resetout_init_data(void)
 
 
 	return 1;
+#endif /* PSU_INIT_TABLE */
 }
 unsigned long psu_resetin_init_data(void)
 {
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_resetin_init_data_table);
+#else
     /*
     * PUTTING SERDES PERIPHERAL IN RESET
     */
@@ -22015,9 +24263,13 @@ unsigned long psu_resetin_init_data(void)
 
 
 	return 1;
+#endif /* PSU_INIT_TABLE */
 }
 unsigned long psu_ps_pl_isolation_removal_data(void)
 {
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_ps_pl_isolation_removal_data_table);
+#else
     /*
     * PS-PL POWER UP REQUEST
     */
@@ -22066,9 +24318,13 @@ unsigned long psu_ps_pl_isolation_removal_data(void)
 
 
 	return 1;
+#endif /* PSU_INIT_TABLE */
 }
 unsigned long psu_afi_config(void)
 {
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_afi_config_table);
+#else
     /*
     * AFI RESET
     */
@@ -22136,9 +24392,13 @@ unsigned long psu_afi_config(void)
 
 
 	return 1;
+#endif /* PSU_INIT_TABLE */
 }
 unsigned long psu_ps_pl_reset_config_data(void)
 {
+#ifdef PSU_INIT_TABLE
+	return psu_table_run(psu_ps_pl_reset_config_data_table);
+#else
     /*
     * PS PL RESET SEQUENCE
     */
@@ -22234,6 +24494,7 @@ unsigned long psu_ps_pl_reset_config_data(void)
 
 
 	return 1;
+#endif /* PSU_INIT_TABLE */
 }
 
 unsigned long psu_ddr_phybringup_data(void)
@@ -22433,12 +24694,18 @@ return 1;
 #define CRF_APB_PLL_STATUS    ( ( CRF_APB_BASEADDR ) + 0X00000044 )
 
 
-static int mask_pollOnValue(u32 add, u32 mask, u32 value)
+/*
+ * Polls until (addr & mask) == value, or until any bit of mask is set when
+ * any is not 0, gives up after PSU_MASK_POLL_TIME reads. Returns 0 when it
+ * gave up. The FSBL overrides it with a poll on a deadline.
+ */
+int __attribute__((weak)) psu_poll(unsigned long addr, unsigned int mask,
+	unsigned int value, int any)
 {
-	volatile u32 *addr = (volatile u32 *)(unsigned long) add;
+	volatile u32 *reg = (volatile u32 *)addr;
 	int i = 0;
 
-	while ((*addr & mask) != value) {
+	while ((any != 0) ? ((*reg & mask) == 0U) : ((*reg & mask) != value)) {
 		if (i == PSU_MASK_POLL_TIME)
 			return 0;
 		i++;
@@ -22446,17 +24713,16 @@ static int mask_pollOnValue(u32 add, u32 mask, u32 value)
 	return 1;
 }
 
-static int mask_poll(u32 add, u32 mask)
+#ifndef PSU_INIT_TABLE
+static int mask_pollOnValue(u32 add, u32 mask, u32 value)
 {
-	volatile u32 *addr = (volatile u32 *)(unsigned long) add;
-	int i = 0;
+	return psu_poll(add, mask, value, 0);
+}
+#endif /* PSU_INIT_TABLE */
 
-	while (!(*addr & mask)) {
-		if (i == PSU_MASK_POLL_TIME)
-			return 0;
-		i++;
-	}
-	return 1;
+static int mask_poll(u32 add, u32 mask)
+{
+	return psu_poll(add, mask, 0U, 1);
 }
 
 static void mask_delay(u32 delay)
@@ -22991,6 +25257,35 @@ static int serdes_bist_result(u32 lane_active)
    return (1); //BIST PASS
 }
 
+/*
+ * Lane protocols and rates of serdes_illcalib(), 5 bits per lane from
+ * lane 0, and its pass of serdes_illcalib_pcie_gen1()
+ */
+static unsigned int psu_serdes_ill_config;
+static unsigned int psu_serdes_ill_pass;
+
+#define PSU_SERDES_ILL_LANE(protocol, rate, lane) \
+	((((protocol) & 0x7U) | (((rate) & 0x3U) << 3)) << ((lane) * 5U))
+
+int __attribute__((weak)) psu_serdes_ill_restore(unsigned int config,
+	unsigned int pass, unsigned int lanes, unsigned int *meancount)
+{
+	(void)config;
+	(void)pass;
+	(void)lanes;
+	(void)meancount;
+	return 0;
+}
+
+void __attribute__((weak)) psu_serdes_ill_save(unsigned int config,
+	unsigned int pass, unsigned int lanes, const unsigned int *meancount)
+{
+	(void)config;
+	(void)pass;
+	(void)lanes;
+	(void)meancount;
+}
+
 static int serdes_illcalib_pcie_gen1 (u32 pllsel, u32 lane3_protocol, u32 lane3_rate, u32 lane2_protocol, u32 lane2_rate, u32 lane1_protocol, u32 lane1_rate, u32 lane0_protocol, u32 lane0_rate, u32 gen2_calib)
 {
         //The counter values to try are in
@@ -23014,11 +25309,16 @@ static int serdes_illcalib_pcie_gen1 (u32 pllsel, u32 lane3_protocol, u32 lane3_
         u32 lane1_active;
         u32 lane2_active;
         u32 lane3_active;
+        u32 lanes;
+        u32 pass;
+        int restored;
 
         lane0_active = (lane0_protocol == 1);
         lane1_active = (lane1_protocol == 1);
         lane2_active = (lane2_protocol == 1);
         lane3_active = (lane3_protocol == 1);
+        lanes = lane0_active | (lane1_active << 1) | (lane2_active << 2) | (lane3_active << 3);
+        pass = psu_serdes_ill_pass++;
 
         for (loop=0; loop<=3; loop++)
         {
@@ -23031,6 +25331,10 @@ static int serdes_illcalib_pcie_gen1 (u32 pllsel, u32 lane3_protocol, u32 lane3_
           bistpasscount[loop] = 0;
         }
         itercount = 0;
+        //codes of a previous boot: a single pass at the last counter value
+        //for the side effects of the reset sequence, without BIST
+        restored = psu_serdes_ill_restore(psu_serdes_ill_config, pass, lanes, meancount);
+        if (restored) itercount = 63;
         if (lane0_active) serdes_bist_static_settings(0);
         if (lane1_active) serdes_bist_static_settings(1);
         if (lane2_active) serdes_bist_static_settings(2);
@@ -23089,6 +25393,7 @@ static int serdes_illcalib_pcie_gen1 (u32 pllsel, u32 lane3_protocol, u32 lane3_
 
           //bist iterations
           serdes_rst_seq (pllsel, lane3_protocol, lane3_rate, lane2_protocol, lane2_rate, lane1_protocol, lane1_rate, lane0_protocol, lane0_rate);
+          if (restored) break;
           if (lane3_active == 1) serdes_bist_run(3);
           if (lane2_active == 1) serdes_bist_run(2);
           if (lane1_active == 1) serdes_bist_run(1);
@@ -23170,6 +25475,7 @@ static int serdes_illcalib_pcie_gen1 (u32 pllsel, u32 lane3_protocol, u32 lane3_
 #endif
           }
         }
+        if (!restored) psu_serdes_ill_save(psu_serdes_ill_config, pass, lanes, meancount);
         if (gen2_calib != 1)
         {
         if (lane0_active == 1) Xil_Out32(SERDES_L0_TM_E_ILL1,ill1_val[0]);
@@ -23423,6 +25729,12 @@ static int serdes_illcalib (u32 lane3_protocol, u32 lane3_rate, u32 lane2_protoc
   unsigned int temp_tx_dig_tm_61;
   unsigned int temp_tm_dig_6;
   unsigned int temp_pll_fbdiv_frac_3_msb_offset;
+
+  psu_serdes_ill_config = PSU_SERDES_ILL_LANE(lane0_protocol, lane0_rate, 0U) |
+    PSU_SERDES_ILL_LANE(lane1_protocol, lane1_rate, 1U) |
+    PSU_SERDES_ILL_LANE(lane2_protocol, lane2_rate, 2U) |
+    PSU_SERDES_ILL_LANE(lane3_protocol, lane3_rate, 3U);
+  psu_serdes_ill_pass = 0U;
  if ((lane0_protocol == 2)||(lane0_protocol == 1))
  {
    //Lane-3 is configured for SATA mode
@@ -23725,14 +26037,7 @@ int serdes_fixcal_code(void)
   rdata = rdata | 0x1;
   Xil_Out32(0XFD40289C, rdata);
   // check supply good status before starting AFE sequencing
-  int count = 0;
-  do
-  {
-    if (count == PSU_MASK_POLL_TIME)
-      break;
-    rdata = Xil_In32(0xFD402B1C);
-    count++;
-  }while((rdata&0x0000000E) !=0x0000000E);
+  (void)psu_poll(0xFD402B1C, 0x0000000E, 0x0000000E, 0);
 
 	for (i = 0; i < 23; i++) {
 		match_pmos_code[i] = 0;
@@ -23857,6 +26162,7 @@ int serdes_fixcal_code(void)
   return MaskStatus;
 
 }
+#ifdef PSU_INIT_SEQUENTIAL
 static int init_serdes(void)
 {
 	int status = 1;
@@ -23871,6 +26177,22 @@ static int init_serdes(void)
 
 	return status;
 }
+#else
+static unsigned long init_serdes_start(void)
+{
+	int status = 1;
+
+	status &=  psu_resetin_init_data();
+
+	status &= serdes_fixcal_code();
+	status &= serdes_enb_coarse_saturation();
+
+	status &=  psu_serdes_init_data();
+	status &=  psu_resetout_start_data();
+
+	return status;
+}
+#endif /* PSU_INIT_SEQUENTIAL */
 
 
 static void init_peripheral(void)
@@ -23879,6 +26201,18 @@ static void init_peripheral(void)
 	PSU_Mask_Write(0xFD5F0018, 0x8000001FU, 0x8000001FU);
 }
 
+#ifndef PSU_INIT_SEQUENTIAL
+static unsigned long init_serdes_finish(void)
+{
+	int status = 1;
+
+	status &=  psu_resetout_finish_data();
+	init_peripheral();
+
+	return status;
+}
+#endif /* PSU_INIT_SEQUENTIAL */
+
 static int psu_init_xppu_aper_ram(void)
 {
 
@@ -23930,6 +26264,19 @@ int psu_protection(void)
 }
 
 
+void __attribute__((weak)) psu_init_block_start(unsigned int block)
+{
+	(void)block;
+}
+
+void __attribute__((weak)) psu_init_block_done(unsigned int block,
+	unsigned int after)
+{
+	(void)block;
+	(void)after;
+}
+
+#ifdef PSU_INIT_SEQUENTIAL
 int
 psu_init(void)
 {
@@ -23981,3 +26328,275 @@ int psu_init_ddr_self_refresh(void) {
 
 
 }
+#else
+/*
+ * A psu_init stage starts once the blocks of its deps are done, the first
+ * one of the table that can start with waits, else the first one. A stage
+ * with waits only starts its hardware: the next stages run while its
+ * registers are not ready, then its finish() runs once they are, or once
+ * psu_poll() gave up on them.
+ * With PSU_INIT_SERIAL, the stages run one after the other in the order of
+ * the table, which is the order of the generated psu_init(), and the waits
+ * are polled as mask_poll() does.
+ */
+struct psu_init_wait {
+	unsigned long addr;
+	unsigned int mask;
+};
+
+struct psu_init_stage {
+	unsigned int block;
+	unsigned int deps;
+	unsigned long (*start)(void);
+	const struct psu_init_wait *waits;
+	unsigned int nwaits;
+	unsigned long (*finish)(void);
+};
+
+#define PSU_INIT_DEP(block)	(1U << (block))
+#define PSU_INIT_WAITS(waits)	(waits), (sizeof(waits) / sizeof(waits[0]))
+
+/* Locks of the PLLs */
+static const struct psu_init_wait psu_rpll_lock[] = {
+	{ CRL_APB_PLL_STATUS_OFFSET, 0x00000002U },
+};
+
+static const struct psu_init_wait psu_iopll_lock[] = {
+	{ CRL_APB_PLL_STATUS_OFFSET, 0x00000001U },
+};
+
+static const struct psu_init_wait psu_apll_lock[] = {
+	{ CRF_APB_PLL_STATUS_OFFSET, 0x00000001U },
+};
+
+static const struct psu_init_wait psu_dpll_lock[] = {
+	{ CRF_APB_PLL_STATUS_OFFSET, 0x00000002U },
+};
+
+static const struct psu_init_wait psu_vpll_lock[] = {
+	{ CRF_APB_PLL_STATUS_OFFSET, 0x00000004U },
+};
+
+/* Locks of the SERDES lanes */
+static const struct psu_init_wait psu_serdes_locks[] = {
+	{ SERDES_L0_PLL_STATUS_READ_1_OFFSET, 0x00000010U },
+	{ SERDES_L1_PLL_STATUS_READ_1_OFFSET, 0x00000010U },
+	{ SERDES_L2_PLL_STATUS_READ_1_OFFSET, 0x00000010U },
+	{ SERDES_L3_PLL_STATUS_READ_1_OFFSET, 0x00000010U },
+};
+
+/*
+ * Returns the first wait of the stage that does not hold, NULL when all do.
+ * With block set, polls each of them in turn until it holds or psu_poll()
+ * gives up, and returns NULL.
+ */
+static const struct psu_init_wait *psu_init_wait(
+	const struct psu_init_stage *stage, int block)
+{
+	const struct psu_init_wait *wait;
+	unsigned int i;
+
+	for (i = 0U; i < stage->nwaits; i++) {
+		wait = &stage->waits[i];
+		if (block != 0)
+			(void)psu_poll(wait->addr, wait->mask, 0U, 1);
+		else if ((Xil_In32(wait->addr) & wait->mask) == 0U)
+			return wait;
+	}
+	return NULL;
+}
+
+static unsigned long psu_ddr_qos_stage(void)
+{
+	psu_ddr_qos_init_data();
+	return 1;
+}
+
+#define PSU_INIT_PLL_DEPS (PSU_INIT_DEP(PSU_INIT_BLOCK_RPLL) | \
+	PSU_INIT_DEP(PSU_INIT_BLOCK_IOPLL) | \
+	PSU_INIT_DEP(PSU_INIT_BLOCK_APLL) | \
+	PSU_INIT_DEP(PSU_INIT_BLOCK_DPLL) | \
+	PSU_INIT_DEP(PSU_INIT_BLOCK_VPLL))
+
+/*
+ * RPLL, APLL, DPLL and VPLL lock while the MIO is set up. IOPLL is put in
+ * bypass once RPLL is out of it and SYSMON is back on RPLL, and
+ * psu_peripherals_pre_init_data() moves SYSMON to IOPLL once IOPLL is out
+ * of bypass, so that SYSMON never runs from a PLL in bypass.
+ * The AFIs and their QoS are set up while the SERDES lanes lock.
+ */
+static const struct psu_init_stage psu_init_stages[] = {
+	{ PSU_INIT_BLOCK_MIO, 0U, psu_mio_init_data, NULL, 0U, NULL },
+	{ PSU_INIT_BLOCK_PERIPHERALS_PRE, PSU_INIT_DEP(PSU_INIT_BLOCK_MIO) |
+		PSU_INIT_DEP(PSU_INIT_BLOCK_IOPLL),
+		psu_peripherals_pre_init_data, NULL, 0U, NULL },
+	{ PSU_INIT_BLOCK_RPLL, 0U, psu_rpll_start_data,
+		PSU_INIT_WAITS(psu_rpll_lock), psu_rpll_finish_data },
+	{ PSU_INIT_BLOCK_IOPLL, PSU_INIT_DEP(PSU_INIT_BLOCK_RPLL),
+		psu_iopll_start_data, PSU_INIT_WAITS(psu_iopll_lock),
+		psu_iopll_finish_data },
+	{ PSU_INIT_BLOCK_APLL, 0U, psu_apll_start_data,
+		PSU_INIT_WAITS(psu_apll_lock), psu_apll_finish_data },
+	{ PSU_INIT_BLOCK_DPLL, 0U, psu_dpll_start_data,
+		PSU_INIT_WAITS(psu_dpll_lock), psu_dpll_finish_data },
+	{ PSU_INIT_BLOCK_VPLL, 0U, psu_vpll_start_data,
+		PSU_INIT_WAITS(psu_vpll_lock), psu_vpll_finish_data },
+	{ PSU_INIT_BLOCK_CLOCK, PSU_INIT_PLL_DEPS |
+		PSU_INIT_DEP(PSU_INIT_BLOCK_PERIPHERALS_PRE),
+		psu_clock_init_data, NULL, 0U, NULL },
+#ifndef XPAR_DYNAMIC_DDR_ENABLED
+	{ PSU_INIT_BLOCK_DDR, PSU_INIT_DEP(PSU_INIT_BLOCK_CLOCK),
+		psu_ddr_init_data, NULL, 0U, NULL },
+	{ PSU_INIT_BLOCK_DDR_PHYBRINGUP, PSU_INIT_DEP(PSU_INIT_BLOCK_DDR),
+		psu_ddr_phybringup_data, NULL, 0U, NULL },
+#endif
+	{ PSU_INIT_BLOCK_PERIPHERALS, PSU_INIT_DEP(PSU_INIT_BLOCK_CLOCK) |
+		PSU_INIT_DEP(PSU_INIT_BLOCK_DDR) |
+		PSU_INIT_DEP(PSU_INIT_BLOCK_DDR_PHYBRINGUP),
+		psu_peripherals_init_data, NULL, 0U, NULL },
+	{ PSU_INIT_BLOCK_SERDES, PSU_INIT_DEP(PSU_INIT_BLOCK_PERIPHERALS),
+		init_serdes_start, PSU_INIT_WAITS(psu_serdes_locks),
+		init_serdes_finish },
+	{ PSU_INIT_BLOCK_PERIPHERALS_POWERDWN,
+		PSU_INIT_DEP(PSU_INIT_BLOCK_SERDES),
+		psu_peripherals_powerdwn_data, NULL, 0U, NULL },
+	{ PSU_INIT_BLOCK_AFI, PSU_INIT_DEP(PSU_INIT_BLOCK_PERIPHERALS),
+		psu_afi_config, NULL, 0U, NULL },
+	{ PSU_INIT_BLOCK_DDR_QOS, PSU_INIT_DEP(PSU_INIT_BLOCK_AFI),
+		psu_ddr_qos_stage, NULL, 0U, NULL },
+};
+
+#define PSU_INIT_STAGES \
+	(sizeof(psu_init_stages) / sizeof(psu_init_stages[0]))
+
+/*
+ * Returns the stage to start next, PSU_INIT_STAGES when none can start.
+ */
+static unsigned int psu_init_next(unsigned int started, unsigned int done)
+{
+	unsigned int next = PSU_INIT_STAGES;
+	unsigned int i;
+
+#ifdef PSU_INIT_SERIAL
+	(void)done;
+#endif
+	for (i = 0U; i < PSU_INIT_STAGES; i++) {
+		if ((started & PSU_INIT_DEP(i)) != 0U)
+			continue;
+#ifdef PSU_INIT_SERIAL
+		return i;
+#else
+		if ((psu_init_stages[i].deps & ~done) != 0U)
+			continue;
+		if (psu_init_stages[i].waits != NULL)
+			return i;
+		if (next == PSU_INIT_STAGES)
+			next = i;
+#endif
+	}
+	return next;
+}
+
+/*
+ * Runs the stages but those of the blocks of skip. A stage whose waits do
+ * not hold is finished once no stage can start nor finish, after polling
+ * them. psu_init_block_done() gets the block the stage waited for on the
+ * critical path: the block done last before it started, or before it
+ * finished when its hardware was ready at the first check.
+ */
+static int psu_init_run(unsigned int skip)
+{
+	const struct psu_init_stage *stage = NULL;
+	unsigned int after[PSU_INIT_STAGES];
+	unsigned int done = ~0U;
+	unsigned int started = 0U;
+	unsigned int checked = 0U;
+	unsigned int pending;
+	unsigned int last = PSU_INIT_BLOCK_NONE;
+	unsigned int i;
+	int status = 1;
+
+	for (i = 0U; i < PSU_INIT_STAGES; i++) {
+		if ((skip & PSU_INIT_DEP(psu_init_stages[i].block)) == 0U)
+			done &= ~PSU_INIT_DEP(psu_init_stages[i].block);
+		else
+			started |= PSU_INIT_DEP(i);
+	}
+
+	while (done != ~0U) {
+		i = psu_init_next(started, done);
+		if (i < PSU_INIT_STAGES) {
+			stage = &psu_init_stages[i];
+			started |= PSU_INIT_DEP(i);
+			after[i] = last;
+			psu_init_block_start(stage->block);
+			status &= stage->start();
+			if (stage->waits != NULL) {
+#ifndef PSU_INIT_SERIAL
+				continue;
+#else
+				(void)psu_init_wait(stage, 1);
+				status &= stage->finish();
+#endif
+			}
+			done |= PSU_INIT_DEP(stage->block);
+			last = stage->block;
+			psu_init_block_done(stage->block, after[i]);
+			continue;
+		}
+
+		pending = PSU_INIT_STAGES;
+		for (i = 0U; i < PSU_INIT_STAGES; i++) {
+			stage = &psu_init_stages[i];
+			if ((started & PSU_INIT_DEP(i)) == 0U ||
+			    (done & PSU_INIT_DEP(stage->block)) != 0U)
+				continue;
+			if (psu_init_wait(stage, 0) == NULL)
+				break;
+			checked |= PSU_INIT_DEP(i);
+			if (pending == PSU_INIT_STAGES)
+				pending = i;
+		}
+		if (i == PSU_INIT_STAGES) {
+			if (pending == PSU_INIT_STAGES)
+				return 0;
+			i = pending;
+			stage = &psu_init_stages[i];
+			(void)psu_init_wait(stage, 1);
+		} else if ((checked & PSU_INIT_DEP(i)) == 0U) {
+			after[i] = last;
+		}
+		status &= stage->finish();
+		done |= PSU_INIT_DEP(stage->block);
+		last = stage->block;
+		psu_init_block_done(stage->block, after[i]);
+	}
+
+	return status;
+}
+
+int
+psu_init(void)
+{
+	int status;
+
+	status = psu_init_run(0U);
+
+	if (status == 0)
+		return 1;
+	return 0;
+}
+
+int psu_init_ddr_self_refresh(void) {
+
+    int status;
+
+    status = psu_init_run(PSU_INIT_DEP(PSU_INIT_BLOCK_DDR_PHYBRINGUP));
+
+    if (status == 0)
+        return 1;
+    return 0;
+
+
+}
+#endif /* PSU_INIT_SEQUENTIAL */
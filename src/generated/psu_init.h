@@ -38608,6 +38608,58 @@ extern "C" {
  int psu_protection_lock();
  unsigned long psu_ddr_qos_init_data(void);
  unsigned long psu_apply_master_tz();
+
+/*
+ * psu_init() and psu_init_ddr_self_refresh() call psu_init_block_start()
+ * and psu_init_block_done() around each of these blocks, they do nothing
+ * unless they are redefined. The blocks run as soon as the blocks they
+ * depend on are done, while the PLLs and the SERDES lanes lock, after is
+ * the block a block waited for on the critical path, PSU_INIT_BLOCK_NONE
+ * for the first one. Define PSU_INIT_SERIAL to run them in the generated
+ * order, PSU_INIT_SEQUENTIAL to build the generated psu_init() instead.
+ */
+#define PSU_INIT_BLOCK_MIO			0U
+#define PSU_INIT_BLOCK_PERIPHERALS_PRE		1U
+#define PSU_INIT_BLOCK_RPLL			2U
+#define PSU_INIT_BLOCK_IOPLL			3U
+#define PSU_INIT_BLOCK_APLL			4U
+#define PSU_INIT_BLOCK_DPLL			5U
+#define PSU_INIT_BLOCK_VPLL			6U
+#define PSU_INIT_BLOCK_CLOCK			7U
+#define PSU_INIT_BLOCK_DDR			8U
+#define PSU_INIT_BLOCK_DDR_PHYBRINGUP		9U
+#define PSU_INIT_BLOCK_PERIPHERALS		10U
+#define PSU_INIT_BLOCK_SERDES			11U
+#define PSU_INIT_BLOCK_PERIPHERALS_POWERDWN	12U
+#define PSU_INIT_BLOCK_AFI			13U
+#define PSU_INIT_BLOCK_DDR_QOS			14U
+#define PSU_INIT_BLOCKS				15U
+#define PSU_INIT_BLOCK_NONE			0xFFU
+ void psu_init_block_start(unsigned int block);
+ void psu_init_block_done(unsigned int block, unsigned int after);
+
+/*
+ * All the polls of psu_init() go through psu_poll(): until
+ * (addr & mask) == value, or until any bit of mask is set when any is not
+ * 0. It returns 0 when it gave up, the default one after a number of reads,
+ * it can be redefined to poll on a deadline.
+ */
+ int psu_poll(unsigned long addr, unsigned int mask, unsigned int value,
+	int any);
+
+/*
+ * Each pass of the ILL calibration of the SERDES searches the ILL code of
+ * its active lanes with 64 BIST runs. psu_serdes_ill_restore() can provide
+ * the codes found by a previous boot instead and return 1, the pass then
+ * only applies them, and psu_serdes_ill_save() gets the codes of the passes
+ * searched. config holds the protocols and rates of the lanes, pass counts
+ * the passes of this config, meancount holds the codes of the lanes of the
+ * mask lanes. The default ones do nothing.
+ */
+ int psu_serdes_ill_restore(unsigned int config, unsigned int pass,
+	unsigned int lanes, unsigned int *meancount);
+ void psu_serdes_ill_save(unsigned int config, unsigned int pass,
+	unsigned int lanes, const unsigned int *meancount);
 #ifdef __cplusplus
 }
 #endif
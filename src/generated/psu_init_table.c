@@ -0,0 +1,520 @@
+/******************************************************************************
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file psu_init_table.c
+*
+* This file is automatically generated by tools/psu_table/psu_table_gen
+* from psu_init.c, see psu_table.h
+*
+*****************************************************************************/
+
+#include "psu_init_table.h"
+
+/* psu_rpll_start_data: 3 ops */
+const unsigned char psu_rpll_start_data_table[] = {
+	0x1C, 0x34, 0x00, 0x5E, 0xFF, 0xEF, 0xDB, 0xFF, 0xF3, 0x0F, 0xEC, 0xD8,
+	0x9C, 0xF3, 0x07, 0x18, 0x01, 0x89, 0xFE, 0xC5, 0x03, 0x89, 0xDA, 0x04,
+	0x14, 0x01, 0x00, 0x00
+};
+
+/* psu_rpll_finish_data: 3 ops */
+const unsigned char psu_rpll_finish_data_table[] = {
+	0x1C, 0x30, 0x00, 0x5E, 0xFF, 0x08, 0x00, 0x18, 0x0C, 0x80, 0x7E, 0x80,
+	0x04, 0x18, 0x60, 0x87, 0xFE, 0xFC, 0x09, 0x80, 0xC6, 0x84, 0x08, 0x00
+};
+
+/* psu_iopll_start_data: 3 ops */
+const unsigned char psu_iopll_start_data_table[] = {
+	0x1C, 0x24, 0x00, 0x5E, 0xFF, 0xEF, 0xDB, 0xFF, 0xF3, 0x0F, 0x82, 0x99,
+	0xAC, 0xF2, 0x07, 0x18, 0x01, 0x89, 0xFE, 0xC5, 0x03, 0x89, 0xB4, 0x05,
+	0x14, 0x01, 0x00, 0x00
+};
+
+/* psu_iopll_finish_data: 2 ops */
+const unsigned char psu_iopll_finish_data_table[] = {
+	0x1C, 0x20, 0x00, 0x5E, 0xFF, 0x08, 0x00, 0x18, 0x12, 0x80, 0x7E, 0x80,
+	0x06, 0x00
+};
+
+/* psu_apll_start_data: 3 ops */
+const unsigned char psu_apll_start_data_table[] = {
+	0x1C, 0x24, 0x00, 0x1A, 0xFD, 0xEF, 0xDB, 0xFF, 0xF3, 0x0F, 0xE2, 0x98,
+	0xAC, 0xF2, 0x07, 0x18, 0x01, 0x89, 0xFE, 0xC5, 0x03, 0x89, 0x90, 0x05,
+	0x14, 0x01, 0x00, 0x00
+};
+
+/* psu_apll_finish_data: 2 ops */
+const unsigned char psu_apll_finish_data_table[] = {
+	0x1C, 0x20, 0x00, 0x1A, 0xFD, 0x08, 0x00, 0x18, 0x14, 0x80, 0x7E, 0x80,
+	0x06, 0x00
+};
+
+/* psu_dpll_start_data: 3 ops */
+const unsigned char psu_dpll_start_data_table[] = {
+	0x1C, 0x30, 0x00, 0x1A, 0xFD, 0xEF, 0xDB, 0xFF, 0xF3, 0x0F, 0xE2, 0x98,
+	0xAC, 0xF2, 0x07, 0x18, 0x01, 0x89, 0xFE, 0xC5, 0x03, 0x89, 0x80, 0x05,
+	0x14, 0x01, 0x00, 0x00
+};
+
+/* psu_dpll_finish_data: 2 ops */
+const unsigned char psu_dpll_finish_data_table[] = {
+	0x1C, 0x2C, 0x00, 0x1A, 0xFD, 0x08, 0x00, 0x18, 0x10, 0x80, 0x7E, 0x80,
+	0x04, 0x00
+};
+
+/* psu_vpll_start_data: 3 ops */
+const unsigned char psu_vpll_start_data_table[] = {
+	0x1C, 0x3C, 0x00, 0x1A, 0xFD, 0xEF, 0xDB, 0xFF, 0xF3, 0x0F, 0x82, 0x99,
+	0xAC, 0xF2, 0x07, 0x18, 0x01, 0x89, 0xFE, 0xC5, 0x03, 0x89, 0xB4, 0x05,
+	0x14, 0x01, 0x00, 0x00
+};
+
+/* psu_vpll_finish_data: 2 ops */
+const unsigned char psu_vpll_finish_data_table[] = {
+	0x1C, 0x38, 0x00, 0x1A, 0xFD, 0x08, 0x00, 0x18, 0x0C, 0x80, 0x7E, 0x80,
+	0x06, 0x00
+};
+
+/* psu_pll_init_data: 31 ops */
+const unsigned char psu_pll_init_data_table[] = {
+	0x1C, 0x34, 0x00, 0x5E, 0xFF, 0xEF, 0xDB, 0xFF, 0xF3, 0x0F, 0xEC, 0xD8,
+	0x9C, 0xF3, 0x07, 0x18, 0x01, 0x89, 0xFE, 0xC5, 0x03, 0x89, 0xDA, 0x04,
+	0x14, 0x01, 0x00, 0x38, 0x08, 0x02, 0x18, 0x07, 0x08, 0x00, 0x18, 0x0C,
+	0x80, 0x7E, 0x80, 0x04, 0x18, 0x60, 0x87, 0xFE, 0xFC, 0x09, 0x80, 0xC6,
+	0x84, 0x08, 0x18, 0x71, 0xEF, 0xDB, 0xFF, 0xF3, 0x0F, 0x82, 0x99, 0xAC,
+	0xF2, 0x07, 0x18, 0x01, 0x89, 0xFE, 0xC5, 0x03, 0x89, 0xB4, 0x05, 0x14,
+	0x01, 0x00, 0x38, 0x10, 0x01, 0x18, 0x0F, 0x08, 0x00, 0x18, 0x12, 0x80,
+	0x7E, 0x80, 0x06, 0x1C, 0x24, 0x00, 0x1A, 0xFD, 0xEF, 0xDB, 0xFF, 0xF3,
+	0x0F, 0xE2, 0x98, 0xAC, 0xF2, 0x07, 0x18, 0x01, 0x89, 0xFE, 0xC5, 0x03,
+	0x89, 0x90, 0x05, 0x14, 0x01, 0x00, 0x38, 0x12, 0x01, 0x18, 0x11, 0x08,
+	0x00, 0x18, 0x14, 0x80, 0x7E, 0x80, 0x06, 0x18, 0x0B, 0xEF, 0xDB, 0xFF,
+	0xF3, 0x0F, 0xE2, 0x98, 0xAC, 0xF2, 0x07, 0x18, 0x01, 0x89, 0xFE, 0xC5,
+	0x03, 0x89, 0x80, 0x05, 0x14, 0x01, 0x00, 0x38, 0x0C, 0x02, 0x18, 0x0B,
+	0x08, 0x00, 0x18, 0x10, 0x80, 0x7E, 0x80, 0x04, 0x18, 0x07, 0xEF, 0xDB,
+	0xFF, 0xF3, 0x0F, 0x82, 0x99, 0xAC, 0xF2, 0x07, 0x18, 0x01, 0x89, 0xFE,
+	0xC5, 0x03, 0x89, 0xB4, 0x05, 0x14, 0x01, 0x00, 0x38, 0x06, 0x04, 0x18,
+	0x05, 0x08, 0x00, 0x18, 0x0C, 0x80, 0x7E, 0x80, 0x06, 0x00
+};
+
+/* psu_clock_init_data: 41 ops */
+const unsigned char psu_clock_init_data_table[] = {
+	0x1C, 0x5C, 0x00, 0x5E, 0xFF, 0x87, 0xFE, 0xFC, 0x31, 0x80, 0x98, 0x84,
+	0x30, 0x18, 0x52, 0x87, 0xFE, 0xFC, 0x09, 0x80, 0x8C, 0x84, 0x08, 0x18,
+	0x4F, 0x87, 0xFE, 0xFC, 0x11, 0x80, 0x8C, 0x84, 0x10, 0x18, 0x09, 0x87,
+	0xFE, 0xFC, 0x11, 0x80, 0xB2, 0x8C, 0x10, 0x18, 0x0E, 0x87, 0xFE, 0xFC,
+	0x09, 0x80, 0x98, 0x84, 0x08, 0x18, 0x04, 0x87, 0xFE, 0xFC, 0x09, 0x80,
+	0x90, 0x84, 0x08, 0x1C, 0x0C, 0x03, 0x18, 0xFF, 0x80, 0x80, 0x08, 0x00,
+	0x1C, 0x74, 0x00, 0x5E, 0xFF, 0x87, 0xFE, 0xFC, 0x09, 0x80, 0x9E, 0x84,
+	0x08, 0x10, 0x87, 0xFE, 0xFC, 0x09, 0x80, 0x9E, 0x84, 0x08, 0x18, 0x54,
+	0x87, 0xFE, 0xFC, 0x09, 0x80, 0x9E, 0x84, 0x08, 0x10, 0x87, 0xFE, 0xFC,
+	0x09, 0x80, 0x9E, 0x84, 0x08, 0x18, 0x4D, 0x87, 0xFE, 0xFC, 0x09, 0x80,
+	0x9E, 0x84, 0x08, 0x18, 0x04, 0x87, 0xFE, 0x80, 0x08, 0x82, 0x86, 0x80,
+	0x08, 0x18, 0x06, 0x87, 0xFE, 0x80, 0x08, 0x82, 0x8C, 0x80, 0x08, 0x18,
+	0x04, 0x87, 0xFE, 0x80, 0x08, 0x80, 0x90, 0x80, 0x08, 0x10, 0x87, 0xFE,
+	0x80, 0x08, 0x82, 0x86, 0x80, 0x08, 0x10, 0x87, 0xFE, 0x80, 0x08, 0x82,
+	0x9E, 0x80, 0x08, 0x10, 0x87, 0xFE, 0x80, 0x08, 0x82, 0x8C, 0x80, 0x08,
+	0x18, 0x04, 0x87, 0xFE, 0x80, 0x08, 0x82, 0x86, 0x80, 0x08, 0x18, 0x04,
+	0x87, 0xFE, 0xFC, 0x09, 0x80, 0x9E, 0x84, 0x08, 0x18, 0x24, 0x87, 0xFE,
+	0xFC, 0x09, 0x82, 0xBC, 0x84, 0x08, 0x18, 0x01, 0x07, 0x00, 0x18, 0x12,
+	0x87, 0xFE, 0x80, 0x08, 0x80, 0x9E, 0x80, 0x08, 0x1C, 0xA0, 0x00, 0x1A,
+	0xFD, 0x87, 0xFE, 0x80, 0x08, 0x80, 0x84, 0x80, 0x08, 0x18, 0x0A, 0x87,
+	0xFE, 0x80, 0x08, 0x80, 0x84, 0x80, 0x08, 0x18, 0x21, 0x87, 0xFE, 0xFC,
+	0x09, 0x80, 0x8A, 0x84, 0x08, 0x10, 0x87, 0xFE, 0xFC, 0x09, 0x83, 0x9E,
+	0x84, 0x08, 0x18, 0x04, 0x87, 0xFE, 0xFC, 0x09, 0x83, 0x9C, 0x84, 0x08,
+	0x18, 0x0D, 0x87, 0xFE, 0x80, 0x18, 0x80, 0x82, 0x80, 0x18, 0x18, 0x04,
+	0x87, 0xFE, 0x80, 0x08, 0x80, 0x84, 0x80, 0x08, 0x18, 0x0C, 0x87, 0x7E,
+	0x80, 0x04, 0x10, 0x87, 0xFE, 0x80, 0x38, 0x80, 0x82, 0x80, 0x38, 0x18,
+	0x1A, 0x87, 0xFE, 0x80, 0x08, 0x80, 0x84, 0x80, 0x08, 0x10, 0x87, 0xFE,
+	0x80, 0x08, 0x80, 0x84, 0x80, 0x08, 0x10, 0x87, 0xFE, 0x80, 0x08, 0x83,
+	0x84, 0x80, 0x08, 0x10, 0x87, 0xFE, 0x80, 0x08, 0x82, 0x8A, 0x80, 0x08,
+	0x18, 0x1A, 0x87, 0x7E, 0x80, 0x04, 0x1C, 0x80, 0x03, 0x18, 0xFF, 0xFF,
+	0x01, 0x00, 0x1C, 0x00, 0x01, 0x61, 0xFD, 0x01, 0x00, 0x1C, 0x00, 0x03,
+	0x18, 0xFF, 0x01, 0x00, 0x18, 0xA8, 0xFD, 0x51, 0x01, 0x00, 0x00
+};
+
+/* psu_ddr_init_data: 260 ops */
+const unsigned char psu_ddr_init_data_table[] = {
+	0x1E, 0x08, 0x01, 0x1A, 0xFD, 0x08, 0x18, 0x83, 0x81, 0x26, 0xBD, 0xFC,
+	0xBE, 0x98, 0x0E, 0x90, 0x80, 0x90, 0x88, 0x04, 0x18, 0x08, 0xBF, 0xE0,
+	0x83, 0x80, 0x08, 0x30, 0x18, 0x08, 0xF3, 0x07, 0x80, 0x04, 0x20, 0x80,
+	0x80, 0x80, 0x04, 0x18, 0x06, 0x7F, 0x00, 0x10, 0x9F, 0xFE, 0xFF, 0x07,
+	0x90, 0x88, 0x82, 0x02, 0x18, 0x0E, 0xF4, 0xE3, 0xC7, 0x07, 0x80, 0x80,
+	0x84, 0x01, 0x10, 0xFF, 0x9F, 0xFC, 0x7F, 0x00, 0x18, 0x06, 0x73, 0x01,
+	0x10, 0xFF, 0x87, 0xFE, 0x7F, 0x8B, 0x81, 0x86, 0x04, 0x18, 0x06, 0x17,
+	0x10, 0x10, 0x03, 0x00, 0x18, 0x28, 0x91, 0x87, 0x80, 0xF8, 0x03, 0x80,
+	0x84, 0x80, 0x80, 0x01, 0x10, 0xBF, 0xBE, 0xFC, 0x0F, 0x9F, 0x8A, 0x80,
+	0x02, 0x18, 0x04, 0xFF, 0x9F, 0xFC, 0x9F, 0x0C, 0x86, 0x82, 0x08, 0x10,
+	0x8F, 0xFE, 0xFD, 0x0F, 0x80, 0x80, 0x08, 0x10, 0x8F, 0xFE, 0x03, 0x85,
+	0x46, 0x20, 0x81, 0x86, 0xC0, 0x39, 0x20, 0x80, 0x84, 0x80, 0x01, 0x10,
+	0xFF, 0x87, 0xFC, 0x07, 0x84, 0x80, 0x84, 0x01, 0x20, 0xC0, 0x0D, 0x10,
+	0x80, 0x80, 0xFC, 0xFF, 0x0F, 0x80, 0x80, 0xE4, 0x40, 0x10, 0x3F, 0x10,
+	0x10, 0xFF, 0x1F, 0xEF, 0x0C, 0x18, 0x06, 0xBF, 0xFE, 0xFD, 0xF9, 0x07,
+	0x92, 0xC8, 0xC0, 0x88, 0x01, 0x10, 0xFF, 0xBE, 0x7C, 0x9A, 0x88, 0x10,
+	0x10, 0xBF, 0xFE, 0xFC, 0xF9, 0x03, 0x8D, 0x8C, 0xA0, 0x38, 0x10, 0xFF,
+	0xE7, 0xCF, 0xFF, 0x03, 0x8C, 0x80, 0xC1, 0x02, 0x10, 0x9F, 0x9E, 0xBC,
+	0xF8, 0x01, 0x89, 0x86, 0x8C, 0x40, 0x10, 0x9F, 0xFE, 0xBC, 0x78, 0x83,
+	0x88, 0x98, 0x30, 0x10, 0x8F, 0x80, 0xBC, 0x78, 0x84, 0x80, 0x84, 0x08,
+	0x10, 0x8F, 0x1E, 0x86, 0x0C, 0x10, 0xFF, 0xFE, 0xFD, 0xFB, 0x07, 0x86,
+	0x9A, 0x8C, 0x18, 0x10, 0xBF, 0x9E, 0x9C, 0x80, 0x04, 0x8B, 0x84, 0x08,
+	0x18, 0x04, 0x9F, 0x86, 0xFC, 0xF8, 0x07, 0x8E, 0x82, 0x9C, 0x88, 0x01,
+	0x10, 0x9F, 0x9E, 0x0C, 0x88, 0x8C, 0x08, 0x18, 0x28, 0xFF, 0x87, 0xFC,
+	0xBF, 0x0F, 0xC0, 0x80, 0x80, 0x88, 0x08, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x03, 0xDC, 0xAD, 0x86, 0x10, 0x18, 0x06, 0xBF, 0xFE, 0xFE, 0xFD, 0x01,
+	0x8B, 0x84, 0xAE, 0x24, 0x10, 0x8F, 0x9E, 0xFC, 0x98, 0x0F, 0x84, 0x86,
+	0x0C, 0x10, 0xF1, 0xE3, 0xC7, 0x7F, 0x81, 0x82, 0x80, 0x38, 0x10, 0xF1,
+	0x01, 0x21, 0x10, 0xFF, 0x87, 0xFC, 0x9F, 0x0C, 0x83, 0x80, 0x80, 0x02,
+	0x10, 0xFF, 0x81, 0xFC, 0x07, 0xFF, 0x81, 0xA0, 0x06, 0x18, 0x06, 0x07,
+	0x00, 0x10, 0xBF, 0x7E, 0x89, 0x12, 0x18, 0x06, 0x07, 0x01, 0x1A, 0x20,
+	0x1F, 0x10, 0x9F, 0xBE, 0x7C, 0x8A, 0x94, 0x7C, 0x10, 0x8F, 0x9E, 0xBC,
+	0x78, 0x80, 0x82, 0x84, 0x08, 0x10, 0x8F, 0x9E, 0xBC, 0x78, 0x81, 0x82,
+	0x84, 0x08, 0x12, 0x8F, 0x1E, 0x10, 0x8F, 0x9E, 0xBC, 0x78, 0x88, 0x90,
+	0xBC, 0x40, 0x10, 0x8F, 0x9E, 0xBC, 0xF8, 0x08, 0x88, 0x90, 0xA0, 0x78,
+	0x12, 0x8F, 0x1E, 0x10, 0x9F, 0x3E, 0x81, 0x10, 0x10, 0x8F, 0x9E, 0xBC,
+	0x78, 0x88, 0x90, 0xA0, 0x40, 0x10, 0x8F, 0x9E, 0xBC, 0x78, 0x88, 0x90,
+	0xA0, 0x40, 0x10, 0x0F, 0x08, 0x18, 0x0A, 0xFC, 0x9E, 0xFC, 0x78, 0x80,
+	0x8C, 0x80, 0x30, 0x10, 0xB3, 0x66, 0x01, 0x18, 0x06, 0x87, 0xFE, 0xFC,
+	0xFF, 0x07, 0x81, 0xC0, 0x80, 0x08, 0x18, 0x0A, 0xFF, 0xFF, 0x83, 0xF8,
+	0x0F, 0xC0, 0x80, 0x80, 0x40, 0x18, 0x04, 0xFF, 0xFF, 0x83, 0xF8, 0x0F,
+	0xC0, 0x80, 0x80, 0x40, 0x28, 0x0A, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20,
+	0x00, 0x10, 0xFF, 0xFF, 0x03, 0x00, 0x12, 0x01, 0x18, 0x36, 0x11, 0x00,
+	0x18, 0x06, 0xB3, 0x80, 0x80, 0x80, 0x08, 0x00, 0x18, 0x0A, 0x01, 0x00,
+	0x18, 0x70, 0x91, 0x02, 0x01, 0x10, 0xFF, 0xE7, 0x01, 0x8F, 0x40, 0x10,
+	0xFF, 0xE7, 0x01, 0x8F, 0x40, 0x1A, 0x44, 0x01, 0x10, 0x8F, 0x80, 0xCC,
+	0x01, 0x8B, 0x80, 0x80, 0x01, 0x10, 0xFF, 0x8F, 0xFC, 0x3F, 0x00, 0x18,
+	0x0E, 0xFF, 0xE7, 0x01, 0x8F, 0x40, 0x10, 0xFF, 0xE7, 0x01, 0x8F, 0x40,
+	0x1A, 0x44, 0x01, 0x10, 0x8F, 0x9E, 0xCC, 0x19, 0x83, 0x96, 0x80, 0x10,
+	0x10, 0xFF, 0x8F, 0xFC, 0x3F, 0x00, 0x18, 0x0E, 0xFF, 0xE7, 0x01, 0x8F,
+	0x40, 0x10, 0xFF, 0xE7, 0x01, 0x8F, 0x40, 0x1A, 0x44, 0x01, 0x10, 0x8F,
+	0x9E, 0xCC, 0x19, 0x83, 0x96, 0x80, 0x10, 0x10, 0xFF, 0x8F, 0xFC, 0x3F,
+	0x00, 0x18, 0x0E, 0xFF, 0xE7, 0x01, 0x8F, 0x40, 0x10, 0xFF, 0xE7, 0x01,
+	0x8F, 0x40, 0x1A, 0x44, 0x01, 0x10, 0x8F, 0x80, 0xCC, 0x01, 0x83, 0x80,
+	0x40, 0x10, 0xFF, 0x8F, 0xFC, 0x3F, 0x4F, 0x10, 0x8F, 0x80, 0xCC, 0x01,
+	0x83, 0x80, 0x40, 0x10, 0xFF, 0x0F, 0x4F, 0x18, 0x0A, 0xFF, 0xE7, 0x01,
+	0x8F, 0x40, 0x10, 0xFF, 0xE7, 0x01, 0x8F, 0x40, 0x1A, 0x44, 0x01, 0x10,
+	0x8F, 0x80, 0xCC, 0x01, 0x83, 0x80, 0x40, 0x10, 0xFF, 0x8F, 0xFC, 0x3F,
+	0x4F, 0x10, 0x8F, 0x80, 0xCC, 0x01, 0x83, 0x80, 0x40, 0x10, 0xFF, 0x0F,
+	0x4F, 0x18, 0x0A, 0xFF, 0xE7, 0x01, 0x8F, 0x40, 0x10, 0xFF, 0xE7, 0x01,
+	0x8F, 0x40, 0x1A, 0x44, 0x01, 0x10, 0x8F, 0x80, 0xCC, 0x01, 0x83, 0x80,
+	0x40, 0x10, 0xFF, 0x8F, 0xFC, 0x3F, 0x4F, 0x10, 0x8F, 0x80, 0xCC, 0x01,
+	0x83, 0x80, 0x40, 0x10, 0xFF, 0x0F, 0x4F, 0x18, 0xFA, 0x06, 0xFF, 0x03,
+	0x00, 0x10, 0xFF, 0x01, 0x00, 0x10, 0xFF, 0x03, 0x10, 0x10, 0xFF, 0x01,
+	0x0F, 0x18, 0xC0, 0x12, 0xBF, 0xFE, 0xFE, 0xFD, 0x01, 0x82, 0x80, 0x8A,
+	0x3C, 0x18, 0xBC, 0xDF, 0x25, 0x0C, 0x00, 0x28, 0xFB, 0x80, 0x24, 0x80,
+	0xBC, 0x80, 0x38, 0x28, 0x04, 0x90, 0x80, 0xC4, 0x07, 0x20, 0x80, 0xA9,
+	0xA9, 0xAD, 0x05, 0x28, 0x04, 0xF4, 0x81, 0x84, 0x08, 0x28, 0x0E, 0x90,
+	0xAB, 0x88, 0x96, 0x04, 0x20, 0xC0, 0xA5, 0xC4, 0x82, 0x0D, 0x28, 0x12,
+	0x80, 0x80, 0xC0, 0x08, 0x28, 0x14, 0xE1, 0x82, 0x81, 0x15, 0x28, 0x18,
+	0x00, 0x20, 0xE5, 0x01, 0x28, 0x1E, 0x8C, 0x88, 0x80, 0x40, 0x28, 0x08,
+	0x88, 0x9E, 0x90, 0x31, 0x20, 0x88, 0x80, 0x80, 0xC1, 0x02, 0x20, 0x80,
+	0x86, 0x3C, 0x20, 0x80, 0x90, 0x80, 0x98, 0x08, 0x20, 0x87, 0xD6, 0xD8,
+	0x08, 0x20, 0x88, 0x9E, 0xCC, 0x01, 0x20, 0x8F, 0x1C, 0x28, 0x0C, 0xA0,
+	0x80, 0x80, 0x42, 0x20, 0x80, 0x19, 0x28, 0x06, 0x00, 0x20, 0x80, 0x06,
+	0x28, 0x16, 0xB0, 0x0C, 0x20, 0x81, 0x06, 0x20, 0x20, 0x20, 0x80, 0x04,
+	0x20, 0x00, 0x20, 0xC0, 0x0D, 0x20, 0x99, 0x10, 0x28, 0x0A, 0x00, 0x20,
+	0x4D, 0x20, 0x08, 0x20, 0x4D, 0x28, 0x10, 0x00, 0x28, 0x14, 0xC7, 0xA3,
+	0x82, 0x80, 0x08, 0x20, 0xB6, 0x84, 0x04, 0x28, 0x1E, 0xD4, 0xA0, 0x50,
+	0x28, 0x08, 0x80, 0x80, 0x22, 0x28, 0xE2, 0x01, 0x80, 0xA0, 0xD0, 0x91,
+	0x01, 0x28, 0x70, 0x05, 0x28, 0x06, 0xA8, 0x80, 0x80, 0x80, 0x03, 0x28,
+	0x04, 0x80, 0x80, 0x80, 0x50, 0x20, 0x09, 0x20, 0x80, 0x80, 0x80, 0x50,
+	0x28, 0x08, 0xCE, 0xE1, 0x82, 0x18, 0x28, 0x04, 0x99, 0xC0, 0x8C, 0xC8,
+	0x0F, 0x20, 0xE3, 0x83, 0xC0, 0x3F, 0x28, 0x0C, 0x00, 0x20, 0x00, 0x28,
+	0x08, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x28, 0x8E, 0x01, 0xD8,
+	0xD4, 0xAA, 0x04, 0x20, 0xDD, 0xF3, 0x01, 0x28, 0x08, 0x90, 0x84, 0x84,
+	0x0F, 0x20, 0x80, 0x80, 0x84, 0x0F, 0x28, 0x06, 0xDB, 0xF7, 0x21, 0x28,
+	0x2E, 0x84, 0x8C, 0x80, 0x84, 0x04, 0x20, 0xFF, 0xFF, 0x01, 0x28, 0x04,
+	0x88, 0x80, 0x80, 0xF8, 0x03, 0x20, 0xBC, 0xE0, 0x82, 0x70, 0x20, 0xD5,
+	0xAA, 0xA5, 0x48, 0x20, 0xAB, 0xD6, 0xA4, 0x48, 0x28, 0x74, 0x84, 0x8C,
+	0x80, 0x84, 0x04, 0x20, 0xFF, 0xFF, 0x01, 0x28, 0x04, 0x88, 0x80, 0x80,
+	0xF8, 0x03, 0x20, 0xBC, 0xE0, 0x82, 0x70, 0x20, 0xD5, 0xAA, 0xA5, 0x48,
+	0x20, 0xAB, 0xD6, 0xA4, 0x48, 0x28, 0x74, 0x84, 0x8C, 0x80, 0x84, 0x04,
+	0x20, 0xFF, 0xFF, 0x01, 0x28, 0x04, 0x88, 0x80, 0x80, 0xF8, 0x03, 0x20,
+	0x84, 0xE0, 0x82, 0x70, 0x20, 0xD5, 0xAA, 0xA5, 0x48, 0x20, 0xAB, 0xD6,
+	0xA4, 0x48, 0x28, 0x74, 0x84, 0x8C, 0x80, 0x84, 0x04, 0x20, 0xFF, 0xFF,
+	0x01, 0x28, 0x04, 0x88, 0x80, 0x80, 0xF8, 0x03, 0x20, 0x84, 0xE0, 0x82,
+	0x70, 0x20, 0xD5, 0xAA, 0xA5, 0x48, 0x20, 0xAB, 0xD6, 0xA4, 0x48, 0x28,
+	0x74, 0x84, 0x8C, 0x80, 0x84, 0x04, 0x20, 0xFF, 0xFF, 0x01, 0x20, 0x00,
+	0x20, 0x88, 0x80, 0x80, 0xF8, 0x03, 0x20, 0x84, 0xE0, 0x82, 0x70, 0x20,
+	0xD5, 0xAA, 0xA5, 0x48, 0x20, 0xAB, 0xD6, 0xA4, 0x48, 0x28, 0x74, 0x84,
+	0x8C, 0x80, 0x84, 0x04, 0x20, 0xFF, 0xFF, 0x01, 0x20, 0x00, 0x20, 0x88,
+	0x80, 0x80, 0xF8, 0x03, 0x20, 0xBC, 0xE0, 0x82, 0x70, 0x20, 0xD5, 0xAA,
+	0xA5, 0x48, 0x20, 0xAB, 0xD6, 0xA4, 0x48, 0x28, 0x74, 0x84, 0x8C, 0x80,
+	0x84, 0x04, 0x20, 0xFF, 0xFF, 0x01, 0x20, 0x00, 0x20, 0x88, 0x80, 0x80,
+	0xF8, 0x03, 0x20, 0x84, 0xE0, 0x82, 0x70, 0x20, 0xD5, 0xAA, 0xA5, 0x48,
+	0x20, 0xAB, 0xD6, 0xA4, 0x48, 0x28, 0x74, 0x84, 0x8C, 0x80, 0x84, 0x04,
+	0x20, 0xFF, 0xFF, 0x01, 0x20, 0x00, 0x20, 0x88, 0x80, 0x80, 0xF8, 0x03,
+	0x20, 0xBC, 0xE0, 0x82, 0x70, 0x20, 0xD5, 0xAA, 0xA5, 0x48, 0x20, 0xAB,
+	0xD6, 0xA4, 0x48, 0x28, 0x74, 0xE0, 0xEC, 0x80, 0x84, 0x08, 0x20, 0x80,
+	0xC0, 0xD5, 0xAA, 0x05, 0x20, 0xAA, 0xD5, 0xAA, 0xD5, 0x0A, 0x20, 0xA4,
+	0xC9, 0xA6, 0x01, 0x20, 0x80, 0xE0, 0x82, 0x60, 0x20, 0xD5, 0xAA, 0xA5,
+	0x48, 0x20, 0xAB, 0xD6, 0xA4, 0x48, 0x28, 0xF4, 0x04, 0xFE, 0xBF, 0x86,
+	0xD0, 0x02, 0x20, 0x80, 0x80, 0xC0, 0x08, 0x28, 0x0C, 0x80, 0x86, 0x99,
+	0x09, 0x28, 0x08, 0x80, 0xB0, 0x10, 0x20, 0x80, 0x80, 0x80, 0x84, 0x07,
+	0x28, 0x08, 0xFE, 0xBF, 0x86, 0xD0, 0x02, 0x20, 0x80, 0x80, 0xC0, 0x08,
+	0x28, 0x0C, 0x80, 0x86, 0x99, 0x09, 0x28, 0x08, 0x80, 0xB0, 0x10, 0x20,
+	0x80, 0x80, 0x80, 0x84, 0x07, 0x28, 0x08, 0xFE, 0xBF, 0x86, 0xD0, 0x02,
+	0x20, 0x80, 0x80, 0xC0, 0x08, 0x28, 0x0C, 0x80, 0x86, 0x99, 0x09, 0x28,
+	0x08, 0x80, 0xB0, 0x10, 0x20, 0x80, 0x80, 0x80, 0x84, 0x07, 0x28, 0x08,
+	0xFE, 0xBF, 0x86, 0xD0, 0x02, 0x20, 0x80, 0x80, 0xC0, 0x08, 0x28, 0x0C,
+	0x80, 0x86, 0x99, 0x09, 0x28, 0x08, 0x80, 0xB0, 0x10, 0x20, 0x80, 0x80,
+	0x80, 0x84, 0x07, 0x28, 0x08, 0xFE, 0xBF, 0x86, 0xA8, 0x01, 0x20, 0x80,
+	0x80, 0xC0, 0x88, 0x02, 0x28, 0x0C, 0x80, 0xC6, 0x99, 0x09, 0x28, 0x08,
+	0x80, 0xB0, 0x10, 0x20, 0x80, 0x80, 0x80, 0x82, 0x07, 0x28, 0xD6, 0x02,
+	0xC4, 0x87, 0x99, 0x09, 0x00
+};
+
+/* psu_ddr_qos_init_data: 14 ops */
+const unsigned char psu_ddr_qos_init_data_table[] = {
+	0x1C, 0x08, 0x00, 0x36, 0xFD, 0x0F, 0x00, 0x18, 0x0A, 0x0F, 0x00, 0x18,
+	0xF6, 0xFF, 0x01, 0x0F, 0x00, 0x18, 0x0A, 0x0F, 0x00, 0x18, 0xF6, 0xFF,
+	0x01, 0x0F, 0x00, 0x18, 0x0A, 0x0F, 0x00, 0x18, 0xF6, 0xFF, 0x01, 0x0F,
+	0x00, 0x18, 0x0A, 0x0F, 0x00, 0x18, 0xF6, 0xFF, 0x01, 0x0F, 0x00, 0x18,
+	0x0A, 0x0F, 0x00, 0x18, 0xF6, 0xFF, 0x01, 0x0F, 0x00, 0x18, 0x0A, 0x0F,
+	0x00, 0x1C, 0x08, 0x00, 0x9B, 0xFF, 0x0F, 0x00, 0x18, 0x0A, 0x0F, 0x00,
+	0x00
+};
+
+/* psu_mio_init_data: 96 ops */
+const unsigned char psu_mio_init_data_table[] = {
+	0x1C, 0x00, 0x00, 0x18, 0xFF, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01, 0x02,
+	0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01, 0x02,
+	0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01, 0x02,
+	0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01, 0x02,
+	0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01, 0x00,
+	0x10, 0xFE, 0x01, 0x40, 0x10, 0xFE, 0x01, 0x40, 0x10, 0xFE, 0x01, 0x40,
+	0x10, 0xFE, 0x01, 0x40, 0x10, 0xFE, 0x01, 0xC0, 0x01, 0x10, 0xFE, 0x01,
+	0xC0, 0x01, 0x10, 0xFE, 0x01, 0xC0, 0x01, 0x10, 0xFE, 0x01, 0xC0, 0x01,
+	0x10, 0xFE, 0x01, 0x00, 0x10, 0xFE, 0x01, 0x00, 0x10, 0xFE, 0x01, 0x20,
+	0x10, 0xFE, 0x01, 0x20, 0x10, 0xFE, 0x01, 0x00, 0x10, 0xFE, 0x01, 0x18,
+	0x10, 0xFE, 0x01, 0x18, 0x10, 0xFE, 0x01, 0x18, 0x10, 0xFE, 0x01, 0x18,
+	0x10, 0xFE, 0x01, 0x00, 0x10, 0xFE, 0x01, 0x08, 0x10, 0xFE, 0x01, 0x08,
+	0x18, 0x0A, 0xFE, 0x01, 0x00, 0x10, 0xFE, 0x01, 0x10, 0x10, 0xFE, 0x01,
+	0x10, 0x10, 0xFE, 0x01, 0x10, 0x10, 0xFE, 0x01, 0x10, 0x10, 0xFE, 0x01,
+	0x00, 0x10, 0xFE, 0x01, 0x10, 0x10, 0xFE, 0x01, 0x10, 0x10, 0xFE, 0x01,
+	0x10, 0x10, 0xFE, 0x01, 0x10, 0x10, 0xFE, 0x01, 0x10, 0x10, 0xFE, 0x01,
+	0x10, 0x10, 0xFE, 0x01, 0x10, 0x10, 0xFE, 0x01, 0x10, 0x10, 0xFE, 0x01,
+	0x04, 0x10, 0xFE, 0x01, 0x04, 0x10, 0xFE, 0x01, 0x04, 0x10, 0xFE, 0x01,
+	0x04, 0x10, 0xFE, 0x01, 0x04, 0x10, 0xFE, 0x01, 0x04, 0x10, 0xFE, 0x01,
+	0x04, 0x10, 0xFE, 0x01, 0x04, 0x10, 0xFE, 0x01, 0x04, 0x10, 0xFE, 0x01,
+	0x04, 0x10, 0xFE, 0x01, 0x04, 0x10, 0xFE, 0x01, 0x04, 0x10, 0xFE, 0x01,
+	0x02, 0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01,
+	0x02, 0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01,
+	0x02, 0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01,
+	0x02, 0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01, 0x02, 0x10, 0xFE, 0x01,
+	0xC0, 0x01, 0x10, 0xFE, 0x01, 0xC0, 0x01, 0x28, 0x68, 0x80, 0x80, 0x90,
+	0x91, 0x05, 0x20, 0x80, 0xE0, 0xC0, 0x05, 0x10, 0xFF, 0x7F, 0xC0, 0x1F,
+	0x1A, 0x69, 0xFF, 0xFF, 0xFF, 0x1F, 0x12, 0xFF, 0xFF, 0xFF, 0x1F, 0x10,
+	0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x12, 0xFF, 0xFF, 0xFF, 0x1F, 0x12, 0xFF,
+	0xFF, 0xFF, 0x1F, 0x10, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x1A, 0x04, 0xFF,
+	0xFF, 0xFF, 0x1F, 0x12, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0xFF, 0xFF, 0xFF,
+	0x1F, 0x00, 0x12, 0xFF, 0xFF, 0xFF, 0x1F, 0x12, 0xFF, 0xFF, 0xFF, 0x1F,
+	0x10, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x1A, 0x04, 0xFF, 0xFF, 0xFF, 0x1F,
+	0x12, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x12,
+	0xFF, 0xFF, 0xFF, 0x1F, 0x12, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0xFF, 0xFF,
+	0xFF, 0x1F, 0x00, 0x18, 0x3E, 0x0F, 0x00, 0x00
+};
+
+/* psu_peripherals_pre_init_data: 2 ops */
+const unsigned char psu_peripherals_pre_init_data_table[] = {
+	0x1C, 0x08, 0x01, 0x5E, 0xFF, 0x87, 0xFE, 0xFC, 0x09, 0x82, 0xC6, 0x84,
+	0x08, 0x1A, 0x98, 0x01, 0x01, 0x00
+};
+
+/* psu_peripherals_init_data: 42 ops */
+const unsigned char psu_peripherals_init_data_table[] = {
+	0x1C, 0x00, 0x01, 0x1A, 0xFD, 0xFE, 0x80, 0x3E, 0x00, 0x1C, 0x38, 0x02,
+	0x5E, 0xFF, 0x81, 0x80, 0x68, 0x00, 0x10, 0x98, 0x80, 0xCF, 0x04, 0x00,
+	0x18, 0x05, 0x08, 0x00, 0x1E, 0x90, 0x03, 0x18, 0xFF, 0x04, 0x1C, 0x3C,
+	0x02, 0x5E, 0xFF, 0x80, 0x08, 0x00, 0x18, 0x01, 0x40, 0x00, 0x1C, 0x10,
+	0x03, 0x18, 0xFF, 0x80, 0x80, 0x02, 0x00, 0x18, 0x08, 0x80, 0x80, 0x90,
+	0x9C, 0x03, 0x80, 0x80, 0x90, 0x14, 0x18, 0x01, 0x80, 0x80, 0xF8, 0xFF,
+	0x07, 0x80, 0x80, 0xC0, 0xA2, 0x06, 0x1A, 0x1E, 0x08, 0x18, 0x19, 0x80,
+	0x80, 0x80, 0x1E, 0x00, 0x1C, 0x38, 0x02, 0x5E, 0xFF, 0x86, 0xFE, 0x03,
+	0x00, 0x1C, 0x34, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x10, 0x18, 0x0D, 0xFF,
+	0xFF, 0x03, 0x33, 0x18, 0x0B, 0xFF, 0x03, 0x17, 0x10, 0xFF, 0x07, 0x20,
+	0x18, 0x98, 0x80, 0x02, 0xFF, 0x01, 0x10, 0x18, 0x0D, 0xFF, 0xFF, 0x03,
+	0x33, 0x18, 0x0B, 0xFF, 0x03, 0x17, 0x10, 0xFF, 0x07, 0x20, 0x1C, 0x38,
+	0x02, 0x5E, 0xFF, 0x80, 0x80, 0x10, 0x00, 0x1A, 0x89, 0x82, 0x26, 0xFF,
+	0x01, 0x1C, 0x00, 0x50, 0xCA, 0xFF, 0xFF, 0x3F, 0x00, 0x1C, 0x60, 0x00,
+	0x5C, 0xFD, 0x8F, 0x80, 0x3C, 0x00, 0x1E, 0x40, 0x00, 0xA6, 0xFF, 0x80,
+	0x80, 0x80, 0x80, 0x08, 0x2C, 0x20, 0x00, 0x26, 0xFF, 0xF8, 0xF3, 0xD6,
+	0x2F, 0x1A, 0x0F, 0x01, 0x18, 0xA8, 0x82, 0x70, 0x8F, 0x1E, 0x82, 0x04,
+	0x50, 0x01, 0x14, 0x8F, 0x1E, 0x02, 0x50, 0x05, 0x14, 0x8F, 0x1E, 0x82,
+	0x04, 0x1C, 0x44, 0x02, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x20, 0x10,
+	0xFF, 0xFF, 0xFF, 0x1F, 0x20, 0x28, 0x9F, 0x02, 0xA0, 0x80, 0xFC, 0xFE,
+	0x0F, 0x50, 0x01, 0x24, 0x80, 0x80, 0xFC, 0xFE, 0x0F, 0x50, 0x05, 0x18,
+	0x9E, 0x02, 0xFF, 0xFF, 0xFF, 0x1F, 0x20, 0x10, 0xFF, 0xFF, 0xFF, 0x1F,
+	0x20, 0x28, 0x9F, 0x02, 0x80, 0x80, 0xFC, 0xFE, 0x0F, 0x00
+};
+
+/* psu_apply_master_tz: 7 ops */
+const unsigned char psu_apply_master_tz_table[] = {
+	0x1E, 0x40, 0x00, 0x69, 0xFD, 0x01, 0x1A, 0x07, 0xFF, 0xFF, 0xFF, 0x0F,
+	0x1E, 0x34, 0x00, 0x4B, 0xFF, 0x03, 0x18, 0x97, 0x80, 0x4E, 0xFF, 0x9F,
+	0xFC, 0x0F, 0x92, 0x89, 0xC8, 0x04, 0x18, 0x01, 0xFF, 0x9F, 0xFC, 0x7F,
+	0x92, 0x89, 0xC8, 0x24, 0x1A, 0x92, 0x80, 0x4E, 0xFF, 0x01, 0x1E, 0x50,
+	0x00, 0x69, 0xFD, 0xFF, 0x01, 0x00
+};
+
+/* psu_serdes_init_data: 106 ops */
+const unsigned char psu_serdes_init_data_table[] = {
+	0x1C, 0x00, 0x00, 0x41, 0xFD, 0x1F, 0x0D, 0x10, 0x1F, 0x09, 0x10, 0x1F,
+	0x08, 0x10, 0x1F, 0x0F, 0x1A, 0xD5, 0xD7, 0x01, 0x80, 0x01, 0x10, 0x88,
+	0x01, 0x08, 0x12, 0x80, 0x01, 0x10, 0x82, 0x01, 0x02, 0x1A, 0x94, 0x78,
+	0x10, 0x18, 0xEA, 0x02, 0xFF, 0x01, 0x38, 0x10, 0x07, 0x03, 0x18, 0xFE,
+	0x3F, 0xFF, 0x01, 0xE0, 0x01, 0x10, 0x07, 0x03, 0x18, 0x81, 0x80, 0x01,
+	0xFF, 0x01, 0x58, 0x10, 0x07, 0x03, 0x10, 0xFF, 0x01, 0x7C, 0x10, 0xFF,
+	0x01, 0x33, 0x10, 0xFF, 0x01, 0x02, 0x10, 0x33, 0x30, 0x18, 0xFA, 0x3F,
+	0xFF, 0x01, 0xF4, 0x01, 0x10, 0xFF, 0x01, 0x31, 0x10, 0xFF, 0x01, 0x02,
+	0x10, 0x33, 0x30, 0x18, 0xFA, 0x3F, 0xFF, 0x01, 0xC9, 0x01, 0x10, 0xFF,
+	0x01, 0xD2, 0x01, 0x10, 0xFF, 0x01, 0x01, 0x10, 0xB3, 0x01, 0xB0, 0x01,
+	0x1A, 0x87, 0x53, 0x03, 0x1A, 0xBB, 0x0F, 0x03, 0x1A, 0xB6, 0x62, 0x40,
+	0x1A, 0xF9, 0x12, 0x0F, 0x1A, 0xBB, 0x0F, 0x0B, 0x1A, 0x93, 0xB0, 0x01,
+	0x20, 0x1A, 0x80, 0x80, 0x01, 0x20, 0x1A, 0xAB, 0x80, 0x01, 0x10, 0x1A,
+	0x80, 0x40, 0x10, 0x1A, 0x80, 0x40, 0x10, 0x1A, 0x80, 0x40, 0x10, 0x1A,
+	0xEB, 0xB7, 0x01, 0x80, 0x01, 0x18, 0x2E, 0xFF, 0x01, 0x64, 0x10, 0xFF,
+	0x01, 0x64, 0x18, 0x4A, 0xFF, 0x01, 0x11, 0x18, 0x35, 0xFF, 0x01, 0x04,
+	0x10, 0xFF, 0x01, 0xFE, 0x01, 0x18, 0x13, 0xFF, 0x01, 0x64, 0x18, 0x16,
+	0xFF, 0x01, 0x00, 0x1A, 0x2A, 0xFF, 0x01, 0x18, 0x35, 0xFF, 0x01, 0xF7,
+	0x01, 0x12, 0x01, 0x18, 0x14, 0xFF, 0x01, 0xF7, 0x01, 0x12, 0x01, 0x1A,
+	0x28, 0x07, 0x1A, 0x80, 0x40, 0x07, 0x1A, 0x84, 0x3F, 0x80, 0x01, 0x18,
+	0x2E, 0xFF, 0x01, 0x1A, 0x10, 0xFF, 0x01, 0x1A, 0x18, 0x4A, 0xFF, 0x01,
+	0x10, 0x18, 0x35, 0xFF, 0x01, 0xFE, 0x01, 0x10, 0xFF, 0x01, 0x00, 0x18,
+	0x13, 0xFF, 0x01, 0x1A, 0x18, 0x16, 0xFF, 0x01, 0x00, 0x1A, 0x2A, 0xFF,
+	0x01, 0x18, 0x35, 0xFF, 0x01, 0xF7, 0x01, 0x12, 0x01, 0x18, 0x14, 0xFF,
+	0x01, 0xF7, 0x01, 0x12, 0x01, 0x1A, 0x28, 0x07, 0x1A, 0x84, 0x3F, 0x80,
+	0x01, 0x18, 0x2E, 0xFF, 0x01, 0x7D, 0x10, 0xFF, 0x01, 0x7D, 0x18, 0x4A,
+	0xFF, 0x01, 0x01, 0x18, 0x35, 0xFF, 0x01, 0x9C, 0x01, 0x10, 0xFF, 0x01,
+	0x39, 0x18, 0x32, 0xF0, 0x01, 0x20, 0x18, 0x45, 0xFF, 0x01, 0x7D, 0x18,
+	0x16, 0xFF, 0x01, 0x64, 0x1A, 0x2A, 0xFF, 0x01, 0x18, 0x35, 0xFF, 0x01,
+	0xF7, 0x01, 0x12, 0x01, 0x18, 0x14, 0xFF, 0x01, 0xF7, 0x01, 0x12, 0x01,
+	0x1A, 0x28, 0x07, 0x18, 0x8B, 0xC9, 0x01, 0x0F, 0x01, 0x18, 0x80, 0x40,
+	0x0F, 0x01, 0x18, 0x80, 0x40, 0x0F, 0x01, 0x18, 0x80, 0x40, 0x0F, 0x01,
+	0x1A, 0xEB, 0xB6, 0x01, 0xFF, 0x01, 0x1A, 0xB5, 0x09, 0x40, 0x1A, 0x05,
+	0x40, 0x1A, 0xBC, 0x49, 0xFF, 0x01, 0x1A, 0xB5, 0x09, 0x40, 0x1A, 0x05,
+	0x40, 0x1A, 0xBC, 0x49, 0xFF, 0x01, 0x1A, 0xB5, 0x09, 0x40, 0x1A, 0x05,
+	0x40, 0x1A, 0xBC, 0x49, 0xFF, 0x01, 0x1A, 0xB5, 0x09, 0x40, 0x1A, 0x05,
+	0x40, 0x18, 0xBF, 0xB6, 0x01, 0x03, 0x00, 0x18, 0x80, 0x40, 0x03, 0x00,
+	0x18, 0x80, 0x40, 0x03, 0x00, 0x18, 0x80, 0x40, 0x03, 0x00, 0x1A, 0x99,
+	0xC0, 0x01, 0x10, 0x1A, 0x80, 0x40, 0x10, 0x1A, 0x80, 0x40, 0x10, 0x1A,
+	0x80, 0x40, 0x10, 0x00
+};
+
+/* psu_serdes_init_data: 13 ops */
+const unsigned char psu_serdes_init_data_table1[] = {
+	0x2C, 0x1C, 0x00, 0x3D, 0xFD, 0x01, 0x18, 0xFA, 0xFF, 0x07, 0x77, 0x41,
+	0x10, 0x77, 0x23, 0x1A, 0xAF, 0xB3, 0x01, 0x37, 0x1A, 0xED, 0x0A, 0x01,
+	0x1A, 0x80, 0x80, 0x01, 0x01, 0x18, 0x9E, 0x1A, 0xFF, 0x01, 0xE6, 0x01,
+	0x18, 0x16, 0x1F, 0x0C, 0x1A, 0xF9, 0x02, 0x20, 0x10, 0x07, 0x06, 0x18,
+	0xC7, 0x8C, 0x01, 0x1F, 0x00, 0x18, 0xBB, 0x0C, 0xFF, 0x01, 0x00, 0x18,
+	0x80, 0x80, 0x01, 0xFF, 0x01, 0x01, 0x00
+};
+
+/* psu_resetout_start_data: 58 ops */
+const unsigned char psu_resetout_start_data_table[] = {
+	0x1C, 0x3C, 0x02, 0x5E, 0xFF, 0x80, 0x08, 0x00, 0x1A, 0xA2, 0xFE, 0x7D,
+	0x01, 0x18, 0x01, 0x01, 0x00, 0x18, 0x9F, 0xFE, 0x7D, 0xC0, 0x02, 0x00,
+	0x18, 0x05, 0x08, 0x00, 0x1E, 0x00, 0x01, 0x3D, 0xFD, 0x03, 0x18, 0xFF,
+	0xFF, 0x45, 0x82, 0x80, 0x34, 0x00, 0x18, 0x80, 0x81, 0x60, 0x02, 0x00,
+	0x18, 0x1C, 0x0F, 0x00, 0x1C, 0x00, 0xC2, 0x20, 0xFE, 0xFF, 0xFF, 0x08,
+	0xD7, 0xC8, 0x08, 0x18, 0x98, 0x04, 0x80, 0xFE, 0xFF, 0x01, 0x00, 0x1A,
+	0x89, 0x05, 0x80, 0x0C, 0x1A, 0x08, 0x80, 0x80, 0x01, 0x1C, 0x64, 0x00,
+	0x48, 0xFD, 0xFF, 0x07, 0x86, 0x04, 0x18, 0x23, 0xFF, 0xFF, 0x03, 0x00,
+	0x10, 0xFF, 0xFF, 0x03, 0x00, 0x10, 0xFF, 0xFF, 0x03, 0x00, 0x10, 0xFF,
+	0xFF, 0x03, 0x00, 0x12, 0xFF, 0xFF, 0x03, 0x10, 0xFF, 0xFF, 0x03, 0xFF,
+	0x01, 0x10, 0xFF, 0xFF, 0x03, 0x00, 0x12, 0xFF, 0xFF, 0x03, 0x10, 0xFF,
+	0xFF, 0x03, 0xF0, 0xFF, 0x03, 0x10, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0x03,
+	0x10, 0xFF, 0xFF, 0x03, 0xF1, 0xFF, 0x03, 0x10, 0xFF, 0xFF, 0x03, 0xF1,
+	0xFF, 0x03, 0x18, 0x12, 0xB8, 0x0E, 0x80, 0x02, 0x18, 0x2E, 0xF0, 0xFF,
+	0x03, 0x40, 0x18, 0x6E, 0xFF, 0x0F, 0xCD, 0x01, 0x10, 0xFF, 0x7F, 0xA4,
+	0x0C, 0x10, 0xFF, 0x0F, 0x18, 0x10, 0xFF, 0x0F, 0xB5, 0x01, 0x10, 0xFF,
+	0xFF, 0x03, 0xA0, 0xFC, 0x01, 0x18, 0x95, 0x01, 0xFF, 0x01, 0x01, 0x18,
+	0x26, 0xFF, 0x01, 0x60, 0x18, 0x17, 0xFF, 0x07, 0x00, 0x18, 0x70, 0xFF,
+	0x1F, 0x41, 0x18, 0x06, 0x40, 0x00, 0x12, 0xE2, 0xFF, 0x03, 0x18, 0x7F,
+	0x80, 0xFC, 0x01, 0x80, 0x94, 0x01, 0x18, 0x70, 0xFF, 0xFF, 0x03, 0x80,
+	0xA0, 0x02, 0x28, 0x46, 0xA1, 0xA0, 0xBB, 0x87, 0x01, 0x20, 0x87, 0x80,
+	0xB8, 0x87, 0x01, 0x10, 0xFF, 0x01, 0x00, 0x18, 0xD3, 0x01, 0xFF, 0xFF,
+	0x03, 0x80, 0x08, 0x18, 0x27, 0x80, 0x20, 0x00, 0x18, 0xAA, 0x01, 0xFE,
+	0x3F, 0x00, 0x1A, 0x13, 0x20, 0x18, 0x47, 0x80, 0x02, 0x00, 0x18, 0x0A,
+	0xFF, 0x0F, 0x00, 0x18, 0x03, 0xFF, 0xFF, 0x03, 0x00, 0x10, 0xFF, 0x3F,
+	0x00, 0x18, 0x05, 0xFF, 0xFF, 0x03, 0x00, 0x10, 0xF8, 0xFF, 0x03, 0x00,
+	0x18, 0xB4, 0x02, 0x02, 0x00, 0x18, 0xC7, 0x02, 0x80, 0xE0, 0x02, 0x80,
+	0x80, 0x02, 0x18, 0xC5, 0xFF, 0x5B, 0x80, 0x80, 0x08, 0x00, 0x2C, 0x08,
+	0x00, 0x0A, 0xFF, 0xA0, 0x80, 0xFC, 0xFE, 0x0F, 0x00
+};
+
+/* psu_resetout_finish_data: 4 ops */
+const unsigned char psu_resetout_finish_data_table[] = {
+	0x2C, 0xAC, 0x00, 0x0C, 0xFD, 0x98, 0x80, 0xE1, 0xC0, 0x02, 0x20, 0x86,
+	0xA8, 0xA0, 0x70, 0x20, 0x93, 0x90, 0xA8, 0x32, 0x20, 0xA4, 0xAD, 0xF2,
+	0xFF, 0x03, 0x00
+};
+
+/* psu_resetout_init_data: 66 ops */
+const unsigned char psu_resetout_init_data_table[] = {
+	0x1C, 0x3C, 0x02, 0x5E, 0xFF, 0x80, 0x08, 0x00, 0x1A, 0xA2, 0xFE, 0x7D,
+	0x01, 0x18, 0x01, 0x01, 0x00, 0x18, 0x9F, 0xFE, 0x7D, 0xC0, 0x02, 0x00,
+	0x18, 0x05, 0x08, 0x00, 0x1E, 0x00, 0x01, 0x3D, 0xFD, 0x03, 0x18, 0xFF,
+	0xFF, 0x45, 0x82, 0x80, 0x34, 0x00, 0x18, 0x80, 0x81, 0x60, 0x02, 0x00,
+	0x18, 0x1C, 0x0F, 0x00, 0x1C, 0x00, 0xC2, 0x20, 0xFE, 0xFF, 0xFF, 0x08,
+	0xD7, 0xC8, 0x08, 0x18, 0x98, 0x04, 0x80, 0xFE, 0xFF, 0x01, 0x00, 0x1A,
+	0x89, 0x05, 0x80, 0x0C, 0x1A, 0x08, 0x80, 0x80, 0x01, 0x1C, 0x64, 0x00,
+	0x48, 0xFD, 0xFF, 0x07, 0x86, 0x04, 0x18, 0x23, 0xFF, 0xFF, 0x03, 0x00,
+	0x10, 0xFF, 0xFF, 0x03, 0x00, 0x10, 0xFF, 0xFF, 0x03, 0x00, 0x10, 0xFF,
+	0xFF, 0x03, 0x00, 0x12, 0xFF, 0xFF, 0x03, 0x10, 0xFF, 0xFF, 0x03, 0xFF,
+	0x01, 0x10, 0xFF, 0xFF, 0x03, 0x00, 0x12, 0xFF, 0xFF, 0x03, 0x10, 0xFF,
+	0xFF, 0x03, 0xF0, 0xFF, 0x03, 0x10, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0x03,
+	0x10, 0xFF, 0xFF, 0x03, 0xF1, 0xFF, 0x03, 0x10, 0xFF, 0xFF, 0x03, 0xF1,
+	0xFF, 0x03, 0x18, 0x12, 0xB8, 0x0E, 0x80, 0x02, 0x18, 0x2E, 0xF0, 0xFF,
+	0x03, 0x40, 0x18, 0x6E, 0xFF, 0x0F, 0xCD, 0x01, 0x10, 0xFF, 0x7F, 0xA4,
+	0x0C, 0x10, 0xFF, 0x0F, 0x18, 0x10, 0xFF, 0x0F, 0xB5, 0x01, 0x10, 0xFF,
+	0xFF, 0x03, 0xA0, 0xFC, 0x01, 0x18, 0x95, 0x01, 0xFF, 0x01, 0x01, 0x18,
+	0x26, 0xFF, 0x01, 0x60, 0x18, 0x17, 0xFF, 0x07, 0x00, 0x18, 0x70, 0xFF,
+	0x1F, 0x41, 0x18, 0x06, 0x40, 0x00, 0x12, 0xE2, 0xFF, 0x03, 0x18, 0x7F,
+	0x80, 0xFC, 0x01, 0x80, 0x94, 0x01, 0x18, 0x70, 0xFF, 0xFF, 0x03, 0x80,
+	0xA0, 0x02, 0x28, 0x46, 0xA1, 0xA0, 0xBB, 0x87, 0x01, 0x20, 0x87, 0x80,
+	0xB8, 0x87, 0x01, 0x10, 0xFF, 0x01, 0x00, 0x18, 0xD3, 0x01, 0xFF, 0xFF,
+	0x03, 0x80, 0x08, 0x18, 0x27, 0x80, 0x20, 0x00, 0x18, 0xAA, 0x01, 0xFE,
+	0x3F, 0x00, 0x1A, 0x13, 0x20, 0x18, 0x47, 0x80, 0x02, 0x00, 0x18, 0x0A,
+	0xFF, 0x0F, 0x00, 0x18, 0x03, 0xFF, 0xFF, 0x03, 0x00, 0x10, 0xFF, 0x3F,
+	0x00, 0x18, 0x05, 0xFF, 0xFF, 0x03, 0x00, 0x10, 0xF8, 0xFF, 0x03, 0x00,
+	0x18, 0xB4, 0x02, 0x02, 0x00, 0x18, 0xC7, 0x02, 0x80, 0xE0, 0x02, 0x80,
+	0x80, 0x02, 0x18, 0xC5, 0xFF, 0x5B, 0x80, 0x80, 0x08, 0x00, 0x2C, 0x08,
+	0x00, 0x0A, 0xFF, 0xA0, 0x80, 0xFC, 0xFE, 0x0F, 0x3C, 0xE4, 0x23, 0x40,
+	0xFD, 0x10, 0x38, 0x80, 0x40, 0x10, 0x38, 0x80, 0x40, 0x10, 0x38, 0x80,
+	0x40, 0x10, 0x28, 0x9B, 0xE3, 0x69, 0x98, 0x80, 0xE1, 0xC0, 0x02, 0x20,
+	0x86, 0xA8, 0xA0, 0x70, 0x20, 0x93, 0x90, 0xA8, 0x32, 0x20, 0xA4, 0xAD,
+	0xF2, 0xFF, 0x03, 0x00
+};
+
+/* psu_resetin_init_data: 6 ops */
+const unsigned char psu_resetin_init_data_table[] = {
+	0x1E, 0x3C, 0x02, 0x5E, 0xFF, 0xC0, 0x0A, 0x1A, 0x05, 0x08, 0x1E, 0x00,
+	0x01, 0x1A, 0xFD, 0x82, 0x80, 0x38, 0x18, 0x9C, 0x81, 0x60, 0x0F, 0x0A,
+	0x1A, 0x1B, 0x02, 0x1A, 0xFF, 0x80, 0x60, 0x80, 0x80, 0x04, 0x00
+};
+
+/* psu_ps_pl_isolation_removal_data: 3 ops */
+const unsigned char psu_ps_pl_isolation_removal_data_table[] = {
+	0x1A, 0xF3, 0xFE, 0x4F, 0x80, 0x80, 0x80, 0x04, 0x1A, 0x04, 0x80, 0x80,
+	0x80, 0x04, 0x48, 0x07, 0x80, 0x80, 0x80, 0x04, 0x00, 0x00
+};
+
+/* psu_afi_config: 3 ops */
+const unsigned char psu_afi_config_table[] = {
+	0x1C, 0x00, 0x01, 0x1A, 0xFD, 0x80, 0x3F, 0x00, 0x1C, 0x3C, 0x02, 0x5E,
+	0xFF, 0x80, 0x80, 0x20, 0x00, 0x1C, 0x00, 0x50, 0x61, 0xFD, 0x80, 0x1E,
+	0x80, 0x14, 0x00
+};
+
+/* psu_ps_pl_reset_config_data: 8 ops */
+const unsigned char psu_ps_pl_reset_config_data_table[] = {
+	0x1C, 0x2C, 0x00, 0x0A, 0xFF, 0x80, 0x80, 0xFC, 0xFF, 0x0F, 0x80, 0x80,
+	0x80, 0x80, 0x08, 0x28, 0x8C, 0x03, 0x80, 0x80, 0x80, 0x80, 0x08, 0x20,
+	0x80, 0x80, 0x80, 0x80, 0x08, 0x28, 0xF9, 0x02, 0x80, 0x80, 0x80, 0x80,
+	0x08, 0x50, 0x01, 0x24, 0x00, 0x50, 0x01, 0x24, 0x80, 0x80, 0x80, 0x80,
+	0x08, 0x00
+};
@@ -0,0 +1,48 @@
+/******************************************************************************
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file psu_init_table.h
+*
+* This file is automatically generated by tools/psu_table/psu_table_gen
+* from psu_init.c, see psu_table.h
+*
+*****************************************************************************/
+
+#ifndef PSU_INIT_TABLE_H
+#define PSU_INIT_TABLE_H
+
+#include "psu_table.h"
+
+extern const unsigned char psu_rpll_start_data_table[];
+extern const unsigned char psu_rpll_finish_data_table[];
+extern const unsigned char psu_iopll_start_data_table[];
+extern const unsigned char psu_iopll_finish_data_table[];
+extern const unsigned char psu_apll_start_data_table[];
+extern const unsigned char psu_apll_finish_data_table[];
+extern const unsigned char psu_dpll_start_data_table[];
+extern const unsigned char psu_dpll_finish_data_table[];
+extern const unsigned char psu_vpll_start_data_table[];
+extern const unsigned char psu_vpll_finish_data_table[];
+extern const unsigned char psu_pll_init_data_table[];
+extern const unsigned char psu_clock_init_data_table[];
+extern const unsigned char psu_ddr_init_data_table[];
+extern const unsigned char psu_ddr_qos_init_data_table[];
+extern const unsigned char psu_mio_init_data_table[];
+extern const unsigned char psu_peripherals_pre_init_data_table[];
+extern const unsigned char psu_peripherals_init_data_table[];
+extern const unsigned char psu_apply_master_tz_table[];
+extern const unsigned char psu_serdes_init_data_table[];
+extern const unsigned char psu_serdes_init_data_table1[];
+extern const unsigned char psu_resetout_start_data_table[];
+extern const unsigned char psu_resetout_finish_data_table[];
+extern const unsigned char psu_resetout_init_data_table[];
+extern const unsigned char psu_resetin_init_data_table[];
+extern const unsigned char psu_ps_pl_isolation_removal_data_table[];
+extern const unsigned char psu_afi_config_table[];
+extern const unsigned char psu_ps_pl_reset_config_data_table[];
+
+#endif /* PSU_INIT_TABLE_H */
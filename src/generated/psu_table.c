@@ -0,0 +1,121 @@
+/******************************************************************************
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file psu_table.c
+*
+* This file contains the interpreter of the psu_init register tables, see
+* psu_table.h for their encoding.
+*
+*****************************************************************************/
+
+#include <xil_io.h>
+#include <sleep.h>
+#include "psu_init.h"
+#include "psu_table.h"
+
+static u32 psu_table_number(const unsigned char **table)
+{
+	u32 val = 0U;
+	u32 shift = 0U;
+	unsigned char byte;
+
+	do {
+		byte = *(*table)++;
+		val |= (u32)(byte & 0x7FU) << shift;
+		shift += 7U;
+	} while ((byte & 0x80U) != 0U);
+
+	return val;
+}
+
+/**
+ * Runs a table, polls that time out do not stop it as they do not stop
+ * the generated functions
+ */
+unsigned long psu_table_run(const unsigned char *table)
+{
+	u32 addr = 0U;
+	u32 mask = 0U;
+	u32 value = 0U;
+	u32 count = 0U;
+	u32 skip = 0U;
+	u32 delta;
+	u32 regval;
+	unsigned char byte;
+	u32 op;
+
+	for (;;) {
+		byte = *table++;
+		op = PSU_TABLE_OP(byte);
+		if (op == PSU_TABLE_END)
+			break;
+
+		if (op != PSU_TABLE_DELAY) {
+			switch (PSU_TABLE_ADDR(byte)) {
+			case PSU_TABLE_ADDR_NEXT:
+				addr += 4U;
+				break;
+			case PSU_TABLE_ADDR_DELTA:
+				delta = psu_table_number(&table);
+				addr += (delta & 1U) ? ~(delta >> 1) * 4U :
+					(delta >> 1) * 4U;
+				break;
+			case PSU_TABLE_ADDR_ABS:
+				addr = (u32)table[0] | ((u32)table[1] << 8) |
+					((u32)table[2] << 16) |
+					((u32)table[3] << 24);
+				table += 4;
+				break;
+			default:
+				break;
+			}
+		}
+
+		if ((op != PSU_TABLE_WRITE) && (op != PSU_TABLE_DELAY))
+			mask = (byte & PSU_TABLE_MASK_ALL) ? 0xFFFFFFFFU :
+				psu_table_number(&table);
+		if ((op != PSU_TABLE_POLL) && (op != PSU_TABLE_DELAY))
+			value = (byte & PSU_TABLE_VALUE_MASK) ? mask :
+				psu_table_number(&table);
+		if ((op == PSU_TABLE_DELAY) || (op == PSU_TABLE_SKIP_UNLESS))
+			count = psu_table_number(&table);
+
+		if (skip != 0U) {
+			skip--;
+			continue;
+		}
+
+		switch (op) {
+		case PSU_TABLE_MASK_WRITE:
+			regval = Xil_In32(addr);
+			regval &= ~mask;
+			regval |= value & mask;
+			Xil_Out32(addr, regval);
+			break;
+		case PSU_TABLE_WRITE:
+			Xil_Out32(addr, value);
+			break;
+		case PSU_TABLE_POLL:
+			(void)psu_poll(addr, mask, 0U, 1);
+			break;
+		case PSU_TABLE_POLL_VALUE:
+			(void)psu_poll(addr, mask, value, 0);
+			break;
+		case PSU_TABLE_DELAY:
+			usleep(count);
+			break;
+		case PSU_TABLE_SKIP_UNLESS:
+			if ((Xil_In32(addr) & mask) != value)
+				skip = count;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 1;
+}
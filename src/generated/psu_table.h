@@ -0,0 +1,84 @@
+/******************************************************************************
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file psu_table.h
+*
+* This file contains the encoding of the psu_init register tables and the
+* prototype of their interpreter.
+*
+* tools/psu_table/psu_table_gen converts the psu_init functions made of
+* register writes, polls and delays into tables in psu_init_table.c, which
+* psu_table_run() executes instead of the straight-line code of
+* psu_init.c. Define PSU_INIT_TABLE_EXCLUDE to build the functions as they
+* were generated.
+*
+* A table is a sequence of ops, ended by PSU_TABLE_END. The op byte holds
+* the op in its high nibble, how its register address is encoded in bits
+* 3:2 and flags in bits 1:0. It is followed by the address, when it is not
+* implicit, then by the mask, the value and the count of the op, encoded as
+* unsigned LEB128 numbers (7 bits per byte, least significant first, bit 7
+* set on all bytes but the last).
+*
+* Addresses are relative to the address of the previous op, 0 at the start
+* of a table, so that a run of writes to a peripheral only costs its masks
+* and values:
+*  - NEXT: the next word
+*  - SAME: the same register
+*  - DELTA: a LEB128 word delta, zigzag encoded (0, -1, 1, -2, ...)
+*  - ABS: a 32-bit little endian address
+*
+*****************************************************************************/
+
+#ifndef PSU_TABLE_H
+#define PSU_TABLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef PSU_INIT_TABLE_EXCLUDE
+#define PSU_INIT_TABLE
+#endif
+
+/* Ops */
+#define PSU_TABLE_END			0x00U
+/* Read-modify-write of (address, mask, value), as PSU_Mask_Write() */
+#define PSU_TABLE_MASK_WRITE		0x1U
+/* Write of (address, value) */
+#define PSU_TABLE_WRITE			0x2U
+/* Poll until (address & mask) != 0 with psu_poll(), as mask_poll() */
+#define PSU_TABLE_POLL			0x3U
+/* Poll until (address & mask) == value, as mask_pollOnValue() */
+#define PSU_TABLE_POLL_VALUE		0x4U
+/* Delay of count us, without address */
+#define PSU_TABLE_DELAY			0x5U
+/* Skip the count next ops unless (address & mask) == value */
+#define PSU_TABLE_SKIP_UNLESS		0x6U
+
+/* Address encodings */
+#define PSU_TABLE_ADDR_NEXT		0x0U
+#define PSU_TABLE_ADDR_SAME		0x1U
+#define PSU_TABLE_ADDR_DELTA		0x2U
+#define PSU_TABLE_ADDR_ABS		0x3U
+
+/* Flags of the ops with a mask: the mask is 0xFFFFFFFF, the value is the
+ * mask, neither is then encoded */
+#define PSU_TABLE_MASK_ALL		0x1U
+#define PSU_TABLE_VALUE_MASK		0x2U
+
+#define PSU_TABLE_OP_BYTE(Op, Addr, Flags) \
+	(((Op) << 4) | ((Addr) << 2) | (Flags))
+#define PSU_TABLE_OP(Byte)		((Byte) >> 4)
+#define PSU_TABLE_ADDR(Byte)		(((Byte) >> 2) & 0x3U)
+
+unsigned long psu_table_run(const unsigned char *table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PSU_TABLE_H */
@@ -14,6 +14,6 @@ void outbyte(char c);
 }
 #endif
 
-void outbyte(char c) {
+__attribute__((weak)) void outbyte(char c) {
 	 XUartPs_SendByte(STDOUT_BASEADDRESS, c);
 }
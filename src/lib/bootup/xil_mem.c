@@ -8,8 +8,18 @@
 /**
 * @file xil_mem.c
 *
-* This file contains xil mem copy function to use in case of word aligned
-* data copies.
+* This file contains the xil memory copy, move, set and compare functions.
+*
+* The bulk of every function works on 16 byte blocks, held in NEON registers
+* on AArch64 and in a pair of 64 bit registers elsewhere, four blocks per
+* loop iteration so the compiler emits LDP/STP of Q registers.
+*
+* The FSBL runs with the MMU off, where every data access is a Device
+* access and an unaligned one takes an alignment fault. All the accesses
+* are therefore aligned to their size: the buffers are walked byte by byte
+* up to their alignment, then in blocks when they are aligned alike modulo
+* 16, in 8 or 4 byte words when only that much is common to them, and the
+* tail is handled in words and bytes.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -22,6 +32,9 @@
 * 			  violations.
 * 7.7	sk	 01/10/22 Include xil_mem.h header file to fix Xil_MemCpy
 * 			  prototype misra_c_2012_rule_8_4 violation.
+* 8.0   dd       10/16/26 Xil_MemCpy copies 16 byte blocks, added Xil_MemMove,
+* 			  Xil_MemSet, Xil_MemCompare and Xil_MemCmp_CT
+*       dd       10/16/26 Only aligned accesses, the MMU is off
 *
 * </pre>
 *
@@ -31,8 +44,158 @@
 
 #include "xil_types.h"
 #include "xil_mem.h"
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+/************************** Constant Definitions ****************************/
+
+#define XIL_MEM_BLOCK		16U
+#define XIL_MEM_BLOCK_MASK	(XIL_MEM_BLOCK - 1U)
+#define XIL_MEM_LOOP		(4U * XIL_MEM_BLOCK)
+
+/**************************** Type Definitions ******************************/
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+typedef uint8x16_t Xil_MemBlock;
+#else
+typedef struct {
+	u64 Lo;
+	u64 Hi;
+} Xil_MemBlock;
+#endif
 
 /***************** Inline Functions Definitions ********************/
+
+static inline u64 Xil_MemLoad64(const u8 *Src)
+{
+	u64 Val;
+
+	__builtin_memcpy(&Val, Src, sizeof(Val));
+	return Val;
+}
+
+static inline void Xil_MemStore64(u8 *Dst, u64 Val)
+{
+	__builtin_memcpy(Dst, &Val, sizeof(Val));
+}
+
+static inline u32 Xil_MemLoad32(const u8 *Src)
+{
+	u32 Val;
+
+	__builtin_memcpy(&Val, Src, sizeof(Val));
+	return Val;
+}
+
+static inline void Xil_MemStore32(u8 *Dst, u32 Val)
+{
+	__builtin_memcpy(Dst, &Val, sizeof(Val));
+}
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+static inline Xil_MemBlock Xil_MemLoad(const u8 *Src)
+{
+	return vld1q_u8(Src);
+}
+
+static inline void Xil_MemStore(u8 *Dst, Xil_MemBlock Val)
+{
+	vst1q_u8(Dst, Val);
+}
+
+static inline Xil_MemBlock Xil_MemDup(u8 Val)
+{
+	return vdupq_n_u8(Val);
+}
+
+static inline Xil_MemBlock Xil_MemXor(Xil_MemBlock A, Xil_MemBlock B)
+{
+	return veorq_u8(A, B);
+}
+
+static inline Xil_MemBlock Xil_MemOr(Xil_MemBlock A, Xil_MemBlock B)
+{
+	return vorrq_u8(A, B);
+}
+
+/* Non zero if any byte of the block is non zero */
+static inline u32 Xil_MemAny(Xil_MemBlock Val)
+{
+	return (u32)vmaxvq_u8(Val);
+}
+#else
+static inline Xil_MemBlock Xil_MemLoad(const u8 *Src)
+{
+	Xil_MemBlock Val;
+
+	Val.Lo = Xil_MemLoad64(Src);
+	Val.Hi = Xil_MemLoad64(&Src[8U]);
+	return Val;
+}
+
+static inline void Xil_MemStore(u8 *Dst, Xil_MemBlock Val)
+{
+	Xil_MemStore64(Dst, Val.Lo);
+	Xil_MemStore64(&Dst[8U], Val.Hi);
+}
+
+static inline Xil_MemBlock Xil_MemDup(u8 Val)
+{
+	Xil_MemBlock Block;
+
+	Block.Lo = (u64)Val * 0x0101010101010101U;
+	Block.Hi = Block.Lo;
+	return Block;
+}
+
+static inline Xil_MemBlock Xil_MemXor(Xil_MemBlock A, Xil_MemBlock B)
+{
+	A.Lo ^= B.Lo;
+	A.Hi ^= B.Hi;
+	return A;
+}
+
+static inline Xil_MemBlock Xil_MemOr(Xil_MemBlock A, Xil_MemBlock B)
+{
+	A.Lo |= B.Lo;
+	A.Hi |= B.Hi;
+	return A;
+}
+
+/* Non zero if any byte of the block is non zero */
+static inline u32 Xil_MemAny(Xil_MemBlock Val)
+{
+	u64 Any = Val.Lo | Val.Hi;
+
+	return (u32)(Any | (Any >> 32U));
+}
+#endif
+
+/*****************************************************************************/
+/**
+* @brief       Returns the widest access, up to a block, at which both
+*              addresses are aligned once one of them is.
+*
+*****************************************************************************/
+static inline u32 Xil_MemWidth(const void *a, const void *b)
+{
+	const UINTPTR Mis = (UINTPTR)a ^ (UINTPTR)b;
+	u32 Width;
+
+	if ((Mis & XIL_MEM_BLOCK_MASK) == 0U) {
+		Width = XIL_MEM_BLOCK;
+	} else if ((Mis & 7U) == 0U) {
+		Width = 8U;
+	} else if ((Mis & 3U) == 0U) {
+		Width = 4U;
+	} else {
+		Width = 1U;
+	}
+
+	return Width;
+}
+
 /*****************************************************************************/
 /**
 * @brief       This  function copies memory from once location to other.
@@ -43,28 +206,367 @@
 *
 * @param       cnt: 32 bit length of bytes to be copied
 *
+* @note        The buffers must not overlap, use Xil_MemMove otherwise.
+*              The copy runs forward, so a destination below the source
+*              is also correct.
+*
 *****************************************************************************/
 void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 {
-	char *d = (char*)(void *)dst;
-	const char *s = src;
+	u8 *d = (u8 *)dst;
+	const u8 *s = (const u8 *)src;
+	const u32 Width = Xil_MemWidth(d, s);
 
-	while (cnt >= sizeof (s32)) {
-		*(s32*)d = *(s32*)s;
-		d += sizeof (s32);
-		s += sizeof (s32);
-		cnt -= sizeof (s32);
+	/* Bytes up to the alignment of the destination, and of the source */
+	while ((cnt != 0U) && (((UINTPTR)d & (Width - 1U)) != 0U)) {
+		*d = *s;
+		d++;
+		s++;
+		cnt--;
 	}
-	while (cnt >= sizeof (u16)) {
-		*(u16*)d = *(u16*)s;
-		d += sizeof (u16);
-		s += sizeof (u16);
-		cnt -= sizeof (u16);
+
+	if (Width == XIL_MEM_BLOCK) {
+		while (cnt >= XIL_MEM_LOOP) {
+			Xil_MemBlock B0 = Xil_MemLoad(s);
+			Xil_MemBlock B1 = Xil_MemLoad(&s[16U]);
+			Xil_MemBlock B2 = Xil_MemLoad(&s[32U]);
+			Xil_MemBlock B3 = Xil_MemLoad(&s[48U]);
+
+			Xil_MemStore(d, B0);
+			Xil_MemStore(&d[16U], B1);
+			Xil_MemStore(&d[32U], B2);
+			Xil_MemStore(&d[48U], B3);
+			d += XIL_MEM_LOOP;
+			s += XIL_MEM_LOOP;
+			cnt -= XIL_MEM_LOOP;
+		}
+
+		while (cnt >= XIL_MEM_BLOCK) {
+			Xil_MemStore(d, Xil_MemLoad(s));
+			d += XIL_MEM_BLOCK;
+			s += XIL_MEM_BLOCK;
+			cnt -= XIL_MEM_BLOCK;
+		}
 	}
-	while ((cnt) > 0U){
+
+	if (Width >= 8U) {
+		while (cnt >= 8U) {
+			Xil_MemStore64(d, Xil_MemLoad64(s));
+			d += 8U;
+			s += 8U;
+			cnt -= 8U;
+		}
+	}
+
+	if (Width >= 4U) {
+		while (cnt >= 4U) {
+			Xil_MemStore32(d, Xil_MemLoad32(s));
+			d += 4U;
+			s += 4U;
+			cnt -= 4U;
+		}
+	}
+
+	while (cnt != 0U) {
 		*d = *s;
-		d += 1U;
-		s += 1U;
-		cnt -= 1U;
+		d++;
+		s++;
+		cnt--;
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       Copies memory backward, from the end of the buffers, for a
+*              destination which starts inside the source.
+*
+*****************************************************************************/
+static void Xil_MemCpyBackward(u8 *d, const u8 *s, u32 cnt)
+{
+	const u32 Width = Xil_MemWidth(d, s);
+
+	while ((cnt != 0U) && (((UINTPTR)&d[cnt] & (Width - 1U)) != 0U)) {
+		cnt--;
+		d[cnt] = s[cnt];
+	}
+
+	if (Width == XIL_MEM_BLOCK) {
+		while (cnt >= XIL_MEM_LOOP) {
+			Xil_MemBlock B0;
+			Xil_MemBlock B1;
+			Xil_MemBlock B2;
+			Xil_MemBlock B3;
+
+			cnt -= XIL_MEM_LOOP;
+			B3 = Xil_MemLoad(&s[cnt + 48U]);
+			B2 = Xil_MemLoad(&s[cnt + 32U]);
+			B1 = Xil_MemLoad(&s[cnt + 16U]);
+			B0 = Xil_MemLoad(&s[cnt]);
+			Xil_MemStore(&d[cnt + 48U], B3);
+			Xil_MemStore(&d[cnt + 32U], B2);
+			Xil_MemStore(&d[cnt + 16U], B1);
+			Xil_MemStore(&d[cnt], B0);
+		}
+
+		while (cnt >= XIL_MEM_BLOCK) {
+			cnt -= XIL_MEM_BLOCK;
+			Xil_MemStore(&d[cnt], Xil_MemLoad(&s[cnt]));
+		}
+	}
+
+	if (Width >= 8U) {
+		while (cnt >= 8U) {
+			cnt -= 8U;
+			Xil_MemStore64(&d[cnt], Xil_MemLoad64(&s[cnt]));
+		}
+	}
+
+	if (Width >= 4U) {
+		while (cnt >= 4U) {
+			cnt -= 4U;
+			Xil_MemStore32(&d[cnt], Xil_MemLoad32(&s[cnt]));
+		}
+	}
+
+	while (cnt != 0U) {
+		cnt--;
+		d[cnt] = s[cnt];
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function copies memory from one location to another
+*              location which may overlap with it.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       src: pointer pointing to source memory
+*
+* @param       cnt: 32 bit length of bytes to be copied
+*
+*****************************************************************************/
+void Xil_MemMove(void* dst, const void* src, u32 cnt)
+{
+	if (((UINTPTR)dst - (UINTPTR)src) >= (UINTPTR)cnt) {
+		/*
+		 * The destination does not start inside the source, copying
+		 * forward never overwrites unread source bytes
+		 */
+		Xil_MemCpy(dst, src, cnt);
+	} else {
+		Xil_MemCpyBackward((u8 *)dst, (const u8 *)src, cnt);
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function fills memory with a byte value.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       val: value written to every byte
+*
+* @param       cnt: 32 bit length of bytes to be written
+*
+*****************************************************************************/
+void Xil_MemSet(void* dst, u8 val, u32 cnt)
+{
+	u8 *d = (u8 *)dst;
+	const Xil_MemBlock Fill = Xil_MemDup(val);
+	const u64 Fill64 = (u64)val * 0x0101010101010101U;
+
+	while ((cnt != 0U) && (((UINTPTR)d & XIL_MEM_BLOCK_MASK) != 0U)) {
+		*d = val;
+		d++;
+		cnt--;
+	}
+
+	while (cnt >= XIL_MEM_LOOP) {
+		Xil_MemStore(d, Fill);
+		Xil_MemStore(&d[16U], Fill);
+		Xil_MemStore(&d[32U], Fill);
+		Xil_MemStore(&d[48U], Fill);
+		d += XIL_MEM_LOOP;
+		cnt -= XIL_MEM_LOOP;
+	}
+
+	while (cnt >= XIL_MEM_BLOCK) {
+		Xil_MemStore(d, Fill);
+		d += XIL_MEM_BLOCK;
+		cnt -= XIL_MEM_BLOCK;
+	}
+
+	if (cnt >= 8U) {
+		Xil_MemStore64(d, Fill64);
+		d += 8U;
+		cnt -= 8U;
+	}
+
+	if (cnt >= 4U) {
+		Xil_MemStore32(d, (u32)Fill64);
+		d += 4U;
+		cnt -= 4U;
+	}
+
+	while (cnt != 0U) {
+		*d = val;
+		d++;
+		cnt--;
 	}
 }
+
+/*****************************************************************************/
+/**
+* @brief       This function compares two memory regions like memcmp.
+*
+* @param       src1: pointer pointing to first memory region
+*
+* @param       src2: pointer pointing to second memory region
+*
+* @param       cnt: 32 bit length of bytes to be compared
+*
+* @return      0 if the regions are equal, otherwise the difference of the
+*              first non matching bytes of src1 and src2
+*
+*****************************************************************************/
+s32 Xil_MemCompare(const void* src1, const void* src2, u32 cnt)
+{
+	const u8 *s1 = (const u8 *)src1;
+	const u8 *s2 = (const u8 *)src2;
+	const u32 Width = Xil_MemWidth(s1, s2);
+
+	while ((cnt != 0U) && (((UINTPTR)s1 & (Width - 1U)) != 0U)) {
+		if (*s1 != *s2) {
+			return (s32)*s1 - (s32)*s2;
+		}
+		s1++;
+		s2++;
+		cnt--;
+	}
+
+	/* The wide loops stop at a difference, found by the byte loop */
+	if (Width == XIL_MEM_BLOCK) {
+		while ((cnt >= XIL_MEM_BLOCK) &&
+		       (Xil_MemAny(Xil_MemXor(Xil_MemLoad(s1),
+					      Xil_MemLoad(s2))) == 0U)) {
+			s1 += XIL_MEM_BLOCK;
+			s2 += XIL_MEM_BLOCK;
+			cnt -= XIL_MEM_BLOCK;
+		}
+	}
+
+	if (Width >= 8U) {
+		while ((cnt >= 8U) &&
+		       (Xil_MemLoad64(s1) == Xil_MemLoad64(s2))) {
+			s1 += 8U;
+			s2 += 8U;
+			cnt -= 8U;
+		}
+	}
+
+	if (Width >= 4U) {
+		while ((cnt >= 4U) &&
+		       (Xil_MemLoad32(s1) == Xil_MemLoad32(s2))) {
+			s1 += 4U;
+			s2 += 4U;
+			cnt -= 4U;
+		}
+	}
+
+	while (cnt != 0U) {
+		if (*s1 != *s2) {
+			return (s32)*s1 - (s32)*s2;
+		}
+		s1++;
+		s2++;
+		cnt--;
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function compares two memory regions in constant time.
+*              The time only depends on the length and the alignment of
+*              the regions, not on the contents.
+*
+* @param       src1: pointer pointing to first memory region
+*
+* @param       src2: pointer pointing to second memory region
+*
+* @param       cnt: 32 bit length of bytes to be compared
+*
+* @return      0 if the regions are equal, non zero otherwise
+*
+*****************************************************************************/
+u32 Xil_MemCmp_CT(const void* src1, const void* src2, u32 cnt)
+{
+	const u8 *s1 = (const u8 *)src1;
+	const u8 *s2 = (const u8 *)src2;
+	const u32 Width = Xil_MemWidth(s1, s2);
+	Xil_MemBlock Diff = Xil_MemDup(0U);
+	u64 DiffWord = 0U;
+
+	while ((cnt != 0U) && (((UINTPTR)s1 & (Width - 1U)) != 0U)) {
+		DiffWord |= (u64)(*s1 ^ *s2);
+		s1++;
+		s2++;
+		cnt--;
+	}
+
+	if (Width == XIL_MEM_BLOCK) {
+		while (cnt >= XIL_MEM_LOOP) {
+			Diff = Xil_MemOr(Diff, Xil_MemXor(Xil_MemLoad(s1),
+							  Xil_MemLoad(s2)));
+			Diff = Xil_MemOr(Diff,
+					 Xil_MemXor(Xil_MemLoad(&s1[16U]),
+						    Xil_MemLoad(&s2[16U])));
+			Diff = Xil_MemOr(Diff,
+					 Xil_MemXor(Xil_MemLoad(&s1[32U]),
+						    Xil_MemLoad(&s2[32U])));
+			Diff = Xil_MemOr(Diff,
+					 Xil_MemXor(Xil_MemLoad(&s1[48U]),
+						    Xil_MemLoad(&s2[48U])));
+			s1 += XIL_MEM_LOOP;
+			s2 += XIL_MEM_LOOP;
+			cnt -= XIL_MEM_LOOP;
+		}
+
+		while (cnt >= XIL_MEM_BLOCK) {
+			Diff = Xil_MemOr(Diff, Xil_MemXor(Xil_MemLoad(s1),
+							  Xil_MemLoad(s2)));
+			s1 += XIL_MEM_BLOCK;
+			s2 += XIL_MEM_BLOCK;
+			cnt -= XIL_MEM_BLOCK;
+		}
+	}
+
+	if (Width >= 8U) {
+		while (cnt >= 8U) {
+			DiffWord |= Xil_MemLoad64(s1) ^ Xil_MemLoad64(s2);
+			s1 += 8U;
+			s2 += 8U;
+			cnt -= 8U;
+		}
+	}
+
+	if (Width >= 4U) {
+		while (cnt >= 4U) {
+			DiffWord |= (u64)(Xil_MemLoad32(s1) ^ Xil_MemLoad32(s2));
+			s1 += 4U;
+			s2 += 4U;
+			cnt -= 4U;
+		}
+	}
+
+	while (cnt != 0U) {
+		DiffWord |= (u64)(*s1 ^ *s2);
+		s1++;
+		s2++;
+		cnt--;
+	}
+
+	return Xil_MemAny(Diff) | (u32)DiffWord | (u32)(DiffWord >> 32U);
+}
@@ -79,6 +79,10 @@
 *       adk	 07/15/22 Updated the Xil_WaitForEventSet() API to
 *			  support variable number of events.
 *	ssc	 08/25/22 Added Xil_SecureRMW32 API
+* 9.0   dd       10/16/26 Memory copy, set and compare functions use the
+*                         xil_mem block functions
+*       dd       10/16/26 Xil_SMemCmp_CT updates its redundant data with
+*                         every word again
 *
 * </pre>
 *
@@ -86,6 +90,7 @@
 
 /****************************** Include Files *********************************/
 #include "xil_util.h"
+#include "xil_mem.h"
 #include "sleep.h"
 
 /************************** Constant Definitions ****************************/
@@ -730,21 +735,11 @@ int Xil_SecureMemCpy(void * DestPtr, u32 DestPtrLen, const void * SrcPtr, u32 Le
 	}
 
 	if (Len > DestPtrLen) {
-		while (DestPtrLen != 0U) {
-			*Dest = 0U;
-			Dest++;
-			DestPtrLen--;
-		}
+		Xil_MemSet(Dest, 0U, DestPtrLen);
 		goto END;
 	}
 
-	/* Loop and copy.  */
-	while (Len != 0U) {
-		*Dest = *Src;
-		Dest++;
-		Src++;
-		Len--;
-	}
+	Xil_MemCpy(Dest, Src, Len);
 	Status = XST_SUCCESS;
 
 END:
@@ -770,30 +765,19 @@ int Xil_MemCmp(const void * Buf1Ptr, const void * Buf2Ptr, u32 Len)
 	volatile int RetVal = 1;
 	const u8 *Buf1 = Buf1Ptr;
 	const u8 *Buf2 = Buf2Ptr;
-	u32 Size = Len;
+	s32 Diff;
 
 	/* Assert validates the input arguments */
 	if ((Buf1 == NULL) || (Buf2 == NULL) || (Len == 0x0U)) {
 		goto END;
 	}
 
-	/* Loop and compare */
-	while (Size != 0U) {
-		if (*Buf1 > *Buf2) {
-			RetVal = 1;
-			goto END;
-		} else if (*Buf1 < *Buf2) {
-			RetVal = -1;
-			goto END;
-		} else {
-			Buf1++;
-			Buf2++;
-			Size--;
-		}
-	}
-
-	/* Make sure size is zero to know the whole of data is compared */
-	if (Size == 0U) {
+	Diff = Xil_MemCompare(Buf1, Buf2, Len);
+	if (Diff > 0) {
+		RetVal = 1;
+	} else if (Diff < 0) {
+		RetVal = -1;
+	} else {
 		RetVal = 0;
 	}
 
@@ -818,7 +802,7 @@ int Xil_SecureZeroize(u8 *DataPtr, const u32 Length)
 	int Status = XST_FAILURE;
 
 	/* Clear the data */
-	(void)memset(DataPtr, 0, Length);
+	Xil_MemSet(DataPtr, 0U, Length);
 
 	/* Read it back to verify */
 	 for (Index = 0U; Index < Length; Index++) {
@@ -865,7 +849,7 @@ int Xil_SMemCmp(const void *Src1, const u32 Src1Size,
 		Status =  XST_INVALID_PARAM;
 	}
 	else {
-		Status = memcmp (Src1, Src2, CmpLen);
+		Status = Xil_MemCompare(Src1, Src2, CmpLen);
 		if (Status != 0) {
 			Status = XST_FAILURE;
 		}
@@ -906,7 +890,6 @@ int Xil_SMemCmp_CT(const void *Src1, const u32 Src1Size,
 	const u8 *Src_1 = (const u8 *)Src1;
 	const u8 *Src_2 = (const u8 *)Src2;
 
-
 	if ((Src1 == NULL) || (Src2 == NULL)) {
 		Status =  XST_INVALID_PARAM;
 	}
@@ -914,12 +897,20 @@ int Xil_SMemCmp_CT(const void *Src1, const u32 Src1Size,
 		Status =  XST_INVALID_PARAM;
 	}
 	else {
-		while (Cnt >= sizeof(u32)) {
-			Data |= (*(const u32 *)Src_1 ^ *(const u32 *)Src_2);
-			DataRedundant &= ~Data;
-			Src_1 += sizeof(u32);
-			Src_2 += sizeof(u32);
-			Cnt -= sizeof(u32);
+		/*
+		 * The redundant data is updated with every word, words are
+		 * only read when both regions are word aligned
+		 */
+		if ((((UINTPTR)Src_1 | (UINTPTR)Src_2) &
+		     (sizeof(u32) - 1U)) == 0U) {
+			while (Cnt >= sizeof(u32)) {
+				Data |= (*(const u32 *)Src_1 ^
+					 *(const u32 *)Src_2);
+				DataRedundant &= ~Data;
+				Src_1 += sizeof(u32);
+				Src_2 += sizeof(u32);
+				Cnt -= sizeof(u32);
+			}
 		}
 
 		while (Cnt > 0U) {
@@ -979,7 +970,7 @@ int Xil_SMemCpy(void *Dest, const u32 DestSize,
 		Status =  XST_INVALID_PARAM;
 	}
 	else {
-		(void)memcpy(DestTemp, SrcTemp, CopyLen);
+		Xil_MemCpy(DestTemp, SrcTemp, CopyLen);
 		Status = XST_SUCCESS;
 	}
 
@@ -1012,7 +1003,7 @@ int Xil_SMemSet(void *Dest, const u32 DestSize,
 		Status =  XST_INVALID_PARAM;
 	}
 	else {
-		(void)memset(Dest, (s32)Data, Len);
+		Xil_MemSet(Dest, Data, Len);
 		Status = XST_SUCCESS;
 	}
 
@@ -1225,7 +1216,6 @@ int Xil_SMemMove(void *Dest, const u32 DestSize,
 	const void *Src, const u32 SrcSize, const u32 CopyLen)
 {
 	volatile int Status = XST_FAILURE;
-	const void *Output = NULL;
 
 	if ((Dest == NULL) || (Src == NULL)) {
 		Status =  XST_INVALID_PARAM;
@@ -1234,10 +1224,8 @@ int Xil_SMemMove(void *Dest, const u32 DestSize,
 		Status =  XST_INVALID_PARAM;
 	}
 	else {
-		Output = memmove(Dest, Src, CopyLen);
-		if (Output != NULL) {
-			Status = XST_SUCCESS;
-		}
+		Xil_MemMove(Dest, Src, CopyLen);
+		Status = XST_SUCCESS;
 	}
 
 	return Status;
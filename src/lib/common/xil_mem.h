@@ -22,6 +22,8 @@
 * ----- -------- -------- -----------------------------------------------
 * 6.1   nsk      11/07/16 First release.
 * 7.0   mus      01/07/19 Add cpp extern macro
+* 8.0   dd       10/16/26 Added Xil_MemMove, Xil_MemSet, Xil_MemCompare and
+*                         Xil_MemCmp_CT
 *
 * </pre>
 *
@@ -36,6 +38,10 @@ extern "C" {
 /************************** Function Prototypes *****************************/
 
 void Xil_MemCpy(void* dst, const void* src, u32 cnt);
+void Xil_MemMove(void* dst, const void* src, u32 cnt);
+void Xil_MemSet(void* dst, u8 val, u32 cnt);
+s32 Xil_MemCompare(const void* src1, const void* src2, u32 cnt);
+u32 Xil_MemCmp_CT(const void* src1, const void* src2, u32 cnt);
 
 #ifdef __cplusplus
 }
@@ -44,4 +50,4 @@ void Xil_MemCpy(void* dst, const void* src, u32 cnt);
 #endif /* XIL_MEM_H */
 /**
 * @} End of "addtogroup common_mem_operation_api".
-*/
\ No newline at end of file
+*/
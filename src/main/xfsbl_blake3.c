@@ -0,0 +1,484 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_blake3.c
+ *
+ * This is the file which contains the BLAKE3 hash of the FSBL.
+ *
+ * Full chunks are hashed four at a time, one chunk per lane of a vector of
+ * four words. The vectors are GCC vector types, which the A53 computes with
+ * NEON and other hosts with their own vector unit, so the file also builds
+ * for the host tools. The chaining values of a subtree are merged on a
+ * stack as soon as two subtrees of the same size are complete, which gives
+ * the left balanced tree of BLAKE3 for any length.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xfsbl_blake3.h"
+
+#include "xfsbl_error.h"
+
+/************************** Constant Definitions *****************************/
+#define XFSBL_BLAKE3_BLOCK_LEN (64U)
+#define XFSBL_BLAKE3_ROUNDS (7U)
+#define XFSBL_BLAKE3_CV_WORDS (8U)
+#define XFSBL_BLAKE3_BLOCK_WORDS (16U)
+
+/* Domain flags of a compression */
+#define XFSBL_BLAKE3_CHUNK_START (1U)
+#define XFSBL_BLAKE3_CHUNK_END (2U)
+#define XFSBL_BLAKE3_PARENT (4U)
+#define XFSBL_BLAKE3_ROOT (8U)
+
+/* Chunks hashed together by the vector compression */
+#define XFSBL_BLAKE3_WAYS (4U)
+
+/* Chaining values pending on the stack, a segment has at most 2^21 chunks */
+#define XFSBL_BLAKE3_MAX_DEPTH (24U)
+
+/**************************** Type Definitions *******************************/
+typedef u32 XFsbl_Blake3Vec __attribute__((vector_size(16)));
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define XFSBL_BLAKE3_SPLAT(Word) \
+  ((XFsbl_Blake3Vec){(Word), (Word), (Word), (Word)})
+
+/* Works on u32 and on XFsbl_Blake3Vec */
+#define XFSBL_ROR32(Word, Count) \
+  (((Word) >> (Count)) | ((Word) << (32U - (Count))))
+
+#define XFSBL_BLAKE3_G(V, A, B, C, D, X, Y)  \
+  do {                                       \
+    V[A] = V[A] + V[B] + (X);                \
+    V[D] = XFSBL_ROR32(V[D] ^ V[A], 16U);    \
+    V[C] = V[C] + V[D];                      \
+    V[B] = XFSBL_ROR32(V[B] ^ V[C], 12U);    \
+    V[A] = V[A] + V[B] + (Y);                \
+    V[D] = XFSBL_ROR32(V[D] ^ V[A], 8U);     \
+    V[C] = V[C] + V[D];                      \
+    V[B] = XFSBL_ROR32(V[B] ^ V[C], 7U);     \
+  } while (0)
+
+/* The columns, then the diagonals, with the message words of the round */
+#define XFSBL_BLAKE3_ROUND(V, M, S)                       \
+  do {                                                    \
+    XFSBL_BLAKE3_G(V, 0, 4, 8, 12, M[S[0]], M[S[1]]);     \
+    XFSBL_BLAKE3_G(V, 1, 5, 9, 13, M[S[2]], M[S[3]]);     \
+    XFSBL_BLAKE3_G(V, 2, 6, 10, 14, M[S[4]], M[S[5]]);    \
+    XFSBL_BLAKE3_G(V, 3, 7, 11, 15, M[S[6]], M[S[7]]);    \
+    XFSBL_BLAKE3_G(V, 0, 5, 10, 15, M[S[8]], M[S[9]]);    \
+    XFSBL_BLAKE3_G(V, 1, 6, 11, 12, M[S[10]], M[S[11]]);  \
+    XFSBL_BLAKE3_G(V, 2, 7, 8, 13, M[S[12]], M[S[13]]);   \
+    XFSBL_BLAKE3_G(V, 3, 4, 9, 14, M[S[14]], M[S[15]]);   \
+  } while (0)
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+static const u32 XFsbl_Blake3Iv[XFSBL_BLAKE3_CV_WORDS] = {
+    0x6A09E667U, 0xBB67AE85U, 0x3C6EF372U, 0xA54FF53AU,
+    0x510E527FU, 0x9B05688CU, 0x1F83D9ABU, 0x5BE0CD19U};
+
+/* Message word order of every round, the permutation applied repeatedly */
+static const u8 XFsbl_Blake3Schedule[XFSBL_BLAKE3_ROUNDS]
+                                    [XFSBL_BLAKE3_BLOCK_WORDS] = {
+    {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U, 11U, 12U, 13U, 14U, 15U},
+    {2U, 6U, 3U, 10U, 7U, 0U, 4U, 13U, 1U, 11U, 12U, 5U, 9U, 14U, 15U, 8U},
+    {3U, 4U, 10U, 12U, 13U, 2U, 7U, 14U, 6U, 5U, 9U, 0U, 11U, 15U, 8U, 1U},
+    {10U, 7U, 12U, 9U, 14U, 3U, 13U, 15U, 4U, 0U, 11U, 2U, 5U, 8U, 1U, 6U},
+    {12U, 13U, 9U, 11U, 15U, 10U, 14U, 8U, 7U, 2U, 5U, 3U, 0U, 1U, 6U, 4U},
+    {9U, 14U, 11U, 5U, 8U, 12U, 15U, 1U, 13U, 3U, 0U, 10U, 2U, 6U, 4U, 7U},
+    {11U, 15U, 5U, 0U, 1U, 9U, 8U, 6U, 14U, 10U, 2U, 12U, 3U, 4U, 7U, 13U}};
+
+static inline u32 XFsbl_Blake3Load32(const u8* Data) {
+  return (u32)Data[0] | ((u32)Data[1] << 8U) | ((u32)Data[2] << 16U) |
+         ((u32)Data[3] << 24U);
+}
+
+static void XFsbl_Blake3StoreCv(const u32* Cv, u8* Bytes) {
+  for (u32 Index = 0U; Index < XFSBL_BLAKE3_CV_WORDS; Index++) {
+    Bytes[(4U * Index)] = (u8)Cv[Index];
+    Bytes[(4U * Index) + 1U] = (u8)(Cv[Index] >> 8U);
+    Bytes[(4U * Index) + 2U] = (u8)(Cv[Index] >> 16U);
+    Bytes[(4U * Index) + 3U] = (u8)(Cv[Index] >> 24U);
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function compresses one block into a chaining value
+ *
+ * @param	Cv is the chaining value, updated in place
+ * @param	M is the block as 16 little endian words
+ * @param	Counter is the chunk counter, 0 for parents
+ * @param	BlockLen is the number of bytes in the block
+ * @param	Flags are the domain flags
+ *
+ *****************************************************************************/
+static void XFsbl_Blake3Compress(u32* Cv, const u32* M, u64 Counter,
+                                 u32 BlockLen, u32 Flags) {
+  u32 V[16] = {Cv[0],
+               Cv[1],
+               Cv[2],
+               Cv[3],
+               Cv[4],
+               Cv[5],
+               Cv[6],
+               Cv[7],
+               XFsbl_Blake3Iv[0],
+               XFsbl_Blake3Iv[1],
+               XFsbl_Blake3Iv[2],
+               XFsbl_Blake3Iv[3],
+               (u32)Counter,
+               (u32)(Counter >> 32U),
+               BlockLen,
+               Flags};
+
+  for (u32 Round = 0U; Round < XFSBL_BLAKE3_ROUNDS; Round++) {
+    XFSBL_BLAKE3_ROUND(V, M, XFsbl_Blake3Schedule[Round]);
+  }
+
+  for (u32 Index = 0U; Index < XFSBL_BLAKE3_CV_WORDS; Index++) {
+    Cv[Index] = V[Index] ^ V[Index + 8U];
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function hashes one chunk, full or not
+ *
+ * @param	Data is the chunk
+ * @param	Length is the chunk length, at most XFSBL_BLAKE3_CHUNK_LEN
+ * @param	Counter is the index of the chunk in the input
+ * @param	Flags are the flags of the last block, XFSBL_BLAKE3_ROOT for
+ * 		an input of a single chunk
+ * @param	Cv is filled with the chaining value of the chunk
+ *
+ *****************************************************************************/
+static void XFsbl_Blake3Chunk(const u8* Data, u32 Length, u64 Counter,
+                              u32 Flags, u32* Cv) {
+  u32 M[XFSBL_BLAKE3_BLOCK_WORDS];
+  u32 BlockFlags = XFSBL_BLAKE3_CHUNK_START;
+
+  for (u32 Index = 0U; Index < XFSBL_BLAKE3_CV_WORDS; Index++) {
+    Cv[Index] = XFsbl_Blake3Iv[Index];
+  }
+
+  while (Length > XFSBL_BLAKE3_BLOCK_LEN) {
+    for (u32 Word = 0U; Word < XFSBL_BLAKE3_BLOCK_WORDS; Word++) {
+      M[Word] = XFsbl_Blake3Load32(&Data[4U * Word]);
+    }
+    XFsbl_Blake3Compress(Cv, M, Counter, XFSBL_BLAKE3_BLOCK_LEN, BlockFlags);
+    BlockFlags = 0U;
+    Data += XFSBL_BLAKE3_BLOCK_LEN;
+    Length -= XFSBL_BLAKE3_BLOCK_LEN;
+  }
+
+  /* The last block is zero padded */
+  u8 Block[XFSBL_BLAKE3_BLOCK_LEN] = {0U};
+  for (u32 Index = 0U; Index < Length; Index++) {
+    Block[Index] = Data[Index];
+  }
+  for (u32 Word = 0U; Word < XFSBL_BLAKE3_BLOCK_WORDS; Word++) {
+    M[Word] = XFsbl_Blake3Load32(&Block[4U * Word]);
+  }
+  XFsbl_Blake3Compress(Cv, M, Counter, Length,
+                       BlockFlags | XFSBL_BLAKE3_CHUNK_END | Flags);
+}
+
+/*****************************************************************************/
+/**
+ * This function hashes four consecutive full chunks, one per vector lane
+ *
+ * @param	Data is the first chunk
+ * @param	Counter is the index of the first chunk in the input
+ * @param	Cvs is filled with the four chaining values
+ *
+ *****************************************************************************/
+static void XFsbl_Blake3Chunks4(const u8* Data, u64 Counter,
+                                u32 Cvs[XFSBL_BLAKE3_WAYS]
+                                       [XFSBL_BLAKE3_CV_WORDS]) {
+  const XFsbl_Blake3Vec CounterLow = {(u32)Counter, (u32)(Counter + 1U),
+                                      (u32)(Counter + 2U),
+                                      (u32)(Counter + 3U)};
+  const XFsbl_Blake3Vec CounterHigh = {
+      (u32)(Counter >> 32U), (u32)((Counter + 1U) >> 32U),
+      (u32)((Counter + 2U) >> 32U), (u32)((Counter + 3U) >> 32U)};
+  XFsbl_Blake3Vec Cv[XFSBL_BLAKE3_CV_WORDS];
+
+  for (u32 Index = 0U; Index < XFSBL_BLAKE3_CV_WORDS; Index++) {
+    Cv[Index] = XFSBL_BLAKE3_SPLAT(XFsbl_Blake3Iv[Index]);
+  }
+
+  for (u32 Offset = 0U; Offset < XFSBL_BLAKE3_CHUNK_LEN;
+       Offset += XFSBL_BLAKE3_BLOCK_LEN) {
+    const u8* Block = &Data[Offset];
+    XFsbl_Blake3Vec M[XFSBL_BLAKE3_BLOCK_WORDS];
+    u32 Flags = 0U;
+
+    /* Lane n takes the words of chunk n */
+    for (u32 Word = 0U; Word < XFSBL_BLAKE3_BLOCK_WORDS; Word++) {
+      M[Word] = (XFsbl_Blake3Vec){
+          XFsbl_Blake3Load32(&Block[4U * Word]),
+          XFsbl_Blake3Load32(&Block[XFSBL_BLAKE3_CHUNK_LEN + (4U * Word)]),
+          XFsbl_Blake3Load32(
+              &Block[(2U * XFSBL_BLAKE3_CHUNK_LEN) + (4U * Word)]),
+          XFsbl_Blake3Load32(
+              &Block[(3U * XFSBL_BLAKE3_CHUNK_LEN) + (4U * Word)])};
+    }
+
+    if (Offset == 0U) {
+      Flags |= XFSBL_BLAKE3_CHUNK_START;
+    }
+    if (Offset == (XFSBL_BLAKE3_CHUNK_LEN - XFSBL_BLAKE3_BLOCK_LEN)) {
+      Flags |= XFSBL_BLAKE3_CHUNK_END;
+    }
+
+    XFsbl_Blake3Vec V[16] = {
+        Cv[0],
+        Cv[1],
+        Cv[2],
+        Cv[3],
+        Cv[4],
+        Cv[5],
+        Cv[6],
+        Cv[7],
+        XFSBL_BLAKE3_SPLAT(XFsbl_Blake3Iv[0]),
+        XFSBL_BLAKE3_SPLAT(XFsbl_Blake3Iv[1]),
+        XFSBL_BLAKE3_SPLAT(XFsbl_Blake3Iv[2]),
+        XFSBL_BLAKE3_SPLAT(XFsbl_Blake3Iv[3]),
+        CounterLow,
+        CounterHigh,
+        XFSBL_BLAKE3_SPLAT(XFSBL_BLAKE3_BLOCK_LEN),
+        XFSBL_BLAKE3_SPLAT(Flags)};
+
+    for (u32 Round = 0U; Round < XFSBL_BLAKE3_ROUNDS; Round++) {
+      XFSBL_BLAKE3_ROUND(V, M, XFsbl_Blake3Schedule[Round]);
+    }
+
+    for (u32 Index = 0U; Index < XFSBL_BLAKE3_CV_WORDS; Index++) {
+      Cv[Index] = V[Index] ^ V[Index + 8U];
+    }
+  }
+
+  for (u32 Lane = 0U; Lane < XFSBL_BLAKE3_WAYS; Lane++) {
+    for (u32 Index = 0U; Index < XFSBL_BLAKE3_CV_WORDS; Index++) {
+      Cvs[Lane][Index] = Cv[Index][Lane];
+    }
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function computes the chaining value of a parent node
+ *
+ * @param	Children is the left chaining value followed by the right one
+ * @param	Flags is XFSBL_BLAKE3_ROOT for the root, 0 otherwise
+ * @param	Cv is filled with the chaining value of the parent
+ *
+ *****************************************************************************/
+static void XFsbl_Blake3Parent(const u32* Children, u32 Flags, u32* Cv) {
+  for (u32 Index = 0U; Index < XFSBL_BLAKE3_CV_WORDS; Index++) {
+    Cv[Index] = XFsbl_Blake3Iv[Index];
+  }
+  XFsbl_Blake3Compress(Cv, Children, 0U, XFSBL_BLAKE3_BLOCK_LEN,
+                       XFSBL_BLAKE3_PARENT | Flags);
+}
+
+/*****************************************************************************/
+/**
+ * This function computes the chaining value of a subtree that is not the
+ * root, which is any aligned power of two chunks, or the chunks left at the
+ * end of the input
+ *
+ * @param	Data is the subtree input
+ * @param	Length is the subtree length, not 0
+ * @param	Counter is the index of the first chunk in the input
+ * @param	Cv is filled with the chaining value
+ *
+ *****************************************************************************/
+static void XFsbl_Blake3Subtree(const u8* Data, u32 Length, u64 Counter,
+                                u32* Cv) {
+  u32 Stack[XFSBL_BLAKE3_MAX_DEPTH][XFSBL_BLAKE3_CV_WORDS];
+  u32 Cvs[XFSBL_BLAKE3_WAYS][XFSBL_BLAKE3_CV_WORDS];
+  u32 Children[2U * XFSBL_BLAKE3_CV_WORDS];
+  u32 Depth = 0U;
+  u64 Chunks = 0U;
+  u32 Ways = 0U;
+
+  do {
+    if (Length >= (XFSBL_BLAKE3_WAYS * XFSBL_BLAKE3_CHUNK_LEN)) {
+      XFsbl_Blake3Chunks4(Data, Counter, Cvs);
+      Ways = XFSBL_BLAKE3_WAYS;
+      Data += XFSBL_BLAKE3_WAYS * XFSBL_BLAKE3_CHUNK_LEN;
+      Length -= XFSBL_BLAKE3_WAYS * XFSBL_BLAKE3_CHUNK_LEN;
+    } else {
+      const u32 Bytes = (Length < XFSBL_BLAKE3_CHUNK_LEN)
+                            ? Length
+                            : XFSBL_BLAKE3_CHUNK_LEN;
+      XFsbl_Blake3Chunk(Data, Bytes, Counter, 0U, Cvs[0]);
+      Ways = 1U;
+      Data += Bytes;
+      Length -= Bytes;
+    }
+    Counter += Ways;
+
+    /* A complete subtree of 2^n chunks is merged with its left sibling */
+    for (u32 Way = 0U; Way < Ways; Way++) {
+      u32* Merged = Cvs[Way];
+
+      Chunks++;
+      for (u64 Complete = Chunks; (Complete & 1U) == 0U; Complete >>= 1U) {
+        Depth--;
+        for (u32 Index = 0U; Index < XFSBL_BLAKE3_CV_WORDS; Index++) {
+          Children[Index] = Stack[Depth][Index];
+          Children[Index + XFSBL_BLAKE3_CV_WORDS] = Merged[Index];
+        }
+        XFsbl_Blake3Parent(Children, 0U, Merged);
+      }
+      for (u32 Index = 0U; Index < XFSBL_BLAKE3_CV_WORDS; Index++) {
+        Stack[Depth][Index] = Merged[Index];
+      }
+      Depth++;
+    }
+  } while (Length != 0U);
+
+  /* The pending subtrees get smaller to the top, merge from the right */
+  Depth--;
+  for (u32 Index = 0U; Index < XFSBL_BLAKE3_CV_WORDS; Index++) {
+    Cv[Index] = Stack[Depth][Index];
+  }
+  while (Depth != 0U) {
+    Depth--;
+    for (u32 Index = 0U; Index < XFSBL_BLAKE3_CV_WORDS; Index++) {
+      Children[Index] = Stack[Depth][Index];
+      Children[Index + XFSBL_BLAKE3_CV_WORDS] = Cv[Index];
+    }
+    XFsbl_Blake3Parent(Children, 0U, Cv);
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function merges consecutive subtree chaining values into the
+ * chaining value of their tree
+ *
+ * @param	Cvs is the array of chaining values
+ * @param	Count is the number of chaining values, not 0
+ * @param	Flags is XFSBL_BLAKE3_ROOT for the root, 0 otherwise
+ * @param	Cv is filled with the chaining value
+ *
+ *****************************************************************************/
+static void XFsbl_Blake3Merge(const u8* Cvs, u32 Count, u32 Flags, u32* Cv) {
+  u32 Children[2U * XFSBL_BLAKE3_CV_WORDS];
+  u32 Left = 1U;
+
+  if (Count == 1U) {
+    for (u32 Index = 0U; Index < XFSBL_BLAKE3_CV_WORDS; Index++) {
+      Cv[Index] = XFsbl_Blake3Load32(&Cvs[4U * Index]);
+    }
+    return;
+  }
+
+  /* The left subtree is the largest power of two that leaves a right one */
+  while ((2U * Left) < Count) {
+    Left *= 2U;
+  }
+  XFsbl_Blake3Merge(Cvs, Left, 0U, Children);
+  XFsbl_Blake3Merge(&Cvs[Left * XFSBL_BLAKE3_LEN], Count - Left, 0U,
+                    &Children[XFSBL_BLAKE3_CV_WORDS]);
+  XFsbl_Blake3Parent(Children, Flags, Cv);
+}
+
+/*****************************************************************************/
+/**
+ * This function computes the BLAKE3 digest of a buffer
+ *
+ * @param	Data is the data
+ * @param	Length is the number of bytes of data
+ * @param	Hash is filled with the XFSBL_BLAKE3_LEN bytes of the digest
+ *
+ *****************************************************************************/
+void XFsbl_Blake3Digest(const u8* Data, u32 Length, u8* Hash) {
+  u32 Cv[XFSBL_BLAKE3_CV_WORDS];
+
+  if (Length <= XFSBL_BLAKE3_CHUNK_LEN) {
+    XFsbl_Blake3Chunk(Data, Length, 0U, XFSBL_BLAKE3_ROOT, Cv);
+  } else {
+    u32 Children[2U * XFSBL_BLAKE3_CV_WORDS];
+    u64 Left = XFSBL_BLAKE3_CHUNK_LEN;
+
+    while ((2U * Left) < Length) {
+      Left *= 2U;
+    }
+    XFsbl_Blake3Subtree(Data, (u32)Left, 0U, Children);
+    XFsbl_Blake3Subtree(&Data[Left], Length - (u32)Left,
+                        Left / XFSBL_BLAKE3_CHUNK_LEN,
+                        &Children[XFSBL_BLAKE3_CV_WORDS]);
+    XFsbl_Blake3Parent(Children, XFSBL_BLAKE3_ROOT, Cv);
+  }
+
+  XFsbl_Blake3StoreCv(Cv, Hash);
+}
+
+/*****************************************************************************/
+/**
+ * This function computes the chaining value of a segment of a longer input.
+ * A segment is a power of two chunks at a multiple of its size, or the rest
+ * of the input after the last full segment.
+ *
+ * @param	Data is the segment
+ * @param	Length is the segment length, not 0
+ * @param	Offset is the offset of the segment in the input
+ * @param	Cv is filled with the XFSBL_BLAKE3_LEN bytes chaining value
+ *
+ *****************************************************************************/
+void XFsbl_Blake3Segment(const u8* Data, u32 Length, u64 Offset, u8* Cv) {
+  u32 Words[XFSBL_BLAKE3_CV_WORDS];
+
+  XFsbl_Blake3Subtree(Data, Length, Offset / XFSBL_BLAKE3_CHUNK_LEN, Words);
+  XFsbl_Blake3StoreCv(Words, Cv);
+}
+
+/*****************************************************************************/
+/**
+ * This function computes the BLAKE3 digest of an input from the chaining
+ * values of its segments
+ *
+ * @param	Cvs is the chaining value of every segment, in order
+ * @param	Count is the number of segments
+ * @param	Hash is filled with the XFSBL_BLAKE3_LEN bytes of the digest
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns XFSBL_FAILURE for less than two segments, the root of
+ * 		a single segment is a chunk or a parent with the root flag
+ *
+ *****************************************************************************/
+u32 XFsbl_Blake3Root(const u8* Cvs, u32 Count, u8* Hash) {
+  u32 Cv[XFSBL_BLAKE3_CV_WORDS];
+
+  if (Count < 2U) {
+    return XFSBL_FAILURE;
+  }
+
+  XFsbl_Blake3Merge(Cvs, Count, XFSBL_BLAKE3_ROOT, Cv);
+  XFsbl_Blake3StoreCv(Cv, Hash);
+
+  return XFSBL_SUCCESS;
+}
@@ -0,0 +1,78 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_blake3.h
+ *
+ * This is the header file of the BLAKE3 hash of the FSBL. BLAKE3 hashes
+ * 1 KB chunks independently and combines their chaining values in a binary
+ * tree, so a partition is split in segments of a power of two chunks that
+ * are hashed separately, on several cores, and checked one by one against
+ * the segment chaining values stored with the partition.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef XFSBL_BLAKE3_H
+#define XFSBL_BLAKE3_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+/* Length of the BLAKE3 digest and of a chaining value */
+#define XFSBL_BLAKE3_LEN (32U)
+
+/* Bytes per leaf of the BLAKE3 tree */
+#define XFSBL_BLAKE3_CHUNK_LEN (1024U)
+
+/**
+ * Partition integrity record of the BLAKE3 checksum type, at the partition
+ * checksum offset. Segments is the number of 2^SegmentShift byte segments
+ * of the loaded partition. Unless there is a single segment, the header is
+ * followed by the chaining value of every segment, the root hash is the
+ * BLAKE3 tree of these chaining values.
+ */
+#define XFSBL_BLAKE3_MAGIC (0x33424C42U) /* "BLB3" */
+#define XFSBL_BLAKE3_RECORD_LEN (48U)
+#define XFSBL_BLAKE3_MIN_SEGMENT_SHIFT (10U)
+#define XFSBL_BLAKE3_MAX_SEGMENT_SHIFT (31U)
+#define XFSBL_BLAKE3_MAX_SEGMENTS (64U)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+  u8 Root[XFSBL_BLAKE3_LEN]; /**< BLAKE3 of the loaded partition */
+  u32 Magic;
+  u32 SegmentShift; /**< log2 of the segment size in bytes */
+  u32 Segments;
+  u32 Reserved;
+} XFsblPs_Blake3Record;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+void XFsbl_Blake3Digest(const u8* Data, u32 Length, u8* Hash);
+void XFsbl_Blake3Segment(const u8* Data, u32 Length, u64 Offset, u8* Cv);
+u32 XFsbl_Blake3Root(const u8* Cvs, u32 Count, u8* Hash);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_BLAKE3_H */
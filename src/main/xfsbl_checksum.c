@@ -0,0 +1,230 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_checksum.c
+ *
+ * This is the file which contains the checksum functions of the FSBL.
+ *
+ * The CRC-32C uses the ARMv8 CRC32CX instruction on 8 bytes at a time.
+ * One CRC instruction depends on the result of the previous one, so long
+ * buffers are split in three lanes of XFSBL_CRC32C_LANE_SIZE bytes that are
+ * computed in the same loop and merged by shifting the CRC of the earlier
+ * lanes over the length of the later ones. Other hosts use the SSE4.2
+ * CRC32 instruction, which computes the same CRC, or a bitwise fallback, so
+ * the file also builds for the host tools.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *       dd   10/16/26 Word sum of unaligned buffers without unaligned loads
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xfsbl_checksum.h"
+
+#if defined(__aarch64__)
+#  include <arm_acle.h>
+#  if defined(__ARM_NEON)
+#    include <arm_neon.h>
+#  endif
+#elif defined(__SSE4_2__)
+#  include <nmmintrin.h>
+#endif
+
+/************************** Constant Definitions *****************************/
+/* CRC-32C (Castagnoli) polynomial, reflected */
+#define XFSBL_CRC32C_POLY (0x82F63B78U)
+
+/* x^0 in the reflected representation */
+#define XFSBL_CRC32C_X0 (0x80000000U)
+
+/* x^(8 * XFSBL_CRC32C_LANE_SIZE) modulo the polynomial, reflected */
+#define XFSBL_CRC32C_LANE_SHIFT (0x35D73A62U)
+
+#if XFSBL_CRC32C_LANE_SIZE != 4096U
+#  error "XFSBL_CRC32C_LANE_SHIFT must be updated with XFSBL_CRC32C_LANE_SIZE"
+#endif
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#if defined(__aarch64__)
+#  define XFSBL_CRC32C_TARGET __attribute__((target("+crc")))
+#else
+#  define XFSBL_CRC32C_TARGET
+#endif
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+
+static inline u64 XFsbl_Crc32CLoad64(const u8* Buf) {
+  u64 Data;
+
+  __builtin_memcpy(&Data, Buf, sizeof(Data));
+  return Data;
+}
+
+#if defined(__aarch64__)
+static inline XFSBL_CRC32C_TARGET u32 XFsbl_Crc32CWord(u32 Crc, u64 Data) {
+  return __crc32cd(Crc, Data);
+}
+
+static inline XFSBL_CRC32C_TARGET u32 XFsbl_Crc32CByte(u32 Crc, u8 Data) {
+  return __crc32cb(Crc, Data);
+}
+#elif defined(__SSE4_2__)
+static inline u32 XFsbl_Crc32CWord(u32 Crc, u64 Data) {
+  return (u32)_mm_crc32_u64(Crc, Data);
+}
+
+static inline u32 XFsbl_Crc32CByte(u32 Crc, u8 Data) {
+  return _mm_crc32_u8(Crc, Data);
+}
+#else
+static inline u32 XFsbl_Crc32CByte(u32 Crc, u8 Data) {
+  Crc ^= Data;
+  for (u32 Bit = 0U; Bit < 8U; Bit++) {
+    Crc = (Crc >> 1U) ^ (XFSBL_CRC32C_POLY & (0U - (Crc & 1U)));
+  }
+  return Crc;
+}
+
+static inline u32 XFsbl_Crc32CWord(u32 Crc, u64 Data) {
+  for (u32 Byte = 0U; Byte < 8U; Byte++) {
+    Crc = XFsbl_Crc32CByte(Crc, (u8)(Data >> (8U * Byte)));
+  }
+  return Crc;
+}
+#endif
+
+/*****************************************************************************/
+/**
+ * This function multiplies two reflected polynomials modulo the CRC-32C
+ * polynomial
+ *
+ * @param	A is the first factor
+ * @param	B is the second factor
+ *
+ * @return	the product
+ *
+ *****************************************************************************/
+static u32 XFsbl_Crc32CMulMod(u32 A, u32 B) {
+  u32 Product = 0U;
+
+  for (u32 Bit = 0U; Bit < 32U; Bit++) {
+    Product ^= B & (0U - (A >> 31U));
+    A <<= 1U;
+    B = (B >> 1U) ^ (XFSBL_CRC32C_POLY & (0U - (B & 1U)));
+  }
+
+  return Product;
+}
+
+/*****************************************************************************/
+/**
+ * This function updates a CRC-32C (Castagnoli, reflected) with Len bytes
+ *
+ * @param	Crc is the CRC of the preceding data, 0 to start
+ * @param	Buf is the data
+ * @param	Len is the number of bytes in Buf
+ *
+ * @return	returns the updated CRC
+ *
+ *****************************************************************************/
+XFSBL_CRC32C_TARGET u32 XFsbl_Crc32C(u32 Crc, const u8* Buf, u32 Len) {
+  u32 Crc0 = ~Crc;
+
+  while ((Len != 0U) && (((UINTPTR)Buf & 7U) != 0U)) {
+    Crc0 = XFsbl_Crc32CByte(Crc0, *Buf);
+    Buf++;
+    Len--;
+  }
+
+  while (Len >= (3U * XFSBL_CRC32C_LANE_SIZE)) {
+    const u8* Lane1 = &Buf[XFSBL_CRC32C_LANE_SIZE];
+    const u8* Lane2 = &Buf[2U * XFSBL_CRC32C_LANE_SIZE];
+    u32 Crc1 = 0U;
+    u32 Crc2 = 0U;
+
+    for (u32 Offset = 0U; Offset < XFSBL_CRC32C_LANE_SIZE; Offset += 8U) {
+      Crc0 = XFsbl_Crc32CWord(Crc0, XFsbl_Crc32CLoad64(&Buf[Offset]));
+      Crc1 = XFsbl_Crc32CWord(Crc1, XFsbl_Crc32CLoad64(&Lane1[Offset]));
+      Crc2 = XFsbl_Crc32CWord(Crc2, XFsbl_Crc32CLoad64(&Lane2[Offset]));
+    }
+
+    /* Shift the earlier lanes over the length of the later ones */
+    Crc0 = XFsbl_Crc32CMulMod(Crc0, XFSBL_CRC32C_LANE_SHIFT) ^ Crc1;
+    Crc0 = XFsbl_Crc32CMulMod(Crc0, XFSBL_CRC32C_LANE_SHIFT) ^ Crc2;
+
+    Buf += 3U * XFSBL_CRC32C_LANE_SIZE;
+    Len -= 3U * XFSBL_CRC32C_LANE_SIZE;
+  }
+
+  while (Len >= 8U) {
+    Crc0 = XFsbl_Crc32CWord(Crc0, XFsbl_Crc32CLoad64(Buf));
+    Buf += 8U;
+    Len -= 8U;
+  }
+
+  while (Len != 0U) {
+    Crc0 = XFsbl_Crc32CByte(Crc0, *Buf);
+    Buf++;
+    Len--;
+  }
+
+  return ~Crc0;
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the sum of Length words, the boot image header
+ * checksum is the inverse of it
+ *
+ * @param	Buffer is the word buffer
+ * @param	Length is the number of words
+ *
+ * @return	returns the sum modulo 2^32
+ *
+ *****************************************************************************/
+u32 XFsbl_WordSum(const u32* Buffer, u32 Length) {
+  u32 Sum = 0U;
+  u32 Index = 0U;
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+  /* The Q register loads need a 16 byte aligned buffer, the MMU is off */
+  for (; (Index < Length) && (((UINTPTR)&Buffer[Index] & 15U) != 0U);
+       Index++) {
+    Sum += Buffer[Index];
+  }
+
+  if ((Length - Index) >= 8U) {
+    uint32x4_t Sum0 = vdupq_n_u32(0U);
+    uint32x4_t Sum1 = vdupq_n_u32(0U);
+
+    for (; (Index + 8U) <= Length; Index += 8U) {
+      Sum0 = vaddq_u32(Sum0, vld1q_u32(&Buffer[Index]));
+      Sum1 = vaddq_u32(Sum1, vld1q_u32(&Buffer[Index + 4U]));
+    }
+    Sum += vaddvq_u32(vaddq_u32(Sum0, Sum1));
+  }
+#endif
+
+  for (; Index < Length; Index++) {
+    Sum += Buffer[Index];
+  }
+
+  return Sum;
+}
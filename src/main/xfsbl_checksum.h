@@ -0,0 +1,58 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_checksum.h
+ *
+ * This is the header file of the checksum functions: the CRC-32C of
+ * partitions with the CRC32C checksum attribute and the word sum of the
+ * boot image headers.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef XFSBL_CHECKSUM_H
+#define XFSBL_CHECKSUM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+/*
+ * Bytes per lane of the interleaved CRC loop. Three lanes are computed
+ * together and merged, shorter buffers use a single lane.
+ */
+#define XFSBL_CRC32C_LANE_SIZE (4096U)
+
+/* Length of the CRC32C checksum stored at the partition checksum offset */
+#define XFSBL_CRC32C_LEN (4U)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+u32 XFsbl_Crc32C(u32 Crc, const u8* Buf, u32 Len);
+u32 XFsbl_WordSum(const u32* Buffer, u32 Length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_CHECKSUM_H */
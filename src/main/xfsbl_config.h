@@ -29,6 +29,40 @@
  *       bsv  05/15/21 Support to ensure authenticated images boot as
  *                     non-secure when RSA_EN is not programmed is disabled by
  *                     default
+ * 5.0   dd   10/16/26 Added FSBL_QSPI_STREAM_EXCLUDE_VAL and
+ *                     XFSBL_QSPI_STREAM_CHUNK_SIZE configurations
+ *       dd   10/16/26 Added FSBL_QSPI_SFDP_EXCLUDE_VAL configuration
+ *       dd   10/16/26 Added FSBL_QSPI_CALIB_EXCLUDE_VAL, XFSBL_QSPI_CALIB_OFFSET
+ *                     and XFSBL_QSPI_CALIB_SIZE configurations
+ *       dd   10/16/26 Added FSBL_QSPI24_4B_EXCLUDE_VAL configuration
+ *       dd   10/16/26 Added FSBL_DEVICE_CACHE_EXCLUDE_VAL,
+ *                     XFSBL_DEVICE_CACHE_BLOCK_SIZE and
+ *                     XFSBL_DEVICE_CACHE_BLOCKS configurations
+ *       dd   10/16/26 Added FSBL_COMPRESSION_EXCLUDE_VAL and
+ *                     XFSBL_DECOMP_STAGING_SIZE configurations
+ *       dd   10/16/26 Added XFSBL_ZDMA_BASEADDR, XFSBL_ZDMA_CHANNELS,
+ *                     XFSBL_ZDMA_DSCR_PER_CHANNEL and XFSBL_ZDMA_SPLIT_MIN
+ *                     configurations
+ *       dd   10/16/26 Added FSBL_PARTITION_CRC_EXCLUDE_VAL configuration
+ *       dd   10/16/26 Added FSBL_PARTITION_SHA3_EXCLUDE_VAL and
+ *                     FSBL_CSU_SHA3_EXCLUDE_VAL configurations
+ *       dd   10/16/26 Added FSBL_PARTITION_BLAKE3_EXCLUDE_VAL and
+ *                     FSBL_APU_WORKERS_EXCLUDE_VAL configurations
+ *       dd   10/16/26 Early handoff is included, partitions enable it with
+ *                     the early handoff attribute
+ *       dd   10/16/26 Added XFSBL_PERF_RECORDS and XFSBL_PERF_TIMELINE_ADDRESS
+ *                     configurations
+ *       dd   10/16/26 Added FSBL_DEFERRED_LOG_EXCLUDE_VAL,
+ *                     XFSBL_LOG_BUFFER_SIZE, XFSBL_LOG_MEMORY_ONLY and
+ *                     XFSBL_LOG_ADDRESS configurations
+ *       dd   10/16/26 Added FSBL_LOG_TOKENS_EXCLUDE_VAL configuration
+ *       dd   10/16/26 Added FSBL_SERDES_CACHE_EXCLUDE_VAL configuration
+ *       dd   10/16/26 Added XFSBL_DDR_TRAIN_ADDRESS and
+ *                     XFSBL_DDR_TRAIN_TEMP_WINDOW configurations
+ *       dd   10/16/26 Added FSBL_DDR_ECC_LAZY_EXCLUDE_VAL,
+ *                     XFSBL_DDR_ECC_CHUNK_SIZE, XFSBL_DDR_ECC_RUN_CHUNKS,
+ *                     XFSBL_DDR_ECC_PENDING_ADDRESS and
+ *                     XFSBL_DDR_ECC_PENDING_RANGES configurations
  *
  *</pre>
  *
@@ -51,6 +85,150 @@ extern "C" {
 /* This is the address in DDR where boot.bin will be copied in USB boot mode */
 #define XFSBL_DDR_TEMP_BUFFER_ADDRESS (0x4000000U)
 
+/*
+ * Chunk size of the QSPI streaming read path. One chunk is read by DMA
+ * while the previous one is post-processed. Must be a multiple of 64 bytes.
+ */
+#ifndef XFSBL_QSPI_STREAM_CHUNK_SIZE
+#define XFSBL_QSPI_STREAM_CHUNK_SIZE (0x40000U)
+#endif
+
+/*
+ * Flash region read back by QSPI clock calibration. It must not change
+ * between boots, must not be blank and must not cross a 16 MB bank. The
+ * size must be a multiple of 64 bytes.
+ */
+#ifndef XFSBL_QSPI_CALIB_OFFSET
+#define XFSBL_QSPI_CALIB_OFFSET (0x0U)
+#endif
+
+#ifndef XFSBL_QSPI_CALIB_SIZE
+#define XFSBL_QSPI_CALIB_SIZE (0x400U)
+#endif
+
+/*
+ * Read-ahead cache in OCM for small boot device reads such as the boot
+ * header, image header table and partition headers. The block size must be
+ * a power of 2 and a multiple of 64 bytes.
+ */
+#ifndef XFSBL_DEVICE_CACHE_BLOCK_SIZE
+#define XFSBL_DEVICE_CACHE_BLOCK_SIZE (0x1000U)
+#endif
+
+#ifndef XFSBL_DEVICE_CACHE_BLOCKS
+#define XFSBL_DEVICE_CACHE_BLOCKS (2U)
+#endif
+
+/*
+ * OCM staging buffer of compressed partitions. It must be a multiple of
+ * 64 bytes and hold the largest block payload of a stream plus 72 bytes.
+ */
+#ifndef XFSBL_DECOMP_STAGING_SIZE
+#define XFSBL_DECOMP_STAGING_SIZE (0x4000U)
+#endif
+
+/*
+ * ZDMA copy engine. XFSBL_ZDMA_BASEADDR is the first channel of the GDMA
+ * (0xFD500000U) or the ADMA (0xFFA80000U) block, of which the first
+ * XFSBL_ZDMA_CHANNELS channels are used. Copies shorter than
+ * XFSBL_ZDMA_SPLIT_MIN bytes use a single channel.
+ */
+#ifndef XFSBL_ZDMA_BASEADDR
+#define XFSBL_ZDMA_BASEADDR (0xFD500000U)
+#endif
+
+#ifndef XFSBL_ZDMA_CHANNELS
+#define XFSBL_ZDMA_CHANNELS (4U)
+#endif
+
+#ifndef XFSBL_ZDMA_DSCR_PER_CHANNEL
+#define XFSBL_ZDMA_DSCR_PER_CHANNEL (4U)
+#endif
+
+#ifndef XFSBL_ZDMA_SPLIT_MIN
+#define XFSBL_ZDMA_SPLIT_MIN (0x10000U)
+#endif
+
+/*
+ * Boot timeline of FSBL_PERF_EXCLUDE_VAL = 0. XFSBL_PERF_RECORDS records are
+ * kept in an OCM ring, which is copied before the handoff to
+ * XFSBL_PERF_TIMELINE_ADDRESS, a reserved 64 byte aligned DDR region of
+ * 32 * (XFSBL_PERF_RECORDS + 1) bytes. When it is 0 the timeline stays in
+ * OCM, where it is only readable until the OCM is reused (e.g. by BL31).
+ */
+#ifndef XFSBL_PERF_RECORDS
+#define XFSBL_PERF_RECORDS (128U)
+#endif
+
+#ifndef XFSBL_PERF_TIMELINE_ADDRESS
+#define XFSBL_PERF_TIMELINE_ADDRESS (0x0U)
+#endif
+
+/*
+ * Log buffer of FSBL_DEFERRED_LOG_EXCLUDE_VAL = 0, a power of two. Unless
+ * XFSBL_LOG_MEMORY_ONLY is 1, it is drained to the UART while the FSBL waits
+ * for the hardware and flushed when the FSBL exits. With
+ * XFSBL_LOG_MEMORY_ONLY the log is not sent to the UART and the buffer keeps
+ * its last XFSBL_LOG_BUFFER_SIZE bytes. Before the FSBL exits, the buffer is
+ * copied to XFSBL_LOG_ADDRESS, a reserved 64 byte aligned DDR region of
+ * XFSBL_LOG_BUFFER_SIZE + 16 bytes, unless it is 0.
+ */
+#ifndef XFSBL_LOG_BUFFER_SIZE
+#define XFSBL_LOG_BUFFER_SIZE (0x2000U)
+#endif
+
+#ifndef XFSBL_LOG_MEMORY_ONLY
+#define XFSBL_LOG_MEMORY_ONLY (0U)
+#endif
+
+#ifndef XFSBL_LOG_ADDRESS
+#define XFSBL_LOG_ADDRESS (0x0U)
+#endif
+
+/*
+ * Training results of the dynamic DDR initialization. After a full training
+ * the trained PHY delays and VREF settings are saved to
+ * XFSBL_DDR_TRAIN_ADDRESS, a reserved 64 byte aligned region of 2 KB outside
+ * the DDR which a system reset does not clear, e.g. OCM unused by the FSBL,
+ * ATF and the PMU firmware. The next boots with the same DIMM within
+ * XFSBL_DDR_TRAIN_TEMP_WINDOW degrees C of the training restore them and
+ * check the DDR with a short pattern test instead of training it again.
+ * When it is 0 the DDR is trained on every boot.
+ */
+#ifndef XFSBL_DDR_TRAIN_ADDRESS
+#define XFSBL_DDR_TRAIN_ADDRESS (0x0U)
+#endif
+
+#ifndef XFSBL_DDR_TRAIN_TEMP_WINDOW
+#define XFSBL_DDR_TRAIN_TEMP_WINDOW (20U)
+#endif
+
+/*
+ * Background DDR ECC initialization. The DDR is written in chunks of
+ * XFSBL_DDR_ECC_CHUNK_SIZE bytes, a power of 2 from 64 KB, by ZDMA fills of
+ * up to XFSBL_DDR_ECC_RUN_CHUNKS chunks, which bound the wait for the
+ * destination of a partition. The fill completes before the first handoff
+ * unless XFSBL_DDR_ECC_PENDING_ADDRESS is set: the final handoff then
+ * writes the ranges left, at most XFSBL_DDR_ECC_PENDING_RANGES, to this
+ * reserved 64 byte aligned region of 16 + 16 * XFSBL_DDR_ECC_PENDING_RANGES
+ * bytes, for a next stage which writes them before reading them.
+ */
+#ifndef XFSBL_DDR_ECC_CHUNK_SIZE
+#define XFSBL_DDR_ECC_CHUNK_SIZE (0x200000U)
+#endif
+
+#ifndef XFSBL_DDR_ECC_RUN_CHUNKS
+#define XFSBL_DDR_ECC_RUN_CHUNKS (8U)
+#endif
+
+#ifndef XFSBL_DDR_ECC_PENDING_ADDRESS
+#define XFSBL_DDR_ECC_PENDING_ADDRESS (0x0U)
+#endif
+
+#ifndef XFSBL_DDR_ECC_PENDING_RANGES
+#define XFSBL_DDR_ECC_PENDING_RANGES (32U)
+#endif
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -120,8 +298,11 @@ extern "C" {
  *     			(authentication, decryption, checksum) will be excluded
  *     - FSBL_BS_EXCLUDE PL bitstream code will be excluded
  *     - FSBL_EARLY_HANDOFF_EXCLUDE Early handoff related code will be excluded
+ *       Included by default, only partitions with the early handoff
+ *       attribute (early_handoff in the BIF) are handed off early
  *     - FSBL_WDT_EXCLUDE WDT code will be excluded
- *     - FSBL_PERF_EXCLUDE_VAL Performance prints are excluded
+ *     - FSBL_PERF_EXCLUDE_VAL Performance prints and the boot timeline are
+ *       excluded
  *     - FSBL_A53_TCM_ECC_EXCLUDE_VAL TCM ECC Init will be excluded for A53
  *     - FSBL_PL_CLEAR_EXCLUDE_VAL PL clear will be excluded unless boot.bin
  *     	 contains bitstream
@@ -137,6 +318,39 @@ extern "C" {
  *     - FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL Code to "load authenticated
  *       partitions as non secure when EFUSEs are not programmed and when boot
  *       header is not authenticated" is excluded
+ *     - FSBL_QSPI_STREAM_EXCLUDE_VAL Double-buffered QSPI reads are excluded,
+ *       every QSPI read is a single blocking transfer
+ *     - FSBL_QSPI_SFDP_EXCLUDE_VAL SFDP based QSPI read mode selection is
+ *       excluded, the read command is chosen from the flash ID only
+ *     - FSBL_QSPI_CALIB_EXCLUDE_VAL QSPI clock and tap delay calibration is
+ *       excluded, the flash is read with the fixed default prescaler
+ *     - FSBL_QSPI24_4B_EXCLUDE_VAL QSPI 24 bit boot mode keeps reading flashes
+ *       larger than 16 MB with 3 byte addresses and bank switching
+ *     - FSBL_DEVICE_CACHE_EXCLUDE_VAL Boot device read-ahead cache for header
+ *       reads is excluded, every header read goes to the boot device
+ *     - FSBL_COMPRESSION_EXCLUDE_VAL Compressed partition support is excluded,
+ *       partitions with the compression attribute are rejected
+ *     - FSBL_PARTITION_CRC_EXCLUDE_VAL CRC32C partition checksum support is
+ *       excluded, partitions with the CRC32C checksum type are rejected
+ *     - FSBL_PARTITION_SHA3_EXCLUDE_VAL SHA3 partition checksums are not
+ *       verified
+ *     - FSBL_CSU_SHA3_EXCLUDE_VAL SHA3 partition checksums are computed in
+ *       software instead of by the CSU SHA3 engine
+ *     - FSBL_PARTITION_BLAKE3_EXCLUDE_VAL BLAKE3 partition checksum support
+ *       is excluded, partitions with the BLAKE3 checksum type are rejected
+ *     - FSBL_APU_WORKERS_EXCLUDE_VAL The other A53 cores are not used to
+ *       compute partition checksums
+ *     - FSBL_DEFERRED_LOG_EXCLUDE_VAL Prints are sent to the UART as they
+ *       are made instead of through the log buffer
+ *     - FSBL_LOG_TOKENS_EXCLUDE_VAL Prints are formatted by the FSBL. When
+ *       included, they are sent as binary records that
+ *       tools/xfsbl_log/xfsbl_log_decode formats with the FSBL ELF file
+ *     - FSBL_SERDES_CACHE_EXCLUDE_VAL The SERDES ILL calibration runs on
+ *       every boot instead of reusing the codes of the previous boot. It
+ *       always does with the DDR self refresh code, which uses the same
+ *       persistent register
+ *     - FSBL_DDR_ECC_LAZY_EXCLUDE_VAL The ECC of the whole DDR is initialized
+ *       before the partitions are loaded instead of in the background
  */
 #ifndef FSBL_NAND_EXCLUDE_VAL
 #define FSBL_NAND_EXCLUDE_VAL (1U)
@@ -159,7 +373,7 @@ extern "C" {
 #endif
 
 #ifndef FSBL_EARLY_HANDOFF_EXCLUDE_VAL
-#define FSBL_EARLY_HANDOFF_EXCLUDE_VAL (1U)
+#define FSBL_EARLY_HANDOFF_EXCLUDE_VAL (0U)
 #endif
 
 #ifndef FSBL_WDT_EXCLUDE_VAL
@@ -210,6 +424,66 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL (1U)
 #endif
 
+#ifndef FSBL_QSPI_STREAM_EXCLUDE_VAL
+#define FSBL_QSPI_STREAM_EXCLUDE_VAL (0U)
+#endif
+
+#ifndef FSBL_QSPI_SFDP_EXCLUDE_VAL
+#define FSBL_QSPI_SFDP_EXCLUDE_VAL (0U)
+#endif
+
+#ifndef FSBL_QSPI_CALIB_EXCLUDE_VAL
+#define FSBL_QSPI_CALIB_EXCLUDE_VAL (0U)
+#endif
+
+#ifndef FSBL_QSPI24_4B_EXCLUDE_VAL
+#define FSBL_QSPI24_4B_EXCLUDE_VAL (0U)
+#endif
+
+#ifndef FSBL_DEVICE_CACHE_EXCLUDE_VAL
+#define FSBL_DEVICE_CACHE_EXCLUDE_VAL (0U)
+#endif
+
+#ifndef FSBL_COMPRESSION_EXCLUDE_VAL
+#define FSBL_COMPRESSION_EXCLUDE_VAL (0U)
+#endif
+
+#ifndef FSBL_PARTITION_CRC_EXCLUDE_VAL
+#define FSBL_PARTITION_CRC_EXCLUDE_VAL (0U)
+#endif
+
+#ifndef FSBL_PARTITION_SHA3_EXCLUDE_VAL
+#define FSBL_PARTITION_SHA3_EXCLUDE_VAL (0U)
+#endif
+
+#ifndef FSBL_CSU_SHA3_EXCLUDE_VAL
+#define FSBL_CSU_SHA3_EXCLUDE_VAL (1U)
+#endif
+
+#ifndef FSBL_PARTITION_BLAKE3_EXCLUDE_VAL
+#define FSBL_PARTITION_BLAKE3_EXCLUDE_VAL (0U)
+#endif
+
+#ifndef FSBL_APU_WORKERS_EXCLUDE_VAL
+#define FSBL_APU_WORKERS_EXCLUDE_VAL (1U)
+#endif
+
+#ifndef FSBL_DEFERRED_LOG_EXCLUDE_VAL
+#define FSBL_DEFERRED_LOG_EXCLUDE_VAL (0U)
+#endif
+
+#ifndef FSBL_LOG_TOKENS_EXCLUDE_VAL
+#define FSBL_LOG_TOKENS_EXCLUDE_VAL (1U)
+#endif
+
+#ifndef FSBL_SERDES_CACHE_EXCLUDE_VAL
+#define FSBL_SERDES_CACHE_EXCLUDE_VAL (0U)
+#endif
+
+#ifndef FSBL_DDR_ECC_LAZY_EXCLUDE_VAL
+#define FSBL_DDR_ECC_LAZY_EXCLUDE_VAL (0U)
+#endif
+
 #if (FSBL_NAND_EXCLUDE_VAL) && (!defined(FSBL_NAND_EXCLUDE))
 #define FSBL_NAND_EXCLUDE
 #endif
@@ -284,6 +558,68 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE
 #endif
 
+#if (FSBL_QSPI_STREAM_EXCLUDE_VAL) && (!defined(FSBL_QSPI_STREAM_EXCLUDE))
+#define FSBL_QSPI_STREAM_EXCLUDE
+#endif
+
+#if (FSBL_QSPI_SFDP_EXCLUDE_VAL) && (!defined(FSBL_QSPI_SFDP_EXCLUDE))
+#define FSBL_QSPI_SFDP_EXCLUDE
+#endif
+
+#if (FSBL_QSPI_CALIB_EXCLUDE_VAL) && (!defined(FSBL_QSPI_CALIB_EXCLUDE))
+#define FSBL_QSPI_CALIB_EXCLUDE
+#endif
+
+#if (FSBL_QSPI24_4B_EXCLUDE_VAL) && (!defined(FSBL_QSPI24_4B_EXCLUDE))
+#define FSBL_QSPI24_4B_EXCLUDE
+#endif
+
+#if (FSBL_DEVICE_CACHE_EXCLUDE_VAL) && (!defined(FSBL_DEVICE_CACHE_EXCLUDE))
+#define FSBL_DEVICE_CACHE_EXCLUDE
+#endif
+
+#if (FSBL_COMPRESSION_EXCLUDE_VAL) && (!defined(FSBL_COMPRESSION_EXCLUDE))
+#define FSBL_COMPRESSION_EXCLUDE
+#endif
+
+#if (FSBL_PARTITION_CRC_EXCLUDE_VAL) && (!defined(FSBL_PARTITION_CRC_EXCLUDE))
+#define FSBL_PARTITION_CRC_EXCLUDE
+#endif
+
+#if (FSBL_PARTITION_SHA3_EXCLUDE_VAL) &&                                       \
+    (!defined(FSBL_PARTITION_SHA3_EXCLUDE))
+#define FSBL_PARTITION_SHA3_EXCLUDE
+#endif
+
+#if (FSBL_CSU_SHA3_EXCLUDE_VAL) && (!defined(FSBL_CSU_SHA3_EXCLUDE))
+#define FSBL_CSU_SHA3_EXCLUDE
+#endif
+
+#if (FSBL_PARTITION_BLAKE3_EXCLUDE_VAL) &&                                     \
+    (!defined(FSBL_PARTITION_BLAKE3_EXCLUDE))
+#define FSBL_PARTITION_BLAKE3_EXCLUDE
+#endif
+
+#if (FSBL_APU_WORKERS_EXCLUDE_VAL) && (!defined(FSBL_APU_WORKERS_EXCLUDE))
+#define FSBL_APU_WORKERS_EXCLUDE
+#endif
+
+#if (FSBL_DEFERRED_LOG_EXCLUDE_VAL) && (!defined(FSBL_DEFERRED_LOG_EXCLUDE))
+#define FSBL_DEFERRED_LOG_EXCLUDE
+#endif
+
+#if (FSBL_LOG_TOKENS_EXCLUDE_VAL) && (!defined(FSBL_LOG_TOKENS_EXCLUDE))
+#define FSBL_LOG_TOKENS_EXCLUDE
+#endif
+
+#if (FSBL_SERDES_CACHE_EXCLUDE_VAL) && (!defined(FSBL_SERDES_CACHE_EXCLUDE))
+#define FSBL_SERDES_CACHE_EXCLUDE
+#endif
+
+#if (FSBL_DDR_ECC_LAZY_EXCLUDE_VAL) && (!defined(FSBL_DDR_ECC_LAZY_EXCLUDE))
+#define FSBL_DDR_ECC_LAZY_EXCLUDE
+#endif
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
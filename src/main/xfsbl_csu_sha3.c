@@ -0,0 +1,266 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_csu_sha3.c
+ *
+ * This is the file which contains the CSU SHA3 engine of XFsbl_Sha3Update().
+ *
+ * The data is sent to the SHA3 engine by the source channel of the CSU DMA.
+ * A transfer is started by XFsbl_Sha3Update() and waited for by the next
+ * call, so the engine hashes one chunk while the boot device reads the
+ * next. The CSU DMA moves words, data of other lengths or alignments goes
+ * through a bounce buffer. The engine does not pad, the SHA3 padding is
+ * sent with the last transfer.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xfsbl_hw.h"
+
+#ifdef XFSBL_CSU_SHA3
+#  include "xfsbl_sha3.h"
+#  include "xil_cache.h"
+#  include "xil_mem.h"
+#  include "xil_util.h"
+
+/************************** Constant Definitions *****************************/
+#  define XFSBL_CSU_SHA3_TIMEOUT_US (1000000U)
+
+/* Pending bytes and the padding, rounded up to a cache line */
+#  define XFSBL_CSU_SHA3_BOUNCE_SIZE (256U)
+
+#  define XFSBL_CSU_SHA3_DIGEST_WORDS (XFSBL_SHA3_LEN / 4U)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u32 XFsbl_CsuSha3Start(void);
+static u32 XFsbl_CsuSha3Update(const u8* Data, u32 Length);
+static u32 XFsbl_CsuSha3Finish(u8* Hash);
+
+/************************** Variable Definitions *****************************/
+const XFsblPs_Sha3Engine XFsbl_CsuSha3Engine = {
+    XFsbl_CsuSha3Start, XFsbl_CsuSha3Update, XFsbl_CsuSha3Finish};
+
+static u8 CsuSha3Bounce[XFSBL_CSU_SHA3_BOUNCE_SIZE]
+    __attribute__((aligned(64)));
+static u32 CsuSha3BounceBytes;     /**< Bytes waiting for a full word */
+static u32 CsuSha3Length;          /**< Bytes hashed, for the padding */
+static u32 CsuSha3DmaBusy = FALSE; /**< TRUE while a transfer runs */
+
+/*****************************************************************************/
+/**
+ * This function waits for the running CSU DMA transfer
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns XFSBL_ERROR_CSU_SHA3 on a timeout
+ *
+ *****************************************************************************/
+static u32 XFsbl_CsuSha3DmaWait(void) {
+  if (CsuSha3DmaBusy == FALSE) {
+    return XFSBL_SUCCESS;
+  }
+  CsuSha3DmaBusy = FALSE;
+
+  if (Xil_WaitForEvent(CSUDMA_CSU_DMA_SRC_I_STS,
+                       CSUDMA_CSU_DMA_SRC_I_STS_DONE_MASK,
+                       CSUDMA_CSU_DMA_SRC_I_STS_DONE_MASK,
+                       XFSBL_CSU_SHA3_TIMEOUT_US) != XST_SUCCESS) {
+    XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_CSU_SHA3 DMA timeout\n\r");
+    return XFSBL_ERROR_CSU_SHA3;
+  }
+  XFsbl_Out32(CSUDMA_CSU_DMA_SRC_I_STS, CSUDMA_CSU_DMA_SRC_I_STS_DONE_MASK);
+
+  return XFSBL_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function starts a CSU DMA transfer of words to the SHA3 engine,
+ * after the previous one is done
+ *
+ * @param	Data is the word aligned data
+ * @param	Length is the number of bytes, a multiple of 4
+ * @param	Last is TRUE for the transfer with the padding
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns XFSBL_ERROR_CSU_SHA3 on a timeout
+ *
+ *****************************************************************************/
+static u32 XFsbl_CsuSha3DmaStart(const u8* Data, u32 Length, u32 Last) {
+  const u32 Status = XFsbl_CsuSha3DmaWait();
+  if (Status != XFSBL_SUCCESS) {
+    return Status;
+  }
+
+  /* The DMA reads memory, data written by the CPU has to be flushed */
+  Xil_DCacheFlushRange((INTPTR)Data, Length);
+
+  XFsbl_Out32(CSUDMA_CSU_DMA_SRC_ADDR, (u32)(UINTPTR)Data);
+  XFsbl_Out32(CSUDMA_CSU_DMA_SRC_ADDR_MSB, (u32)((u64)(UINTPTR)Data >> 32U));
+  XFsbl_Out32(CSUDMA_CSU_DMA_SRC_SIZE,
+              Length | ((Last == TRUE) ? CSUDMA_CSU_DMA_SRC_SIZE_LAST_WORD_MASK
+                                       : 0U));
+  CsuSha3DmaBusy = TRUE;
+
+  return XFSBL_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function resets and starts the SHA3 engine and routes the CSU DMA to
+ * it
+ *
+ * @return	returns XFSBL_SUCCESS
+ *
+ *****************************************************************************/
+static u32 XFsbl_CsuSha3Start(void) {
+  (void)XFsbl_CsuSha3DmaWait();
+  CsuSha3BounceBytes = 0U;
+  CsuSha3Length = 0U;
+
+  XFsbl_Out32(CSU_CSU_SSS_CFG, CSU_CSU_SSS_CFG_SHA_SSS_DMA_VAL);
+
+  /* The engine takes the words big endian */
+  XFsbl_Out32(CSUDMA_CSU_DMA_SRC_CTRL,
+              XFsbl_In32(CSUDMA_CSU_DMA_SRC_CTRL) |
+                  CSUDMA_CSU_DMA_SRC_CTRL_ENDIANNESS_MASK);
+  XFsbl_Out32(CSUDMA_CSU_DMA_SRC_I_STS, CSUDMA_CSU_DMA_SRC_I_STS_DONE_MASK);
+
+  XFsbl_Out32(CSU_SHA_RESET, CSU_SHA_RESET_RESET_MASK);
+  XFsbl_Out32(CSU_SHA_RESET, 0U);
+  XFsbl_Out32(CSU_SHA_START, CSU_SHA_START_START_MSG_MASK);
+
+  return XFSBL_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function sends data to the SHA3 engine. Word aligned data is read
+ * by the CSU DMA in place and the transfer is left running.
+ *
+ * @param	Data is the data
+ * @param	Length is the number of bytes of data
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns XFSBL_ERROR_CSU_SHA3 on a timeout
+ *
+ *****************************************************************************/
+static u32 XFsbl_CsuSha3Update(const u8* Data, u32 Length) {
+  u32 Status = XFSBL_SUCCESS;
+
+  CsuSha3Length += Length;
+
+  while ((Status == XFSBL_SUCCESS) && (Length != 0U)) {
+    if ((CsuSha3BounceBytes == 0U) && (((UINTPTR)Data & 3U) == 0U) &&
+        (Length >= 4U)) {
+      const u32 Words = Length & ~3U;
+
+      Status = XFsbl_CsuSha3DmaStart(Data, Words, FALSE);
+      Data += Words;
+      Length -= Words;
+      continue;
+    }
+
+    /* The bounce buffer may still be read by the DMA */
+    Status = XFsbl_CsuSha3DmaWait();
+    if (Status != XFSBL_SUCCESS) {
+      break;
+    }
+
+    u32 Bytes = XFSBL_CSU_SHA3_BOUNCE_SIZE - CsuSha3BounceBytes;
+    if (Bytes > Length) {
+      Bytes = Length;
+    }
+    Xil_MemCpy(&CsuSha3Bounce[CsuSha3BounceBytes], Data, Bytes);
+    CsuSha3BounceBytes += Bytes;
+    Data += Bytes;
+    Length -= Bytes;
+
+    const u32 Words = CsuSha3BounceBytes & ~3U;
+    if (Words != 0U) {
+      Status = XFsbl_CsuSha3DmaStart(CsuSha3Bounce, Words, FALSE);
+      if (Status == XFSBL_SUCCESS) {
+        Status = XFsbl_CsuSha3DmaWait();
+      }
+      CsuSha3BounceBytes -= Words;
+      Xil_MemCpy(CsuSha3Bounce, &CsuSha3Bounce[Words], CsuSha3BounceBytes);
+    }
+  }
+
+  return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function sends the padding and reads the digest of the SHA3 engine
+ *
+ * @param	Hash is filled with the XFSBL_SHA3_LEN bytes of the digest
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns XFSBL_ERROR_CSU_SHA3 on a timeout
+ *
+ *****************************************************************************/
+static u32 XFsbl_CsuSha3Finish(u8* Hash) {
+  u32 Status = XFsbl_CsuSha3DmaWait();
+  if (Status != XFSBL_SUCCESS) {
+    goto END;
+  }
+
+  /* Pad to a block, the pending bytes and the padding are words */
+  const u32 PadBytes = XFSBL_SHA3_RATE - (CsuSha3Length % XFSBL_SHA3_RATE);
+  Xil_MemSet(&CsuSha3Bounce[CsuSha3BounceBytes], 0U, PadBytes);
+  CsuSha3Bounce[CsuSha3BounceBytes] = 0x06U;
+  CsuSha3Bounce[CsuSha3BounceBytes + PadBytes - 1U] |= 0x80U;
+
+  Status = XFsbl_CsuSha3DmaStart(CsuSha3Bounce, CsuSha3BounceBytes + PadBytes,
+                                 TRUE);
+  if (Status == XFSBL_SUCCESS) {
+    Status = XFsbl_CsuSha3DmaWait();
+  }
+  CsuSha3BounceBytes = 0U;
+  if (Status != XFSBL_SUCCESS) {
+    goto END;
+  }
+
+  if (Xil_WaitForEvent(CSU_SHA_DONE, CSU_SHA_DONE_SHA_DONE_MASK,
+                       CSU_SHA_DONE_SHA_DONE_MASK,
+                       XFSBL_CSU_SHA3_TIMEOUT_US) != XST_SUCCESS) {
+    XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_CSU_SHA3 digest timeout\n\r");
+    Status = XFSBL_ERROR_CSU_SHA3;
+    goto END;
+  }
+
+  /* The digest registers hold the words last to first */
+  for (u32 Index = 0U; Index < XFSBL_CSU_SHA3_DIGEST_WORDS; Index++) {
+    const u32 Word = XFsbl_In32(CSU_SHA_DIGEST_0 + (Index * 4U));
+    Xil_MemCpy(&Hash[(XFSBL_CSU_SHA3_DIGEST_WORDS - 1U - Index) * 4U], &Word,
+               sizeof(Word));
+  }
+
+END:
+  XFsbl_Out32(CSUDMA_CSU_DMA_SRC_CTRL,
+              XFsbl_In32(CSUDMA_CSU_DMA_SRC_CTRL) &
+                  ~CSUDMA_CSU_DMA_SRC_CTRL_ENDIANNESS_MASK);
+  XFsbl_Out32(CSU_SHA_RESET, CSU_SHA_RESET_RESET_MASK);
+
+  return Status;
+}
+#endif /* XFSBL_CSU_SHA3 */
@@ -0,0 +1,697 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_ddr_ecc.c
+ *
+ * This is the file which contains the background DDR ECC initialization.
+ *
+ * The low and the high PS DDR are cut in chunks of XFSBL_DDR_ECC_CHUNK_SIZE
+ * bytes, a bitmap keeps the chunks written. Two streams fill runs of free
+ * chunks, each on half of the ZDMA channels, one in each region when there
+ * are two. They are advanced by XFsbl_DdrEccPoll(), which every poll of the
+ * FSBL calls, so the fill goes on while the FSBL waits for the boot device.
+ *
+ * XFsbl_DdrEccInitRange() makes the chunks of a range urgent: the streams
+ * take them before any other as their runs end, and it returns once they
+ * are written. The partition destinations are initialized through it
+ * before they are loaded, and the other regions the FSBL writes before a
+ * handoff.
+ *
+ * A CPU released by a handoff may read any DDR, XFsbl_DdrEccFinish() waits
+ * for the whole DDR before, or with XFSBL_DDR_ECC_PENDING_ADDRESS, writes
+ * the ranges left for the next stage and stops the fill.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *       dd   10/16/26 Ranges are rounded to chunks, no translation table
+ *                     update as the MMU is off, runs aborted on timeout
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xfsbl_ddr_ecc.h"
+
+#ifdef XFSBL_DDR_ECC_LAZY
+#  include "xfsbl_debug.h"
+#  include "xfsbl_main.h"
+#  include "xfsbl_perf.h"
+#  include "xfsbl_poll.h"
+#  include "xfsbl_zdma.h"
+#  include "xil_cache.h"
+
+/************************** Constant Definitions *****************************/
+#  if (XFSBL_DDR_ECC_CHUNK_SIZE < 0x10000U) || \
+      ((XFSBL_DDR_ECC_CHUNK_SIZE & (XFSBL_DDR_ECC_CHUNK_SIZE - 1U)) != 0U)
+#    error "XFSBL_DDR_ECC_CHUNK_SIZE must be a power of 2 from 64 KB"
+#  endif
+
+#  if (XFSBL_DDR_ECC_RUN_CHUNKS == 0U)
+#    error "XFSBL_DDR_ECC_RUN_CHUNKS must be 1 or more"
+#  endif
+
+#  define XFSBL_DDR_ECC_LOW_SIZE                                    \
+    (((u64)XFSBL_PS_DDR_END_ADDRESS -                               \
+      (u64)XFSBL_PS_DDR_INIT_START_ADDRESS) + 1U)
+#  define XFSBL_DDR_ECC_LOW_CHUNKS                                  \
+    ((XFSBL_DDR_ECC_LOW_SIZE + XFSBL_DDR_ECC_CHUNK_SIZE - 1U) /     \
+     XFSBL_DDR_ECC_CHUNK_SIZE)
+
+#  ifdef XFSBL_PS_HI_DDR_START_ADDRESS
+#    define XFSBL_DDR_ECC_REGIONS (2U)
+#    define XFSBL_DDR_ECC_HI_SIZE                                   \
+      (((u64)XFSBL_PS_HI_DDR_END_ADDRESS -                          \
+        (u64)XFSBL_PS_HI_DDR_START_ADDRESS) + 1U)
+#    define XFSBL_DDR_ECC_HI_CHUNKS                                 \
+      ((XFSBL_DDR_ECC_HI_SIZE + XFSBL_DDR_ECC_CHUNK_SIZE - 1U) /    \
+       XFSBL_DDR_ECC_CHUNK_SIZE)
+#  else
+#    define XFSBL_DDR_ECC_REGIONS (1U)
+#    define XFSBL_DDR_ECC_HI_CHUNKS (0U)
+#  endif
+
+#  define XFSBL_DDR_ECC_CHUNKS \
+    ((u32)(XFSBL_DDR_ECC_LOW_CHUNKS + XFSBL_DDR_ECC_HI_CHUNKS))
+
+#  define XFSBL_DDR_ECC_STREAMS (2U)
+#  define XFSBL_DDR_ECC_STREAM_CHANNELS ((XFSBL_ZDMA_CHANNELS + 1U) / 2U)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+  u64 Address;
+  u64 Length;
+  u32 First;  /**< First chunk of the region in the bitmap */
+  u32 Chunks;
+  u32 Next;   /**< No chunk before it is left to the background fill */
+  u32 Left;   /**< Chunks not written */
+  XTime Start;
+} XFsblPs_DdrEccRegion;
+
+typedef struct {
+  XFsblPs_ZDmaRequest Request;
+  u32 First; /**< First chunk of the run */
+  u32 Count; /**< Chunks of the run, 0 when the stream is idle */
+} XFsblPs_DdrEccStream;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+static XFsblPs_DdrEccRegion DdrEccRegions[XFSBL_DDR_ECC_REGIONS];
+static XFsblPs_DdrEccStream DdrEccStreams[XFSBL_DDR_ECC_STREAMS];
+static u32 DdrEccDone[(XFSBL_DDR_ECC_CHUNKS + 31U) / 32U];
+
+static u32 DdrEccStarted;
+static u32 DdrEccBackground; /**< TRUE while all the chunks are filled */
+static u32 DdrEccLeft;       /**< Chunks not written */
+static u32 DdrEccRuns;       /**< Runs ended, the progress of the waits */
+static u32 DdrEccStatus;
+
+/* Chunks to write before any other */
+static u32 DdrEccUrgentFirst;
+static u32 DdrEccUrgentEnd;
+
+static u32 XFsbl_DdrEccIsDone(u32 Chunk) {
+  const u32 Done = (DdrEccDone[Chunk / 32U] >> (Chunk % 32U)) & 1U;
+
+  return (Done != 0U) ? TRUE : FALSE;
+}
+
+/*****************************************************************************/
+/**
+ * This function checks if a chunk can be written by a new run
+ *
+ * @param	Chunk is the chunk
+ *
+ * @return	TRUE when it is neither written nor in a run, FALSE otherwise
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrEccIsFree(u32 Chunk) {
+  const XFsblPs_DdrEccStream* Stream;
+  u32 Index;
+
+  if (XFsbl_DdrEccIsDone(Chunk) == TRUE) {
+    return FALSE;
+  }
+  for (Index = 0U; Index < XFSBL_DDR_ECC_STREAMS; Index++) {
+    Stream = &DdrEccStreams[Index];
+    if ((Chunk >= Stream->First) && (Chunk < (Stream->First + Stream->Count))) {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+static XFsblPs_DdrEccRegion* XFsbl_DdrEccRegionOf(u32 Chunk) {
+  u32 Index = 0U;
+
+  while (Chunk >= (DdrEccRegions[Index].First + DdrEccRegions[Index].Chunks)) {
+    Index++;
+  }
+
+  return &DdrEccRegions[Index];
+}
+
+static u32 XFsbl_DdrEccAllDone(u32 First, u32 End) {
+  u32 Chunk;
+
+  for (Chunk = First; Chunk < End; Chunk++) {
+    if (XFsbl_DdrEccIsDone(Chunk) == FALSE) {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the chunks of a range of a region
+ *
+ * @param	Region is the region
+ *
+ * @param	Start is the start of the range, in the region
+ *
+ * @param	End is the end of the range, in the region
+ *
+ * @param	First is set to the first chunk of the range
+ *
+ * @return	The end of the chunks of the range
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrEccChunks(const XFsblPs_DdrEccRegion* Region, u64 Start,
+                              u64 End, u32* First) {
+  *First = Region->First +
+           (u32)((Start - Region->Address) / XFSBL_DDR_ECC_CHUNK_SIZE);
+
+  return Region->First +
+         (u32)(((End - Region->Address) + XFSBL_DDR_ECC_CHUNK_SIZE - 1U) /
+               XFSBL_DDR_ECC_CHUNK_SIZE);
+}
+
+/*****************************************************************************/
+/**
+ * This function starts a run on an idle stream: the fill of the free chunks
+ * from First, up to End and XFSBL_DDR_ECC_RUN_CHUNKS chunks.
+ *
+ * @param	Stream is the idle stream
+ *
+ * @param	First is a free chunk
+ *
+ * @param	End is the end of the run, in the region of First
+ *
+ * @return	None, the run is retried on the next poll while the ZDMA
+ *		channels are busy
+ *
+ *****************************************************************************/
+static void XFsbl_DdrEccStartRun(XFsblPs_DdrEccStream* Stream, u32 First,
+                                 u32 End) {
+  const XFsblPs_DdrEccRegion* Region = XFsbl_DdrEccRegionOf(First);
+  const u64 RegionEnd = Region->Address + Region->Length;
+  u32 Count = 1U;
+
+  while (((First + Count) < End) && (Count < XFSBL_DDR_ECC_RUN_CHUNKS) &&
+         (XFsbl_DdrEccIsFree(First + Count) == TRUE)) {
+    Count++;
+  }
+
+  const u64 Address = Region->Address + ((u64)(First - Region->First) *
+                                         XFSBL_DDR_ECC_CHUNK_SIZE);
+  u64 Length = (u64)Count * XFSBL_DDR_ECC_CHUNK_SIZE;
+  if ((Address + Length) > RegionEnd) {
+    Length = RegionEnd - Address;
+  }
+
+  const u32 Status = XFsbl_ZDmaFillSubmitChannels(
+      &Stream->Request, Address, XFSBL_ECC_INIT_VAL_WORD, Length,
+      XFSBL_DDR_ECC_STREAM_CHANNELS);
+  if (Status == XFSBL_ERROR_DEVICE_BUSY) {
+    return;
+  }
+  if (Status != XFSBL_SUCCESS) {
+    XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_DDR_ECC_INIT: fill of 0x%llx\n\r",
+                 Address);
+    DdrEccStatus = XFSBL_ERROR_DDR_ECC_INIT;
+    return;
+  }
+
+  Stream->First = First;
+  Stream->Count = Count;
+}
+
+/*****************************************************************************/
+/**
+ * This function marks the chunks of the run of a stream as written
+ *
+ * @param	Stream is the stream whose run is done
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_DdrEccRunDone(const XFsblPs_DdrEccStream* Stream) {
+  XFsblPs_DdrEccRegion* Region = XFsbl_DdrEccRegionOf(Stream->First);
+  u32 Chunk;
+
+  for (Chunk = Stream->First; Chunk < (Stream->First + Stream->Count);
+       Chunk++) {
+    DdrEccDone[Chunk / 32U] |= (u32)1U << (Chunk % 32U);
+  }
+  DdrEccLeft -= Stream->Count;
+  Region->Left -= Stream->Count;
+
+  if (Region->Left == 0U) {
+    XFsbl_PerfRecord(XFSBL_PERF_EVENT_DDR_ECC,
+                     (u32)(Region - DdrEccRegions), Region->Start,
+                     Region->Length);
+    XFsbl_Printf(DEBUG_INFO, "Address 0x%llx, Length %llx, ECC initialized\n\r",
+                 Region->Address, Region->Length);
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function starts the next run of an idle stream, on the urgent
+ * chunks first, then with the background fill on the free chunks of the
+ * region of the stream, or of the other one once it is done.
+ *
+ * @param	Index is the stream
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_DdrEccSchedule(u32 Index) {
+  XFsblPs_DdrEccStream* Stream = &DdrEccStreams[Index];
+  XFsblPs_DdrEccRegion* Region;
+  u32 Offset;
+  u32 Chunk;
+  u32 End;
+
+  for (Chunk = DdrEccUrgentFirst; Chunk < DdrEccUrgentEnd; Chunk++) {
+    if (XFsbl_DdrEccIsFree(Chunk) == TRUE) {
+      XFsbl_DdrEccStartRun(Stream, Chunk, DdrEccUrgentEnd);
+      return;
+    }
+  }
+
+  if (DdrEccBackground == FALSE) {
+    return;
+  }
+
+  for (Offset = 0U; Offset < XFSBL_DDR_ECC_REGIONS; Offset++) {
+    Region = &DdrEccRegions[(Index + Offset) % XFSBL_DDR_ECC_REGIONS];
+    End = Region->First + Region->Chunks;
+
+    while ((Region->Next < End) &&
+           (XFsbl_DdrEccIsDone(Region->Next) == TRUE)) {
+      Region->Next++;
+    }
+    for (Chunk = Region->Next; Chunk < End; Chunk++) {
+      if (XFsbl_DdrEccIsFree(Chunk) == TRUE) {
+        XFsbl_DdrEccStartRun(Stream, Chunk, End);
+        return;
+      }
+    }
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function advances the fill without blocking: the runs which are
+ * done are recorded and the idle streams start the next ones.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_DdrEccPoll(void) {
+  XFsblPs_DdrEccStream* Stream;
+  u32 Index;
+
+  if (DdrEccStarted == FALSE) {
+    return;
+  }
+
+  for (Index = 0U; Index < XFSBL_DDR_ECC_STREAMS; Index++) {
+    Stream = &DdrEccStreams[Index];
+
+    if (Stream->Count != 0U) {
+      const u32 Status = XFsbl_ZDmaPoll(&Stream->Request);
+      if (Status == XFSBL_STATUS_DEVICE_REQUEST_PENDING) {
+        continue;
+      }
+      if (Status == XFSBL_SUCCESS) {
+        XFsbl_DdrEccRunDone(Stream);
+      } else {
+        XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_DDR_ECC_INIT: chunk %u\n\r",
+                     Stream->First);
+        DdrEccStatus = XFSBL_ERROR_DDR_ECC_INIT;
+      }
+      Stream->Count = 0U;
+      DdrEccRuns++;
+    }
+
+    if ((DdrEccStatus == XFSBL_SUCCESS) && (DdrEccLeft != 0U)) {
+      XFsbl_DdrEccSchedule(Index);
+    }
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function checks if a wait is over
+ *
+ * @param	First is the first chunk waited for
+ *
+ * @param	End is the end of the chunks waited for, First for the runs in
+ *		progress
+ *
+ * @return	TRUE while a chunk waited for is not written, or with an empty
+ *		range while a stream runs, FALSE otherwise
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrEccWaiting(u32 First, u32 End) {
+  u32 Index;
+
+  if ((First == 0U) && (End == XFSBL_DDR_ECC_CHUNKS)) {
+    return (DdrEccLeft != 0U) ? TRUE : FALSE;
+  }
+  if (XFsbl_DdrEccAllDone(First, End) == FALSE) {
+    return TRUE;
+  }
+  if (First == End) {
+    for (Index = 0U; Index < XFSBL_DDR_ECC_STREAMS; Index++) {
+      if (DdrEccStreams[Index].Count != 0U) {
+        return TRUE;
+      }
+    }
+  }
+
+  return FALSE;
+}
+
+static u32 XFsbl_DdrEccProgress(u32 Runs) {
+  XFsbl_DdrEccPoll();
+
+  return ((DdrEccRuns != Runs) || (DdrEccStatus != XFSBL_SUCCESS)) ? TRUE
+                                                                   : FALSE;
+}
+
+/*****************************************************************************/
+/**
+ * This function waits for chunks, each run getting XFSBL_ZDMA_TIMEOUT
+ *
+ * @param	First is the first chunk to wait for
+ *
+ * @param	End is the end of the chunks, First to wait for the runs in
+ *		progress
+ *
+ * @return	returns XFSBL_SUCCESS once the chunks are written
+ * 		returns XFSBL_ERROR_DDR_ECC_INIT on a fill error or timeout
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrEccWait(u32 First, u32 End) {
+  u32 Runs;
+  u32 Index;
+
+  for (;;) {
+    XFsbl_DdrEccPoll();
+    if (DdrEccStatus != XFSBL_SUCCESS) {
+      return DdrEccStatus;
+    }
+    if (XFsbl_DdrEccWaiting(First, End) == FALSE) {
+      return XFSBL_SUCCESS;
+    }
+
+    Runs = DdrEccRuns;
+    if (XFSBL_POLL_UNTIL(XFsbl_DdrEccProgress(Runs) == TRUE,
+                         XFSBL_ZDMA_TIMEOUT, 0U) != XFSBL_SUCCESS) {
+      XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_POLL_TIMEOUT: DDR ECC\n\r");
+      DdrEccStatus = XFSBL_ERROR_DDR_ECC_INIT;
+      /* Free the channels, no run is started after an error */
+      for (Index = 0U; Index < XFSBL_DDR_ECC_STREAMS; Index++) {
+        XFsbl_ZDmaAbort(&DdrEccStreams[Index].Request, DdrEccStatus);
+        DdrEccStreams[Index].Count = 0U;
+      }
+      return DdrEccStatus;
+    }
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function starts the background fill of the PS DDR
+ *
+ * @param	None
+ *
+ * @return	returns XFSBL_SUCCESS if the fill was started
+ * 		returns XFSBL_ERROR_DDR_ECC_INIT on a fill error
+ *
+ *****************************************************************************/
+u32 XFsbl_DdrEccStart(void) {
+  XFsblPs_DdrEccRegion* Region;
+  u32 First = 0U;
+  u32 Index;
+
+  DdrEccRegions[0U].Address = XFSBL_PS_DDR_INIT_START_ADDRESS;
+  DdrEccRegions[0U].Length = XFSBL_DDR_ECC_LOW_SIZE;
+#  ifdef XFSBL_PS_HI_DDR_START_ADDRESS
+  DdrEccRegions[1U].Address = XFSBL_PS_HI_DDR_START_ADDRESS;
+  DdrEccRegions[1U].Length = XFSBL_DDR_ECC_HI_SIZE;
+#  endif
+
+  for (Index = 0U; Index < XFSBL_DDR_ECC_REGIONS; Index++) {
+    Region = &DdrEccRegions[Index];
+    Region->First = First;
+    Region->Chunks = (u32)((Region->Length + XFSBL_DDR_ECC_CHUNK_SIZE - 1U) /
+                           XFSBL_DDR_ECC_CHUNK_SIZE);
+    Region->Next = First;
+    Region->Left = Region->Chunks;
+    Region->Start = XFsbl_PerfNow();
+    First += Region->Chunks;
+    XFsbl_Printf(DEBUG_INFO,
+                 "Address 0x%llx, Length %llx, ECC initializing\n\r",
+                 Region->Address, Region->Length);
+  }
+
+  DdrEccLeft = XFSBL_DDR_ECC_CHUNKS;
+  DdrEccBackground = TRUE;
+  DdrEccStarted = TRUE;
+  XFsbl_Printf(DEBUG_GENERAL, "Initializing DDR ECC in the background\n\r");
+
+  XFsbl_DdrEccPoll();
+
+  return DdrEccStatus;
+}
+
+/*****************************************************************************/
+/**
+ * This function initializes the ECC of a range before the FSBL writes it.
+ * The parts of the range outside the PS DDR are ignored.
+ *
+ * @param	Address is the start of the range
+ *
+ * @param	Length is the length of the range
+ *
+ * @return	returns XFSBL_SUCCESS once the range is initialized
+ * 		returns XFSBL_ERROR_DDR_ECC_INIT on a fill error or timeout
+ *
+ *****************************************************************************/
+u32 XFsbl_DdrEccInitRange(u64 Address, u64 Length) {
+  const XFsblPs_DdrEccRegion* Region;
+  u32 Status = DdrEccStatus;
+  u32 Index;
+
+  if ((DdrEccStarted == FALSE) || (Length == 0U)) {
+    return Status;
+  }
+
+  for (Index = 0U; (Index < XFSBL_DDR_ECC_REGIONS) &&
+                   (Status == XFSBL_SUCCESS);
+       Index++) {
+    Region = &DdrEccRegions[Index];
+
+    const u64 RegionEnd = Region->Address + Region->Length;
+    if ((Address >= RegionEnd) || ((Address + Length) <= Region->Address)) {
+      continue;
+    }
+    /* The chunks of the range are rounded out by XFsbl_DdrEccChunks */
+    const u64 Start = (Address > Region->Address) ? Address : Region->Address;
+    const u64 End =
+        ((Address + Length) < RegionEnd) ? (Address + Length) : RegionEnd;
+
+    DdrEccUrgentEnd =
+        XFsbl_DdrEccChunks(Region, Start, End, &DdrEccUrgentFirst);
+    Status = XFsbl_DdrEccWait(DdrEccUrgentFirst, DdrEccUrgentEnd);
+    DdrEccUrgentFirst = 0U;
+    DdrEccUrgentEnd = 0U;
+  }
+
+  return Status;
+}
+
+#  if (XFSBL_DDR_ECC_PENDING_ADDRESS != 0U)
+/*****************************************************************************/
+/**
+ * This function writes the ranges which are not initialized at
+ * XFSBL_DDR_ECC_PENDING_ADDRESS. No run may be in progress.
+ *
+ * @param	None
+ *
+ * @return	returns XFSBL_SUCCESS if the ranges were written
+ * 		returns XFSBL_FAILURE if there are more than
+ *		XFSBL_DDR_ECC_PENDING_RANGES
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrEccPublish(void) {
+  XFsblPs_DdrEccPending* const Pending =
+      (XFsblPs_DdrEccPending*)(UINTPTR)XFSBL_DDR_ECC_PENDING_ADDRESS;
+  const XFsblPs_DdrEccRegion* Region;
+  u32 Count = 0U;
+  u32 Chunk = 0U;
+  u32 End;
+
+  while (Chunk < XFSBL_DDR_ECC_CHUNKS) {
+    if (XFsbl_DdrEccIsDone(Chunk) == TRUE) {
+      Chunk++;
+      continue;
+    }
+    if (Count == XFSBL_DDR_ECC_PENDING_RANGES) {
+      return XFSBL_FAILURE;
+    }
+
+    Region = XFsbl_DdrEccRegionOf(Chunk);
+    End = Chunk + 1U;
+    while ((End < (Region->First + Region->Chunks)) &&
+           (XFsbl_DdrEccIsDone(End) == FALSE)) {
+      End++;
+    }
+
+    const u64 Address = Region->Address + ((u64)(Chunk - Region->First) *
+                                           XFSBL_DDR_ECC_CHUNK_SIZE);
+    u64 Length = (u64)(End - Chunk) * XFSBL_DDR_ECC_CHUNK_SIZE;
+    if ((Address + Length) > (Region->Address + Region->Length)) {
+      Length = (Region->Address + Region->Length) - Address;
+    }
+    Pending->Range[Count].Address = Address;
+    Pending->Range[Count].Length = Length;
+    Count++;
+    Chunk = End;
+  }
+
+  Pending->Magic = XFSBL_DDR_ECC_PENDING_MAGIC;
+  Pending->Count = Count;
+  Pending->Pattern = XFSBL_ECC_INIT_VAL_WORD;
+  Pending->Reserved = 0U;
+  Xil_DCacheFlushRange((INTPTR)Pending, sizeof(*Pending));
+
+  return XFSBL_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function stops the fill and leaves the chunks left to the next
+ * stage. The regions the FSBL still writes, the ranges, the boot timeline
+ * and the log, are initialized first.
+ *
+ * @param	None
+ *
+ * @return	returns XFSBL_SUCCESS if the ranges left were written
+ * 		returns XFSBL_FAILURE if there are too many of them, the fill
+ *		goes on
+ * 		returns XFSBL_ERROR_DDR_ECC_INIT on a fill error or timeout
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrEccHandOver(void) {
+  u32 Status = XFsbl_DdrEccInitRange(XFSBL_DDR_ECC_PENDING_ADDRESS,
+                                     sizeof(XFsblPs_DdrEccPending));
+
+#    if defined(XFSBL_PERF) && (XFSBL_PERF_TIMELINE_ADDRESS != 0U)
+  if (Status == XFSBL_SUCCESS) {
+    Status = XFsbl_DdrEccInitRange(XFSBL_PERF_TIMELINE_ADDRESS,
+                                   32U * (XFSBL_PERF_RECORDS + 1U));
+  }
+#    endif
+#    if defined(XFSBL_DEFERRED_LOG) && (XFSBL_LOG_ADDRESS != 0U)
+  if (Status == XFSBL_SUCCESS) {
+    Status = XFsbl_DdrEccInitRange(XFSBL_LOG_ADDRESS,
+                                   XFSBL_LOG_BUFFER_SIZE + 16U);
+  }
+#    endif
+  if (Status != XFSBL_SUCCESS) {
+    return Status;
+  }
+
+  DdrEccBackground = FALSE;
+  Status = XFsbl_DdrEccWait(0U, 0U);
+  if (Status == XFSBL_SUCCESS) {
+    Status = XFsbl_DdrEccPublish();
+  }
+  if (Status == XFSBL_SUCCESS) {
+    XFsbl_Printf(DEBUG_GENERAL,
+                 "DDR ECC of %u chunks left to the next stage\n\r",
+                 DdrEccLeft);
+    DdrEccStarted = FALSE;
+  }
+  DdrEccBackground = TRUE;
+
+  return Status;
+}
+#  endif
+
+/*****************************************************************************/
+/**
+ * This function completes the fill before a handoff. With HandOver and
+ * XFSBL_DDR_ECC_PENDING_ADDRESS, the fill is stopped instead and the ranges
+ * left are written for the next stage. The FSBL writes no other DDR after.
+ *
+ * @param	HandOver is TRUE when the next stage may initialize the ranges
+ *		left
+ *
+ * @return	returns XFSBL_SUCCESS once the DDR is initialized or handed
+ *		over
+ * 		returns XFSBL_ERROR_DDR_ECC_INIT on a fill error or timeout
+ *
+ *****************************************************************************/
+u32 XFsbl_DdrEccFinish(u32 HandOver) {
+  u32 Status;
+
+  if (DdrEccStarted == FALSE) {
+    return XFSBL_SUCCESS;
+  }
+
+#  if (XFSBL_DDR_ECC_PENDING_ADDRESS != 0U)
+  if (HandOver == TRUE) {
+    Status = XFsbl_DdrEccHandOver();
+    if (Status != XFSBL_FAILURE) {
+      return Status;
+    }
+  }
+#  else
+  (void)HandOver;
+#  endif
+
+  Status = XFsbl_DdrEccWait(0U, XFSBL_DDR_ECC_CHUNKS);
+#  if (XFSBL_DDR_ECC_PENDING_ADDRESS != 0U)
+  /* Nothing is left, the next stage still gets the ranges */
+  if ((Status == XFSBL_SUCCESS) && (HandOver == TRUE)) {
+    Status = XFsbl_DdrEccPublish();
+  }
+#  endif
+
+  return Status;
+}
+#endif /* XFSBL_DDR_ECC_LAZY */
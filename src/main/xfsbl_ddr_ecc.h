@@ -0,0 +1,88 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_ddr_ecc.h
+ *
+ * This is the header file of the background DDR ECC initialization. The PS
+ * DDR regions are written in chunks of XFSBL_DDR_ECC_CHUNK_SIZE bytes by
+ * ZDMA fills that run while the partitions are loaded. The destination of a
+ * partition is initialized first with XFsbl_DdrEccInitRange(), the rest is
+ * completed by XFsbl_DdrEccFinish() before a CPU is handed off, or left to
+ * the next stage through XFSBL_DDR_ECC_PENDING_ADDRESS.
+ *
+ * The fills hold the ZDMA channels until XFsbl_DdrEccFinish(), the other
+ * ZDMA requests may be rejected with XFSBL_ERROR_DEVICE_BUSY until then.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef XFSBL_DDR_ECC_H
+#define XFSBL_DDR_ECC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xfsbl_hw.h"
+#include "xfsbl_error.h"
+
+/************************** Constant Definitions *****************************/
+#define XFSBL_DDR_ECC_PENDING_MAGIC (0x50434345U) /* "ECCP" */
+
+/**************************** Type Definitions *******************************/
+/**
+ * Ranges whose ECC is not initialized at the handoff, written at
+ * XFSBL_DDR_ECC_PENDING_ADDRESS. The next stage writes every range, with
+ * full 64 byte bursts, before it reads from it.
+ */
+typedef struct {
+  u32 Magic; /**< XFSBL_DDR_ECC_PENDING_MAGIC */
+  u32 Count; /**< Ranges used */
+  u32 Pattern;
+  u32 Reserved;
+  struct {
+    u64 Address;
+    u64 Length;
+  } Range[XFSBL_DDR_ECC_PENDING_RANGES];
+} XFsblPs_DdrEccPending;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+#ifdef XFSBL_DDR_ECC_LAZY
+u32 XFsbl_DdrEccStart(void);
+void XFsbl_DdrEccPoll(void);
+u32 XFsbl_DdrEccInitRange(u64 Address, u64 Length);
+u32 XFsbl_DdrEccFinish(u32 HandOver);
+#else
+static inline void XFsbl_DdrEccPoll(void) {}
+static inline u32 XFsbl_DdrEccInitRange(u64 Address, u64 Length) {
+  (void)Address;
+  (void)Length;
+  return XFSBL_SUCCESS;
+}
+static inline u32 XFsbl_DdrEccFinish(u32 HandOver) {
+  (void)HandOver;
+  return XFSBL_SUCCESS;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_DDR_ECC_H */
@@ -30,6 +30,12 @@
  *       mn   12/24/19 Enable Address Mirroring based on SPD data
  *       bsv  02/05/20 Added support for ZCU208 board
  * 4.0   mn   10/28/21 Added support for ZCU670 board
+ * 5.0   dd   10/16/26 Record the training in the boot timeline
+ *       dd   10/16/26 Poll the controller and the PHY on a deadline
+ *       dd   10/16/26 Save the training and restore it on the next boots
+ *       dd   10/16/26 Map the blocks of the pattern test of a restore
+ *       dd   10/16/26 Removed the map of the pattern test, the MMU is off
+ *       dd   10/16/26 Check the training records with XFsbl_Crc32C
  *
  * </pre>
  *
@@ -45,6 +51,13 @@
 
 #include "xiicps.h"
 #include "xfsbl_ddr_init.h"
+#include "xfsbl_perf.h"
+#include "xfsbl_poll.h"
+#ifdef XFSBL_DDR_TRAIN_CACHE
+#include "xfsbl_checksum.h"
+#include "xfsbl_misc.h"
+#include "xil_cache.h"
+#endif
 
 /************************** Constant Definitions *****************************/
 
@@ -181,7 +194,46 @@
 #define XFSBL_BRCMAPPING XPAR_PSU_DDRC_0_BRC_MAPPING
 
 #define XFSBL_DDR4ADDRMAPPING XPAR_PSU_DDRC_0_DDR4_ADDR_MAPPING
+
+#ifdef XFSBL_DDR_TRAIN_CACHE
+/* Saved training record at XFSBL_DDR_TRAIN_ADDRESS */
+#define XFSBL_DDR_TRAIN_MAGIC 0x54524444U /* "DDRT" */
+/* Byte lanes DX0 to DX8 of the PHY and their register stride */
+#define XFSBL_DDR_TRAIN_LANES 9U
+#define XFSBL_DDR_TRAIN_LANE_STRIDE 0x100U
+#define XFSBL_DDR_TRAIN_RANKS 2U
+/* Registers of a lane common to the ranks and per rank */
+#define XFSBL_DDR_TRAIN_LANE_REGS 2U
+#define XFSBL_DDR_TRAIN_RANK_REGS 14U
+/* Drift of the delay line calibration allowed since the training, 1/32 */
+#define XFSBL_DDR_TRAIN_TPRD_DRIFT_SHIFT 5U
+/* DDR4 MR6 VrefDQ training enable, range and value */
+#define XFSBL_DDR_TRAIN_MR6_VREF_EN 0x80U
+#define XFSBL_DDR_TRAIN_MR6_VREF_MASK 0x7FU
+/* Pattern test of a restored training, at both ends of the DDR */
+#define XFSBL_DDR_TRAIN_TEST_SIZE 0x400U
+/* Temperature of the PS SYSMON, 509.314 / 2^16 degrees C per LSB - 280.23 */
+#define XFSBL_DDR_TRAIN_TEMP_OFFSET AMS_PS_SYSMON_BASEADDR
+#define XFSBL_DDR_TRAIN_TEMP_SCALE 509314U
+#define XFSBL_DDR_TRAIN_TEMP_ZERO 280230
+#endif
 /**************************** Type Definitions *******************************/
+#ifdef XFSBL_DDR_TRAIN_CACHE
+/* Trained PHY state saved at XFSBL_DDR_TRAIN_ADDRESS */
+typedef struct {
+	u32 Magic;
+	u32 Size;	/* Size of the record */
+	u32 SpdCrc;	/* CRC of the SPD of the DIMM trained */
+	s32 Temp;	/* Temperature of the training in degrees C */
+	u32 Mr6;	/* MR6 of the PHY, with the trained DRAM VREF */
+	u32 Dtcr0;
+	u32 Tprd[XFSBL_DDR_TRAIN_LANES]; /* Delay line calibration */
+	u32 Lane[XFSBL_DDR_TRAIN_LANES][XFSBL_DDR_TRAIN_LANE_REGS];
+	u32 Rank[XFSBL_DDR_TRAIN_RANKS][XFSBL_DDR_TRAIN_LANES]
+		[XFSBL_DDR_TRAIN_RANK_REGS];
+	u32 Crc;	/* CRC of the fields above */
+} XFsbl_DdrTrainRecord;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -193,16 +245,14 @@
 #define XFSBL_SETBITS(a, b, c) ((a & ((1U << c) - 1U)) << b)
 /* Macro  to poll for register bits to be set with certain value */
 #define XFSBL_POLL(a, b, c)                                                    \
-	{                                                                      \
-		while ((Xil_In32(a) & (b)) != (c))                             \
-			;                                                      \
-	}
+	XFSBL_POLL_REG((a), (b), (c), XFSBL_DDR_TRAINING_TIMEOUT,              \
+		       XFSBL_POLL_WFE)
 /* Macro  to poll for register bits to be set equal to given mask value */
-#define XFSBL_MASK_POLL(a, b)                                                  \
-	{                                                                      \
-		while ((Xil_In32(a) & (b)) != (b))                             \
-			;                                                      \
-	}
+#define XFSBL_MASK_POLL(a, b) XFSBL_POLL((a), (b), (b))
+/* Macro to poll until the value read in RegVal matches Cond */
+#define XFSBL_POLL_VAL(RegVal, a, Cond)                                        \
+	XFSBL_POLL_UNTIL((((RegVal) = Xil_In32(a)), (Cond)),                   \
+			 XFSBL_DDR_TRAINING_TIMEOUT, XFSBL_POLL_WFE)
 /* Program the register with given value, shifts and mask */
 #define XFSBL_PROG_REG(Addr, mask, shift, Value)                               \
 	{                                                                      \
@@ -216,6 +266,21 @@
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
+#ifdef XFSBL_DDR_TRAIN_CACHE
+/* Offsets in a lane of the VREF settings, DXnGCR5 and DXnGCR6 */
+static const u32 XFsbl_DdrTrainLaneRegs[XFSBL_DDR_TRAIN_LANE_REGS] = {
+	0x14U, 0x18U
+};
+
+/*
+ * Offsets in a lane of the trained delays of the rank selected by RANKIDR,
+ * DXnBDLR0 to DXnBDLR6, DXnLCDLR0 to DXnLCDLR5 and DXnGTR0
+ */
+static const u32 XFsbl_DdrTrainRankRegs[XFSBL_DDR_TRAIN_RANK_REGS] = {
+	0x40U, 0x44U, 0x48U, 0x50U, 0x54U, 0x58U, 0x60U,
+	0x80U, 0x84U, 0x88U, 0x8CU, 0x90U, 0x94U, 0xC0U
+};
+#endif
 
 /*****************************************************************************/
 /**
@@ -5903,259 +5968,401 @@ static void XFsbl_MrsFunc(u32 Addr, u32 Rank, u32 Mr07)
 
 	Xil_Out32(XFSBL_DDRC_BASE_ADDR + 0x10U, RegVal);
 
-	RegVal = Xil_In32(DDRC_MRSTAT_OFFSET);
-	while ((RegVal & 0x1U) != 0x0U)
-		RegVal = Xil_In32(DDRC_MRSTAT_OFFSET);
+	(void)XFSBL_POLL(DDRC_MRSTAT_OFFSET, 0x1U, 0x0U);
 
 	for (u32 i = 0U; i < 10U; i++) {
 		RegVal = Xil_In32(DDRC_MRSTAT_OFFSET);
 	}
 }
 
+#ifdef XFSBL_DDR_TRAIN_CACHE
 /*****************************************************************************/
 /**
- * This function performs the DDR/PHY training sequence to initialize the DDR
+ * This function reads the temperature of the PS from the PS SYSMON
  *
- * @param	DdrDataPtr is pointer to DDR Initialization Data Structure
+ * @param	None
  *
- * @return	Returns XFSBL_SUCCESS or XFSBL_FAILURE
+ * @return	Temperature in degrees C
  *
  *****************************************************************************/
-static u32 XFsbl_DdrcPhyTraining(struct DdrcInitData *DdrDataPtr)
+static s32 XFsbl_DdrTrainTemp(void)
 {
-	XFsbl_DimmParams *PDimmPtr = &DdrDataPtr->PDimm;
-	u32 ActiveRanks;
-	u32 PollVal = 0U;
-	u32 CurTRefPrd;
-	u32 RegVal = 0U;
-	u32 PllRetry = 100U;
-	u32 PllLocked = 0U;
-	u32 Puad;
-	u32 Status = XFSBL_FAILURE;
-
-	ActiveRanks = Xil_In32(XFSBL_DDRC_BASE_ADDR + 0x0000U);
-
-	while ((PllRetry > 0U) && (!PllLocked)) {
-		if ((PllRetry % 10U) == 0U) {
-			Xil_Out32(DDR_PHY_PIR_OFFSET, 0x00040010U);
-			Xil_Out32(DDR_PHY_PIR_OFFSET, 0x00040011U);
-		}
-
-		while ((Xil_In32(DDR_PHY_PGSR0_OFFSET) & 0x1U) != 1U)
-			;
+	u64 Raw = Xil_In32(XFSBL_DDR_TRAIN_TEMP_OFFSET) & 0xFFFFU;
 
-		PllLocked =
-			(Xil_In32(DDR_PHY_PGSR0_OFFSET) & 0x80000000U) >> 31U;
-		PllLocked &=
-			(Xil_In32(DDR_PHY_DX0GSR0_OFFSET) & 0x10000U) >> 16U;
-		PllLocked &=
-			(Xil_In32(DDR_PHY_DX2GSR0_OFFSET) & 0x10000U) >> 16U;
-
-		if (PDimmPtr->BusWidth == 64U) {
-			PllLocked &=
-				(Xil_In32(DDR_PHY_DX4GSR0_OFFSET) & 0x10000U) >>
-				16U;
-			PllLocked &=
-				(Xil_In32(DDR_PHY_DX6GSR0_OFFSET) & 0x10000U) >>
-				16U;
-		}
+	return ((s32)((Raw * XFSBL_DDR_TRAIN_TEMP_SCALE) >> 16U) -
+		XFSBL_DDR_TRAIN_TEMP_ZERO) /
+	       1000;
+}
 
-		if (PDimmPtr->Ecc) {
-			PllLocked &=
-				(Xil_In32(DDR_PHY_DX8GSR0_OFFSET) & 0x10000U) >>
-				16U;
-		}
+/*****************************************************************************/
+/**
+ * This function computes the CRC of a saved training record
+ *
+ * @param	Record is the training record
+ *
+ * @return	CRC of the fields of the record before its CRC
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrTrainCrc(const XFsbl_DdrTrainRecord *Record)
+{
+	return XFsbl_Crc32C(0U, (const u8 *)Record,
+			    sizeof(*Record) - sizeof(Record->Crc));
+}
 
-		PllRetry--;
+/*****************************************************************************/
+/**
+ * This function checks whether the saved training was done with the DIMM of
+ * this boot, within XFSBL_DDR_TRAIN_TEMP_WINDOW of the current temperature
+ *
+ * @param	SpdData is the SPD of the DIMM
+ *
+ * @return	1 when the saved training can be restored, 0 otherwise
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrTrainLookup(u8 *SpdData)
+{
+	const XFsbl_DdrTrainRecord *Record =
+		(const XFsbl_DdrTrainRecord *)(UINTPTR)XFSBL_DDR_TRAIN_ADDRESS;
+	const s32 Temp = XFsbl_DdrTrainTemp();
+	u32 Restore = 0U;
+
+	if ((Record->Magic != XFSBL_DDR_TRAIN_MAGIC) ||
+	    (Record->Size != sizeof(*Record)) ||
+	    (Record->Crc != XFsbl_DdrTrainCrc(Record))) {
+		XFsbl_Printf(DEBUG_INFO, "No saved DDR training\n\r");
+		goto END;
 	}
 
-	Xil_Out32(DDR_PHY_GPR1_OFFSET,
-		  Xil_In32(DDR_PHY_GPR1_OFFSET) | (PllRetry << 16U));
-
-	if (PllLocked == 0U) {
-		XFsbl_Printf(DEBUG_INFO, "DDR-PHY Training failed\n\r");
-		/* Do nothing as Status is initialized to XFSBL_FAILURE */
+	if (Record->SpdCrc != XFsbl_Crc32C(0U, SpdData, 512U)) {
+		XFsbl_Printf(DEBUG_INFO,
+			     "Saved DDR training of another DIMM\n\r");
 		goto END;
 	}
 
-	RegVal = ((PDimmPtr->RDimm ? 0x1U : 0x0U) << 19U) | (0x1U << 18U) |
-		 0x73U;
-
-	/* Now PLL lock is done, resume with other training */
-	RegVal = RegVal & ~DDR_PHY_PIR_PLLINIT_MASK;
+	if ((Temp > (Record->Temp + (s32)XFSBL_DDR_TRAIN_TEMP_WINDOW)) ||
+	    (Temp < (Record->Temp - (s32)XFSBL_DDR_TRAIN_TEMP_WINDOW))) {
+		XFsbl_Printf(DEBUG_INFO,
+			     "Saved DDR training at %d C, now %d C\n\r",
+			     Record->Temp, Temp);
+		goto END;
+	}
 
-	/* End of pll lock retry */
+	Restore = 1U;
+END:
+	return Restore;
+}
 
-	Xil_Out32(XFSBL_DDRPHY_BASE_ADDR + 0x4U, RegVal);
+/*****************************************************************************/
+/**
+ * This function restores the saved training of the PHY and the DRAM VREF
+ * instead of training them. The PHY has calibrated its delay lines during
+ * its initialization, the saved delays are only valid if the calibration of
+ * every lane has not drifted since the training.
+ *
+ * @param	PDimmPtr is pointer to DDR parameters structure
+ *
+ * @return	1 when the training is restored, 0 when the DDR must be trained
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrTrainRestore(XFsbl_DimmParams *PDimmPtr)
+{
+	const XFsbl_DdrTrainRecord *Record =
+		(const XFsbl_DdrTrainRecord *)(UINTPTR)XFSBL_DDR_TRAIN_ADDRESS;
+	const u32 Ranks = XFSBL_MIN(PDimmPtr->NRanks, XFSBL_DDR_TRAIN_RANKS);
+	u32 Lane;
+	u32 Rank;
+	u32 Index;
+	u32 Tprd;
+	u32 Drift;
+	u32 Mr6;
+	UINTPTR LaneAddr;
+	u32 Restore = 0U;
+
+	for (Lane = 0U; Lane < XFSBL_DDR_TRAIN_LANES; Lane++) {
+		Tprd = (Xil_In32(DDR_PHY_DX0MDLR0_OFFSET +
+				 (Lane * XFSBL_DDR_TRAIN_LANE_STRIDE)) &
+			DDR_PHY_DXMDLR0_TPRD_MASK) >>
+		       DDR_PHY_DXMDLR0_TPRD_SHIFT;
+		Drift = (Tprd > Record->Tprd[Lane]) ?
+				(Tprd - Record->Tprd[Lane]) :
+				(Record->Tprd[Lane] - Tprd);
+		if (Drift > (Record->Tprd[Lane] >>
+			     XFSBL_DDR_TRAIN_TPRD_DRIFT_SHIFT)) {
+			XFsbl_Printf(DEBUG_INFO,
+				     "DDR lane %u delay lines at %u, trained "
+				     "at %u\n\r",
+				     Lane, Tprd, Record->Tprd[Lane]);
+			goto END;
+		}
+	}
 
-	if (PDimmPtr->PllByp) {
-		XFsbl_DdrPllBypass(1U);
+	/* Keep the VT compensation off the delays while they are written */
+	XFSBL_PROG_REG(DDR_PHY_PGCR6_OFFSET, DDR_PHY_PGCR6_INHVT_MASK,
+		       DDR_PHY_PGCR6_INHVT_SHIFT, 1U);
+
+	for (Rank = 0U; Rank < Ranks; Rank++) {
+		XFSBL_PROG_REG(DDR_PHY_RANKIDR_OFFSET,
+			       DDR_PHY_RANKIDR_RANKWID_MASK,
+			       DDR_PHY_RANKIDR_RANKWID_SHIFT, Rank);
+		for (Lane = 0U; Lane < XFSBL_DDR_TRAIN_LANES; Lane++) {
+			LaneAddr = DDR_PHY_DX0GCR0_OFFSET +
+				   (Lane * XFSBL_DDR_TRAIN_LANE_STRIDE);
+			for (Index = 0U; Index < XFSBL_DDR_TRAIN_RANK_REGS;
+			     Index++) {
+				Xil_Out32(LaneAddr +
+						  XFsbl_DdrTrainRankRegs[Index],
+					  Record->Rank[Rank][Lane][Index]);
+			}
+		}
 	}
+	XFSBL_PROG_REG(DDR_PHY_RANKIDR_OFFSET, DDR_PHY_RANKIDR_RANKWID_MASK,
+		       DDR_PHY_RANKIDR_RANKWID_SHIFT, 0U);
 
-	XFSBL_POLL(DDR_PHY_PGSR0_OFFSET, 0xFU, 0xFU);
+	for (Lane = 0U; Lane < XFSBL_DDR_TRAIN_LANES; Lane++) {
+		LaneAddr = DDR_PHY_DX0GCR0_OFFSET +
+			   (Lane * XFSBL_DDR_TRAIN_LANE_STRIDE);
+		for (Index = 0U; Index < XFSBL_DDR_TRAIN_LANE_REGS; Index++) {
+			Xil_Out32(LaneAddr + XFsbl_DdrTrainLaneRegs[Index],
+				  Record->Lane[Lane][Index]);
+		}
+	}
+	Xil_Out32(DDR_PHY_DTCR0_OFFSET, Record->Dtcr0);
+	Xil_Out32(DDR_PHY_MR6_OFFSET, Record->Mr6);
 
-	XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_INIT_MASK,
-		       DDR_PHY_PIR_INIT_SHIFT, 1U);
-	XFSBL_POLL(DDR_PHY_PGSR0_OFFSET, 0xFFU, 0x1FU);
+	XFSBL_PROG_REG(DDR_PHY_PGCR6_OFFSET, DDR_PHY_PGCR6_INHVT_MASK,
+		       DDR_PHY_PGCR6_INHVT_SHIFT, 0U);
 
-	if (PDimmPtr->MemType == SPD_MEMTYPE_LPDDR4) {
+	/*
+	 * The DRAM got the default VREF of MR6 at its initialization, set the
+	 * trained one through the VrefDQ training mode
+	 */
+	if ((PDimmPtr->MemType == SPD_MEMTYPE_DDR4) &&
+	    (PDimmPtr->Vref == 1U)) {
+		Mr6 = Record->Mr6 & ~XFSBL_DDR_TRAIN_MR6_VREF_EN;
 		XFsbl_CfgSwInitInt(1U);
-		XFsbl_CfgDfiInitComplete(1U);
-		XFsbl_MrsFunc(0x331U, ActiveRanks, 0U);
-		XFsbl_MrsFunc(0xB36U, ActiveRanks, 0U);
-		if ((PDimmPtr->Zc1656) || (PDimmPtr->HasEccComp)) {
-			XFsbl_MrsFunc(0xC4DU, ActiveRanks, 0U);
-			if (PDimmPtr->Lp4NoOdt) {
-				XFsbl_MrsFunc(0xE6EU, ActiveRanks, 0U);
-			} else {
-				XFsbl_MrsFunc(0xE1EU, ActiveRanks, 0U);
-			}
-			XFsbl_MrsFunc(0x1606U, ActiveRanks, 0U);
-		} else {
-			XFsbl_MrsFunc(0xC21U, ActiveRanks, 0U);
-
-			if (PDimmPtr->Lp4NoOdt) {
-				XFsbl_MrsFunc(0xE6FU, ActiveRanks, 0U);
-			} else {
-				XFsbl_MrsFunc(0xE19U, ActiveRanks, 0U);
-			}
-			XFsbl_MrsFunc(0x1616U, ActiveRanks, 0U);
-		}
+		XFsbl_MrsFunc(Mr6 | XFSBL_DDR_TRAIN_MR6_VREF_EN,
+			      (1U << Ranks) - 1U, 6U);
+		XFsbl_MrsFunc(Mr6 | XFSBL_DDR_TRAIN_MR6_VREF_EN,
+			      (1U << Ranks) - 1U, 6U);
+		XFsbl_MrsFunc(Mr6, (1U << Ranks) - 1U, 6U);
 		XFsbl_CfgSwInitInt(0U);
 	}
 
-	if ((PDimmPtr->MemType == SPD_MEMTYPE_DDR4) && PDimmPtr->RDimm) {
-		XFsbl_CfgSwInitInt(1U);
-		XFsbl_CfgDfiInitComplete(1U);
+	XFsbl_Printf(DEBUG_INFO, "DDR training restored\n\r");
+	Restore = 1U;
+END:
+	return Restore;
+}
 
-		if (PDimmPtr->Parity)
-			XFsbl_MrsFunc(0x88U, 1U, 7U);
-		if (PDimmPtr->AddrMirror)
-			XFsbl_MrsFunc(0xD8U, 1U, 7U);
-		if (PDimmPtr->DisOpInv)
-			XFsbl_MrsFunc(0x01U, 1U, 7U);
-		if (PDimmPtr->SpeedBin == 1866U)
-			XFsbl_MrsFunc(0xA1U, 1U, 7U);
-		if (PDimmPtr->SpeedBin == 2133U)
-			XFsbl_MrsFunc(0xA2U, 1U, 7U);
-		if (PDimmPtr->SpeedBin == 2400U)
-			XFsbl_MrsFunc(0xA3U, 1U, 7U);
-		if (PDimmPtr->SpeedBin == 2666U)
-			XFsbl_MrsFunc(0xA4U, 1U, 7U);
+/*****************************************************************************/
+/**
+ * This function saves the training of the PHY just done for the next boots.
+ * The command bus training of LPDDR4 and the mode registers of LPDDR3 and
+ * LPDDR4 are not saved, so only DDR3 and DDR4 trainings are.
+ *
+ * @param	PDimmPtr is pointer to DDR parameters structure
+ * @param	SpdData is the SPD of the DIMM
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_DdrTrainSave(XFsbl_DimmParams *PDimmPtr, u8 *SpdData)
+{
+	XFsbl_DdrTrainRecord *Record =
+		(XFsbl_DdrTrainRecord *)(UINTPTR)XFSBL_DDR_TRAIN_ADDRESS;
+	const u32 Ranks = XFSBL_MIN(PDimmPtr->NRanks, XFSBL_DDR_TRAIN_RANKS);
+	u32 Lane;
+	u32 Rank;
+	u32 Index;
+	UINTPTR LaneAddr;
 
-		XFsbl_CfgSwInitInt(0U);
+	if ((PDimmPtr->MemType != SPD_MEMTYPE_DDR3) &&
+	    (PDimmPtr->MemType != SPD_MEMTYPE_DDR4)) {
+		goto END;
 	}
 
-	RegVal = Xil_In32(XFSBL_DDRC_BASE_ADDR + 0x1B0U);
-	RegVal |= (0x1U << 0U);
-	Xil_Out32(XFSBL_DDRC_BASE_ADDR + 0x1B0U, RegVal);
+	Record->Magic = XFSBL_DDR_TRAIN_MAGIC;
+	Record->Size = sizeof(*Record);
+	Record->SpdCrc = XFsbl_Crc32C(0U, SpdData, 512U);
+	Record->Temp = XFsbl_DdrTrainTemp();
+	Record->Mr6 = Xil_In32(DDR_PHY_MR6_OFFSET);
+	Record->Dtcr0 = Xil_In32(DDR_PHY_DTCR0_OFFSET);
+
+	for (Lane = 0U; Lane < XFSBL_DDR_TRAIN_LANES; Lane++) {
+		LaneAddr = DDR_PHY_DX0GCR0_OFFSET +
+			   (Lane * XFSBL_DDR_TRAIN_LANE_STRIDE);
+		Record->Tprd[Lane] = (Xil_In32(DDR_PHY_DX0MDLR0_OFFSET +
+					       (Lane *
+						XFSBL_DDR_TRAIN_LANE_STRIDE)) &
+				      DDR_PHY_DXMDLR0_TPRD_MASK) >>
+				     DDR_PHY_DXMDLR0_TPRD_SHIFT;
+		for (Index = 0U; Index < XFSBL_DDR_TRAIN_LANE_REGS; Index++) {
+			Record->Lane[Lane][Index] = Xil_In32(
+				LaneAddr + XFsbl_DdrTrainLaneRegs[Index]);
+		}
+	}
 
-	Xil_Out32(XFSBL_DDRC_BASE_ADDR + 0x320U, 0x1U);
+	for (Rank = 0U; Rank < Ranks; Rank++) {
+		XFSBL_PROG_REG(DDR_PHY_RANKIDR_OFFSET,
+			       DDR_PHY_RANKIDR_RANKRID_MASK,
+			       DDR_PHY_RANKIDR_RANKRID_SHIFT, Rank);
+		for (Lane = 0U; Lane < XFSBL_DDR_TRAIN_LANES; Lane++) {
+			LaneAddr = DDR_PHY_DX0GCR0_OFFSET +
+				   (Lane * XFSBL_DDR_TRAIN_LANE_STRIDE);
+			for (Index = 0U; Index < XFSBL_DDR_TRAIN_RANK_REGS;
+			     Index++) {
+				Record->Rank[Rank][Lane][Index] = Xil_In32(
+					LaneAddr +
+					XFsbl_DdrTrainRankRegs[Index]);
+			}
+		}
+	}
+	XFSBL_PROG_REG(DDR_PHY_RANKIDR_OFFSET, DDR_PHY_RANKIDR_RANKRID_MASK,
+		       DDR_PHY_RANKIDR_RANKRID_SHIFT, 0U);
 
-	XFSBL_POLL(DDRC_STAT_OFFSET, 0xFU, 1U);
+	Record->Crc = XFsbl_DdrTrainCrc(Record);
+	Xil_DCacheFlushRange((INTPTR)Record, sizeof(*Record));
+	XFsbl_Printf(DEBUG_INFO, "DDR training saved\n\r");
 
-	if (PDimmPtr->Slowboot == 1U) {
-		XFSBL_PROG_REG(DDRC_DFIMISC_OFFSET,
-			       DDRC_DFIMISC_DFI_INIT_COMPLETE_EN_MASK,
-			       DDRC_DFIMISC_DFI_INIT_COMPLETE_EN_SHIFT, 0U);
+END:
+	return;
+}
 
-		XFSBL_PROG_REG(DDR_PHY_PGCR1_OFFSET, DDR_PHY_PGCR1_PUBMODE_MASK,
-			       DDR_PHY_PGCR1_PUBMODE_SHIFT, 0x1U);
-		XFSBL_PROG_REG(DDR_PHY_PGCR6_OFFSET, DDR_PHY_PGCR6_INHVT_MASK,
-			       DDR_PHY_PGCR6_INHVT_SHIFT, 0x1U);
-		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_DCALPSE_MASK,
-			       DDR_PHY_PIR_DCALPSE_SHIFT, 0x1U);
-		XFSBL_PROG_REG(DDR_PHY_SCHCR1_OFFSET,
-			       DDR_PHY_SCHCR1_ALLRANK_MASK,
-			       DDR_PHY_SCHCR1_ALLRANK_SHIFT, 0x1U);
-		XFSBL_PROG_REG(DDR_PHY_SCHCR0_OFFSET, DDR_PHY_SCHCR0_CMD_MASK,
-			       DDR_PHY_SCHCR0_CMD_SHIFT, 0x7U);
-		XFSBL_PROG_REG(DDR_PHY_SCHCR0_OFFSET,
-			       DDR_PHY_SCHCR0_SP_CMD_MASK,
-			       DDR_PHY_SCHCR0_SP_CMD_SHIFT, 0x2U);
-		XFSBL_PROG_REG(DDR_PHY_SCHCR0_OFFSET,
-			       DDR_PHY_SCHCR0_SCHTRIG_MASK,
-			       DDR_PHY_SCHCR0_SCHTRIG_SHIFT, 0x1U);
+/*****************************************************************************/
+/**
+ * This function invalidates the saved training
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_DdrTrainInvalidate(void)
+{
+	XFsbl_DdrTrainRecord *Record =
+		(XFsbl_DdrTrainRecord *)(UINTPTR)XFSBL_DDR_TRAIN_ADDRESS;
 
-		Xil_Out32(DDR_PHY_PLLCR0_OFFSET,
-			  Xil_In32(DDR_PHY_PLLCR0_OFFSET));
-		Xil_Out32(DDR_PHY_DX8SL0PLLCR0_OFFSET,
-			  Xil_In32(DDR_PHY_DX8SL0PLLCR0_OFFSET));
-		Xil_Out32(DDR_PHY_DX8SL1PLLCR0_OFFSET,
-			  Xil_In32(DDR_PHY_DX8SL1PLLCR0_OFFSET));
-		Xil_Out32(DDR_PHY_DX8SL2PLLCR0_OFFSET,
-			  Xil_In32(DDR_PHY_DX8SL2PLLCR0_OFFSET));
-		Xil_Out32(DDR_PHY_DX8SL3PLLCR0_OFFSET,
-			  Xil_In32(DDR_PHY_DX8SL3PLLCR0_OFFSET));
-		Xil_Out32(DDR_PHY_DX8SL4PLLCR0_OFFSET,
-			  Xil_In32(DDR_PHY_DX8SL4PLLCR0_OFFSET));
-		Xil_Out32(DDR_PHY_DX8SLBPLLCR0_OFFSET,
-			  Xil_In32(DDR_PHY_DX8SLBPLLCR0_OFFSET));
+	Record->Magic = 0U;
+	Xil_DCacheFlushRange((INTPTR)Record, sizeof(*Record));
+}
 
-		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_DCALPSE_MASK,
-			       DDR_PHY_PIR_DCALPSE_SHIFT, 0U);
+/*****************************************************************************/
+/**
+ * This function returns the test pattern of a DDR word
+ *
+ * @param	Pass is the pass of the test: checkerboard, walking 1,
+ *		walking 0 and address
+ * @param	Addr is the address of the word
+ *
+ * @return	The pattern
+ *
+ *****************************************************************************/
+static u64 XFsbl_DdrTrainPattern(u32 Pass, UINTPTR Addr)
+{
+	const u32 Word = (u32)(Addr >> 3U);
+	u64 Pattern;
+
+	if (Pass == 0U) {
+		Pattern = ((Word & 1U) != 0U) ? 0xAAAAAAAAAAAAAAAAU :
+						0x5555555555555555U;
+	} else if (Pass == 1U) {
+		Pattern = (u64)1U << (Word & 63U);
+	} else if (Pass == 2U) {
+		Pattern = ~((u64)1U << (Word & 63U));
+	} else {
+		Pattern = ((u64)(~(u32)Addr) << 32U) | (u32)Addr;
+	}
 
-		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_CTLDINIT_MASK,
-			       DDR_PHY_PIR_CTLDINIT_SHIFT, 1U);
-		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_PHYRST_MASK,
-			       DDR_PHY_PIR_PHYRST_SHIFT, 1U);
-		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_DCAL_MASK,
-			       DDR_PHY_PIR_DCAL_SHIFT, 1U);
-		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_PLLINIT_MASK,
-			       DDR_PHY_PIR_PLLINIT_SHIFT, 1U);
-		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_INIT_MASK,
-			       DDR_PHY_PIR_INIT_SHIFT, 1U);
+	return Pattern;
+}
 
-		XFSBL_POLL(DDR_PHY_PGSR0_OFFSET, 0xFU, 0xFU);
+/*****************************************************************************/
+/**
+ * This function checks the DDR after a restored training with patterns on
+ * every bit of the byte lanes. The blocks tested are at both ends of the
+ * DDR, in both ranks when the rank is selected by the top address bit.
+ * Every word of the blocks is written with a 64 bit store, then read back.
+ *
+ * @param	None
+ *
+ * @return	XFSBL_SUCCESS if the patterns are read back, else XFSBL_FAILURE
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrTrainTest(void)
+{
+	const UINTPTR Blocks[2U] = {
+		XFSBL_PS_DDR_INIT_START_ADDRESS,
+		(XFSBL_PS_DDR_END_ADDRESS + 1U) - XFSBL_DDR_TRAIN_TEST_SIZE
+	};
+	UINTPTR Addr;
+	u32 Pass;
+	u32 Block;
+	u32 Offset;
+	u32 Byte;
+	u32 ByteLanes;
+	u64 Diff;
+	u32 Status = XFSBL_FAILURE;
 
-		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_INIT_MASK,
-			       DDR_PHY_PIR_INIT_SHIFT, 1U);
-		XFSBL_POLL(DDR_PHY_PGSR0_OFFSET, 0xFFU, 0x1FU);
+	for (Pass = 0U; Pass < 4U; Pass++) {
+		for (Block = 0U; Block < 2U; Block++) {
+			for (Offset = 0U; Offset < XFSBL_DDR_TRAIN_TEST_SIZE;
+			     Offset += 8U) {
+				Addr = Blocks[Block] + Offset;
+				Xil_Out64(Addr,
+					  XFsbl_DdrTrainPattern(Pass, Addr));
+			}
+			/* Write the lines back and drop them from the cache */
+			Xil_DCacheFlushRange((INTPTR)Blocks[Block],
+					     XFSBL_DDR_TRAIN_TEST_SIZE);
+		}
 
-		XFSBL_PROG_REG(DDR_PHY_PGCR6_OFFSET, DDR_PHY_PGCR6_INHVT_MASK,
-			       DDR_PHY_PGCR6_INHVT_SHIFT, 0x0U);
-
-		XFSBL_PROG_REG(DDR_PHY_SCHCR1_OFFSET,
-			       DDR_PHY_SCHCR1_ALLRANK_MASK,
-			       DDR_PHY_SCHCR1_ALLRANK_SHIFT, 0x1U);
-		XFSBL_PROG_REG(DDR_PHY_SCHCR0_OFFSET, DDR_PHY_SCHCR0_CMD_MASK,
-			       DDR_PHY_SCHCR0_CMD_SHIFT, 0x7U);
-		XFSBL_PROG_REG(DDR_PHY_SCHCR0_OFFSET,
-			       DDR_PHY_SCHCR0_SP_CMD_MASK,
-			       DDR_PHY_SCHCR0_SP_CMD_SHIFT, 0x3U);
-		XFSBL_PROG_REG(DDR_PHY_SCHCR0_OFFSET,
-			       DDR_PHY_SCHCR0_SCHTRIG_MASK,
-			       DDR_PHY_SCHCR0_SCHTRIG_SHIFT, 0x1U);
-	}
-
-	if (PDimmPtr->MemType == SPD_MEMTYPE_LPDDR3) {
-		XFsbl_CfgSwInitInt(1U);
-		XFsbl_CfgDfiInitComplete(1U);
-		XFsbl_MrsFunc(0xB02U, ActiveRanks, 0U);
-		XFsbl_CfgSwInitInt(0U);
+		for (Block = 0U; Block < 2U; Block++) {
+			for (Offset = 0U; Offset < XFSBL_DDR_TRAIN_TEST_SIZE;
+			     Offset += 8U) {
+				Addr = Blocks[Block] + Offset;
+				Diff = Xil_In64(Addr) ^
+				       XFsbl_DdrTrainPattern(Pass, Addr);
+				if (Diff == 0U) {
+					continue;
+				}
+				ByteLanes = 0U;
+				for (Byte = 0U; Byte < 8U; Byte++) {
+					if (((Diff >> (Byte * 8U)) & 0xFFU) !=
+					    0U) {
+						ByteLanes |= 1U << Byte;
+					}
+				}
+				XFsbl_Printf(DEBUG_GENERAL,
+					     "DDR pattern %u failed at 0x%x, "
+					     "bytes 0x%x\n\r",
+					     Pass, (u32)Addr, ByteLanes);
+				goto END;
+			}
+		}
 	}
 
-	if ((PDimmPtr->MemType == SPD_MEMTYPE_LPDDR4) &&
-	    (PDimmPtr->Lp4catrain == 1U)) {
-		XFSBL_PROG_REG(DDRC_SWCTL_OFFSET, DDRC_SWCTL_SW_DONE_MASK,
-			       DDRC_SWCTL_SW_DONE_SHIFT, 1U);
-		XFSBL_PROG_REG(DDRC_DFIUPD0_OFFSET,
-			       DDRC_DFIUPD0_DIS_AUTO_CTRLUPD_MASK,
-			       DDRC_DFIUPD0_DIS_AUTO_CTRLUPD_SHIFT, 1U);
-		XFSBL_PROG_REG(DDRC_RFSHCTL3_OFFSET,
-			       DDRC_RFSHCTL3_DIS_AUTO_REFRESH_MASK,
-			       DDRC_RFSHCTL3_DIS_AUTO_REFRESH_SHIFT, 1U);
-		XFSBL_PROG_REG(DDRC_ZQCTL0_OFFSET, DDRC_ZQCTL0_DIS_AUTO_ZQ_MASK,
-			       DDRC_ZQCTL0_DIS_AUTO_ZQ_SHIFT, 1U);
-		XFSBL_PROG_REG(DDRC_RFSHCTL3_OFFSET,
-			       DDRC_RFSHCTL3_DIS_AUTO_REFRESH_MASK,
-			       DDRC_RFSHCTL3_DIS_AUTO_REFRESH_SHIFT, 0U);
-		XFSBL_PROG_REG(DDRC_ZQCTL0_OFFSET, DDRC_ZQCTL0_DIS_AUTO_ZQ_MASK,
-			       DDRC_ZQCTL0_DIS_AUTO_ZQ_SHIFT, 0U);
-	}
+	Status = XFSBL_SUCCESS;
+END:
+	return Status;
+}
+#endif
 
-	XFSBL_PROG_REG(DDR_PHY_PGCR1_OFFSET, DDR_PHY_PGCR1_PUBMODE_MASK,
-		       DDR_PHY_PGCR1_PUBMODE_SHIFT, 1U);
+/*****************************************************************************/
+/**
+ * This function trains the DDR with the PHY in PUB mode: write leveling,
+ * gate, eye and optionally deskew training, then the VREF training
+ *
+ * @param	PDimmPtr is pointer to DDR parameters structure
+ *
+ * @return	Returns XFSBL_SUCCESS or XFSBL_FAILURE
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrcPhyTrainSteps(XFsbl_DimmParams *PDimmPtr)
+{
+	u32 PollVal = 0U;
+	u32 CurTRefPrd;
+	u32 RegVal = 0U;
+	u32 Status = XFSBL_FAILURE;
 
 	if ((PDimmPtr->MemType == SPD_MEMTYPE_DDR3) ||
 	    (PDimmPtr->MemType == SPD_MEMTYPE_DDR4)) {
@@ -6218,21 +6425,27 @@ static u32 XFsbl_DdrcPhyTraining(struct DdrcInitData *DdrDataPtr)
 	}
 
 	if (PDimmPtr->MemType != SPD_MEMTYPE_LPDDR4) {
-		RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
-		while (RegVal != PollVal) {
-			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
+		Status = XFSBL_POLL_VAL(RegVal, DDR_PHY_PGSR0_OFFSET,
+					RegVal == PollVal);
+		if (Status != XFSBL_SUCCESS) {
+			goto END;
 		}
 	} else {
-		while (RegVal != 0x8000007EU)
-			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
+		Status = XFSBL_POLL_VAL(RegVal, DDR_PHY_PGSR0_OFFSET,
+					RegVal == 0x8000007EU);
+		if (Status != XFSBL_SUCCESS) {
+			goto END;
+		}
 
 		RegVal = Xil_In32(XFSBL_DDRPHY_BASE_ADDR + 0x200U);
 		RegVal &= ~(0xFU << 28U);
 		Xil_Out32(XFSBL_DDRPHY_BASE_ADDR + 0x200U, RegVal);
 
-		RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
-		while (RegVal != PollVal)
-			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
+		Status = XFSBL_POLL_VAL(RegVal, DDR_PHY_PGSR0_OFFSET,
+					RegVal == PollVal);
+		if (Status != XFSBL_SUCCESS) {
+			goto END;
+		}
 
 		RegVal &= ~(0xFU << 28U);
 		RegVal |= (0x8U << 28U);
@@ -6281,9 +6494,11 @@ static u32 XFsbl_DdrcPhyTraining(struct DdrcInitData *DdrDataPtr)
 			       DDR_PHY_DX8SL4DXCTL2_RDMODE_SHIFT, 3U);
 
 		Xil_Out32(DDR_PHY_PIR_OFFSET, 0x00060001U);
-		RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
-		while ((RegVal & 0x80004001U) != 0x80004001U)
-			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
+		Status = XFSBL_POLL(DDR_PHY_PGSR0_OFFSET, 0x80004001U,
+				    0x80004001U);
+		if (Status != XFSBL_SUCCESS) {
+			goto END;
+		}
 
 		XFSBL_PROG_REG(DDR_PHY_PGCR3_OFFSET, DDR_PHY_PGCR3_RDMODE_MASK,
 			       DDR_PHY_PGCR3_RDMODE_SHIFT, 0U);
@@ -6312,9 +6527,294 @@ static u32 XFsbl_DdrcPhyTraining(struct DdrcInitData *DdrDataPtr)
 			       DDR_PHY_PGCR2_TREFPRD_SHIFT, CurTRefPrd);
 
 		Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0000C001U);
-		RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
-		while ((RegVal & 0x80000C01U) != 0x80000C01U)
-			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
+		Status = XFSBL_POLL(DDR_PHY_PGSR0_OFFSET, 0x80000C01U,
+				    0x80000C01U);
+		if (Status != XFSBL_SUCCESS) {
+			goto END;
+		}
+	}
+
+	Status = XFSBL_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function performs the DDR/PHY training sequence to initialize the DDR
+ *
+ * @param	DdrDataPtr is pointer to DDR Initialization Data Structure
+ * @param	Restore is 1 to restore the saved training instead of training,
+ *		it is cleared when the DDR is trained
+ *
+ * @return	Returns XFSBL_SUCCESS or XFSBL_FAILURE
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrcPhyTraining(struct DdrcInitData *DdrDataPtr, u32 *Restore)
+{
+	XFsbl_DimmParams *PDimmPtr = &DdrDataPtr->PDimm;
+	u32 ActiveRanks;
+	u32 RegVal = 0U;
+	u32 PllRetry = 100U;
+	u32 PllLocked = 0U;
+	u32 Puad;
+	u32 Status = XFSBL_FAILURE;
+
+	ActiveRanks = Xil_In32(XFSBL_DDRC_BASE_ADDR + 0x0000U);
+
+	while ((PllRetry > 0U) && (!PllLocked)) {
+		if ((PllRetry % 10U) == 0U) {
+			Xil_Out32(DDR_PHY_PIR_OFFSET, 0x00040010U);
+			Xil_Out32(DDR_PHY_PIR_OFFSET, 0x00040011U);
+		}
+
+		/* A PHY which does not finish its init is not locked */
+		if (XFSBL_POLL(DDR_PHY_PGSR0_OFFSET, 0x1U, 0x1U) !=
+		    XFSBL_SUCCESS) {
+			PllRetry--;
+			continue;
+		}
+
+		PllLocked =
+			(Xil_In32(DDR_PHY_PGSR0_OFFSET) & 0x80000000U) >> 31U;
+		PllLocked &=
+			(Xil_In32(DDR_PHY_DX0GSR0_OFFSET) & 0x10000U) >> 16U;
+		PllLocked &=
+			(Xil_In32(DDR_PHY_DX2GSR0_OFFSET) & 0x10000U) >> 16U;
+
+		if (PDimmPtr->BusWidth == 64U) {
+			PllLocked &=
+				(Xil_In32(DDR_PHY_DX4GSR0_OFFSET) & 0x10000U) >>
+				16U;
+			PllLocked &=
+				(Xil_In32(DDR_PHY_DX6GSR0_OFFSET) & 0x10000U) >>
+				16U;
+		}
+
+		if (PDimmPtr->Ecc) {
+			PllLocked &=
+				(Xil_In32(DDR_PHY_DX8GSR0_OFFSET) & 0x10000U) >>
+				16U;
+		}
+
+		PllRetry--;
+	}
+
+	Xil_Out32(DDR_PHY_GPR1_OFFSET,
+		  Xil_In32(DDR_PHY_GPR1_OFFSET) | (PllRetry << 16U));
+
+	if (PllLocked == 0U) {
+		XFsbl_Printf(DEBUG_INFO, "DDR-PHY Training failed\n\r");
+		/* Do nothing as Status is initialized to XFSBL_FAILURE */
+		goto END;
+	}
+
+	RegVal = ((PDimmPtr->RDimm ? 0x1U : 0x0U) << 19U) | (0x1U << 18U) |
+		 0x73U;
+
+	/* Now PLL lock is done, resume with other training */
+	RegVal = RegVal & ~DDR_PHY_PIR_PLLINIT_MASK;
+
+	/* End of pll lock retry */
+
+	Xil_Out32(XFSBL_DDRPHY_BASE_ADDR + 0x4U, RegVal);
+
+	if (PDimmPtr->PllByp) {
+		XFsbl_DdrPllBypass(1U);
+	}
+
+	Status = XFSBL_POLL(DDR_PHY_PGSR0_OFFSET, 0xFU, 0xFU);
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_INIT_MASK,
+		       DDR_PHY_PIR_INIT_SHIFT, 1U);
+	Status = XFSBL_POLL(DDR_PHY_PGSR0_OFFSET, 0xFFU, 0x1FU);
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	if (PDimmPtr->MemType == SPD_MEMTYPE_LPDDR4) {
+		XFsbl_CfgSwInitInt(1U);
+		XFsbl_CfgDfiInitComplete(1U);
+		XFsbl_MrsFunc(0x331U, ActiveRanks, 0U);
+		XFsbl_MrsFunc(0xB36U, ActiveRanks, 0U);
+		if ((PDimmPtr->Zc1656) || (PDimmPtr->HasEccComp)) {
+			XFsbl_MrsFunc(0xC4DU, ActiveRanks, 0U);
+			if (PDimmPtr->Lp4NoOdt) {
+				XFsbl_MrsFunc(0xE6EU, ActiveRanks, 0U);
+			} else {
+				XFsbl_MrsFunc(0xE1EU, ActiveRanks, 0U);
+			}
+			XFsbl_MrsFunc(0x1606U, ActiveRanks, 0U);
+		} else {
+			XFsbl_MrsFunc(0xC21U, ActiveRanks, 0U);
+
+			if (PDimmPtr->Lp4NoOdt) {
+				XFsbl_MrsFunc(0xE6FU, ActiveRanks, 0U);
+			} else {
+				XFsbl_MrsFunc(0xE19U, ActiveRanks, 0U);
+			}
+			XFsbl_MrsFunc(0x1616U, ActiveRanks, 0U);
+		}
+		XFsbl_CfgSwInitInt(0U);
+	}
+
+	if ((PDimmPtr->MemType == SPD_MEMTYPE_DDR4) && PDimmPtr->RDimm) {
+		XFsbl_CfgSwInitInt(1U);
+		XFsbl_CfgDfiInitComplete(1U);
+
+		if (PDimmPtr->Parity)
+			XFsbl_MrsFunc(0x88U, 1U, 7U);
+		if (PDimmPtr->AddrMirror)
+			XFsbl_MrsFunc(0xD8U, 1U, 7U);
+		if (PDimmPtr->DisOpInv)
+			XFsbl_MrsFunc(0x01U, 1U, 7U);
+		if (PDimmPtr->SpeedBin == 1866U)
+			XFsbl_MrsFunc(0xA1U, 1U, 7U);
+		if (PDimmPtr->SpeedBin == 2133U)
+			XFsbl_MrsFunc(0xA2U, 1U, 7U);
+		if (PDimmPtr->SpeedBin == 2400U)
+			XFsbl_MrsFunc(0xA3U, 1U, 7U);
+		if (PDimmPtr->SpeedBin == 2666U)
+			XFsbl_MrsFunc(0xA4U, 1U, 7U);
+
+		XFsbl_CfgSwInitInt(0U);
+	}
+
+	RegVal = Xil_In32(XFSBL_DDRC_BASE_ADDR + 0x1B0U);
+	RegVal |= (0x1U << 0U);
+	Xil_Out32(XFSBL_DDRC_BASE_ADDR + 0x1B0U, RegVal);
+
+	Xil_Out32(XFSBL_DDRC_BASE_ADDR + 0x320U, 0x1U);
+
+	Status = XFSBL_POLL(DDRC_STAT_OFFSET, 0xFU, 1U);
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	if (PDimmPtr->Slowboot == 1U) {
+		XFSBL_PROG_REG(DDRC_DFIMISC_OFFSET,
+			       DDRC_DFIMISC_DFI_INIT_COMPLETE_EN_MASK,
+			       DDRC_DFIMISC_DFI_INIT_COMPLETE_EN_SHIFT, 0U);
+
+		XFSBL_PROG_REG(DDR_PHY_PGCR1_OFFSET, DDR_PHY_PGCR1_PUBMODE_MASK,
+			       DDR_PHY_PGCR1_PUBMODE_SHIFT, 0x1U);
+		XFSBL_PROG_REG(DDR_PHY_PGCR6_OFFSET, DDR_PHY_PGCR6_INHVT_MASK,
+			       DDR_PHY_PGCR6_INHVT_SHIFT, 0x1U);
+		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_DCALPSE_MASK,
+			       DDR_PHY_PIR_DCALPSE_SHIFT, 0x1U);
+		XFSBL_PROG_REG(DDR_PHY_SCHCR1_OFFSET,
+			       DDR_PHY_SCHCR1_ALLRANK_MASK,
+			       DDR_PHY_SCHCR1_ALLRANK_SHIFT, 0x1U);
+		XFSBL_PROG_REG(DDR_PHY_SCHCR0_OFFSET, DDR_PHY_SCHCR0_CMD_MASK,
+			       DDR_PHY_SCHCR0_CMD_SHIFT, 0x7U);
+		XFSBL_PROG_REG(DDR_PHY_SCHCR0_OFFSET,
+			       DDR_PHY_SCHCR0_SP_CMD_MASK,
+			       DDR_PHY_SCHCR0_SP_CMD_SHIFT, 0x2U);
+		XFSBL_PROG_REG(DDR_PHY_SCHCR0_OFFSET,
+			       DDR_PHY_SCHCR0_SCHTRIG_MASK,
+			       DDR_PHY_SCHCR0_SCHTRIG_SHIFT, 0x1U);
+
+		Xil_Out32(DDR_PHY_PLLCR0_OFFSET,
+			  Xil_In32(DDR_PHY_PLLCR0_OFFSET));
+		Xil_Out32(DDR_PHY_DX8SL0PLLCR0_OFFSET,
+			  Xil_In32(DDR_PHY_DX8SL0PLLCR0_OFFSET));
+		Xil_Out32(DDR_PHY_DX8SL1PLLCR0_OFFSET,
+			  Xil_In32(DDR_PHY_DX8SL1PLLCR0_OFFSET));
+		Xil_Out32(DDR_PHY_DX8SL2PLLCR0_OFFSET,
+			  Xil_In32(DDR_PHY_DX8SL2PLLCR0_OFFSET));
+		Xil_Out32(DDR_PHY_DX8SL3PLLCR0_OFFSET,
+			  Xil_In32(DDR_PHY_DX8SL3PLLCR0_OFFSET));
+		Xil_Out32(DDR_PHY_DX8SL4PLLCR0_OFFSET,
+			  Xil_In32(DDR_PHY_DX8SL4PLLCR0_OFFSET));
+		Xil_Out32(DDR_PHY_DX8SLBPLLCR0_OFFSET,
+			  Xil_In32(DDR_PHY_DX8SLBPLLCR0_OFFSET));
+
+		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_DCALPSE_MASK,
+			       DDR_PHY_PIR_DCALPSE_SHIFT, 0U);
+
+		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_CTLDINIT_MASK,
+			       DDR_PHY_PIR_CTLDINIT_SHIFT, 1U);
+		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_PHYRST_MASK,
+			       DDR_PHY_PIR_PHYRST_SHIFT, 1U);
+		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_DCAL_MASK,
+			       DDR_PHY_PIR_DCAL_SHIFT, 1U);
+		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_PLLINIT_MASK,
+			       DDR_PHY_PIR_PLLINIT_SHIFT, 1U);
+		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_INIT_MASK,
+			       DDR_PHY_PIR_INIT_SHIFT, 1U);
+
+		Status = XFSBL_POLL(DDR_PHY_PGSR0_OFFSET, 0xFU, 0xFU);
+		if (Status != XFSBL_SUCCESS) {
+			goto END;
+		}
+
+		XFSBL_PROG_REG(DDR_PHY_PIR_OFFSET, DDR_PHY_PIR_INIT_MASK,
+			       DDR_PHY_PIR_INIT_SHIFT, 1U);
+		Status = XFSBL_POLL(DDR_PHY_PGSR0_OFFSET, 0xFFU, 0x1FU);
+		if (Status != XFSBL_SUCCESS) {
+			goto END;
+		}
+
+		XFSBL_PROG_REG(DDR_PHY_PGCR6_OFFSET, DDR_PHY_PGCR6_INHVT_MASK,
+			       DDR_PHY_PGCR6_INHVT_SHIFT, 0x0U);
+
+		XFSBL_PROG_REG(DDR_PHY_SCHCR1_OFFSET,
+			       DDR_PHY_SCHCR1_ALLRANK_MASK,
+			       DDR_PHY_SCHCR1_ALLRANK_SHIFT, 0x1U);
+		XFSBL_PROG_REG(DDR_PHY_SCHCR0_OFFSET, DDR_PHY_SCHCR0_CMD_MASK,
+			       DDR_PHY_SCHCR0_CMD_SHIFT, 0x7U);
+		XFSBL_PROG_REG(DDR_PHY_SCHCR0_OFFSET,
+			       DDR_PHY_SCHCR0_SP_CMD_MASK,
+			       DDR_PHY_SCHCR0_SP_CMD_SHIFT, 0x3U);
+		XFSBL_PROG_REG(DDR_PHY_SCHCR0_OFFSET,
+			       DDR_PHY_SCHCR0_SCHTRIG_MASK,
+			       DDR_PHY_SCHCR0_SCHTRIG_SHIFT, 0x1U);
+	}
+
+	if (PDimmPtr->MemType == SPD_MEMTYPE_LPDDR3) {
+		XFsbl_CfgSwInitInt(1U);
+		XFsbl_CfgDfiInitComplete(1U);
+		XFsbl_MrsFunc(0xB02U, ActiveRanks, 0U);
+		XFsbl_CfgSwInitInt(0U);
+	}
+
+	if ((PDimmPtr->MemType == SPD_MEMTYPE_LPDDR4) &&
+	    (PDimmPtr->Lp4catrain == 1U)) {
+		XFSBL_PROG_REG(DDRC_SWCTL_OFFSET, DDRC_SWCTL_SW_DONE_MASK,
+			       DDRC_SWCTL_SW_DONE_SHIFT, 1U);
+		XFSBL_PROG_REG(DDRC_DFIUPD0_OFFSET,
+			       DDRC_DFIUPD0_DIS_AUTO_CTRLUPD_MASK,
+			       DDRC_DFIUPD0_DIS_AUTO_CTRLUPD_SHIFT, 1U);
+		XFSBL_PROG_REG(DDRC_RFSHCTL3_OFFSET,
+			       DDRC_RFSHCTL3_DIS_AUTO_REFRESH_MASK,
+			       DDRC_RFSHCTL3_DIS_AUTO_REFRESH_SHIFT, 1U);
+		XFSBL_PROG_REG(DDRC_ZQCTL0_OFFSET, DDRC_ZQCTL0_DIS_AUTO_ZQ_MASK,
+			       DDRC_ZQCTL0_DIS_AUTO_ZQ_SHIFT, 1U);
+		XFSBL_PROG_REG(DDRC_RFSHCTL3_OFFSET,
+			       DDRC_RFSHCTL3_DIS_AUTO_REFRESH_MASK,
+			       DDRC_RFSHCTL3_DIS_AUTO_REFRESH_SHIFT, 0U);
+		XFSBL_PROG_REG(DDRC_ZQCTL0_OFFSET, DDRC_ZQCTL0_DIS_AUTO_ZQ_MASK,
+			       DDRC_ZQCTL0_DIS_AUTO_ZQ_SHIFT, 0U);
+	}
+
+#ifdef XFSBL_DDR_TRAIN_CACHE
+	if (*Restore != 0U) {
+		*Restore = XFsbl_DdrTrainRestore(PDimmPtr);
+	}
+#endif
+
+	XFSBL_PROG_REG(DDR_PHY_PGCR1_OFFSET, DDR_PHY_PGCR1_PUBMODE_MASK,
+		       DDR_PHY_PGCR1_PUBMODE_SHIFT, 1U);
+
+	if (*Restore == 0U) {
+		Status = XFsbl_DdrcPhyTrainSteps(PDimmPtr);
+		if (Status != XFSBL_SUCCESS) {
+			goto END;
+		}
 	}
 
 	if (PDimmPtr->Slowboot == 1U) {
@@ -6989,19 +7489,21 @@ END:
 
 /*****************************************************************************/
 /**
- * This function checks for the DDR SPD data and Initializes the same based on
- * configuration parameters obtained from SPD data.
+ * This function initializes the DDR controller and the PHY for a DIMM and
+ * trains the DDR, or restores its saved training
  *
- * @param	None
+ * @param	SpdData is the SPD of the DIMM
+ * @param	Restore is 1 to restore the saved training instead of training,
+ *		it is cleared when the DDR is trained
  *
  * @return	returns the error codes described in xfsbl_error.h on any error
  *			returns XFSBL_SUCCESS on success
  *
  *****************************************************************************/
-u32 XFsbl_DdrInit(void)
+static u32 XFsbl_DdrInitDimm(u8 *SpdData, u32 *Restore)
 {
 	u32 Status;
-	u8 SpdData[512U];
+	XTime TrainingStart;
 #if !(defined(XPS_BOARD_ZCU102) || defined(XPS_BOARD_ZCU106) ||                \
       defined(XPS_BOARD_ZCU111) || defined(XPS_BOARD_ZCU216) ||                \
       defined(XPS_BOARD_ZCU208) || defined(XPS_BOARD_ZCU670)) ||               \
@@ -7015,13 +7517,6 @@ u32 XFsbl_DdrInit(void)
 		.AddrMapRowBits2To10 = 0x0U,
 	};
 
-	/* Get the Model Part Number from the SPD stored in EEPROM */
-	Status = XFsbl_IicReadSpdEeprom(SpdData);
-	if (Status != XFSBL_SUCCESS) {
-		Status = XFSBL_FAILURE;
-		goto END;
-	}
-
 #if defined(XPS_BOARD_ZCU102) || defined(XPS_BOARD_ZCU106) ||                  \
 	defined(XPS_BOARD_ZCU111) || defined(XPS_BOARD_ZCU216) ||              \
 	defined(XPS_BOARD_ZCU208) || defined(XPS_BOARD_ZCU670)
@@ -7069,13 +7564,14 @@ u32 XFsbl_DdrInit(void)
 	}
 #endif
 
+	TrainingStart = XFsbl_PerfNow();
 #ifdef XFSBL_ENABLE_DDR_SR
 	/* Check if DDR is in self refresh mode */
 	RegVal = Xil_In32(XFSBL_DDR_STATUS_REGISTER_OFFSET) &
 		 DDR_STATUS_FLAG_MASK;
 	if (!RegVal) {
 		/* Execute the Training Sequence */
-		Status = XFsbl_DdrcPhyTraining(&DdrData);
+		Status = XFsbl_DdrcPhyTraining(&DdrData, Restore);
 		if (Status != XFSBL_SUCCESS) {
 			Status = XFSBL_FAILURE;
 			goto END;
@@ -7083,16 +7579,75 @@ u32 XFsbl_DdrInit(void)
 	}
 #else
 	/* Execute the Training Sequence */
-	Status = XFsbl_DdrcPhyTraining(&DdrData);
+	Status = XFsbl_DdrcPhyTraining(&DdrData, Restore);
 	if (Status != XFSBL_SUCCESS) {
 		Status = XFSBL_FAILURE;
 		goto END;
 	}
 #endif
+	XFsbl_PerfRecord(XFSBL_PERF_EVENT_DDR_TRAINING, *Restore, TrainingStart,
+			 0U);
+
+#ifdef XFSBL_DDR_TRAIN_CACHE
+	if (*Restore == 0U) {
+		XFsbl_DdrTrainSave(&DdrData.PDimm, SpdData);
+	}
+#endif
 
 	Status = XFSBL_SUCCESS;
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * This function checks for the DDR SPD data and Initializes the same based on
+ * configuration parameters obtained from SPD data.
+ *
+ * @param	None
+ *
+ * @return	returns the error codes described in xfsbl_error.h on any error
+ *			returns XFSBL_SUCCESS on success
+ *
+ *****************************************************************************/
+u32 XFsbl_DdrInit(void)
+{
+	u32 Status;
+	u8 SpdData[512U];
+	u32 Restore = 0U;
+
+	/* Get the Model Part Number from the SPD stored in EEPROM */
+	Status = XFsbl_IicReadSpdEeprom(SpdData);
+	if (Status != XFSBL_SUCCESS) {
+		Status = XFSBL_FAILURE;
+		goto END;
+	}
+
+#ifdef XFSBL_DDR_TRAIN_CACHE
+	Restore = XFsbl_DdrTrainLookup(SpdData);
+#endif
+
+	Status = XFsbl_DdrInitDimm(SpdData, &Restore);
+
+#ifdef XFSBL_DDR_TRAIN_CACHE
+	/* Train the DDR from its reset if the restored training fails */
+	if (Restore != 0U) {
+		if (Status == XFSBL_SUCCESS) {
+			Status = XFsbl_DdrTrainTest();
+		}
+		if (Status != XFSBL_SUCCESS) {
+			XFsbl_Printf(DEBUG_GENERAL,
+				     "Restored DDR training failed, "
+				     "training the DDR\n\r");
+			XFsbl_DdrTrainInvalidate();
+			Restore = 0U;
+			Status = XFsbl_DdrInitDimm(SpdData, &Restore);
+		}
+	}
+#endif
+
+END:
+	return Status;
+}
 #endif /* XPAR_DYNAMIC_DDR_ENABLED */
 #endif /* XFSBL_PS_DDR */
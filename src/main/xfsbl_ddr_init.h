@@ -26,6 +26,7 @@
  * 3.0   bsv  11/12/19 Added support for ZCU216 board
  *       mn   12/24/19 Enable Address Mirroring based on SPD data
  *       bsv  02/05/20 Added support for ZCU208 board
+ * 4.0   dd   10/16/26 Added the TPRD field of DXnMDLR0
  *
  * </pre>
  *
@@ -376,6 +377,9 @@ extern "C" {
 #define DDR_PHY_DXMDLR0_IPRD_SHIFT   0U
 #define DDR_PHY_DXMDLR0_IPRD_MASK    0x000001FFU
 
+#define DDR_PHY_DXMDLR0_TPRD_SHIFT   16U
+#define DDR_PHY_DXMDLR0_TPRD_MASK    0x01FF0000U
+
 #define DDR_PHY_PIR_DQS2DQ_SHIFT   20U
 #define DDR_PHY_PIR_DQS2DQ_MASK    0x00100000U
 
@@ -18,6 +18,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00a kc	11/05/13 Initial release
 * 2.0   bv   12/05/16 Made compliance to MISRAC 2012 guidelines
+* 3.0   dd   10/16/26 Added tokenized prints
 *
 * </pre>
 *
@@ -36,6 +37,15 @@ extern "C" {
 #include "xil_printf.h"
 #include "xfsbl_config.h"
 #include "xil_types.h"
+
+/**
+ * Definition for tokenized prints to be included, here rather than in
+ * xfsbl_hw.h as XFsbl_Printf depends on it
+ */
+#if !defined(FSBL_LOG_TOKENS_EXCLUDE)
+#define XFSBL_LOG_TOKENS
+#include "xfsbl_log_token.h"
+#endif
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
@@ -67,8 +77,13 @@ extern "C" {
 #else
 #define XFsblDbgCurrentTypes (0U)
 #endif
+#ifdef XFSBL_LOG_TOKENS
+#define XFsbl_Printf(DebugType,...) \
+		if(((DebugType) & XFsblDbgCurrentTypes)!=XFSBL_SUCCESS) {XFSBL_LOG_TOKENIZED(__VA_ARGS__); }
+#else
 #define XFsbl_Printf(DebugType,...) \
 		if(((DebugType) & XFsblDbgCurrentTypes)!=XFSBL_SUCCESS) {xil_printf (__VA_ARGS__); }
+#endif
 
 #ifdef __cplusplus
 }
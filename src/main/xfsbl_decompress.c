@@ -0,0 +1,401 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_decompress.c
+ *
+ * This is the file which contains the streaming decoder for compressed
+ * partitions. The stored stream is read in staging buffer sized chunks and
+ * every block is decoded straight to the destination.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xfsbl_decompress.h"
+
+/************************** Constant Definitions *****************************/
+#define XFSBL_LZ4_MIN_MATCH (4U)
+#define XFSBL_LZ4_LENGTH_MASK (0xFU)
+#define XFSBL_LZ4_LENGTH_SHIFT (4U)
+#define XFSBL_LZ4_LENGTH_MORE (255U)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+  const XFsblPs_DecompSource* Source;
+  XFsblPs_DecompStats* Stats;
+  u32 Offset; /**< Next stored byte to read from the source */
+  u32 Pos;    /**< Next unconsumed byte in the staging buffer */
+  u32 Fill;   /**< End of the valid bytes in the staging buffer */
+} XFsblPs_DecompReader;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+
+static u32 XFsbl_DecompLe32(const u8* Buf) {
+  return (u32)Buf[0] | ((u32)Buf[1] << 8U) | ((u32)Buf[2] << 16U) |
+         ((u32)Buf[3] << 24U);
+}
+
+static void XFsbl_DecompCopy(u8* Dest, const u8* Src, u32 Length) {
+  while (Length != 0U) {
+    *Dest = *Src;
+    Dest++;
+    Src++;
+    Length--;
+  }
+}
+
+static void XFsbl_DecompMove(u8* Dest, const u8* Src, u32 Length) {
+  if (Dest <= Src) {
+    XFsbl_DecompCopy(Dest, Src, Length);
+    return;
+  }
+
+  while (Length != 0U) {
+    Length--;
+    Dest[Length] = Src[Length];
+  }
+}
+
+static void XFsbl_DecompZero(u8* Dest, u32 Length) {
+  while ((Length != 0U) && (((UINTPTR)Dest & (sizeof(u64) - 1U)) != 0U)) {
+    *Dest = 0U;
+    Dest++;
+    Length--;
+  }
+
+  u64* Dest64 = (u64*)Dest;
+  while (Length >= sizeof(u64)) {
+    *Dest64 = 0U;
+    Dest64++;
+    Length -= sizeof(u64);
+  }
+
+  Dest = (u8*)Dest64;
+  while (Length != 0U) {
+    *Dest = 0U;
+    Dest++;
+    Length--;
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function makes sure the staging buffer holds Needed unconsumed bytes.
+ * The unconsumed bytes are moved just below an aligned position and the
+ * source is read from there up to the end of the staging buffer.
+ *
+ * @param	Reader is the stream reader
+ * @param	Needed is the number of bytes the caller consumes next
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns XFSBL_ERROR_DECOMPRESSION if the stream is truncated
+ * 		returns the source read status on read failure
+ *
+ *****************************************************************************/
+static u32 XFsbl_DecompFill(XFsblPs_DecompReader* Reader, u32 Needed) {
+  const XFsblPs_DecompSource* Source = Reader->Source;
+  const u32 Left = Reader->Fill - Reader->Pos;
+
+  if (Left >= Needed) {
+    return XFSBL_SUCCESS;
+  }
+
+  const u32 ReadPos =
+      (Left + XFSBL_DECOMP_READ_ALIGN - 1U) & ~(XFSBL_DECOMP_READ_ALIGN - 1U);
+  if (ReadPos > Source->StagingSize) {
+    return XFSBL_ERROR_DECOMPRESSION;
+  }
+
+  u32 Length = Source->StagingSize - ReadPos;
+  if (Length > (Source->Length - Reader->Offset)) {
+    Length = Source->Length - Reader->Offset;
+  }
+  if (Length < (Needed - Left)) {
+    return XFSBL_ERROR_DECOMPRESSION;
+  }
+
+  XFsbl_DecompMove(&Source->Staging[ReadPos - Left],
+                   &Source->Staging[Reader->Pos], Left);
+
+  const u32 Status = Source->Read(Source->Context, Reader->Offset,
+                                  &Source->Staging[ReadPos], Length);
+  if (Status != XFSBL_SUCCESS) {
+    return Status;
+  }
+
+  Reader->Offset += Length;
+  Reader->Pos = ReadPos - Left;
+  Reader->Fill = ReadPos + Length;
+  Reader->Stats->Reads++;
+  Reader->Stats->InputBytes += Length;
+
+  return XFSBL_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function validates a stream header and returns its lengths
+ *
+ * @param	Header is the first XFSBL_DECOMP_HDR_LEN bytes of the stream
+ * @param	DecompLength is updated with the decompressed length
+ * @param	MaxBlockLength is updated with the largest block payload
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns XFSBL_ERROR_DECOMPRESSION on an invalid header
+ *
+ *****************************************************************************/
+u32 XFsbl_DecompGetLength(const u8* Header, u32* DecompLength,
+                          u32* MaxBlockLength) {
+  if ((XFsbl_DecompLe32(&Header[0U]) != XFSBL_DECOMP_MAGIC) ||
+      (XFsbl_DecompLe32(&Header[12U]) != 0U)) {
+    return XFSBL_ERROR_DECOMPRESSION;
+  }
+
+  *DecompLength = XFsbl_DecompLe32(&Header[4U]);
+  *MaxBlockLength = XFsbl_DecompLe32(&Header[8U]);
+
+  return XFSBL_SUCCESS;
+}
+
+static u32 XFsbl_Lz4ReadLength(const u8** SrcPtr, const u8* SrcEnd,
+                               u32* Length) {
+  const u8* Src = *SrcPtr;
+  u32 Byte;
+
+  do {
+    if ((Src == SrcEnd) || (*Length > XFSBL_DECOMP_BLOCK_LEN_MASK)) {
+      return XFSBL_ERROR_DECOMPRESSION;
+    }
+    Byte = *Src;
+    Src++;
+    *Length += Byte;
+  } while (Byte == XFSBL_LZ4_LENGTH_MORE);
+
+  *SrcPtr = Src;
+
+  return XFSBL_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function decodes one independent LZ4 block. Every literal run and
+ * match is bounds checked, so a corrupt block can not write outside of
+ * Dest or read outside of Src.
+ *
+ * @param	Src is the LZ4 block
+ * @param	SrcLength is the length of the LZ4 block
+ * @param	Dest is the destination
+ * @param	DestLength is the exact decoded length of the block
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns XFSBL_ERROR_DECOMPRESSION on a corrupt block
+ *
+ *****************************************************************************/
+u32 XFsbl_Lz4DecodeBlock(const u8* Src, u32 SrcLength, u8* Dest,
+                         u32 DestLength) {
+  const u8* const SrcEnd = &Src[SrcLength];
+  u32 Out = 0U;
+
+  while (Src != SrcEnd) {
+    const u32 Token = *Src;
+    Src++;
+
+    /* Literal run */
+    u32 Length = Token >> XFSBL_LZ4_LENGTH_SHIFT;
+    if ((Length == XFSBL_LZ4_LENGTH_MASK) &&
+        (XFsbl_Lz4ReadLength(&Src, SrcEnd, &Length) != XFSBL_SUCCESS)) {
+      return XFSBL_ERROR_DECOMPRESSION;
+    }
+    if ((Length > (u32)(SrcEnd - Src)) || (Length > (DestLength - Out))) {
+      return XFSBL_ERROR_DECOMPRESSION;
+    }
+    XFsbl_DecompCopy(&Dest[Out], Src, Length);
+    Src = &Src[Length];
+    Out += Length;
+
+    /* The last sequence has literals only */
+    if (Src == SrcEnd) {
+      break;
+    }
+
+    /* Match, it may overlap the bytes it produces */
+    if ((SrcEnd - Src) < 2) {
+      return XFSBL_ERROR_DECOMPRESSION;
+    }
+    const u32 Offset = (u32)Src[0U] | ((u32)Src[1U] << 8U);
+    Src = &Src[2U];
+    if ((Offset == 0U) || (Offset > Out)) {
+      return XFSBL_ERROR_DECOMPRESSION;
+    }
+
+    Length = Token & XFSBL_LZ4_LENGTH_MASK;
+    if ((Length == XFSBL_LZ4_LENGTH_MASK) &&
+        (XFsbl_Lz4ReadLength(&Src, SrcEnd, &Length) != XFSBL_SUCCESS)) {
+      return XFSBL_ERROR_DECOMPRESSION;
+    }
+    Length += XFSBL_LZ4_MIN_MATCH;
+    if (Length > (DestLength - Out)) {
+      return XFSBL_ERROR_DECOMPRESSION;
+    }
+
+    const u8* Match = &Dest[Out - Offset];
+    u8* Copy = &Dest[Out];
+    Out += Length;
+    while (Length != 0U) {
+      *Copy = *Match;
+      Copy++;
+      Match++;
+      Length--;
+    }
+  }
+
+  if (Out != DestLength) {
+    return XFSBL_ERROR_DECOMPRESSION;
+  }
+
+  return XFSBL_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function decompresses a stored stream to Dest. The stream is read
+ * through the staging buffer, ZERO blocks are filled without reading the
+ * source and only word padding may follow the last block.
+ *
+ * @param	Source describes the stored stream and the staging buffer
+ * @param	Dest is the destination
+ * @param	DestLength is the expected decompressed length
+ * @param	Stats is updated with the decoder counters, may be NULL
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns XFSBL_ERROR_PARTITION_LENGTH if the stream decompresses
+ * 		to a length other than DestLength
+ * 		returns XFSBL_ERROR_DECOMPRESSION on a corrupt stream
+ * 		returns the source read status on read failure
+ *
+ *****************************************************************************/
+u32 XFsbl_Decompress(const XFsblPs_DecompSource* Source, u8* Dest,
+                     u32 DestLength, XFsblPs_DecompStats* Stats) {
+  XFsblPs_DecompStats Counters = {0U};
+  XFsblPs_DecompReader Reader = {Source, &Counters, 0U, 0U, 0U};
+  u32 DecompLength;
+  u32 MaxBlockLength;
+  u32 Out = 0U;
+
+  u32 Status = XFsbl_DecompFill(&Reader, XFSBL_DECOMP_HDR_LEN);
+  if (Status != XFSBL_SUCCESS) {
+    goto END;
+  }
+
+  Status = XFsbl_DecompGetLength(&Source->Staging[Reader.Pos], &DecompLength,
+                                 &MaxBlockLength);
+  if (Status != XFSBL_SUCCESS) {
+    goto END;
+  }
+  Reader.Pos += XFSBL_DECOMP_HDR_LEN;
+
+  if (DecompLength != DestLength) {
+    Status = XFSBL_ERROR_PARTITION_LENGTH;
+    goto END;
+  }
+
+  /* A block and its header must fit behind an aligned read position */
+  if ((Source->StagingSize <
+       (XFSBL_DECOMP_BLOCK_HDR_LEN + XFSBL_DECOMP_READ_ALIGN)) ||
+      (MaxBlockLength > (Source->StagingSize - XFSBL_DECOMP_BLOCK_HDR_LEN -
+                         XFSBL_DECOMP_READ_ALIGN))) {
+    Status = XFSBL_ERROR_DECOMPRESSION;
+    goto END;
+  }
+
+  while (Out < DestLength) {
+    Status = XFsbl_DecompFill(&Reader, XFSBL_DECOMP_BLOCK_HDR_LEN);
+    if (Status != XFSBL_SUCCESS) {
+      goto END;
+    }
+
+    const u32 Word = XFsbl_DecompLe32(&Source->Staging[Reader.Pos]);
+    const u32 Payload = XFsbl_DecompLe32(&Source->Staging[Reader.Pos + 4U]);
+    const u32 Type = Word >> XFSBL_DECOMP_BLOCK_TYPE_SHIFT;
+    const u32 Length = Word & XFSBL_DECOMP_BLOCK_LEN_MASK;
+    Reader.Pos += XFSBL_DECOMP_BLOCK_HDR_LEN;
+
+    if ((Length == 0U) || (Length > (DestLength - Out)) ||
+        (Payload > MaxBlockLength)) {
+      Status = XFSBL_ERROR_DECOMPRESSION;
+      goto END;
+    }
+
+    Status = XFsbl_DecompFill(&Reader, Payload);
+    if (Status != XFSBL_SUCCESS) {
+      goto END;
+    }
+    const u8* Src = &Source->Staging[Reader.Pos];
+
+    switch (Type) {
+    case XFSBL_DECOMP_BLOCK_RAW:
+      if (Payload != Length) {
+        Status = XFSBL_ERROR_DECOMPRESSION;
+        goto END;
+      }
+      XFsbl_DecompCopy(&Dest[Out], Src, Length);
+      break;
+
+    case XFSBL_DECOMP_BLOCK_LZ4:
+      Status = XFsbl_Lz4DecodeBlock(Src, Payload, &Dest[Out], Length);
+      if (Status != XFSBL_SUCCESS) {
+        goto END;
+      }
+      break;
+
+    case XFSBL_DECOMP_BLOCK_ZERO:
+      if (Payload != 0U) {
+        Status = XFSBL_ERROR_DECOMPRESSION;
+        goto END;
+      }
+      XFsbl_DecompZero(&Dest[Out], Length);
+      Counters.ZeroBytes += Length;
+      break;
+
+    default:
+      Status = XFSBL_ERROR_DECOMPRESSION;
+      goto END;
+    }
+
+    Reader.Pos += Payload;
+    Out += Length;
+    Counters.Blocks++;
+  }
+
+  /* Bytes of the stream that were not consumed */
+  if (((Source->Length - Reader.Offset) + (Reader.Fill - Reader.Pos)) >=
+      sizeof(u32)) {
+    Status = XFSBL_ERROR_DECOMPRESSION;
+  }
+
+END:
+  Counters.OutputBytes = Out;
+  if (Stats != NULL) {
+    *Stats = Counters;
+  }
+
+  return Status;
+}
@@ -0,0 +1,103 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_decompress.h
+ *
+ * This is the header file of the streaming decoder for compressed partitions.
+ *
+ * A compressed partition is stored as a stream header followed by blocks:
+ *
+ *   Stream header (16 bytes)
+ *     Magic "XFZ1", decompressed length, largest block payload, reserved
+ *   Block header (8 bytes)
+ *     Type and decompressed length of the block, payload length
+ *   Block payload
+ *     RAW  - the decompressed bytes as they are
+ *     LZ4  - an independent LZ4 block
+ *     ZERO - no payload, the block is filled with zeros
+ *
+ * All fields are little endian. The decoder does not depend on the boot
+ * device, so the host packer and benchmark build it unchanged.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef XFSBL_DECOMPRESS_H
+#define XFSBL_DECOMPRESS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xfsbl_error.h"
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+#define XFSBL_DECOMP_MAGIC (0x315A4658U) /* "XFZ1" */
+#define XFSBL_DECOMP_HDR_LEN (16U)
+#define XFSBL_DECOMP_BLOCK_HDR_LEN (8U)
+
+/* Block header word 0 */
+#define XFSBL_DECOMP_BLOCK_TYPE_SHIFT (28U)
+#define XFSBL_DECOMP_BLOCK_LEN_MASK (0x0FFFFFFFU)
+#define XFSBL_DECOMP_BLOCK_RAW (0x0U)
+#define XFSBL_DECOMP_BLOCK_LZ4 (0x1U)
+#define XFSBL_DECOMP_BLOCK_ZERO (0x2U)
+
+/* Staging buffer reads start on this boundary */
+#define XFSBL_DECOMP_READ_ALIGN (64U)
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Reads Length bytes at Offset of the stored stream into Buffer
+ */
+typedef u32 (*XFsbl_DecompReadFn)(void* Context, u32 Offset, u8* Buffer,
+                                  u32 Length);
+
+typedef struct {
+  XFsbl_DecompReadFn Read; /**< Reader of the stored stream */
+  void* Context;           /**< Passed to Read */
+  u32 Length;              /**< Stored length of the stream in bytes */
+  u8* Staging;             /**< Staging buffer, XFSBL_DECOMP_READ_ALIGN
+                                aligned */
+  u32 StagingSize;         /**< Size of the staging buffer */
+} XFsblPs_DecompSource;
+
+typedef struct {
+  u32 Blocks;      /**< Blocks decoded */
+  u32 Reads;       /**< Reads issued to the source */
+  u32 InputBytes;  /**< Bytes read from the source */
+  u32 OutputBytes; /**< Bytes written to the destination */
+  u32 ZeroBytes;   /**< Bytes of OutputBytes filled locally */
+} XFsblPs_DecompStats;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+u32 XFsbl_DecompGetLength(const u8* Header, u32* DecompLength,
+                          u32* MaxBlockLength);
+u32 XFsbl_Lz4DecodeBlock(const u8* Src, u32 SrcLength, u8* Dest,
+                         u32 DestLength);
+u32 XFsbl_Decompress(const XFsblPs_DecompSource* Source, u8* Dest,
+                     u32 DestLength, XFsblPs_DecompStats* Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_DECOMPRESS_H */
@@ -24,6 +24,12 @@
 * 5.0   ka   04/10/18 Added error codes for user-efuse revocation
 * 6.0   bkm  04/10/18 Added error codes for FMC_VADJ
 * 7.0	bsv	 08/27/19 Added error code for invalid image header size
+* 8.0   dd   10/16/26 Added device copy request status and busy error code
+*       dd   10/16/26 Added compressed partition error codes
+*       dd   10/16/26 Added ZDMA error code
+*       dd   10/16/26 Added CSU SHA3 engine error code
+*       dd   10/16/26 Added poll timeout error code
+*       dd   10/16/26 Device request pending status out of the error codes
 *
 * </pre>
 *
@@ -79,6 +85,8 @@ extern "C" {
 #define STATUS_PARTITION_LOAD_IN_PROGRESS (0x3U)
 #define XFSBL_STATUS_CONTINUE_OTHER_HANDOFF (0x4U)
 #define XFSBL_STATUS_SECONDARY_BOOT_MODE (0x5U)
+/* Above the 16 bit error codes, so that no error is taken for it */
+#define XFSBL_STATUS_DEVICE_REQUEST_PENDING (0x10000U)
 
 #define XFSBL_ERROR_UNSUPPORTED_BOOT_MODE (0x6U)
 #define XFSBL_WDT_INIT_FAILED (0x7U)
@@ -187,6 +195,12 @@ extern "C" {
 #define XFSBL_BITSTREAM_NOT_LOADED (0x77U)
 #define XFSBL_ERROR_SHA2_NOT_SUPPORTED (0x78U)
 #define XFSBL_ERROR_IMAGE_HEADER_SIZE (0x79U)
+#define XFSBL_ERROR_DEVICE_BUSY (0x7AU)
+#define XFSBL_ERROR_DECOMPRESSION (0x7BU)
+#define XFSBL_ERROR_COMPRESSION_NOT_SUPPORTED (0x7CU)
+#define XFSBL_ERROR_ZDMA (0x7DU)
+#define XFSBL_ERROR_CSU_SHA3 (0x7EU)
+#define XFSBL_ERROR_POLL_TIMEOUT (0x7FU)
 #define XFSBL_FAILURE (0x3FFFFFFFU)
 
 /**************************** Type Definitions *******************************/
@@ -26,6 +26,13 @@
  * 3.0   ma   09/09/19 Update FSBL proc info reporting to PMU
  * 4.0   bsv  03/05/19 Restore value of SD_CDN_CTRL register before
  *                     handoff in FSBL
+ * 5.0   dd   10/16/26 Release the boot device before the final handoff
+ *       dd   10/16/26 Added early handoff, the running CPU is handed off
+ *                     after the other CPUs
+ *       dd   10/16/26 Record the handoffs and publish the boot timeline
+ *       dd   10/16/26 Publish the deferred log when the FSBL exits
+ *       dd   10/16/26 Complete or hand over the DDR ECC initialization
+ *                     before a CPU is released
  *
  * </pre>
  *
@@ -35,9 +42,12 @@
 
 /***************************** Include Files *********************************/
 #include "psu_init.h"
+#include "xfsbl_ddr_ecc.h"
 #include "xfsbl_hw.h"
 #include "xfsbl_image_header.h"
+#include "xfsbl_log.h"
 #include "xfsbl_main.h"
+#include "xfsbl_perf.h"
 #include "xil_cache.h"
 
 /************************** Constant Definitions *****************************/
@@ -66,6 +76,12 @@
 #define A53_0_64_HANDOFF_TO_A53_0_32 (0x1U)
 #define A53_0_32_HANDOFF_TO_A53_0_64 (0x2U)
 
+/**
+ * Bit of a destination CPU in the mask of the CPUs released by an early
+ * handoff
+ */
+#define XFSBL_EARLY_HANDOFF_CPU_BIT(CpuId) ((u32)1U << ((CpuId) >> 8U))
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -77,6 +93,12 @@ static void XFsbl_UpdateResetVector(u64 HandOffAddress, u32 CpuSettings,
                                     u32 HandoffType, u32 Vector);
 static u32 XFsbl_Is32BitCpu(u32 CpuSettings);
 static u32 XFsbl_ProtectionConfig(void);
+static u32 XFsbl_HandoffPmInit(u32 EarlyHandoff);
+#ifdef XFSBL_EARLY_HANDOFF
+static u32 XFsbl_CpusOverlap(u32 CpuId, u32 OtherCpuId);
+static u32 XFsbl_EarlyHandoff(const XFsblPs* const FsblInstancePtr,
+                              u32 PartitionNum);
+#endif
 
 /**
  * Functions defined in xfsbl_handoff.S
@@ -87,6 +109,14 @@ extern void XFsbl_Exit(PTRSIZE HandoffAddress, u32 Flags);
 
 extern u32 SdCdnRegVal;
 
+/* PMU firmware configured by XFsbl_PmInit */
+static u32 PmInitDone = FALSE;
+
+#ifdef XFSBL_EARLY_HANDOFF
+/* CPUs released by an early handoff, skipped by the final handoff */
+static u32 EarlyHandoffCpus = 0U;
+#endif
+
 static u32 XFsbl_Is32BitCpu(u32 CpuSettings) {
   u32 Status;
   u32 CpuId;
@@ -586,6 +616,7 @@ void XFsbl_HandoffExit(u64 HandoffAddress, u32 Flags) {
   XFsbl_Out32(PMU_GLOBAL_GLOB_GEN_STORAGE5, RegVal);
 
   XFsbl_Printf(DEBUG_GENERAL, "Exit from FSBL \n\r");
+  XFsbl_LogPublish();
 
   /**
    * Exit to handoff address
@@ -718,131 +749,160 @@ static void XFsbl_UpdateResetVector(u64 HandOffAddress, u32 CpuSettings,
   return;
 }
 
+/****************************************************************************/
+/**
+ * This function releases the CPUs with a handoff address from reset at
+ * their handoff address, and hands off the running CPU last.
+ *
+ * @param FsblInstancePtr is pointer to the XFsbl Instance
+ *
+ * @param PartitionNum is the partition number of the image
+ *
+ * @param EarlyHandoff is TRUE to release only the destination CPU of
+ * 			PartitionNum while the FSBL loads the other partitions
+ *
+ * @return
+ * 		- STATUS_PARTITION_LOAD_IN_PROGRESS after an early handoff
+ * 		- XFSBL_SUCCESS when there is no handoff to the running CPU
+ * 		- error codes on failure
+ *
+ *****************************************************************************/
 u32 XFsbl_HandoffExecute(const XFsblPs* const FsblInstancePtr,
-                         u32 PartitionNum) {
-  u32 CpuIndex = 0U;
+                         u32 PartitionNum, u32 EarlyHandoff) {
+  u32 CpuIndex;
   u32 CpuSettings;
   u32 ExecState;
-  u32 Status;
+  u32 Status = XFSBL_SUCCESS;
   u32 CpuId;
   u64 HandoffAddress;
+  u32 RunningCpuIndex = FsblInstancePtr->HandoffCpuNo;
   const XFsblPs_PartitionHeader* const PartitionHeader =
       &FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
 
-  while (CpuIndex < FsblInstancePtr->HandoffCpuNo) {
+  for (CpuIndex = 0U; CpuIndex < FsblInstancePtr->HandoffCpuNo; CpuIndex++) {
     CpuSettings = FsblInstancePtr->HandoffValues[CpuIndex].CpuSettings;
 
     CpuId = CpuSettings & XIH_PH_ATTRB_DEST_CPU_MASK;
     ExecState = CpuSettings & XIH_PH_ATTRB_A53_EXEC_ST_MASK;
 
+#ifdef XFSBL_EARLY_HANDOFF
     /**
-     * Run the code in this loop in the below conditions:
-     * - HandOffCPU is not the running CPU
+     * An early handoff releases the CPU of the partition just loaded, the
+     * final handoff the CPUs that are not running yet
      */
-    if (CpuId != FsblInstancePtr->ProcessorID) {
-      /* Check if handoff CPU is supported */
-      Status = XFsbl_CheckSupportedCpu(CpuId);
-      if (XFSBL_SUCCESS != Status) {
-        XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_UNAVAILABLE_CPU\n\r");
-        Status = XFSBL_ERROR_UNAVAILABLE_CPU;
-        return Status;
+    if (EarlyHandoff == (u32)TRUE) {
+      if (CpuId != XFsbl_GetDestinationCpu(PartitionHeader)) {
+        continue;
       }
+    } else if ((EarlyHandoffCpus & XFSBL_EARLY_HANDOFF_CPU_BIT(CpuId)) != 0U) {
+      continue;
+    } else {
+      /* for MISRA C compliance */
+    }
+#endif
 
-      /**
-       * Check for power status of the cpu
-       * Update the IVT
-       * Take cpu out of reset
-       */
-      Status = XFsbl_power_up_reset_cpu(CpuSettings, XFSBL_CPU_POWER_UP);
-      if (XFSBL_SUCCESS != Status) {
-        XFsbl_Printf(DEBUG_GENERAL,
-                     "Power Up "
-                     "Cpu 0x%0lx failed \n\r",
-                     CpuId);
-
-        Status = XFSBL_ERROR_PWR_UP_CPU;
-        return Status;
-      }
+    /**
+     * The running CPU is handed off once the others run
+     */
+    if (CpuId == FsblInstancePtr->ProcessorID) {
+      RunningCpuIndex = CpuIndex;
+      continue;
+    }
 
-      HandoffAddress =
-          (u64)FsblInstancePtr->HandoffValues[CpuIndex].HandoffAddress;
-
-      /* Update the handoff address at reset vector address */
-      XFsbl_UpdateResetVector(HandoffAddress, CpuSettings, OTHER_CPU_HANDOFF,
-                              XFsbl_GetVectorLocation(PartitionHeader) >>
-                                  XIH_ATTRB_VECTOR_LOCATION_SHIFT);
-      XFsbl_Printf(
-          DEBUG_INFO,
-          "CPU 0x%0lx reset release, "
-          "Exec State 0x%0lx, "
-          "HandoffAddress: %0lx\n\r",
-          CpuId, ExecState,
-          (PTRSIZE)FsblInstancePtr->HandoffValues[CpuIndex].HandoffAddress);
-
-      /** Take CPU out of reset */
-      Status = XFsbl_power_up_reset_cpu(CpuSettings, XFSBL_CPU_SWRST);
-      if (XFSBL_SUCCESS != Status) {
-        return Status;
-      }
-    } else {
-      /**
-       * Update reset vector address for
-       * - FSBL running on A53-0 (64bit), handoff to
-       * A53-0 (32 bit)
-       * - FSBL running on A53-0 (32bit), handoff to
-       * A53-0 (64 bit)
-       */
-      if ((FsblInstancePtr->A53ExecState == XIH_PH_ATTRB_A53_EXEC_ST_AA64) &&
-          (ExecState == XIH_PH_ATTRB_A53_EXEC_ST_AA32)) {
-        Status = XFSBL_ERROR_UNSUPPORTED_HANDOFF;
-        XFsbl_Printf(DEBUG_GENERAL,
-                     "XFSBL_ERROR_UNSUPPORTED_HANDOFF : "
-                     "A53-0 64 bit to 32 bit\n\r");
-        return Status;
-      } else if ((FsblInstancePtr->A53ExecState ==
-                  XIH_PH_ATTRB_A53_EXEC_ST_AA32) &&
-                 (ExecState == XIH_PH_ATTRB_A53_EXEC_ST_AA64)) {
-        Status = XFSBL_ERROR_UNSUPPORTED_HANDOFF;
-        XFsbl_Printf(DEBUG_GENERAL,
-                     "XFSBL_ERROR_UNSUPPORTED_HANDOFF : "
-                     "A53-0 32 bit to 64 bit\n\r");
-        return Status;
-      } else {
-        /* for MISRA C compliance */
-      }
+    /* Check if handoff CPU is supported */
+    Status = XFsbl_CheckSupportedCpu(CpuId);
+    if (XFSBL_SUCCESS != Status) {
+      XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_UNAVAILABLE_CPU\n\r");
+      Status = XFSBL_ERROR_UNAVAILABLE_CPU;
+      return Status;
+    }
+
+    /**
+     * Check for power status of the cpu
+     * Update the IVT
+     * Take cpu out of reset
+     */
+    Status = XFsbl_power_up_reset_cpu(CpuSettings, XFSBL_CPU_POWER_UP);
+    if (XFSBL_SUCCESS != Status) {
+      XFsbl_Printf(DEBUG_GENERAL,
+                   "Power Up "
+                   "Cpu 0x%0lx failed \n\r",
+                   CpuId);
+
+      Status = XFSBL_ERROR_PWR_UP_CPU;
+      return Status;
+    }
+
+    HandoffAddress =
+        (u64)FsblInstancePtr->HandoffValues[CpuIndex].HandoffAddress;
+
+    /* Update the handoff address at reset vector address */
+    XFsbl_UpdateResetVector(HandoffAddress, CpuSettings, OTHER_CPU_HANDOFF,
+                            XFsbl_GetVectorLocation(PartitionHeader) >>
+                                XIH_ATTRB_VECTOR_LOCATION_SHIFT);
+    XFsbl_Printf(
+        DEBUG_INFO,
+        "CPU 0x%0lx reset release, "
+        "Exec State 0x%0lx, "
+        "HandoffAddress: %0lx\n\r",
+        CpuId, ExecState,
+        (PTRSIZE)FsblInstancePtr->HandoffValues[CpuIndex].HandoffAddress);
+
+    /** Take CPU out of reset */
+    Status = XFsbl_power_up_reset_cpu(CpuSettings, XFSBL_CPU_SWRST);
+    if (XFSBL_SUCCESS != Status) {
+      return Status;
+    }
 
-      handoff_within_running_core(
-          FsblInstancePtr->HandoffValues[CpuIndex].HandoffAddress, ExecState);
+#ifdef XFSBL_EARLY_HANDOFF
+    if (EarlyHandoff == (u32)TRUE) {
+      EarlyHandoffCpus |= XFSBL_EARLY_HANDOFF_CPU_BIT(CpuId);
+      return STATUS_PARTITION_LOAD_IN_PROGRESS;
     }
-#if 0
-    if ((EarlyHandoff == TRUE) && (CpuNeedsEarlyHandoff == TRUE)){
-
-			/* Enable cache again as we will continue loading partitions */
-			Xil_DCacheEnable();
-
-			if (PartitionNum <
-					(FsblInstancePtr->
-							ImageHeader.ImageHeaderTable.NoOfPartitions-1U)) {
-				/**
-				 * If this is not the last handoff CPU, return back and continue
-				 * loading remaining partitions in stage 3
-				 */
-				CpuIndexEarlyHandoff++;
-				Status = XFSBL_STATUS_CONTINUE_PARTITION_LOAD;
-			}
-			else {
-				/**
-				 * Early handoff to all required CPUs is done, continue with
-				 * regular handoff for remaining applications, as applicable
-				 */
-				Status = XFSBL_STATUS_CONTINUE_OTHER_HANDOFF;
-			}
-			goto END;
-		}
 #endif
-    /* Go to the next cpu */
-    CpuIndex++;
   }
+
+  if ((RunningCpuIndex < FsblInstancePtr->HandoffCpuNo) &&
+      (EarlyHandoff != (u32)TRUE)) {
+    ExecState = FsblInstancePtr->HandoffValues[RunningCpuIndex].CpuSettings &
+                XIH_PH_ATTRB_A53_EXEC_ST_MASK;
+
+    /**
+     * Update reset vector address for
+     * - FSBL running on A53-0 (64bit), handoff to
+     * A53-0 (32 bit)
+     * - FSBL running on A53-0 (32bit), handoff to
+     * A53-0 (64 bit)
+     */
+    if ((FsblInstancePtr->A53ExecState == XIH_PH_ATTRB_A53_EXEC_ST_AA64) &&
+        (ExecState == XIH_PH_ATTRB_A53_EXEC_ST_AA32)) {
+      Status = XFSBL_ERROR_UNSUPPORTED_HANDOFF;
+      XFsbl_Printf(DEBUG_GENERAL,
+                   "XFSBL_ERROR_UNSUPPORTED_HANDOFF : "
+                   "A53-0 64 bit to 32 bit\n\r");
+      return Status;
+    } else if ((FsblInstancePtr->A53ExecState ==
+                XIH_PH_ATTRB_A53_EXEC_ST_AA32) &&
+               (ExecState == XIH_PH_ATTRB_A53_EXEC_ST_AA64)) {
+      Status = XFSBL_ERROR_UNSUPPORTED_HANDOFF;
+      XFsbl_Printf(DEBUG_GENERAL,
+                   "XFSBL_ERROR_UNSUPPORTED_HANDOFF : "
+                   "A53-0 32 bit to 64 bit\n\r");
+      return Status;
+    } else {
+      /* for MISRA C compliance */
+    }
+
+    handoff_within_running_core(
+        FsblInstancePtr->HandoffValues[RunningCpuIndex].HandoffAddress,
+        ExecState);
+  }
+
+#ifdef XFSBL_EARLY_HANDOFF
+  if (EarlyHandoff == (u32)TRUE) {
+    Status = STATUS_PARTITION_LOAD_IN_PROGRESS;
+  }
+#endif
   return Status;
 }
 
@@ -875,6 +935,7 @@ void HandoffJtagMode(const XFsblPs* const FsblInstancePtr) {
 #else
     XFsbl_Out32(0xFFFC0000U, 0xEAFFFFFEU);
 #endif
+    XFsbl_LogPublish();
     XFsbl_Exit(0xFFFC0000U, XFSBL_HANDOFFEXIT);
   } else {
     /**
@@ -884,13 +945,164 @@ void HandoffJtagMode(const XFsblPs* const FsblInstancePtr) {
   }
 }
 
+/*****************************************************************************/
+/**
+ * This function sends the PM configuration object to the PMU firmware the
+ * first time it is called with the PMU firmware running. An early handoff
+ * waits for the PMU firmware, the final handoff configures it or reports
+ * that it is not running.
+ *
+ * @param	EarlyHandoff is TRUE for an early handoff
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns XFSBL_ERROR_PM_INIT on failure
+ *
+ *****************************************************************************/
+static u32 XFsbl_HandoffPmInit(u32 EarlyHandoff) {
+  const u32 PmuFwPresent = XFsbl_In32(PMU_GLOBAL_GLOBAL_CNTRL) &
+                           PMU_GLOBAL_GLOBAL_CNTRL_FW_IS_PRESENT_MASK;
+
+  if ((PmInitDone == (u32)TRUE) ||
+      ((EarlyHandoff == (u32)TRUE) && (PmuFwPresent == 0U))) {
+    return XFSBL_SUCCESS;
+  }
+
+  if (XFsbl_PmInit() != XFSBL_SUCCESS) {
+    XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_PM_INIT\r\n");
+    return XFSBL_ERROR_PM_INIT;
+  }
+  if (PmuFwPresent != 0U) {
+    PmInitDone = TRUE;
+  }
+
+  return XFSBL_SUCCESS;
+}
+
+#ifdef XFSBL_EARLY_HANDOFF
+/*****************************************************************************/
+/**
+ * This function checks if two destination CPUs share a core, the R5
+ * lockstep pair includes both R5 cores
+ *
+ * @param	CpuId is a destination CPU
+ *
+ * @param	OtherCpuId is the other destination CPU
+ *
+ * @return	TRUE if the CPUs share a core, and FALSE if not
+ *
+ *****************************************************************************/
+static u32 XFsbl_CpusOverlap(u32 CpuId, u32 OtherCpuId) {
+  u32 Status = FALSE;
+
+  if (CpuId == OtherCpuId) {
+    Status = TRUE;
+  } else if (((CpuId == XIH_PH_ATTRB_DEST_CPU_R5_L) &&
+              ((OtherCpuId == XIH_PH_ATTRB_DEST_CPU_R5_0) ||
+               (OtherCpuId == XIH_PH_ATTRB_DEST_CPU_R5_1))) ||
+             ((OtherCpuId == XIH_PH_ATTRB_DEST_CPU_R5_L) &&
+              ((CpuId == XIH_PH_ATTRB_DEST_CPU_R5_0) ||
+               (CpuId == XIH_PH_ATTRB_DEST_CPU_R5_1)))) {
+    Status = TRUE;
+  } else {
+    /* for MISRA C compliance */
+  }
+
+  return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function releases the destination CPU of a partition while the FSBL
+ * goes on loading the remaining partitions. Only the steps the released
+ * CPU depends on are taken: the image is flushed from the data cache of
+ * the FSBL core, which stays enabled, and the PMU firmware is configured
+ * if it runs already. The boot device, the PS-PL isolation and the
+ * protection configuration are left to the final handoff, the released
+ * CPU must not rely on them until then.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ *
+ * @param	PartitionNum is the partition number of the image
+ *
+ * @return	returns STATUS_PARTITION_LOAD_IN_PROGRESS on success
+ * 		returns the error codes described in xfsbl_error.h on failure
+ *
+ *****************************************************************************/
+static u32 XFsbl_EarlyHandoff(const XFsblPs* const FsblInstancePtr,
+                              u32 PartitionNum) {
+  u32 Status;
+
+  /**
+   * The released CPU may use any DDR while the FSBL goes on, so the DDR
+   * ECC initialization is completed first
+   */
+  Status = XFsbl_DdrEccFinish(FALSE);
+  if (Status != XFSBL_SUCCESS) {
+    return Status;
+  }
+
+  /**
+   * The released CPU reads the image from memory, not from the caches of
+   * the FSBL core
+   */
+  Xil_DCacheFlush();
+
+  if (XFSBL_MASTER_ONLY_RESET != FsblInstancePtr->ResetReason) {
+    Status = XFsbl_HandoffPmInit(TRUE);
+    if (Status != XFSBL_SUCCESS) {
+      return Status;
+    }
+  }
+
+  if (XFsbl_HookBeforeHandoff(TRUE) != XFSBL_SUCCESS) {
+    XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_HOOK_BEFORE_HANDOFF\r\n");
+    return XFSBL_ERROR_HOOK_BEFORE_HANDOFF;
+  }
+
+  return XFsbl_HandoffExecute(FsblInstancePtr, PartitionNum, TRUE);
+}
+#endif /* XFSBL_EARLY_HANDOFF */
+
 u32 XFsbl_Handoff(const XFsblPs* const FsblInstancePtr, u32 PartitionNum,
                   u32 EarlyHandoff) {
+  const XTime Start = XFsbl_PerfNow();
   u32 Status;
 
+#ifdef XFSBL_EARLY_HANDOFF
+  if (EarlyHandoff == (u32)TRUE) {
+    Status = XFsbl_EarlyHandoff(FsblInstancePtr, PartitionNum);
+    XFsbl_PerfRecord(XFSBL_PERF_EVENT_EARLY_HANDOFF, PartitionNum, Start, 0U);
+    return Status;
+  }
+#endif
+
+  /**
+   * Complete the DDR ECC initialization, or leave the rest of it to the
+   * next stage, which JTAG boots do not have
+   */
+  Status = XFsbl_DdrEccFinish(
+      (FsblInstancePtr->PrimaryBootDevice != XFSBL_JTAG_BOOT_MODE) ? TRUE
+                                                                   : FALSE);
+  if (Status != XFSBL_SUCCESS) {
+    return Status;
+  }
+
   /* Restoring the SD card detection signal */
   XFsbl_Out32(IOU_SLCR_SD_CDN_CTRL, SdCdnRegVal);
 
+  /**
+   * Leave the boot device in the state the BootROM expects it in once no
+   * more partitions are going to be loaded
+   */
+  if ((EarlyHandoff == (u32)FALSE) &&
+      (FsblInstancePtr->DeviceOps.DeviceRelease != NULL)) {
+    Status = FsblInstancePtr->DeviceOps.DeviceRelease();
+    if (Status != XFSBL_SUCCESS) {
+      XFsbl_Printf(DEBUG_GENERAL, "Boot device release failed: 0x%x\r\n",
+                   Status);
+    }
+  }
+
   if (FsblInstancePtr->ResetReason == XFSBL_PS_ONLY_RESET) {
     /**Remove PS-PL isolation to allow u-boot and linux to access
      * PL*/
@@ -904,10 +1116,8 @@ u32 XFsbl_Handoff(const XFsblPs* const FsblInstancePtr, u32 PartitionNum,
   Xil_DCacheDisable();
 
   if (XFSBL_MASTER_ONLY_RESET != FsblInstancePtr->ResetReason) {
-    Status = XFsbl_PmInit();
+    Status = XFsbl_HandoffPmInit(FALSE);
     if (Status != XFSBL_SUCCESS) {
-      Status = XFSBL_ERROR_PM_INIT;
-      XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_PM_INIT\r\n");
       return Status;
     }
 
@@ -938,7 +1148,20 @@ u32 XFsbl_Handoff(const XFsblPs* const FsblInstancePtr, u32 PartitionNum,
    */
   XFsbl_Out32(XFSBL_ERROR_STATUS_REGISTER_OFFSET, XFSBL_COMPLETED);
 
-  Status = XFsbl_HandoffExecute(FsblInstancePtr, PartitionNum);
+  /**
+   * Complete the boot timeline, the running CPU does not come back from
+   * XFsbl_HandoffExecute()
+   */
+  XFsbl_PerfRecord(XFSBL_PERF_EVENT_HANDOFF, PartitionNum, Start, 0U);
+#if defined(XFSBL_PERF)
+  XFsbl_PerfRecord(XFSBL_PERF_EVENT_FSBL, 0U,
+                   FsblInstancePtr->PerfTime.tFsblStart, 0U);
+  XFsbl_MeasurePerfTime(FsblInstancePtr->PerfTime.tFsblStart);
+  XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": Total Time \n\r");
+#endif
+  XFsbl_PerfPublish();
+
+  Status = XFsbl_HandoffExecute(FsblInstancePtr, PartitionNum, FALSE);
   if (Status != XFSBL_SUCCESS) {
     return Status;
   }
@@ -948,7 +1171,10 @@ u32 XFsbl_Handoff(const XFsblPs* const FsblInstancePtr, u32 PartitionNum,
 
 /*****************************************************************************/
 /**
- * This function determines if the given partition needs early handoff
+ * This function determines if the given partition needs early handoff. It
+ * does when the partition has the early handoff attribute, its destination
+ * CPU is neither the running CPU nor the PMU, which is woken up once its
+ * firmware is loaded, and no later partition is for the same CPU.
  *
  * @param	FsblInstancePtr is pointer to the XFsbl Instance
  *
@@ -957,8 +1183,48 @@ u32 XFsbl_Handoff(const XFsblPs* const FsblInstancePtr, u32 PartitionNum,
  * @return	TRUE if this partitions needs early handoff, and FALSE if not
  *
  *****************************************************************************/
-u32 XFsbl_CheckEarlyHandoff(XFsblPs* FsblInstancePtr, u32 PartitionNum) {
+u32 XFsbl_CheckEarlyHandoff(const XFsblPs* const FsblInstancePtr,
+                            u32 PartitionNum) {
   u32 Status = FALSE;
+#ifdef XFSBL_EARLY_HANDOFF
+  const XFsblPs_PartitionHeader* const PartitionHeader =
+      &FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
+  const u32 CpuId = XFsbl_GetDestinationCpu(PartitionHeader);
+  u32 Index;
+
+  if ((XFsbl_IsEarlyHandoff(PartitionHeader) == 0U) ||
+      (CpuId == XIH_PH_ATTRB_DEST_CPU_NONE) ||
+      (CpuId == XIH_PH_ATTRB_DEST_CPU_PMU) ||
+      (XFsbl_CpusOverlap(CpuId, FsblInstancePtr->ProcessorID) == (u32)TRUE)) {
+    goto END;
+  }
+
+  /* The image of the CPU has to be complete */
+  for (Index = PartitionNum + 1U;
+       Index < FsblInstancePtr->ImageHeader.ImageHeaderTable.NoOfPartitions;
+       Index++) {
+    if (XFsbl_CpusOverlap(CpuId,
+                          XFsbl_GetDestinationCpu(
+                              &FsblInstancePtr->ImageHeader
+                                   .PartitionHeader[Index])) == (u32)TRUE) {
+      goto END;
+    }
+  }
+
+  /* A CPU without handoff address is not released */
+  if (XFsbl_CheckHandoffCpu(FsblInstancePtr, CpuId) == XFSBL_SUCCESS) {
+    goto END;
+  }
+
+  XFsbl_Printf(DEBUG_INFO, "Early handoff to CPU 0x%0lx after partition %u\n\r",
+               CpuId, PartitionNum);
+  Status = TRUE;
+
+END:
+#else
+  (void)FsblInstancePtr;
+  (void)PartitionNum;
+#endif
   return Status;
 }
 
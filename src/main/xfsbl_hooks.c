@@ -19,6 +19,9 @@
 * 1.00  kc   04/21/14 Initial release
 * 2.0   bv   12/05/16 Made compliance to MISRAC 2012 guidelines
 *       ssc  03/25/17 Set correct value for SYSMON ANALOG_BUS register
+* 3.0   dd   10/16/26 Record the psu_init blocks in the boot timeline
+*       dd   10/16/26 Print the psu_init critical path
+*       dd   10/16/26 Wait for the PMU boot type on a deadline
 *
 * </pre>
 *
@@ -29,6 +32,8 @@
 #include "xfsbl_hw.h"
 #include "xfsbl_hooks.h"
 #include "psu_init.h"
+#include "xfsbl_perf.h"
+#include "xfsbl_misc.h"
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
@@ -132,6 +137,8 @@ u32 XFsbl_HookPsuInit(void)
 	Status = (u32)psu_init();
 #endif
 
+	XFsbl_PerfPsuInitDone();
+
 	if (XFSBL_SUCCESS != Status) {
 			XFsbl_Printf(DEBUG_GENERAL,"XFSBL_PSU_INIT_FAILED\n\r");
 			/**
@@ -171,10 +178,16 @@ u32 XFsbl_HookGetPosBootType(void)
 {
 	u32 WarmBoot = 0;
 	u32 RegValue = 0;
+	u32 Status;
 
-	do {
-		RegValue = XFsbl_In32(PMU_GLOBAL_GLOB_GEN_STORAGE1);
-	} while (0U == RegValue);
+	/* A PMU which does not answer is taken as a cold boot */
+	Status = XFSBL_POLL_UNTIL(
+		(RegValue = XFsbl_In32(PMU_GLOBAL_GLOB_GEN_STORAGE1)) != 0U,
+		XFSBL_PMU_REQ_TIMEOUT, XFSBL_POLL_WFE);
+	if (Status != XFSBL_SUCCESS) {
+		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_POLL_TIMEOUT\r\n");
+		goto END;
+	}
 
 	/* Clear Gen Storage register so it can be used later in system */
 	XFsbl_Out32(PMU_GLOBAL_GLOB_GEN_STORAGE1, 0U);
@@ -186,6 +199,7 @@ u32 XFsbl_HookGetPosBootType(void)
 		XFsbl_Out32(PMU_GLOBAL_GLOB_GEN_STORAGE2, 1U);
 	}
 
+END:
 	return WarmBoot;
 }
 #endif
@@ -27,6 +27,22 @@
  *       bsv  05/03/21 Add provision to load bitstream from OCM with DDR
  *                     present in design
  * 6.0   bsv  08/03/22 Fix ECC error count for R5 FSBL
+ * 7.0   dd   10/16/26 Added XFSBL_QSPI_STREAM
+ *       dd   10/16/26 Added XFSBL_QSPI_SFDP
+ *       dd   10/16/26 Added XFSBL_QSPI_CALIB
+ *       dd   10/16/26 Added XFSBL_QSPI24_4B
+ *       dd   10/16/26 Added XFSBL_DEVICE_CACHE
+ *       dd   10/16/26 Added XFSBL_COMPRESSION
+ *       dd   10/16/26 Added XFSBL_PARTITION_CRC
+ *       dd   10/16/26 Added XFSBL_PARTITION_SHA3, XFSBL_CSU_SHA3 and the CSU
+ *                     DMA source channel registers
+ *       dd   10/16/26 Added XFSBL_PARTITION_BLAKE3 and XFSBL_APU_WORKERS
+ *       dd   10/16/26 Added the boot timeline register
+ *       dd   10/16/26 Added XFSBL_DEFERRED_LOG and the log buffer register
+ *       dd   10/16/26 Added XFSBL_SERDES_CACHE and its register
+ *       dd   10/16/26 Added XFSBL_DDR_TRAIN_CACHE
+ *       dd   10/16/26 Added XFSBL_DDR_ECC_LAZY
+ *       dd   10/16/26 XFSBL_QSPI24_4B needs XFSBL_QSPI_SFDP
  *
  * </pre>
  *
@@ -203,6 +219,34 @@ extern "C" {
  */
 #define CSUDMA_BASEADDR 0XFFC80000U
 
+/**
+ * Register: CSUDMA_CSU_DMA_SRC_ADDR
+ */
+#define CSUDMA_CSU_DMA_SRC_ADDR ((CSUDMA_BASEADDR) + 0X00000000U)
+
+/**
+ * Register: CSUDMA_CSU_DMA_SRC_SIZE
+ */
+#define CSUDMA_CSU_DMA_SRC_SIZE ((CSUDMA_BASEADDR) + 0X00000004U)
+#define CSUDMA_CSU_DMA_SRC_SIZE_LAST_WORD_MASK 0X00000001U
+
+/**
+ * Register: CSUDMA_CSU_DMA_SRC_CTRL
+ */
+#define CSUDMA_CSU_DMA_SRC_CTRL ((CSUDMA_BASEADDR) + 0X0000000CU)
+#define CSUDMA_CSU_DMA_SRC_CTRL_ENDIANNESS_MASK 0X00800000U
+
+/**
+ * Register: CSUDMA_CSU_DMA_SRC_I_STS
+ */
+#define CSUDMA_CSU_DMA_SRC_I_STS ((CSUDMA_BASEADDR) + 0X00000014U)
+#define CSUDMA_CSU_DMA_SRC_I_STS_DONE_MASK 0X00000002U
+
+/**
+ * Register: CSUDMA_CSU_DMA_SRC_ADDR_MSB
+ */
+#define CSUDMA_CSU_DMA_SRC_ADDR_MSB ((CSUDMA_BASEADDR) + 0X00000028U)
+
 /* crf_apb */
 
 /**
@@ -332,8 +376,10 @@ extern "C" {
 #define PMU_GLOBAL_GLOB_GEN_STORAGE6 ((PMU_GLOBAL_BASEADDR) + 0X48U)
 #define PMU_GLOBAL_GLOB_GEN_STORAGE5 ((PMU_GLOBAL_BASEADDR) + 0x44U)
 #define PMU_GLOBAL_GLOB_GEN_STORAGE4 ((PMU_GLOBAL_BASEADDR) + 0X40U)
+#define PMU_GLOBAL_GLOB_GEN_STORAGE0 ((PMU_GLOBAL_BASEADDR) + 0X30U)
 #define PMU_GLOBAL_GLOB_GEN_STORAGE1 ((PMU_GLOBAL_BASEADDR) + 0X34U)
 #define PMU_GLOBAL_GLOB_GEN_STORAGE2 ((PMU_GLOBAL_BASEADDR) + 0X38U)
+#define PMU_GLOBAL_GLOB_GEN_STORAGE3 ((PMU_GLOBAL_BASEADDR) + 0X3CU)
 
 /**
  * Register: PMU_GLOBAL_PERS_GLOB_GEN_STORAGE4
@@ -345,6 +391,11 @@ extern "C" {
  */
 #define PMU_GLOBAL_PERS_GLOB_GEN_STORAGE5 ((PMU_GLOBAL_BASEADDR) + 0X00000064U)
 
+/*
+ * Register: PMU_GLOBAL_PERS_GLOB_GEN_STORAGE6
+ */
+#define PMU_GLOBAL_PERS_GLOB_GEN_STORAGE6 ((PMU_GLOBAL_BASEADDR) + 0X00000068U)
+
 /*
  * Register: PMU_GLOBAL_PERS_GLOB_GEN_STORAGE7
  */
@@ -738,6 +789,37 @@ extern "C" {
  */
 #define XFSBL_ERROR_STATUS_REGISTER_OFFSET (PMU_GLOBAL_PERS_GLOB_GEN_STORAGE4)
 
+/**
+ * The QSPI read mode selected from SFDP is kept across warm boots in
+ * PMU_GLOBAL_PERS_GLOB_GEN_STORAGE6
+ */
+#define XFSBL_QSPI_SFDP_CACHE_REGISTER (PMU_GLOBAL_PERS_GLOB_GEN_STORAGE6)
+
+/**
+ * The calibrated QSPI clock prescaler and tap delay are kept across warm
+ * boots in PMU_GLOBAL_PERS_GLOB_GEN_STORAGE5
+ */
+#define XFSBL_QSPI_CALIB_CACHE_REGISTER (PMU_GLOBAL_PERS_GLOB_GEN_STORAGE5)
+
+/**
+ * The SERDES ILL calibration codes are kept across warm boots in
+ * PMU_GLOBAL_PERS_GLOB_GEN_STORAGE7, the DDR status register of
+ * XFSBL_ENABLE_DDR_SR
+ */
+#define XFSBL_SERDES_CACHE_REGISTER (PMU_GLOBAL_PERS_GLOB_GEN_STORAGE7)
+
+/**
+ * The address of the boot timeline of XFSBL_PERF is published to U-Boot and
+ * Linux in PMU_GLOBAL_GLOB_GEN_STORAGE3, 0 when there is none
+ */
+#define XFSBL_PERF_TIMELINE_REGISTER (PMU_GLOBAL_GLOB_GEN_STORAGE3)
+
+/**
+ * The address of the log buffer of XFSBL_DEFERRED_LOG is published to U-Boot
+ * and Linux in PMU_GLOBAL_GLOB_GEN_STORAGE0
+ */
+#define XFSBL_LOG_REGISTER (PMU_GLOBAL_GLOB_GEN_STORAGE0)
+
 /* PMU RAM address for PMU FW */
 #define XFSBL_PMU_RAM_START_ADDRESS (0xFFDC0000U)
 #define XFSBL_PMU_RAM_END_ADDRESS (0xFFDDFFFFU)
@@ -825,6 +907,107 @@ extern "C" {
 #define XFSBL_QSPI_BUSWIDTH_FOUR 2U
 #endif
 
+/**
+ * Definition for double-buffered QSPI reads to be included
+ */
+#if defined(XFSBL_QSPI) && !defined(FSBL_QSPI_STREAM_EXCLUDE)
+#define XFSBL_QSPI_STREAM
+#endif
+
+/**
+ * Definition for SFDP based QSPI read mode selection to be included
+ */
+#if defined(XFSBL_QSPI) && !defined(FSBL_QSPI_SFDP_EXCLUDE)
+#define XFSBL_QSPI_SFDP
+#endif
+
+/**
+ * Definition for QSPI clock and tap delay calibration to be included
+ */
+#if defined(XFSBL_QSPI) && !defined(FSBL_QSPI_CALIB_EXCLUDE)
+#define XFSBL_QSPI_CALIB
+#endif
+
+/**
+ * Definition for 4 byte addresses in QSPI 24 bit boot mode to be included,
+ * SFDP tells whether the flash takes them
+ */
+#if defined(XFSBL_QSPI_SFDP) && !defined(FSBL_QSPI24_4B_EXCLUDE)
+#define XFSBL_QSPI24_4B
+#endif
+
+/**
+ * Definition for the boot device read-ahead cache to be included
+ */
+#if !defined(FSBL_DEVICE_CACHE_EXCLUDE)
+#define XFSBL_DEVICE_CACHE
+#endif
+
+/**
+ * Definition for compressed partition support to be included
+ */
+#if !defined(FSBL_COMPRESSION_EXCLUDE)
+#define XFSBL_COMPRESSION
+#endif
+
+/**
+ * Definition for CRC32C partition checksum support to be included
+ */
+#if !defined(FSBL_PARTITION_CRC_EXCLUDE)
+#define XFSBL_PARTITION_CRC
+#endif
+
+/**
+ * Definition for SHA3 partition checksum verification to be included
+ */
+#if !defined(FSBL_PARTITION_SHA3_EXCLUDE)
+#define XFSBL_PARTITION_SHA3
+#endif
+
+/**
+ * Definition for the CSU SHA3 engine to be included
+ */
+#if !defined(FSBL_CSU_SHA3_EXCLUDE)
+#define XFSBL_CSU_SHA3
+#endif
+
+/**
+ * Definition for BLAKE3 partition checksum support to be included
+ */
+#if !defined(FSBL_PARTITION_BLAKE3_EXCLUDE)
+#define XFSBL_PARTITION_BLAKE3
+#endif
+
+/**
+ * Definition for the A53 workers to be included
+ */
+#if !defined(FSBL_APU_WORKERS_EXCLUDE) && defined(ARMA53_64)
+#define XFSBL_APU_WORKERS
+#endif
+
+/**
+ * Definition for the deferred log to be included
+ */
+#if !defined(FSBL_DEFERRED_LOG_EXCLUDE)
+#define XFSBL_DEFERRED_LOG
+#endif
+
+/**
+ * Definition for the SERDES ILL calibration cache to be included, its
+ * register is the DDR status register of the DDR self refresh
+ */
+#if !defined(FSBL_SERDES_CACHE_EXCLUDE) && !defined(XFSBL_ENABLE_DDR_SR)
+#define XFSBL_SERDES_CACHE
+#endif
+
+/**
+ * Definition for the DDR training cache to be included. The DDR self refresh
+ * skips the training and must not see the pattern test of a restore
+ */
+#if (XFSBL_DDR_TRAIN_ADDRESS != 0U) && !defined(XFSBL_ENABLE_DDR_SR)
+#define XFSBL_DDR_TRAIN_CACHE
+#endif
+
 /**
  * Definition for NAND to be included
  */
@@ -927,6 +1110,14 @@ extern "C" {
 #endif
 #endif
 
+/**
+ * Definition for the background DDR ECC initialization to be included
+ */
+#if (XPAR_PSU_DDRC_0_HAS_ECC) && defined(XFSBL_PS_DDR) && \
+    !defined(FSBL_DDR_ECC_LAZY_EXCLUDE)
+#define XFSBL_DDR_ECC_LAZY
+#endif
+
 #ifdef XFSBL_ENABLE_DDR_SR
 /*
  * For DDR status PMU_GLOBAL_PERS_GLOB_GEN_STORAGE7 is used
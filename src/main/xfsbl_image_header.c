@@ -30,6 +30,13 @@
  *       bsv  07/05/19 Remove MD5 checksum related code
  *       bsv  07/19/19 Rectify the TCM limit used for validating DDR address
  *                     by R5 FSBL
+ * 4.0   dd   10/16/26 Read headers through the boot device read-ahead cache
+ *       dd   10/16/26 Read contiguous partition headers in one transfer
+ *       dd   10/16/26 Added compressed partition attribute checks
+ *       dd   10/16/26 Header checksums use XFsbl_WordSum, added the CRC32C
+ *                     checksum type
+ *       dd   10/16/26 Added the BLAKE3 checksum type
+ *       dd   10/16/26 Added XFsbl_IsEarlyHandoff
  *
  * </pre>
  *
@@ -40,6 +47,8 @@
 /***************************** Include Files *********************************/
 #include "xfsbl_image_header.h"
 
+#include "xfsbl_checksum.h"
+
 #include "xfsbl_hw.h"
 #include "xfsbl_misc_drivers.h"
 
@@ -95,6 +104,15 @@ u32 XFsbl_GetBlockSize(const XFsblPs_PartitionHeader* PartitionHeader) {
   return Size;
 }
 
+u32 XFsbl_IsCompressed(const XFsblPs_PartitionHeader* PartitionHeader) {
+  return PartitionHeader->PartitionAttributes & XIH_PH_ATTRB_COMPRESSION_MASK;
+}
+
+u32 XFsbl_IsEarlyHandoff(const XFsblPs_PartitionHeader* PartitionHeader) {
+  return PartitionHeader->PartitionAttributes &
+         XIH_PH_ATTRB_EARLY_HANDOFF_MASK;
+}
+
 /************************** Function Prototypes ******************************/
 static u32 XFsbl_ValidateImageHeaderTable(
     XFsblPs_ImageHeaderTable* ImageHeaderTable);
@@ -136,9 +154,6 @@ extern u8* ImageHdr;
  *
  *****************************************************************************/
 u32 XFsbl_ValidateChecksum(u32 Buffer[], u32 Length) {
-  u32 Checksum = 0U;
-  u32 Count = 0;
-
   /**
    * Length has to be at least equal to 2,
    */
@@ -150,12 +165,7 @@ u32 XFsbl_ValidateChecksum(u32 Buffer[], u32 Length) {
    * Checksum = ~(X1 + X2 + X3 + .... + Xn)
    * Calculate the checksum
    */
-  for (Count = 0U; Count < (Length - 1U); Count++) {
-    /**
-     * Read the word from the header
-     */
-    Checksum += Buffer[Count];
-  }
+  u32 Checksum = XFsbl_WordSum(Buffer, Length - 1U);
 
   /**
    * Invert checksum
@@ -308,8 +318,8 @@ u32 XFsbl_ReadImageHeader(XFsblPs_ImageHeader* ImageHeader,
    * and update the image header table structure
    */
   if (DeviceOps) {
-    Status = DeviceOps->DeviceCopy(
-        FlashImageOffsetAddress + ImageHeaderTableAddressOffset,
+    Status = XFsbl_DeviceCachedCopy(
+        DeviceOps, FlashImageOffsetAddress + ImageHeaderTableAddressOffset,
         (PTRSIZE) & (ImageHeader->ImageHeaderTable), XIH_IHT_LEN);
 
     if (XFSBL_SUCCESS != Status) {
@@ -345,6 +355,27 @@ u32 XFsbl_ReadImageHeader(XFsblPs_ImageHeader* ImageHeader,
 
   XfsblPs_RuntimePartitionConfiguration PartConfig = {};
 
+  /**
+   * Bootgen places the partition headers one after the other, so read
+   * them all in one transfer. From the first header whose predecessor
+   * points elsewhere on, the headers are read one by one following
+   * NextPartitionOffset
+   */
+  const u32 FirstPartitionHeaderAddress = PartitionHeaderAddress;
+  u32 ContiguousCount = 0U;
+  if (DeviceOps != NULL) {
+    Status = XFsbl_DeviceCachedCopy(
+        DeviceOps, FlashImageOffsetAddress + PartitionHeaderAddress,
+        (PTRSIZE) & (ImageHeader->PartitionHeader[0]),
+        ImageHeader->ImageHeaderTable.NoOfPartitions * XIH_PH_LEN);
+
+    if (XFSBL_SUCCESS != Status) {
+      XFsbl_Printf(DEBUG_GENERAL, "Device Copy Failed \n\r");
+      return Status;
+    }
+    ContiguousCount = ImageHeader->ImageHeaderTable.NoOfPartitions;
+  }
+
   /**
    * Read the partitions based on the partition offset
    * and update the partition header structure
@@ -357,9 +388,9 @@ u32 XFsbl_ReadImageHeader(XFsblPs_ImageHeader* ImageHeader,
      * Read the Image header table of 64 bytes
      * and update the image header table structure
      */
-    if (DeviceOps != NULL) {
-      Status = DeviceOps->DeviceCopy(
-          FlashImageOffsetAddress + PartitionHeaderAddress,
+    if ((DeviceOps != NULL) && (PartitionIndex >= ContiguousCount)) {
+      Status = XFsbl_DeviceCachedCopy(
+          DeviceOps, FlashImageOffsetAddress + PartitionHeaderAddress,
           (PTRSIZE) & (ImageHeader->PartitionHeader[PartitionIndex]),
           XIH_PH_LEN);
 
@@ -394,6 +425,16 @@ u32 XFsbl_ReadImageHeader(XFsblPs_ImageHeader* ImageHeader,
     PartitionHeaderAddress =
         (ImageHeader->PartitionHeader[PartitionIndex].NextPartitionOffset) *
         XIH_PARTITION_WORD_LENGTH;
+
+    if (((PartitionIndex + 1U) < ContiguousCount) &&
+        (PartitionHeaderAddress !=
+         (FirstPartitionHeaderAddress +
+          ((PartitionIndex + 1U) * XIH_PH_LEN)))) {
+      XFsbl_Printf(DEBUG_INFO,
+                   "Partition headers not contiguous from partition %u\n\r",
+                   PartitionIndex + 1U);
+      ContiguousCount = PartitionIndex + 1U;
+    }
   }
 
   /**
@@ -524,10 +565,12 @@ static u32 verify_encryption_values(
    */
   if ((IsAuthenticated == FALSE) && (IsEncrypted == FALSE)) {
     /**
-     * all lengths should be equal
+     * all lengths should be equal, except the unencrypted length of a
+     * compressed partition which is its decompressed length
      */
-    if ((PartitionHeader->UnEncryptedDataWordLength !=
-         PartitionHeader->EncryptedDataWordLength) ||
+    if (((XFsbl_IsCompressed(PartitionHeader) != XIH_PH_ATTRB_COMPRESSION) &&
+         (PartitionHeader->UnEncryptedDataWordLength !=
+          PartitionHeader->EncryptedDataWordLength)) ||
         (PartitionHeader->EncryptedDataWordLength !=
          PartitionHeader->TotalDataWordLength)) {
       XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_PARTITION_LENGTH\n\r");
@@ -563,6 +606,30 @@ static u32 verify_encryption_values(
   return XFSBL_SUCCESS;
 }
 
+static u32 verify_compression_values(
+    const XFsblPs_PartitionHeader* const PartitionHeader) {
+  if (XFsbl_IsCompressed(PartitionHeader) != XIH_PH_ATTRB_COMPRESSION) {
+    return XFSBL_SUCCESS;
+  }
+
+#ifdef XFSBL_COMPRESSION
+  /**
+   * Decryption, authentication and bitstream loading work on the stored
+   * data, so none of them can be combined with compression
+   */
+  if ((XFsbl_IsEncrypted(PartitionHeader) != XIH_PH_ATTRB_ENCRYPTION) &&
+      (XFsbl_IsRsaSignaturePresent(PartitionHeader) !=
+       XIH_PH_ATTRB_RSA_SIGNATURE) &&
+      (XFsbl_GetDestinationDevice(PartitionHeader) !=
+       XIH_PH_ATTRB_DEST_DEVICE_PL)) {
+    return XFSBL_SUCCESS;
+  }
+#endif
+
+  XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_COMPRESSION_NOT_SUPPORTED\n\r");
+  return XFSBL_ERROR_COMPRESSION_NOT_SUPPORTED;
+}
+
 inline static void print_partitionHeaderDetails(
     const XFsblPs_PartitionHeader* const PartitionHeader) {
   XFsbl_Printf(DEBUG_INFO, "UnEncrypted data Length: 0x%0lx \n\r",
@@ -656,7 +723,12 @@ u32 XFsbl_ValidatePartitionHeader(XFsblPs_PartitionHeader* PartitionHeader,
     DestinationCpu = RunningCpu;
   }
 
-  u32 Status = verify_encryption_values(PartitionHeader);
+  u32 Status = verify_compression_values(PartitionHeader);
+  if (Status != XFSBL_SUCCESS) {
+    return Status;
+  }
+
+  Status = verify_encryption_values(PartitionHeader);
   if (Status != XFSBL_SUCCESS) {
     return Status;
   }
@@ -678,8 +750,16 @@ u32 XFsbl_ValidatePartitionHeader(XFsblPs_PartitionHeader* PartitionHeader,
   /**
    * Checks for invalid checksum type
    */
-  if ((XFsbl_GetChecksumType(PartitionHeader) != XIH_PH_ATTRB_NOCHECKSUM) &&
-      (XFsbl_GetChecksumType(PartitionHeader) != XIH_PH_ATTRB_HASH_SHA3)) {
+  const u32 ChecksumType = XFsbl_GetChecksumType(PartitionHeader);
+  if ((ChecksumType != XIH_PH_ATTRB_NOCHECKSUM) &&
+      (ChecksumType != XIH_PH_ATTRB_HASH_SHA3)
+#ifdef XFSBL_PARTITION_CRC
+      && (ChecksumType != XIH_PH_ATTRB_CHECKSUM_CRC32C)
+#endif
+#ifdef XFSBL_PARTITION_BLAKE3
+      && (ChecksumType != XIH_PH_ATTRB_CHECKSUM_BLAKE3)
+#endif
+  ) {
     Status = XFSBL_ERROR_INVALID_CHECKSUM_TYPE;
     XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_INVALID_CHECKSUM_TYPE\n\r");
     return Status;
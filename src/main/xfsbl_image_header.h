@@ -34,6 +34,11 @@
  *       bsv  07/05/19 Remove MD5 checksum related macro
  *       bsv  07/19/19 Rectify the TCM limit used for validating DDR address
  *                     by R5 FSBL
+ * 4.0   dd   10/16/26 Added XIH_PH_ATTRB_COMPRESSION_MASK and
+ *                     XFsbl_IsCompressed()
+ *       dd   10/16/26 Added XIH_PH_ATTRB_CHECKSUM_CRC32C
+ *       dd   10/16/26 Added XIH_PH_ATTRB_CHECKSUM_BLAKE3
+ *       dd   10/16/26 Added XIH_PH_ATTRB_EARLY_HANDOFF_MASK
  *
  * </pre>
  *
@@ -131,8 +136,10 @@ extern "C" {
 /**
  * Partition Attribute fields
  */
+#define XIH_PH_ATTRB_COMPRESSION_MASK (0x1000000U)
 #define XIH_PH_ATTRB_VEC_LOCATION_MASK (0x800000U)
 #define XIH_PH_ATTR_BLOCK_SIZE_MASK (0x700000U)
+#define XIH_PH_ATTRB_EARLY_HANDOFF_MASK (0x80000U)
 #define XIH_PH_ATTRB_ENDIAN_MASK (0x40000U)
 #define XIH_PH_ATTRB_PART_OWNER_MASK (0x30000U)
 #define XIH_PH_ATTRB_RSA_SIGNATURE_MASK (0x8000U)
@@ -151,6 +158,8 @@ extern "C" {
 #define XIH_PH_ATTRB_RSA_SIGNATURE (0x8000U)
 #define XIH_PH_ATTRB_NOCHECKSUM (0x0000U)
 #define XIH_PH_ATTRB_HASH_SHA3 (0x3000U)
+#define XIH_PH_ATTRB_CHECKSUM_CRC32C (0x4000U)
+#define XIH_PH_ATTRB_CHECKSUM_BLAKE3 (0x5000U)
 
 #define XIH_PH_ATTRB_DEST_CPU_NONE (0x0000U)
 #define XIH_PH_ATTRB_DEST_CPU_A53_0 (u32)(0x100U)
@@ -163,6 +172,7 @@ extern "C" {
 #define XIH_PH_ATTRB_DEST_CPU_PMU (u32)(0x800U)
 
 #define XIH_PH_ATTRB_ENCRYPTION (u32)(0x80U)
+#define XIH_PH_ATTRB_COMPRESSION (u32)(0x1000000U)
 
 #define XIH_PH_ATTRB_DEST_DEVICE_NONE (u32)(0x0000U)
 #define XIH_PH_ATTRB_DEST_DEVICE_PS (u32)(0x0010U)
@@ -303,6 +313,8 @@ u32 XFsbl_GetDestinationDevice(const XFsblPs_PartitionHeader* PartitionHeader);
 u32 XFsbl_GetA53ExecState(const XFsblPs_PartitionHeader* PartitionHeader);
 u32 XFsbl_GetVectorLocation(const XFsblPs_PartitionHeader* PartitionHeader);
 u32 XFsbl_GetBlockSize(const XFsblPs_PartitionHeader* PartitionHeader);
+u32 XFsbl_IsCompressed(const XFsblPs_PartitionHeader* PartitionHeader);
+u32 XFsbl_IsEarlyHandoff(const XFsblPs_PartitionHeader* PartitionHeader);
 
 u32 XFsbl_ValidateChecksum(u32 Buffer[], u32 Length);
 u32 XFsbl_ReadImageHeader(XFsblPs_ImageHeader* ImageHeader,
@@ -51,6 +51,15 @@
  *                     avoid speculative accesses
  * 9.0   bsv  10/15/21 Fixed bug to support secondary boot with non-zero
  *                     multiboot offset
+ * 10.0  dd   10/16/26 Read headers through the boot device read-ahead cache
+ *       dd   10/16/26 Added XFsbl_EccInit using the ZDMA fill
+ *       dd   10/16/26 Install the CSU SHA3 engine for partition checksums
+ *       dd   10/16/26 Record the boot device and DDR ECC initializations in
+ *                     the boot timeline
+ *       dd   10/16/26 Start the background DDR ECC initialization, which
+ *                     maps the DDR as it is written
+ *       dd   10/16/26 Mark the DDR as memory with the background DDR ECC
+ *                     initialization too, the MMU is off
  *
  * </pre>
  *
@@ -60,12 +69,16 @@
 
 /***************************** Include Files *********************************/
 #include "xfsbl_board.h"
+#include "xfsbl_ddr_ecc.h"
 #include "xfsbl_ddr_init.h"
 #include "xfsbl_hooks.h"
 #include "xfsbl_hw.h"
 #include "xfsbl_main.h"
 #include "xfsbl_misc_drivers.h"
+#include "xfsbl_perf.h"
 #include "xfsbl_qspi.h"
+#include "xfsbl_sha3.h"
+#include "xfsbl_zdma.h"
 #include "xil_cache.h"
 #include "xil_mmu.h"
 
@@ -89,6 +102,9 @@ static u32 retrieveBootHeader(XFsblPs* const FsblInstancePtr);
 static u32 XFsbl_ValidateHeader(XFsblPs* FsblInstancePtr);
 #endif
 static u32 XFsbl_DdrEccInit(void);
+#if (XPAR_PSU_DDRC_0_HAS_ECC) && !defined(XFSBL_DDR_ECC_LAZY)
+static u32 XFsbl_EccInit(u64 DestAddr, u64 LengthBytes);
+#endif
 static void XFsbl_EnableProgToPL(void);
 static void XFsbl_ClearPendingInterrupts(void);
 
@@ -236,6 +252,11 @@ u32 XFsbl_Initialize(XFsblPs* const FsblInstancePtr) {
   XFsbl_Out32(CSU_AES_RESET, CSU_AES_RESET_RESET_MASK);
   XFsbl_Out32(CSU_SHA_RESET, CSU_SHA_RESET_RESET_MASK);
 
+#ifdef XFSBL_CSU_SHA3
+  /* SHA3 partition checksums are computed by the CSU SHA3 engine */
+  XFsbl_Sha3SetEngine(&XFsbl_CsuSha3Engine);
+#endif
+
   /**
    * Print the FSBL banner
    */
@@ -587,6 +608,7 @@ END:
 static u32 XFsbl_PrimaryBootDeviceInit(XFsblPs* const FsblInstancePtr) {
   u32 Status;
   u32 BootMode;
+  XTime DeviceInitStart;
 
   /**
    * Read Boot Mode register and update the value
@@ -611,6 +633,9 @@ static u32 XFsbl_PrimaryBootDeviceInit(XFsblPs* const FsblInstancePtr) {
     FsblInstancePtr->DeviceOps.DeviceInit = XFsbl_Qspi24Init;
     FsblInstancePtr->DeviceOps.DeviceCopy = XFsbl_Qspi24Copy;
     FsblInstancePtr->DeviceOps.DeviceRelease = XFsbl_Qspi24Release;
+    FsblInstancePtr->DeviceOps.DeviceCopySubmit = XFsbl_QspiCopySubmit;
+    FsblInstancePtr->DeviceOps.DeviceCopyPoll = XFsbl_QspiCopyPoll;
+    FsblInstancePtr->DeviceOps.DeviceCopyWait = XFsbl_QspiCopyWait;
     Status = XFSBL_SUCCESS;
   } break;
 
@@ -620,6 +645,9 @@ static u32 XFsbl_PrimaryBootDeviceInit(XFsblPs* const FsblInstancePtr) {
     FsblInstancePtr->DeviceOps.DeviceInit = XFsbl_Qspi32Init;
     FsblInstancePtr->DeviceOps.DeviceCopy = XFsbl_Qspi32Copy;
     FsblInstancePtr->DeviceOps.DeviceRelease = XFsbl_Qspi32Release;
+    FsblInstancePtr->DeviceOps.DeviceCopySubmit = XFsbl_QspiCopySubmit;
+    FsblInstancePtr->DeviceOps.DeviceCopyPoll = XFsbl_QspiCopyPoll;
+    FsblInstancePtr->DeviceOps.DeviceCopyWait = XFsbl_QspiCopyWait;
     Status = XFSBL_SUCCESS;
   } break;
 
@@ -637,6 +665,7 @@ static u32 XFsbl_PrimaryBootDeviceInit(XFsblPs* const FsblInstancePtr) {
     FsblInstancePtr->DeviceOps.DeviceInit = XFsbl_SdInit;
     FsblInstancePtr->DeviceOps.DeviceCopy = XFsbl_SdCopy;
     FsblInstancePtr->DeviceOps.DeviceRelease = XFsbl_SdRelease;
+    FsblInstancePtr->DeviceOps.DeviceCopySubmit = NULL;
     Status = XFSBL_SUCCESS;
 #else
     /**
@@ -661,6 +690,7 @@ static u32 XFsbl_PrimaryBootDeviceInit(XFsblPs* const FsblInstancePtr) {
     FsblInstancePtr->DeviceOps.DeviceInit = XFsbl_SdInit;
     FsblInstancePtr->DeviceOps.DeviceCopy = XFsbl_SdCopy;
     FsblInstancePtr->DeviceOps.DeviceRelease = XFsbl_SdRelease;
+    FsblInstancePtr->DeviceOps.DeviceCopySubmit = NULL;
     Status = XFSBL_SUCCESS;
 #else
     /**
@@ -687,10 +717,12 @@ static u32 XFsbl_PrimaryBootDeviceInit(XFsblPs* const FsblInstancePtr) {
   /**
    * Initialize the Device Driver
    */
+  DeviceInitStart = XFsbl_PerfNow();
   Status = FsblInstancePtr->DeviceOps.DeviceInit(BootMode);
   if (XFSBL_SUCCESS != Status) {
     goto END;
   }
+  XFsbl_PerfRecord(XFSBL_PERF_EVENT_BOOT_DEVICE, BootMode, DeviceInitStart, 0U);
 
 END:
   return Status;
@@ -730,8 +762,9 @@ static u32 retrieveBootHeader(XFsblPs* const FsblInstancePtr) {
   FlashImageOffsetAddress = FsblInstancePtr->ImageOffsetAddress;
 
   /* Copy boot header to internal memory */
-  Status = FsblInstancePtr->DeviceOps.DeviceCopy(
-      FlashImageOffsetAddress, (PTRSIZE)ReadBuffer, XIH_BH_MAX_SIZE);
+  Status = XFsbl_DeviceCachedCopy(&FsblInstancePtr->DeviceOps,
+                                  FlashImageOffsetAddress, (PTRSIZE)ReadBuffer,
+                                  XIH_BH_MAX_SIZE);
   if (XFSBL_SUCCESS != Status) {
     XFsbl_Printf(DEBUG_GENERAL, "Device Copy Failed \n\r");
     goto END;
@@ -821,7 +854,8 @@ static u32 XFsbl_ValidateHeader(XFsblPs* FsblInstancePtr) {
     XFsbl_Printf(DEBUG_INFO, "Authentication Enabled\r\n");
 
     /* Read AC offset from Image header table */
-    Status = FsblInstancePtr->DeviceOps.DeviceCopy(
+    Status = XFsbl_DeviceCachedCopy(
+        &FsblInstancePtr->DeviceOps,
         FlashImageOffsetAddress + ImageHeaderTableAddressOffset +
             XIH_IHT_AC_OFFSET,
         (PTRSIZE)&AcOffset, XIH_FIELD_LEN);
@@ -831,7 +865,8 @@ static u32 XFsbl_ValidateHeader(XFsblPs* FsblInstancePtr) {
     }
     if (AcOffset != 0x00U) {
       /* Authentication exists copy AC to OCM */
-      Status = FsblInstancePtr->DeviceOps.DeviceCopy(
+      Status = XFsbl_DeviceCachedCopy(
+          &FsblInstancePtr->DeviceOps,
           (FsblInstancePtr->ImageOffsetAddress +
            (AcOffset * XIH_PARTITION_WORD_LENGTH)),
           (INTPTR)AuthBuffer, XFSBL_AUTH_CERT_MIN_SIZE);
@@ -870,7 +905,8 @@ static u32 XFsbl_ValidateHeader(XFsblPs* FsblInstancePtr) {
       }
 
       /* Copy the Image header to OCM */
-      Status = FsblInstancePtr->DeviceOps.DeviceCopy(
+      Status = XFsbl_DeviceCachedCopy(
+          &FsblInstancePtr->DeviceOps,
           FsblInstancePtr->ImageOffsetAddress + ImageHeaderTableAddressOffset,
           (INTPTR)ImageHdr, Size);
       if (Status != XFSBL_SUCCESS) {
@@ -911,9 +947,39 @@ END:
 }
 #endif
 
+#if (XPAR_PSU_DDRC_0_HAS_ECC) && !defined(XFSBL_DDR_ECC_LAZY)
 /*****************************************************************************/
 /**
- * This function does ECC Initialization of DDR memory
+ * This function initializes the ECC of a memory range by writing it with
+ * the ZDMA engine
+ *
+ * @param	DestAddr is the start of the range
+ * @param	LengthBytes is the length of the range
+ *
+ * @return
+ * 		- XFSBL_SUCCESS for successful ECC Initialization
+ * 		- errors as mentioned in xfsbl_error.h
+ *
+ *****************************************************************************/
+static u32 XFsbl_EccInit(u64 DestAddr, u64 LengthBytes) {
+  XFsbl_Printf(DEBUG_INFO, "Address 0x%0lx, Length %0lx, ECC initializing\n\r",
+               DestAddr, LengthBytes);
+
+  const u32 Status = XFsbl_ZDmaFill(DestAddr, 0xDEADBEEFU, LengthBytes);
+  if (XFSBL_SUCCESS == Status) {
+    XFsbl_Printf(DEBUG_INFO, "Address 0x%0lx, Length %0lx, ECC initialized\n\r",
+                 DestAddr, LengthBytes);
+  }
+
+  return Status;
+}
+#endif
+
+/*****************************************************************************/
+/**
+ * This function does ECC Initialization of DDR memory. With
+ * XFSBL_DDR_ECC_LAZY it is only started, the DDR is initialized in the
+ * background.
  *
  * @param none
  *
@@ -925,11 +991,19 @@ END:
  *****************************************************************************/
 static u32 XFsbl_DdrEccInit(void) {
   u32 Status;
-#if XPAR_PSU_DDRC_0_HAS_ECC
+#if defined(XFSBL_DDR_ECC_LAZY)
+  Status = XFsbl_DdrEccStart();
+  if (XFSBL_SUCCESS != Status) {
+    Status = XFSBL_ERROR_DDR_ECC_INIT;
+    XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_DDR_ECC_INIT\n\r");
+  }
+#elif XPAR_PSU_DDRC_0_HAS_ECC
   u64 LengthBytes =
       (XFSBL_PS_DDR_END_ADDRESS - XFSBL_PS_DDR_INIT_START_ADDRESS) + 1;
   u64 DestAddr = XFSBL_PS_DDR_INIT_START_ADDRESS;
 
+  XTime Start = XFsbl_PerfNow();
+
   XFsbl_Printf(DEBUG_GENERAL, "Initializing DDR ECC\n\r");
 
   Status = XFsbl_EccInit(DestAddr, LengthBytes);
@@ -938,12 +1012,14 @@ static u32 XFsbl_DdrEccInit(void) {
     XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_DDR_ECC_INIT\n\r");
     goto END;
   }
+  XFsbl_PerfRecord(XFSBL_PERF_EVENT_DDR_ECC, 0U, Start, LengthBytes);
 
   /* If there is upper PS DDR, initialize its ECC */
 #  ifdef XFSBL_PS_HI_DDR_START_ADDRESS
   LengthBytes =
       (XFSBL_PS_HI_DDR_END_ADDRESS - XFSBL_PS_HI_DDR_START_ADDRESS) + 1;
   DestAddr = XFSBL_PS_HI_DDR_START_ADDRESS;
+  Start = XFsbl_PerfNow();
 
   Status = XFsbl_EccInit(DestAddr, LengthBytes);
   if (XFSBL_SUCCESS != Status) {
@@ -951,6 +1027,7 @@ static u32 XFsbl_DdrEccInit(void) {
     XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_DDR_ECC_INIT\n\r");
     goto END;
   }
+  XFsbl_PerfRecord(XFSBL_PERF_EVENT_DDR_ECC, 1U, Start, LengthBytes);
 #  endif
 END:
 #else
@@ -0,0 +1,263 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_log.c
+ *
+ * This is the file which contains the deferred log of XFSBL_DEFERRED_LOG.
+ *
+ * The FSBL outbyte() replaces the one of the BSP, which waits for room in
+ * the UART TX FIFO for every character. It stores the character in a log
+ * buffer in the FSBL OCM data, and the buffer is drained to the UART FIFO
+ * without waiting by XFsbl_LogDrain(), called from the loops in which the
+ * FSBL waits for the hardware and between the boot stages. The FSBL runs
+ * with interrupts disabled, so the FIFO is polled rather than refilled from
+ * its empty interrupt. Only a full buffer makes a print wait for the UART.
+ *
+ * With XFSBL_LOG_MEMORY_ONLY nothing is sent to the UART, the buffer keeps
+ * the end of the log for the OS.
+ *
+ * XFsbl_LogToken() writes the records of the tokenized prints of
+ * XFSBL_LOG_TOKENS, described in xfsbl_log_token.h, with outbyte().
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *       dd   10/16/26 Added XFsbl_LogToken
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xfsbl_log.h"
+
+#ifdef XFSBL_LOG_TOKENS
+#  include <stdarg.h>
+#endif
+
+#ifdef XFSBL_DEFERRED_LOG
+#  include "xfsbl_misc.h"
+#  include "xil_cache.h"
+#  include "xuartps_hw.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+#ifdef XFSBL_LOG_TOKENS
+/* Longest string argument of a tokenized print */
+#  define XFSBL_LOG_STRING_MAX (255U)
+#endif
+
+#ifdef XFSBL_DEFERRED_LOG
+#  if ((XFSBL_LOG_BUFFER_SIZE & (XFSBL_LOG_BUFFER_SIZE - 1U)) != 0U)
+#    error "XFSBL_LOG_BUFFER_SIZE must be a power of two"
+#  endif
+
+#  define XFSBL_LOG_INDEX(Count) ((Count) & (XFSBL_LOG_BUFFER_SIZE - 1U))
+#endif
+
+/**************************** Type Definitions *******************************/
+#ifdef XFSBL_DEFERRED_LOG
+typedef struct {
+  XFsblPs_LogHeader Header;
+  u8 Data[XFSBL_LOG_BUFFER_SIZE];
+} __attribute__((aligned(64))) XFsblPs_LogBuffer;
+#endif
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+#if defined(XFSBL_DEFERRED_LOG) || defined(XFSBL_LOG_TOKENS)
+void outbyte(char c);
+#endif
+
+/************************** Variable Definitions *****************************/
+#ifdef XFSBL_DEFERRED_LOG
+static XFsblPs_LogBuffer LogBuffer;
+
+/*****************************************************************************/
+/**
+ * This function completes the log buffer header and publishes its OCM
+ * address. Characters printed before are kept.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_LogInit(void) {
+  LogBuffer.Header.Magic = XFSBL_LOG_MAGIC;
+  LogBuffer.Header.Size = XFSBL_LOG_BUFFER_SIZE;
+
+  XFsbl_Out32(XFSBL_LOG_REGISTER, (u32)(UINTPTR)&LogBuffer);
+}
+
+/*****************************************************************************/
+/**
+ * This function is the character output of xil_printf(). It stores the
+ * character in the log buffer, waiting for the UART to free the oldest
+ * character of a full buffer unless the log is kept in memory only.
+ *
+ * @param	c is the character
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void outbyte(char c) {
+#  if (XFSBL_LOG_MEMORY_ONLY == 0U)
+  while ((LogBuffer.Header.Head - LogBuffer.Header.Tail) ==
+         XFSBL_LOG_BUFFER_SIZE) {
+    XFsbl_LogDrain();
+  }
+#  endif
+
+  LogBuffer.Data[XFSBL_LOG_INDEX(LogBuffer.Header.Head)] = (u8)c;
+  LogBuffer.Header.Head++;
+}
+
+/*****************************************************************************/
+/**
+ * This function sends logged characters to the UART until its TX FIFO is
+ * full, without waiting.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_LogDrain(void) {
+#  if (XFSBL_LOG_MEMORY_ONLY == 0U)
+  while ((LogBuffer.Header.Tail != LogBuffer.Header.Head) &&
+         (XUartPs_IsTransmitFull(STDOUT_BASEADDRESS) == FALSE)) {
+    XUartPs_WriteReg(STDOUT_BASEADDRESS, XUARTPS_FIFO_OFFSET,
+                     LogBuffer.Data[XFSBL_LOG_INDEX(LogBuffer.Header.Tail)]);
+    LogBuffer.Header.Tail++;
+  }
+#  endif
+}
+
+/*****************************************************************************/
+/**
+ * This function sends the whole log to the UART and waits until it is out
+ * of the TX FIFO, before a reset or the FSBL exit.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_LogFlush(void) {
+#  if (XFSBL_LOG_MEMORY_ONLY == 0U)
+  while (LogBuffer.Header.Tail != LogBuffer.Header.Head) {
+    XFsbl_LogDrain();
+  }
+
+  while ((XUartPs_ReadReg(STDOUT_BASEADDRESS, XUARTPS_SR_OFFSET) &
+          XUARTPS_SR_TXEMPTY) == 0U) {
+    ;
+  }
+#  endif
+}
+
+/*****************************************************************************/
+/**
+ * This function flushes the log and publishes the log buffer for the OS,
+ * in DDR at XFSBL_LOG_ADDRESS when it is set. Nothing is printed after it.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_LogPublish(void) {
+  UINTPTR Address = (UINTPTR)&LogBuffer;
+
+  XFsbl_LogFlush();
+
+#  if (XFSBL_LOG_ADDRESS != 0U)
+  Address = (UINTPTR)XFSBL_LOG_ADDRESS;
+  (void)XFsbl_MemCpy((void*)Address, &LogBuffer, sizeof(LogBuffer));
+#  endif
+  Xil_DCacheFlushRange((INTPTR)Address, sizeof(LogBuffer));
+
+  XFsbl_Out32(XFSBL_LOG_REGISTER, (u32)Address);
+}
+#endif /* XFSBL_DEFERRED_LOG */
+
+#ifdef XFSBL_LOG_TOKENS
+/*****************************************************************************/
+/**
+ * This function writes the little endian bytes of a value.
+ *
+ * @param	Value is the value
+ *
+ * @param	Bytes is the number of bytes written
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_LogTokenValue(u64 Value, u32 Bytes) {
+  for (u32 Index = 0U; Index < Bytes; Index++) {
+    outbyte((char)(u8)(Value >> (8U * Index)));
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function writes the record of a tokenized print, XFsbl_Printf()
+ * calls it through XFSBL_LOG_TOKENIZED.
+ *
+ * @param	Token is the XFSBL_LOG_TOKEN of the format string
+ *
+ * @param	Types is the XFSBL_LOG_TYPES of the arguments
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_LogToken(u32 Token, u32 Types, ...) {
+  const u32 Count = Types & XFSBL_LOG_ARGC_MASK;
+  const char* String;
+  va_list Args;
+  u32 Length;
+
+  outbyte((char)XFSBL_LOG_TOKEN_SYNC);
+  XFsbl_LogTokenValue(Token, 4U);
+  outbyte((char)Count);
+  for (u32 Index = 0U; Index < Count; Index += 4U) {
+    outbyte((char)(u8)(Types >> XFSBL_LOG_ARG_TYPE_SHIFT(Index)));
+  }
+
+  va_start(Args, Types);
+  for (u32 Index = 0U; Index < Count; Index++) {
+    switch ((Types >> XFSBL_LOG_ARG_TYPE_SHIFT(Index)) & 0x3U) {
+    case XFSBL_LOG_ARG_INT64:
+      XFsbl_LogTokenValue(va_arg(Args, u64), 8U);
+      break;
+    case XFSBL_LOG_ARG_STRING:
+      String = va_arg(Args, const char*);
+      Length = 0U;
+      while ((String != NULL) && (Length < XFSBL_LOG_STRING_MAX) &&
+             (String[Length] != '\0')) {
+        Length++;
+      }
+      outbyte((char)Length);
+      for (u32 Char = 0U; Char < Length; Char++) {
+        outbyte(String[Char]);
+      }
+      break;
+    default:
+      XFsbl_LogTokenValue(va_arg(Args, u32), 4U);
+      break;
+    }
+  }
+  va_end(Args);
+}
+#endif /* XFSBL_LOG_TOKENS */
@@ -0,0 +1,73 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_log.h
+ *
+ * This is the header file of the deferred log of XFSBL_DEFERRED_LOG. The
+ * characters xil_printf() formats are stored in a log buffer instead of
+ * waiting for the UART, XFsbl_LogDrain() sends them while the FSBL waits
+ * for the hardware and XFsbl_LogPublish() hands the buffer over when the
+ * FSBL exits. Without XFSBL_DEFERRED_LOG the functions are empty.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef XFSBL_LOG_H
+#define XFSBL_LOG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xfsbl_hw.h"
+
+/************************** Constant Definitions *****************************/
+#define XFSBL_LOG_MAGIC (0x474F4C46U) /* "FLOG" */
+
+/**************************** Type Definitions *******************************/
+/**
+ * Log buffer header, followed by Size bytes of log. Head is the number of
+ * bytes logged, byte N is at offset N % Size and the last Size of them are
+ * kept. Tail is the number of bytes sent to the UART.
+ */
+typedef struct {
+  u32 Magic;
+  u32 Size;
+  u32 Head;
+  u32 Tail;
+} XFsblPs_LogHeader;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+#ifdef XFSBL_DEFERRED_LOG
+void XFsbl_LogInit(void);
+void XFsbl_LogDrain(void);
+void XFsbl_LogFlush(void);
+void XFsbl_LogPublish(void);
+#else
+static inline void XFsbl_LogInit(void) {}
+static inline void XFsbl_LogDrain(void) {}
+static inline void XFsbl_LogFlush(void) {}
+static inline void XFsbl_LogPublish(void) {}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_LOG_H */
@@ -0,0 +1,220 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_log_token.h
+ *
+ * This is the header file of the tokenized prints of XFSBL_LOG_TOKENS.
+ *
+ * XFsbl_Printf() does not format its string on the target. The token of the
+ * format string, a 65599 hash of its length and of its first
+ * XFSBL_LOG_TOKEN_HASH_LEN characters, is computed by the compiler and sent
+ * with the raw arguments. The format string itself is only kept in the
+ * .xfsbl_log_tokens section of the ELF file, which is not loaded, and
+ * tools/xfsbl_log/xfsbl_log_decode formats the records from it on the host.
+ *
+ * A record is the byte XFSBL_LOG_TOKEN_SYNC, the token, the number of
+ * arguments, their XFSBL_LOG_ARG_* types 2 bits each and four per byte,
+ * then the arguments: 4 or 8 bytes for an integer, a length byte and at
+ * most 255 characters for a string. Values are little endian.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef XFSBL_LOG_TOKEN_H
+#define XFSBL_LOG_TOKEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+#define XFSBL_LOG_TOKEN_SYNC (0xFEU)
+#define XFSBL_LOG_TOKEN_MAGIC (0x4E4B5446U) /* "FTKN" */
+#define XFSBL_LOG_TOKEN_HASH_LEN (80U)
+
+/* Argument types */
+#define XFSBL_LOG_ARG_INT (0U)
+#define XFSBL_LOG_ARG_INT64 (1U)
+#define XFSBL_LOG_ARG_STRING (2U)
+
+/* A print has at most XFSBL_LOG_ARGS_MAX arguments */
+#define XFSBL_LOG_ARGS_MAX (8U)
+#define XFSBL_LOG_ARGC_MASK (0xFU)
+#define XFSBL_LOG_ARG_TYPE_SHIFT(Index) (4U + (2U * (Index)))
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+/* Character Index of the string literal Str, 0 past its end */
+#define XFSBL_LOG_HASH_CHAR(Str, Index)                          \
+  (((Index) < (sizeof(Str) - 1U))                                \
+       ? (u32)(u8)(Str)[((Index) < sizeof(Str)) ? (Index) : 0U] \
+       : 0U)
+
+/* Token of the string literal Str, folded to a constant by the compiler */
+#define XFSBL_LOG_TOKEN(Str) \
+  ((u32)(sizeof(Str) - 1U) + \
+   XFSBL_LOG_HASH_CHAR(Str, 0U) * 0x0001003FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 1U) * 0x007E0F81U + \
+   XFSBL_LOG_HASH_CHAR(Str, 2U) * 0x2E86D0BFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 3U) * 0x43EC5F01U + \
+   XFSBL_LOG_HASH_CHAR(Str, 4U) * 0x162C613FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 5U) * 0xD62AEE81U + \
+   XFSBL_LOG_HASH_CHAR(Str, 6U) * 0xA311B1BFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 7U) * 0xD319BE01U + \
+   XFSBL_LOG_HASH_CHAR(Str, 8U) * 0xB156C23FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 9U) * 0x6698CD81U + \
+   XFSBL_LOG_HASH_CHAR(Str, 10U) * 0x0D1B92BFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 11U) * 0xCC881D01U + \
+   XFSBL_LOG_HASH_CHAR(Str, 12U) * 0x7280233FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 13U) * 0x50C7AC81U + \
+   XFSBL_LOG_HASH_CHAR(Str, 14U) * 0x8DA473BFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 15U) * 0x4F377C01U + \
+   XFSBL_LOG_HASH_CHAR(Str, 16U) * 0xFAA8843FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 17U) * 0x33B78B81U + \
+   XFSBL_LOG_HASH_CHAR(Str, 18U) * 0x45AC54BFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 19U) * 0x7A27DB01U + \
+   XFSBL_LOG_HASH_CHAR(Str, 20U) * 0xEACFE53FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 21U) * 0xAE686A81U + \
+   XFSBL_LOG_HASH_CHAR(Str, 22U) * 0x563335BFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 23U) * 0x6C593A01U + \
+   XFSBL_LOG_HASH_CHAR(Str, 24U) * 0xE3F6463FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 25U) * 0x5FDA4981U + \
+   XFSBL_LOG_HASH_CHAR(Str, 26U) * 0xE03916BFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 27U) * 0x44CB9901U + \
+   XFSBL_LOG_HASH_CHAR(Str, 28U) * 0x871BA73FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 29U) * 0xE70D2881U + \
+   XFSBL_LOG_HASH_CHAR(Str, 30U) * 0x04BDF7BFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 31U) * 0x227EF801U + \
+   XFSBL_LOG_HASH_CHAR(Str, 32U) * 0x7540083FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 33U) * 0xE3010781U + \
+   XFSBL_LOG_HASH_CHAR(Str, 34U) * 0xE4C1D8BFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 35U) * 0x24735701U + \
+   XFSBL_LOG_HASH_CHAR(Str, 36U) * 0x4F63693FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 37U) * 0xF2B5E681U + \
+   XFSBL_LOG_HASH_CHAR(Str, 38U) * 0xA144B9BFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 39U) * 0x69A8B601U + \
+   XFSBL_LOG_HASH_CHAR(Str, 40U) * 0xB685CA3FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 41U) * 0xB52BC581U + \
+   XFSBL_LOG_HASH_CHAR(Str, 42U) * 0x5B469ABFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 43U) * 0x111F1501U + \
+   XFSBL_LOG_HASH_CHAR(Str, 44U) * 0x4BA72B3FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 45U) * 0xC962A481U + \
+   XFSBL_LOG_HASH_CHAR(Str, 46U) * 0x33C77BBFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 47U) * 0x39D67401U + \
+   XFSBL_LOG_HASH_CHAR(Str, 48U) * 0xAFC78C3FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 49U) * 0xCE5A8381U + \
+   XFSBL_LOG_HASH_CHAR(Str, 50U) * 0x4BC75CBFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 51U) * 0x02CED301U + \
+   XFSBL_LOG_HASH_CHAR(Str, 52U) * 0x83E6ED3FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 53U) * 0x63136281U + \
+   XFSBL_LOG_HASH_CHAR(Str, 54U) * 0xC4463DBFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 55U) * 0x8B083201U + \
+   XFSBL_LOG_HASH_CHAR(Str, 56U) * 0x69054E3FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 57U) * 0x268D4181U + \
+   XFSBL_LOG_HASH_CHAR(Str, 58U) * 0xBE441EBFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 59U) * 0xF1829101U + \
+   XFSBL_LOG_HASH_CHAR(Str, 60U) * 0x0022AF3FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 61U) * 0xB7C82081U + \
+   XFSBL_LOG_HASH_CHAR(Str, 62U) * 0x5AC0FFBFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 63U) * 0x553DF001U + \
+   XFSBL_LOG_HASH_CHAR(Str, 64U) * 0xEA3F103FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 65U) * 0xB5C3FF81U + \
+   XFSBL_LOG_HASH_CHAR(Str, 66U) * 0xBABCE0BFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 67U) * 0xD53A4F01U + \
+   XFSBL_LOG_HASH_CHAR(Str, 68U) * 0xC85A713FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 69U) * 0xBF80DE81U + \
+   XFSBL_LOG_HASH_CHAR(Str, 70U) * 0xFF37C1BFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 71U) * 0x9077AE01U + \
+   XFSBL_LOG_HASH_CHAR(Str, 72U) * 0x3B74D23FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 73U) * 0x73FEBD81U + \
+   XFSBL_LOG_HASH_CHAR(Str, 74U) * 0x4931A2BFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 75U) * 0xA5F60D01U + \
+   XFSBL_LOG_HASH_CHAR(Str, 76U) * 0xE48E333FU + \
+   XFSBL_LOG_HASH_CHAR(Str, 77U) * 0x723D9C81U + \
+   XFSBL_LOG_HASH_CHAR(Str, 78U) * 0xB9AA83BFU + \
+   XFSBL_LOG_HASH_CHAR(Str, 79U) * 0x34B56C01U)
+
+/**
+ * Database entry of the string literal Str, placed in the .xfsbl_log_tokens
+ * section that lscript.ld does not load
+ */
+#define XFSBL_LOG_TOKEN_ENTRY(Str)                                      \
+  static const struct {                                                 \
+    u32 Magic;                                                          \
+    u32 Length;                                                         \
+    char String[sizeof(Str)];                                           \
+  } XFsblLogTokenEntry                                                  \
+      __attribute__((section(".xfsbl_log_tokens"), used, aligned(4))) = \
+          {XFSBL_LOG_TOKEN_MAGIC, sizeof(Str) - 1U, Str}
+
+/* Type of a print argument */
+#define XFSBL_LOG_ARG_TYPE(Arg)                                   \
+  _Generic((Arg),                                                 \
+      char*: XFSBL_LOG_ARG_STRING,                                \
+      const char*: XFSBL_LOG_ARG_STRING,                          \
+      default: ((sizeof(Arg) == 8U) ? XFSBL_LOG_ARG_INT64         \
+                                    : XFSBL_LOG_ARG_INT))
+
+#define XFSBL_LOG_CAT(A, B) XFSBL_LOG_CAT_(A, B)
+#define XFSBL_LOG_CAT_(A, B) A##B
+
+/* Number of arguments, up to XFSBL_LOG_ARGS_MAX, without suffix to be pasted */
+#define XFSBL_LOG_NARGS(...) \
+  XFSBL_LOG_NARGS_(_, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define XFSBL_LOG_NARGS_(_, A1, A2, A3, A4, A5, A6, A7, A8, N, ...) N
+
+/* Argument count and types word of XFsbl_LogToken() */
+#define XFSBL_LOG_TYPES(...)              \
+  ((u32)XFSBL_LOG_NARGS(__VA_ARGS__) |    \
+   XFSBL_LOG_CAT(XFSBL_LOG_TYPES_, XFSBL_LOG_NARGS(__VA_ARGS__))(__VA_ARGS__))
+#define XFSBL_LOG_T(Arg, Index) \
+  ((u32)XFSBL_LOG_ARG_TYPE(Arg) << XFSBL_LOG_ARG_TYPE_SHIFT(Index))
+#define XFSBL_LOG_TYPES_0(...) (0U)
+#define XFSBL_LOG_TYPES_1(A) XFSBL_LOG_T(A, 0U)
+#define XFSBL_LOG_TYPES_2(A, B) (XFSBL_LOG_TYPES_1(A) | XFSBL_LOG_T(B, 1U))
+#define XFSBL_LOG_TYPES_3(A, B, C) \
+  (XFSBL_LOG_TYPES_2(A, B) | XFSBL_LOG_T(C, 2U))
+#define XFSBL_LOG_TYPES_4(A, B, C, D) \
+  (XFSBL_LOG_TYPES_3(A, B, C) | XFSBL_LOG_T(D, 3U))
+#define XFSBL_LOG_TYPES_5(A, B, C, D, E) \
+  (XFSBL_LOG_TYPES_4(A, B, C, D) | XFSBL_LOG_T(E, 4U))
+#define XFSBL_LOG_TYPES_6(A, B, C, D, E, F) \
+  (XFSBL_LOG_TYPES_5(A, B, C, D, E) | XFSBL_LOG_T(F, 5U))
+#define XFSBL_LOG_TYPES_7(A, B, C, D, E, F, G) \
+  (XFSBL_LOG_TYPES_6(A, B, C, D, E, F) | XFSBL_LOG_T(G, 6U))
+#define XFSBL_LOG_TYPES_8(A, B, C, D, E, F, G, H) \
+  (XFSBL_LOG_TYPES_7(A, B, C, D, E, F, G) | XFSBL_LOG_T(H, 7U))
+
+/* Tokenized print of the format string literal Fmt */
+#define XFSBL_LOG_TOKENIZED(Fmt, ...)                                 \
+  do {                                                                \
+    XFSBL_LOG_TOKEN_ENTRY(Fmt);                                       \
+    XFsbl_LogToken(XFSBL_LOG_TOKEN(Fmt), XFSBL_LOG_TYPES(__VA_ARGS__), \
+                   ##__VA_ARGS__);                                    \
+  } while (0)
+
+/************************** Function Prototypes ******************************/
+void XFsbl_LogToken(u32 Token, u32 Types, ...);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_LOG_TOKEN_H */
@@ -18,6 +18,13 @@
  * 3.0   bv   03/03/21 Print multiboot offset in FSBL banner
  *       bsv  04/28/21 Added support to ensure authenticated images boot as
  *                     non-secure when RSA_EN is not programmed
+ * 4.0   dd   10/16/26 Release the boot device before fallback
+ *       dd   10/16/26 Early handoff once the image of a CPU is loaded
+ *       dd   10/16/26 Record the stages in the boot timeline, implemented
+ *                     XFsbl_MeasurePerfTime
+ *       dd   10/16/26 Drain the deferred log between the stages
+ *       dd   10/16/26 Slow the calibrated QSPI clock down on a checksum
+ *                     failure before fallback
  *
  * </pre>
  *
@@ -31,6 +38,9 @@
 #include "bspconfig.h"
 #include "psu_init.h"
 #include "xfsbl_hw.h"
+#include "xfsbl_log.h"
+#include "xfsbl_perf.h"
+#include "xfsbl_qspi.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -64,14 +74,24 @@ static void load_artifacts(XFsblPs* const FsblInstance,
   } else {
     if (stage->PartitionNum <
         (FsblInstance->ImageHeader.ImageHeaderTable.NoOfPartitions - 1U)) {
-      stage->PartitionNum++;
+      /**
+       * Release the CPU of a complete image right away if it asks for an
+       * early handoff, perform_handoff() comes back to the next partition
+       */
+      stage->EarlyHandoff =
+          XFsbl_CheckEarlyHandoff(FsblInstance, stage->PartitionNum);
+      if (stage->EarlyHandoff == (u32)TRUE) {
+        stage->FsblStage = XFSBL_HANDOFF;
+      } else {
+        stage->PartitionNum++;
+      }
     } else {
       XFsbl_Printf(DEBUG_GENERAL,
                    "All Partitions "
                    "Loaded \n\r");
 
       stage->FsblStage = XFSBL_HANDOFF;
-      stage->EarlyHandoff = stage->FsblStageStatus;
+      stage->EarlyHandoff = FALSE;
     }
   }
 }
@@ -129,6 +149,7 @@ static void perform_handoff(const XFsblPs* const FsblInstance,
                  "partitions \n\r");
 
     stage->PartitionNum++;
+    stage->EarlyHandoff = FALSE;
     stage->FsblStage = XFSBL_PARTITION_LOAD;
   } else if (XFSBL_STATUS_CONTINUE_OTHER_HANDOFF == stage->FsblStageStatus) {
     XFsbl_Printf(DEBUG_INFO,
@@ -189,7 +210,20 @@ int main(void) {
 #  error "FSBL should be generated using only EL3 BSP"
 #endif
 
+  XFsbl_LogInit();
+#if defined(XFSBL_PERF)
+  XTime_GetTime(&FsblInstance.PerfTime.tFsblStart);
+#endif
+  XFsbl_PerfInit();
+
   while (FsblStagesVal.FsblStage <= XFSBL_STAGE_POST_HANDOFF) {
+    /**
+     * Every pass of a stage is recorded once it is left, the final handoff
+     * does not come back and is recorded by XFsbl_Handoff()
+     */
+    const u32 Stage = FsblStagesVal.FsblStage;
+    const XTime StageStart = XFsbl_PerfNow();
+
     switch (FsblStagesVal.FsblStage) {
     case SYSTEM_INIT:
       print_stage_status(&FsblStagesVal);
@@ -239,6 +273,9 @@ int main(void) {
 
     } /* End of switch(FsblStage) */
 
+    XFsbl_PerfRecord(XFSBL_PERF_EVENT_STAGE, Stage, StageStart, 0U);
+    XFsbl_LogDrain();
+
     if (FsblStagesVal.FsblStage == XFSBL_STAGE_POST_HANDOFF) {
       break;
     }
@@ -253,6 +290,28 @@ int main(void) {
   return 0;
 }
 
+#if defined(XFSBL_PERF)
+/*****************************************************************************/
+/**
+ * This function prints the time elapsed since tCur, the caller prints what
+ * was measured after it.
+ *
+ * @param tCur is the XTime_GetTime() of the start of the measure
+ *
+ * @return none
+ *
+ *****************************************************************************/
+void XFsbl_MeasurePerfTime(XTime tCur) {
+  XTime tEnd = 0U;
+
+  XTime_GetTime(&tEnd);
+  const u64 Us = ((tEnd - tCur) * 1000000U) / COUNTS_PER_SECOND;
+
+  XFsbl_Printf(DEBUG_PRINT_ALWAYS, "%u.%03u ms", (u32)(Us / 1000U),
+               (u32)(Us % 1000U));
+}
+#endif
+
 /*****************************************************************************/
 /**
  * This function is called in FSBL error cases. Error status
@@ -320,6 +379,20 @@ static void XFsbl_FallBack(void) {
   /* Hook before FSBL Fallback */
   (void)XFsbl_HookBeforeFallback();
 
+#ifdef XFSBL_QSPI_CALIB
+  /* A checksum failure may be a misread at the calibrated QSPI clock */
+  u32 Error = FsblInstance.ErrorCode & ~XFSBL_ERROR_HANDOFF_FAILED;
+  if ((Error == XFSBL_ERROR_PH_CHECKSUM_FAILED) ||
+      (Error == XFSBL_ERROR_PARTITION_CHECKSUM_FAILED)) {
+    (void)XFsbl_QspiCalibFallback();
+  }
+#endif
+
+  /* Leave the boot device in the state the BootROM reads it in */
+  if (FsblInstance.DeviceOps.DeviceRelease != NULL) {
+    (void)FsblInstance.DeviceOps.DeviceRelease();
+  }
+
   /* Read the Multiboot register */
   u32 RegValue = XFsbl_In32(CSU_CSU_MULTI_BOOT);
 
@@ -366,6 +439,10 @@ static void XFsbl_UpdateMultiBoot(u32 MultiBootValue) {
   if (XFSBL_MASTER_ONLY_RESET != FsblInstance.ResetReason) {
     /* Soft reset the system */
     XFsbl_Printf(DEBUG_GENERAL, "Performing System Soft Reset\n\r");
+
+    /* Nothing of the log is sent after the reset */
+    XFsbl_LogFlush();
+
     RegValue = XFsbl_In32(CRL_APB_RESET_CTRL);
     XFsbl_Out32(CRL_APB_RESET_CTRL,
                 RegValue | CRL_APB_RESET_CTRL_SOFT_RESET_MASK);
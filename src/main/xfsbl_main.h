@@ -22,6 +22,9 @@
  *                     non-secure when RSA_EN is not programmed
  * 4.00  bsv  10/15/21 Fixed bug to support secondary boot with non-zero
  *                     multiboot offset
+ * 5.00  dd   10/16/26 Added the early handoff argument of
+ *                     XFsbl_HandoffExecute
+ *       dd   10/16/26 Added the FSBL start time to the instance
  *
  * </pre>
  *
@@ -85,6 +88,9 @@ typedef struct {
   u32 ResetReason;                 /**< Reset reason */
   XFsblPs_HandoffValues HandoffValues[10];
   /**< Handoff address for different CPU's  */
+#if defined(XFSBL_PERF)
+  XFsblPs_Perf PerfTime; /**< FSBL execution time */
+#endif
 } XFsblPs;
 
 typedef struct {
@@ -221,8 +227,9 @@ void handoff_within_running_core(u32 CpuHandoffAddress,
 void HandoffJtagMode(const XFsblPs* const FsblInstancePtr);
 
 u32 XFsbl_HandoffExecute(const XFsblPs* const FsblInstancePtr,
-                         u32 PartitionNum);
-u32 XFsbl_CheckEarlyHandoff(XFsblPs* const FsblInstancePtr, u32 PartitionNum);
+                         u32 PartitionNum, u32 EarlyHandoff);
+u32 XFsbl_CheckEarlyHandoff(const XFsblPs* const FsblInstancePtr,
+                            u32 PartitionNum);
 
 u32 XFsbl_CheckHandoffCpu(const XFsblPs* const FsblInstancePtr,
                           u32 DestinationCpu);
@@ -18,6 +18,13 @@
  * 1.00  kc   10/21/13 Initial release
  * 2.0   bv   12/02/16 Made compliance to MISRAC 2012 guidelines
  *       vns  01/29/17 Added API XFsbl_AdmaCopy to transfer data using ADMA
+ * 3.0   dd   10/16/26 Added XFsbl_Crc32
+ *       dd   10/16/26 Removed XFsbl_Crc32, XFsbl_Crc32C is used instead
+ *       dd   10/16/26 XFsbl_AdmaCopy uses the multi-channel ZDMA engine
+ *       dd   10/16/26 XFsbl_MemCpy uses the Xil_MemCpy block copy
+ *       dd   10/16/26 XFsbl_PollTimeout drains the deferred log
+ *       dd   10/16/26 XFsbl_PollTimeout moved to xfsbl_misc.h, PMU requests
+ *                     poll on a deadline
  *
  * </pre>
  *
@@ -27,7 +34,10 @@
 
 /***************************** Include Files *********************************/
 #include "xfsbl_hw.h"
+#include "xfsbl_log.h"
 #include "xfsbl_main.h"
+#include "xfsbl_zdma.h"
+#include "xil_mem.h"
 #include "xil_exception.h"
 
 /************************** Constant Definitions *****************************/
@@ -185,25 +195,17 @@ END:
 
 /*****************************************************************************/
 /**
+ * This function copies memory, see Xil_MemCpy
  *
+ * @param	DestPtr is the destination buffer
+ * @param	SrcPtr is the source buffer, not overlapping DestPtr
+ * @param	Len is the number of bytes to be copied
  *
- *
- * @param	None
- *
- * @return	None
+ * @return	DestPtr
  *
  ******************************************************************************/
 void* XFsbl_MemCpy(void* DestPtr, const void* SrcPtr, u32 Len) {
-  u8* Dst = DestPtr;
-  const u8* Src = SrcPtr;
-
-  /* Loop and copy.  */
-  while (Len != 0U) {
-    *Dst = *Src;
-    Dst++;
-    Src++;
-    Len--;
-  }
+  Xil_MemCpy(DestPtr, SrcPtr, Len);
 
   return DestPtr;
 }
@@ -500,13 +502,12 @@ void XFsbl_RegisterHandlers(void) {
  * @param	Mask of Island(s) that need to be powered up
  *
  * @return	XFSBL_SUCCESS for successful power up or
- * 		    XFSBL_FAILURE otherwise.
+ * 		    XFSBL_ERROR_POLL_TIMEOUT otherwise.
  *
  * @note		None.
  *
  ****************************************************************************/
 u32 XFsbl_PowerUpIsland(u32 PwrIslandMask) {
-  u32 RegVal;
   u32 Status = XFSBL_SUCCESS;
 
   /* Skip power-up request for QEMU */
@@ -525,9 +526,8 @@ u32 XFsbl_PowerUpIsland(u32 PwrIslandMask) {
     XFsbl_Out32(PMU_GLOBAL_REQ_PWRUP_TRIG, PwrIslandMask);
 
     /* Poll for Power up complete */
-    do {
-      RegVal = XFsbl_In32(PMU_GLOBAL_REQ_PWRUP_STATUS) & PwrIslandMask;
-    } while (RegVal != 0x0U);
+    Status = XFSBL_POLL_REG(PMU_GLOBAL_REQ_PWRUP_STATUS, PwrIslandMask, 0x0U,
+                            XFSBL_PMU_REQ_TIMEOUT, XFSBL_POLL_WFE);
   }
 
   return Status;
@@ -539,13 +539,13 @@ u32 XFsbl_PowerUpIsland(u32 PwrIslandMask) {
  *
  * @param	Mask of the entries for which isolation is to be restored
  *
- * @return	XFSBL_SUCCESS (for now always returns this)
+ * @return	XFSBL_SUCCESS, or XFSBL_ERROR_POLL_TIMEOUT when the PMU does
+ *		not restore the isolation
  *
  * @note		None.
  *
  ****************************************************************************/
 u32 XFsbl_IsolationRestore(u32 IsolationMask) {
-  u32 RegVal;
   u32 Status = XFSBL_SUCCESS;
 
   /* Skip power-up request for QEMU */
@@ -557,9 +557,8 @@ u32 XFsbl_IsolationRestore(u32 IsolationMask) {
     XFsbl_Out32(PMU_GLOBAL_REQ_ISO_TRIG, IsolationMask);
 
     /* Poll for Isolation complete */
-    do {
-      RegVal = XFsbl_In32(PMU_GLOBAL_REQ_ISO_STATUS) & IsolationMask;
-    } while (RegVal != 0x0U);
+    Status = XFSBL_POLL_REG(PMU_GLOBAL_REQ_ISO_STATUS, IsolationMask, 0x0U,
+                            XFSBL_PMU_REQ_TIMEOUT, XFSBL_POLL_WFE);
   }
 
   return Status;
@@ -748,7 +747,7 @@ END:
 
 /******************************************************************************
  *
- * This function copies data memory to memory using ADMA.
+ * This function copies data memory to memory using the ZDMA copy engine.
  *
  * @param	DestPtr is a pointer to destination buffer to which data needs
  *		to be copied.
@@ -760,123 +759,10 @@ END:
  *		Error on failure.
  *
  * @note		Cache invalidation and flushing should be taken care by
- *user Before calling this API ADMA also should be configured to simple DMA.
+ *		user.
+ *		The copy is split across the channels of XFSBL_ZDMA_BASEADDR.
  *
  ******************************************************************************/
 u32 XFsbl_AdmaCopy(void* DestPtr, void* SrcPtr, u32 Size) {
-  u32 RegVal;
-  u64 SrcAddr = (UINTPTR)SrcPtr;
-  u64 DstAddr = (UINTPTR)DestPtr;
-  u32 Status = XFSBL_SUCCESS;
-
-  /* Wait until the DMA is in idle state */
-  do {
-    RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_STATUS);
-    RegVal &= ADMA_CH0_ZDMA_CH_STATUS_STATE_MASK;
-  } while ((RegVal != ADMA_CH0_ZDMA_CH_STATUS_STATE_DONE) &&
-           (RegVal != ADMA_CH0_ZDMA_CH_STATUS_STATE_ERR));
-
-  /* Write source Address */
-  XFsbl_Out32(ADMA_CH0_ZDMA_CH_SRC_DSCR_WORD0,
-              (SrcAddr & ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0_LSB_MASK));
-  XFsbl_Out32(
-      ADMA_CH0_ZDMA_CH_SRC_DSCR_WORD1,
-      (((u64)SrcAddr >> 32U) & ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1_MSB_MASK));
-
-  /* Write Destination Address */
-  XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0,
-              (u32)(DstAddr & ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0_LSB_MASK));
-  XFsbl_Out32(
-      ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1,
-      (u32)((DstAddr >> 32U) & ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1_MSB_MASK));
-
-  /* Size to be Transferred. Recommended to set both src and dest sizes */
-  XFsbl_Out32(ADMA_CH0_ZDMA_CH_SRC_DSCR_WORD2, Size);
-  XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD2, Size);
-
-  /* coherence enable */
-  RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_SRC_DSCR_WORD3);
-  XFsbl_Out32(ADMA_CH0_ZDMA_CH_SRC_DSCR_WORD3, RegVal | 0x1U);
-
-  RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD3);
-  XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD3, RegVal | 0x1U);
-
-  /* DMA Enable */
-  RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_CTRL2);
-  RegVal |= ADMA_CH0_ZDMA_CH_CTRL2_EN_MASK;
-  XFsbl_Out32(ADMA_CH0_ZDMA_CH_CTRL2, RegVal);
-
-  /* Check the status of the transfer by polling on DMA Done */
-  do {
-    RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_ISR);
-    RegVal &= ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK;
-  } while (RegVal != ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK);
-
-  /* Clear DMA status */
-  RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_ISR);
-  RegVal |= ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK;
-  XFsbl_Out32(ADMA_CH0_ZDMA_CH_ISR, ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK);
-
-  /* Read the channel status for errors */
-  RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_STATUS);
-  if (RegVal == ADMA_CH0_ZDMA_CH_STATUS_STATE_ERR) {
-    Status = XFSBL_FAILURE;
-  }
-
-  /* Clear the TOTAL BYTE COUNT register to avoid the BYTE_CNT_OVRFLW
-   *interrupt from being set
-   */
-  XFsbl_Out32(ADMA_CH0_ZDMA_CH_CTRL0_TOTAL_BYTE_COUNT, 0x00000000U);
-
-  return Status;
-}
-
-/*****************************************************************************/
-/**
- * *
- * * This macro polls an address periodically until a condition is met or till
- * the
- * * timeout occurs.
- * * The minimum timeout for calling this macro is 100us. If the timeout is less
- * * than 100us, it still waits for 100us. Also the unit for the timeout is
- * 100us.
- * * If the timeout is not a multiple of 100us, it waits for a timeout of
- * * the next usec value which is a multiple of 100us.
- * *
- * * @param            Addr - Address to be polled
- * * @param            Value - variable to read the value
- * * @param            Cond - Condition to checked (usually involves VALUE)
- * * @param            TimeOutInUs - timeout in micro seconds
- * *
- * * @return           XFSBL_SUCCESS - when the condition is met
- * *                   XFSBL_FAILURE - when the condition is not met
- * * @note             none
- * *
- * *****************************************************************************/
-s32 XFsbl_PollTimeout(u32 Addr, u32 Value, u32 cond, u32 TimeOutInUs) {
-  s32 Status;
-  u64 timeout = TimeOutInUs / 100U;
-
-  if ((TimeOutInUs % (100U)) != 0U) {
-    timeout++;
-  }
-
-  for (;;) {
-    Value = Xil_In32(Addr);
-    if (cond) {
-      break;
-    } else {
-      usleep(100U);
-      timeout--;
-      if (timeout == 0U) break;
-    }
-  }
-
-  if (timeout > 0U) {
-    Status = XFSBL_SUCCESS;
-  } else {
-    Status = XFSBL_FAILURE;
-  }
-
-  return Status;
+  return XFsbl_ZDmaCopy((UINTPTR)DestPtr, (UINTPTR)SrcPtr, Size);
 }
@@ -18,6 +18,9 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  kc   10/21/13 Initial release
 * 2.0   bv   12/02/16 Made compliance to MISRAC 2012 guidelines
+* 3.0   dd   10/16/26 Added XFsbl_Crc32
+*       dd   10/16/26 Removed XFsbl_Crc32, XFsbl_Crc32C is used instead
+*       dd   10/16/26 XFsbl_PollTimeout is a poll on a deadline
 *
 * </pre>
 *
@@ -35,6 +38,7 @@ extern "C" {
 /***************************** Include Files *********************************/
 #include "xfsbl_hw.h"
 #include "xil_exception.h"
+#include "xfsbl_poll.h"
 
 /************************** Constant Definitions *****************************/
 #define XFSBL_SD_DRV_NUM_0	0U
@@ -43,9 +47,19 @@ extern "C" {
 #define BLOCK_SIZE_1GB 0x40000000U
 #define ADDRESS_LIMIT_4GB 0x100000000UL
 #define ARRAY_SIZE(a)	(sizeof(a) / sizeof((a)[0]))
+/* Timeout of the power up and isolation requests to the PMU, in us */
+#define XFSBL_PMU_REQ_TIMEOUT	(100000U)
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
+/**
+ * Reads Addr into Value until Cond, usually on Value, holds or for
+ * TimeOutInUs microseconds. Returns XFSBL_SUCCESS or
+ * XFSBL_ERROR_POLL_TIMEOUT.
+ */
+#define XFsbl_PollTimeout(Addr, Value, Cond, TimeOutInUs) \
+	XFSBL_POLL_UNTIL((((Value) = XFsbl_In32(Addr)), (Cond)), \
+			 (TimeOutInUs), 0U)
 
 /************************** Function Prototypes ******************************/
 void XFsbl_PrintArray (u32 DebugType, const u8 Buf[], u32 Len, const char *Str);
@@ -64,7 +78,6 @@ const char *XFsbl_GetSiliconIdName(void);
 const char *XFsbl_GetProcEng(void);
 u32 XFsbl_CheckSupportedCpu(u32 CpuId);
 u32 XFsbl_AdmaCopy(void * DestPtr, void * SrcPtr, u32 Size);
-s32 XFsbl_PollTimeout(u32 Addr,u32 Value, u32 cond, u32 TimeOutInUs);
 
 #ifndef ARMA53_64
 void XFsbl_RegisterHandlers(void);
@@ -22,6 +22,8 @@
  *                     SYSCFG is enabled and sending PM_SET_CONFIGURATION API
  *                     to the PMU
  * 3.0  bv    08/04/18 Call XWdts_Stop only when WDT timer is in ready state
+ * 4.0  dd    10/16/26 Added device copy request wrappers
+ *      dd    10/16/26 Added boot device read-ahead cache
  *
  * </pre>
  *
@@ -35,6 +37,7 @@
 #include "pm_api_sys.h"
 #include "pm_cfg_obj.h"
 #include "xfsbl_hw.h"
+#include "xfsbl_misc.h"
 #include "xipipsu.h"
 
 /**
@@ -65,6 +68,18 @@ static u32 XFsbl_ConvertTime_WdtCounter(u32 seconds);
 #ifdef XFSBL_WDT_PRESENT
 static XWdtPs Watchdog = {0}; /* Instance of WatchDog Timer	*/
 #endif
+#ifdef XFSBL_DEVICE_CACHE
+static u8 DeviceCacheBuf[XFSBL_DEVICE_CACHE_BLOCKS]
+                        [XFSBL_DEVICE_CACHE_BLOCK_SIZE]
+    __attribute__((aligned(64)));
+static u32 DeviceCacheTag[XFSBL_DEVICE_CACHE_BLOCKS];
+static u32 DeviceCacheValid = 0U; /* Bit per valid block */
+static u32 DeviceCacheVictim = 0U;
+/* Copy function of the boot device the blocks were read from */
+static u32 (*DeviceCacheCopy)(u32 SrcAddress, PTRSIZE DestAddress,
+                              u32 Length) = NULL;
+#endif
+static XFsblPs_DeviceCacheStats DeviceCacheStats;
 /*****************************************************************************/
 
 /**
@@ -287,3 +302,192 @@ u32 XFsbl_PmInit(void) {
 
   return Status;
 }
+
+/*****************************************************************************/
+/**
+ * This function submits a copy request to the boot device. Devices that
+ * only support blocking copies complete the request before returning.
+ *
+ * @param	DeviceOps is the boot device the request is submitted to
+ * @param	Request is the request handle, owned by the caller until done
+ * @param	SrcAddress is the flash address to copy from
+ * @param	DestAddress is the address to copy to
+ * @param	Length is the number of bytes to be copied
+ *
+ * @return	XFSBL_SUCCESS if the request was accepted, otherwise the
+ *		error codes described in xfsbl_error.h
+ *
+ *******************************************************************************/
+u32 XFsbl_DeviceCopySubmit(const XFsblPs_DeviceOps* DeviceOps,
+                           XFsblPs_DeviceRequest* Request, u32 SrcAddress,
+                           PTRSIZE DestAddress, u32 Length) {
+  if (DeviceOps->DeviceCopySubmit != NULL) {
+    return DeviceOps->DeviceCopySubmit(Request, SrcAddress, DestAddress,
+                                       Length);
+  }
+
+  Request->State = XFSBL_DEVICE_REQUEST_DONE;
+  Request->Status = DeviceOps->DeviceCopy(SrcAddress, DestAddress, Length);
+
+  return Request->Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function advances a copy request without blocking.
+ *
+ * @param	DeviceOps is the boot device the request was submitted to
+ * @param	Request is the request handle
+ *
+ * @return	XFSBL_STATUS_DEVICE_REQUEST_PENDING while the request is in
+ *		progress, otherwise its completion status
+ *
+ *******************************************************************************/
+u32 XFsbl_DeviceCopyPoll(const XFsblPs_DeviceOps* DeviceOps,
+                         XFsblPs_DeviceRequest* Request) {
+  if (Request->State == XFSBL_DEVICE_REQUEST_DONE) {
+    return Request->Status;
+  }
+
+  return DeviceOps->DeviceCopyPoll(Request);
+}
+
+/*****************************************************************************/
+/**
+ * This function blocks until a copy request is done.
+ *
+ * @param	DeviceOps is the boot device the request was submitted to
+ * @param	Request is the request handle
+ *
+ * @return	Completion status of the request
+ *
+ *******************************************************************************/
+u32 XFsbl_DeviceCopyWait(const XFsblPs_DeviceOps* DeviceOps,
+                         XFsblPs_DeviceRequest* Request) {
+  if (Request->State == XFSBL_DEVICE_REQUEST_DONE) {
+    return Request->Status;
+  }
+
+  return DeviceOps->DeviceCopyWait(Request);
+}
+
+/*****************************************************************************/
+/**
+ * This function copies data from the boot device through the read-ahead
+ * cache. Reads up to one block are served from cached blocks, a block that
+ * is not cached is read from the device as a whole. Larger reads go to the
+ * device directly.
+ *
+ * @param	DeviceOps is the boot device to read from
+ * @param	SrcAddress is the flash address to copy from
+ * @param	DestAddress is the address to copy to
+ * @param	Length is the number of bytes to be copied
+ *
+ * @return	XFSBL_SUCCESS on success, otherwise the error codes described
+ *		in xfsbl_error.h
+ *
+ *******************************************************************************/
+u32 XFsbl_DeviceCachedCopy(const XFsblPs_DeviceOps* DeviceOps, u32 SrcAddress,
+                           PTRSIZE DestAddress, u32 Length) {
+#ifdef XFSBL_DEVICE_CACHE
+  u32 Status = XFSBL_SUCCESS;
+  u32 BlockAddress;
+  u32 Offset;
+  u32 Bytes;
+  u32 Index;
+
+  if (Length > XFSBL_DEVICE_CACHE_BLOCK_SIZE) {
+    DeviceCacheStats.Bypasses++;
+    return DeviceOps->DeviceCopy(SrcAddress, DestAddress, Length);
+  }
+
+  /* Blocks read from another boot device are stale */
+  if (DeviceCacheCopy != DeviceOps->DeviceCopy) {
+    XFsbl_DeviceCacheInvalidate();
+    DeviceCacheCopy = DeviceOps->DeviceCopy;
+  }
+
+  while (Length != 0U) {
+    BlockAddress = SrcAddress & ~(XFSBL_DEVICE_CACHE_BLOCK_SIZE - 1U);
+    Offset = SrcAddress - BlockAddress;
+    Bytes = XFSBL_DEVICE_CACHE_BLOCK_SIZE - Offset;
+    if (Bytes > Length) {
+      Bytes = Length;
+    }
+
+    for (Index = 0U; Index < XFSBL_DEVICE_CACHE_BLOCKS; Index++) {
+      if (((DeviceCacheValid & (1U << Index)) != 0U) &&
+          (DeviceCacheTag[Index] == BlockAddress)) {
+        break;
+      }
+    }
+
+    if (Index < XFSBL_DEVICE_CACHE_BLOCKS) {
+      DeviceCacheStats.Hits++;
+    } else {
+      Index = DeviceCacheVictim;
+      DeviceCacheVictim = (DeviceCacheVictim + 1U) % XFSBL_DEVICE_CACHE_BLOCKS;
+      DeviceCacheValid &= ~(1U << Index);
+
+      Status = DeviceOps->DeviceCopy(
+          BlockAddress, (PTRSIZE)DeviceCacheBuf[Index],
+          XFSBL_DEVICE_CACHE_BLOCK_SIZE);
+      if (Status != XFSBL_SUCCESS) {
+        /* The block may run past the end of the device */
+        DeviceCacheStats.Bypasses++;
+        return DeviceOps->DeviceCopy(SrcAddress, DestAddress, Length);
+      }
+      DeviceCacheTag[Index] = BlockAddress;
+      DeviceCacheValid |= (1U << Index);
+      DeviceCacheStats.Misses++;
+    }
+
+    (void)XFsbl_MemCpy((void*)DestAddress, &DeviceCacheBuf[Index][Offset],
+                       Bytes);
+    SrcAddress += Bytes;
+    DestAddress += Bytes;
+    Length -= Bytes;
+  }
+
+  return Status;
+#else
+  return DeviceOps->DeviceCopy(SrcAddress, DestAddress, Length);
+#endif
+}
+
+/*****************************************************************************/
+/**
+ * This function drops all blocks of the read-ahead cache. It is called
+ * before bulk partition copies so that no header data outlives the header
+ * parsing.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *******************************************************************************/
+void XFsbl_DeviceCacheInvalidate(void) {
+#ifdef XFSBL_DEVICE_CACHE
+  if (DeviceCacheValid != 0U) {
+    XFsbl_Printf(DEBUG_INFO,
+                 "Device cache: %u hits, %u misses, %u bypassed\r\n",
+                 DeviceCacheStats.Hits, DeviceCacheStats.Misses,
+                 DeviceCacheStats.Bypasses);
+  }
+  DeviceCacheValid = 0U;
+  DeviceCacheVictim = 0U;
+#endif
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the counters of the read-ahead cache.
+ *
+ * @param	None
+ *
+ * @return	Pointer to the counters
+ *
+ *******************************************************************************/
+const XFsblPs_DeviceCacheStats* XFsbl_DeviceCacheGetStats(void) {
+  return &DeviceCacheStats;
+}
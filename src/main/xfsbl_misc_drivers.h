@@ -19,6 +19,8 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  kc   10/21/13 Initial release
 * 2.0   bv   12/02/16 Made compliance to MISRAC 2012 guidelines
+* 3.0   dd   10/16/26 Added device copy requests to XFsblPs_DeviceOps
+*       dd   10/16/26 Added boot device read-ahead cache
 *
 * </pre>
 *
@@ -43,6 +45,10 @@ extern "C" {
 #define XFSBL_WDT_CRV_SHIFT			(12U)
 #endif
 
+/* Device copy request states */
+#define XFSBL_DEVICE_REQUEST_DONE		(0U)
+#define XFSBL_DEVICE_REQUEST_PENDING		(1U)
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -56,6 +62,22 @@ void XFsbl_RestartWdt(void);
 
 /************************** Variable Definitions *****************************/
 
+/**
+ * Handle of a device copy request. It is owned by the caller and must stay
+ * valid until the request is done.
+ */
+typedef struct {
+	u32 SrcAddress;		/**< Flash address of the next read */
+	PTRSIZE DestAddress;	/**< Destination of the next read */
+	u32 RemainingBytes;	/**< Bytes not yet issued to the device */
+	u32 SegmentBytes;	/**< Bytes left in the current device segment */
+	PTRSIZE InFlightAddress; /**< Destination of the transfer in flight */
+	u32 InFlightBytes;	/**< Bytes of the transfer in flight */
+	u64 StartTime;		/**< Start time of the transfer in flight */
+	u32 State;		/**< XFSBL_DEVICE_REQUEST_PENDING or DONE */
+	u32 Status;		/**< Completion status once the request is done */
+} XFsblPs_DeviceRequest;
+
 typedef struct {
 	u32 DeviceBaseAddress; /**< Flash device base address */
 	u32 (*DeviceInit) (u32 DeviceFlags);
@@ -64,8 +86,38 @@ typedef struct {
 		/**< Function pointer for device copy */
 	u32 (*DeviceRelease) ();
 		/**< Function pointer for device release */
+	u32 (*DeviceCopySubmit) (XFsblPs_DeviceRequest *Request,
+			u32 SrcAddress, PTRSIZE DestAddress, u32 Length);
+		/**< Function pointer for starting a device copy request,
+		 * NULL if the device only supports blocking copies */
+	u32 (*DeviceCopyPoll) (XFsblPs_DeviceRequest *Request);
+		/**< Function pointer for advancing a device copy request */
+	u32 (*DeviceCopyWait) (XFsblPs_DeviceRequest *Request);
+		/**< Function pointer for completing a device copy request */
 } XFsblPs_DeviceOps;
 
+u32 XFsbl_DeviceCopySubmit(const XFsblPs_DeviceOps *DeviceOps,
+		XFsblPs_DeviceRequest *Request, u32 SrcAddress,
+		PTRSIZE DestAddress, u32 Length);
+u32 XFsbl_DeviceCopyPoll(const XFsblPs_DeviceOps *DeviceOps,
+		XFsblPs_DeviceRequest *Request);
+u32 XFsbl_DeviceCopyWait(const XFsblPs_DeviceOps *DeviceOps,
+		XFsblPs_DeviceRequest *Request);
+
+/**
+ * Counters of the boot device read-ahead cache
+ */
+typedef struct {
+	u32 Hits;	/**< Block lookups served from the cache */
+	u32 Misses;	/**< Blocks read from the boot device */
+	u32 Bypasses;	/**< Reads sent to the boot device uncached */
+} XFsblPs_DeviceCacheStats;
+
+u32 XFsbl_DeviceCachedCopy(const XFsblPs_DeviceOps *DeviceOps,
+		u32 SrcAddress, PTRSIZE DestAddress, u32 Length);
+void XFsbl_DeviceCacheInvalidate(void);
+const XFsblPs_DeviceCacheStats *XFsbl_DeviceCacheGetStats(void);
+
 
 /**
  * SD driver functions
@@ -41,6 +41,16 @@
  *provision to load bitstream from OCM with DDR present in design bsv  05/15/21
  *Support to ensure authenticated images boot as non-secure when RSA_EN is not
  *programmed and boot header is not authenticated is disabled by default
+ * 4.0   dd   10/16/26 Added compressed partition support
+ *       dd   10/16/26 Added CRC32C partition checksum, computed as the
+ *                     partition is copied
+ *       dd   10/16/26 SHA3 partition checksums are computed as the partition
+ *                     is copied, replacing the USE_CRYPTO_LIB digest
+ *       dd   10/16/26 Added the BLAKE3 partition checksum, verified segment by
+ *                     segment on the A53 workers as the partition is copied
+ *       dd   10/16/26 Record the partition load phases in the boot timeline
+ *       dd   10/16/26 Initialize the DDR ECC of the destination before the
+ *                     partition is copied
  *
  * </pre>
  *
@@ -50,11 +60,20 @@
 
 /***************************** Include Files *********************************/
 #include "psu_init.h"
+#include "xfsbl_blake3.h"
+#include "xfsbl_checksum.h"
+#include "xfsbl_ddr_ecc.h"
+#include "xfsbl_decompress.h"
 #include "xfsbl_hooks.h"
 #include "xfsbl_hw.h"
 #include "xfsbl_image_header.h"
 #include "xfsbl_main.h"
+#include "xfsbl_perf.h"
+#include "xfsbl_qspi.h"
+#include "xfsbl_sha3.h"
+#include "xfsbl_workers.h"
 #include "xil_cache.h"
+#include "xil_mem.h"
 
 #ifdef MAX_TODO
 #  include "xfsbl_tpm.h"
@@ -63,6 +82,48 @@
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
+#ifdef XFSBL_COMPRESSION
+/**
+ * Boot device reader of a compressed partition
+ */
+typedef struct {
+  const XFsblPs_DeviceOps* DeviceOps;
+  u32 SrcAddress;  /**< Flash address of the stored stream */
+  XTime ReadTicks; /**< Time spent in DeviceCopy */
+} XFsblPs_DecompDevice;
+#endif
+
+#if defined(XFSBL_PARTITION_CRC) || defined(XFSBL_PARTITION_SHA3) || \
+    defined(XFSBL_PARTITION_BLAKE3)
+#  define XFSBL_PARTITION_CHECKSUM
+
+/**
+ * CRC32C, SHA3-384 or BLAKE3 of the partition being loaded
+ */
+typedef struct {
+  u32 Type;            /**< Checksum type attribute of the partition */
+  PTRSIZE NextAddress; /**< Load address the next chunk has to start at */
+  u32 Bytes;           /**< Number of bytes covered by the checksum */
+  u32 Valid; /**< TRUE once the partition is loaded, until it is verified */
+  XTime Ticks; /**< Time spent computing the checksum */
+#  ifdef XFSBL_PARTITION_CRC
+  u32 Crc;
+#  endif
+#  ifdef XFSBL_PARTITION_SHA3
+  XFsblPs_Sha3 Sha3;
+  u8 Hash[XFSBL_SHA3_LEN];
+#  endif
+#  ifdef XFSBL_PARTITION_BLAKE3
+  PTRSIZE LoadAddress;
+  u32 Length;  /**< Loaded length of the partition */
+  u32 Segment; /**< First segment not verified yet */
+  XFsblPs_Blake3Record Record;
+  u8 Cvs[XFSBL_BLAKE3_MAX_SEGMENTS][XFSBL_BLAKE3_LEN]
+      __attribute__((aligned(64)));
+  u8 Mismatch[XFSBL_BLAKE3_MAX_SEGMENTS]; /**< Written by the workers */
+#  endif
+} XFsblPs_PartitionChecksum;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XFSBL_IVT_LENGTH (u32)(0x20U)
@@ -89,11 +150,6 @@ static u32 XFsbl_PartitionValidation(XFsblPs* const FsblInstancePtr,
                                      u32 PartitionNum);
 static void XFsbl_CheckPmuFw(const XFsblPs* const FsblInstancePtr,
                              u32 PartitionNum);
-#ifdef USE_CRYPTO_LIB
-static u32 XFsbl_ValidateCheckSum(const XFsblPs* const FsblInstancePtr,
-                                  PTRSIZE LoadAddress, u32 PartitionNum,
-                                  u8* PartitionHash);
-#endif
 #ifdef XFSBL_BS
 static void XFsbl_SetBSSecureState(u32 State);
 #endif
@@ -104,6 +160,18 @@ static void XFsbl_PollForDDRReady(void);
 #ifdef XFSBL_TPM
 static u8 XFsbl_GetPcrIndex(const XFsblPs* FsblInstancePtr, u32 PartitionNum);
 #endif
+#ifdef XFSBL_COMPRESSION
+static u32 XFsbl_PartitionDecompress(const XFsblPs* const FsblInstancePtr,
+                                     u32 PartitionNum, u32 SrcAddress,
+                                     PTRSIZE LoadAddress, u32 Length);
+#endif
+#ifdef XFSBL_PARTITION_CHECKSUM
+static u32 XFsbl_PartitionChecksumStart(const XFsblPs* const FsblInstancePtr,
+                                        u32 PartitionNum, PTRSIZE LoadAddress);
+static u32 XFsbl_PartitionChecksumFinish(PTRSIZE LoadAddress, u32 Length);
+static u32 XFsbl_PartitionChecksumVerify(const XFsblPs* const FsblInstancePtr,
+                                         u32 PartitionNum);
+#endif
 
 /************************** Variable Definitions *****************************/
 #ifdef XFSBL_SECURE
@@ -120,10 +188,20 @@ u8 HashsOfChunks[HASH_BUFFER_SIZE]
 #  endif
 #endif
 
+#ifdef XFSBL_PARTITION_CHECKSUM
+static XFsblPs_PartitionChecksum PartitionChecksum;
+#endif
+
 /* buffer for storing chunks for bitstream */
 #if defined(XFSBL_BS)
 extern u8 ReadBuffer[READ_BUFFER_SIZE];
 #endif
+
+#ifdef XFSBL_COMPRESSION
+/* OCM staging buffer for the stored stream of compressed partitions */
+static u8 DecompStaging[XFSBL_DECOMP_STAGING_SIZE]
+    __attribute__((aligned(XFSBL_DECOMP_READ_ALIGN)));
+#endif
 /*****************************************************************************/
 /**
  * This function loads the partition
@@ -137,13 +215,18 @@ extern u8 ReadBuffer[READ_BUFFER_SIZE];
  *
  *****************************************************************************/
 u32 XFsbl_PartitionLoad(XFsblPs* const FsblInstancePtr, u32 PartitionNum) {
+  const XFsblPs_PartitionHeader* const PartitionHeader =
+      &FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
   u32 Status;
+  XTime Start;
 
 #ifdef XFSBL_ENABLE_DDR_SR
   XFsbl_PollForDDRReady();
 #endif
 
+  Start = XFsbl_PerfNow();
   Status = XFsbl_PartitionHeaderValidation(FsblInstancePtr, PartitionNum);
+  XFsbl_PerfRecord(XFSBL_PERF_EVENT_PART_HEADER, PartitionNum, Start, 0U);
 
   /**
    * FSBL is not partition owner and skip this partition
@@ -155,15 +238,21 @@ u32 XFsbl_PartitionLoad(XFsblPs* const FsblInstancePtr, u32 PartitionNum) {
   } else {
   }
 
+  Start = XFsbl_PerfNow();
   Status = XFsbl_PartitionCopy(FsblInstancePtr, PartitionNum);
   if (XFSBL_SUCCESS != Status) {
     return Status;
   }
+  XFsbl_PerfRecord(XFSBL_PERF_EVENT_PART_COPY, PartitionNum, Start,
+                   (u64)PartitionHeader->TotalDataWordLength * 4U);
 
+  Start = XFsbl_PerfNow();
   Status = XFsbl_PartitionValidation(FsblInstancePtr, PartitionNum);
   if (XFSBL_SUCCESS != Status) {
     return Status;
   }
+  XFsbl_PerfRecord(XFSBL_PERF_EVENT_PART_VALIDATE, PartitionNum, Start,
+                   (u64)PartitionHeader->UnEncryptedDataWordLength * 4U);
 
   /* Check if PMU FW load is done and handoff it to Microblaze */
   XFsbl_CheckPmuFw(FsblInstancePtr, PartitionNum);
@@ -568,75 +657,610 @@ u32 XFsbl_PartitionCopy(XFsblPs* const FsblInstancePtr, u32 PartitionNum) {
     } while (1);
   }
 
+  XFsbl_DeviceCacheInvalidate();
+
+  /**
+   * The ECC of the destination is initialized before it is written, the
+   * decompressed data may be longer than the stored partition
+   */
+  const u32 UnEncryptedLength =
+      PartitionHeader->UnEncryptedDataWordLength * XIH_PARTITION_WORD_LENGTH;
+  u32 Status = XFsbl_DdrEccInitRange(
+      LoadAddress, (Length > UnEncryptedLength) ? Length : UnEncryptedLength);
+  if (XFSBL_SUCCESS != Status) {
+    return Status;
+  }
+
+#ifdef XFSBL_PARTITION_CHECKSUM
+  Status =
+      XFsbl_PartitionChecksumStart(FsblInstancePtr, PartitionNum, LoadAddress);
+  if (XFSBL_SUCCESS != Status) {
+    return Status;
+  }
+#endif
+
+#ifdef XFSBL_COMPRESSION
+  if (XFsbl_IsCompressed(PartitionHeader) == XIH_PH_ATTRB_COMPRESSION) {
+    Status = XFsbl_PartitionDecompress(FsblInstancePtr, PartitionNum,
+                                       SrcAddress, LoadAddress, Length);
+#  ifdef XFSBL_PARTITION_CHECKSUM
+    if (Status == XFSBL_SUCCESS) {
+      Status = XFsbl_PartitionChecksumFinish(
+          LoadAddress,
+          PartitionHeader->UnEncryptedDataWordLength *
+              XIH_PARTITION_WORD_LENGTH);
+    }
+#  endif
+    return Status;
+  }
+#endif
+
   /**
-   * Copy the partition to PS_DDR/PL_DDR/TCM
+   * Copy the partition to PS_DDR/PL_DDR/TCM. The copy is submitted as a
+   * device request so the partition details are printed while it runs
    */
-  return FsblInstancePtr->DeviceOps.DeviceCopy(SrcAddress, LoadAddress, Length);
+  XFsblPs_DeviceRequest Request;
+  Status = XFsbl_DeviceCopySubmit(&FsblInstancePtr->DeviceOps, &Request,
+                                  SrcAddress, LoadAddress, Length);
+  if (XFSBL_SUCCESS != Status) {
+    return Status;
+  }
+
+  XFsbl_Printf(DEBUG_INFO,
+               "Partition %d: copying 0x%x bytes from 0x%x to 0x%lx\n\r",
+               PartitionNum, Length, SrcAddress, (UINTPTR)LoadAddress);
+
+  Status = XFsbl_DeviceCopyWait(&FsblInstancePtr->DeviceOps, &Request);
+#ifdef XFSBL_PARTITION_CHECKSUM
+  if (Status == XFSBL_SUCCESS) {
+    Status = XFsbl_PartitionChecksumFinish(LoadAddress, Length);
+  }
+#endif
+
+  return Status;
 }
 
-#ifdef USE_CRYPTO_LIB
+#ifdef XFSBL_PARTITION_CHECKSUM
+#  ifdef XFSBL_PARTITION_BLAKE3
 /*****************************************************************************/
 /**
- * This function calculates checksum of the partition.
+ * This function is the work of one segment of a BLAKE3 partition checksum.
+ * It compares the chaining value of the segment with the stored one, or
+ * the digest with the root hash when the partition is a single segment.
  *
- * @param	FsblInstancePtr is pointer to the XFsbl Instance
- * @param	LoadAddress Load address of partition
- * @param	PartitionNum is the partition number to calculate checksum
+ * @param	Context is the partition checksum
+ * @param	Index is the segment, from the first one not verified yet
+ *
+ *****************************************************************************/
+static void XFsbl_PartitionBlake3Segment(void* Context, u32 Index) {
+  XFsblPs_PartitionChecksum* Checksum = (XFsblPs_PartitionChecksum*)Context;
+  const u32 Segment = Checksum->Segment + Index;
+  const u64 Offset = (u64)Segment << Checksum->Record.SegmentShift;
+  const u64 SegmentSize = (u64)1U << Checksum->Record.SegmentShift;
+  const u8* Data = (const u8*)(Checksum->LoadAddress + (PTRSIZE)Offset);
+  u32 Length = (u32)SegmentSize;
+  u8 Cv[XFSBL_BLAKE3_LEN];
+  const u8* Expected;
+
+  if ((Checksum->Length - Offset) < SegmentSize) {
+    Length = (u32)(Checksum->Length - Offset);
+  }
+
+  if (Checksum->Record.Segments == 1U) {
+    XFsbl_Blake3Digest(Data, Length, Cv);
+    Expected = Checksum->Record.Root;
+  } else {
+    XFsbl_Blake3Segment(Data, Length, Offset, Cv);
+    Expected = Checksum->Cvs[Segment];
+  }
+
+  Checksum->Mismatch[Segment] =
+      (Xil_MemCompare(Cv, Expected, XFSBL_BLAKE3_LEN) != 0) ? TRUE : FALSE;
+}
+
+/*****************************************************************************/
+/**
+ * This function verifies the segments of a BLAKE3 partition that are
+ * completely loaded, on the FSBL core and the A53 workers
+ *
+ * @param	Checksum is the partition checksum
+ * @param	Loaded is the number of bytes loaded
  *
  * @return	returns XFSBL_SUCCESS on success
- * 		returns XFSBL_ERROR_INVALID_CHECKSUM_TYPE on failure
+ * 		returns XFSBL_ERROR_PARTITION_CHECKSUM_FAILED on a mismatch
  *
  *****************************************************************************/
-static u32 XFsbl_CalculateCheckSum(const XFsblPs* const FsblInstancePtr,
-                                   PTRSIZE LoadAddress, u32 PartitionNum,
-                                   u8* PartitionHash) {
-  const XFsblPs_PartitionHeader* const PartitionHeader =
-      &FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
-  u32 ChecksumType;
+static u32 XFsbl_PartitionBlake3Update(XFsblPs_PartitionChecksum* Checksum,
+                                       u32 Loaded) {
+  u32 Ready = Loaded >> Checksum->Record.SegmentShift;
 
-  ChecksumType = XFsbl_GetChecksumType(PartitionHeader);
-  if (ChecksumType != XIH_PH_ATTRB_HASH_SHA3) {
-    /* Check sum type is other than SHA3 */
-    return XFSBL_ERROR_INVALID_CHECKSUM_TYPE;
+  if (Loaded >= Checksum->Length) {
+    Ready = Checksum->Record.Segments;
+  }
+  if (Ready <= Checksum->Segment) {
+    return XFSBL_SUCCESS;
   }
-  XFsbl_Printf(DEBUG_INFO, "CheckSum Type - SHA3\r\n");
-
-  /* SHA calculation in DDRful systems */
-  u32 Length = PartitionHeader->TotalDataWordLength * 4U;
 
-  /* Calculate SHA hash */
-  XFsbl_ShaDigest((u8*)LoadAddress, Length, PartitionHash,
-                  XFSBL_HASH_TYPE_SHA3);
+  XFsbl_WorkersRun(XFsbl_PartitionBlake3Segment, Checksum,
+                   Ready - Checksum->Segment);
+
+  for (u32 Segment = Checksum->Segment; Segment < Ready; Segment++) {
+    if (Checksum->Mismatch[Segment] != FALSE) {
+      XFsbl_WorkersStop();
+      XFsbl_Printf(DEBUG_GENERAL,
+                   "XFSBL_ERROR_PARTITION_CHECKSUM_FAILED BLAKE3 segment %u "
+                   "at 0x%x\r\n",
+                   Segment, Segment << Checksum->Record.SegmentShift);
+      return XFSBL_ERROR_PARTITION_CHECKSUM_FAILED;
+    }
+  }
+  Checksum->Segment = Ready;
 
   return XFSBL_SUCCESS;
 }
-#endif
 
-#ifdef USE_CRYPTO_LIB
-static u32 VerifyChecksum(const XFsblPs* const FsblInstancePtr,
-                          u32 PartitionNum) {
+/*****************************************************************************/
+/**
+ * This function reads the BLAKE3 record of a partition and checks the
+ * segment chaining values against the root hash before the partition is
+ * loaded, then starts the A53 workers
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	PartitionNum is the partition number in the image
+ * @param	LoadAddress is the load address of the partition
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns XFSBL_ERROR_PARTITION_CHECKSUM_FAILED for an invalid
+ * 		record
+ *
+ *****************************************************************************/
+static u32 XFsbl_PartitionBlake3Start(const XFsblPs* const FsblInstancePtr,
+                                      u32 PartitionNum, PTRSIZE LoadAddress) {
   const XFsblPs_PartitionHeader* PartitionHeader =
       &FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
-  PTRSIZE LoadAddress = (PTRSIZE)PartitionHeader->DestinationLoadAddress;
-  u32 Status = XFSBL_SUCCESS;
+  const u32 ChecksumOffset = FsblInstancePtr->ImageOffsetAddress +
+                             (PartitionHeader->ChecksumWordOffset * 4U);
+  XFsblPs_Blake3Record* Record = &PartitionChecksum.Record;
+  u32 Length = PartitionHeader->TotalDataWordLength * XIH_PARTITION_WORD_LENGTH;
+  u8 Root[XFSBL_BLAKE3_LEN];
+
+#    ifdef XFSBL_COMPRESSION
+  if (XFsbl_IsCompressed(PartitionHeader) == XIH_PH_ATTRB_COMPRESSION) {
+    Length =
+        PartitionHeader->UnEncryptedDataWordLength * XIH_PARTITION_WORD_LENGTH;
+  }
+#    endif
+
+  u32 Status =
+      XFsbl_DeviceCachedCopy(&FsblInstancePtr->DeviceOps, ChecksumOffset,
+                             (PTRSIZE)Record, XFSBL_BLAKE3_RECORD_LEN);
+  if (Status != XFSBL_SUCCESS) {
+    XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_HASH_COPY_FAILED\r\n");
+    return Status;
+  }
 
-  u8 PartitionHash[XFSBL_HASH_TYPE_SHA3] __attribute__((aligned(4U))) = {0U};
+  /* The segments have to cover the partition exactly */
+  if ((Record->Magic != XFSBL_BLAKE3_MAGIC) ||
+      (Record->SegmentShift < XFSBL_BLAKE3_MIN_SEGMENT_SHIFT) ||
+      (Record->SegmentShift > XFSBL_BLAKE3_MAX_SEGMENT_SHIFT) ||
+      (Record->Segments == 0U) ||
+      (Record->Segments > XFSBL_BLAKE3_MAX_SEGMENTS) ||
+      (((u64)(Record->Segments - 1U) << Record->SegmentShift) >= Length) ||
+      (((u64)Record->Segments << Record->SegmentShift) < Length)) {
+    XFsbl_Printf(DEBUG_GENERAL,
+                 "XFSBL_ERROR_PARTITION_CHECKSUM_FAILED invalid BLAKE3 "
+                 "record\r\n");
+    return XFSBL_ERROR_PARTITION_CHECKSUM_FAILED;
+  }
 
-  /* Checksum verification */
-  if (XFsbl_GetChecksumType(PartitionHeader) != XIH_PH_ATTRB_NOCHECKSUM) {
-    Status = XFsbl_CalculateCheckSum(FsblInstancePtr, LoadAddress, PartitionNum,
-                                     PartitionHash);
+  if (Record->Segments > 1U) {
+    Status = XFsbl_DeviceCachedCopy(
+        &FsblInstancePtr->DeviceOps, ChecksumOffset + XFSBL_BLAKE3_RECORD_LEN,
+        (PTRSIZE)PartitionChecksum.Cvs, Record->Segments * XFSBL_BLAKE3_LEN);
     if (Status != XFSBL_SUCCESS) {
-      XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_PARTITION_CHECKSUM_FAILED \r\n");
-      Status = XFSBL_ERROR_PARTITION_CHECKSUM_FAILED;
+      XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_HASH_COPY_FAILED\r\n");
       return Status;
     }
-    Status = XFsbl_ValidateCheckSum(FsblInstancePtr, LoadAddress, PartitionNum,
-                                    PartitionHash);
+
+    (void)XFsbl_Blake3Root((const u8*)PartitionChecksum.Cvs,
+                           Record->Segments, Root);
+    if (Xil_MemCompare(Root, Record->Root, XFSBL_BLAKE3_LEN) != 0) {
+      XFsbl_Printf(DEBUG_GENERAL,
+                   "XFSBL_ERROR_PARTITION_CHECKSUM_FAILED BLAKE3 segment "
+                   "table\r\n");
+      return XFSBL_ERROR_PARTITION_CHECKSUM_FAILED;
+    }
+  }
+
+  PartitionChecksum.LoadAddress = LoadAddress;
+  PartitionChecksum.Length = Length;
+  PartitionChecksum.Segment = 0U;
+
+  /* Without workers the FSBL core verifies every segment */
+  Status = XFsbl_WorkersStart();
+  if (Status != XFSBL_SUCCESS) {
+    XFsbl_Printf(DEBUG_INFO, "A53 workers not started, error 0x%x\r\n",
+                 Status);
+  }
+
+  return XFSBL_SUCCESS;
+}
+#  endif
+
+/*****************************************************************************/
+/**
+ * This function adds data to the checksum of the partition being loaded
+ *
+ * @param	Checksum is the partition checksum
+ * @param	Address is the address of the data
+ * @param	Length is the length of the data
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns the SHA3 engine error on failure
+ * 		returns XFSBL_ERROR_PARTITION_CHECKSUM_FAILED on a corrupt
+ * 		BLAKE3 segment
+ *
+ *****************************************************************************/
+static u32 XFsbl_PartitionChecksumUpdate(XFsblPs_PartitionChecksum* Checksum,
+                                         PTRSIZE Address, u32 Length) {
+  u32 Status = XFSBL_SUCCESS;
+  XTime tStart;
+  XTime tEnd;
+
+  XTime_GetTime(&tStart);
+#  ifdef XFSBL_PARTITION_CRC
+  if (Checksum->Type == XIH_PH_ATTRB_CHECKSUM_CRC32C) {
+    Checksum->Crc = XFsbl_Crc32C(Checksum->Crc, (const u8*)Address, Length);
+  }
+#  endif
+#  ifdef XFSBL_PARTITION_SHA3
+  if (Checksum->Type == XIH_PH_ATTRB_HASH_SHA3) {
+    Status = XFsbl_Sha3Update(&Checksum->Sha3, (const u8*)Address, Length);
+  }
+#  endif
+#  ifdef XFSBL_PARTITION_BLAKE3
+  if (Checksum->Type == XIH_PH_ATTRB_CHECKSUM_BLAKE3) {
+    Status = XFsbl_PartitionBlake3Update(Checksum, Checksum->Bytes + Length);
+  }
+#  endif
+  XTime_GetTime(&tEnd);
+  Checksum->Ticks += tEnd - tStart;
+
+  if (Status == XFSBL_SUCCESS) {
+    Checksum->Bytes += Length;
+    Checksum->NextAddress += Length;
+  }
+
+  return Status;
+}
+
+#  ifdef XFSBL_QSPI_STREAM
+/*****************************************************************************/
+/**
+ * This function is the QSPI streaming hook of the partition checksum. It
+ * adds every chunk to the checksum as it lands, while the next chunk is
+ * read.
+ *
+ * @param	ChunkAddress is the address of the chunk
+ * @param	ChunkLength is the length of the chunk
+ * @param	Context is the partition checksum
+ *
+ * @return	returns XFSBL_SUCCESS to continue the copy
+ * 		returns XFSBL_ERROR_PARTITION_CHECKSUM_FAILED on a corrupt
+ * 		BLAKE3 segment, which aborts the copy
+ *
+ *****************************************************************************/
+static u32 XFsbl_PartitionChecksumHook(PTRSIZE ChunkAddress, u32 ChunkLength,
+                                       void* Context) {
+  XFsblPs_PartitionChecksum* Checksum = (XFsblPs_PartitionChecksum*)Context;
+  u32 Status = XFSBL_SUCCESS;
+
+  /*
+   * A chunk out of order, or an engine error, leaves the checksum to
+   * XFsbl_PartitionChecksumFinish
+   */
+  if (ChunkAddress == Checksum->NextAddress) {
+    Status =
+        XFsbl_PartitionChecksumUpdate(Checksum, ChunkAddress, ChunkLength);
+  }
+
+  return (Status == XFSBL_ERROR_PARTITION_CHECKSUM_FAILED) ? Status
+                                                           : XFSBL_SUCCESS;
+}
+#  endif
+
+/*****************************************************************************/
+/**
+ * This function starts the checksum of a partition that is loaded to
+ * LoadAddress. Checksum types that are not computed while loading are
+ * ignored.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	PartitionNum is the partition number in the image
+ * @param	LoadAddress is the load address of the partition
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns the SHA3 engine error on failure
+ * 		returns XFSBL_ERROR_PARTITION_CHECKSUM_FAILED for an invalid
+ * 		BLAKE3 record
+ *
+ *****************************************************************************/
+static u32 XFsbl_PartitionChecksumStart(const XFsblPs* const FsblInstancePtr,
+                                        u32 PartitionNum, PTRSIZE LoadAddress) {
+  const u32 Type = XFsbl_GetChecksumType(
+      &FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum]);
+  u32 Status = XFSBL_SUCCESS;
+
+  PartitionChecksum.Type = XIH_PH_ATTRB_NOCHECKSUM;
+  PartitionChecksum.NextAddress = LoadAddress;
+  PartitionChecksum.Bytes = 0U;
+  PartitionChecksum.Valid = FALSE;
+  PartitionChecksum.Ticks = 0U;
+
+#  ifdef XFSBL_PARTITION_CRC
+  if (Type == XIH_PH_ATTRB_CHECKSUM_CRC32C) {
+    PartitionChecksum.Type = Type;
+    PartitionChecksum.Crc = 0U;
+  }
+#  endif
+#  ifdef XFSBL_PARTITION_SHA3
+  if (Type == XIH_PH_ATTRB_HASH_SHA3) {
+    PartitionChecksum.Type = Type;
+    Status = XFsbl_Sha3Start(&PartitionChecksum.Sha3);
+  }
+#  endif
+#  ifdef XFSBL_PARTITION_BLAKE3
+  /* Workers left running by a copy that failed */
+  XFsbl_WorkersStop();
+  if (Type == XIH_PH_ATTRB_CHECKSUM_BLAKE3) {
+    PartitionChecksum.Type = Type;
+    Status =
+        XFsbl_PartitionBlake3Start(FsblInstancePtr, PartitionNum, LoadAddress);
+  }
+#  endif
+
+#  ifdef XFSBL_QSPI_STREAM
+  if ((Status == XFSBL_SUCCESS) &&
+      (PartitionChecksum.Type != XIH_PH_ATTRB_NOCHECKSUM)) {
+    XFsbl_QspiSetStreamHook(XFsbl_PartitionChecksumHook, &PartitionChecksum);
+  }
+#  endif
+
+  return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function completes the checksum of a loaded partition. Data the QSPI
+ * streaming hook did not see, from other boot devices or decompressed, is
+ * read back from the load address.
+ *
+ * @param	LoadAddress is the load address of the partition
+ * @param	Length is the loaded length of the partition
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns the SHA3 engine error on failure
+ *
+ *****************************************************************************/
+static u32 XFsbl_PartitionChecksumFinish(PTRSIZE LoadAddress, u32 Length) {
+  u32 Status = XFSBL_SUCCESS;
+
+#  ifdef XFSBL_QSPI_STREAM
+  XFsbl_QspiSetStreamHook(NULL, NULL);
+#  endif
+
+  if (PartitionChecksum.Type == XIH_PH_ATTRB_NOCHECKSUM) {
+    return XFSBL_SUCCESS;
+  }
+
+  if (PartitionChecksum.Bytes != Length) {
+    PartitionChecksum.Bytes = 0U;
+    PartitionChecksum.NextAddress = LoadAddress;
+#  ifdef XFSBL_PARTITION_CRC
+    PartitionChecksum.Crc = 0U;
+#  endif
+#  ifdef XFSBL_PARTITION_SHA3
+    if (PartitionChecksum.Type == XIH_PH_ATTRB_HASH_SHA3) {
+      Status = XFsbl_Sha3Start(&PartitionChecksum.Sha3);
+    }
+#  endif
+#  ifdef XFSBL_PARTITION_BLAKE3
+    PartitionChecksum.Segment = 0U;
+#  endif
+    if (Status == XFSBL_SUCCESS) {
+      Status = XFsbl_PartitionChecksumUpdate(&PartitionChecksum, LoadAddress,
+                                             Length);
+    }
+  }
+
+#  ifdef XFSBL_PARTITION_SHA3
+  if ((Status == XFSBL_SUCCESS) &&
+      (PartitionChecksum.Type == XIH_PH_ATTRB_HASH_SHA3)) {
+    XTime tStart;
+    XTime tEnd;
+
+    XTime_GetTime(&tStart);
+    Status = XFsbl_Sha3Finish(&PartitionChecksum.Sha3, PartitionChecksum.Hash);
+    XTime_GetTime(&tEnd);
+    PartitionChecksum.Ticks += tEnd - tStart;
+  }
+#  endif
+#  ifdef XFSBL_PARTITION_BLAKE3
+  XFsbl_WorkersStop();
+#  endif
+
+  if (Status == XFSBL_SUCCESS) {
+    PartitionChecksum.Valid = TRUE;
+  }
+
+  return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function compares the checksum of the loaded partition with the
+ * CRC32C or SHA3-384 stored at the partition checksum offset. Partitions
+ * that were not copied, like the bitstream on a PS only reset, are skipped.
+ * BLAKE3 partitions were verified segment by segment as they were loaded.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	PartitionNum is the partition number in the image
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns XFSBL_ERROR_PARTITION_CHECKSUM_FAILED on a mismatch
+ *
+ *****************************************************************************/
+static u32 XFsbl_PartitionChecksumVerify(const XFsblPs* const FsblInstancePtr,
+                                         u32 PartitionNum) {
+  const XFsblPs_PartitionHeader* PartitionHeader =
+      &FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
+  const u32 ChecksumOffset = FsblInstancePtr->ImageOffsetAddress +
+                             (PartitionHeader->ChecksumWordOffset * 4U);
+  u8 Expected[XFSBL_HASH_TYPE_SHA3] __attribute__((aligned(4U))) = {0U};
+  const u8* Computed = NULL;
+  u32 Length = 0U;
+
+  if ((PartitionChecksum.Valid != TRUE) ||
+      (PartitionChecksum.Type != XFsbl_GetChecksumType(PartitionHeader))) {
+    return XFSBL_SUCCESS;
+  }
+  PartitionChecksum.Valid = FALSE;
+
+#  ifdef XFSBL_PARTITION_BLAKE3
+  if (PartitionChecksum.Type == XIH_PH_ATTRB_CHECKSUM_BLAKE3) {
+    XFsbl_Printf(DEBUG_INFO,
+                 "Partition %d BLAKE3 verified, %u segments, 0x%x bytes in "
+                 "%u ticks\r\n",
+                 PartitionNum, PartitionChecksum.Record.Segments,
+                 PartitionChecksum.Bytes, (u32)PartitionChecksum.Ticks);
+    return XFSBL_SUCCESS;
+  }
+#  endif
+
+#  ifdef XFSBL_PARTITION_CRC
+  if (PartitionChecksum.Type == XIH_PH_ATTRB_CHECKSUM_CRC32C) {
+    Computed = (const u8*)&PartitionChecksum.Crc;
+    Length = XFSBL_CRC32C_LEN;
+  }
+#  endif
+#  ifdef XFSBL_PARTITION_SHA3
+  if (PartitionChecksum.Type == XIH_PH_ATTRB_HASH_SHA3) {
+    Computed = PartitionChecksum.Hash;
+    Length = XFSBL_SHA3_LEN;
+  }
+#  endif
+
+  const u32 Status =
+      XFsbl_DeviceCachedCopy(&FsblInstancePtr->DeviceOps, ChecksumOffset,
+                             (PTRSIZE)Expected, Length);
+  if (Status != XFSBL_SUCCESS) {
+    XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_HASH_COPY_FAILED\r\n");
+    return Status;
+  }
+
+  if (Xil_MemCompare(Computed, Expected, Length) != 0) {
+    XFsbl_Printf(DEBUG_GENERAL,
+                 "XFSBL_ERROR_PARTITION_CHECKSUM_FAILED type 0x%x\r\n",
+                 PartitionChecksum.Type);
+    return XFSBL_ERROR_PARTITION_CHECKSUM_FAILED;
   }
 
+  XFsbl_Printf(DEBUG_INFO,
+               "Partition %d checksum 0x%x verified, 0x%x bytes in %u "
+               "ticks\r\n",
+               PartitionNum, PartitionChecksum.Type, PartitionChecksum.Bytes,
+               (u32)PartitionChecksum.Ticks);
+
+  return XFSBL_SUCCESS;
+}
+#endif
+
+#ifdef XFSBL_COMPRESSION
+/*****************************************************************************/
+/**
+ * This function reads a chunk of a compressed partition from the boot
+ * device for the decoder and adds the read time to the device statistics.
+ *
+ * @param	Context is the XFsblPs_DecompDevice of the partition
+ * @param	Offset is the offset of the chunk in the stored stream
+ * @param	Buffer is the staging buffer the chunk is read into
+ * @param	Length is the number of bytes to be read
+ *
+ * @return	returns the error codes described in xfsbl_error.h on any error
+ * 			returns XFSBL_SUCCESS on success
+ *
+ *****************************************************************************/
+static u32 XFsbl_DecompDeviceRead(void* Context, u32 Offset, u8* Buffer,
+                                  u32 Length) {
+  XFsblPs_DecompDevice* Device = (XFsblPs_DecompDevice*)Context;
+  XTime tStart;
+  XTime tEnd;
+
+  XTime_GetTime(&tStart);
+  const u32 Status = Device->DeviceOps->DeviceCopy(Device->SrcAddress + Offset,
+                                                   (PTRSIZE)Buffer, Length);
+  XTime_GetTime(&tEnd);
+  Device->ReadTicks += tEnd - tStart;
+
   return Status;
 }
+
+/*****************************************************************************/
+/**
+ * This function decompresses a compressed partition to its load address.
+ * The stored stream is read in chunks into the OCM staging buffer and only
+ * the decompressed data is written to the load address.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	PartitionNum is the partition number in the image to be loaded
+ * @param	SrcAddress is the flash address of the stored stream
+ * @param	LoadAddress is the destination of the decompressed data
+ * @param	Length is the stored length of the partition
+ *
+ * @return	returns the error codes described in xfsbl_error.h on any error
+ * 			returns XFSBL_SUCCESS on success
+ *
+ *****************************************************************************/
+static u32 XFsbl_PartitionDecompress(const XFsblPs* const FsblInstancePtr,
+                                     u32 PartitionNum, u32 SrcAddress,
+                                     PTRSIZE LoadAddress, u32 Length) {
+  const XFsblPs_PartitionHeader* const PartitionHeader =
+      &FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
+  const u32 DecompLength =
+      PartitionHeader->UnEncryptedDataWordLength * XIH_PARTITION_WORD_LENGTH;
+  XFsblPs_DecompDevice Device = {&FsblInstancePtr->DeviceOps, SrcAddress, 0U};
+  const XFsblPs_DecompSource Source = {XFsbl_DecompDeviceRead, &Device, Length,
+                                       DecompStaging, sizeof(DecompStaging)};
+  XFsblPs_DecompStats Stats;
+  XTime tStart;
+  XTime tEnd;
+
+  XFsbl_Printf(DEBUG_INFO,
+               "Partition %d: decompressing 0x%x bytes from 0x%x to 0x%lx\n\r",
+               PartitionNum, Length, SrcAddress, (UINTPTR)LoadAddress);
+
+  XTime_GetTime(&tStart);
+  const u32 Status =
+      XFsbl_Decompress(&Source, (u8*)LoadAddress, DecompLength, &Stats);
+  XTime_GetTime(&tEnd);
+  if (Status != XFSBL_SUCCESS) {
+    XFsbl_Printf(DEBUG_GENERAL,
+                 "Partition %d decompression failed: 0x%x at byte 0x%x\n\r",
+                 PartitionNum, Status, Stats.OutputBytes);
+    return Status;
+  }
+
+  XFsbl_Printf(DEBUG_INFO,
+               "Decompressed 0x%x bytes in %u blocks, 0x%x zero filled, "
+               "0x%x read in %u reads\n\r",
+               Stats.OutputBytes, Stats.Blocks, Stats.ZeroBytes,
+               Stats.InputBytes, Stats.Reads);
+  XFsbl_Printf(DEBUG_INFO, "Decompression ticks: read %u decode %u\n\r",
+               (u32)Device.ReadTicks,
+               (u32)((tEnd - tStart) - Device.ReadTicks));
+
+  return XFSBL_SUCCESS;
+}
 #endif
 
 /*****************************************************************************/
@@ -657,8 +1281,8 @@ static u32 XFsbl_PartitionValidation(XFsblPs* const FsblInstancePtr,
       &FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
   u32 Status = XFSBL_SUCCESS;
 
-#ifdef USE_CRYPTO_LIB
-  Status = VerifyChecksum(FsblInstancePtr, PartitionNum);
+#ifdef XFSBL_PARTITION_CHECKSUM
+  Status = XFsbl_PartitionChecksumVerify(FsblInstancePtr, PartitionNum);
   if (Status != XFSBL_SUCCESS) {
     return Status;
   }
@@ -694,50 +1318,6 @@ static u32 XFsbl_PartitionValidation(XFsblPs* const FsblInstancePtr,
   return Status;
 }
 
-#ifdef USE_CRYPTO_LIB
-/*****************************************************************************/
-/**
- * This function validates the partition.
- *
- * @param	FsblInstancePtr is pointer to the XFsbl Instance
- * @param	LoadAddress Load address of partition
- * @param	PartitionNum is the partition number to calculate checksum
- *
- * @return	returns XFSBL_SUCCESS on success
- * 			returns XFSBL_FAILURE on failure
- *
- *****************************************************************************/
-static u32 XFsbl_ValidateCheckSum(const XFsblPs* const FsblInstancePtr,
-                                  PTRSIZE LoadAddress, u32 PartitionNum,
-                                  u8* PartitionHash) {
-  u32 Status = XFSBL_FAILURE;
-  u8 Hash[XFSBL_HASH_TYPE_SHA3] __attribute__((aligned(4U))) = {0U};
-
-  const XFsblPs_PartitionHeader* PartitionHeader =
-      &FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
-  u32 HashOffset = FsblInstancePtr->ImageOffsetAddress +
-                   PartitionHeader->ChecksumWordOffset * 4U;
-
-  Status = FsblInstancePtr->DeviceOps.DeviceCopy(HashOffset, (PTRSIZE)Hash,
-                                                 XFSBL_HASH_TYPE_SHA3);
-  if (Status != XFSBL_SUCCESS) {
-    XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_HASH_COPY_FAILED\r\n");
-    return Status;
-  }
-
-  u8 Index;
-  for (Index = 0U; Index < XFSBL_HASH_TYPE_SHA3; Index++) {
-    if (PartitionHash[Index] != Hash[Index]) {
-      XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_HASH_FAILED\r\n");
-      Status = XFSBL_FAILURE;
-      return Status;
-    }
-  }
-
-  return Status;
-}
-#endif
-
 /*****************************************************************************/
 /**
  * This function checks if PMU FW is loaded and gives handoff to PMU
@@ -0,0 +1,247 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_perf.c
+ *
+ * This is the file which contains the boot timeline of XFSBL_PERF.
+ *
+ * The records are written to a ring in the FSBL OCM data and, before the
+ * handoff, copied to XFSBL_PERF_TIMELINE_ADDRESS when it is set, as DDR is
+ * not up for the first records and the OCM is reused after the handoff.
+ * Start and End are CNTPCT ticks, at TimerFreq once psu_init has set up the
+ * timestamp clock. The psu_init blocks are recorded by the
+ * psu_init_block_start() and psu_init_block_done() hooks of psu_init(),
+ * with the block they waited for on the critical path.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *       dd   10/16/26 Record the psu_init critical path
+ *       dd   10/16/26 Publish the poll statistics
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xfsbl_perf.h"
+
+#ifdef XFSBL_PERF
+#  include "psu_init.h"
+#  include "xfsbl_misc.h"
+#  include "xil_cache.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+  XFsblPs_PerfTimeline Header;
+  XFsblPs_PerfRecord Record[XFSBL_PERF_RECORDS];
+} __attribute__((aligned(64))) XFsblPs_PerfRing;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+static XFsblPs_PerfRing PerfRing;
+
+/* Start of the psu_init blocks, the block they waited for and the last one */
+static XTime PsuInitStart[PSU_INIT_BLOCKS];
+static XTime PsuInitEnd[PSU_INIT_BLOCKS];
+static u8 PsuInitAfter[PSU_INIT_BLOCKS];
+static u32 PsuInitLast = PSU_INIT_BLOCK_NONE;
+
+/*****************************************************************************/
+/**
+ * This function starts the boot timeline and publishes its OCM address.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_PerfInit(void) {
+  PerfRing.Header.Magic = XFSBL_PERF_MAGIC;
+  PerfRing.Header.Version = (u16)XFSBL_PERF_VERSION;
+  PerfRing.Header.RecordSize = (u16)sizeof(XFsblPs_PerfRecord);
+  PerfRing.Header.Records = XFSBL_PERF_RECORDS;
+  PerfRing.Header.Head = 0U;
+  PerfRing.Header.TimerFreq = COUNTS_PER_SECOND;
+  PerfRing.Header.Reserved = 0U;
+
+  XFsbl_Out32(XFSBL_PERF_TIMELINE_REGISTER, (u32)(UINTPTR)&PerfRing);
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the generic timer count.
+ *
+ * @param	None
+ *
+ * @return	CNTPCT
+ *
+ *****************************************************************************/
+XTime XFsbl_PerfNow(void) {
+  XTime Now;
+
+  XTime_GetTime(&Now);
+  return Now;
+}
+
+/*****************************************************************************/
+/**
+ * This function records a boot step ending now.
+ *
+ * @param	Event is one of XFSBL_PERF_EVENT_*
+ *
+ * @param	Id is the step of the event
+ *
+ * @param	Start is the XFsbl_PerfNow() of the start of the step
+ *
+ * @param	Bytes is the data length the step processed, 0 if none
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_PerfRecord(u32 Event, u32 Id, XTime Start, u64 Bytes) {
+  XFsblPs_PerfRecord* Record =
+      &PerfRing.Record[PerfRing.Header.Head % XFSBL_PERF_RECORDS];
+  const XTime End = XFsbl_PerfNow();
+
+  Record->Start = Start;
+  Record->End = End;
+  Record->Event = (u16)Event;
+  Record->Id = (u16)Id;
+  Record->Bytes = Bytes;
+  Record->KBps = 0U;
+  if ((Bytes != 0U) && (End > Start)) {
+    Record->KBps =
+        (u32)((Bytes * COUNTS_PER_SECOND) / ((End - Start) * 1024U));
+  }
+
+  PerfRing.Header.Head++;
+}
+
+/*****************************************************************************/
+/**
+ * This function is the psu_init() hook called before each of its blocks.
+ *
+ * @param	block is the PSU_INIT_BLOCK_* started
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void psu_init_block_start(unsigned int block) {
+  if (block < PSU_INIT_BLOCKS) {
+    PsuInitStart[block] = XFsbl_PerfNow();
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function is the psu_init() hook called after each of its blocks, it
+ * records the block with the block it waited for in bits 15:8 of the Id.
+ *
+ * @param	block is the PSU_INIT_BLOCK_* done
+ *
+ * @param	after is the PSU_INIT_BLOCK_* it waited for on the critical
+ *		path, PSU_INIT_BLOCK_NONE if none
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void psu_init_block_done(unsigned int block, unsigned int after) {
+  if (block >= PSU_INIT_BLOCKS) {
+    return;
+  }
+
+  XFsbl_PerfRecord(XFSBL_PERF_EVENT_PSU_INIT, block | (after << 8U),
+                   PsuInitStart[block], 0U);
+  PsuInitEnd[block] = XFsbl_PerfNow();
+  PsuInitAfter[block] = (u8)after;
+  PsuInitLast = block;
+}
+
+/*****************************************************************************/
+/**
+ * This function prints the critical path of psu_init, from the block done
+ * last back through the blocks each one waited for, with the time from
+ * the end of the block waited for to the end of the block.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_PerfPsuInitDone(void) {
+  u32 Path[PSU_INIT_BLOCKS];
+  u32 Blocks = 0U;
+  u32 Block = PsuInitLast;
+  XTime From;
+
+  while ((Block < PSU_INIT_BLOCKS) && (Blocks < PSU_INIT_BLOCKS)) {
+    Path[Blocks] = Block;
+    Blocks++;
+    Block = PsuInitAfter[Block];
+  }
+
+  while (Blocks > 0U) {
+    Blocks--;
+    Block = Path[Blocks];
+    From = (PsuInitAfter[Block] < PSU_INIT_BLOCKS)
+               ? PsuInitEnd[PsuInitAfter[Block]]
+               : PsuInitStart[Block];
+    XFsbl_Printf(DEBUG_INFO, "psu_init critical path: block %u, %u us\n\r",
+                 Block,
+                 (u32)(((PsuInitEnd[Block] - From) * 1000000U) /
+                       COUNTS_PER_SECOND));
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function prints the timeline and the poll statistics, and publishes
+ * the timeline for the handoff, in DDR at XFSBL_PERF_TIMELINE_ADDRESS when
+ * it is set.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_PerfPublish(void) {
+  const u32 Head = PerfRing.Header.Head;
+  const XFsblPs_PerfRecord* Record;
+  UINTPTR Address = (UINTPTR)&PerfRing;
+  u32 Index;
+
+  Index = (Head > XFSBL_PERF_RECORDS) ? (Head - XFSBL_PERF_RECORDS) : 0U;
+  for (; Index < Head; Index++) {
+    Record = &PerfRing.Record[Index % XFSBL_PERF_RECORDS];
+    XFsbl_Printf(DEBUG_INFO, "Perf %u/%u: %u us, 0x%llx bytes, %u KB/s\n\r",
+                 (u32)Record->Event, (u32)Record->Id,
+                 (u32)(((Record->End - Record->Start) * 1000000U) /
+                       COUNTS_PER_SECOND),
+                 Record->Bytes, Record->KBps);
+  }
+  XFsbl_PollReport();
+
+#  if (XFSBL_PERF_TIMELINE_ADDRESS != 0U)
+  Address = (UINTPTR)XFSBL_PERF_TIMELINE_ADDRESS;
+  (void)XFsbl_MemCpy((void*)Address, &PerfRing, sizeof(PerfRing));
+#  endif
+  Xil_DCacheFlushRange((INTPTR)Address, sizeof(PerfRing));
+
+  XFsbl_Out32(XFSBL_PERF_TIMELINE_REGISTER, (u32)Address);
+}
+#endif /* XFSBL_PERF */
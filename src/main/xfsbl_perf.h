@@ -0,0 +1,124 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_perf.h
+ *
+ * This is the header file of the boot timeline of XFSBL_PERF. Every boot
+ * step is recorded with its generic timer (CNTPCT) start and end in a ring
+ * of fixed size records, whose address is published in
+ * XFSBL_PERF_TIMELINE_REGISTER so that U-Boot or Linux can read the boot
+ * timeline after the handoff. Without XFSBL_PERF the functions are empty.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *       dd   10/16/26 Record the psu_init critical path
+ *       dd   10/16/26 DDR ECC regions are recorded once initialized
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef XFSBL_PERF_H
+#define XFSBL_PERF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xfsbl_hw.h"
+#include "xtime_l.h"
+
+/************************** Constant Definitions *****************************/
+#define XFSBL_PERF_MAGIC (0x46525046U) /* "FPRF" */
+#define XFSBL_PERF_VERSION (1U)
+
+/**
+ * Recorded events, the record Id is
+ *  - STAGE: the FsblStage left
+ *  - PSU_INIT: the psu_init block (PSU_INIT_BLOCK_*), the block it waited
+ *    for on the critical path in bits 15:8 (PSU_INIT_BLOCK_NONE if none)
+ *  - BOOT_DEVICE: the boot mode
+ *  - DDR_ECC: 0 for the low PS DDR, 1 for the high PS DDR, recorded once
+ *    the whole region is initialized
+ *  - PART_*, *HANDOFF: the partition number
+ *  - DDR_TRAINING: 1 when the saved training was restored, 0 otherwise
+ *  - FSBL: 0
+ */
+#define XFSBL_PERF_EVENT_FSBL (0x1U)
+#define XFSBL_PERF_EVENT_STAGE (0x2U)
+#define XFSBL_PERF_EVENT_PSU_INIT (0x3U)
+#define XFSBL_PERF_EVENT_DDR_TRAINING (0x4U)
+#define XFSBL_PERF_EVENT_DDR_ECC (0x5U)
+#define XFSBL_PERF_EVENT_BOOT_DEVICE (0x6U)
+#define XFSBL_PERF_EVENT_PART_HEADER (0x7U)
+#define XFSBL_PERF_EVENT_PART_COPY (0x8U)
+#define XFSBL_PERF_EVENT_PART_VALIDATE (0x9U)
+#define XFSBL_PERF_EVENT_HANDOFF (0xAU)
+#define XFSBL_PERF_EVENT_EARLY_HANDOFF (0xBU)
+
+/**************************** Type Definitions *******************************/
+/**
+ * Timeline header, followed by Records records. Head is the number of
+ * records written, the last Records of them are kept and record N is at
+ * index N % Records.
+ */
+typedef struct {
+  u32 Magic;
+  u16 Version;
+  u16 RecordSize; /**< sizeof(XFsblPs_PerfRecord) */
+  u32 Records;
+  u32 Head;
+  u64 TimerFreq; /**< Start and End ticks per second */
+  u64 Reserved;
+} XFsblPs_PerfTimeline;
+
+/**
+ * One boot step. KBps is the Bytes throughput in KB/s, 0 without Bytes.
+ */
+typedef struct {
+  u64 Start;
+  u64 End;
+  u64 Bytes;
+  u16 Event;
+  u16 Id;
+  u32 KBps;
+} XFsblPs_PerfRecord;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+#ifdef XFSBL_PERF
+void XFsbl_PerfInit(void);
+XTime XFsbl_PerfNow(void);
+void XFsbl_PerfRecord(u32 Event, u32 Id, XTime Start, u64 Bytes);
+void XFsbl_PerfPsuInitDone(void);
+void XFsbl_PerfPublish(void);
+#else
+static inline void XFsbl_PerfInit(void) {}
+static inline XTime XFsbl_PerfNow(void) { return 0U; }
+static inline void XFsbl_PerfRecord(u32 Event, u32 Id, XTime Start,
+                                    u64 Bytes) {
+  (void)Event;
+  (void)Id;
+  (void)Start;
+  (void)Bytes;
+}
+static inline void XFsbl_PerfPsuInitDone(void) {}
+static inline void XFsbl_PerfPublish(void) {}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_PERF_H */
@@ -0,0 +1,285 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_poll.c
+ *
+ * This is the file which contains the poll service of the FSBL.
+ *
+ * A poll reads its condition, then XFsbl_PollRetry() checks the deadline
+ * before every other read. Without a timer (R5 without sleep timer) every
+ * retry waits 1 us with usleep(). The timer runs at COUNTS_PER_SECOND once
+ * psu_init has set up the timestamp clock, the deadlines of the polls
+ * before that are only approximate.
+ *
+ * With XFSBL_POLL_WFE, the event stream of the generic timer is enabled for
+ * the poll, an event every 2^(XFSBL_POLL_EVENT_BIT + 1) ticks, about 1 us
+ * at 100 MHz, and CNTKCTL_EL1 is restored afterwards.
+ *
+ * The psu_init() polls go through psu_poll(), defined here so that they
+ * also get a deadline and statistics, per polled register.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *       dd   10/16/26 Advance the background DDR ECC initialization
+ *       dd   10/16/26 Read the condition once more at the deadline
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xfsbl_poll.h"
+#include "xfsbl_ddr_ecc.h"
+#include "xfsbl_log.h"
+#include "xfsbl_debug.h"
+#include "psu_init.h"
+#include "sleep.h"
+
+/************************** Constant Definitions *****************************/
+#define XFSBL_POLL_EVENT_BIT (6U)
+#define XFSBL_POLL_CNTKCTL_EVNTEN (0x4U)
+#define XFSBL_POLL_CNTKCTL_EVNTI_SHIFT (4U)
+#define XFSBL_POLL_CNTKCTL_EVNTI_MASK (0xF0U)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#if defined(__aarch64__)
+#  define XFSBL_POLL_EVENTS
+#endif
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+#ifdef XFSBL_PERF
+/* Bounds of the .xfsbl_poll_sites section, from the linker script */
+extern XFsblPs_PollSite __xfsbl_poll_sites_start[];
+extern XFsblPs_PollSite __xfsbl_poll_sites_end[];
+
+static XFsblPs_PollSite PsuInitSites[XFSBL_POLL_PSU_INIT_SITES]
+    __attribute__((section(".xfsbl_poll_sites"), used, aligned(8)));
+#endif
+
+#ifdef XFSBL_POLL_TIMER
+static XTime XFsbl_PollNow(void) {
+  XTime Now;
+
+  XTime_GetTime(&Now);
+  return Now;
+}
+#endif
+
+/*****************************************************************************/
+/**
+ * This function starts a poll, whose condition is then read by the caller.
+ *
+ * @param	Poll is the poll to start
+ *
+ * @param	Site is the XFSBL_POLL_SITE() of the caller, NULL if none
+ *
+ * @param	TimeOutUs is the timeout of the poll in microseconds
+ *
+ * @param	Flags are XFSBL_POLL_* flags
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_PollStart(XFsblPs_Poll* Poll, XFsblPs_PollSite* Site,
+                     u32 TimeOutUs, u32 Flags) {
+  Poll->Site = Site;
+  Poll->Flags = Flags;
+  Poll->Reads = 1U;
+#ifdef XFSBL_POLL_TIMER
+  Poll->Start = XFsbl_PollNow();
+  Poll->Deadline =
+      Poll->Start + (((XTime)TimeOutUs * COUNTS_PER_SECOND) / 1000000U);
+#else
+  Poll->Left = TimeOutUs;
+#endif
+
+#ifdef XFSBL_POLL_EVENTS
+  if ((Flags & XFSBL_POLL_WFE) != 0U) {
+    u64 Cntkctl;
+
+    __asm__ __volatile__("mrs %0, cntkctl_el1" : "=r"(Poll->EventStream));
+    Cntkctl = Poll->EventStream & ~(u64)XFSBL_POLL_CNTKCTL_EVNTI_MASK;
+    Cntkctl |= ((u64)XFSBL_POLL_EVENT_BIT << XFSBL_POLL_CNTKCTL_EVNTI_SHIFT) |
+               XFSBL_POLL_CNTKCTL_EVNTEN;
+    __asm__ __volatile__("msr cntkctl_el1, %0\n\tisb" : : "r"(Cntkctl));
+  }
+#endif
+}
+
+/*****************************************************************************/
+/**
+ * This function waits before the next read of the condition of a poll.
+ *
+ * @param	Poll is the poll in progress
+ *
+ * @return	XFSBL_SUCCESS to read the condition again,
+ *		XFSBL_ERROR_POLL_TIMEOUT once the deadline has passed
+ *
+ *****************************************************************************/
+u32 XFsbl_PollRetry(XFsblPs_Poll* Poll) {
+#ifdef XFSBL_POLL_TIMER
+  if (XFsbl_PollNow() >= Poll->Deadline) {
+    return XFSBL_ERROR_POLL_TIMEOUT;
+  }
+#else
+  if (Poll->Left == 0U) {
+    return XFSBL_ERROR_POLL_TIMEOUT;
+  }
+  Poll->Left--;
+  (void)usleep(1U);
+#endif
+
+  XFsbl_LogDrain();
+  XFsbl_DdrEccPoll();
+#ifdef XFSBL_POLL_EVENTS
+  if ((Poll->Flags & XFSBL_POLL_WFE) != 0U) {
+    __asm__ __volatile__("wfe" : : : "memory");
+  }
+#endif
+  Poll->Reads++;
+
+  return XFSBL_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function ends a poll and records it in the statistics of its site.
+ *
+ * @param	Poll is the poll in progress
+ *
+ * @param	Status is XFSBL_SUCCESS or XFSBL_ERROR_POLL_TIMEOUT
+ *
+ * @return	Status
+ *
+ *****************************************************************************/
+u32 XFsbl_PollEnd(XFsblPs_Poll* Poll, u32 Status) {
+#ifdef XFSBL_POLL_EVENTS
+  if ((Poll->Flags & XFSBL_POLL_WFE) != 0U) {
+    __asm__ __volatile__("msr cntkctl_el1, %0\n\tisb"
+                         :
+                         : "r"(Poll->EventStream));
+  }
+#endif
+
+#ifdef XFSBL_PERF
+  XFsblPs_PollSite* Site = Poll->Site;
+
+  if (Site != NULL) {
+#  ifdef XFSBL_POLL_TIMER
+    const u32 Us = (u32)(((XFsbl_PollNow() - Poll->Start) * 1000000U) /
+                         COUNTS_PER_SECOND);
+#  else
+    /* Every retry waited 1 us */
+    const u32 Us = Poll->Reads - 1U;
+#  endif
+
+    Site->Calls++;
+    Site->Reads += Poll->Reads;
+    Site->Us += Us;
+    if (Us > Site->MaxUs) {
+      Site->MaxUs = Us;
+    }
+    if (Status != XFSBL_SUCCESS) {
+      Site->Timeouts++;
+    }
+  }
+#endif
+
+  return Status;
+}
+
+#ifdef XFSBL_PERF
+/*****************************************************************************/
+/**
+ * This function prints the statistics of the poll sites which have polled.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_PollReport(void) {
+  const XFsblPs_PollSite* Site;
+
+  for (Site = __xfsbl_poll_sites_start; Site < __xfsbl_poll_sites_end;
+       Site++) {
+    if (Site->Calls == 0U) {
+      continue;
+    }
+    XFsbl_Printf(DEBUG_INFO,
+                 "Poll %s:%u 0x%x: %u calls, %u timeouts, %llu reads, "
+                 "%u us, max %u us\n\r",
+                 Site->Name, Site->Line, Site->Addr, Site->Calls,
+                 Site->Timeouts, Site->Reads, (u32)Site->Us, Site->MaxUs);
+  }
+}
+#endif
+
+/*****************************************************************************/
+/**
+ * This function is the poll of psu_init(), with the statistics of the
+ * polled register.
+ *
+ * @param	addr is the register polled
+ *
+ * @param	mask is the mask of the register bits polled
+ *
+ * @param	value is the value of the bits polled
+ *
+ * @param	any is not 0 to poll until any bit of mask is set
+ *
+ * @return	1 when the condition is met, 0 on timeout
+ *
+ *****************************************************************************/
+int psu_poll(unsigned long addr, unsigned int mask, unsigned int value,
+             int any) {
+  XFsblPs_PollSite* Site = NULL;
+  XFsblPs_Poll Poll;
+  u32 Status = XFSBL_SUCCESS;
+  u32 RegVal;
+
+#ifdef XFSBL_PERF
+  u32 Index;
+
+  for (Index = 0U; Index < XFSBL_POLL_PSU_INIT_SITES; Index++) {
+    if (PsuInitSites[Index].Name == NULL) {
+      PsuInitSites[Index].Name = "psu_init";
+      PsuInitSites[Index].Addr = (u32)addr;
+    }
+    if (PsuInitSites[Index].Addr == (u32)addr) {
+      Site = &PsuInitSites[Index];
+      break;
+    }
+  }
+#endif
+
+  XFsbl_PollStart(&Poll, Site, XFSBL_POLL_PSU_INIT_TIMEOUT, 0U);
+  for (;;) {
+    RegVal = XFsbl_In32(addr) & mask;
+    if ((any != 0) ? (RegVal != 0U) : (RegVal == value)) {
+      Status = XFSBL_SUCCESS;
+      break;
+    }
+    /* The register is read once more after the deadline */
+    if (Status != XFSBL_SUCCESS) {
+      break;
+    }
+    Status = XFsbl_PollRetry(&Poll);
+  }
+
+  return (XFsbl_PollEnd(&Poll, Status) == XFSBL_SUCCESS) ? 1 : 0;
+}
@@ -0,0 +1,152 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_poll.h
+ *
+ * This is the header file of the poll service of the FSBL. A poll waits for
+ * a condition until a deadline in microseconds of the generic timer, or of
+ * the sleep timer on R5, so that the timeouts do not depend on the CPU
+ * clock. The log is drained and the background DDR ECC initialization
+ * advanced between the reads, and with XFSBL_POLL_WFE an A53 in AArch64
+ * waits for an event of the timer event stream between them.
+ *
+ * With XFSBL_PERF every call site records its calls, reads, time and
+ * timeouts in the .xfsbl_poll_sites section, printed by XFsbl_PollReport().
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *       dd   10/16/26 Advance the background DDR ECC initialization
+ *       dd   10/16/26 Read the condition once more at the deadline
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef XFSBL_POLL_H
+#define XFSBL_POLL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xfsbl_hw.h"
+#include "xfsbl_error.h"
+
+#if !defined(ARMR5) || defined(SLEEP_TIMER_BASEADDR)
+#  define XFSBL_POLL_TIMER
+#  include "xtime_l.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+/* Flags of a poll */
+#define XFSBL_POLL_WFE (0x1U) /**< Wait for an event between the reads */
+
+/* Timeout of the psu_init polls */
+#define XFSBL_POLL_PSU_INIT_TIMEOUT (100000U)
+
+/* Distinct registers polled by psu_init with statistics */
+#define XFSBL_POLL_PSU_INIT_SITES (16U)
+
+/**************************** Type Definitions *******************************/
+/**
+ * Statistics of a poll call site
+ */
+typedef struct {
+  const char* Name; /**< Function of the call site */
+  u32 Line;         /**< Line of the call site, 0 for psu_init */
+  u32 Addr;         /**< Register polled by psu_init, 0 otherwise */
+  u32 Calls;
+  u32 Timeouts;
+  u64 Reads;
+  u64 Us;    /**< Time spent polling */
+  u32 MaxUs; /**< Longest poll */
+} XFsblPs_PollSite;
+
+/**
+ * A poll in progress
+ */
+typedef struct {
+  XFsblPs_PollSite* Site;
+  u32 Flags;
+  u32 Reads;
+#ifdef XFSBL_POLL_TIMER
+  XTime Start;
+  XTime Deadline;
+#else
+  u32 Left; /**< Microseconds left */
+#endif
+  u64 EventStream; /**< CNTKCTL_EL1 to restore with XFSBL_POLL_WFE */
+} XFsblPs_Poll;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+/**
+ * Statistics of the call site, NULL without XFSBL_PERF
+ */
+#ifdef XFSBL_PERF
+#  define XFSBL_POLL_SITE()                                                \
+    ({                                                                     \
+      static XFsblPs_PollSite XFsbl_PollSite_                              \
+          __attribute__((section(".xfsbl_poll_sites"), used, aligned(8))) = \
+              {__func__, __LINE__, 0U, 0U, 0U, 0U, 0U, 0U};                \
+      &XFsbl_PollSite_;                                                    \
+    })
+#else
+#  define XFSBL_POLL_SITE() ((XFsblPs_PollSite*)NULL)
+#endif
+
+/**
+ * Evaluates Cond until it holds or for TimeOutUs microseconds, returns
+ * XFSBL_SUCCESS or XFSBL_ERROR_POLL_TIMEOUT. Cond is evaluated once more
+ * at the deadline, as the work between the reads may have delayed it.
+ */
+#define XFSBL_POLL_UNTIL(Cond, TimeOutUs, Flags)                         \
+  ({                                                                     \
+    XFsblPs_Poll XFsbl_Poll_;                                            \
+    u32 XFsbl_PollStatus_ = XFSBL_SUCCESS;                               \
+    XFsbl_PollStart(&XFsbl_Poll_, XFSBL_POLL_SITE(), (TimeOutUs),        \
+                    (Flags));                                            \
+    while (!(Cond)) {                                                    \
+      XFsbl_PollStatus_ = XFsbl_PollRetry(&XFsbl_Poll_);                 \
+      if (XFsbl_PollStatus_ != XFSBL_SUCCESS) {                          \
+        if (Cond) {                                                      \
+          XFsbl_PollStatus_ = XFSBL_SUCCESS;                             \
+        }                                                                \
+        break;                                                           \
+      }                                                                  \
+    }                                                                    \
+    XFsbl_PollEnd(&XFsbl_Poll_, XFsbl_PollStatus_);                      \
+  })
+
+/**
+ * Polls Addr until its bits of Mask are Value
+ */
+#define XFSBL_POLL_REG(Addr, Mask, Value, TimeOutUs, Flags)                 \
+  XFSBL_POLL_UNTIL((XFsbl_In32(Addr) & (Mask)) == (Value), (TimeOutUs), \
+                   (Flags))
+
+/************************** Function Prototypes ******************************/
+void XFsbl_PollStart(XFsblPs_Poll* Poll, XFsblPs_PollSite* Site,
+                     u32 TimeOutUs, u32 Flags);
+u32 XFsbl_PollRetry(XFsblPs_Poll* Poll);
+u32 XFsbl_PollEnd(XFsblPs_Poll* Poll, u32 Status);
+#ifdef XFSBL_PERF
+void XFsbl_PollReport(void);
+#else
+static inline void XFsbl_PollReport(void) {}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_POLL_H */
@@ -30,6 +30,26 @@
 *                     64 byte aligned
 *       bsv  05/03/22 Replace memcpy with Xil_MemCpy to avoid non-word aligned
 *                     access to memory
+* 8.0   dd   10/16/26 Added double-buffered streaming read path that keeps
+*                     a chunk DMA in flight while the previous chunk is
+*                     post-processed
+*       dd   10/16/26 Reworked Qspi24Copy and Qspi32Copy on top of a
+*                     non-blocking copy request engine
+*       dd   10/16/26 Added SFDP based read mode selection
+*       dd   10/16/26 Added clock and tap delay calibration
+*       dd   10/16/26 Track the flash mode across copies so that QPI, 4 byte
+*                     address and bank changes are only sent when needed,
+*                     and restore the power on mode at release
+*       dd   10/16/26 Read flashes larger than 16MB with 4 byte addresses in
+*                     24 bit boot mode
+*       dd   10/16/26 Drain the deferred log while waiting for the DMA
+*       dd   10/16/26 Wait for the copy requests on a deadline
+*       dd   10/16/26 Slow a calibrated clock down on a read or checksum
+*                     failure instead of checking it before every copy
+*       dd   10/16/26 Use 4 byte addresses in 24 bit boot mode only when
+*                     SFDP describes them
+*       dd   10/16/26 Check the Quad Enable bit again for a quad read mode
+*                     from the SFDP cache
 *
 * </pre>
 *
@@ -40,10 +60,14 @@
 #include "xfsbl_hw.h"
 #include "xparameters.h"
 #include "xil_cache.h"
+#include <string.h>
 
 #ifdef XFSBL_QSPI
 #include "xqspipsu.h"
 #include "xfsbl_qspi.h"
+#include "xfsbl_misc.h"
+#include "xfsbl_checksum.h"
+#include "xfsbl_log.h"
 
 /************************** Constant Definitions *****************************/
 /*
@@ -54,15 +78,50 @@
 #define QSPI_DEVICE_ID XPAR_XQSPIPSU_0_DEVICE_ID
 #define XFSBL_SIXTY_FOUR_BYTE_MASK (0x3FU)
 #define XFSBL_SIXTY_FOUR_BYTE_VAL (64U)
+#define XFSBL_QSPI_WORD_MASK (0x3U)
+#define XFSBL_QSPI_DEVICES (2U)
 
 /**************************** Type Definitions *******************************/
+/*
+ * Mode a flash device has been put in by the FSBL. Reads send all ones
+ * mode bits, so the device never enters continuous read mode.
+ */
+typedef struct {
+	u8 Qpi;		/* QPI 4-4-4 mode entered */
+	u8 Addr4B;	/* 4 byte address mode entered */
+	u8 Bank;	/* Selected bank or XFSBL_QSPI_BANK_UNKNOWN */
+} XFsblPs_QspiSession;
+
+#ifdef XFSBL_QSPI_SFDP
+/*
+ * Bus widths and 4-byte address variant of an SFDP read mode
+ */
+typedef struct {
+	u8 AddrBusWidth;
+	u8 DataBusWidth;
+	u8 Command4B;
+	u32 Support4BMask;
+} XFsblPs_QspiSfdpModeInfo;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
 static u32 FlashReadID(XQspiPsu *QspiPsuPtr);
-static u32 MacronixEnable4B(XQspiPsu *QspiPsuPtr);
+static u32 MacronixEnable4B(XQspiPsu *QspiPsuPtr, int Enable);
 static u32 MacronixEnableQPIMode(XQspiPsu *QspiPsuPtr, int Enable);
+static void QspiSetReadMode(void);
+static void QspiSessionReset(void);
+#ifdef XFSBL_QSPI24_4B
+static void QspiPromote4B(void);
+#endif
+#ifdef XFSBL_QSPI_SFDP
+static u32 QspiSfdpAddrBytes(u32 *FourBait);
+static void QspiSfdpProbe(u32 AddrSize);
+#endif
+#ifdef XFSBL_QSPI_CALIB
+static void QspiCalibrate(void);
+#endif
 
 /************************** Variable Definitions *****************************/
 static XQspiPsu QspiPsuInstance __attribute__((aligned(64)));
@@ -77,6 +136,47 @@ static u8 ReadBuffer[10] __attribute__((aligned(32)));
 static u8 WriteBuffer[10] __attribute__((aligned(32)));
 static u32 MacronixFlash = 0U;
 u8 MultiDie = (u8)FALSE;
+static u32 QspiAddrSize = XFSBL_QSPI_ADDR_SIZE_24BIT;
+static u8 QspiTempBuf[XFSBL_SIXTY_FOUR_BYTE_VAL] __attribute__((aligned(64)));
+static XFsblPs_DeviceRequest *QspiActiveRequest = NULL;
+static XFsblPs_QspiReadMode QspiReadMode;
+static u32 QspiQpiRead = 0U;
+static u32 QspiAddr4B = 0U;
+static u32 Qspi24Promoted = 0U;
+static XFsblPs_QspiSession QspiSession[XFSBL_QSPI_DEVICES];
+
+#ifdef XFSBL_QSPI_SFDP
+static u32 QspiSfdpBuf[XFSBL_QSPI_SFDP_BUF_WORDS] __attribute__((aligned(64)));
+static XFsblPs_QspiReadMode QspiSfdpMode;
+static u32 QspiSfdpModeValid = 0U;
+
+static const XFsblPs_QspiSfdpModeInfo
+	QspiSfdpModeInfo[XFSBL_QSPI_SFDP_MODE_COUNT] = {
+	{XQSPIPSU_SELECT_MODE_SPI, XQSPIPSU_SELECT_MODE_SPI,
+	 FAST_READ_CMD_32BIT, XFSBL_QSPI_4BAIT_FAST_READ_111_MASK},
+	{XQSPIPSU_SELECT_MODE_SPI, XQSPIPSU_SELECT_MODE_DUALSPI,
+	 DUAL_READ_CMD_32BIT, XFSBL_QSPI_4BAIT_FAST_READ_112_MASK},
+	{XQSPIPSU_SELECT_MODE_DUALSPI, XQSPIPSU_SELECT_MODE_DUALSPI,
+	 DUAL_IO_READ_CMD_32BIT, XFSBL_QSPI_4BAIT_FAST_READ_122_MASK},
+	{XQSPIPSU_SELECT_MODE_SPI, XQSPIPSU_SELECT_MODE_QUADSPI,
+	 QUAD_READ_CMD_32BIT, XFSBL_QSPI_4BAIT_FAST_READ_114_MASK},
+	{XQSPIPSU_SELECT_MODE_QUADSPI, XQSPIPSU_SELECT_MODE_QUADSPI,
+	 QUAD_IO_READ_CMD_32BIT, XFSBL_QSPI_4BAIT_FAST_READ_144_MASK},
+};
+#endif
+
+#ifdef XFSBL_QSPI_STREAM
+static u32 QspiStreamChunkSize = XFSBL_QSPI_STREAM_CHUNK_SIZE;
+static XFsbl_QspiStreamHook QspiStreamHook = NULL;
+static void *QspiStreamHookContext = NULL;
+static XFsblPs_QspiStreamStats QspiStreamStats;
+#endif
+
+#ifdef XFSBL_QSPI_CALIB
+static u8 QspiCalibBuf[XFSBL_QSPI_CALIB_SIZE] __attribute__((aligned(64)));
+static u32 QspiCalibRefCrc = 0U;
+static u8 QspiCalibPrescaler = XFSBL_QSPI_CLK_PRESCALER;
+#endif
 
 /******************************************************************************
 *
@@ -257,7 +357,7 @@ u32 XFsbl_Qspi24Init(u32 DeviceFlags)
 	 * Set the pre-scaler for QSPI clock
 	 */
 	Status = XQspiPsu_SetClkPrescaler(&QspiPsuInstance,
-					  XQSPIPSU_CLK_PRESCALE_8);
+					  XFSBL_QSPI_CLK_PRESCALER);
 
 	if (Status != XFSBL_SUCCESS) {
 		UStatus = XFSBL_ERROR_QSPI_PRESCALER_CLK;
@@ -317,6 +417,8 @@ u32 XFsbl_Qspi24Init(u32 DeviceFlags)
 	} break;
 	}
 
+	QspiSessionReset();
+
 	/**
 	 * Read Flash ID and extract Manufacture and Size information
 	 */
@@ -324,6 +426,7 @@ u32 XFsbl_Qspi24Init(u32 DeviceFlags)
 	if (UStatus != XFSBL_SUCCESS) {
 		goto END;
 	}
+
 	/**
 	 *  add code for 1x, 2x and 4x
 	 *
@@ -336,6 +439,24 @@ u32 XFsbl_Qspi24Init(u32 DeviceFlags)
 	    (QspiPsuInstance.Config.BusWidth == XFSBL_QSPI_BUSWIDTH_FOUR)) {
 		ReadCommand = QUAD_READ_CMD_24BIT2;
 	}
+	QspiAddrSize = XFSBL_QSPI_ADDR_SIZE_24BIT;
+
+#ifdef XFSBL_QSPI24_4B
+	/**
+	 * Avoid bank switching on flashes larger than one bank
+	 */
+	QspiPromote4B();
+#endif
+
+#ifdef XFSBL_QSPI_SFDP
+	/**
+	 * Look up the fastest read mode described by the flash
+	 */
+	QspiSfdpProbe(QspiAddrSize);
+#endif
+
+	QspiSetReadMode();
+
 	/**
 	 * add code: For a Stacked connection, read second Flash ID
 	 */
@@ -345,10 +466,90 @@ u32 XFsbl_Qspi24Init(u32 DeviceFlags)
 		QspiFlashSize = 2 * QspiFlashSize;
 	}
 
+#ifdef XFSBL_QSPI_CALIB
+	/**
+	 * Read at the fastest clock the flash is read back reliably with
+	 */
+	QspiCalibrate();
+#endif
+
 END:
 	return UStatus;
 }
 
+#ifdef XFSBL_QSPI24_4B
+/******************************************************************************
+*
+* This function switches 24 bit boot mode to 4 byte addresses when the flash
+* is larger than one bank and SFDP describes 4 byte addressing, so that reads
+* need no bank switching and are not split at bank boundaries. A 4 byte only
+* flash takes its read command as is. Otherwise Macronix flashes are put in 4
+* byte address mode before the first read, other flashes are read with the 4
+* byte address read command if the 4BAIT lists it. Bank switching is kept
+* when SFDP is absent or describes 3 byte addresses only. The BootROM mode is
+* restored at release.
+*
+* @param	None.
+*
+* @return	None.
+*
+* @note		ReadCommand must be set before calling this function.
+*
+******************************************************************************/
+static void QspiPromote4B(void)
+{
+	u32 AddrBytes;
+	u32 FourBait;
+	u32 Command = 0U;
+	u32 Support = 0U;
+
+	if (QspiFlashSize <= BANKSIZE) {
+		goto END;
+	}
+
+	AddrBytes = QspiSfdpAddrBytes(&FourBait);
+	if (AddrBytes == XFSBL_QSPI_BFPT_ADDR_BYTES_4_ONLY) {
+		/* Read commands take 4 address bytes already */
+	} else if (AddrBytes != XFSBL_QSPI_BFPT_ADDR_BYTES_3_OR_4) {
+		goto END;
+	} else if (MacronixFlash == 1U) {
+		QspiAddr4B = 1U;
+	} else {
+		switch (ReadCommand) {
+		case FAST_READ_CMD_24BIT:
+			Command = FAST_READ_CMD_32BIT;
+			Support = XFSBL_QSPI_4BAIT_FAST_READ_111_MASK;
+			break;
+
+		case DUAL_READ_CMD_24BIT:
+			Command = DUAL_READ_CMD_32BIT;
+			Support = XFSBL_QSPI_4BAIT_FAST_READ_112_MASK;
+			break;
+
+		case QUAD_READ_CMD_24BIT:
+			Command = QUAD_READ_CMD_32BIT;
+			Support = XFSBL_QSPI_4BAIT_FAST_READ_114_MASK;
+			break;
+
+		default:
+			break;
+		}
+		if ((FourBait & Support) == 0U) {
+			goto END;
+		}
+		ReadCommand = Command;
+	}
+
+	QspiAddrSize = XFSBL_QSPI_ADDR_SIZE_32BIT;
+	Qspi24Promoted = 1U;
+	XFsbl_Printf(DEBUG_INFO, "QSPI 24 bit boot mode using 4 byte "
+		     "addresses\r\n");
+
+END:
+	return;
+}
+#endif
+
 /******************************************************************************
 *
 * This functions translates the address based on the type of interconnection.
@@ -423,6 +624,146 @@ static u32 XFsbl_GetQspiAddr(u32 Address)
 	return (RealAddr);
 }
 
+/******************************************************************************
+*
+* This function forgets the mode of the flash devices. The BootROM leaves
+* them in SPI mode with 3 byte addresses, the bank is not known.
+*
+* @param	None.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void QspiSessionReset(void)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < XFSBL_QSPI_DEVICES; Index++) {
+		QspiSession[Index].Qpi = (u8)FALSE;
+		QspiSession[Index].Addr4B = (u8)FALSE;
+		QspiSession[Index].Bank = XFSBL_QSPI_BANK_UNKNOWN;
+	}
+	QspiAddr4B = 0U;
+	Qspi24Promoted = 0U;
+}
+
+/******************************************************************************
+*
+* This function returns the mode of the currently selected flash device.
+* In dual parallel connection both devices always get the same commands,
+* so the mode of the lower device stands for both.
+*
+* @param	None.
+*
+* @return	Pointer to the mode of the selected device.
+*
+* @note		None.
+*
+******************************************************************************/
+static XFsblPs_QspiSession *QspiSessionState(void)
+{
+	XFsblPs_QspiSession *Session = &QspiSession[0U];
+
+	if ((QspiPsuInstance.GenFifoCS & XQSPIPSU_GENFIFO_CS_LOWER) == 0U) {
+		Session = &QspiSession[1U];
+	}
+
+	return Session;
+}
+
+/******************************************************************************
+*
+* This function puts the selected flash device in or out of QPI mode unless
+* it already is in that mode.
+*
+* @param	Enable is TRUE to enter and FALSE to leave QPI mode.
+*
+* @return	XFSBL_SUCCESS if success, otherwise XFSBL_ERROR_QSPI_READ.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiSessionSetQpi(u8 Enable)
+{
+	u32 UStatus = XFSBL_SUCCESS;
+	XFsblPs_QspiSession *Session = QspiSessionState();
+
+	if (Session->Qpi != Enable) {
+		UStatus = MacronixEnableQPIMode(&QspiPsuInstance,
+						(Enable == (u8)TRUE) ?
+						ENABLE_QPI : DISABLE_QPI);
+		if (UStatus == XFSBL_SUCCESS) {
+			Session->Qpi = Enable;
+		}
+	}
+
+	return UStatus;
+}
+
+/******************************************************************************
+*
+* This function puts the selected flash device in or out of 4 byte address
+* mode unless it already is in that mode. The commands are sent in SPI mode.
+*
+* @param	Enable is TRUE to enter and FALSE to leave 4 byte address mode.
+*
+* @return	XFSBL_SUCCESS if success, otherwise error code.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiSessionSet4B(u8 Enable)
+{
+	u32 UStatus = XFSBL_SUCCESS;
+	XFsblPs_QspiSession *Session = QspiSessionState();
+
+	if (Session->Addr4B != Enable) {
+		UStatus = QspiSessionSetQpi((u8)FALSE);
+		if (UStatus != XFSBL_SUCCESS) {
+			goto END;
+		}
+
+		UStatus = MacronixEnable4B(&QspiPsuInstance, (int)Enable);
+		if (UStatus != XFSBL_SUCCESS) {
+			goto END;
+		}
+		Session->Addr4B = Enable;
+	}
+
+END:
+	return UStatus;
+}
+
+/******************************************************************************
+*
+* This function puts the selected flash device in the mode the read
+* command of QspiSetupReadMsg needs.
+*
+* @param	None.
+*
+* @return	XFSBL_SUCCESS if success, otherwise XFSBL_ERROR_QSPI_READ.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiSessionPrepareRead(void)
+{
+	u32 UStatus;
+
+	UStatus = QspiSessionSet4B((QspiAddr4B == 1U) ? (u8)TRUE : (u8)FALSE);
+	if (UStatus != XFSBL_SUCCESS) {
+		UStatus = XFSBL_ERROR_QSPI_READ;
+		goto END;
+	}
+
+	UStatus = QspiSessionSetQpi((QspiQpiRead == 1U) ? (u8)TRUE : (u8)FALSE);
+
+END:
+	return UStatus;
+}
+
 /******************************************************************************
 *
 * This functions selects the current bank
@@ -433,7 +774,7 @@ static u32 XFsbl_GetQspiAddr(u32 Address)
 *
 * @return	XST_SUCCESS if bank selected, otherwise XST_FAILURE.
 *
-* @note		None.
+* @note		Nothing is sent if the bank is already selected.
 *
 *
 ******************************************************************************/
@@ -441,6 +782,21 @@ static u32 SendBankSelect(u32 BankSel)
 {
 	s32 Status;
 	u32 UStatus;
+	XFsblPs_QspiSession *Session = QspiSessionState();
+
+	if (Session->Bank == (u8)BankSel) {
+		UStatus = XFSBL_SUCCESS;
+		goto END;
+	}
+	Session->Bank = XFSBL_QSPI_BANK_UNKNOWN;
+
+	/*
+	 * Bank select commands are sent in SPI mode
+	 */
+	UStatus = QspiSessionSetQpi((u8)FALSE);
+	if (UStatus != XFSBL_SUCCESS) {
+		goto END;
+	}
 
 	/*
 	 * bank select commands for Micron and Spansion are different
@@ -582,347 +938,1845 @@ static u32 SendBankSelect(u32 BankSel)
 		}
 	}
 	UStatus = XFSBL_SUCCESS;
+	Session->Bank = (u8)BankSel;
 	/* Winbond can be added here */
 END:
 	return UStatus;
 }
 
-/*****************************************************************************/
-/**
- * This function is used to copy the data from QSPI flash to destination
- * address
- *
- * @param SrcAddress is the address of the QSPI flash where copy should
- * start from
- *
- * @param DestAddress is the address of the destination where it
- * should copy to
- *
- * @param Length Length of the bytes to be copied
- *
- * @return
- * 		- XFSBL_SUCCESS for successful copy
- * 		- errors as mentioned in xfsbl_error.h
- *
- *****************************************************************************/
-u32 XFsbl_Qspi24Copy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
+/******************************************************************************
+*
+* This function sets the read mode used by QspiSetupReadMsg from the
+* ReadCommand deduced from the flash ID and bus width. A read mode selected
+* from SFDP takes precedence over it.
+*
+* @param	None.
+*
+* @return	None.
+*
+* @note		QspiAddrSize must be set before calling this function.
+*
+******************************************************************************/
+static void QspiSetReadMode(void)
 {
-	u32 Status;
-	u32 QspiAddr, OrigAddr;
-	u32 BankSel;
-	u32 RemainingBytes;
-	u32 TransferBytes;
-	u32 DiscardByteCnt;
-	u8 BankSwitchFlag = 0U;
-	u32 BankSize;
-	u32 BankMask;
-	s32 SStatus;
-	u8 TempBuf[XFSBL_SIXTY_FOUR_BYTE_VAL] __attribute__((aligned(64)));
-	u32 UnalignedBytes = (u32)(DestAddress & XFSBL_SIXTY_FOUR_BYTE_MASK);
-	PTRSIZE DestAddr;
+	u8 BusWidth;
+	u8 DummyClocks;
+
+	switch (ReadCommand) {
+	case FAST_READ_CMD_24BIT:
+	case FAST_READ_CMD_32BIT:
+		BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+		DummyClocks = DUMMY_CLOCKS;
+		break;
 
-	XFsbl_Printf(DEBUG_INFO,
-		     "QSPI Reading Src 0x%0lx, Dest %0lx, Length %0lx\r\n",
-		     SrcAddress, DestAddress, Length);
+	case DUAL_READ_CMD_24BIT:
+	case DUAL_READ_CMD_32BIT:
+		BusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
+		DummyClocks = DUMMY_CLOCKS;
+		break;
 
-	/**
-	 * Check the read length with Qspi flash size
-	 */
-	if ((SrcAddress + Length) > QspiFlashSize) {
-		Status = XFSBL_ERROR_QSPI_LENGTH;
-		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_QSPI_LENGTH\r\n");
-		goto END;
-	}
+	case QUAD_READ_CMD_24BIT:
+	case QUAD_READ_CMD_32BIT:
+		BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+		DummyClocks = DUMMY_CLOCKS;
+		break;
 
-	/* Multiply bank size & mask in case of Dual Parallel */
-	if (QspiPsuInstance.Config.ConnectionMode ==
-	    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
-		BankSize = SINGLEBANKSIZE * 2U;
-		BankMask = SINGLEBANKMASK * 2U;
-	} else {
-		BankSize = SINGLEBANKSIZE;
-		BankMask = SINGLEBANKMASK;
+	default:
+		BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+		DummyClocks = 0U;
+		break;
 	}
 
-	/**
-	 * Update no of bytes to be copied
+	QspiReadMode.Command = (u8)ReadCommand;
+	QspiReadMode.AddrBusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	QspiReadMode.DataBusWidth = BusWidth;
+	QspiReadMode.ModeBytes = 0U;
+	QspiReadMode.DummyClocks = DummyClocks;
+
+	/*
+	 * Macronix quad reads are done in QPI 4-4-4 mode
 	 */
-	RemainingBytes = Length;
+	QspiQpiRead = 0U;
+	if ((MacronixFlash == 1U) &&
+	    (QspiPsuInstance.Config.BusWidth == XFSBL_QSPI_BUSWIDTH_FOUR)) {
+		QspiQpiRead = 1U;
+		QspiReadMode.AddrBusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+		QspiReadMode.DataBusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+		QspiReadMode.DummyClocks = DUMMY_CLOCKS_MACRONIX;
+	}
 
-	while (RemainingBytes > 0U) {
-		if (RemainingBytes > DMA_DATA_TRAN_SIZE) {
-			TransferBytes = DMA_DATA_TRAN_SIZE;
-		} else {
-			TransferBytes = RemainingBytes;
-		}
+#ifdef XFSBL_QSPI_SFDP
+	if (QspiSfdpModeValid == 1U) {
+		QspiReadMode = QspiSfdpMode;
+		QspiQpiRead = 0U;
+	}
+#endif
 
-		/* Check for 64 byte alignment of DMA destination */
-		if (UnalignedBytes != 0U) {
-			UnalignedBytes =
-				(u32)XFSBL_SIXTY_FOUR_BYTE_VAL - UnalignedBytes;
-			if (UnalignedBytes > TransferBytes) {
-				UnalignedBytes = TransferBytes;
-			} else {
-				TransferBytes = UnalignedBytes;
-			}
-			DestAddr = (PTRSIZE)TempBuf;
-		} else {
-			DestAddr = DestAddress;
-		}
-		/**
-		 * Translate address based on type of connection
-		 * If stacked assert the slave select based on address
-		 */
-		QspiAddr = XFsbl_GetQspiAddr((u32)SrcAddress);
+	XFsbl_Printf(DEBUG_INFO, "QSPI read command 0x%x, %d-%d-%d, %d dummy"
+		     " clocks\r\n", QspiReadMode.Command,
+		     (QspiQpiRead == 1U) ? XQSPIPSU_SELECT_MODE_QUADSPI :
+		     XQSPIPSU_SELECT_MODE_SPI, QspiReadMode.AddrBusWidth,
+		     QspiReadMode.DataBusWidth, QspiReadMode.DummyClocks);
+}
 
-		/**
-		 * Multiply address by 2 in case of Dual Parallel
-		 * This address is used to calculate the bank crossing
-		 * condition
-		 */
-		if (QspiPsuInstance.Config.ConnectionMode ==
-		    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
-			OrigAddr = QspiAddr * 2U;
-		} else {
-			OrigAddr = QspiAddr;
-		}
+#ifdef XFSBL_QSPI_SFDP
+/******************************************************************************
+*
+* This function reads Length bytes of the SFDP area at Offset into
+* QspiSfdpBuf. SFDP is read in 1-1-1 mode with a 3 byte address and 8 dummy
+* clocks from the lower flash.
+*
+* @param	Offset is the SFDP address to read from.
+* @param	Length is the number of bytes to read, a multiple of 4 that
+*		fits QspiSfdpBuf.
+*
+* @return	XFSBL_SUCCESS if success, otherwise XFSBL_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiSfdpRead(u32 Offset, u32 Length)
+{
+	s32 Status;
+	u32 UStatus;
 
-		/**
-		 * Select bank
-		 * check logic for DualQspi
-		 */
-		if (QspiFlashSize > BankSize) {
-			BankSel = QspiAddr / BANKSIZE;
-			Status = SendBankSelect(BankSel);
-			if (Status != XFSBL_SUCCESS) {
-				Status = XFSBL_ERROR_QSPI_READ;
-				XFsbl_Printf(DEBUG_GENERAL,
-					     "XFSBL_ERROR_QSPI_READ\r\n");
-				goto END;
-			}
-		}
+	WriteBuffer[COMMAND_OFFSET] = READ_SFDP_CMD;
+	WriteBuffer[ADDRESS_1_OFFSET] = (u8)(Offset >> 16U);
+	WriteBuffer[ADDRESS_2_OFFSET] = (u8)(Offset >> 8U);
+	WriteBuffer[ADDRESS_3_OFFSET] = (u8)Offset;
 
-		/**
-		 * If data to be read spans beyond the current bank, then
-		 * calculate Transfer Bytes in current bank. Else
-		 * transfer bytes are same
-		 */
-		if ((OrigAddr & BankMask) !=
-		    ((OrigAddr + TransferBytes) & BankMask)) {
-			TransferBytes =
-				(OrigAddr & BankMask) + BankSize - OrigAddr;
-		}
+	FlashMsg[0].TxBfrPtr = WriteBuffer;
+	FlashMsg[0].RxBfrPtr = NULL;
+	FlashMsg[0].ByteCount = XFSBL_QSPI_ADDR_SIZE_24BIT + 1U;
+	FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
 
-		XFsbl_Printf(DEBUG_INFO, ".");
-		XFsbl_Printf(DEBUG_DETAILED,
-			     "QSPI Read Src 0x%0lx, Dest %0lx, Length %0lx\r\n",
-			     QspiAddr, DestAddress, TransferBytes);
+	FlashMsg[1].TxBfrPtr = NULL;
+	FlashMsg[1].RxBfrPtr = NULL;
+	FlashMsg[1].ByteCount = XFSBL_QSPI_SFDP_DUMMY_CLOCKS;
+	FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	FlashMsg[1].Flags = 0U;
 
-		/**
-		 * Setup the read command with the specified address and data for the
-		 * Flash
-		 */
-		if ((MacronixFlash == 1U) && (QspiPsuInstance.Config.BusWidth ==
-					      XFSBL_QSPI_BUSWIDTH_FOUR)) {
-			/* Enable QPI mode */
-			SStatus = MacronixEnableQPIMode(&QspiPsuInstance,
-							ENABLE_QPI);
-			if (SStatus != XFSBL_SUCCESS) {
-				Status = XFSBL_ERROR_QSPI_READ;
-				XFsbl_Printf(DEBUG_GENERAL,
-					     "XFSBL_ERROR_QSPI_READ\r\n");
-				goto END;
-			}
+	FlashMsg[2].TxBfrPtr = NULL;
+	FlashMsg[2].RxBfrPtr = (u8 *)QspiSfdpBuf;
+	FlashMsg[2].ByteCount = Length;
+	FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	FlashMsg[2].Flags = XQSPIPSU_MSG_FLAG_RX;
 
-			/*Command*/
-			WriteBuffer[COMMAND_OFFSET] = (u8)ReadCommand;
-			DiscardByteCnt = 1;
-			/*MACRONIX is in QPI MODE 4-4-4*/
-			FlashMsg[0].TxBfrPtr = WriteBuffer;
-			FlashMsg[0].RxBfrPtr = NULL;
-			FlashMsg[0].ByteCount = DiscardByteCnt;
-			FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
-			FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
-			/*Address*/
-			WriteBuffer[ADDRESS_1_OFFSET] =
-				(u8)((QspiAddr & 0xFF0000U) >> 16);
-			WriteBuffer[ADDRESS_2_OFFSET] =
-				(u8)((QspiAddr & 0xFF00U) >> 8);
-			WriteBuffer[ADDRESS_3_OFFSET] = (u8)(QspiAddr & 0xFFU);
-			DiscardByteCnt = 3;
-
-			FlashMsg[1].TxBfrPtr = &WriteBuffer[ADDRESS_1_OFFSET];
-			FlashMsg[1].RxBfrPtr = NULL;
-			FlashMsg[1].ByteCount = DiscardByteCnt;
-			FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
-			FlashMsg[1].Flags = XQSPIPSU_MSG_FLAG_TX;
-
-			/*Dummy*/
-			/*Default Dummy is 6 when QPI READ MODE(ECH)*/
-			FlashMsg[2].TxBfrPtr = NULL;
-			FlashMsg[2].RxBfrPtr = NULL;
-			FlashMsg[2].ByteCount = DUMMY_CLOCKS_MACRONIX;
-			FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
-			FlashMsg[2].Flags = 0U;
-
-			/*Data*/
-			FlashMsg[3].TxBfrPtr = NULL;
-			FlashMsg[3].RxBfrPtr = (u8 *)DestAddr;
-			FlashMsg[3].ByteCount = TransferBytes;
-			FlashMsg[3].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
-			FlashMsg[3].Flags = XQSPIPSU_MSG_FLAG_RX;
-			if (QspiPsuInstance.Config.ConnectionMode ==
-			    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
-				FlashMsg[3].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
-			}
+	Status = XQspiPsu_PolledTransfer(&QspiPsuInstance, &FlashMsg[0], 3);
+	if (Status != XFSBL_SUCCESS) {
+		UStatus = XFSBL_FAILURE;
+		goto END;
+	}
 
-			SStatus = XQspiPsu_PolledTransfer(&QspiPsuInstance,
-							  &FlashMsg[0], 4);
-			if (SStatus != XFSBL_SUCCESS) {
-				Status = XFSBL_ERROR_QSPI_READ;
-				XFsbl_Printf(DEBUG_GENERAL,
-					     "XFSBL_ERROR_QSPI_READ\r\n");
-				goto END;
-			}
+	UStatus = XFSBL_SUCCESS;
+
+END:
+	return UStatus;
+}
+
+/******************************************************************************
+*
+* This function checks the Quad Enable bit described by the Quad Enable
+* Requirements field of the BFPT. The bit is only read, FSBL does not write
+* the non-volatile status registers.
+*
+* @param	Qer is the Quad Enable Requirements field.
+*
+* @return	TRUE if quad reads can be issued, otherwise FALSE.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiSfdpQuadEnabled(u32 Qer)
+{
+	s32 Status;
+	u32 Enabled = (u32)FALSE;
+	u8 Mask = 0U;
+
+	switch (Qer) {
+	case XFSBL_QSPI_QER_NONE:
+		Enabled = (u32)TRUE;
+		break;
+
+	case XFSBL_QSPI_QER_SR1_BIT6:
+		WriteBuffer[COMMAND_OFFSET] = READ_STATUS_CMD;
+		Mask = 0x40U;
+		break;
+
+	case XFSBL_QSPI_QER_SR2_BIT7:
+		WriteBuffer[COMMAND_OFFSET] = READ_STATUS2_ALT_CMD;
+		Mask = 0x80U;
+		break;
+
+	case XFSBL_QSPI_QER_SR2_BIT1_WRSR:
+	case XFSBL_QSPI_QER_SR2_BIT1_WRSR2:
+	case XFSBL_QSPI_QER_SR2_BIT1:
+	case XFSBL_QSPI_QER_SR2_BIT1_31H:
+		WriteBuffer[COMMAND_OFFSET] = READ_STATUS2_CMD;
+		Mask = 0x02U;
+		break;
+
+	default:
+		/* Reserved, quad reads are not used */
+		break;
+	}
+
+	if (Mask != 0U) {
+		FlashMsg[0].TxBfrPtr = WriteBuffer;
+		FlashMsg[0].RxBfrPtr = NULL;
+		FlashMsg[0].ByteCount = 1;
+		FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+		FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+
+		FlashMsg[1].TxBfrPtr = NULL;
+		FlashMsg[1].RxBfrPtr = ReadBuffer;
+		FlashMsg[1].ByteCount = 1;
+		FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+		FlashMsg[1].Flags = XQSPIPSU_MSG_FLAG_RX;
+
+		Status = XQspiPsu_PolledTransfer(&QspiPsuInstance, &FlashMsg[0],
+						 2);
+		if ((Status == XFSBL_SUCCESS) &&
+		    ((ReadBuffer[0] & Mask) != 0U)) {
+			Enabled = (u32)TRUE;
+		}
+	}
+
+	return Enabled;
+}
+
+/******************************************************************************
+*
+* This function decodes a 16 bit fast read parameter field of the BFPT
+* (opcode, mode clocks and wait states) into a read mode. Modes whose mode
+* clocks do not add up to whole bytes are left unsupported.
+*
+* @param	Mode is the read mode to fill in, Command is 0 if unsupported.
+* @param	ModeIndex is one of XFSBL_QSPI_SFDP_MODE_*.
+* @param	Params is the 16 bit parameter field.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void QspiSfdpDecodeMode(XFsblPs_QspiReadMode *Mode, u32 ModeIndex,
+			       u32 Params)
+{
+	u32 ModeBits;
+
+	Mode->AddrBusWidth = QspiSfdpModeInfo[ModeIndex].AddrBusWidth;
+	Mode->DataBusWidth = QspiSfdpModeInfo[ModeIndex].DataBusWidth;
+	Mode->Command = (u8)((Params >> 8U) & 0xFFU);
+	Mode->DummyClocks = (u8)(Params & 0x1FU);
+
+	/* XQSPIPSU_SELECT_MODE_* is the number of lines */
+	ModeBits = ((Params >> 5U) & 0x7U) * Mode->AddrBusWidth;
+	Mode->ModeBytes = (u8)(ModeBits / 8U);
+	if (((ModeBits % 8U) != 0U) ||
+	    (Mode->ModeBytes > XFSBL_QSPI_MODE_BYTES_MAX)) {
+		Mode->Command = 0U;
+	}
+}
+
+/******************************************************************************
+*
+* This function reads the SFDP header and the parameter headers and locates
+* the Basic Flash Parameter Table and the 4-byte Address Instruction Table.
+* The longest major revision 1 BFPT is used.
+*
+* @param	BfptPtr is the SFDP address of the BFPT.
+* @param	BfptWords is the number of DWORDs of the BFPT.
+* @param	FourBaitPtr is the SFDP address of the 4BAIT, 0 if there is
+*		none.
+*
+* @return	XFSBL_SUCCESS if a usable BFPT is found, otherwise
+*		XFSBL_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiSfdpTables(u32 *BfptPtr, u32 *BfptWords, u32 *FourBaitPtr)
+{
+	u32 UStatus = XFSBL_FAILURE;
+	u32 NumHeaders;
+	u32 Index;
+	u32 Id;
+
+	*BfptPtr = 0U;
+	*BfptWords = 0U;
+	*FourBaitPtr = 0U;
+
+	/*
+	 * SFDP header
+	 */
+	if (QspiSfdpRead(0U, XFSBL_QSPI_SFDP_HEADER_SIZE) != XFSBL_SUCCESS) {
+		goto END;
+	}
+	if (QspiSfdpBuf[0U] != XFSBL_QSPI_SFDP_SIGNATURE) {
+		XFsbl_Printf(DEBUG_INFO, "QSPI flash has no SFDP\r\n");
+		goto END;
+	}
+	XFsbl_Printf(DEBUG_INFO, "SFDP rev %d.%d\r\n",
+		     (QspiSfdpBuf[1U] >> 8U) & 0xFFU, QspiSfdpBuf[1U] & 0xFFU);
+
+	NumHeaders = ((QspiSfdpBuf[1U] >> 16U) & 0xFFU) + 1U;
+	if (NumHeaders > XFSBL_QSPI_SFDP_MAX_PARAM_HEADERS) {
+		NumHeaders = XFSBL_QSPI_SFDP_MAX_PARAM_HEADERS;
+	}
+
+	/*
+	 * Parameter headers
+	 */
+	if (QspiSfdpRead(XFSBL_QSPI_SFDP_HEADER_SIZE,
+			 NumHeaders * XFSBL_QSPI_SFDP_HEADER_SIZE) !=
+	    XFSBL_SUCCESS) {
+		goto END;
+	}
+	for (Index = 0U; Index < NumHeaders; Index++) {
+		Id = ((QspiSfdpBuf[(2U * Index) + 1U] >> 16U) & 0xFF00U) |
+		     (QspiSfdpBuf[2U * Index] & 0xFFU);
+		if ((Id == XFSBL_QSPI_SFDP_BFPT_ID) &&
+		    (((QspiSfdpBuf[2U * Index] >> 16U) & 0xFFU) == 1U) &&
+		    ((QspiSfdpBuf[2U * Index] >> 24U) > *BfptWords)) {
+			*BfptWords = QspiSfdpBuf[2U * Index] >> 24U;
+			*BfptPtr = QspiSfdpBuf[(2U * Index) + 1U] & 0xFFFFFFU;
+		} else if (Id == XFSBL_QSPI_SFDP_4BAIT_ID) {
+			*FourBaitPtr = QspiSfdpBuf[(2U * Index) + 1U] &
+				       0xFFFFFFU;
+		} else {
+			/* Other tables are not used */
+		}
+	}
+	if (*BfptWords >= XFSBL_QSPI_BFPT_DWORD_MIN) {
+		UStatus = XFSBL_SUCCESS;
+	}
+
+END:
+	return UStatus;
+}
+
+/******************************************************************************
+*
+* This function reads the address bytes field of the BFPT and the read
+* support bits of the 4BAIT.
+*
+* @param	FourBait is DWORD1 of the 4BAIT, 0 if there is none.
+*
+* @return	One of XFSBL_QSPI_BFPT_ADDR_BYTES_*, 3 byte only if the flash
+*		has no SFDP.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiSfdpAddrBytes(u32 *FourBait)
+{
+	u32 AddrBytes = XFSBL_QSPI_BFPT_ADDR_BYTES_3_ONLY;
+	u32 BfptPtr;
+	u32 BfptWords;
+	u32 FourBaitPtr;
+
+	*FourBait = 0U;
+	if ((QspiSfdpTables(&BfptPtr, &BfptWords, &FourBaitPtr) !=
+	     XFSBL_SUCCESS) ||
+	    (QspiSfdpRead(BfptPtr, 4U) != XFSBL_SUCCESS)) {
+		goto END;
+	}
+	AddrBytes = (QspiSfdpBuf[0U] >> XFSBL_QSPI_BFPT_ADDR_BYTES_SHIFT) &
+		    XFSBL_QSPI_BFPT_ADDR_BYTES_MASK;
+
+	if ((FourBaitPtr != 0U) &&
+	    (QspiSfdpRead(FourBaitPtr, 4U) == XFSBL_SUCCESS)) {
+		*FourBait = QspiSfdpBuf[0U];
+	}
+
+END:
+	return AddrBytes;
+}
+
+/******************************************************************************
+*
+* This function parses the SFDP Basic Flash Parameter Table and, if present,
+* the 4-byte Address Instruction Table and selects the read mode with the
+* widest data bus the controller and the Quad Enable state allow. Among
+* modes of the same width the one with the fewest clocks before the data
+* is taken.
+*
+* DTR and 4-4-4 reads are reported but not selected, the GQSPI generic FIFO
+* has no DTR support and 4-4-4 needs the whole device switched to QPI.
+*
+* @param	AddrSize is the number of address bytes sent with reads.
+* @param	QuadTrusted is TRUE if quad reads may be used when the table
+*		does not describe the Quad Enable requirements.
+* @param	Mode is the selected read mode.
+* @param	Qer is the Quad Enable Requirements field, or
+*		XFSBL_QSPI_BFPT_QER_MASK if the table does not describe them.
+*
+* @return	XFSBL_SUCCESS if a read mode is selected, otherwise
+*		XFSBL_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiSfdpParse(u32 AddrSize, u32 QuadTrusted,
+			 XFsblPs_QspiReadMode *Mode, u32 *Qer)
+{
+	XFsblPs_QspiReadMode Modes[XFSBL_QSPI_SFDP_MODE_COUNT];
+	u32 UStatus = XFSBL_FAILURE;
+	u32 Index;
+	u32 BfptPtr;
+	u32 BfptWords;
+	u32 FourBaitPtr;
+	u32 FourBait = 0U;
+	u32 Dword1;
+	u32 Dword3;
+	u32 Dword4;
+	u32 Dword5;
+	u32 Dword7;
+	u32 QuadOk;
+	u32 MaxBusWidth;
+	u32 Cost;
+	u32 BestCost = 0U;
+	u32 Best = XFSBL_QSPI_SFDP_MODE_COUNT;
+
+	*Qer = XFSBL_QSPI_BFPT_QER_MASK;
+	if (QspiSfdpTables(&BfptPtr, &BfptWords, &FourBaitPtr) !=
+	    XFSBL_SUCCESS) {
+		goto END;
+	}
+	if (BfptWords > XFSBL_QSPI_BFPT_DWORD_QER) {
+		BfptWords = XFSBL_QSPI_BFPT_DWORD_QER;
+	}
+
+	/*
+	 * Basic Flash Parameter Table
+	 */
+	if (QspiSfdpRead(BfptPtr, BfptWords * 4U) != XFSBL_SUCCESS) {
+		goto END;
+	}
+	Dword1 = QspiSfdpBuf[0U];
+	Dword3 = QspiSfdpBuf[2U];
+	Dword4 = QspiSfdpBuf[3U];
+	Dword5 = QspiSfdpBuf[4U];
+	Dword7 = QspiSfdpBuf[6U];
+	if (BfptWords == XFSBL_QSPI_BFPT_DWORD_QER) {
+		*Qer = (QspiSfdpBuf[XFSBL_QSPI_BFPT_DWORD_QER - 1U] >>
+			XFSBL_QSPI_BFPT_QER_SHIFT) & XFSBL_QSPI_BFPT_QER_MASK;
+	}
+
+	if ((Dword1 & XFSBL_QSPI_BFPT_DTR_MASK) != 0U) {
+		XFsbl_Printf(DEBUG_INFO, "SFDP: DTR reads supported, not"
+			     " used\r\n");
+	}
+	if ((Dword5 & XFSBL_QSPI_BFPT_FAST_READ_444_MASK) != 0U) {
+		XFsbl_Printf(DEBUG_INFO, "SFDP: 4-4-4 read 0x%x supported, not"
+			     " used\r\n", (Dword7 >> 24U) & 0xFFU);
+	}
+
+	/*
+	 * 4-byte Address Instruction Table
+	 */
+	if (FourBaitPtr != 0U) {
+		if (QspiSfdpRead(FourBaitPtr, 4U) != XFSBL_SUCCESS) {
+			goto END;
+		}
+		FourBait = QspiSfdpBuf[0U];
+	}
+
+	/*
+	 * Candidate read modes, 1-1-1 fast read is mandatory
+	 */
+	(void)memset(Modes, 0, sizeof(Modes));
+	Modes[XFSBL_QSPI_SFDP_MODE_111].Command = FAST_READ_CMD_24BIT;
+	Modes[XFSBL_QSPI_SFDP_MODE_111].AddrBusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	Modes[XFSBL_QSPI_SFDP_MODE_111].DataBusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	Modes[XFSBL_QSPI_SFDP_MODE_111].DummyClocks = DUMMY_CLOCKS;
+	if ((Dword1 & XFSBL_QSPI_BFPT_FAST_READ_112_MASK) != 0U) {
+		QspiSfdpDecodeMode(&Modes[XFSBL_QSPI_SFDP_MODE_112],
+				   XFSBL_QSPI_SFDP_MODE_112, Dword4 & 0xFFFFU);
+	}
+	if ((Dword1 & XFSBL_QSPI_BFPT_FAST_READ_122_MASK) != 0U) {
+		QspiSfdpDecodeMode(&Modes[XFSBL_QSPI_SFDP_MODE_122],
+				   XFSBL_QSPI_SFDP_MODE_122, Dword4 >> 16U);
+	}
+	if ((Dword1 & XFSBL_QSPI_BFPT_FAST_READ_114_MASK) != 0U) {
+		QspiSfdpDecodeMode(&Modes[XFSBL_QSPI_SFDP_MODE_114],
+				   XFSBL_QSPI_SFDP_MODE_114, Dword3 >> 16U);
+	}
+	if ((Dword1 & XFSBL_QSPI_BFPT_FAST_READ_144_MASK) != 0U) {
+		QspiSfdpDecodeMode(&Modes[XFSBL_QSPI_SFDP_MODE_144],
+				   XFSBL_QSPI_SFDP_MODE_144, Dword3 & 0xFFFFU);
+	}
+
+	/*
+	 * Address width. A 4-byte only device takes 4 address bytes with
+	 * the BFPT opcodes. Otherwise 32 bit boot needs the 4-byte address
+	 * opcodes, without a 4BAIT only the 1-1-x ones already used by
+	 * FSBL are assumed.
+	 */
+	if (((Dword1 >> XFSBL_QSPI_BFPT_ADDR_BYTES_SHIFT) &
+	     XFSBL_QSPI_BFPT_ADDR_BYTES_MASK) ==
+	    XFSBL_QSPI_BFPT_ADDR_BYTES_4_ONLY) {
+		if (AddrSize == XFSBL_QSPI_ADDR_SIZE_24BIT) {
+			XFsbl_Printf(DEBUG_INFO, "SFDP: 4-byte address only"
+				     " device\r\n");
+			goto END;
+		}
+	} else if (AddrSize == XFSBL_QSPI_ADDR_SIZE_32BIT) {
+		for (Index = 0U; Index < XFSBL_QSPI_SFDP_MODE_COUNT; Index++) {
+			if (FourBaitPtr != 0U) {
+				if ((FourBait &
+				     QspiSfdpModeInfo[Index].Support4BMask) ==
+				    0U) {
+					Modes[Index].Command = 0U;
+				}
+			} else if ((QspiSfdpModeInfo[Index].AddrBusWidth !=
+				    XQSPIPSU_SELECT_MODE_SPI) ||
+				   ((u32)Modes[Index].Command + 1U !=
+				    QspiSfdpModeInfo[Index].Command4B)) {
+				Modes[Index].Command = 0U;
+			} else {
+				/* Standard 1-1-x opcode */
+			}
+			if (Modes[Index].Command != 0U) {
+				Modes[Index].Command =
+					QspiSfdpModeInfo[Index].Command4B;
+			}
+		}
+	} else {
+		/* 3 byte opcodes as described */
+	}
+
+	/*
+	 * Quad reads need the Quad Enable bit. When the BFPT does not
+	 * describe it, quad is used only where FSBL used it before.
+	 */
+	if (*Qer != XFSBL_QSPI_BFPT_QER_MASK) {
+		QuadOk = QspiSfdpQuadEnabled(*Qer);
+	} else {
+		QuadOk = QuadTrusted;
+	}
+
+	switch (QspiPsuInstance.Config.BusWidth) {
+	case XFSBL_QSPI_BUSWIDTH_FOUR:
+		MaxBusWidth = (QuadOk == (u32)TRUE) ?
+			XQSPIPSU_SELECT_MODE_QUADSPI :
+			XQSPIPSU_SELECT_MODE_DUALSPI;
+		break;
+
+	case XFSBL_QSPI_BUSWIDTH_TWO:
+		MaxBusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
+		break;
+
+	default:
+		MaxBusWidth = XQSPIPSU_SELECT_MODE_SPI;
+		break;
+	}
+
+	for (Index = 0U; Index < XFSBL_QSPI_SFDP_MODE_COUNT; Index++) {
+		if ((Modes[Index].Command != 0U) &&
+		    (Modes[Index].DataBusWidth <= MaxBusWidth)) {
+			/* Clocks for command, address, mode and dummy */
+			Cost = 8U + (((AddrSize + Modes[Index].ModeBytes) *
+				      8U) / Modes[Index].AddrBusWidth) +
+			       Modes[Index].DummyClocks;
+			if ((Best == XFSBL_QSPI_SFDP_MODE_COUNT) ||
+			    (Modes[Index].DataBusWidth >
+			     Modes[Best].DataBusWidth) ||
+			    ((Modes[Index].DataBusWidth ==
+			      Modes[Best].DataBusWidth) &&
+			     (Cost < BestCost))) {
+				Best = Index;
+				BestCost = Cost;
+			}
+		}
+	}
+
+	if (Best != XFSBL_QSPI_SFDP_MODE_COUNT) {
+		*Mode = Modes[Best];
+		UStatus = XFSBL_SUCCESS;
+	}
+
+END:
+	return UStatus;
+}
+
+/******************************************************************************
+*
+* This function selects the QSPI read mode from SFDP. The selection is kept
+* in XFSBL_QSPI_SFDP_CACHE_REGISTER, tagged with a hash of the flash ID, so
+* that warm boots skip the parse. As different flashes may share the tag,
+* the Quad Enable bit is checked again before a cached quad read mode is
+* used. It must be called once the read command has been deduced from the
+* flash ID, before the flash is switched to 4-byte address mode.
+*
+* @param	AddrSize is the number of address bytes sent with reads.
+*
+* @return	None. If no read mode can be selected the one deduced from the
+*		flash ID is used.
+*
+* @note		None.
+*
+******************************************************************************/
+static void QspiSfdpProbe(u32 AddrSize)
+{
+	u32 Cache;
+	u32 Tag;
+	u32 Qer;
+	u32 QuadOk;
+	u32 Addr32 = 0U;
+	u32 QuadTrusted = (u32)FALSE;
+
+	if (AddrSize == XFSBL_QSPI_ADDR_SIZE_32BIT) {
+		Addr32 = XFSBL_QSPI_SFDP_CACHE_ADDR32_MASK;
+	}
+	Tag = ((u32)ReadBuffer[0U] ^ ((u32)ReadBuffer[1U] << 1U) ^
+	       ((u32)ReadBuffer[2U] << 2U)) & 0xFFU;
+
+	if (((ReadCommand == QUAD_READ_CMD_24BIT) ||
+	     (ReadCommand == QUAD_READ_CMD_32BIT)) &&
+	    (IssiIdFlag == 0U) && (MacronixFlash == 0U)) {
+		QuadTrusted = (u32)TRUE;
+	}
+
+	QspiSfdpModeValid = 0U;
+	Cache = XFsbl_In32(XFSBL_QSPI_SFDP_CACHE_REGISTER);
+	if (((Cache & XFSBL_QSPI_SFDP_CACHE_VALID_MASK) ==
+	     XFSBL_QSPI_SFDP_CACHE_VALID) &&
+	    ((Cache & XFSBL_QSPI_SFDP_CACHE_ADDR32_MASK) == Addr32) &&
+	    ((Cache >> XFSBL_QSPI_SFDP_CACHE_TAG_SHIFT) == Tag)) {
+		QspiSfdpMode.Command =
+			(u8)(Cache & XFSBL_QSPI_SFDP_CACHE_CMD_MASK);
+		QspiSfdpMode.DummyClocks =
+			(u8)((Cache >> XFSBL_QSPI_SFDP_CACHE_DUMMY_SHIFT) &
+			     XFSBL_QSPI_SFDP_CACHE_DUMMY_MASK);
+		QspiSfdpMode.ModeBytes =
+			(u8)((Cache >> XFSBL_QSPI_SFDP_CACHE_MODE_SHIFT) &
+			     XFSBL_QSPI_SFDP_CACHE_MODE_MASK);
+		QspiSfdpMode.AddrBusWidth =
+			(u8)(1U << ((Cache >>
+				     XFSBL_QSPI_SFDP_CACHE_ADDR_BW_SHIFT) &
+				    XFSBL_QSPI_SFDP_CACHE_BW_MASK));
+		QspiSfdpMode.DataBusWidth =
+			(u8)(1U << ((Cache >>
+				     XFSBL_QSPI_SFDP_CACHE_DATA_BW_SHIFT) &
+				    XFSBL_QSPI_SFDP_CACHE_BW_MASK));
+		Qer = (Cache >> XFSBL_QSPI_SFDP_CACHE_QER_SHIFT) &
+		      XFSBL_QSPI_BFPT_QER_MASK;
+
+		QuadOk = (u32)TRUE;
+		if ((QspiSfdpMode.AddrBusWidth ==
+		     XQSPIPSU_SELECT_MODE_QUADSPI) ||
+		    (QspiSfdpMode.DataBusWidth ==
+		     XQSPIPSU_SELECT_MODE_QUADSPI)) {
+			if (Qer != XFSBL_QSPI_BFPT_QER_MASK) {
+				QuadOk = QspiSfdpQuadEnabled(Qer);
+			} else {
+				QuadOk = QuadTrusted;
+			}
+		}
+		if (QuadOk == (u32)TRUE) {
+			QspiSfdpModeValid = 1U;
+			XFsbl_Printf(DEBUG_INFO, "QSPI read mode from SFDP"
+				     " cache\r\n");
+			goto END;
+		}
+	}
+
+	Cache = 0U;
+	if (QspiSfdpParse(AddrSize, QuadTrusted, &QspiSfdpMode, &Qer) ==
+	    XFSBL_SUCCESS) {
+		QspiSfdpModeValid = 1U;
+		Cache = (u32)QspiSfdpMode.Command |
+			((u32)QspiSfdpMode.DummyClocks <<
+			 XFSBL_QSPI_SFDP_CACHE_DUMMY_SHIFT) |
+			((u32)QspiSfdpMode.ModeBytes <<
+			 XFSBL_QSPI_SFDP_CACHE_MODE_SHIFT) |
+			(((u32)QspiSfdpMode.AddrBusWidth >> 1U) <<
+			 XFSBL_QSPI_SFDP_CACHE_ADDR_BW_SHIFT) |
+			(((u32)QspiSfdpMode.DataBusWidth >> 1U) <<
+			 XFSBL_QSPI_SFDP_CACHE_DATA_BW_SHIFT) |
+			Addr32 |
+			(Qer << XFSBL_QSPI_SFDP_CACHE_QER_SHIFT) |
+			XFSBL_QSPI_SFDP_CACHE_VALID |
+			(Tag << XFSBL_QSPI_SFDP_CACHE_TAG_SHIFT);
+	}
+	XFsbl_Out32(XFSBL_QSPI_SFDP_CACHE_REGISTER, Cache);
+
+END:
+	return;
+}
+#endif
+
+/******************************************************************************
+*
+* This function sets up the message list for a read of Length bytes from
+* QspiAddr into DestAddr with the read mode selected at init. The command
+* goes out in SPI mode, or on four lines in QPI mode, address and mode bytes
+* use the address bus width and dummy cycles and data use the data bus width
+* of the read mode.
+*
+* @param	QspiAddr is the flash address as returned by XFsbl_GetQspiAddr.
+* @param	DestAddr is the address of the buffer the data is read into.
+* @param	Length is the number of bytes to be read.
+*
+* @return	Number of messages set up in FlashMsg.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiSetupReadMsg(u32 QspiAddr, PTRSIZE DestAddr, u32 Length)
+{
+	u32 Index;
+	u32 AddrBytes;
+	u32 NumMsg = 0U;
+	u8 CmdBusWidth = XQSPIPSU_SELECT_MODE_SPI;
+
+	if (QspiQpiRead == 1U) {
+		CmdBusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+	}
+
+	WriteBuffer[COMMAND_OFFSET] = QspiReadMode.Command;
+	for (Index = 0U; Index < QspiAddrSize; Index++) {
+		WriteBuffer[ADDRESS_1_OFFSET + Index] =
+			(u8)(QspiAddr >> (8U * (QspiAddrSize - 1U - Index)));
+	}
+	for (Index = 0U; Index < QspiReadMode.ModeBytes; Index++) {
+		WriteBuffer[ADDRESS_1_OFFSET + QspiAddrSize + Index] =
+			XFSBL_QSPI_MODE_BITS_NONE;
+	}
+	AddrBytes = QspiAddrSize + QspiReadMode.ModeBytes;
+
+	/*
+	 * Command and address share one entry unless the address is sent
+	 * on more lines than the command
+	 */
+	if (QspiReadMode.AddrBusWidth == CmdBusWidth) {
+		FlashMsg[NumMsg].TxBfrPtr = WriteBuffer;
+		FlashMsg[NumMsg].RxBfrPtr = NULL;
+		FlashMsg[NumMsg].ByteCount = AddrBytes + 1U;
+		FlashMsg[NumMsg].BusWidth = CmdBusWidth;
+		FlashMsg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_TX;
+		NumMsg++;
+	} else {
+		FlashMsg[NumMsg].TxBfrPtr = WriteBuffer;
+		FlashMsg[NumMsg].RxBfrPtr = NULL;
+		FlashMsg[NumMsg].ByteCount = 1U;
+		FlashMsg[NumMsg].BusWidth = CmdBusWidth;
+		FlashMsg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_TX;
+		NumMsg++;
+
+		FlashMsg[NumMsg].TxBfrPtr = &WriteBuffer[ADDRESS_1_OFFSET];
+		FlashMsg[NumMsg].RxBfrPtr = NULL;
+		FlashMsg[NumMsg].ByteCount = AddrBytes;
+		FlashMsg[NumMsg].BusWidth = QspiReadMode.AddrBusWidth;
+		FlashMsg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_TX;
+		NumMsg++;
+	}
+
+	/*
+	 * It is recommended to have a separate entry for dummy and that
+	 * bus width value during dummy phase is same as data phase
+	 */
+	if (QspiReadMode.DummyClocks != 0U) {
+		FlashMsg[NumMsg].TxBfrPtr = NULL;
+		FlashMsg[NumMsg].RxBfrPtr = NULL;
+		FlashMsg[NumMsg].ByteCount = QspiReadMode.DummyClocks;
+		FlashMsg[NumMsg].BusWidth = QspiReadMode.DataBusWidth;
+		FlashMsg[NumMsg].Flags = 0U;
+		NumMsg++;
+	}
+
+	FlashMsg[NumMsg].TxBfrPtr = NULL;
+	FlashMsg[NumMsg].RxBfrPtr = (u8 *)DestAddr;
+	FlashMsg[NumMsg].ByteCount = Length;
+	FlashMsg[NumMsg].BusWidth = QspiReadMode.DataBusWidth;
+	FlashMsg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_RX;
+	if (QspiPsuInstance.Config.ConnectionMode ==
+	    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		FlashMsg[NumMsg].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
+	}
+	NumMsg++;
+
+	return NumMsg;
+}
+
+/******************************************************************************
+*
+* This function reads Length bytes from the flash with a single blocking
+* transfer.
+*
+* @param	SrcAddress is the linear flash address to read from.
+* @param	DestAddr is the address of the buffer the data is read into.
+* @param	Length is the number of bytes to be read.
+*
+* @return	XFSBL_SUCCESS if success, otherwise XFSBL_ERROR_QSPI_READ.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiPolledRead(u32 SrcAddress, PTRSIZE DestAddr, u32 Length)
+{
+	s32 Status;
+	u32 UStatus;
+	u32 QspiAddr;
+	u32 NumMsg;
+
+	/**
+	 * Translate address based on type of connection
+	 * If stacked assert the slave select based on address
+	 */
+	QspiAddr = XFsbl_GetQspiAddr(SrcAddress);
+
+	UStatus = QspiSessionPrepareRead();
+	if (UStatus != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	NumMsg = QspiSetupReadMsg(QspiAddr, DestAddr, Length);
+
+	/**
+	 * Send the read command to the Flash to read the specified number
+	 * of bytes from the Flash, send the read command and address and
+	 * receive the specified number of bytes of data in the data buffer
+	 */
+	Status = XQspiPsu_PolledTransfer(&QspiPsuInstance, &FlashMsg[0],
+					 NumMsg);
+	if (Status != XFSBL_SUCCESS) {
+		UStatus = XFSBL_ERROR_QSPI_READ;
+		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_QSPI_READ\r\n");
+		goto END;
+	}
+
+	UStatus = XFSBL_SUCCESS;
+
+END:
+	return UStatus;
+}
+
+#ifdef XFSBL_QSPI_CALIB
+/******************************************************************************
+*
+* This function reads the calibration region and returns its CRC.
+*
+* @param	Crc is the CRC of the region.
+*
+* @return	XFSBL_SUCCESS if success, otherwise XFSBL_ERROR_QSPI_READ.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiCalibReadCrc(u32 *Crc)
+{
+	u32 UStatus;
+	u32 QspiAddr;
+
+	if ((QspiAddrSize == XFSBL_QSPI_ADDR_SIZE_24BIT) &&
+	    (QspiFlashSize > BANKSIZE)) {
+		QspiAddr = XFsbl_GetQspiAddr(XFSBL_QSPI_CALIB_OFFSET);
+		UStatus = SendBankSelect(QspiAddr / BANKSIZE);
+		if (UStatus != XFSBL_SUCCESS) {
+			UStatus = XFSBL_ERROR_QSPI_READ;
+			goto END;
+		}
+	}
+
+	UStatus = QspiPolledRead(XFSBL_QSPI_CALIB_OFFSET,
+				 (PTRSIZE)QspiCalibBuf, XFSBL_QSPI_CALIB_SIZE);
+	if (UStatus != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	*Crc = XFsbl_Crc32C(0U, QspiCalibBuf, XFSBL_QSPI_CALIB_SIZE);
+
+END:
+	return UStatus;
+}
+
+/******************************************************************************
+*
+* This function sets the QSPI clock prescaler and the receive data delay.
+*
+* @param	Prescaler is one of XQSPIPSU_CLK_PRESCALE_*.
+* @param	Tap is the data delay tap, 0 to XFSBL_QSPI_CALIB_TAPS - 1 or
+*		XFSBL_QSPI_CALIB_TAP_DEFAULT.
+*
+* @return	XFSBL_SUCCESS if success, otherwise
+*		XFSBL_ERROR_QSPI_PRESCALER_CLK when the driver has no tap delay
+*		settings for the resulting clock.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiCalibApply(u8 Prescaler, u32 Tap)
+{
+	s32 Status;
+	u32 UStatus;
+	u32 DataDelay = 0U;
+
+	Status = XQspiPsu_SetClkPrescaler(&QspiPsuInstance, Prescaler);
+	if (Status != XFSBL_SUCCESS) {
+		UStatus = XFSBL_ERROR_QSPI_PRESCALER_CLK;
+		goto END;
+	}
+
+	if (Tap != XFSBL_QSPI_CALIB_TAP_DEFAULT) {
+		if (Tap != 0U) {
+			DataDelay = XQSPIPSU_DATA_DLY_ADJ_USE_DATA_DLY_MASK |
+				    ((Tap - 1U) <<
+				     XQSPIPSU_DATA_DLY_ADJ_DLY_SHIFT);
+		}
+		XQspiPsu_WriteReg(QspiPsuInstance.Config.BaseAddress,
+				  XQSPIPSU_DATA_DLY_ADJ_OFFSET, DataDelay);
+	}
+
+	UStatus = XFSBL_SUCCESS;
+
+END:
+	return UStatus;
+}
+
+/******************************************************************************
+*
+* This function checks that the calibration region reads back with the
+* reference CRC XFSBL_QSPI_CALIB_READS times in a row.
+*
+* @param	None.
+*
+* @return	TRUE if all reads match, otherwise FALSE.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiCalibCheck(void)
+{
+	u32 Pass = (u32)TRUE;
+	u32 Index;
+	u32 Crc = 0U;
+
+	for (Index = 0U; (Index < XFSBL_QSPI_CALIB_READS) &&
+	     (Pass == (u32)TRUE); Index++) {
+		if ((QspiCalibReadCrc(&Crc) != XFSBL_SUCCESS) ||
+		    (Crc != QspiCalibRefCrc)) {
+			Pass = (u32)FALSE;
+		}
+	}
+
+	return Pass;
+}
+
+/******************************************************************************
+*
+* This function sweeps the data delay taps at one prescaler and selects the
+* centre of the widest window of taps that read the calibration region
+* back correctly.
+*
+* @param	Prescaler is one of XQSPIPSU_CLK_PRESCALE_*.
+* @param	Tap is the selected tap.
+*
+* @return	XFSBL_SUCCESS if a window of at least
+*		XFSBL_QSPI_CALIB_MIN_WINDOW taps is found, otherwise
+*		XFSBL_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiCalibSweep(u8 Prescaler, u32 *Tap)
+{
+	u32 UStatus = XFSBL_FAILURE;
+	u32 Index;
+	u32 Start = 0U;
+	u32 Length = 0U;
+	u32 BestStart = 0U;
+	u32 BestLength = 0U;
+
+	for (Index = 0U; Index < XFSBL_QSPI_CALIB_TAPS; Index++) {
+		if ((QspiCalibApply(Prescaler, Index) == XFSBL_SUCCESS) &&
+		    (QspiCalibCheck() == (u32)TRUE)) {
+			if (Length == 0U) {
+				Start = Index;
+			}
+			Length++;
+			if (Length > BestLength) {
+				BestStart = Start;
+				BestLength = Length;
+			}
+		} else {
+			Length = 0U;
+		}
+	}
+
+	if (BestLength >= XFSBL_QSPI_CALIB_MIN_WINDOW) {
+		*Tap = BestStart + (BestLength / 2U);
+		if ((QspiCalibApply(Prescaler, *Tap) == XFSBL_SUCCESS) &&
+		    (QspiCalibCheck() == (u32)TRUE)) {
+			UStatus = XFSBL_SUCCESS;
+		}
+	}
+
+	return UStatus;
+}
+
+/******************************************************************************
+*
+* This function saves the prescaler and tap in use for warm boots.
+*
+* @param	Tap is the data delay tap in use.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void QspiCalibSave(u32 Tap)
+{
+	XFsbl_Out32(XFSBL_QSPI_CALIB_CACHE_REGISTER,
+		    (QspiCalibRefCrc & XFSBL_QSPI_CALIB_CACHE_CRC_MASK) |
+		    XFSBL_QSPI_CALIB_CACHE_VALID |
+		    ((Tap & XFSBL_QSPI_CALIB_CACHE_TAP_MASK) <<
+		     XFSBL_QSPI_CALIB_CACHE_TAP_SHIFT) |
+		    ((u32)QspiCalibPrescaler &
+		     XFSBL_QSPI_CALIB_CACHE_PRESCALER_MASK));
+}
+
+/******************************************************************************
+*
+* This function calibrates the QSPI clock. The calibration region is read
+* at the default prescaler to get the reference CRC. The setting saved by a
+* previous boot is tried first. Otherwise the prescalers faster than the
+* default are swept, fastest first, and the first one with a stable window
+* of data delay taps is kept. The flash stays at the default prescaler if
+* none is found or the region is not usable.
+* The setting is verified here only, later read and checksum failures slow
+* it down through XFsbl_QspiCalibFallback.
+*
+* @param	None.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void QspiCalibrate(void)
+{
+	u32 Cache;
+	u32 Crc = 0U;
+	u32 Tap = XFSBL_QSPI_CALIB_TAP_DEFAULT;
+	u32 Index;
+	u8 Prescaler;
+
+	QspiCalibPrescaler = XFSBL_QSPI_CLK_PRESCALER;
+
+	/*
+	 * Reference CRC at the default clock, the region must read back the
+	 * same twice and must not be blank
+	 */
+	if ((QspiCalibReadCrc(&QspiCalibRefCrc) != XFSBL_SUCCESS) ||
+	    (QspiCalibReadCrc(&Crc) != XFSBL_SUCCESS) ||
+	    (Crc != QspiCalibRefCrc)) {
+		XFsbl_Printf(DEBUG_INFO, "QSPI calibration region unstable\r\n");
+		goto END;
+	}
+	for (Index = 1U; (Index < XFSBL_QSPI_CALIB_SIZE) &&
+	     (QspiCalibBuf[Index] == QspiCalibBuf[0U]); Index++) {
+		;
+	}
+	if (Index == XFSBL_QSPI_CALIB_SIZE) {
+		XFsbl_Printf(DEBUG_INFO, "QSPI calibration region blank\r\n");
+		goto END;
+	}
+
+	Cache = XFsbl_In32(XFSBL_QSPI_CALIB_CACHE_REGISTER);
+	if (((Cache & XFSBL_QSPI_CALIB_CACHE_VALID_MASK) ==
+	     XFSBL_QSPI_CALIB_CACHE_VALID) &&
+	    ((Cache & XFSBL_QSPI_CALIB_CACHE_CRC_MASK) ==
+	     (QspiCalibRefCrc & XFSBL_QSPI_CALIB_CACHE_CRC_MASK))) {
+		Prescaler = (u8)(Cache & XFSBL_QSPI_CALIB_CACHE_PRESCALER_MASK);
+		Tap = (Cache >> XFSBL_QSPI_CALIB_CACHE_TAP_SHIFT) &
+		      XFSBL_QSPI_CALIB_CACHE_TAP_MASK;
+		if ((QspiCalibApply(Prescaler, Tap) == XFSBL_SUCCESS) &&
+		    (QspiCalibCheck() == (u32)TRUE)) {
+			QspiCalibPrescaler = Prescaler;
+			XFsbl_Printf(DEBUG_INFO, "QSPI clock from calibration"
+				     " cache\r\n");
+			goto END;
+		}
+	}
+
+	Tap = XFSBL_QSPI_CALIB_TAP_DEFAULT;
+	for (Prescaler = XQSPIPSU_CLK_PRESCALE_2;
+	     Prescaler < XFSBL_QSPI_CLK_PRESCALER; Prescaler++) {
+		if (QspiCalibSweep(Prescaler, &Tap) == XFSBL_SUCCESS) {
+			QspiCalibPrescaler = Prescaler;
+			break;
+		}
+	}
+	if (QspiCalibPrescaler == XFSBL_QSPI_CLK_PRESCALER) {
+		Tap = XFSBL_QSPI_CALIB_TAP_DEFAULT;
+		(void)QspiCalibApply(QspiCalibPrescaler, Tap);
+	}
+	QspiCalibSave(Tap);
+
+END:
+	XFsbl_Printf(DEBUG_INFO, "QSPI clock prescaler %d, tap %d\r\n",
+		     QspiCalibPrescaler, Tap);
+}
+
+/******************************************************************************
+*
+* This function slows a calibrated clock down by one prescaler step, with
+* the driver tap delays, after a read or checksum failure. The slower
+* setting is saved for warm boots, so that the fallback boot uses it too.
+*
+* @param	None.
+*
+* @return	TRUE if the clock was slowed down, FALSE if it already runs at
+*		the default prescaler or cannot be slowed down.
+*
+* @note		No copy request may be in progress.
+*
+******************************************************************************/
+u32 XFsbl_QspiCalibFallback(void)
+{
+	u32 Slowed = (u32)FALSE;
+
+	if (QspiCalibPrescaler < XFSBL_QSPI_CLK_PRESCALER) {
+		QspiCalibPrescaler++;
+		XFsbl_Printf(DEBUG_GENERAL, "QSPI read failure, clock"
+			     " prescaler %d\r\n", QspiCalibPrescaler);
+		if (QspiCalibApply(QspiCalibPrescaler,
+				   XFSBL_QSPI_CALIB_TAP_DEFAULT) ==
+		    XFSBL_SUCCESS) {
+			QspiCalibSave(XFSBL_QSPI_CALIB_TAP_DEFAULT);
+			Slowed = (u32)TRUE;
+		} else {
+			XFsbl_Printf(DEBUG_GENERAL,
+				     "XFSBL_ERROR_QSPI_PRESCALER_CLK\r\n");
+		}
+	}
+
+	return Slowed;
+}
+#endif
+
+#ifdef XFSBL_QSPI_STREAM
+/******************************************************************************
+*
+* This function hands a chunk of data that has landed in memory to the
+* registered post-processing hook and accounts the time spent in it.
+*
+* @param	ChunkAddr is the address of the chunk.
+* @param	ChunkBytes is the length of the chunk.
+*
+* @return	XFSBL_SUCCESS if there is no hook, otherwise the hook status.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiStreamNotify(PTRSIZE ChunkAddr, u32 ChunkBytes)
+{
+	u32 UStatus = XFSBL_SUCCESS;
+	XTime tStart;
+	XTime tEnd;
+
+	if ((QspiStreamHook != NULL) && (ChunkBytes != 0U)) {
+		XTime_GetTime(&tStart);
+		UStatus = QspiStreamHook(ChunkAddr, ChunkBytes,
+					 QspiStreamHookContext);
+		XTime_GetTime(&tEnd);
+		QspiStreamStats.HookTicks += tEnd - tStart;
+	}
+
+	return UStatus;
+}
+
+/******************************************************************************
+*
+* This function updates the streaming counters for a chunk read by DMA.
+*
+* @param	ChunkBytes is the length of the chunk.
+* @param	ChunkTicks is the time from DMA start until the DMA was seen
+*		done.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void QspiStreamAccount(u32 ChunkBytes, XTime ChunkTicks)
+{
+	QspiStreamStats.Chunks++;
+	QspiStreamStats.Bytes += ChunkBytes;
+	QspiStreamStats.DmaTicks += ChunkTicks;
+	if ((QspiStreamStats.MinChunkTicks == 0U) ||
+	    (ChunkTicks < QspiStreamStats.MinChunkTicks)) {
+		QspiStreamStats.MinChunkTicks = ChunkTicks;
+	}
+	if (ChunkTicks > QspiStreamStats.MaxChunkTicks) {
+		QspiStreamStats.MaxChunkTicks = ChunkTicks;
+	}
+}
+#endif
+
+/******************************************************************************
+*
+* This function starts the next segment of a request, that is the part of
+* it which can be read without changing the bank or crossing a die. In 24
+* bit mode the bank of the segment is selected here.
+*
+* @param	Request is the request to be advanced.
+*
+* @return	XFSBL_SUCCESS if success, otherwise XFSBL_ERROR_QSPI_READ.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiStartSegment(XFsblPs_DeviceRequest *Request)
+{
+	u32 UStatus;
+	u32 QspiAddr;
+	u32 OrigAddr;
+	u32 BankSize;
+	u32 BankMask;
+	u32 TransferBytes = Request->RemainingBytes;
+
+	if (TransferBytes > DMA_DATA_TRAN_SIZE) {
+		TransferBytes = DMA_DATA_TRAN_SIZE;
+	}
+
+	if (QspiAddrSize == XFSBL_QSPI_ADDR_SIZE_24BIT) {
+		BankSize = SINGLEBANKSIZE;
+		BankMask = SINGLEBANKMASK;
+	} else if (MultiDie == (u8)TRUE) {
+		BankSize = BANKSIZE_64MB;
+		BankMask = BANKMASK_64MB;
+	} else {
+		BankSize = BANKSIZE;
+		BankMask = BANKMASK;
+	}
 
-			/* Disable QPI mode */
-			SStatus = MacronixEnableQPIMode(&QspiPsuInstance,
-							DISABLE_QPI);
-			if (SStatus != XFSBL_SUCCESS) {
-				Status = XFSBL_ERROR_QSPI_READ;
-				XFsbl_Printf(DEBUG_GENERAL,
-					     "XFSBL_ERROR_QSPI_READ\r\n");
-				goto END;
+	/**
+	 * Translate address based on type of connection
+	 * If stacked assert the slave select based on address
+	 */
+	QspiAddr = XFsbl_GetQspiAddr(Request->SrcAddress);
+
+	/**
+	 * Multiply bank size, mask and address by 2 in case of Dual Parallel
+	 * This address is used to calculate the bank crossing condition
+	 */
+	if (QspiPsuInstance.Config.ConnectionMode ==
+	    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		BankSize *= 2U;
+		BankMask *= 2U;
+		OrigAddr = QspiAddr * 2U;
+	} else {
+		OrigAddr = QspiAddr;
+	}
+
+	/**
+	 * Select bank
+	 * check logic for DualQspi
+	 */
+	if ((QspiAddrSize == XFSBL_QSPI_ADDR_SIZE_24BIT) &&
+	    (QspiFlashSize > BankSize)) {
+		UStatus = SendBankSelect(QspiAddr / BANKSIZE);
+		if (UStatus != XFSBL_SUCCESS) {
+			UStatus = XFSBL_ERROR_QSPI_READ;
+			XFsbl_Printf(DEBUG_GENERAL,
+				     "XFSBL_ERROR_QSPI_READ\r\n");
+			goto END;
+		}
+	}
+
+	/**
+	 * If data to be read spans beyond the current bank or die, then
+	 * calculate Transfer Bytes in current bank. Else
+	 * transfer bytes are same
+	 */
+	if ((QspiAddrSize == XFSBL_QSPI_ADDR_SIZE_24BIT) ||
+	    (MultiDie == (u8)TRUE)) {
+		if ((OrigAddr & BankMask) !=
+		    ((OrigAddr + TransferBytes) & BankMask)) {
+			TransferBytes =
+				(OrigAddr & BankMask) + BankSize - OrigAddr;
+		}
+	}
+
+	Request->SegmentBytes = TransferBytes;
+	UStatus = XFSBL_SUCCESS;
+
+END:
+	return UStatus;
+}
+
+/******************************************************************************
+*
+* This function kicks off the DMA read of the next Length bytes of a
+* request and returns without waiting for the data.
+*
+* @param	Request is the request to be advanced.
+* @param	Length is the number of bytes to be read, a multiple of 4.
+*
+* @return	XFSBL_SUCCESS if success, otherwise XFSBL_ERROR_QSPI_READ.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiStartDma(XFsblPs_DeviceRequest *Request, u32 Length)
+{
+	s32 Status;
+	u32 UStatus;
+	u32 NumMsg;
+	u32 QspiAddr;
+	XTime StartTime;
+
+	QspiAddr = XFsbl_GetQspiAddr(Request->SrcAddress);
+
+	UStatus = QspiSessionPrepareRead();
+	if (UStatus != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	NumMsg = QspiSetupReadMsg(QspiAddr, Request->DestAddress, Length);
+
+	XTime_GetTime(&StartTime);
+	Status = XQspiPsu_StartDmaTransfer(&QspiPsuInstance, &FlashMsg[0],
+					   NumMsg);
+	if (Status != XFSBL_SUCCESS) {
+		UStatus = XFSBL_ERROR_QSPI_READ;
+		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_QSPI_READ\r\n");
+		goto END;
+	}
+
+	Request->StartTime = StartTime;
+	Request->InFlightAddress = Request->DestAddress;
+	Request->InFlightBytes = Length;
+	UStatus = XFSBL_SUCCESS;
+
+END:
+	return UStatus;
+}
+
+/******************************************************************************
+*
+* This function issues the next reads of a request until either a DMA is in
+* flight or the request has been read completely. Reads which can not be
+* done by DMA in the background (unaligned head, last chunk not a multiple
+* of a word) are done blocking.
+*
+* @param	Request is the request to be advanced.
+* @param	DmaOnly is TRUE to stop at the first read that would block.
+*
+* @return	XFSBL_SUCCESS if success, otherwise error code.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiIssue(XFsblPs_DeviceRequest *Request, u32 DmaOnly)
+{
+	u32 UseDma;
+	u32 UStatus = XFSBL_SUCCESS;
+	u32 UnalignedBytes;
+	u32 TransferBytes;
+
+	while ((Request->RemainingBytes != 0U) &&
+	       (Request->InFlightBytes == 0U)) {
+		if (Request->SegmentBytes == 0U) {
+			UStatus = QspiStartSegment(Request);
+			if (UStatus != XFSBL_SUCCESS) {
+				break;
+			}
+		}
+		TransferBytes = Request->SegmentBytes;
+
+		/* Check for 64 byte alignment of DMA destination */
+		UnalignedBytes = (u32)(Request->DestAddress &
+				       XFSBL_SIXTY_FOUR_BYTE_MASK);
+		if (UnalignedBytes != 0U) {
+			if (DmaOnly == (u32)TRUE) {
+				break;
 			}
+			UnalignedBytes =
+				(u32)XFSBL_SIXTY_FOUR_BYTE_VAL - UnalignedBytes;
+			if (TransferBytes > UnalignedBytes) {
+				TransferBytes = UnalignedBytes;
+			}
+			UStatus = QspiPolledRead(Request->SrcAddress,
+						 (PTRSIZE)QspiTempBuf,
+						 TransferBytes);
+			if (UStatus != XFSBL_SUCCESS) {
+				break;
+			}
+			Xil_MemCpy((void *)Request->DestAddress, QspiTempBuf,
+				   TransferBytes);
 		} else {
-			WriteBuffer[COMMAND_OFFSET] = (u8)ReadCommand;
-			WriteBuffer[ADDRESS_1_OFFSET] =
-				(u8)((QspiAddr & 0xFF0000U) >> 16);
-			WriteBuffer[ADDRESS_2_OFFSET] =
-				(u8)((QspiAddr & 0xFF00U) >> 8);
-			WriteBuffer[ADDRESS_3_OFFSET] = (u8)(QspiAddr & 0xFFU);
-			DiscardByteCnt = 4;
-
-			FlashMsg[0].TxBfrPtr = WriteBuffer;
-			FlashMsg[0].RxBfrPtr = NULL;
-			FlashMsg[0].ByteCount = DiscardByteCnt;
-			FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-			FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
-
-			/* It is recommended to have a separate entry for dummy */
-			if ((ReadCommand == FAST_READ_CMD_24BIT) ||
-			    (ReadCommand == DUAL_READ_CMD_24BIT) ||
-			    (ReadCommand == QUAD_READ_CMD_24BIT)) {
-				/* Update Dummy cycles as per flash specs for QUAD IO */
-
-				/*
-				 * It is recommended that Bus width value during dummy
-				 * phase should be same as data phase
-				 */
-				if (ReadCommand == FAST_READ_CMD_24BIT) {
-					FlashMsg[1].BusWidth =
-						XQSPIPSU_SELECT_MODE_SPI;
-				}
+#ifdef XFSBL_QSPI_STREAM
+			if (TransferBytes > QspiStreamChunkSize) {
+				TransferBytes = QspiStreamChunkSize;
+			}
+#endif
+			if (TransferBytes > XQSPIPSU_DMA_BYTES_MAX) {
+				TransferBytes = XQSPIPSU_DMA_BYTES_MAX;
+			}
 
-				if (ReadCommand == DUAL_READ_CMD_24BIT) {
-					FlashMsg[1].BusWidth =
-						XQSPIPSU_SELECT_MODE_DUALSPI;
-				}
+			/*
+			 * XQspiPsu_CheckDmaDone does not read the IO mode
+			 * remainder of a transfer that is not a multiple of
+			 * a word, such a transfer is done blocking
+			 */
+			UseDma = (u32)TRUE;
+			if ((TransferBytes & XFSBL_QSPI_WORD_MASK) != 0U) {
+				UseDma = (u32)FALSE;
+			}
+
+			if (UseDma == (u32)TRUE) {
+				UStatus = QspiStartDma(Request, TransferBytes);
+			} else if (DmaOnly == (u32)TRUE) {
+				break;
+			} else {
+				UStatus = QspiPolledRead(Request->SrcAddress,
+							 Request->DestAddress,
+							 TransferBytes);
+			}
+			if (UStatus != XFSBL_SUCCESS) {
+				break;
+			}
+		}
+
+#ifdef XFSBL_QSPI_STREAM
+		if (Request->InFlightBytes == 0U) {
+			UStatus = QspiStreamNotify(Request->DestAddress,
+						   TransferBytes);
+			if (UStatus != XFSBL_SUCCESS) {
+				break;
+			}
+		}
+#endif
+
+		/**
+		 * Update the variables
+		 */
+		Request->RemainingBytes -= TransferBytes;
+		Request->SegmentBytes -= TransferBytes;
+		Request->DestAddress += TransferBytes;
+		Request->SrcAddress += TransferBytes;
+	}
+
+	return UStatus;
+}
+
+/******************************************************************************
+*
+* This function completes a request once it has failed or all of its data
+* has landed in memory.
+*
+* @param	Request is the request to be updated.
+* @param	Status is the status of the last step of the request.
+*
+* @return	XFSBL_STATUS_DEVICE_REQUEST_PENDING while the request is in
+*		progress, otherwise its completion status.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiUpdateRequest(XFsblPs_DeviceRequest *Request, u32 Status)
+{
+	if ((Status == XFSBL_SUCCESS) && ((Request->RemainingBytes != 0U) ||
+					  (Request->InFlightBytes != 0U))) {
+		return XFSBL_STATUS_DEVICE_REQUEST_PENDING;
+	}
+
+	/* Do not leave the controller busy behind a failed request */
+	if (Request->InFlightBytes != 0U) {
+		(void)XFSBL_POLL_UNTIL(
+			XQspiPsu_CheckDmaDone(&QspiPsuInstance) == XST_SUCCESS,
+			XFSBL_QSPI_DMA_TIMEOUT, 0U);
+		Request->InFlightBytes = 0U;
+	}
+
+	Request->Status = Status;
+	Request->State = XFSBL_DEVICE_REQUEST_DONE;
+	QspiActiveRequest = NULL;
+
+#ifdef XFSBL_QSPI_CALIB
+	if (Status != XFSBL_SUCCESS) {
+		(void)XFsbl_QspiCalibFallback();
+	}
+#endif
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function submits a request to copy data from QSPI flash to the
+ * destination address. The first DMA of the request is started before
+ * returning, the rest of the request is driven by XFsbl_QspiCopyPoll or
+ * XFsbl_QspiCopyWait. Only one request can be in progress at a time.
+ *
+ * @param Request is the request handle, owned by the caller until the
+ * request is done
+ *
+ * @param SrcAddress is the address of the QSPI flash where copy should
+ * start from
+ *
+ * @param DestAddress is the address of the destination where it
+ * should copy to
+ *
+ * @param Length Length of the bytes to be copied
+ *
+ * @return
+ * 		- XFSBL_SUCCESS if the request was accepted
+ * 		- errors as mentioned in xfsbl_error.h
+ *
+ *****************************************************************************/
+u32 XFsbl_QspiCopySubmit(XFsblPs_DeviceRequest *Request, u32 SrcAddress,
+			 PTRSIZE DestAddress, u32 Length)
+{
+	u32 UStatus;
+
+	XFsbl_Printf(DEBUG_DETAILED,
+		     "QSPI Reading Src 0x%0lx, Dest %0lx, Length %0lx\r\n",
+		     SrcAddress, DestAddress, Length);
+
+	Request->State = XFSBL_DEVICE_REQUEST_DONE;
+
+	/**
+	 * Check the read length with Qspi flash size
+	 */
+	if ((SrcAddress + Length) > QspiFlashSize) {
+		UStatus = XFSBL_ERROR_QSPI_LENGTH;
+		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_QSPI_LENGTH\r\n");
+		goto END;
+	}
+
+	if (QspiActiveRequest != NULL) {
+		UStatus = XFSBL_ERROR_DEVICE_BUSY;
+		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_DEVICE_BUSY\r\n");
+		goto END;
+	}
+
+	Request->SrcAddress = SrcAddress;
+	Request->DestAddress = DestAddress;
+	Request->RemainingBytes = Length;
+	Request->SegmentBytes = 0U;
+	Request->InFlightAddress = 0U;
+	Request->InFlightBytes = 0U;
+	Request->StartTime = 0U;
+	Request->State = XFSBL_DEVICE_REQUEST_PENDING;
+	QspiActiveRequest = Request;
+
+	UStatus = QspiUpdateRequest(Request, QspiIssue(Request, FALSE));
+	if (UStatus == XFSBL_STATUS_DEVICE_REQUEST_PENDING) {
+		UStatus = XFSBL_SUCCESS;
+	}
+
+END:
+	if (Request->State == XFSBL_DEVICE_REQUEST_DONE) {
+		Request->Status = UStatus;
+	}
+	return UStatus;
+}
+
+/*****************************************************************************/
+/**
+ * This function advances a submitted request without blocking. When the
+ * DMA in flight is done, the next one is started before the chunk which
+ * just landed is handed to the post-processing hook.
+ *
+ * @param Request is the request handle
+ *
+ * @return
+ * 		- XFSBL_STATUS_DEVICE_REQUEST_PENDING if the request is in progress
+ * 		- XFSBL_SUCCESS if the request is done
+ * 		- errors as mentioned in xfsbl_error.h
+ *
+ *****************************************************************************/
+u32 XFsbl_QspiCopyPoll(XFsblPs_DeviceRequest *Request)
+{
+	u32 UStatus;
+#ifdef XFSBL_QSPI_STREAM
+	XTime DoneTime;
+	PTRSIZE ChunkAddr = 0U;
+	u32 ChunkBytes = 0U;
+#endif
+
+	if (Request->State != XFSBL_DEVICE_REQUEST_PENDING) {
+		UStatus = Request->Status;
+		goto END;
+	}
+
+	if (Request->InFlightBytes != 0U) {
+		if (XQspiPsu_CheckDmaDone(&QspiPsuInstance) != XST_SUCCESS) {
+			UStatus = XFSBL_STATUS_DEVICE_REQUEST_PENDING;
+			goto END;
+		}
+#ifdef XFSBL_QSPI_STREAM
+		XTime_GetTime(&DoneTime);
+		QspiStreamAccount(Request->InFlightBytes,
+				  DoneTime - Request->StartTime);
+		ChunkAddr = Request->InFlightAddress;
+		ChunkBytes = Request->InFlightBytes;
+#endif
+		Request->InFlightBytes = 0U;
+	}
+
+	/*
+	 * Keep the flash busy while the CPU works on the chunk that landed.
+	 * Blocking reads are only done after the hook has seen the chunk so
+	 * that it gets the data in order.
+	 */
+	UStatus = QspiIssue(Request, TRUE);
+#ifdef XFSBL_QSPI_STREAM
+	if (UStatus == XFSBL_SUCCESS) {
+		UStatus = QspiStreamNotify(ChunkAddr, ChunkBytes);
+	}
+#endif
+	if (UStatus == XFSBL_SUCCESS) {
+		UStatus = QspiIssue(Request, FALSE);
+	}
+	UStatus = QspiUpdateRequest(Request, UStatus);
+
+END:
+	return UStatus;
+}
+
+/*****************************************************************************/
+/**
+ * This function blocks until a submitted request is done. A request which
+ * is not done by XFSBL_QSPI_COPY_TIMEOUT is failed with
+ * XFSBL_ERROR_POLL_TIMEOUT.
+ *
+ * @param Request is the request handle
+ *
+ * @return
+ * 		- XFSBL_SUCCESS if the request is done
+ * 		- errors as mentioned in xfsbl_error.h
+ *
+ *****************************************************************************/
+u32 XFsbl_QspiCopyWait(XFsblPs_DeviceRequest *Request)
+{
+	XFsblPs_Poll Poll;
+	u32 PollStatus = XFSBL_SUCCESS;
+	u32 UStatus;
+#ifdef XFSBL_QSPI_STREAM
+	XTime tStart;
+	XTime tEnd;
+#endif
+
+	XFsbl_PollStart(&Poll, XFSBL_POLL_SITE(),
+			XFSBL_QSPI_COPY_TIMEOUT(Request->RemainingBytes +
+						Request->InFlightBytes), 0U);
+	for (;;) {
+#ifdef XFSBL_QSPI_STREAM
+		XTime_GetTime(&tStart);
+#endif
+		UStatus = XFsbl_QspiCopyPoll(Request);
+		if (UStatus != XFSBL_STATUS_DEVICE_REQUEST_PENDING) {
+			break;
+		}
+#ifdef XFSBL_QSPI_STREAM
+		XTime_GetTime(&tEnd);
+		QspiStreamStats.WaitTicks += tEnd - tStart;
+#endif
+		PollStatus = XFsbl_PollRetry(&Poll);
+		if (PollStatus != XFSBL_SUCCESS) {
+			XFsbl_Printf(DEBUG_GENERAL,
+				     "XFSBL_ERROR_POLL_TIMEOUT: QSPI copy\r\n");
+			UStatus = QspiUpdateRequest(Request, PollStatus);
+			break;
+		}
+	}
+	(void)XFsbl_PollEnd(&Poll, PollStatus);
+
+	return UStatus;
+}
+
+/*****************************************************************************/
+/**
+ * This function copies from the QSPI flash and waits for the copy. A copy
+ * which fails at a calibrated clock is read again at the slower clock the
+ * failure falls back to.
+ *
+ * @param SrcAddress is the address of the QSPI flash where copy should
+ * start from
+ *
+ * @param DestAddress is the address of the destination where it
+ * should copy to
+ *
+ * @param Length Length of the bytes to be copied
+ *
+ * @return
+ * 		- XFSBL_SUCCESS for successful copy
+ * 		- errors as mentioned in xfsbl_error.h
+ *
+ *****************************************************************************/
+static u32 QspiCopy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
+{
+	XFsblPs_DeviceRequest Request;
+	u32 Status;
+#ifdef XFSBL_QSPI_CALIB
+	u8 Prescaler;
+#endif
+
+	for (;;) {
+#ifdef XFSBL_QSPI_CALIB
+		Prescaler = QspiCalibPrescaler;
+#endif
+		Status = XFsbl_QspiCopySubmit(&Request, SrcAddress,
+					      DestAddress, Length);
+		if (Status == XFSBL_SUCCESS) {
+			Status = XFsbl_QspiCopyWait(&Request);
+		}
+#ifdef XFSBL_QSPI_CALIB
+		if ((Status != XFSBL_SUCCESS) &&
+		    (Prescaler != QspiCalibPrescaler)) {
+			continue;
+		}
+#endif
+		break;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function is used to copy the data from QSPI flash to destination
+ * address
+ *
+ * @param SrcAddress is the address of the QSPI flash where copy should
+ * start from
+ *
+ * @param DestAddress is the address of the destination where it
+ * should copy to
+ *
+ * @param Length Length of the bytes to be copied
+ *
+ * @return
+ * 		- XFSBL_SUCCESS for successful copy
+ * 		- errors as mentioned in xfsbl_error.h
+ *
+ *****************************************************************************/
+u32 XFsbl_Qspi24Copy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
+{
+	return QspiCopy(SrcAddress, DestAddress, Length);
+}
 
-				if (ReadCommand == QUAD_READ_CMD_24BIT) {
-					FlashMsg[1].BusWidth =
-						XQSPIPSU_SELECT_MODE_QUADSPI;
-				}
+/******************************************************************************
+*
+* This function brings the selected flash device back to the mode the
+* BootROM reads it in: SPI mode, bank 0 and 3 byte addresses. The bank is
+* also reset when 24 bit boot mode has been reading with 4 byte addresses,
+* as the bank left by the BootROM is not known then.
+*
+* @param	None.
+*
+* @return	XFSBL_SUCCESS if success, otherwise error code.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiSessionRestoreDevice(void)
+{
+	u32 UStatus;
+	XFsblPs_QspiSession *Session = QspiSessionState();
 
-				FlashMsg[1].TxBfrPtr = NULL;
-				FlashMsg[1].RxBfrPtr = NULL;
-				FlashMsg[1].ByteCount = DUMMY_CLOCKS;
-				FlashMsg[1].Flags = 0U;
-			}
+	UStatus = QspiSessionSetQpi((u8)FALSE);
+	if (UStatus != XFSBL_SUCCESS) {
+		goto END;
+	}
 
-			if (ReadCommand == FAST_READ_CMD_24BIT) {
-				FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-			}
+	if ((Session->Bank != 0U) &&
+	    ((Session->Bank != XFSBL_QSPI_BANK_UNKNOWN) ||
+	     (Qspi24Promoted == 1U))) {
+		UStatus = SendBankSelect(0U);
+		if (UStatus != XFSBL_SUCCESS) {
+			goto END;
+		}
+	}
 
-			if (ReadCommand == DUAL_READ_CMD_24BIT) {
-				FlashMsg[2].BusWidth =
-					XQSPIPSU_SELECT_MODE_DUALSPI;
-			}
+	UStatus = QspiSessionSet4B((u8)FALSE);
 
-			if (ReadCommand == QUAD_READ_CMD_24BIT) {
-				FlashMsg[2].BusWidth =
-					XQSPIPSU_SELECT_MODE_QUADSPI;
-			}
+END:
+	return UStatus;
+}
 
-			FlashMsg[2].TxBfrPtr = NULL;
-			FlashMsg[2].RxBfrPtr = (u8 *)DestAddr;
-			FlashMsg[2].ByteCount = TransferBytes;
-			FlashMsg[2].Flags = XQSPIPSU_MSG_FLAG_RX;
+/******************************************************************************
+*
+* This function waits for the request in progress, if any, and brings all
+* flash devices back to the mode the BootROM reads them in, so that a
+* later reset which does not reset the flash can boot again.
+*
+* @param	None.
+*
+* @return	XFSBL_SUCCESS if success, otherwise error code.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 QspiSessionRestore(void)
+{
+	u32 UStatus = XFSBL_SUCCESS;
 
-			if (QspiPsuInstance.Config.ConnectionMode ==
-			    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
-				FlashMsg[2].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
-			}
+	/* Nothing to restore if the init did not get that far */
+	if (QspiPsuInstance.IsReady != XIL_COMPONENT_IS_READY) {
+		goto END;
+	}
 
-			/**
-			 * Send the read command to the Flash to read the specified number
-			 * of bytes from the Flash, send the read command and address and
-			 * receive the specified number of bytes of data in the data buffer
-			 */
-			SStatus = XQspiPsu_PolledTransfer(&QspiPsuInstance,
-							  &FlashMsg[0], 3);
-			if (SStatus != XFSBL_SUCCESS) {
-				Status = XFSBL_ERROR_QSPI_READ;
-				XFsbl_Printf(DEBUG_GENERAL,
-					     "XFSBL_ERROR_QSPI_READ\r\n");
-				goto END;
-			}
-		}
+	if (QspiActiveRequest != NULL) {
+		(void)XFsbl_QspiCopyWait(QspiActiveRequest);
+	}
 
-		if (UnalignedBytes != 0U) {
-			Xil_MemCpy((void *)DestAddress, TempBuf,
-				   UnalignedBytes);
-			UnalignedBytes = 0U;
-		}
-		/**
-		 * Update the variables
-		 */
-		RemainingBytes -= TransferBytes;
-		DestAddress += TransferBytes;
-		SrcAddress += TransferBytes;
+	if (QspiPsuInstance.Config.ConnectionMode ==
+	    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		XQspiPsu_SelectFlash(&QspiPsuInstance,
+				     XQSPIPSU_SELECT_FLASH_CS_BOTH,
+				     XQSPIPSU_SELECT_FLASH_BUS_BOTH);
+		UStatus = QspiSessionRestoreDevice();
+		goto END;
 	}
 
-	if (BankSwitchFlag == 1U) {
-		/*
-		 * Reset Bank selection to zero
-		 */
-		Status = SendBankSelect(0);
-		if (Status != XFSBL_SUCCESS) {
-			Status = XFSBL_ERROR_QSPI_READ;
-			XFsbl_Printf(DEBUG_GENERAL,
-				     "XFSBL_ERROR_QSPI_READ\r\n");
+	if (QspiPsuInstance.Config.ConnectionMode ==
+	    XQSPIPSU_CONNECTION_MODE_STACKED) {
+		XQspiPsu_SelectFlash(&QspiPsuInstance,
+				     XQSPIPSU_SELECT_FLASH_CS_UPPER,
+				     XQSPIPSU_SELECT_FLASH_BUS_LOWER);
+		UStatus = QspiSessionRestoreDevice();
+		if (UStatus != XFSBL_SUCCESS) {
 			goto END;
 		}
-	} else {
-		Status = XFSBL_SUCCESS;
 	}
 
+	XQspiPsu_SelectFlash(&QspiPsuInstance, XQSPIPSU_SELECT_FLASH_CS_LOWER,
+			     XQSPIPSU_SELECT_FLASH_BUS_LOWER);
+	UStatus = QspiSessionRestoreDevice();
+
 END:
-	return (u32)Status;
+	return UStatus;
 }
 
 /*****************************************************************************/
 /**
- * This function is used to release the Qspi settings
+ * This function is used to release the Qspi settings. The flash is left
+ * in the mode the BootROM reads it in.
  *
  * @param	None
  *
- * @return	None
+ * @return	XFSBL_SUCCESS or error code
  *
  *****************************************************************************/
 u32 XFsbl_Qspi24Release(void)
 {
-	u32 Status = XFSBL_SUCCESS;
+	u32 Status;
+
+	Status = QspiSessionRestore();
+
+#ifdef XFSBL_QSPI_STREAM
+	XFsbl_QspiPrintStreamStats();
+#endif
 
 	return Status;
 }
@@ -977,7 +2831,7 @@ u32 XFsbl_Qspi32Init(u32 DeviceFlags)
 	 * Set the pre-scaler for QSPI clock
 	 */
 	Status = XQspiPsu_SetClkPrescaler(&QspiPsuInstance,
-					  XQSPIPSU_CLK_PRESCALE_8);
+					  XFSBL_QSPI_CLK_PRESCALER);
 
 	if (Status != XFSBL_SUCCESS) {
 		UStatus = XFSBL_ERROR_QSPI_PRESCALER_CLK;
@@ -1038,6 +2892,8 @@ u32 XFsbl_Qspi32Init(u32 DeviceFlags)
 	} break;
 	}
 
+	QspiSessionReset();
+
 	/**
 	 * Read Flash ID and extract Manufacture and Size information
 	 */
@@ -1046,18 +2902,26 @@ u32 XFsbl_Qspi32Init(u32 DeviceFlags)
 		goto END;
 	}
 
+#ifdef XFSBL_QSPI_SFDP
+	/**
+	 * Look up the fastest read mode described by the flash
+	 */
+	QspiSfdpProbe(XFSBL_QSPI_ADDR_SIZE_32BIT);
+#endif
+
 	if (MacronixFlash == 1U) {
 		if (QspiPsuInstance.Config.BusWidth ==
 		    XFSBL_QSPI_BUSWIDTH_FOUR) {
 			ReadCommand = QUAD_READ_CMD_24BIT2;
 		}
+		QspiAddr4B = 1U;
 
 		if (QspiPsuInstance.Config.ConnectionMode ==
 		    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
 			XQspiPsu_SelectFlash(&QspiPsuInstance,
 					     XQSPIPSU_SELECT_FLASH_CS_BOTH,
 					     XQSPIPSU_SELECT_FLASH_BUS_BOTH);
-			Status = MacronixEnable4B(&QspiPsuInstance);
+			Status = QspiSessionSet4B((u8)TRUE);
 			if (Status != XFSBL_SUCCESS) {
 				goto END;
 			}
@@ -1065,7 +2929,7 @@ u32 XFsbl_Qspi32Init(u32 DeviceFlags)
 			XQspiPsu_SelectFlash(&QspiPsuInstance,
 					     XQSPIPSU_SELECT_FLASH_CS_LOWER,
 					     XQSPIPSU_SELECT_FLASH_BUS_LOWER);
-			Status = MacronixEnable4B(&QspiPsuInstance);
+			Status = QspiSessionSet4B((u8)TRUE);
 			if (Status != XFSBL_SUCCESS) {
 				goto END;
 			}
@@ -1079,13 +2943,16 @@ u32 XFsbl_Qspi32Init(u32 DeviceFlags)
 					&QspiPsuInstance,
 					XQSPIPSU_SELECT_FLASH_CS_UPPER,
 					XQSPIPSU_SELECT_FLASH_BUS_LOWER);
-				Status = MacronixEnable4B(&QspiPsuInstance);
+				Status = QspiSessionSet4B((u8)TRUE);
 				if (Status != XFSBL_SUCCESS) {
 					goto END;
 				}
 			}
 		}
 	}
+	QspiAddrSize = XFSBL_QSPI_ADDR_SIZE_32BIT;
+	QspiSetReadMode();
+
 	/**
 	 * add code: For a Stacked connection, read second Flash ID
 	 */
@@ -1095,27 +2962,37 @@ u32 XFsbl_Qspi32Init(u32 DeviceFlags)
 		QspiFlashSize = 2 * QspiFlashSize;
 	}
 
+#ifdef XFSBL_QSPI_CALIB
+	/**
+	 * Read at the fastest clock the flash is read back reliably with
+	 */
+	QspiCalibrate();
+#endif
+
 END:
 	return UStatus;
 }
 
 /******************************************************************************
 *
-* Static API used for Macronix flash to enable 4BYTE mode
+* Static API used for Macronix flash to enable or disable 4BYTE mode
 *
 * @param	QspiPsuPtr Pointer to QSPI instance.
+* @param    Enable valid values are 0 (disable) and 1 (enable).
 *
 * @return	XFSBL_SUCCESS if success, otherwise XFSBL_FAILURE.
 *
 * @note		None.
 *
 ******************************************************************************/
-static u32 MacronixEnable4B(XQspiPsu *QspiPsuPtr)
+static u32 MacronixEnable4B(XQspiPsu *QspiPsuPtr, int Enable)
 {
 	s32 Status;
 	u32 UStatus;
 
-	XFsbl_Printf(DEBUG_GENERAL, "MACRONIX_FLASH_MODE\r\n");
+	if (Enable == (int)TRUE) {
+		XFsbl_Printf(DEBUG_GENERAL, "MACRONIX_FLASH_MODE\r\n");
+	}
 
 	/*Enable register write*/
 	TxBfrPtr = WRITE_ENABLE_CMD;
@@ -1131,8 +3008,12 @@ static u32 MacronixEnable4B(XQspiPsu *QspiPsuPtr)
 		goto END;
 	}
 
-	/*Enable 4 byte mode*/
-	TxBfrPtr = 0xB7;
+	/*Enter or exit 4 byte mode*/
+	if (Enable == (int)TRUE) {
+		TxBfrPtr = ENTER_4B_CMD;
+	} else {
+		TxBfrPtr = EXIT_4B_CMD;
+	}
 	FlashMsg[0].TxBfrPtr = &TxBfrPtr;
 	FlashMsg[0].RxBfrPtr = NULL;
 	FlashMsg[0].ByteCount = 1;
@@ -1144,7 +3025,9 @@ static u32 MacronixEnable4B(XQspiPsu *QspiPsuPtr)
 		UStatus = XFSBL_FAILURE;
 		goto END;
 	}
-	XFsbl_Printf(DEBUG_GENERAL, "MACRONIX_ENABLE_4BYTE_DONE\r\n");
+	if (Enable == (int)TRUE) {
+		XFsbl_Printf(DEBUG_GENERAL, "MACRONIX_ENABLE_4BYTE_DONE\r\n");
+	}
 
 	UStatus = XFSBL_SUCCESS;
 
@@ -1189,9 +3072,9 @@ static u32 MacronixEnableQPIMode(XQspiPsu *QspiPsuPtr, int Enable)
 	}
 
 	if (Enable == ENABLE_QPI)
-		TxBfrPtr = 0x35;
+		TxBfrPtr = ENTER_QPI_CMD;
 	else
-		TxBfrPtr = 0xF5;
+		TxBfrPtr = EXIT_QPI_CMD;
 	FlashMsg[0].TxBfrPtr = &TxBfrPtr;
 	FlashMsg[0].RxBfrPtr = NULL;
 	FlashMsg[0].ByteCount = 1;
@@ -1235,302 +3118,136 @@ END:
  *****************************************************************************/
 u32 XFsbl_Qspi32Copy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
 {
-	s32 Status;
-	u32 QspiAddr;
-	u32 RemainingBytes;
-	u32 TransferBytes;
-	u32 DiscardByteCnt;
-	u32 UStatus;
-	u32 BankSize;
-	u32 BankMask;
-	u32 OrigAddr;
-	u8 TempBuf[XFSBL_SIXTY_FOUR_BYTE_VAL] __attribute__((aligned(64)));
-	u32 UnalignedBytes = (u32)(DestAddress & XFSBL_SIXTY_FOUR_BYTE_MASK);
-	PTRSIZE DestAddr;
-
-	/*
-	XFsbl_Printf(DEBUG_INFO,"QSPI Reading Src 0x%0lx, Dest %0lx, Length %0lx\r\n",
-			SrcAddress, DestAddress, Length);
-*/
-	/**
-	 * Check the read length with Qspi flash size
-	 */
-	if ((SrcAddress + Length) > QspiFlashSize) {
-		UStatus = XFSBL_ERROR_QSPI_LENGTH;
-		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_QSPI_LENGTH\r\n");
-		goto END;
-	}
-
-	if (MultiDie == (u8)TRUE) {
-		BankSize = BANKSIZE_64MB;
-		BankMask = BANKMASK_64MB;
-	} else {
-		BankSize = BANKSIZE;
-		BankMask = BANKMASK;
-	}
-
-	if (QspiPsuInstance.Config.ConnectionMode ==
-	    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
-		BankSize *= 2U;
-		BankMask *= 2U;
-	}
-	/**
-	 * Update no of bytes to be copied
-	 */
-	RemainingBytes = Length;
-	while (RemainingBytes > 0U) {
-		if (RemainingBytes > DMA_DATA_TRAN_SIZE) {
-			TransferBytes = DMA_DATA_TRAN_SIZE;
-		} else {
-			TransferBytes = RemainingBytes;
-		}
-
-		/* Check for 64 byte alignment of DMA destination */
-		if (UnalignedBytes != 0U) {
-			UnalignedBytes =
-				(u32)XFSBL_SIXTY_FOUR_BYTE_VAL - UnalignedBytes;
-			if (UnalignedBytes > TransferBytes) {
-				UnalignedBytes = TransferBytes;
-			} else {
-				TransferBytes = UnalignedBytes;
-			}
-			DestAddr = (PTRSIZE)TempBuf;
-		} else {
-			DestAddr = DestAddress;
-		}
-
-		/**
-		 * Translate address based on type of connection
-		 * If stacked assert the slave select based on address
-		 */
-		QspiAddr = XFsbl_GetQspiAddr((u32)SrcAddress);
-		if (MultiDie == (u8)TRUE) {
-			/**
-			 * Multiply address by 2 in case of Dual Parallel
-			 * This address is used to calculate the bank crossing
-			 * condition
-			 */
-			if (QspiPsuInstance.Config.ConnectionMode ==
-			    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
-				OrigAddr = QspiAddr * 2U;
-			} else {
-				OrigAddr = QspiAddr;
-			}
-			/**
-			 * If data to be read spans beyond the current die, then
-			 * calculate Transfer Bytes in current die. Else
-			 * transfer bytes are same
-			 */
-			if ((OrigAddr & BankMask) !=
-			    ((OrigAddr + TransferBytes) & BankMask)) {
-				TransferBytes = (OrigAddr & BankMask) +
-						BankSize - OrigAddr;
-			}
-		}
-		/*
-		XFsbl_Printf(DEBUG_INFO, ".");
-		XFsbl_Printf(DEBUG_DETAILED,
-			     "QSPI Read Src 0x%0lx, Dest %0lx, Length %0lx\r\n",
-			     QspiAddr, DestAddr, TransferBytes);
-*/
-		/**
-		 * Setup the read command with the specified address and data for the
-		 * Flash
-		 */
-		if ((MacronixFlash == 1U) && (QspiPsuInstance.Config.BusWidth ==
-					      XFSBL_QSPI_BUSWIDTH_FOUR)) {
-			/* Enable QPI mode */
-			Status = MacronixEnableQPIMode(&QspiPsuInstance,
-						       ENABLE_QPI);
-			if (Status != XFSBL_SUCCESS) {
-				UStatus = XFSBL_ERROR_QSPI_READ;
-				XFsbl_Printf(DEBUG_GENERAL,
-					     "XFSBL_ERROR_QSPI_READ\r\n");
-				goto END;
-			}
-
-			/*Command*/
-			WriteBuffer[COMMAND_OFFSET] = (u8)ReadCommand;
-			DiscardByteCnt = 1;
-			/*MACRONIX is in QPI MODE 4-4-4*/
-			FlashMsg[0].TxBfrPtr = WriteBuffer;
-			FlashMsg[0].RxBfrPtr = NULL;
-			FlashMsg[0].ByteCount = DiscardByteCnt;
-			FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
-			FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
-			/*Address*/
-			WriteBuffer[ADDRESS_1_OFFSET] =
-				(u8)((QspiAddr & 0xFF000000U) >> 24);
-			WriteBuffer[ADDRESS_2_OFFSET] =
-				(u8)((QspiAddr & 0xFF0000U) >> 16);
-			WriteBuffer[ADDRESS_3_OFFSET] =
-				(u8)((QspiAddr & 0xFF00U) >> 8);
-			WriteBuffer[ADDRESS_4_OFFSET] = (u8)(QspiAddr & 0xFFU);
-			DiscardByteCnt = 4;
-
-			FlashMsg[1].TxBfrPtr = &WriteBuffer[ADDRESS_1_OFFSET];
-			FlashMsg[1].RxBfrPtr = NULL;
-			FlashMsg[1].ByteCount = DiscardByteCnt;
-			FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
-			FlashMsg[1].Flags = XQSPIPSU_MSG_FLAG_TX;
-
-			/*Dummy*/
-			/*Default Dummy is 6 when QPI READ MODE(ECH)*/
-			FlashMsg[2].TxBfrPtr = NULL;
-			FlashMsg[2].RxBfrPtr = NULL;
-			FlashMsg[2].ByteCount = DUMMY_CLOCKS_MACRONIX;
-			FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
-			FlashMsg[2].Flags = 0U;
-
-			/*Data*/
-			FlashMsg[3].TxBfrPtr = NULL;
-			FlashMsg[3].RxBfrPtr = (u8 *)DestAddr;
-			FlashMsg[3].ByteCount = TransferBytes;
-			FlashMsg[3].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
-			FlashMsg[3].Flags = XQSPIPSU_MSG_FLAG_RX;
-			if (QspiPsuInstance.Config.ConnectionMode ==
-			    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
-				FlashMsg[3].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
-			}
-
-			Status = XQspiPsu_PolledTransfer(&QspiPsuInstance,
-							 &FlashMsg[0], 4);
-			if (Status != XFSBL_SUCCESS) {
-				UStatus = XFSBL_ERROR_QSPI_READ;
-				XFsbl_Printf(DEBUG_GENERAL,
-					     "XFSBL_ERROR_QSPI_READ\r\n");
-				goto END;
-			}
-
-			/* Disable QPI mode */
-			Status = MacronixEnableQPIMode(&QspiPsuInstance,
-						       DISABLE_QPI);
-			if (Status != XFSBL_SUCCESS) {
-				UStatus = XFSBL_ERROR_QSPI_READ;
-				XFsbl_Printf(DEBUG_GENERAL,
-					     "XFSBL_ERROR_QSPI_READ\r\n");
-				goto END;
-			}
-
-		} else {
-			WriteBuffer[COMMAND_OFFSET] = (u8)ReadCommand;
-			WriteBuffer[ADDRESS_1_OFFSET] =
-				(u8)((QspiAddr & 0xFF000000U) >> 24);
-			WriteBuffer[ADDRESS_2_OFFSET] =
-				(u8)((QspiAddr & 0xFF0000U) >> 16);
-			WriteBuffer[ADDRESS_3_OFFSET] =
-				(u8)((QspiAddr & 0xFF00U) >> 8);
-			WriteBuffer[ADDRESS_4_OFFSET] = (u8)(QspiAddr & 0xFFU);
-			DiscardByteCnt = 5;
-
-			FlashMsg[0].TxBfrPtr = WriteBuffer;
-			FlashMsg[0].RxBfrPtr = NULL;
-			FlashMsg[0].ByteCount = DiscardByteCnt;
-			FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-			FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
-
-			/*
-			 * It is recommended to have a separate entry for dummy
-			 */
-			if ((ReadCommand == FAST_READ_CMD_32BIT) ||
-			    (ReadCommand == DUAL_READ_CMD_32BIT) ||
-			    (ReadCommand == QUAD_READ_CMD_32BIT)) {
-				/* Update Dummy cycles as per flash specs for QUAD IO */
-
-				/*
-				 * It is recommended that Bus width value during dummy
-				 * phase should be same as data phase
-				 */
-				if (ReadCommand == FAST_READ_CMD_32BIT) {
-					FlashMsg[1].BusWidth =
-						XQSPIPSU_SELECT_MODE_SPI;
-				}
-
-				if (ReadCommand == DUAL_READ_CMD_32BIT) {
-					FlashMsg[1].BusWidth =
-						XQSPIPSU_SELECT_MODE_DUALSPI;
-				}
+	return QspiCopy(SrcAddress, DestAddress, Length);
+}
 
-				if (ReadCommand == QUAD_READ_CMD_32BIT) {
-					FlashMsg[1].BusWidth =
-						XQSPIPSU_SELECT_MODE_QUADSPI;
-				}
+/*****************************************************************************/
+/**
+ * This function is used to release the Qspi settings. The flash is left
+ * in the mode the BootROM reads it in.
+ *
+ * @param	None
+ *
+ * @return	XFSBL_SUCCESS or error code
+ *
+ *****************************************************************************/
+u32 XFsbl_Qspi32Release(void)
+{
+	u32 Status;
 
-				FlashMsg[1].TxBfrPtr = NULL;
-				FlashMsg[1].RxBfrPtr = NULL;
-				FlashMsg[1].ByteCount = DUMMY_CLOCKS;
-				FlashMsg[1].Flags = 0U;
-			}
+	Status = QspiSessionRestore();
 
-			if (ReadCommand == FAST_READ_CMD_32BIT) {
-				FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-			}
+#ifdef XFSBL_QSPI_STREAM
+	XFsbl_QspiPrintStreamStats();
+#endif
 
-			if (ReadCommand == DUAL_READ_CMD_32BIT) {
-				FlashMsg[2].BusWidth =
-					XQSPIPSU_SELECT_MODE_DUALSPI;
-			}
+	return Status;
+}
 
-			if (ReadCommand == QUAD_READ_CMD_32BIT) {
-				FlashMsg[2].BusWidth =
-					XQSPIPSU_SELECT_MODE_QUADSPI;
-			}
+#ifdef XFSBL_QSPI_STREAM
+/*****************************************************************************/
+/**
+ * This function sets the chunk size used by the streaming read path. The
+ * size is rounded down to a multiple of 64 bytes so that every chunk
+ * starts on a DMA aligned address.
+ *
+ * @param	ChunkSize is the requested chunk size in bytes. Sizes below
+ *		64 bytes restore XFSBL_QSPI_STREAM_CHUNK_SIZE.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_QspiSetStreamChunkSize(u32 ChunkSize)
+{
+	if (ChunkSize > XQSPIPSU_DMA_BYTES_MAX) {
+		ChunkSize = XQSPIPSU_DMA_BYTES_MAX;
+	}
+	ChunkSize &= ~XFSBL_SIXTY_FOUR_BYTE_MASK;
+	if (ChunkSize == 0U) {
+		ChunkSize = XFSBL_QSPI_STREAM_CHUNK_SIZE;
+	}
 
-			FlashMsg[2].TxBfrPtr = NULL;
-			FlashMsg[2].RxBfrPtr = (u8 *)DestAddr;
-			FlashMsg[2].ByteCount = TransferBytes;
-			FlashMsg[2].Flags = XQSPIPSU_MSG_FLAG_RX;
+	QspiStreamChunkSize = ChunkSize;
+}
 
-			if (QspiPsuInstance.Config.ConnectionMode ==
-			    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
-				FlashMsg[2].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
-			}
+/*****************************************************************************/
+/**
+ * This function registers the hook that post-processes data read from
+ * flash. Streamed chunks are handed over while the DMA of the next chunk
+ * is in flight, so the hook must only touch the chunk it is given.
+ *
+ * @param	Hook is the function to be called, NULL removes the hook.
+ * @param	Context is passed to the hook unchanged.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_QspiSetStreamHook(XFsbl_QspiStreamHook Hook, void *Context)
+{
+	QspiStreamHook = Hook;
+	QspiStreamHookContext = Context;
+}
 
-			/**
-			 * Send the read command to the Flash to read the specified number
-			 * of bytes from the Flash, send the read command and address and
-			 * receive the specified number of bytes of data in the data buffer
-			 */
-			Status = XQspiPsu_PolledTransfer(&QspiPsuInstance,
-							 &FlashMsg[0], 3);
-			if (Status != XFSBL_SUCCESS) {
-				UStatus = XFSBL_ERROR_QSPI_READ;
-				XFsbl_Printf(DEBUG_GENERAL,
-					     "XFSBL_ERROR_QSPI_READ\r\n");
-				goto END;
-			}
-		}
-		if (UnalignedBytes != 0U) {
-			Xil_MemCpy((void *)DestAddress, TempBuf, TransferBytes);
-			UnalignedBytes = 0U;
-		}
-		/**
-		 * Update the variables
-		 */
-		RemainingBytes -= TransferBytes;
-		DestAddress += TransferBytes;
-		SrcAddress += TransferBytes;
-	}
-	UStatus = XFSBL_SUCCESS;
+/*****************************************************************************/
+/**
+ * This function returns the streaming read counters.
+ *
+ * @param	None
+ *
+ * @return	Pointer to the counters
+ *
+ *****************************************************************************/
+const XFsblPs_QspiStreamStats *XFsbl_QspiGetStreamStats(void)
+{
+	return &QspiStreamStats;
+}
 
-END:
-	return UStatus;
+/*****************************************************************************/
+/**
+ * This function clears the streaming read counters.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_QspiResetStreamStats(void)
+{
+	(void)memset(&QspiStreamStats, 0, sizeof(QspiStreamStats));
 }
 
 /*****************************************************************************/
 /**
- * This function is used to release the Qspi settings
+ * This function prints the streaming read counters. Flash throughput is
+ * derived from the chunk DMA time, the wait time is the part of it the
+ * CPU could not hide behind post-processing.
  *
  * @param	None
  *
  * @return	None
  *
  *****************************************************************************/
-u32 XFsbl_Qspi32Release(void)
+void XFsbl_QspiPrintStreamStats(void)
 {
-	u32 Status = XFSBL_SUCCESS;
+	u32 KBps = 0U;
 
-	return Status;
+	if (QspiStreamStats.DmaTicks != 0U) {
+		KBps = (u32)((QspiStreamStats.Bytes * COUNTS_PER_SECOND) /
+			     (QspiStreamStats.DmaTicks * 1024U));
+	}
+
+	XFsbl_Printf(DEBUG_INFO,
+		     "QSPI stream: %u chunks of 0x%x, %u KB at %u KB/s\r\n",
+		     QspiStreamStats.Chunks, QspiStreamChunkSize,
+		     (u32)(QspiStreamStats.Bytes / 1024U), KBps);
+	XFsbl_Printf(DEBUG_INFO,
+		     "QSPI stream ticks: dma %u wait %u hook %u min %u max %u\r\n",
+		     (u32)QspiStreamStats.DmaTicks,
+		     (u32)QspiStreamStats.WaitTicks,
+		     (u32)QspiStreamStats.HookTicks,
+		     (u32)QspiStreamStats.MinChunkTicks,
+		     (u32)QspiStreamStats.MaxChunkTicks);
 }
+#endif
 
 #endif /* endof XFSBL_QSPI */
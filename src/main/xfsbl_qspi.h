@@ -27,6 +27,15 @@
 * 5.0   bsv  11/15/20 Added Macronix 2G flash support
 * 6.0   bsv  07/29/21 Added Winbond 2G flash support
 *       bsv  09/08/21 Added MultiDie read support for Micron 2G flash part
+* 7.0   dd   10/16/26 Added streaming read hook, chunk size and counters
+*       dd   10/16/26 Added copy request submit, poll and wait APIs
+*       dd   10/16/26 Added SFDP definitions and XFsblPs_QspiReadMode
+*       dd   10/16/26 Added clock calibration definitions
+*       dd   10/16/26 Added QPI and 4 byte address mode commands
+*       dd   10/16/26 Added copy request timeouts
+*       dd   10/16/26 Added XFsbl_QspiCalibFallback
+*       dd   10/16/26 Added the BFPT address bytes values
+*       dd   10/16/26 Keep the Quad Enable Requirements in the SFDP cache
 *
 * </pre>
 *
@@ -45,6 +54,8 @@ extern "C" {
 /***************************** Include Files *********************************/
 #include "xil_types.h"
 #include "xfsbl_hw.h"
+#include "xfsbl_misc_drivers.h"
+#include "xtime_l.h"
 
 #ifdef XFSBL_QSPI
 
@@ -62,6 +73,12 @@ extern "C" {
 #define DUAL_READ_CMD_32BIT		(0x3CU)
 #define QUAD_READ_CMD_32BIT		(0x6CU)
 #define QUAD_READ_CMD_24BIT2	(0xEBU)
+#define DUAL_IO_READ_CMD_32BIT	(0xBCU)
+#define QUAD_IO_READ_CMD_32BIT	(0xECU)
+#define READ_SFDP_CMD		(0x5AU)
+#define READ_STATUS_CMD		(0x05U)
+#define READ_STATUS2_CMD	(0x35U)
+#define READ_STATUS2_ALT_CMD	(0x3FU)
 
 
 #define WRITE_STATUS_CMD	(0x01U)
@@ -191,8 +208,165 @@ extern "C" {
 /* Macronix */
 #define DISABLE_QPI		0x0U
 #define ENABLE_QPI		0x1U
+#define ENTER_QPI_CMD		(0x35U)
+#define EXIT_QPI_CMD		(0xF5U)
+#define ENTER_4B_CMD		(0xB7U)
+#define EXIT_4B_CMD		(0xE9U)
+
+/* Bank of a flash device before the FSBL has selected one */
+#define XFSBL_QSPI_BANK_UNKNOWN	(0xFFU)
+
+/*
+ * Timeouts in us of the DMA of a chunk, and of a copy request of Bytes,
+ * which reads at least 1MB/s
+ */
+#define XFSBL_QSPI_DMA_TIMEOUT		(100000U)
+#define XFSBL_QSPI_COPY_TIMEOUT(Bytes)	(XFSBL_QSPI_DMA_TIMEOUT + (Bytes))
+
+/* Prescaler used until the clock is calibrated */
+#define XFSBL_QSPI_CLK_PRESCALER	XQSPIPSU_CLK_PRESCALE_8
+
+/* Number of address bytes sent with a read command */
+#define XFSBL_QSPI_ADDR_SIZE_24BIT	(3U)
+#define XFSBL_QSPI_ADDR_SIZE_32BIT	(4U)
+
+/*
+ * Mode bits sent after the address of an I/O read. All ones keeps every
+ * supported vendor out of continuous read (XIP) mode.
+ */
+#define XFSBL_QSPI_MODE_BITS_NONE	(0xFFU)
+#define XFSBL_QSPI_MODE_BYTES_MAX	(3U)
+
+#ifdef XFSBL_QSPI_SFDP
+/*
+ * JESD216 Serial Flash Discoverable Parameters
+ */
+#define XFSBL_QSPI_SFDP_SIGNATURE	(0x50444653U) /* "SFDP" */
+#define XFSBL_QSPI_SFDP_DUMMY_CLOCKS	(8U)
+#define XFSBL_QSPI_SFDP_HEADER_SIZE	(8U)
+#define XFSBL_QSPI_SFDP_MAX_PARAM_HEADERS	(8U)
+#define XFSBL_QSPI_SFDP_BUF_WORDS	(32U)
+
+/* Parameter IDs, MSB << 8 | LSB */
+#define XFSBL_QSPI_SFDP_BFPT_ID		(0xFF00U)
+#define XFSBL_QSPI_SFDP_4BAIT_ID	(0xFF84U)
+
+/* Basic Flash Parameter Table, DWORD indices and fields */
+#define XFSBL_QSPI_BFPT_DWORD_MIN	(9U)
+#define XFSBL_QSPI_BFPT_DWORD_QER	(15U)
+#define XFSBL_QSPI_BFPT_FAST_READ_112_MASK	(1U << 16U)
+#define XFSBL_QSPI_BFPT_ADDR_BYTES_SHIFT	(17U)
+#define XFSBL_QSPI_BFPT_ADDR_BYTES_MASK	(0x3U)
+#define XFSBL_QSPI_BFPT_ADDR_BYTES_3_ONLY	(0x0U)
+#define XFSBL_QSPI_BFPT_ADDR_BYTES_3_OR_4	(0x1U)
+#define XFSBL_QSPI_BFPT_ADDR_BYTES_4_ONLY	(0x2U)
+#define XFSBL_QSPI_BFPT_DTR_MASK	(1U << 19U)
+#define XFSBL_QSPI_BFPT_FAST_READ_122_MASK	(1U << 20U)
+#define XFSBL_QSPI_BFPT_FAST_READ_144_MASK	(1U << 21U)
+#define XFSBL_QSPI_BFPT_FAST_READ_114_MASK	(1U << 22U)
+#define XFSBL_QSPI_BFPT_FAST_READ_444_MASK	(1U << 4U)
+#define XFSBL_QSPI_BFPT_QER_SHIFT	(20U)
+#define XFSBL_QSPI_BFPT_QER_MASK	(0x7U)
+
+/* Quad Enable Requirements (QER) */
+#define XFSBL_QSPI_QER_NONE		(0x0U)
+#define XFSBL_QSPI_QER_SR2_BIT1_WRSR	(0x1U)
+#define XFSBL_QSPI_QER_SR1_BIT6		(0x2U)
+#define XFSBL_QSPI_QER_SR2_BIT7		(0x3U)
+#define XFSBL_QSPI_QER_SR2_BIT1_WRSR2	(0x4U)
+#define XFSBL_QSPI_QER_SR2_BIT1		(0x5U)
+#define XFSBL_QSPI_QER_SR2_BIT1_31H	(0x6U)
+
+/* 4-byte Address Instruction Table DWORD1 read support bits */
+#define XFSBL_QSPI_4BAIT_FAST_READ_111_MASK	(1U << 1U)
+#define XFSBL_QSPI_4BAIT_FAST_READ_112_MASK	(1U << 2U)
+#define XFSBL_QSPI_4BAIT_FAST_READ_122_MASK	(1U << 3U)
+#define XFSBL_QSPI_4BAIT_FAST_READ_114_MASK	(1U << 4U)
+#define XFSBL_QSPI_4BAIT_FAST_READ_144_MASK	(1U << 5U)
+
+/* Read modes considered, in increasing data bus width */
+#define XFSBL_QSPI_SFDP_MODE_111	(0U)
+#define XFSBL_QSPI_SFDP_MODE_112	(1U)
+#define XFSBL_QSPI_SFDP_MODE_122	(2U)
+#define XFSBL_QSPI_SFDP_MODE_114	(3U)
+#define XFSBL_QSPI_SFDP_MODE_144	(4U)
+#define XFSBL_QSPI_SFDP_MODE_COUNT	(5U)
+
+/*
+ * Layout of the read mode cached in XFSBL_QSPI_SFDP_CACHE_REGISTER. Bus
+ * widths are kept as log2, the tag is a hash of the flash ID.
+ */
+#define XFSBL_QSPI_SFDP_CACHE_CMD_MASK		(0xFFU)
+#define XFSBL_QSPI_SFDP_CACHE_DUMMY_SHIFT	(8U)
+#define XFSBL_QSPI_SFDP_CACHE_DUMMY_MASK	(0x1FU)
+#define XFSBL_QSPI_SFDP_CACHE_MODE_SHIFT	(13U)
+#define XFSBL_QSPI_SFDP_CACHE_MODE_MASK		(0x3U)
+#define XFSBL_QSPI_SFDP_CACHE_ADDR_BW_SHIFT	(15U)
+#define XFSBL_QSPI_SFDP_CACHE_DATA_BW_SHIFT	(17U)
+#define XFSBL_QSPI_SFDP_CACHE_BW_MASK		(0x3U)
+#define XFSBL_QSPI_SFDP_CACHE_ADDR32_MASK	(1U << 19U)
+#define XFSBL_QSPI_SFDP_CACHE_QER_SHIFT		(20U)
+#define XFSBL_QSPI_SFDP_CACHE_VALID_MASK	(1U << 23U)
+#define XFSBL_QSPI_SFDP_CACHE_VALID		(1U << 23U)
+#define XFSBL_QSPI_SFDP_CACHE_TAG_SHIFT		(24U)
+#endif
+
+#ifdef XFSBL_QSPI_CALIB
+/*
+ * Clock calibration. Tap 0 reads without the data delay, taps 1 to 8 use
+ * data delays 0 to 7. XFSBL_QSPI_CALIB_TAP_DEFAULT keeps the delays set
+ * by XQspiPsu_SetClkPrescaler.
+ */
+#define XFSBL_QSPI_CALIB_TAPS		(9U)
+#define XFSBL_QSPI_CALIB_TAP_DEFAULT	(0xFU)
+#define XFSBL_QSPI_CALIB_MIN_WINDOW	(3U)
+#define XFSBL_QSPI_CALIB_READS		(2U)
+
+/*
+ * Layout of the setting cached in XFSBL_QSPI_CALIB_CACHE_REGISTER, tagged
+ * with the upper bits of the calibration region CRC
+ */
+#define XFSBL_QSPI_CALIB_CACHE_PRESCALER_MASK	(0x7U)
+#define XFSBL_QSPI_CALIB_CACHE_TAP_SHIFT	(4U)
+#define XFSBL_QSPI_CALIB_CACHE_TAP_MASK		(0xFU)
+#define XFSBL_QSPI_CALIB_CACHE_VALID_MASK	(0xF00U)
+#define XFSBL_QSPI_CALIB_CACHE_VALID		(0xA00U)
+#define XFSBL_QSPI_CALIB_CACHE_CRC_MASK		(0xFFFFF000U)
+#endif
 
 /**************************** Type Definitions *******************************/
+/*
+ * Read command and the bus widths, mode bytes and dummy clocks that go with it
+ */
+typedef struct {
+	u8 Command;		/**< Read opcode */
+	u8 AddrBusWidth;	/**< XQSPIPSU_SELECT_MODE_* of address phase */
+	u8 DataBusWidth;	/**< XQSPIPSU_SELECT_MODE_* of dummy and data */
+	u8 ModeBytes;		/**< Mode bytes sent after the address */
+	u8 DummyClocks;		/**< Dummy clocks before the data */
+} XFsblPs_QspiReadMode;
+
+#ifdef XFSBL_QSPI_STREAM
+/*
+ * Post-processing hook called for every chunk read from flash.
+ * Returns XFSBL_SUCCESS to continue the copy, anything else aborts it.
+ */
+typedef u32 (*XFsbl_QspiStreamHook)(PTRSIZE ChunkAddress, u32 ChunkLength,
+				    void *Context);
+
+/*
+ * Streaming read counters, timer ticks are in COUNTS_PER_SECOND units
+ */
+typedef struct {
+	u32 Chunks;		/**< Number of chunks read by DMA */
+	u64 Bytes;		/**< Number of bytes read by DMA */
+	XTime DmaTicks;		/**< Time from chunk DMA start to DMA done */
+	XTime WaitTicks;	/**< Time the CPU spent waiting for DMA done */
+	XTime HookTicks;	/**< Time spent in the post-processing hook */
+	XTime MinChunkTicks;	/**< Fastest chunk DMA */
+	XTime MaxChunkTicks;	/**< Slowest chunk DMA */
+} XFsblPs_QspiStreamStats;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -204,6 +378,20 @@ u32 XFsbl_Qspi24Release(void );
 u32 XFsbl_Qspi32Init(u32 DeviceFlags);
 u32 XFsbl_Qspi32Copy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length);
 u32 XFsbl_Qspi32Release(void );
+u32 XFsbl_QspiCopySubmit(XFsblPs_DeviceRequest *Request, u32 SrcAddress,
+			 PTRSIZE DestAddress, u32 Length);
+u32 XFsbl_QspiCopyPoll(XFsblPs_DeviceRequest *Request);
+u32 XFsbl_QspiCopyWait(XFsblPs_DeviceRequest *Request);
+#ifdef XFSBL_QSPI_CALIB
+u32 XFsbl_QspiCalibFallback(void);
+#endif
+#ifdef XFSBL_QSPI_STREAM
+void XFsbl_QspiSetStreamChunkSize(u32 ChunkSize);
+void XFsbl_QspiSetStreamHook(XFsbl_QspiStreamHook Hook, void *Context);
+const XFsblPs_QspiStreamStats *XFsbl_QspiGetStreamStats(void);
+void XFsbl_QspiResetStreamStats(void);
+void XFsbl_QspiPrintStreamStats(void);
+#endif
 
 /************************** Variable Definitions *****************************/
 
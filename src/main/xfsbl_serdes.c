@@ -0,0 +1,198 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_serdes.c
+ *
+ * This is the file which contains the SERDES ILL calibration cache.
+ *
+ * Every pass of the ILL calibration of psu_init() searches the ILL code of
+ * its lanes with 64 BIST runs, about 90 ms. The codes found are kept in
+ * XFSBL_SERDES_CACHE_REGISTER, which only a power-on reset clears, tagged
+ * with a CRC of the lane protocols and rates, the silicon and the reference
+ * clocks of the lanes. A warm boot with the same tag applies them directly,
+ * any other boot searches them again and replaces the record.
+ *
+ * The register holds XFSBL_SERDES_CACHE_CODES codes, the calibration is not
+ * cached when its passes find more. The codes of serdes_fixcal_code() are
+ * not cached, they are a few calibrations of the impedance codes, which
+ * follow the temperature.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *       dd   10/16/26 Tag the codes with XFsbl_Crc32C
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xfsbl_hw.h"
+
+#ifdef XFSBL_SERDES_CACHE
+#  include "psu_init.h"
+#  include "xfsbl_checksum.h"
+#  include "xfsbl_misc.h"
+
+/************************** Constant Definitions *****************************/
+/*
+ * Layout of the record in XFSBL_SERDES_CACHE_REGISTER: the 6 bit codes from
+ * bit 0 in the order of the passes and of their lanes, tagged with the upper
+ * bits of the CRC
+ */
+#  define XFSBL_SERDES_CACHE_CODES (3U)
+#  define XFSBL_SERDES_CACHE_CODE_BITS (6U)
+#  define XFSBL_SERDES_CACHE_CODE_MASK (0x3FU)
+#  define XFSBL_SERDES_CACHE_VALID_MASK (0x3C0000U)
+#  define XFSBL_SERDES_CACHE_VALID (0x280000U)
+#  define XFSBL_SERDES_CACHE_CRC_MASK (0xFFC00000U)
+
+#  define XFSBL_SERDES_LANES (4U)
+
+/* Reference clock selection of lane 0, the other lanes follow */
+#  define XFSBL_SERDES_PLL_REF_SEL0 (0xFD410000U)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+/* The record of this boot is restored, next code to restore or save */
+static u32 SerdesCacheHit;
+static u32 SerdesCacheCode;
+static u32 SerdesCacheRecord;
+
+/*****************************************************************************/
+/**
+ * This function returns the tag of the codes of a lane configuration.
+ *
+ * @param	Config is the lane protocols and rates of psu_init()
+ *
+ * @return	The tag, in XFSBL_SERDES_CACHE_CRC_MASK
+ *
+ *****************************************************************************/
+static u32 XFsbl_SerdesCacheTag(u32 Config) {
+  u32 Words[3U + XFSBL_SERDES_LANES];
+  u32 Lane;
+
+  Words[0U] = Config;
+  Words[1U] = XFsbl_In32(CSU_IDCODE);
+  Words[2U] = XFsbl_In32(CSU_VERSION);
+  for (Lane = 0U; Lane < XFSBL_SERDES_LANES; Lane++) {
+    Words[3U + Lane] = XFsbl_In32(XFSBL_SERDES_PLL_REF_SEL0 + (Lane * 4U));
+  }
+
+  return XFsbl_Crc32C(0U, (const u8*)Words, sizeof(Words)) &
+         XFSBL_SERDES_CACHE_CRC_MASK;
+}
+
+/*****************************************************************************/
+/**
+ * This function restores the ILL codes of a calibration pass of psu_init()
+ * from the record of the previous boot. The record is checked on the first
+ * pass, the codes of all the passes are restored or none.
+ *
+ * @param	config is the lane protocols and rates of psu_init()
+ *
+ * @param	pass is the calibration pass, from 0
+ *
+ * @param	lanes is the mask of the lanes of the pass
+ *
+ * @param	meancount is set to the codes of the lanes on a hit
+ *
+ * @return	1 when the codes are restored, 0 otherwise
+ *
+ *****************************************************************************/
+int psu_serdes_ill_restore(unsigned int config, unsigned int pass,
+                           unsigned int lanes, unsigned int* meancount) {
+  const u32 Record = XFsbl_In32(XFSBL_SERDES_CACHE_REGISTER);
+  u32 Codes = 0U;
+  u32 Lane;
+
+  if (pass == 0U) {
+    SerdesCacheCode = 0U;
+    SerdesCacheHit = ((Record & XFSBL_SERDES_CACHE_VALID_MASK) ==
+                      XFSBL_SERDES_CACHE_VALID) &&
+                     ((Record & XFSBL_SERDES_CACHE_CRC_MASK) ==
+                      XFsbl_SerdesCacheTag(config));
+    if (SerdesCacheHit != 0U) {
+      XFsbl_Printf(DEBUG_INFO, "SERDES ILL codes 0x%x restored\r\n", Record);
+    }
+  }
+  if (SerdesCacheHit == 0U) {
+    return 0;
+  }
+
+  for (Lane = 0U; Lane < XFSBL_SERDES_LANES; Lane++) {
+    Codes += (lanes >> Lane) & 1U;
+  }
+  if ((SerdesCacheCode + Codes) > XFSBL_SERDES_CACHE_CODES) {
+    SerdesCacheHit = 0U;
+    return 0;
+  }
+
+  for (Lane = 0U; Lane < XFSBL_SERDES_LANES; Lane++) {
+    if ((lanes & (1U << Lane)) != 0U) {
+      meancount[Lane] =
+          (Record >> (SerdesCacheCode * XFSBL_SERDES_CACHE_CODE_BITS)) &
+          XFSBL_SERDES_CACHE_CODE_MASK;
+      SerdesCacheCode++;
+    }
+  }
+
+  return 1;
+}
+
+/*****************************************************************************/
+/**
+ * This function saves the ILL codes found by a calibration pass of
+ * psu_init() for the next boots. The record is started by the first pass
+ * and invalidated if the codes of the passes do not fit in it.
+ *
+ * @param	config is the lane protocols and rates of psu_init()
+ *
+ * @param	pass is the calibration pass, from 0
+ *
+ * @param	lanes is the mask of the lanes of the pass
+ *
+ * @param	meancount is the codes of the lanes
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void psu_serdes_ill_save(unsigned int config, unsigned int pass,
+                         unsigned int lanes, const unsigned int* meancount) {
+  u32 Lane;
+
+  if (pass == 0U) {
+    SerdesCacheCode = 0U;
+    SerdesCacheRecord = XFsbl_SerdesCacheTag(config) | XFSBL_SERDES_CACHE_VALID;
+  }
+
+  for (Lane = 0U; Lane < XFSBL_SERDES_LANES; Lane++) {
+    if ((lanes & (1U << Lane)) == 0U) {
+      continue;
+    }
+    if (SerdesCacheCode == XFSBL_SERDES_CACHE_CODES) {
+      SerdesCacheRecord = 0U;
+      break;
+    }
+    SerdesCacheRecord |= (meancount[Lane] & XFSBL_SERDES_CACHE_CODE_MASK)
+                         << (SerdesCacheCode * XFSBL_SERDES_CACHE_CODE_BITS);
+    SerdesCacheCode++;
+  }
+
+  XFsbl_Out32(XFSBL_SERDES_CACHE_REGISTER, SerdesCacheRecord);
+}
+#endif /* XFSBL_SERDES_CACHE */
@@ -0,0 +1,334 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_sha3.c
+ *
+ * This is the file which contains the incremental SHA3-384 of the FSBL.
+ *
+ * The software Keccak-f[1600] keeps the 25 lanes in local variables and
+ * computes two rounds per loop iteration, from A to E and back, with theta,
+ * rho, pi, chi and iota merged. The A53 keeps most lanes in its 31 general
+ * purpose registers, the chi step is one BIC and one EOR per lane and the
+ * rotations are single ROR instructions.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xfsbl_sha3.h"
+
+#include "xfsbl_error.h"
+
+/************************** Constant Definitions *****************************/
+#define XFSBL_KECCAK_ROUNDS (24U)
+#define XFSBL_KECCAK_LANES (25U)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define XFSBL_ROL64(Lane, Offset) \
+  (((Lane) << (Offset)) | ((Lane) >> (64U - (Offset))))
+
+/*
+ * One round from the lanes A to the lanes E. The five rows of the output are
+ * computed one after the other, each from the five input lanes pi moves to
+ * it, so only five B temporaries are live.
+ */
+#define XFSBL_KECCAK_ROUND(A, E, Rc)                                          \
+  do {                                                                        \
+    u64 Ca = A##ba ^ A##ga ^ A##ka ^ A##ma ^ A##sa;                           \
+    u64 Ce = A##be ^ A##ge ^ A##ke ^ A##me ^ A##se;                           \
+    u64 Ci = A##bi ^ A##gi ^ A##ki ^ A##mi ^ A##si;                           \
+    u64 Co = A##bo ^ A##go ^ A##ko ^ A##mo ^ A##so;                           \
+    u64 Cu = A##bu ^ A##gu ^ A##ku ^ A##mu ^ A##su;                           \
+    const u64 Da = Cu ^ XFSBL_ROL64(Ce, 1U);                                  \
+    const u64 De = Ca ^ XFSBL_ROL64(Ci, 1U);                                  \
+    const u64 Di = Ce ^ XFSBL_ROL64(Co, 1U);                                  \
+    const u64 Do = Ci ^ XFSBL_ROL64(Cu, 1U);                                  \
+    const u64 Du = Co ^ XFSBL_ROL64(Ca, 1U);                                  \
+                                                                              \
+    Ca = A##ba ^ Da;                                                          \
+    Ce = XFSBL_ROL64(A##ge ^ De, 44U);                                        \
+    Ci = XFSBL_ROL64(A##ki ^ Di, 43U);                                        \
+    Co = XFSBL_ROL64(A##mo ^ Do, 21U);                                        \
+    Cu = XFSBL_ROL64(A##su ^ Du, 14U);                                        \
+    E##ba = Ca ^ (~Ce & Ci) ^ (Rc);                                           \
+    E##be = Ce ^ (~Ci & Co);                                                  \
+    E##bi = Ci ^ (~Co & Cu);                                                  \
+    E##bo = Co ^ (~Cu & Ca);                                                  \
+    E##bu = Cu ^ (~Ca & Ce);                                                  \
+                                                                              \
+    Ca = XFSBL_ROL64(A##bo ^ Do, 28U);                                        \
+    Ce = XFSBL_ROL64(A##gu ^ Du, 20U);                                        \
+    Ci = XFSBL_ROL64(A##ka ^ Da, 3U);                                         \
+    Co = XFSBL_ROL64(A##me ^ De, 45U);                                        \
+    Cu = XFSBL_ROL64(A##si ^ Di, 61U);                                        \
+    E##ga = Ca ^ (~Ce & Ci);                                                  \
+    E##ge = Ce ^ (~Ci & Co);                                                  \
+    E##gi = Ci ^ (~Co & Cu);                                                  \
+    E##go = Co ^ (~Cu & Ca);                                                  \
+    E##gu = Cu ^ (~Ca & Ce);                                                  \
+                                                                              \
+    Ca = XFSBL_ROL64(A##be ^ De, 1U);                                         \
+    Ce = XFSBL_ROL64(A##gi ^ Di, 6U);                                         \
+    Ci = XFSBL_ROL64(A##ko ^ Do, 25U);                                        \
+    Co = XFSBL_ROL64(A##mu ^ Du, 8U);                                         \
+    Cu = XFSBL_ROL64(A##sa ^ Da, 18U);                                        \
+    E##ka = Ca ^ (~Ce & Ci);                                                  \
+    E##ke = Ce ^ (~Ci & Co);                                                  \
+    E##ki = Ci ^ (~Co & Cu);                                                  \
+    E##ko = Co ^ (~Cu & Ca);                                                  \
+    E##ku = Cu ^ (~Ca & Ce);                                                  \
+                                                                              \
+    Ca = XFSBL_ROL64(A##bu ^ Du, 27U);                                        \
+    Ce = XFSBL_ROL64(A##ga ^ Da, 36U);                                        \
+    Ci = XFSBL_ROL64(A##ke ^ De, 10U);                                        \
+    Co = XFSBL_ROL64(A##mi ^ Di, 15U);                                        \
+    Cu = XFSBL_ROL64(A##so ^ Do, 56U);                                        \
+    E##ma = Ca ^ (~Ce & Ci);                                                  \
+    E##me = Ce ^ (~Ci & Co);                                                  \
+    E##mi = Ci ^ (~Co & Cu);                                                  \
+    E##mo = Co ^ (~Cu & Ca);                                                  \
+    E##mu = Cu ^ (~Ca & Ce);                                                  \
+                                                                              \
+    Ca = XFSBL_ROL64(A##bi ^ Di, 62U);                                        \
+    Ce = XFSBL_ROL64(A##go ^ Do, 55U);                                        \
+    Ci = XFSBL_ROL64(A##ku ^ Du, 39U);                                        \
+    Co = XFSBL_ROL64(A##ma ^ Da, 41U);                                        \
+    Cu = XFSBL_ROL64(A##se ^ De, 2U);                                         \
+    E##sa = Ca ^ (~Ce & Ci);                                                  \
+    E##se = Ce ^ (~Ci & Co);                                                  \
+    E##si = Ci ^ (~Co & Cu);                                                  \
+    E##so = Co ^ (~Cu & Ca);                                                  \
+    E##su = Cu ^ (~Ca & Ce);                                                  \
+  } while (0)
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+static const u64 XFsbl_KeccakRc[XFSBL_KECCAK_ROUNDS] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL,
+    0x8000000080008000ULL, 0x000000000000808BULL, 0x0000000080000001ULL,
+    0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008AULL,
+    0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+    0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL,
+    0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+    0x000000000000800AULL, 0x800000008000000AULL, 0x8000000080008081ULL,
+    0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL};
+
+static const XFsblPs_Sha3Engine* Sha3Engine = NULL;
+
+/*****************************************************************************/
+/**
+ * This function applies the Keccak-f[1600] permutation to a state
+ *
+ * @param	State is the state, lane x + 5y at index x + 5y
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_KeccakF1600(u64* State) {
+  u64 Aba = State[0], Abe = State[1], Abi = State[2], Abo = State[3];
+  u64 Abu = State[4], Aga = State[5], Age = State[6], Agi = State[7];
+  u64 Ago = State[8], Agu = State[9], Aka = State[10], Ake = State[11];
+  u64 Aki = State[12], Ako = State[13], Aku = State[14], Ama = State[15];
+  u64 Ame = State[16], Ami = State[17], Amo = State[18], Amu = State[19];
+  u64 Asa = State[20], Ase = State[21], Asi = State[22], Aso = State[23];
+  u64 Asu = State[24];
+  u64 Eba, Ebe, Ebi, Ebo, Ebu, Ega, Ege, Egi, Ego, Egu, Eka, Eke, Eki;
+  u64 Eko, Eku, Ema, Eme, Emi, Emo, Emu, Esa, Ese, Esi, Eso, Esu;
+
+  for (u32 Round = 0U; Round < XFSBL_KECCAK_ROUNDS; Round += 2U) {
+    XFSBL_KECCAK_ROUND(A, E, XFsbl_KeccakRc[Round]);
+    XFSBL_KECCAK_ROUND(E, A, XFsbl_KeccakRc[Round + 1U]);
+  }
+
+  State[0] = Aba, State[1] = Abe, State[2] = Abi, State[3] = Abo;
+  State[4] = Abu, State[5] = Aga, State[6] = Age, State[7] = Agi;
+  State[8] = Ago, State[9] = Agu, State[10] = Aka, State[11] = Ake;
+  State[12] = Aki, State[13] = Ako, State[14] = Aku, State[15] = Ama;
+  State[16] = Ame, State[17] = Ami, State[18] = Amo, State[19] = Amu;
+  State[20] = Asa, State[21] = Ase, State[22] = Asi, State[23] = Aso;
+  State[24] = Asu;
+}
+
+/*****************************************************************************/
+/**
+ * This function absorbs one block of XFSBL_SHA3_RATE bytes
+ *
+ * @param	State is the Keccak state
+ * @param	Block is the block, of any alignment
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_Sha3Absorb(u64* State, const u8* Block) {
+  for (u32 Lane = 0U; Lane < (XFSBL_SHA3_RATE / 8U); Lane++) {
+    u64 Data;
+
+    /* The lanes are little endian, like the A53 */
+    __builtin_memcpy(&Data, &Block[Lane * 8U], sizeof(Data));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    Data = __builtin_bswap64(Data);
+#endif
+    State[Lane] ^= Data;
+  }
+
+  XFsbl_KeccakF1600(State);
+}
+
+/*****************************************************************************/
+/**
+ * This function installs the engine used by the digests started after it
+ *
+ * @param	Engine is the engine, NULL for the software Keccak
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_Sha3SetEngine(const XFsblPs_Sha3Engine* Engine) {
+  Sha3Engine = Engine;
+}
+
+/*****************************************************************************/
+/**
+ * This function starts a SHA3-384 digest
+ *
+ * @param	Sha3 is the digest
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns the engine error on failure
+ *
+ *****************************************************************************/
+u32 XFsbl_Sha3Start(XFsblPs_Sha3* Sha3) {
+  Sha3->Engine = Sha3Engine;
+  if (Sha3->Engine != NULL) {
+    return Sha3->Engine->Start();
+  }
+
+  for (u32 Lane = 0U; Lane < XFSBL_KECCAK_LANES; Lane++) {
+    Sha3->State[Lane] = 0U;
+  }
+  Sha3->BlockBytes = 0U;
+
+  return XFSBL_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function adds data to a SHA3-384 digest
+ *
+ * @param	Sha3 is the digest
+ * @param	Data is the data
+ * @param	Length is the number of bytes of data
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns the engine error on failure
+ *
+ *****************************************************************************/
+u32 XFsbl_Sha3Update(XFsblPs_Sha3* Sha3, const u8* Data, u32 Length) {
+  if (Sha3->Engine != NULL) {
+    return Sha3->Engine->Update(Data, Length);
+  }
+
+  if (Sha3->BlockBytes != 0U) {
+    while ((Length != 0U) && (Sha3->BlockBytes < XFSBL_SHA3_RATE)) {
+      Sha3->Block[Sha3->BlockBytes] = *Data;
+      Sha3->BlockBytes++;
+      Data++;
+      Length--;
+    }
+    if (Sha3->BlockBytes < XFSBL_SHA3_RATE) {
+      return XFSBL_SUCCESS;
+    }
+    XFsbl_Sha3Absorb(Sha3->State, Sha3->Block);
+    Sha3->BlockBytes = 0U;
+  }
+
+  while (Length >= XFSBL_SHA3_RATE) {
+    XFsbl_Sha3Absorb(Sha3->State, Data);
+    Data += XFSBL_SHA3_RATE;
+    Length -= XFSBL_SHA3_RATE;
+  }
+
+  while (Length != 0U) {
+    Sha3->Block[Sha3->BlockBytes] = *Data;
+    Sha3->BlockBytes++;
+    Data++;
+    Length--;
+  }
+
+  return XFSBL_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function pads the last block and returns the SHA3-384 digest
+ *
+ * @param	Sha3 is the digest
+ * @param	Hash is filled with the XFSBL_SHA3_LEN bytes of the digest
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns the engine error on failure
+ *
+ *****************************************************************************/
+u32 XFsbl_Sha3Finish(XFsblPs_Sha3* Sha3, u8* Hash) {
+  if (Sha3->Engine != NULL) {
+    return Sha3->Engine->Finish(Hash);
+  }
+
+  /* SHA3 domain bits 01, then the pad10*1 rule */
+  for (u32 Index = Sha3->BlockBytes; Index < XFSBL_SHA3_RATE; Index++) {
+    Sha3->Block[Index] = 0U;
+  }
+  Sha3->Block[Sha3->BlockBytes] = 0x06U;
+  Sha3->Block[XFSBL_SHA3_RATE - 1U] |= 0x80U;
+  XFsbl_Sha3Absorb(Sha3->State, Sha3->Block);
+  Sha3->BlockBytes = 0U;
+
+  for (u32 Index = 0U; Index < XFSBL_SHA3_LEN; Index++) {
+    Hash[Index] = (u8)(Sha3->State[Index / 8U] >> (8U * (Index % 8U)));
+  }
+
+  return XFSBL_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function computes the SHA3-384 digest of a buffer
+ *
+ * @param	Data is the data
+ * @param	Length is the number of bytes of data
+ * @param	Hash is filled with the XFSBL_SHA3_LEN bytes of the digest
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns the engine error on failure
+ *
+ *****************************************************************************/
+u32 XFsbl_Sha3Digest(const u8* Data, u32 Length, u8* Hash) {
+  XFsblPs_Sha3 Sha3;
+
+  u32 Status = XFsbl_Sha3Start(&Sha3);
+  if (Status == XFSBL_SUCCESS) {
+    Status = XFsbl_Sha3Update(&Sha3, Data, Length);
+  }
+  if (Status == XFSBL_SUCCESS) {
+    Status = XFsbl_Sha3Finish(&Sha3, Hash);
+  }
+
+  return Status;
+}
@@ -0,0 +1,82 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_sha3.h
+ *
+ * This is the header file of the incremental SHA3-384. The digest is built
+ * with XFsbl_Sha3Start(), XFsbl_Sha3Update() for every piece of data and
+ * XFsbl_Sha3Finish(). It is computed in software, or by the engine installed
+ * with XFsbl_Sha3SetEngine(), like the CSU SHA3 engine.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef XFSBL_SHA3_H
+#define XFSBL_SHA3_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+/* Length of the SHA3-384 digest */
+#define XFSBL_SHA3_LEN (48U)
+
+/* Bytes absorbed per Keccak-f[1600] permutation by SHA3-384 */
+#define XFSBL_SHA3_RATE (104U)
+
+/**************************** Type Definitions *******************************/
+/**
+ * SHA3 engine. The functions return XFSBL_SUCCESS or an error code. The
+ * engine computes one digest at a time.
+ */
+typedef struct {
+  u32 (*Start)(void);
+  u32 (*Update)(const u8* Data, u32 Length);
+  u32 (*Finish)(u8* Hash);
+} XFsblPs_Sha3Engine;
+
+/**
+ * Digest in progress
+ */
+typedef struct {
+  const XFsblPs_Sha3Engine* Engine; /**< NULL for the software Keccak */
+  u64 State[25];
+  u8 Block[XFSBL_SHA3_RATE]; /**< Partial block not absorbed yet */
+  u32 BlockBytes;
+} XFsblPs_Sha3;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+void XFsbl_Sha3SetEngine(const XFsblPs_Sha3Engine* Engine);
+u32 XFsbl_Sha3Start(XFsblPs_Sha3* Sha3);
+u32 XFsbl_Sha3Update(XFsblPs_Sha3* Sha3, const u8* Data, u32 Length);
+u32 XFsbl_Sha3Finish(XFsblPs_Sha3* Sha3, u8* Hash);
+u32 XFsbl_Sha3Digest(const u8* Data, u32 Length, u8* Hash);
+
+#ifdef XFSBL_CSU_SHA3
+extern const XFsblPs_Sha3Engine XFsbl_CsuSha3Engine;
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_SHA3_H */
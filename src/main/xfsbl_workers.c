@@ -0,0 +1,382 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_workers.c
+ *
+ * This is the file which contains the A53 workers of the FSBL.
+ *
+ * A worker core starts at XFsbl_WorkerEntry, through its RVBAR, with its
+ * own stack and the vector table of the FSBL, and waits in WFE for a job.
+ * A job is posted by incrementing its sequence number followed by SEV.
+ * Index n of a job runs on the core of slot n modulo the number of cores,
+ * the FSBL core being slot 0, so no index is claimed with atomic accesses.
+ * Like the FSBL core the workers run with the MMU off, every data access
+ * is non cacheable and the cores share memory without cache maintenance.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *       dd   10/16/26 Skip the cores released by an early handoff
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xfsbl_workers.h"
+
+#ifdef XFSBL_APU_WORKERS
+#  include "psu_init.h"
+#  include "sleep.h"
+#  include "xfsbl_main.h"
+#  include "xpseudo_asm.h"
+#  include "xreg_cortexa53.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+#ifdef XFSBL_APU_WORKERS
+/* Time a released core has to reach XFsbl_WorkerMain */
+#  define XFSBL_WORKERS_START_TIMEOUT_US (1000U)
+
+/**************************** Type Definitions *******************************/
+/**
+ * Job posted to the workers
+ */
+typedef struct {
+  XFsbl_WorkerFn Fn;
+  void* Context;
+  u32 Count;
+  u32 Cores;    /**< Cores sharing the job, the FSBL core included */
+  u32 Sequence; /**< Incremented for every job */
+} XFsblPs_WorkerJob;
+
+/**
+ * State of a worker core, only written by the core once it runs
+ */
+typedef struct {
+  u32 Slot;     /**< Indices Slot, Slot + Cores, ... of a job, 0 if unused */
+  u32 Ready;    /**< TRUE once the core waits for jobs */
+  u32 Sequence; /**< Last job done */
+} __attribute__((aligned(64))) XFsblPs_WorkerState;
+
+/**
+ * Power island, reset and RVBAR of a worker core
+ */
+typedef struct {
+  u32 PwrState;
+  u32 Reset;
+  u32 PwrOnReset;
+  UINTPTR RvbarLow;
+  UINTPTR RvbarHigh;
+  u32 PowerUpError;
+} XFsblPs_WorkerCore;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#  define XFSBL_WORKERS_SYNC() __asm__ __volatile__("dsb sy" : : : "memory")
+#  define XFSBL_WORKERS_SEV() __asm__ __volatile__("sev" : : : "memory")
+#  define XFSBL_WORKERS_WFE() __asm__ __volatile__("wfe" : : : "memory")
+
+/* AArch64 execution state of an A53 core in APU_CONFIG_0 */
+#  define XFSBL_WORKERS_AA64N32_MASK(Core) ((u32)1U << (Core))
+
+/************************** Function Prototypes ******************************/
+void XFsbl_WorkerEntry(void);
+void XFsbl_WorkerMain(u64 Core);
+
+/************************** Variable Definitions *****************************/
+static const XFsblPs_WorkerCore XFsbl_WorkerCores[XFSBL_WORKERS_MAX_CORES] = {
+    {0U, 0U, 0U, 0U, 0U, 0U},
+    {PMU_GLOBAL_PWR_STATE_ACPU1_MASK, CRF_APB_RST_FPD_APU_ACPU1_RESET_MASK,
+     CRF_APB_RST_FPD_APU_ACPU1_PWRON_RESET_MASK, APU_RVBARADDR1L,
+     APU_RVBARADDR1H, XFSBL_ERROR_A53_1_POWER_UP},
+    {PMU_GLOBAL_PWR_STATE_ACPU2_MASK, CRF_APB_RST_FPD_APU_ACPU2_RESET_MASK,
+     CRF_APB_RST_FPD_APU_ACPU2_PWRON_RESET_MASK, APU_RVBARADDR2L,
+     APU_RVBARADDR2H, XFSBL_ERROR_A53_2_POWER_UP},
+    {PMU_GLOBAL_PWR_STATE_ACPU3_MASK, CRF_APB_RST_FPD_APU_ACPU3_RESET_MASK,
+     CRF_APB_RST_FPD_APU_ACPU3_PWRON_RESET_MASK, APU_RVBARADDR3L,
+     APU_RVBARADDR3H, XFSBL_ERROR_A53_3_POWER_UP}};
+
+static volatile XFsblPs_WorkerJob WorkerJob __attribute__((aligned(64))) = {
+    NULL, NULL, 0U, 1U, 0U};
+static volatile XFsblPs_WorkerState WorkerState[XFSBL_WORKERS_MAX_CORES];
+
+/* Read by XFsbl_WorkerEntry, indexed by the core number */
+u64 XFsbl_WorkerStackTop[XFSBL_WORKERS_MAX_CORES];
+static u8 WorkerStacks[XFSBL_WORKERS_MAX_CORES - 1U][XFSBL_WORKERS_STACK_SIZE]
+    __attribute__((aligned(16)));
+
+/*
+ * Reset entry of the worker cores, at EL3 in AArch64 with the MMU off. The
+ * FSBL core traps the FPU and enables it lazily, the workers enable it
+ * right away since the jobs use NEON.
+ */
+__asm__(
+    "	.section .text.XFsbl_WorkerEntry, \"ax\"\n"
+    "	.global XFsbl_WorkerEntry\n"
+    "	.type XFsbl_WorkerEntry, %function\n"
+    "	.balign 64\n"
+    "XFsbl_WorkerEntry:\n"
+    "	ldr	x1, =_vector_table\n"
+    "	msr	VBAR_EL3, x1\n"
+    "	msr	CPTR_EL3, xzr\n"
+    "	mrs	x0, S3_1_C15_C2_1\n" /* CPUECTLR_EL1, set SMPEN */
+    "	orr	x0, x0, #(1 << 6)\n"
+    "	msr	S3_1_C15_C2_1, x0\n"
+    "	isb\n"
+    "	mrs	x0, MPIDR_EL1\n"
+    "	and	x0, x0, #0xFF\n"
+    "	ldr	x1, =XFsbl_WorkerStackTop\n"
+    "	ldr	x2, [x1, x0, lsl #3]\n"
+    "	mov	sp, x2\n"
+    "	bl	XFsbl_WorkerMain\n"
+    "1:\n"
+    "	wfe\n"
+    "	b	1b\n"
+    "	.ltorg\n"
+    "	.previous\n");
+
+/*****************************************************************************/
+/**
+ * This function is the main loop of a worker core, it runs the indices of
+ * its slot of every job posted
+ *
+ * @param	Core is the A53 core number
+ *
+ *****************************************************************************/
+void XFsbl_WorkerMain(u64 Core) {
+  volatile XFsblPs_WorkerState* const State = &WorkerState[Core];
+  u32 Done = WorkerJob.Sequence;
+
+  State->Sequence = Done;
+  XFSBL_WORKERS_SYNC();
+  State->Ready = TRUE;
+  XFSBL_WORKERS_SYNC();
+  XFSBL_WORKERS_SEV();
+
+  for (;;) {
+    while (WorkerJob.Sequence == Done) {
+      XFSBL_WORKERS_WFE();
+    }
+    XFSBL_WORKERS_SYNC();
+    Done = WorkerJob.Sequence;
+
+    const XFsbl_WorkerFn Fn = WorkerJob.Fn;
+    void* const Context = WorkerJob.Context;
+    const u32 Count = WorkerJob.Count;
+    const u32 Cores = WorkerJob.Cores;
+    for (u32 Index = State->Slot; Index < Count; Index += Cores) {
+      Fn(Context, Index);
+    }
+
+    XFSBL_WORKERS_SYNC();
+    State->Sequence = Done;
+    XFSBL_WORKERS_SYNC();
+    XFSBL_WORKERS_SEV();
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function powers up a worker core and releases it from reset at
+ * XFsbl_WorkerEntry
+ *
+ * @param	Core is the A53 core number, 1 to 3
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns XFSBL_ERROR_A53_x_POWER_UP on failure
+ *
+ *****************************************************************************/
+static u32 XFsbl_WorkerRelease(u32 Core) {
+  const XFsblPs_WorkerCore* const WorkerCore = &XFsbl_WorkerCores[Core];
+  const u64 Entry = (u64)(UINTPTR)&XFsbl_WorkerEntry;
+  u32 RegValue;
+
+  if (XFsbl_PowerUpIsland(WorkerCore->PwrState | PMU_GLOBAL_PWR_STATE_FP_MASK |
+                          PMU_GLOBAL_PWR_STATE_L2_BANK0_MASK) !=
+      XFSBL_SUCCESS) {
+    XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_A53_%u_POWER_UP\r\n", Core);
+    return WorkerCore->PowerUpError;
+  }
+
+  WorkerState[Core].Ready = FALSE;
+  WorkerState[Core].Slot = 0U;
+  XFsbl_WorkerStackTop[Core] =
+      (u64)(UINTPTR)&WorkerStacks[Core - 1U][XFSBL_WORKERS_STACK_SIZE];
+  XFSBL_WORKERS_SYNC();
+
+  XFsbl_Out32(WorkerCore->RvbarLow, (u32)Entry);
+  XFsbl_Out32(WorkerCore->RvbarHigh, (u32)(Entry >> 32U));
+
+  RegValue = XFsbl_In32(APU_CONFIG_0);
+  XFsbl_Out32(APU_CONFIG_0, RegValue | XFSBL_WORKERS_AA64N32_MASK(Core));
+
+  RegValue = XFsbl_In32(CRF_APB_ACPU_CTRL);
+  XFsbl_Out32(CRF_APB_ACPU_CTRL, RegValue |
+                                     CRF_APB_ACPU_CTRL_CLKACT_FULL_MASK |
+                                     CRF_APB_ACPU_CTRL_CLKACT_HALF_MASK);
+
+  RegValue = XFsbl_In32(CRF_APB_RST_FPD_APU);
+  RegValue &= ~(WorkerCore->Reset | WorkerCore->PwrOnReset |
+                CRF_APB_RST_FPD_APU_APU_L2_RESET_MASK);
+  XFsbl_Out32(CRF_APB_RST_FPD_APU, RegValue);
+
+  return XFSBL_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function puts a worker core back in reset
+ *
+ * @param	Core is the A53 core number, 1 to 3
+ *
+ *****************************************************************************/
+static void XFsbl_WorkerReset(u32 Core) {
+  const u32 RegValue = XFsbl_In32(CRF_APB_RST_FPD_APU);
+
+  XFsbl_Out32(CRF_APB_RST_FPD_APU, RegValue | XFsbl_WorkerCores[Core].Reset);
+  WorkerState[Core].Ready = FALSE;
+  WorkerState[Core].Slot = 0U;
+}
+#endif /* XFSBL_APU_WORKERS */
+
+/*****************************************************************************/
+/**
+ * This function releases the other A53 cores as workers. Cores that fail
+ * to start are left in reset and the jobs are shared by the others. Cores
+ * released by an early handoff are left running their application.
+ *
+ * @return	returns XFSBL_SUCCESS when all the cores run as workers
+ * 		returns XFSBL_FAILURE when the data cache is enabled
+ * 		returns XFSBL_ERROR_A53_x_POWER_UP when a core is not powered
+ *
+ *****************************************************************************/
+u32 XFsbl_WorkersStart(void) {
+  u32 Status = XFSBL_SUCCESS;
+
+#ifdef XFSBL_APU_WORKERS
+  u32 Cores = 1U;
+
+  if (WorkerJob.Cores > 1U) {
+    return XFSBL_SUCCESS;
+  }
+
+  if ((mfcp(SCTLR_EL3) & XREG_CONTROL_DCACHE_BIT) != 0U) {
+    XFsbl_Printf(DEBUG_INFO, "A53 workers need the data cache off\r\n");
+    return XFSBL_FAILURE;
+  }
+
+  for (u32 Core = 1U; Core < XFSBL_WORKERS_MAX_CORES; Core++) {
+    /* A core out of reset runs an application of an early handoff */
+    if ((XFsbl_In32(CRF_APB_RST_FPD_APU) & XFsbl_WorkerCores[Core].Reset) ==
+        0U) {
+      continue;
+    }
+
+    const u32 CoreStatus = XFsbl_WorkerRelease(Core);
+    if (CoreStatus != XFSBL_SUCCESS) {
+      Status = CoreStatus;
+      continue;
+    }
+
+    for (u32 Wait = 0U; (Wait < XFSBL_WORKERS_START_TIMEOUT_US) &&
+                        (WorkerState[Core].Ready != TRUE);
+         Wait++) {
+      (void)usleep(1U);
+    }
+    if (WorkerState[Core].Ready != TRUE) {
+      XFsbl_Printf(DEBUG_INFO, "A53 %u worker did not start\r\n", Core);
+      XFsbl_WorkerReset(Core);
+      Status = XFSBL_FAILURE;
+      continue;
+    }
+
+    WorkerState[Core].Slot = Cores;
+    Cores++;
+  }
+
+  XFSBL_WORKERS_SYNC();
+  WorkerJob.Cores = Cores;
+  XFsbl_Printf(DEBUG_INFO, "%u A53 cores share the jobs\r\n", Cores);
+#endif
+
+  return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function calls Fn for the indices 0 to Count - 1 on the FSBL core
+ * and the workers, and returns when all of them are done
+ *
+ * @param	Fn is the work of one index
+ * @param	Context is passed to Fn
+ * @param	Count is the number of indices
+ *
+ *****************************************************************************/
+void XFsbl_WorkersRun(XFsbl_WorkerFn Fn, void* Context, u32 Count) {
+  u32 Cores = 1U;
+
+#ifdef XFSBL_APU_WORKERS
+  if (Count > 1U) {
+    Cores = WorkerJob.Cores;
+  }
+
+  if (Cores > 1U) {
+    const u32 Sequence = WorkerJob.Sequence + 1U;
+
+    WorkerJob.Fn = Fn;
+    WorkerJob.Context = Context;
+    WorkerJob.Count = Count;
+    XFSBL_WORKERS_SYNC();
+    WorkerJob.Sequence = Sequence;
+    XFSBL_WORKERS_SYNC();
+    XFSBL_WORKERS_SEV();
+
+    for (u32 Index = 0U; Index < Count; Index += Cores) {
+      Fn(Context, Index);
+    }
+
+    for (u32 Core = 1U; Core < XFSBL_WORKERS_MAX_CORES; Core++) {
+      while ((WorkerState[Core].Slot != 0U) &&
+             (WorkerState[Core].Sequence != Sequence)) {
+        XFSBL_WORKERS_WFE();
+      }
+    }
+    XFSBL_WORKERS_SYNC();
+    return;
+  }
+#endif
+
+  for (u32 Index = 0U; Index < Count; Index += Cores) {
+    Fn(Context, Index);
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function puts the workers back in reset, so the cores can be handed
+ * off to
+ *
+ *****************************************************************************/
+void XFsbl_WorkersStop(void) {
+#ifdef XFSBL_APU_WORKERS
+  if (WorkerJob.Cores <= 1U) {
+    return;
+  }
+
+  for (u32 Core = 1U; Core < XFSBL_WORKERS_MAX_CORES; Core++) {
+    if (WorkerState[Core].Slot != 0U) {
+      XFsbl_WorkerReset(Core);
+    }
+  }
+  WorkerJob.Cores = 1U;
+#endif
+}
@@ -0,0 +1,63 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_workers.h
+ *
+ * This is the header file of the A53 workers. XFsbl_WorkersRun() calls a
+ * function for every index of a job, on the FSBL core and on the other A53
+ * cores released by XFsbl_WorkersStart(), which are put back in reset by
+ * XFsbl_WorkersStop(). Without XFSBL_APU_WORKERS every index is run on the
+ * FSBL core.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef XFSBL_WORKERS_H
+#define XFSBL_WORKERS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xfsbl_hw.h"
+
+/************************** Constant Definitions *****************************/
+/* Cores sharing a job, the FSBL core included */
+#define XFSBL_WORKERS_MAX_CORES (4U)
+
+/* Stack of every worker core */
+#define XFSBL_WORKERS_STACK_SIZE (0x1000U)
+
+/**************************** Type Definitions *******************************/
+/**
+ * Work of one index of a job. It runs on any core, concurrently with the
+ * other indices, and must only write the data of its index.
+ */
+typedef void (*XFsbl_WorkerFn)(void* Context, u32 Index);
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+u32 XFsbl_WorkersStart(void);
+void XFsbl_WorkersRun(XFsbl_WorkerFn Fn, void* Context, u32 Count);
+void XFsbl_WorkersStop(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_WORKERS_H */
@@ -0,0 +1,513 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_zdma.c
+ *
+ * This is the file which contains the ZDMA copy engine of the FSBL.
+ *
+ * A request is split in 64 byte aligned slices, one per free channel. A copy
+ * slice is programmed as a chain of linked list descriptors from the OCM
+ * descriptor pool of its channel, a fill slice as write only transfers.
+ * Slices larger than the descriptor chain of a channel are continued when
+ * the channel is polled. The caller takes care of the data cache for the
+ * source and destination buffers, the descriptors are flushed here.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *       dd   10/16/26 Drain the deferred log while waiting for a request
+ *       dd   10/16/26 Wait for a request on a deadline
+ *       dd   10/16/26 Added fills on a limited number of channels
+ *       dd   10/16/26 Abort a request which times out
+ *       dd   10/16/26 Scale the timeout of a request with its length
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xfsbl_zdma.h"
+
+#include "xfsbl_log.h"
+#include "xfsbl_misc_drivers.h"
+#include "xfsbl_poll.h"
+#include "xil_cache.h"
+
+/************************** Constant Definitions *****************************/
+#if (XFSBL_ZDMA_CHANNELS == 0U) || \
+    (XFSBL_ZDMA_CHANNELS > XFSBL_ZDMA_MAX_CHANNELS)
+#  error "XFSBL_ZDMA_CHANNELS must be 1 to 8"
+#endif
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Linked list descriptor, the source and destination chains are separate
+ */
+typedef struct {
+  u64 Address;
+  u32 Size;
+  u32 Ctrl;
+  u64 Next;
+  u64 Reserved;
+} XFsblPs_ZDmaDscr;
+
+typedef struct {
+  XFsblPs_ZDmaRequest* Owner; /**< Request of the slice, NULL when free */
+  u64 DestAddr;               /**< Destination of the next transfer */
+  u64 SrcAddr;                /**< Source of the next copy transfer */
+  u64 Remaining;              /**< Bytes of the slice not yet programmed */
+  u32 Pattern;                /**< Fill pattern */
+  u32 Fill;                   /**< TRUE for a fill slice */
+} XFsblPs_ZDmaChannel;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define XFSBL_ZDMA_CH_BASE(Channel)                                            \
+  ((UINTPTR)XFSBL_ZDMA_BASEADDR + ((UINTPTR)(Channel)*XFSBL_ZDMA_CH_STRIDE))
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+static XFsblPs_ZDmaChannel ZDmaChannels[XFSBL_ZDMA_CHANNELS];
+static XFsblPs_ZDmaDscr ZDmaSrcDscr[XFSBL_ZDMA_CHANNELS]
+                                   [XFSBL_ZDMA_DSCR_PER_CHANNEL]
+    __attribute__((aligned(64)));
+static XFsblPs_ZDmaDscr ZDmaDstDscr[XFSBL_ZDMA_CHANNELS]
+                                   [XFSBL_ZDMA_DSCR_PER_CHANNEL]
+    __attribute__((aligned(64)));
+
+static void XFsbl_ZDmaSetDscr(XFsblPs_ZDmaDscr* Dscr, u64 Address, u32 Size) {
+  Dscr->Address = Address;
+  Dscr->Size = Size;
+  Dscr->Ctrl = XFSBL_ZDMA_DSCR_COHRNT | XFSBL_ZDMA_DSCR_TYPE_LL;
+  Dscr->Next = (UINTPTR)&Dscr[1];
+  Dscr->Reserved = 0U;
+}
+
+/*****************************************************************************/
+/**
+ * This function programs and starts the next transfer of a channel slice
+ *
+ * @param	Channel is the channel index
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_ZDmaChannelStart(u32 Channel) {
+  XFsblPs_ZDmaChannel* Ch = &ZDmaChannels[Channel];
+  const UINTPTR Base = XFSBL_ZDMA_CH_BASE(Channel);
+  u32 Size;
+  u32 Index;
+
+  XFsbl_Out32(Base + XFSBL_ZDMA_CH_ISR, XFSBL_ZDMA_ISR_ALL_MASK);
+  XFsbl_Out32(Base + XFSBL_ZDMA_CH_TOTAL_BYTE, 0U);
+
+  if (Ch->Fill == TRUE) {
+    Size = (Ch->Remaining > XFSBL_ZDMA_MAX_SIZE) ? XFSBL_ZDMA_MAX_SIZE
+                                                 : (u32)Ch->Remaining;
+
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_CTRL0, XFSBL_ZDMA_CTRL0_MODE_WR_ONLY);
+    for (Index = 0U; Index < 4U; Index++) {
+      XFsbl_Out32(Base + XFSBL_ZDMA_CH_WR_ONLY_WORD0 + (Index * 4U),
+                  Ch->Pattern);
+    }
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_DST_DSCR_WORD0, (u32)Ch->DestAddr);
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_DST_DSCR_WORD1,
+                (u32)(Ch->DestAddr >> 32U));
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_DST_DSCR_WORD2, Size);
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_DST_DSCR_WORD3, XFSBL_ZDMA_DSCR_COHRNT);
+
+    Ch->DestAddr += Size;
+    Ch->Remaining -= Size;
+  } else {
+    XFsblPs_ZDmaDscr* SrcDscr = ZDmaSrcDscr[Channel];
+    XFsblPs_ZDmaDscr* DstDscr = ZDmaDstDscr[Channel];
+
+    for (Index = 0U;
+         (Index < XFSBL_ZDMA_DSCR_PER_CHANNEL) && (Ch->Remaining != 0U);
+         Index++) {
+      Size = (Ch->Remaining > XFSBL_ZDMA_MAX_SIZE) ? XFSBL_ZDMA_MAX_SIZE
+                                                   : (u32)Ch->Remaining;
+      XFsbl_ZDmaSetDscr(&SrcDscr[Index], Ch->SrcAddr, Size);
+      XFsbl_ZDmaSetDscr(&DstDscr[Index], Ch->DestAddr, Size);
+      Ch->SrcAddr += Size;
+      Ch->DestAddr += Size;
+      Ch->Remaining -= Size;
+    }
+
+    /* Stop at the last descriptor */
+    SrcDscr[Index - 1U].Ctrl |= XFSBL_ZDMA_DSCR_CMD_STOP;
+    SrcDscr[Index - 1U].Next = 0U;
+    DstDscr[Index - 1U].Ctrl |= XFSBL_ZDMA_DSCR_CMD_STOP;
+    DstDscr[Index - 1U].Next = 0U;
+    Xil_DCacheFlushRange((INTPTR)SrcDscr, Index * sizeof(XFsblPs_ZDmaDscr));
+    Xil_DCacheFlushRange((INTPTR)DstDscr, Index * sizeof(XFsblPs_ZDmaDscr));
+
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_CTRL0, XFSBL_ZDMA_CTRL0_POINT_TYPE_LL);
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_DSCR_ATTR, 0U);
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_SRC_START_LSB, (u32)(UINTPTR)SrcDscr);
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_SRC_START_MSB,
+                (u32)((u64)(UINTPTR)SrcDscr >> 32U));
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_DST_START_LSB, (u32)(UINTPTR)DstDscr);
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_DST_START_MSB,
+                (u32)((u64)(UINTPTR)DstDscr >> 32U));
+  }
+
+  XFsbl_Out32(Base + XFSBL_ZDMA_CH_CTRL2, XFSBL_ZDMA_CTRL2_EN);
+}
+
+/*****************************************************************************/
+/**
+ * This function advances a channel slice. A finished transfer starts the
+ * next one until the slice is done, an error ends the slice.
+ *
+ * @param	Channel is the channel index
+ * @param	Done is set to TRUE once the channel is free again
+ *
+ * @return	returns XFSBL_SUCCESS unless the channel reported an error
+ * 		returns XFSBL_ERROR_ZDMA on a channel error
+ *
+ *****************************************************************************/
+static u32 XFsbl_ZDmaChannelPoll(u32 Channel, u32* Done) {
+  XFsblPs_ZDmaChannel* Ch = &ZDmaChannels[Channel];
+  const UINTPTR Base = XFSBL_ZDMA_CH_BASE(Channel);
+  u32 Status = XFSBL_SUCCESS;
+
+  *Done = FALSE;
+
+  const u32 Isr = XFsbl_In32(Base + XFSBL_ZDMA_CH_ISR);
+  if (((Isr & XFSBL_ZDMA_ISR_ERR_MASK) == 0U) &&
+      ((Isr & XFSBL_ZDMA_ISR_DMA_DONE) == 0U)) {
+    return XFSBL_SUCCESS;
+  }
+
+  XFsbl_Out32(Base + XFSBL_ZDMA_CH_ISR, XFSBL_ZDMA_ISR_ALL_MASK);
+  XFsbl_Out32(Base + XFSBL_ZDMA_CH_TOTAL_BYTE, 0U);
+
+  if (((Isr & XFSBL_ZDMA_ISR_ERR_MASK) != 0U) ||
+      ((XFsbl_In32(Base + XFSBL_ZDMA_CH_STATUS) &
+        XFSBL_ZDMA_STATUS_STATE_MASK) == XFSBL_ZDMA_STATUS_STATE_ERR)) {
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_CTRL2, 0U);
+    XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_ZDMA channel %d ISR 0x%x\n\r",
+                 Channel, Isr);
+    Ch->Remaining = 0U;
+    Status = XFSBL_ERROR_ZDMA;
+  }
+
+  if (Ch->Remaining != 0U) {
+    XFsbl_ZDmaChannelStart(Channel);
+  } else {
+    Ch->Owner = NULL;
+    *Done = TRUE;
+  }
+
+  return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function gives the timeout of a request, so that a large fill such
+ * as the ECC initialization of the whole DDR is not cut short
+ *
+ * @param	Length is the number of bytes of the request
+ *
+ * @return	Timeout in us
+ *
+ *****************************************************************************/
+static u32 XFsbl_ZDmaTimeOut(u64 Length) {
+  const u64 TimeOutUs =
+      XFSBL_ZDMA_TIMEOUT + (Length / XFSBL_ZDMA_TIMEOUT_BYTES_PER_US);
+
+  return (TimeOutUs > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (u32)TimeOutUs;
+}
+
+static u32 XFsbl_ZDmaSubmit(XFsblPs_ZDmaRequest* Request, u64 DestAddr,
+                            u64 SrcAddr, u32 Pattern, u32 Fill, u64 Length,
+                            u32 MaxChannels) {
+  u32 Free[XFSBL_ZDMA_CHANNELS];
+  u32 Count = 0U;
+  u32 Channel;
+  u32 Index;
+  u64 Offset = 0U;
+
+  Request->ChannelMask = 0U;
+  Request->State = XFSBL_DEVICE_REQUEST_DONE;
+  Request->Status = XFSBL_SUCCESS;
+  Request->TimeOutUs = XFsbl_ZDmaTimeOut(Length);
+
+  if (Length == 0U) {
+    return XFSBL_SUCCESS;
+  }
+
+  for (Channel = 0U; Channel < XFSBL_ZDMA_CHANNELS; Channel++) {
+    if (ZDmaChannels[Channel].Owner == NULL) {
+      Free[Count] = Channel;
+      Count++;
+    }
+  }
+  if (Count == 0U) {
+    Request->Status = XFSBL_ERROR_DEVICE_BUSY;
+    return Request->Status;
+  }
+
+  /* Small transfers are not worth the setup of several channels */
+  if (Length < XFSBL_ZDMA_SPLIT_MIN) {
+    Count = 1U;
+  } else if (Count > MaxChannels) {
+    Count = MaxChannels;
+  }
+  const u64 Slice = ((Length / Count) + XFSBL_ZDMA_SPLIT_ALIGN - 1U) &
+                    ~((u64)XFSBL_ZDMA_SPLIT_ALIGN - 1U);
+
+  for (Index = 0U; (Index < Count) && (Offset < Length); Index++) {
+    XFsblPs_ZDmaChannel* Ch = &ZDmaChannels[Free[Index]];
+    const u64 Size = ((Length - Offset) > Slice) ? Slice : (Length - Offset);
+
+    Ch->Owner = Request;
+    Ch->DestAddr = DestAddr + Offset;
+    Ch->SrcAddr = SrcAddr + Offset;
+    Ch->Remaining = Size;
+    Ch->Pattern = Pattern;
+    Ch->Fill = Fill;
+    Request->ChannelMask |= (u32)1U << Free[Index];
+    Offset += Size;
+  }
+
+  Request->State = XFSBL_DEVICE_REQUEST_PENDING;
+  for (Channel = 0U; Channel < XFSBL_ZDMA_CHANNELS; Channel++) {
+    if ((Request->ChannelMask & ((u32)1U << Channel)) != 0U) {
+      XFsbl_ZDmaChannelStart(Channel);
+    }
+  }
+
+  return XFSBL_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function submits a memory to memory copy. The copy is split across
+ * the free channels.
+ *
+ * @param	Request is the request handle, owned by the caller until done
+ * @param	DestAddr is the destination address
+ * @param	SrcAddr is the source address
+ * @param	Length is the number of bytes to be copied
+ *
+ * @return	returns XFSBL_SUCCESS if the request was accepted
+ * 		returns XFSBL_ERROR_DEVICE_BUSY if no channel is free
+ *
+ *****************************************************************************/
+u32 XFsbl_ZDmaCopySubmit(XFsblPs_ZDmaRequest* Request, u64 DestAddr,
+                         u64 SrcAddr, u64 Length) {
+  return XFsbl_ZDmaSubmit(Request, DestAddr, SrcAddr, 0U, FALSE, Length,
+                          XFSBL_ZDMA_CHANNELS);
+}
+
+/*****************************************************************************/
+/**
+ * This function submits a fill of memory with a 32 bit pattern. The fill
+ * is split across the free channels.
+ *
+ * @param	Request is the request handle, owned by the caller until done
+ * @param	DestAddr is the destination address, 16 byte aligned
+ * @param	Pattern is written to every word of the destination
+ * @param	Length is the number of bytes to be filled, a multiple of 16
+ *
+ * @return	returns XFSBL_SUCCESS if the request was accepted
+ * 		returns XFSBL_ERROR_ZDMA on an unaligned fill
+ * 		returns XFSBL_ERROR_DEVICE_BUSY if no channel is free
+ *
+ *****************************************************************************/
+u32 XFsbl_ZDmaFillSubmit(XFsblPs_ZDmaRequest* Request, u64 DestAddr,
+                         u32 Pattern, u64 Length) {
+  return XFsbl_ZDmaFillSubmitChannels(Request, DestAddr, Pattern, Length,
+                                      XFSBL_ZDMA_CHANNELS);
+}
+
+/*****************************************************************************/
+/**
+ * This function submits a fill of memory with a 32 bit pattern on at most
+ * MaxChannels of the free channels, leaving the others to other requests.
+ *
+ * @param	Request is the request handle, owned by the caller until done
+ * @param	DestAddr is the destination address, 16 byte aligned
+ * @param	Pattern is written to every word of the destination
+ * @param	Length is the number of bytes to be filled, a multiple of 16
+ * @param	MaxChannels is the number of channels the fill may use, from 1
+ *
+ * @return	returns XFSBL_SUCCESS if the request was accepted
+ * 		returns XFSBL_ERROR_ZDMA on an unaligned fill
+ * 		returns XFSBL_ERROR_DEVICE_BUSY if no channel is free
+ *
+ *****************************************************************************/
+u32 XFsbl_ZDmaFillSubmitChannels(XFsblPs_ZDmaRequest* Request, u64 DestAddr,
+                                 u32 Pattern, u64 Length, u32 MaxChannels) {
+  if (((DestAddr | Length) & (XFSBL_ZDMA_FILL_ALIGN - 1U)) != 0U) {
+    XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_ZDMA unaligned fill\n\r");
+    Request->State = XFSBL_DEVICE_REQUEST_DONE;
+    Request->Status = XFSBL_ERROR_ZDMA;
+    Request->TimeOutUs = XFSBL_ZDMA_TIMEOUT;
+    return Request->Status;
+  }
+
+  return XFsbl_ZDmaSubmit(Request, DestAddr, 0U, Pattern, TRUE, Length,
+                          MaxChannels);
+}
+
+/*****************************************************************************/
+/**
+ * This function advances a request without blocking.
+ *
+ * @param	Request is the request handle
+ *
+ * @return	XFSBL_STATUS_DEVICE_REQUEST_PENDING while the request is in
+ *		progress, otherwise its completion status
+ *
+ *****************************************************************************/
+u32 XFsbl_ZDmaPoll(XFsblPs_ZDmaRequest* Request) {
+  u32 Channel;
+  u32 Done;
+
+  if (Request->State == XFSBL_DEVICE_REQUEST_DONE) {
+    return Request->Status;
+  }
+
+  for (Channel = 0U; Channel < XFSBL_ZDMA_CHANNELS; Channel++) {
+    if ((Request->ChannelMask & ((u32)1U << Channel)) == 0U) {
+      continue;
+    }
+
+    const u32 Status = XFsbl_ZDmaChannelPoll(Channel, &Done);
+    if ((Status != XFSBL_SUCCESS) && (Request->Status == XFSBL_SUCCESS)) {
+      Request->Status = Status;
+    }
+    if (Done == TRUE) {
+      Request->ChannelMask &= ~((u32)1U << Channel);
+    }
+  }
+
+  if (Request->ChannelMask != 0U) {
+    return XFSBL_STATUS_DEVICE_REQUEST_PENDING;
+  }
+
+  Request->State = XFSBL_DEVICE_REQUEST_DONE;
+
+  return Request->Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function stops a request and frees its channels, so that the
+ * request handle may go away while the request is not done.
+ *
+ * @param	Request is the request handle
+ *
+ * @param	Status is the completion status given to the request
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_ZDmaAbort(XFsblPs_ZDmaRequest* Request, u32 Status) {
+  u32 Channel;
+
+  for (Channel = 0U; Channel < XFSBL_ZDMA_CHANNELS; Channel++) {
+    if ((Request->ChannelMask & ((u32)1U << Channel)) == 0U) {
+      continue;
+    }
+
+    const UINTPTR Base = XFSBL_ZDMA_CH_BASE(Channel);
+
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_CTRL2, 0U);
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_ISR, XFSBL_ZDMA_ISR_ALL_MASK);
+    XFsbl_Out32(Base + XFSBL_ZDMA_CH_TOTAL_BYTE, 0U);
+    ZDmaChannels[Channel].Remaining = 0U;
+    ZDmaChannels[Channel].Owner = NULL;
+  }
+
+  Request->ChannelMask = 0U;
+  if (Request->State == XFSBL_DEVICE_REQUEST_PENDING) {
+    Request->State = XFSBL_DEVICE_REQUEST_DONE;
+    Request->Status = Status;
+  }
+}
+
+/*****************************************************************************/
+/**
+ * This function blocks until a request is done.
+ *
+ * @param	Request is the request handle
+ *
+ * @return	Completion status of the request, XFSBL_ERROR_POLL_TIMEOUT if
+ *		it is not done within the timeout its length gives, it is then
+ *		aborted
+ *
+ *****************************************************************************/
+u32 XFsbl_ZDmaWait(XFsblPs_ZDmaRequest* Request) {
+  u32 Status = XFSBL_STATUS_DEVICE_REQUEST_PENDING;
+
+  if (XFSBL_POLL_UNTIL(
+          (Status = XFsbl_ZDmaPoll(Request)) !=
+              XFSBL_STATUS_DEVICE_REQUEST_PENDING,
+          Request->TimeOutUs, 0U) != XFSBL_SUCCESS) {
+    XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_POLL_TIMEOUT: ZDMA\n\r");
+    Status = XFSBL_ERROR_POLL_TIMEOUT;
+    XFsbl_ZDmaAbort(Request, Status);
+  }
+
+  return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function copies memory to memory and waits for the copy
+ *
+ * @param	DestAddr is the destination address
+ * @param	SrcAddr is the source address
+ * @param	Length is the number of bytes to be copied
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns the error codes described in xfsbl_error.h on failure
+ *
+ *****************************************************************************/
+u32 XFsbl_ZDmaCopy(u64 DestAddr, u64 SrcAddr, u64 Length) {
+  XFsblPs_ZDmaRequest Request;
+
+  const u32 Status = XFsbl_ZDmaCopySubmit(&Request, DestAddr, SrcAddr, Length);
+  if (Status != XFSBL_SUCCESS) {
+    return Status;
+  }
+
+  return XFsbl_ZDmaWait(&Request);
+}
+
+/*****************************************************************************/
+/**
+ * This function fills memory with a 32 bit pattern and waits for the fill
+ *
+ * @param	DestAddr is the destination address, 16 byte aligned
+ * @param	Pattern is written to every word of the destination
+ * @param	Length is the number of bytes to be filled, a multiple of 16
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 		returns the error codes described in xfsbl_error.h on failure
+ *
+ *****************************************************************************/
+u32 XFsbl_ZDmaFill(u64 DestAddr, u32 Pattern, u64 Length) {
+  XFsblPs_ZDmaRequest Request;
+
+  const u32 Status = XFsbl_ZDmaFillSubmit(&Request, DestAddr, Pattern, Length);
+  if (Status != XFSBL_SUCCESS) {
+    return Status;
+  }
+
+  return XFsbl_ZDmaWait(&Request);
+}
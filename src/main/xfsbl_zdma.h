@@ -0,0 +1,120 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_zdma.h
+ *
+ * This is the header file of the ZDMA copy engine. Copies and fills are
+ * split across several channels of one ZDMA block. Copies use linked list
+ * descriptors from an OCM pool, fills use the write only mode.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   dd   10/16/26 Initial release
+ *       dd   10/16/26 Added XFSBL_ZDMA_TIMEOUT
+ *       dd   10/16/26 Added XFsbl_ZDmaFillSubmitChannels
+ *       dd   10/16/26 Added XFsbl_ZDmaAbort
+ *       dd   10/16/26 Scale the timeout of a request with its length
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef XFSBL_ZDMA_H
+#define XFSBL_ZDMA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xfsbl_hw.h"
+
+/************************** Constant Definitions *****************************/
+/* Register offsets of a ZDMA channel */
+#define XFSBL_ZDMA_CH_ISR (0x100U)
+#define XFSBL_ZDMA_CH_CTRL0 (0x110U)
+#define XFSBL_ZDMA_CH_STATUS (0x11CU)
+#define XFSBL_ZDMA_CH_DSCR_ATTR (0x124U)
+#define XFSBL_ZDMA_CH_DST_DSCR_WORD0 (0x138U)
+#define XFSBL_ZDMA_CH_DST_DSCR_WORD1 (0x13CU)
+#define XFSBL_ZDMA_CH_DST_DSCR_WORD2 (0x140U)
+#define XFSBL_ZDMA_CH_DST_DSCR_WORD3 (0x144U)
+#define XFSBL_ZDMA_CH_WR_ONLY_WORD0 (0x148U)
+#define XFSBL_ZDMA_CH_SRC_START_LSB (0x158U)
+#define XFSBL_ZDMA_CH_SRC_START_MSB (0x15CU)
+#define XFSBL_ZDMA_CH_DST_START_LSB (0x160U)
+#define XFSBL_ZDMA_CH_DST_START_MSB (0x164U)
+#define XFSBL_ZDMA_CH_TOTAL_BYTE (0x188U)
+#define XFSBL_ZDMA_CH_CTRL2 (0x200U)
+
+#define XFSBL_ZDMA_CH_STRIDE (0x10000U)
+#define XFSBL_ZDMA_MAX_CHANNELS (8U)
+
+#define XFSBL_ZDMA_CTRL0_POINT_TYPE_LL (0x40U)
+#define XFSBL_ZDMA_CTRL0_MODE_WR_ONLY (0x10U)
+#define XFSBL_ZDMA_CTRL2_EN (0x1U)
+#define XFSBL_ZDMA_STATUS_STATE_MASK (0x3U)
+#define XFSBL_ZDMA_STATUS_STATE_ERR (0x3U)
+#define XFSBL_ZDMA_ISR_DMA_DONE (0x400U)
+#define XFSBL_ZDMA_ISR_ERR_MASK (0x3C1U)
+#define XFSBL_ZDMA_ISR_ALL_MASK (0xFFFU)
+
+/* Descriptor control word */
+#define XFSBL_ZDMA_DSCR_COHRNT (0x1U)
+#define XFSBL_ZDMA_DSCR_TYPE_LL (0x2U)
+#define XFSBL_ZDMA_DSCR_CMD_STOP (0x10U)
+
+/* Largest transfer of one descriptor, a multiple of the split alignment */
+#define XFSBL_ZDMA_MAX_SIZE (0x3FFFFFC0U)
+#define XFSBL_ZDMA_SPLIT_ALIGN (64U)
+/* Write only transfers are 128 bit wide */
+#define XFSBL_ZDMA_FILL_ALIGN (16U)
+
+/*
+ * Timeout of XFsbl_ZDmaWait in us, with one more us for every
+ * XFSBL_ZDMA_TIMEOUT_BYTES_PER_US bytes of the request
+ */
+#define XFSBL_ZDMA_TIMEOUT (5000000U)
+#define XFSBL_ZDMA_TIMEOUT_BYTES_PER_US (64U)
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Handle of a ZDMA request. It is owned by the caller and must stay valid
+ * until the request is done.
+ */
+typedef struct {
+  u32 ChannelMask; /**< Channels still working on the request */
+  u32 State;       /**< XFSBL_DEVICE_REQUEST_PENDING or DONE */
+  u32 Status;      /**< Completion status once the request is done */
+  u32 TimeOutUs;   /**< Timeout of XFsbl_ZDmaWait */
+} XFsblPs_ZDmaRequest;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+u32 XFsbl_ZDmaCopySubmit(XFsblPs_ZDmaRequest* Request, u64 DestAddr,
+                         u64 SrcAddr, u64 Length);
+u32 XFsbl_ZDmaFillSubmit(XFsblPs_ZDmaRequest* Request, u64 DestAddr,
+                         u32 Pattern, u64 Length);
+u32 XFsbl_ZDmaFillSubmitChannels(XFsblPs_ZDmaRequest* Request, u64 DestAddr,
+                                 u32 Pattern, u64 Length, u32 MaxChannels);
+u32 XFsbl_ZDmaPoll(XFsblPs_ZDmaRequest* Request);
+void XFsbl_ZDmaAbort(XFsblPs_ZDmaRequest* Request, u32 Status);
+u32 XFsbl_ZDmaWait(XFsblPs_ZDmaRequest* Request);
+u32 XFsbl_ZDmaCopy(u64 DestAddr, u64 SrcAddr, u64 Length);
+u32 XFsbl_ZDmaFill(u64 DestAddr, u32 Pattern, u64 Length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFSBL_ZDMA_H */
@@ -0,0 +1,16 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ * Host replacement of the BSP sleep.h for psu_table_trace: the delays of
+ * psu_init.c and of the table interpreter are recorded.
+ */
+#ifndef PSU_TRACE_SLEEP_H
+#define PSU_TRACE_SLEEP_H
+
+#define usleep psu_trace_usleep
+
+int psu_trace_usleep(unsigned long useconds);
+
+#endif /* PSU_TRACE_SLEEP_H */
@@ -0,0 +1,29 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ * Host replacement of the BSP xil_io.h for psu_table_trace: the register
+ * accesses of psu_init.c and of the table interpreter are recorded.
+ */
+#ifndef PSU_TRACE_XIL_IO_H
+#define PSU_TRACE_XIL_IO_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int32_t s32;
+typedef intptr_t INTPTR;
+typedef uintptr_t UINTPTR;
+
+u32 Xil_In32(UINTPTR Addr);
+void Xil_Out32(UINTPTR Addr, u32 Value);
+
+/* The BSP xil_io.h includes xil_printf.h */
+#define xil_printf(...) fprintf(stderr, __VA_ARGS__)
+
+#endif /* PSU_TRACE_XIL_IO_H */
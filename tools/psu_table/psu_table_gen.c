@@ -0,0 +1,1082 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file psu_table_gen.c
+ *
+ * Host side generator of the psu_init register tables, see
+ * src/generated/psu_table.h.
+ *
+ *   psu_table_gen [-n] <generated dir>
+ *     Reads psu_init.h and psu_init.c and converts every psu_init function
+ *     that only writes registers, polls them and waits into a table, in
+ *     psu_init_table.c and psu_init_table.h. Calls to other functions are
+ *     kept as C calls between two tables. psu_init.c is rewritten so that
+ *     the converted functions run their tables under PSU_INIT_TABLE, with
+ *     their generated code kept under #else, and so are the static helpers
+ *     only the converted functions used. Run it again after psu_init.c is
+ *     exported again; a rewritten psu_init.c is read back as it was
+ *     generated.
+ *
+ *     The writes of a table are coalesced unless -n is given: a masked
+ *     write is merged into an earlier write of the same register when
+ *     only writes to the same peripheral are between them and no field
+ *     they both write changes value, which would be a pulse, and a write
+ *     whose masks cover the whole register does not read it. The MMIO
+ *     transactions saved are reported for every function.
+ *
+ * tools/psu_table/psu_table_trace checks that the tables make the register
+ * writes of the generated code.
+ *
+ ******************************************************************************/
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "psu_table.h"
+
+#define TABLE_GUARD "#ifdef PSU_INIT_TABLE"
+#define HELPER_GUARD "#ifndef PSU_INIT_TABLE"
+#define TABLE_INCLUDE "#include \"psu_init_table.h\""
+#define MAX_SEGMENTS 8U
+#define MAX_DEPTH 32U
+
+/* Register block of an address, writes are only moved within one */
+#define PERIPHERAL(Addr) ((Addr) >> 16)
+
+struct lines {
+  char **line;
+  size_t count;
+};
+
+struct define {
+  char *name;
+  char *text;
+};
+
+enum op_kind { OP_MASK_WRITE, OP_WRITE, OP_POLL, OP_POLL_VALUE, OP_DELAY };
+
+struct op {
+  enum op_kind kind;
+  uint32_t addr;
+  uint32_t mask;
+  uint32_t value;
+  uint32_t count;
+};
+
+struct segment {
+  struct op *op;
+  size_t ops;
+  char *call; /* C statement after the table, NULL for the last one */
+};
+
+struct function {
+  char *name;
+  int converted;
+  size_t open;  /* line of the opening brace */
+  size_t close; /* line of the closing brace */
+  size_t first; /* lines of the generated body */
+  size_t last;
+  struct segment segment[MAX_SEGMENTS];
+  size_t segments;
+  size_t ops;
+};
+
+struct helper {
+  char *name;
+  size_t proto; /* prototype line, 0 if none */
+  size_t first; /* definition lines */
+  size_t last;
+  int guarded;
+};
+
+static struct define *defines;
+static size_t define_size;
+static int optimize = 1;
+
+static void *xmalloc(size_t size) {
+  void *p = calloc(1U, size);
+
+  if (p == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  return p;
+}
+
+static char *xstrndup(const char *s, size_t len) {
+  char *p = xmalloc(len + 1U);
+
+  memcpy(p, s, len);
+  return p;
+}
+
+static void read_lines(const char *name, struct lines *lines) {
+  FILE *f = fopen(name, "r");
+  size_t size = 1024U;
+  char buf[4096];
+
+  if (f == NULL) {
+    perror(name);
+    exit(1);
+  }
+  lines->line = xmalloc(size * sizeof(char *));
+  lines->count = 0U;
+  while (fgets(buf, sizeof(buf), f) != NULL) {
+    size_t len = strlen(buf);
+
+    if (len > 0U && buf[len - 1U] != '\n' && !feof(f)) {
+      fprintf(stderr, "%s:%zu: line too long\n", name, lines->count + 1U);
+      exit(1);
+    }
+    while (len > 0U && (buf[len - 1U] == '\n' || buf[len - 1U] == '\r')) {
+      len--;
+    }
+    if (lines->count == size) {
+      size *= 2U;
+      lines->line = realloc(lines->line, size * sizeof(char *));
+      if (lines->line == NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+      }
+    }
+    lines->line[lines->count++] = xstrndup(buf, len);
+  }
+  fclose(f);
+}
+
+/* Same lines without the comments */
+static void strip_comments(const struct lines *in, struct lines *out) {
+  int comment = 0;
+
+  out->count = in->count;
+  out->line = xmalloc(in->count * sizeof(char *));
+  for (size_t i = 0U; i < in->count; i++) {
+    const char *s = in->line[i];
+    char *d = xstrndup(s, strlen(s));
+    size_t n = 0U;
+
+    for (size_t j = 0U; s[j] != '\0'; j++) {
+      if (comment) {
+        if (s[j] == '*' && s[j + 1U] == '/') {
+          comment = 0;
+          j++;
+        }
+      } else if (s[j] == '/' && s[j + 1U] == '*') {
+        comment = 1;
+        j++;
+      } else if (s[j] == '/' && s[j + 1U] == '/') {
+        break;
+      } else {
+        d[n++] = s[j];
+      }
+    }
+    d[n] = '\0';
+    out->line[i] = d;
+  }
+}
+
+static const char *skip_space(const char *s) {
+  while (isspace((unsigned char)*s)) {
+    s++;
+  }
+  return s;
+}
+
+static size_t ident_len(const char *s) {
+  size_t n = 0U;
+
+  while (isalnum((unsigned char)s[n]) || s[n] == '_') {
+    n++;
+  }
+  return n;
+}
+
+static uint32_t name_hash(const char *s, size_t len) {
+  uint32_t h = 2166136261U;
+
+  for (size_t i = 0U; i < len; i++) {
+    h = (h ^ (uint8_t)s[i]) * 16777619U;
+  }
+  return h;
+}
+
+static struct define *find_define(const char *name, size_t len, int add) {
+  size_t i = name_hash(name, len) & (define_size - 1U);
+
+  while (defines[i].name != NULL) {
+    if (strlen(defines[i].name) == len &&
+        memcmp(defines[i].name, name, len) == 0) {
+      return &defines[i];
+    }
+    i = (i + 1U) & (define_size - 1U);
+  }
+  if (!add) {
+    return NULL;
+  }
+  defines[i].name = xstrndup(name, len);
+  return &defines[i];
+}
+
+/* #define or #undef of a line without comments */
+static void preprocess(const char *line) {
+  const char *s = skip_space(line);
+  struct define *d;
+  size_t len;
+
+  if (*s != '#') {
+    return;
+  }
+  s = skip_space(s + 1);
+  if (strncmp(s, "define", 6U) == 0 && isspace((unsigned char)s[6])) {
+    s = skip_space(s + 6);
+    len = ident_len(s);
+    if (len == 0U || s[len] == '(') {
+      return;
+    }
+    d = find_define(s, len, 1);
+    free(d->text);
+    s = skip_space(s + len);
+    d->text = xstrndup(s, strlen(s));
+  } else if (strncmp(s, "undef", 5U) == 0 && isspace((unsigned char)s[5])) {
+    s = skip_space(s + 5);
+    d = find_define(s, ident_len(s), 0);
+    if (d != NULL) {
+      free(d->text);
+      d->text = NULL;
+    }
+  }
+}
+
+/* Constant expression evaluator, sets *ok to 0 on what it cannot evaluate */
+static uint64_t eval_or(const char **s, int *ok, unsigned depth);
+
+static uint64_t eval_primary(const char **s, int *ok, unsigned depth) {
+  const char *p = skip_space(*s);
+  uint64_t v = 0U;
+  size_t len;
+
+  if (*p == '(') {
+    p++;
+    v = eval_or(&p, ok, depth);
+    p = skip_space(p);
+    if (*p != ')') {
+      *ok = 0;
+    } else {
+      p++;
+    }
+  } else if (isdigit((unsigned char)*p)) {
+    char *end;
+
+    v = strtoull(p, &end, 0);
+    p = end;
+    while (*p == 'U' || *p == 'u' || *p == 'L' || *p == 'l') {
+      p++;
+    }
+  } else if ((len = ident_len(p)) != 0U) {
+    const struct define *d = find_define(p, len, 0);
+
+    if (d == NULL || d->text == NULL || depth >= MAX_DEPTH) {
+      *ok = 0;
+    } else {
+      const char *t = d->text;
+
+      v = eval_or(&t, ok, depth + 1U);
+      if (*skip_space(t) != '\0') {
+        *ok = 0;
+      }
+    }
+    p += len;
+  } else {
+    *ok = 0;
+  }
+  *s = p;
+  return v;
+}
+
+static uint64_t eval_unary(const char **s, int *ok, unsigned depth) {
+  const char *p = skip_space(*s);
+  uint64_t v;
+
+  if (*p == '~' || *p == '-' || *p == '+') {
+    char c = *p++;
+
+    v = eval_unary(&p, ok, depth);
+    v = (c == '~') ? ~v : (c == '-') ? (uint64_t)0U - v : v;
+    *s = p;
+    return v;
+  }
+  return eval_primary(s, ok, depth);
+}
+
+static uint64_t eval_binary(const char **s, int *ok, unsigned depth,
+                            unsigned level) {
+  static const char *const ops[][3] = {
+      {"|", NULL, NULL}, {"^", NULL, NULL}, {"&", NULL, NULL},
+      {"<<", ">>", NULL}, {"+", "-", NULL}, {"*", NULL, NULL}};
+  uint64_t v;
+
+  if (level == sizeof(ops) / sizeof(ops[0])) {
+    return eval_unary(s, ok, depth);
+  }
+  v = eval_binary(s, ok, depth, level + 1U);
+  while (*ok) {
+    const char *p = skip_space(*s);
+    const char *op = NULL;
+    uint64_t r;
+
+    for (size_t i = 0U; i < 2U && ops[level][i] != NULL; i++) {
+      size_t n = strlen(ops[level][i]);
+
+      /* | and & are not || and && */
+      if (strncmp(p, ops[level][i], n) == 0 && p[n] != p[0]) {
+        op = ops[level][i];
+      }
+    }
+    if (op == NULL) {
+      break;
+    }
+    p += strlen(op);
+    r = eval_binary(&p, ok, depth, level + 1U);
+    *s = p;
+    switch (op[0]) {
+      case '|': v |= r; break;
+      case '^': v ^= r; break;
+      case '&': v &= r; break;
+      case '<': v <<= r; break;
+      case '>': v >>= r; break;
+      case '+': v += r; break;
+      case '-': v -= r; break;
+      default: v *= r; break;
+    }
+  }
+  return v;
+}
+
+static uint64_t eval_or(const char **s, int *ok, unsigned depth) {
+  return eval_binary(s, ok, depth, 0U);
+}
+
+static int eval(const char *s, uint32_t *value) {
+  int ok = 1;
+  uint64_t v = eval_or(&s, &ok, 0U);
+
+  if (!ok || *skip_space(s) != '\0') {
+    return 0;
+  }
+  *value = (uint32_t)v;
+  return 1;
+}
+
+/* Splits "name(a, b)" into name and arguments, returns the count or -1 */
+static int split_call(char *stmt, char **name, char **args, int max) {
+  char *p = (char *)skip_space(stmt);
+  size_t len = ident_len(p);
+  int count = 0;
+  int depth = 0;
+  char *end;
+
+  if (len == 0U) {
+    return -1;
+  }
+  *name = p;
+  p = (char *)skip_space(p + len);
+  if (*p != '(') {
+    return -1;
+  }
+  (*name)[len] = '\0';
+  p++;
+  end = p + strlen(p);
+  while (end > p && isspace((unsigned char)end[-1])) {
+    end--;
+  }
+  if (end == p || end[-1] != ')') {
+    return -1;
+  }
+  end[-1] = '\0';
+  if (*skip_space(p) == '\0') {
+    return 0;
+  }
+  args[count++] = p;
+  for (; *p != '\0'; p++) {
+    if (*p == '(') {
+      depth++;
+    } else if (*p == ')') {
+      depth--;
+    } else if (*p == ',' && depth == 0) {
+      if (count == max) {
+        return -1;
+      }
+      *p = '\0';
+      args[count++] = p + 1;
+    }
+  }
+  return count;
+}
+
+static void add_op(struct segment *seg, const struct op *op) {
+  if ((seg->ops & (seg->ops - 1U)) == 0U) {
+    struct op *grown = realloc(seg->op, (seg->ops ? seg->ops * 2U : 16U) *
+                                            sizeof(*grown));
+
+    if (grown == NULL) {
+      fprintf(stderr, "out of memory\n");
+      exit(1);
+    }
+    seg->op = grown;
+  }
+  seg->op[seg->ops++] = *op;
+}
+
+/* Converts a statement of a function, returns 0 if it cannot be */
+static int convert(struct function *fn, const char *stmt, int *returned) {
+  char *copy = xstrndup(stmt, strlen(stmt));
+  struct segment *seg = &fn->segment[fn->segments - 1U];
+  char *name, *args[8];
+  uint32_t v[8];
+  struct op op;
+  int argc;
+  const char *s = skip_space(copy);
+
+  memset(&op, 0, sizeof(op));
+  if (strncmp(s, "return", 6U) == 0 && !isalnum((unsigned char)s[6]) &&
+      eval(s + 6, &v[0]) && v[0] == 1U) {
+    *returned = 1;
+    free(copy);
+    return 1;
+  }
+
+  argc = split_call(copy, &name, args, 8);
+  if (argc < 0) {
+    free(copy);
+    return 0;
+  }
+  for (int i = 0; i < argc; i++) {
+    if (!eval(args[i], &v[i])) {
+      free(copy);
+      return 0;
+    }
+  }
+
+  if (strcmp(name, "PSU_Mask_Write") == 0 && argc == 3) {
+    op.kind = OP_MASK_WRITE;
+    op.addr = v[0];
+    op.mask = v[1];
+    op.value = v[2] & v[1];
+  } else if (strcmp(name, "prog_reg") == 0 && argc == 4) {
+    /* prog_reg() does not mask the value, the mask covers it instead */
+    op.kind = OP_MASK_WRITE;
+    op.addr = v[0];
+    op.value = v[3] << v[2];
+    op.mask = v[1] | op.value;
+  } else if (strcmp(name, "Xil_Out32") == 0 && argc == 2) {
+    op.kind = OP_WRITE;
+    op.addr = v[0];
+    op.value = v[1];
+  } else if (strcmp(name, "mask_poll") == 0 && argc == 2) {
+    op.kind = OP_POLL;
+    op.addr = v[0];
+    op.mask = v[1];
+  } else if (strcmp(name, "mask_pollOnValue") == 0 && argc == 3) {
+    op.kind = OP_POLL_VALUE;
+    op.addr = v[0];
+    op.mask = v[1];
+    op.value = v[2];
+  } else if (strcmp(name, "mask_delay") == 0 && argc == 1) {
+    op.kind = OP_DELAY;
+    op.count = v[0];
+  } else if (fn->segments < MAX_SEGMENTS) {
+    /* Another function, called between two tables */
+    seg->call = xstrndup(skip_space(stmt), strlen(skip_space(stmt)));
+    fn->segments++;
+    free(copy);
+    return 1;
+  } else {
+    free(copy);
+    return 0;
+  }
+
+  if ((op.addr & 3U) != 0U && op.kind != OP_DELAY) {
+    free(copy);
+    return 0;
+  }
+  add_op(seg, &op);
+  fn->ops++;
+  free(copy);
+  return 1;
+}
+
+/* Converts the generated body of a function, returns 0 if it cannot be */
+static int convert_body(struct function *fn, const struct lines *code) {
+  size_t size = 1U, len = 0U;
+  char *body, *stmt;
+  int depth = 0, returned = 0;
+
+  for (size_t i = fn->first; i < fn->last; i++) {
+    const char *s = skip_space(code->line[i]);
+
+    if (*s == '#' || strchr(s, '{') != NULL || strchr(s, '}') != NULL) {
+      return 0;
+    }
+    size += strlen(code->line[i]) + 1U;
+  }
+  body = xmalloc(size);
+  for (size_t i = fn->first; i < fn->last; i++) {
+    len += (size_t)sprintf(body + len, "%s ", code->line[i]);
+  }
+
+  fn->segments = 1U;
+  stmt = body;
+  for (char *p = body; *p != '\0'; p++) {
+    if (*p == '(') {
+      depth++;
+    } else if (*p == ')') {
+      depth--;
+    } else if (*p == ';' && depth == 0) {
+      *p = '\0';
+      if (returned || !convert(fn, stmt, &returned)) {
+        free(body);
+        return 0;
+      }
+      stmt = p + 1;
+    }
+  }
+  returned = returned && *skip_space(stmt) == '\0';
+  free(body);
+  return returned && fn->ops > 0U;
+}
+
+static int is_write(const struct op *op) {
+  return op->kind == OP_MASK_WRITE || op->kind == OP_WRITE;
+}
+
+static uint32_t write_mask(const struct op *op) {
+  return op->kind == OP_WRITE ? 0xFFFFFFFFU : op->mask;
+}
+
+/* MMIO transactions of a table, polls counted as one read */
+static size_t transactions(const struct segment *seg) {
+  size_t n = 0U;
+
+  for (size_t i = 0U; i < seg->ops; i++) {
+    n += (seg->op[i].kind == OP_MASK_WRITE) ? 2U
+         : (seg->op[i].kind == OP_DELAY)    ? 0U
+                                            : 1U;
+  }
+  return n;
+}
+
+/* Coalesces the writes of the tables of a function */
+static void coalesce(struct function *fn) {
+  size_t before = 0U, after = 0U, merged = 0U;
+
+  for (size_t s = 0U; s < fn->segments; s++) {
+    struct segment *seg = &fn->segment[s];
+
+    before += transactions(seg);
+    for (size_t i = 0U; i < seg->ops; i++) {
+      struct op *a = &seg->op[i];
+
+      if (!is_write(a)) {
+        continue;
+      }
+      for (size_t j = i + 1U; j < seg->ops; j++) {
+        struct op *b = &seg->op[j];
+        uint32_t ma = write_mask(a), mb = write_mask(b);
+
+        if (!is_write(b) || PERIPHERAL(b->addr) != PERIPHERAL(a->addr)) {
+          break;
+        }
+        if (b->addr != a->addr) {
+          continue;
+        }
+        if (((a->value ^ b->value) & ma & mb) != 0U) {
+          break;
+        }
+        a->value = (a->value & ~mb) | (b->value & mb);
+        a->mask = ma | mb;
+        a->kind = OP_MASK_WRITE;
+        memmove(b, b + 1, (seg->ops - j - 1U) * sizeof(*b));
+        seg->ops--;
+        fn->ops--;
+        merged++;
+        j--;
+      }
+      if (a->kind == OP_MASK_WRITE && a->mask == 0xFFFFFFFFU) {
+        a->kind = OP_WRITE;
+      }
+    }
+    after += transactions(seg);
+  }
+
+  if (before != after) {
+    fprintf(stderr,
+            "psu_table_gen: %s: %zu writes merged, %zu MMIO transactions "
+            "of %zu saved\n",
+            fn->name, merged, before - after, before);
+  }
+}
+
+static size_t put_number(uint8_t *out, uint32_t v) {
+  size_t n = 0U;
+
+  do {
+    out[n] = (uint8_t)(v & 0x7FU);
+    v >>= 7;
+    if (v != 0U) {
+      out[n] |= 0x80U;
+    }
+    n++;
+  } while (v != 0U);
+  return n;
+}
+
+/* Table of a segment, returns its length */
+static size_t encode(const struct segment *seg, uint8_t *out) {
+  uint32_t addr = 0U;
+  size_t n = 0U;
+
+  for (size_t i = 0U; i < seg->ops; i++) {
+    const struct op *op = &seg->op[i];
+    static const uint32_t kinds[] = {PSU_TABLE_MASK_WRITE, PSU_TABLE_WRITE,
+                                     PSU_TABLE_POLL, PSU_TABLE_POLL_VALUE,
+                                     PSU_TABLE_DELAY};
+    int has_mask = op->kind != OP_WRITE && op->kind != OP_DELAY;
+    int has_value = op->kind != OP_POLL && op->kind != OP_DELAY;
+    uint32_t mode = PSU_TABLE_ADDR_ABS, flags = 0U, zigzag = 0U;
+    uint8_t tmp[8];
+    int32_t delta = (int32_t)(op->addr - addr) / 4;
+    size_t at = n++;
+
+    if (op->kind == OP_DELAY) {
+      mode = 0U;
+    } else if (op->addr == addr + 4U) {
+      mode = PSU_TABLE_ADDR_NEXT;
+    } else if (op->addr == addr) {
+      mode = PSU_TABLE_ADDR_SAME;
+    } else {
+      zigzag = delta >= 0 ? (uint32_t)delta * 2U
+                          : (uint32_t)(-(delta + 1)) * 2U + 1U;
+      if (put_number(tmp, zigzag) < 4U) {
+        mode = PSU_TABLE_ADDR_DELTA;
+      }
+    }
+    if (has_mask && op->mask == 0xFFFFFFFFU) {
+      flags |= PSU_TABLE_MASK_ALL;
+    }
+    if (has_mask && has_value && op->value == op->mask) {
+      flags |= PSU_TABLE_VALUE_MASK;
+    }
+    out[at] = (uint8_t)PSU_TABLE_OP_BYTE(kinds[op->kind], mode, flags);
+
+    if (mode == PSU_TABLE_ADDR_DELTA) {
+      n += put_number(out + n, zigzag);
+    } else if (mode == PSU_TABLE_ADDR_ABS && op->kind != OP_DELAY) {
+      for (unsigned b = 0U; b < 4U; b++) {
+        out[n++] = (uint8_t)(op->addr >> (8U * b));
+      }
+    }
+    if (op->kind != OP_DELAY) {
+      addr = op->addr;
+    }
+    if (has_mask && (flags & PSU_TABLE_MASK_ALL) == 0U) {
+      n += put_number(out + n, op->mask);
+    }
+    if (has_value && (flags & PSU_TABLE_VALUE_MASK) == 0U) {
+      n += put_number(out + n, op->value);
+    }
+    if (op->kind == OP_DELAY) {
+      n += put_number(out + n, op->count);
+    }
+  }
+  out[n++] = PSU_TABLE_END;
+  return n;
+}
+
+static void table_name(char *buf, size_t size, const struct function *fn,
+                       size_t segment) {
+  if (segment == 0U) {
+    snprintf(buf, size, "%s_table", fn->name);
+  } else {
+    snprintf(buf, size, "%s_table%zu", fn->name, segment);
+  }
+}
+
+static FILE *create(const char *dir, const char *name, char *path,
+                    size_t size) {
+  FILE *f;
+
+  snprintf(path, size, "%s/%s", dir, name);
+  f = fopen(path, "w");
+  if (f == NULL) {
+    perror(path);
+    exit(1);
+  }
+  return f;
+}
+
+static const char file_header[] =
+    "/******************************************************************"
+    "************\n"
+    "* SPDX-License-Identifier: MIT\n"
+    "*******************************************************************"
+    "***********/\n"
+    "\n"
+    "/******************************************************************"
+    "**********/\n"
+    "/**\n"
+    "*\n"
+    "* @file %s\n"
+    "*\n"
+    "* This file is automatically generated by tools/psu_table/psu_table_gen\n"
+    "* from psu_init.c, see psu_table.h\n"
+    "*\n"
+    "*******************************************************************"
+    "**********/\n"
+    "\n";
+
+static void write_tables(const char *dir, struct function *fn, size_t count) {
+  char path[4096], name[256];
+  FILE *c = create(dir, "psu_init_table.c", path, sizeof(path));
+  FILE *h = create(dir, "psu_init_table.h", path, sizeof(path));
+  uint8_t *out;
+  size_t total = 0U, ops = 0U, functions = 0U;
+
+  fprintf(h, file_header, "psu_init_table.h");
+  fprintf(h, "#ifndef PSU_INIT_TABLE_H\n#define PSU_INIT_TABLE_H\n\n");
+  fprintf(h, "#include \"psu_table.h\"\n\n");
+  fprintf(c, file_header, "psu_init_table.c");
+  fprintf(c, "#include \"psu_init_table.h\"\n");
+
+  for (size_t i = 0U; i < count; i++) {
+    if (!fn[i].converted) {
+      continue;
+    }
+    functions++;
+    for (size_t s = 0U; s < fn[i].segments; s++) {
+      const struct segment *seg = &fn[i].segment[s];
+      size_t len;
+
+      if (seg->ops == 0U) {
+        continue;
+      }
+      out = xmalloc(seg->ops * 16U + 1U);
+      len = encode(seg, out);
+      table_name(name, sizeof(name), &fn[i], s);
+      fprintf(h, "extern const unsigned char %s[];\n", name);
+      fprintf(c, "\n/* %s: %zu ops */\nconst unsigned char %s[] = {",
+              fn[i].name, seg->ops, name);
+      for (size_t b = 0U; b < len; b++) {
+        fprintf(c, "%s0x%02X%s", (b % 12U) == 0U ? "\n\t" : "", out[b],
+                (b + 1U < len) ? ((b % 12U) == 11U ? "," : ", ") : "");
+      }
+      fprintf(c, "\n};\n");
+      total += len;
+      ops += seg->ops;
+      free(out);
+    }
+  }
+
+  fprintf(h, "\n#endif /* PSU_INIT_TABLE_H */\n");
+  fclose(c);
+  fclose(h);
+  fprintf(stderr, "psu_table_gen: %zu functions, %zu ops in %zu bytes\n",
+          functions, ops, total);
+}
+
+/* Counts the uses of a name in lines [first, last) */
+static size_t uses(const struct lines *code, size_t first, size_t last,
+                   const char *name) {
+  size_t len = strlen(name), count = 0U;
+
+  for (size_t i = first; i < last; i++) {
+    for (const char *p = strstr(code->line[i], name); p != NULL;
+         p = strstr(p + len, name)) {
+      if ((p == code->line[i] || (!isalnum((unsigned char)p[-1]) &&
+                                  p[-1] != '_')) &&
+          ident_len(p) == len) {
+        count++;
+      }
+    }
+  }
+  return count;
+}
+
+/* Finds the static functions of psu_init.c */
+static size_t find_helpers(const struct lines *code, struct helper *helper,
+                           size_t max) {
+  size_t count = 0U;
+
+  for (size_t i = 0U; i < code->count && count < max; i++) {
+    const char *s = code->line[i];
+    const char *p;
+    size_t len;
+    struct helper *h = NULL;
+
+    if (strncmp(s, "static", 6U) != 0 || (p = strchr(s, '(')) == NULL) {
+      /* "static" alone on the line of the PSU_Mask_Write() definition */
+      if (strcmp(skip_space(s), "static") != 0 || i + 1U == code->count ||
+          (p = strchr(code->line[i + 1U], '(')) == NULL) {
+        continue;
+      }
+      s = code->line[++i];
+    }
+    while (p > s && isspace((unsigned char)p[-1])) {
+      p--;
+    }
+    for (len = 0U; p > s && (isalnum((unsigned char)p[-1]) || p[-1] == '_');
+         len++) {
+      p--;
+    }
+    for (size_t j = 0U; j < count; j++) {
+      if (strlen(helper[j].name) == len &&
+          strncmp(helper[j].name, p, len) == 0) {
+        h = &helper[j];
+      }
+    }
+    if (h == NULL) {
+      h = &helper[count++];
+      memset(h, 0, sizeof(*h));
+      h->name = xstrndup(p, len);
+    }
+    if (strchr(s, ';') != NULL) {
+      h->proto = i;
+      continue;
+    }
+    /* Definition, up to its closing brace */
+    h->first = (strcmp(skip_space(code->line[i - 1U]), "static") == 0)
+                   ? i - 1U
+                   : i;
+    for (int depth = 0, open = 0; i < code->count; i++) {
+      for (const char *c = code->line[i]; *c != '\0'; c++) {
+        depth += (*c == '{') - (*c == '}');
+        open |= (*c == '{');
+      }
+      if (open && depth == 0) {
+        break;
+      }
+    }
+    h->last = i + 1U;
+    h->guarded = h->first > 0U &&
+                 strcmp(skip_space(code->line[h->first - 1U]),
+                        HELPER_GUARD) == 0;
+  }
+  return count;
+}
+
+static void put_line(FILE *f, const char *line) { fprintf(f, "%s\n", line); }
+
+static void rewrite(const char *path, const struct lines *lines,
+                    const struct lines *code, struct function *fn,
+                    size_t count) {
+  struct helper helper[64];
+  size_t helpers = find_helpers(code, helper, 64U);
+  char tmp[4096 + 8], name[256];
+  FILE *f;
+  size_t next = 0U;
+  int included = 0;
+
+  /* Helpers only used by the converted functions */
+  for (size_t i = 0U; i < helpers; i++) {
+    size_t all = uses(code, 0U, code->count, helper[i].name);
+    size_t own = uses(code, helper[i].first, helper[i].last, helper[i].name) +
+                 (helper[i].proto ? 1U : 0U);
+    size_t converted = 0U;
+
+    for (size_t j = 0U; j < count; j++) {
+      if (fn[j].converted) {
+        converted += uses(code, fn[j].first, fn[j].last, helper[i].name);
+      }
+      /* The calls kept between the tables still use it */
+      for (size_t s = 0U; s < fn[j].segments; s++) {
+        if (fn[j].converted && fn[j].segment[s].call != NULL) {
+          struct lines call = {&fn[j].segment[s].call, 1U};
+
+          converted -= uses(&call, 0U, 1U, helper[i].name);
+        }
+      }
+    }
+    helper[i].guarded = all > own && all - own == converted;
+  }
+
+  snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+  f = fopen(tmp, "w");
+  if (f == NULL) {
+    perror(tmp);
+    exit(1);
+  }
+  for (size_t i = 0U; i < lines->count; i++) {
+    const char *s = skip_space(code->line[i]);
+
+    /* What a previous run added is added again where still needed */
+    if (strcmp(s, TABLE_INCLUDE) == 0 || strcmp(s, HELPER_GUARD) == 0 ||
+        (strncmp(s, "#endif", 6U) == 0 &&
+         strstr(lines->line[i], "PSU_INIT_TABLE") != NULL)) {
+      continue;
+    }
+
+    for (size_t h = 0U; h < helpers; h++) {
+      if (helper[h].guarded &&
+          (i == helper[h].proto || i == helper[h].first)) {
+        put_line(f, HELPER_GUARD);
+      }
+    }
+
+    if (next < count && i == fn[next].open && !fn[next].converted) {
+      put_line(f, lines->line[i]);
+      for (size_t j = fn[next].first; j < fn[next].last; j++) {
+        put_line(f, lines->line[j]);
+      }
+      i = fn[next].close - 1U;
+      next++;
+      continue;
+    }
+    if (next < count && i == fn[next].open) {
+      put_line(f, lines->line[i]);
+      put_line(f, TABLE_GUARD);
+      for (size_t sgm = 0U; sgm < fn[next].segments; sgm++) {
+        const struct segment *seg = &fn[next].segment[sgm];
+        int last = sgm + 1U == fn[next].segments;
+
+        table_name(name, sizeof(name), &fn[next], sgm);
+        if (seg->ops != 0U) {
+          fprintf(f, "\t%spsu_table_run(%s);\n", last ? "return " : "", name);
+        } else if (last) {
+          fprintf(f, "\treturn 1;\n");
+        }
+        if (seg->call != NULL) {
+          fprintf(f, "\t%s;\n", seg->call);
+        }
+      }
+      put_line(f, "#else");
+      for (size_t j = fn[next].first; j < fn[next].last; j++) {
+        put_line(f, lines->line[j]);
+      }
+      fprintf(f, "#endif /* PSU_INIT_TABLE */\n");
+      i = fn[next].close - 1U;
+      next++;
+      continue;
+    }
+
+    put_line(f, lines->line[i]);
+    if (!included && strcmp(s, "#include \"psu_init.h\"") == 0) {
+      put_line(f, TABLE_INCLUDE);
+      included = 1;
+    }
+    for (size_t h = 0U; h < helpers; h++) {
+      if (helper[h].guarded &&
+          (i == helper[h].proto || i + 1U == helper[h].last)) {
+        fprintf(f, "#endif /* PSU_INIT_TABLE */\n");
+      }
+    }
+  }
+  fclose(f);
+  if (rename(tmp, path) != 0) {
+    perror(path);
+    exit(1);
+  }
+}
+
+/* Generated body of a function, from a rewritten one */
+static void find_body(struct function *fn, const struct lines *code) {
+  fn->first = fn->open + 1U;
+  fn->last = fn->close;
+  if (fn->first < fn->last &&
+      strcmp(skip_space(code->line[fn->first]), TABLE_GUARD) == 0) {
+    while (fn->first < fn->last &&
+           strcmp(skip_space(code->line[fn->first]), "#else") != 0) {
+      fn->first++;
+    }
+    fn->first++;
+    while (fn->last > fn->first &&
+           strncmp(skip_space(code->line[fn->last - 1U]), "#endif", 6U) !=
+               0) {
+      fn->last--;
+    }
+    fn->last--;
+  }
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: psu_table_gen [-n] <generated dir>\n");
+  exit(2);
+}
+
+int main(int argc, char **argv) {
+  struct lines header, header_code, lines, code;
+  struct function *fn;
+  char path[4096];
+  size_t count = 0U;
+
+  if (argc == 3 && strcmp(argv[1], "-n") == 0) {
+    optimize = 0;
+    argc--;
+    argv++;
+  }
+  if (argc != 2) {
+    usage();
+  }
+
+  snprintf(path, sizeof(path), "%s/psu_init.h", argv[1]);
+  read_lines(path, &header);
+  strip_comments(&header, &header_code);
+  snprintf(path, sizeof(path), "%s/psu_init.c", argv[1]);
+  read_lines(path, &lines);
+  strip_comments(&lines, &code);
+
+  for (define_size = 1024U; define_size < 2U * (header.count + lines.count);
+       define_size *= 2U) {
+  }
+  defines = xmalloc(define_size * sizeof(*defines));
+  for (size_t i = 0U; i < header_code.count; i++) {
+    preprocess(header_code.line[i]);
+  }
+
+  fn = xmalloc(lines.count * sizeof(*fn));
+  for (size_t i = 0U; i < code.count; i++) {
+    const char *s = code.line[i];
+    size_t len;
+
+    preprocess(s);
+    if (strncmp(s, "unsigned long ", 14U) != 0 || i + 1U == code.count ||
+        strcmp(skip_space(code.line[i + 1U]), "{") != 0) {
+      continue;
+    }
+    len = ident_len(s + 14);
+    if (strcmp(skip_space(s + 14 + len), "(void)") != 0) {
+      continue;
+    }
+
+    memset(&fn[count], 0, sizeof(fn[count]));
+    fn[count].name = xstrndup(s + 14, len);
+    fn[count].open = i + 1U;
+    for (size_t j = i + 2U; j < code.count; j++) {
+      if (strcmp(code.line[j], "}") == 0) {
+        fn[count].close = j;
+        break;
+      }
+    }
+    if (fn[count].close == 0U) {
+      fprintf(stderr, "%s:%zu: no end of %s\n", path, i + 1U,
+              fn[count].name);
+      return 1;
+    }
+    find_body(&fn[count], &code);
+    fn[count].converted = convert_body(&fn[count], &code);
+    if (!fn[count].converted) {
+      fprintf(stderr, "psu_table_gen: %s kept as C\n", fn[count].name);
+    } else if (optimize) {
+      coalesce(&fn[count]);
+    }
+    count++;
+  }
+
+  write_tables(argv[1], fn, count);
+  rewrite(path, &lines, &code, fn, count);
+  return 0;
+}
@@ -0,0 +1,161 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file psu_table_trace.c
+ *
+ * Host side register trace of psu_init.c, built once with the generated
+ * functions and once with the tables of psu_table_gen.
+ *
+ *   psu_table_trace [-w] [seed]
+ *     Maps the PS register space at its physical address, fills it with a
+ *     pseudo random pattern of the seed, runs the psu_init entry points the
+ *     FSBL calls and psu_ddr_init_data(), and prints every register write,
+ *     poll and delay in order. The register space keeps the values
+ *     written, so read-modify-writes and polls see the same registers in
+ *     both builds, a poll checks its register once. Seed 0 leaves the
+ *     registers 0.
+ *
+ *     With -w, the writes between two delays or entry points are
+ *     printed as the last value of each register, sorted by address, and
+ *     the polls are not printed, which is what the coalescing of
+ *     psu_table_gen preserves.
+ *
+ * "make check-exact" compares the traces of the generated psu_init() built
+ * with PSU_INIT_SEQUENTIAL and of the tables of psu_table_gen -n run with
+ * PSU_INIT_SERIAL, "make check-window" the windowed traces of the
+ * generated functions and of the coalesced tables, for a few seeds.
+ *
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "xil_io.h"
+#include "psu_init.h"
+
+/* PS peripherals, from the FPD registers to the top of the 32-bit space */
+#define REG_BASE 0xF0000000UL
+#define REG_SIZE 0x10000000UL
+
+/* Not declared by psu_init.h */
+int psu_init_ddr_self_refresh(void);
+unsigned long psu_ddr_init_data(void);
+
+#define WINDOW_SIZE 4096U
+
+struct write {
+  unsigned long addr;
+  u32 value;
+};
+
+static unsigned long writes;
+static int windowed;
+static struct write window[WINDOW_SIZE];
+static size_t window_size;
+
+static int compare_write(const void *a, const void *b) {
+  const struct write *wa = a, *wb = b;
+
+  return (wa->addr > wb->addr) - (wa->addr < wb->addr);
+}
+
+/* Prints the writes of the window, ended by a delay or an entry point */
+static void flush(void) {
+  qsort(window, window_size, sizeof(window[0]), compare_write);
+  for (size_t i = 0U; i < window_size; i++) {
+    printf("W %08lx %08x\n", window[i].addr, window[i].value);
+  }
+  window_size = 0U;
+}
+
+u32 Xil_In32(UINTPTR Addr) { return *(volatile u32 *)Addr; }
+
+void Xil_Out32(UINTPTR Addr, u32 Value) {
+  size_t i;
+
+  *(volatile u32 *)Addr = Value;
+  writes++;
+  if (!windowed) {
+    printf("W %08lx %08x\n", (unsigned long)Addr, Value);
+    return;
+  }
+  for (i = 0U; i < window_size && window[i].addr != Addr; i++) {
+  }
+  if (i == WINDOW_SIZE) {
+    flush();
+    i = 0U;
+  }
+  window[i].addr = Addr;
+  window[i].value = Value;
+  if (i == window_size) {
+    window_size++;
+  }
+}
+
+int psu_poll(unsigned long addr, unsigned int mask, unsigned int value,
+             int any) {
+  u32 reg = Xil_In32(addr);
+
+  if (!windowed) {
+    printf("P %08lx %08x %08x %d\n", addr, mask, value, any);
+  }
+  return (any != 0) ? ((reg & mask) != 0U) : ((reg & mask) == value);
+}
+
+int psu_trace_usleep(unsigned long useconds) {
+  flush();
+  printf("D %lu\n", useconds);
+  return 0;
+}
+
+/* Called once the entry point has returned Ret */
+static void entry(const char *name, long ret) {
+  flush();
+  printf("%s %ld\n", name, ret);
+}
+
+int main(int argc, char **argv) {
+  unsigned long seed;
+  uint64_t x;
+  u32 *reg;
+
+  if (argc > 1 && strcmp(argv[1], "-w") == 0) {
+    windowed = 1;
+    argc--;
+    argv++;
+  }
+  seed = (argc > 1) ? strtoul(argv[1], NULL, 0) : 0U;
+  x = seed;
+
+  reg = mmap((void *)REG_BASE, REG_SIZE, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE | MAP_NORESERVE,
+             -1, 0);
+  if (reg != (u32 *)REG_BASE) {
+    perror("mmap of the register space");
+    return 1;
+  }
+  if (seed != 0U) {
+    for (size_t i = 0U; i < REG_SIZE / 4U; i++) {
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+      reg[i] = (u32)x;
+    }
+  }
+
+  entry("psu_init", psu_init());
+  entry("psu_ddr_init_data", (long)psu_ddr_init_data());
+  entry("psu_ps_pl_isolation_removal_data",
+        (long)psu_ps_pl_isolation_removal_data());
+  entry("psu_ps_pl_reset_config_data", (long)psu_ps_pl_reset_config_data());
+  entry("psu_protection", psu_protection());
+  entry("psu_protection_lock", psu_protection_lock());
+  entry("psu_init_ddr_self_refresh", psu_init_ddr_self_refresh());
+  fprintf(stderr, "%lu register writes\n", writes);
+  return 0;
+}
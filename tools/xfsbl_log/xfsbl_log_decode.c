@@ -0,0 +1,409 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_log_decode.c
+ *
+ * Host side decoder of the tokenized prints of an FSBL built with
+ * FSBL_LOG_TOKENS_EXCLUDE_VAL 0.
+ *
+ *   xfsbl_log_decode <fsbl.elf> [log]
+ *     Reads the format strings from the .xfsbl_log_tokens section of the
+ *     FSBL ELF file and formats the records of the UART capture, or of the
+ *     standard input, to the standard output. Bytes out of records, such as
+ *     the prints of the BSP, are copied as they are.
+ *
+ *   xfsbl_log_decode -t <fsbl.elf>
+ *     Lists the tokens and their format strings.
+ *
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Token database and record layout, see src/main/xfsbl_log_token.h */
+#define TOKEN_SECTION ".xfsbl_log_tokens"
+#define TOKEN_MAGIC 0x4E4B5446U
+#define TOKEN_SYNC 0xFEU
+#define TOKEN_HASH_LEN 80U
+#define TOKEN_HASH_MUL 65599U
+#define ARG_INT 0U
+#define ARG_INT64 1U
+#define ARG_STRING 2U
+#define ARGS_MAX 8U
+
+/* ELF64 layout */
+#define EI_CLASS 4U
+#define EI_DATA 5U
+#define ELFCLASS64 2U
+#define ELFDATA2LSB 1U
+#define EH_SHOFF 0x28U
+#define EH_SHENTSIZE 0x3AU
+#define EH_SHNUM 0x3CU
+#define EH_SHSTRNDX 0x3EU
+#define SH_NAME 0x0U
+#define SH_OFFSET 0x18U
+#define SH_SIZE 0x20U
+#define SH_SIZE_MIN 0x40U
+
+struct token {
+  uint32_t token;
+  const char *format;
+};
+
+struct arg {
+  uint32_t type;
+  uint64_t value;
+  const uint8_t *string;
+  uint32_t length;
+};
+
+static struct token *tokens;
+static size_t token_count;
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: xfsbl_log_decode <fsbl.elf> [log]\n"
+          "       xfsbl_log_decode -t <fsbl.elf>\n");
+  exit(2);
+}
+
+static uint8_t *read_stream(FILE *f, const char *name, size_t *len) {
+  size_t size = 0x10000U;
+  uint8_t *buf = malloc(size);
+  size_t n;
+
+  *len = 0U;
+  while (buf != NULL && (n = fread(buf + *len, 1U, size - *len, f)) > 0U) {
+    *len += n;
+    if (*len == size) {
+      size *= 2U;
+      buf = realloc(buf, size);
+    }
+  }
+  if (buf == NULL || ferror(f)) {
+    fprintf(stderr, "%s: read failed\n", name);
+    exit(1);
+  }
+  return buf;
+}
+
+static uint8_t *read_file(const char *name, size_t *len) {
+  FILE *f = fopen(name, "rb");
+  uint8_t *buf;
+
+  if (f == NULL) {
+    perror(name);
+    exit(1);
+  }
+  buf = read_stream(f, name, len);
+  fclose(f);
+  return buf;
+}
+
+static uint64_t get(const uint8_t *p, uint32_t bytes) {
+  uint64_t v = 0U;
+
+  while (bytes-- > 0U) {
+    v = (v << 8) | p[bytes];
+  }
+  return v;
+}
+
+/* XFSBL_LOG_TOKEN of a format string */
+static uint32_t hash(const char *format, uint32_t length) {
+  uint32_t h = length;
+  uint32_t coef = TOKEN_HASH_MUL;
+
+  for (uint32_t i = 0U; i < length && i < TOKEN_HASH_LEN; i++) {
+    h += coef * (uint8_t)format[i];
+    coef *= TOKEN_HASH_MUL;
+  }
+  return h;
+}
+
+static int compare_tokens(const void *a, const void *b) {
+  const struct token *x = a;
+  const struct token *y = b;
+
+  if (x->token != y->token) {
+    return x->token < y->token ? -1 : 1;
+  }
+  return strcmp(x->format, y->format);
+}
+
+static const uint8_t *find_section(const char *name, const uint8_t *elf,
+                                   size_t len, size_t *size) {
+  uint64_t shoff;
+  uint32_t shentsize, shnum, shstrndx;
+  const uint8_t *strtab;
+  uint64_t strtab_size;
+
+  if (len < 0x40U || memcmp(elf, "\177ELF", 4U) != 0 ||
+      elf[EI_CLASS] != ELFCLASS64 || elf[EI_DATA] != ELFDATA2LSB) {
+    fprintf(stderr, "%s: not a little endian ELF64 file\n", name);
+    exit(1);
+  }
+  shoff = get(elf + EH_SHOFF, 8U);
+  shentsize = (uint32_t)get(elf + EH_SHENTSIZE, 2U);
+  shnum = (uint32_t)get(elf + EH_SHNUM, 2U);
+  shstrndx = (uint32_t)get(elf + EH_SHSTRNDX, 2U);
+  if (shentsize < SH_SIZE_MIN || shstrndx >= shnum ||
+      shoff + (uint64_t)shnum * shentsize > len) {
+    fprintf(stderr, "%s: section headers out of range\n", name);
+    exit(1);
+  }
+
+  strtab = elf + get(elf + shoff + shstrndx * shentsize + SH_OFFSET, 8U);
+  strtab_size = get(elf + shoff + shstrndx * shentsize + SH_SIZE, 8U);
+  if ((size_t)(strtab - elf) + strtab_size > len) {
+    fprintf(stderr, "%s: section names out of range\n", name);
+    exit(1);
+  }
+
+  for (uint32_t i = 0U; i < shnum; i++) {
+    const uint8_t *sh = elf + shoff + i * shentsize;
+    uint64_t name_offset = get(sh + SH_NAME, 4U);
+    uint64_t offset = get(sh + SH_OFFSET, 8U);
+
+    if (name_offset + sizeof(TOKEN_SECTION) > strtab_size ||
+        memcmp(strtab + name_offset, TOKEN_SECTION, sizeof(TOKEN_SECTION)) !=
+            0) {
+      continue;
+    }
+    *size = get(sh + SH_SIZE, 8U);
+    if (offset + *size > len) {
+      fprintf(stderr, "%s: %s out of range\n", name, TOKEN_SECTION);
+      exit(1);
+    }
+    return elf + offset;
+  }
+
+  fprintf(stderr, "%s: no %s section, is the FSBL built with tokens?\n",
+          name, TOKEN_SECTION);
+  exit(1);
+}
+
+static void load_tokens(const char *name) {
+  size_t len, size, offset = 0U, count = 0U;
+  const uint8_t *elf = read_file(name, &len);
+  const uint8_t *section = find_section(name, elf, len, &size);
+
+  /* Every print has an entry, a format string used twice has two */
+  tokens = malloc((size / 12U + 1U) * sizeof(*tokens));
+  if (tokens == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  while (offset + 12U <= size) {
+    uint32_t length = (uint32_t)get(section + offset + 4U, 4U);
+
+    if (get(section + offset, 4U) != TOKEN_MAGIC ||
+        offset + 8U + length >= size || section[offset + 8U + length] != 0U) {
+      offset += 4U;
+      continue;
+    }
+    tokens[count].format = (const char *)section + offset + 8U;
+    tokens[count].token = hash(tokens[count].format, length);
+    count++;
+    offset += (8U + length + 1U + 3U) & ~(size_t)3U;
+  }
+  qsort(tokens, count, sizeof(*tokens), compare_tokens);
+
+  for (size_t i = 0U; i < count; i++) {
+    if (token_count > 0U &&
+        tokens[token_count - 1U].token == tokens[i].token) {
+      if (strcmp(tokens[token_count - 1U].format, tokens[i].format) != 0) {
+        fprintf(stderr, "warning: token 0x%08x of \"%s\" and \"%s\"\n",
+                tokens[i].token, tokens[token_count - 1U].format,
+                tokens[i].format);
+      }
+      continue;
+    }
+    tokens[token_count++] = tokens[i];
+  }
+}
+
+static const char *lookup(uint32_t token) {
+  size_t low = 0U, high = token_count;
+
+  while (low < high) {
+    size_t mid = (low + high) / 2U;
+
+    if (tokens[mid].token == token) {
+      return tokens[mid].format;
+    }
+    if (tokens[mid].token < token) {
+      low = mid + 1U;
+    } else {
+      high = mid;
+    }
+  }
+  return NULL;
+}
+
+/* xil_printf() of a format string with the record arguments */
+static void format(const char *fmt, const struct arg *args, uint32_t count) {
+  uint32_t next = 0U;
+
+  while (*fmt != '\0') {
+    char spec[32];
+    size_t n = 0U;
+    const struct arg *arg;
+
+    if (*fmt != '%') {
+      putchar(*fmt++);
+      continue;
+    }
+    spec[n++] = *fmt++;
+    while (*fmt != '\0' && strchr("-+ #0123456789.", *fmt) != NULL &&
+           n < sizeof(spec) - 4U) {
+      spec[n++] = *fmt++;
+    }
+    while (*fmt == 'l' || *fmt == 'h' || *fmt == 'z') {
+      fmt++;
+    }
+    if (*fmt == '\0') {
+      break;
+    }
+    if (*fmt == '%') {
+      putchar('%');
+      fmt++;
+      continue;
+    }
+
+    arg = next < count ? &args[next++] : NULL;
+    if (arg == NULL || (*fmt == 's') != (arg->type == ARG_STRING)) {
+      printf("<?>");
+    } else if (*fmt == 's') {
+      spec[n++] = '.';
+      spec[n++] = '*';
+      spec[n++] = 's';
+      spec[n] = '\0';
+      printf(spec, (int)arg->length, (const char *)arg->string);
+    } else if (*fmt == 'c') {
+      spec[n++] = 'c';
+      spec[n] = '\0';
+      printf(spec, (int)arg->value);
+    } else if (*fmt == 'd' || *fmt == 'i') {
+      spec[n++] = 'l';
+      spec[n++] = 'l';
+      spec[n++] = 'd';
+      spec[n] = '\0';
+      printf(spec, arg->type == ARG_INT64 ? (long long)(int64_t)arg->value
+                                          : (long long)(int32_t)arg->value);
+    } else {
+      spec[n++] = 'l';
+      spec[n++] = 'l';
+      spec[n++] = (*fmt == 'p') ? 'x' : *fmt;
+      spec[n] = '\0';
+      printf(spec, (unsigned long long)arg->value);
+    }
+    fmt++;
+  }
+}
+
+/* Decodes the record at p, returns its length or 0 if it is truncated */
+static size_t decode_record(const uint8_t *p, size_t len) {
+  struct arg args[ARGS_MAX];
+  const uint8_t *end = p + len;
+  const uint8_t *q;
+  const char *fmt;
+  uint32_t token, count;
+
+  if (len < 6U) {
+    return 0U;
+  }
+  token = (uint32_t)get(p + 1U, 4U);
+  count = p[5];
+  if (count > ARGS_MAX) {
+    return 0U;
+  }
+  q = p + 6U + (count + 3U) / 4U;
+  if (q > end) {
+    return 0U;
+  }
+
+  for (uint32_t i = 0U; i < count; i++) {
+    args[i].type = (p[6U + i / 4U] >> (2U * (i % 4U))) & 0x3U;
+    if (args[i].type == ARG_STRING) {
+      if (q + 1U > end || q + 1U + q[0] > end) {
+        return 0U;
+      }
+      args[i].length = q[0];
+      args[i].string = q + 1U;
+      q += 1U + q[0];
+    } else {
+      uint32_t bytes = args[i].type == ARG_INT64 ? 8U : 4U;
+
+      if (q + bytes > end) {
+        return 0U;
+      }
+      args[i].value = get(q, bytes);
+      q += bytes;
+    }
+  }
+
+  fmt = lookup(token);
+  if (fmt == NULL) {
+    printf("<token 0x%08x>", token);
+    for (uint32_t i = 0U; i < count; i++) {
+      if (args[i].type == ARG_STRING) {
+        printf(" \"%.*s\"", (int)args[i].length, (const char *)args[i].string);
+      } else {
+        printf(" 0x%llx", (unsigned long long)args[i].value);
+      }
+    }
+    printf("\n");
+  } else {
+    format(fmt, args, count);
+  }
+  return (size_t)(q - p);
+}
+
+static void decode(const uint8_t *log, size_t len) {
+  size_t offset = 0U;
+
+  while (offset < len) {
+    size_t n = 0U;
+
+    if (log[offset] == TOKEN_SYNC) {
+      n = decode_record(log + offset, len - offset);
+    }
+    if (n == 0U) {
+      putchar(log[offset]);
+      n = 1U;
+    }
+    offset += n;
+  }
+}
+
+int main(int argc, char **argv) {
+  uint8_t *log;
+  size_t len;
+
+  if (argc == 3 && strcmp(argv[1], "-t") == 0) {
+    load_tokens(argv[2]);
+    for (size_t i = 0U; i < token_count; i++) {
+      printf("0x%08x \"%s\"\n", tokens[i].token, tokens[i].format);
+    }
+    return 0;
+  }
+  if (argc < 2 || argc > 3 || argv[1][0] == '-') {
+    usage();
+  }
+
+  load_tokens(argv[1]);
+  if (argc == 3) {
+    log = read_file(argv[2], &len);
+  } else {
+    log = read_stream(stdin, "stdin", &len);
+  }
+  decode(log, len);
+  free(log);
+  return 0;
+}
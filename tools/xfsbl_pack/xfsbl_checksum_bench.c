@@ -0,0 +1,366 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_checksum_bench.c
+ *
+ * Throughput benchmark of the partition checksums.
+ *
+ *   xfsbl_checksum_bench [-n iterations] [-s size]
+ *
+ * XFsbl_Crc32C() is first checked against a bitwise CRC-32C and the FSBL
+ * SHA3-384 against the packer one, for random lengths, alignments and split
+ * points, and the BLAKE3 digest against the test vectors and against the
+ * root of its segment chaining values. Then the MB/s of the three lane CRC,
+ * of a single lane CRC (calls shorter than three lanes), of the bitwise CRC,
+ * of the FSBL SHA3-384, fed whole and in QSPI stream chunks, of the packer
+ * SHA3-384, of BLAKE3, whole and in 64 segments on 1, 2 and 4 threads, and
+ * of the header word sum are measured over a buffer of the given size. The
+ * ARMv8 and SSE4.2 CRC instructions compute the same CRC, so the lane
+ * speedup measured on the host carries over to the A53, as does the thread
+ * scaling of BLAKE3 to the A53 workers. The CSU SHA3 engine only exists on
+ * the target, there the FSBL prints the ticks spent on the checksum of
+ * every partition.
+ *
+ ******************************************************************************/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "xfsbl_blake3.h"
+#include "xfsbl_checksum.h"
+#include "xfsbl_error.h"
+#include "xfsbl_pack_sha3.h"
+#include "xfsbl_sha3.h"
+
+#define DEFAULT_SIZE (16U * 1024U * 1024U)
+#define CHECK_RUNS 2000U
+#define CHECK_MAX_LEN (4U * 3U * XFSBL_CRC32C_LANE_SIZE)
+
+/* Default chunk of the QSPI stream hook */
+#define STREAM_CHUNK (0x40000U)
+
+static uint32_t bitwise_crc32c(uint32_t crc, const uint8_t *buf, size_t len) {
+  crc = ~crc;
+  while (len-- != 0U) {
+    crc ^= *buf++;
+    for (unsigned bit = 0U; bit < 8U; bit++) {
+      crc = (crc >> 1U) ^ (0x82F63B78U & (0U - (crc & 1U)));
+    }
+  }
+  return ~crc;
+}
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static volatile uint32_t sink;
+
+static void run_crc(const uint8_t *buf, size_t len) {
+  sink = XFsbl_Crc32C(0U, buf, (u32)len);
+}
+
+/* Calls of less than three lanes never take the interleaved loop */
+static void run_crc_single(const uint8_t *buf, size_t len) {
+  uint32_t crc = 0U;
+
+  for (size_t off = 0U; off < len; off += XFSBL_CRC32C_LANE_SIZE) {
+    const size_t n = (len - off < XFSBL_CRC32C_LANE_SIZE)
+                         ? len - off
+                         : XFSBL_CRC32C_LANE_SIZE;
+    crc = XFsbl_Crc32C(crc, &buf[off], (u32)n);
+  }
+  sink = crc;
+}
+
+static void run_crc_bitwise(const uint8_t *buf, size_t len) {
+  sink = bitwise_crc32c(0U, buf, len);
+}
+
+static void run_sha3(const uint8_t *buf, size_t len) {
+  u8 hash[XFSBL_SHA3_LEN];
+
+  XFsbl_Sha3Digest(buf, (u32)len, hash);
+  sink = hash[0];
+}
+
+static void run_sha3_stream(const uint8_t *buf, size_t len) {
+  XFsblPs_Sha3 sha3;
+  u8 hash[XFSBL_SHA3_LEN];
+
+  XFsbl_Sha3Start(&sha3);
+  for (size_t off = 0U; off < len; off += STREAM_CHUNK) {
+    const size_t n = (len - off < STREAM_CHUNK) ? len - off : STREAM_CHUNK;
+    XFsbl_Sha3Update(&sha3, &buf[off], (u32)n);
+  }
+  XFsbl_Sha3Finish(&sha3, hash);
+  sink = hash[0];
+}
+
+static void run_sha3_reference(const uint8_t *buf, size_t len) {
+  uint8_t hash[SHA3_384_LEN];
+
+  sha3_384(buf, len, hash);
+  sink = hash[0];
+}
+
+/* Segments of the BLAKE3 rows, hashed by every thread in turn */
+#define BLAKE3_SEGMENTS 64U
+#define BLAKE3_MAX_THREADS 4U
+
+struct blake3_job {
+  const uint8_t *buf;
+  size_t len;
+  unsigned threads;
+  unsigned slot;
+  u8 (*cvs)[XFSBL_BLAKE3_LEN];
+};
+
+static void run_blake3(const uint8_t *buf, size_t len) {
+  u8 hash[XFSBL_BLAKE3_LEN];
+
+  XFsbl_Blake3Digest(buf, (u32)len, hash);
+  sink = hash[0];
+}
+
+static size_t blake3_segment_size(size_t len) {
+  size_t size = XFSBL_BLAKE3_CHUNK_LEN;
+
+  while (size * BLAKE3_SEGMENTS < len) {
+    size <<= 1U;
+  }
+  return size;
+}
+
+static void *blake3_worker(void *arg) {
+  const struct blake3_job *job = arg;
+  const size_t size = blake3_segment_size(job->len);
+
+  for (size_t i = job->slot; i * size < job->len; i += job->threads) {
+    const size_t off = i * size;
+    const size_t n = (job->len - off < size) ? job->len - off : size;
+    XFsbl_Blake3Segment(&job->buf[off], (u32)n, off, job->cvs[i]);
+  }
+  return NULL;
+}
+
+static void run_blake3_threads(const uint8_t *buf, size_t len,
+                               unsigned threads) {
+  u8 cvs[BLAKE3_SEGMENTS][XFSBL_BLAKE3_LEN];
+  struct blake3_job jobs[BLAKE3_MAX_THREADS];
+  pthread_t ids[BLAKE3_MAX_THREADS];
+  u8 hash[XFSBL_BLAKE3_LEN];
+
+  for (unsigned t = 0U; t < threads; t++) {
+    jobs[t] = (struct blake3_job){buf, len, threads, t, cvs};
+    if ((t != 0U) && (pthread_create(&ids[t], NULL, blake3_worker,
+                                     &jobs[t]) != 0)) {
+      ids[t] = 0U;
+      blake3_worker(&jobs[t]);
+    }
+  }
+  blake3_worker(&jobs[0]);
+  for (unsigned t = 1U; t < threads; t++) {
+    if (ids[t] != 0U) {
+      pthread_join(ids[t], NULL);
+    }
+  }
+
+  const size_t size = blake3_segment_size(len);
+  XFsbl_Blake3Root(&cvs[0][0], (u32)((len + size - 1U) / size), hash);
+  sink = hash[0];
+}
+
+static void run_blake3_1(const uint8_t *buf, size_t len) {
+  run_blake3_threads(buf, len, 1U);
+}
+
+static void run_blake3_2(const uint8_t *buf, size_t len) {
+  run_blake3_threads(buf, len, 2U);
+}
+
+static void run_blake3_4(const uint8_t *buf, size_t len) {
+  run_blake3_threads(buf, len, 4U);
+}
+
+static void run_word_sum(const uint8_t *buf, size_t len) {
+  sink = XFsbl_WordSum((const u32 *)buf, (u32)(len / 4U));
+}
+
+/* BLAKE3 test vectors */
+static const u8 blake3_empty[XFSBL_BLAKE3_LEN] = {
+    0xaf, 0x13, 0x49, 0xb9, 0xf5, 0xf9, 0xa1, 0xa6, 0xa0, 0x40, 0x4d,
+    0xea, 0x36, 0xdc, 0xc9, 0x49, 0x9b, 0xcb, 0x25, 0xc9, 0xad, 0xc1,
+    0x12, 0xb7, 0xcc, 0x9a, 0x93, 0xca, 0xe4, 0x1f, 0x32, 0x62};
+static const u8 blake3_abc[XFSBL_BLAKE3_LEN] = {
+    0x64, 0x37, 0xb3, 0xac, 0x38, 0x46, 0x51, 0x33, 0xff, 0xb6, 0x3b,
+    0x75, 0x27, 0x3a, 0x8d, 0xb5, 0x48, 0xc5, 0x58, 0x46, 0x5d, 0x79,
+    0xdb, 0x03, 0xfd, 0x35, 0x9c, 0x6c, 0xd5, 0xbd, 0x9d, 0x85};
+
+static int check_blake3(const uint8_t *buf) {
+  unsigned failures = 0U;
+  u8 hash[XFSBL_BLAKE3_LEN];
+  u8 root[XFSBL_BLAKE3_LEN];
+  u8 cvs[XFSBL_BLAKE3_MAX_SEGMENTS][XFSBL_BLAKE3_LEN];
+
+  XFsbl_Blake3Digest(buf, 0U, hash);
+  if (memcmp(hash, blake3_empty, sizeof(hash)) != 0) {
+    printf("FAIL BLAKE3 empty\n");
+    failures++;
+  }
+  XFsbl_Blake3Digest((const u8 *)"abc", 3U, hash);
+  if (memcmp(hash, blake3_abc, sizeof(hash)) != 0) {
+    printf("FAIL BLAKE3 abc\n");
+    failures++;
+  }
+
+  for (unsigned run = 0U; run < CHECK_RUNS / 10U; run++) {
+    const uint32_t shift =
+        XFSBL_BLAKE3_MIN_SEGMENT_SHIFT + (uint32_t)rand() % 3U;
+    const size_t size = (size_t)1U << shift;
+    const size_t len = size + (size_t)rand() % (CHECK_MAX_LEN - size);
+    const u32 count = (u32)((len + size - 1U) / size);
+
+    for (u32 i = 0U; i < count; i++) {
+      const size_t off = i * size;
+      const size_t n = (len - off < size) ? len - off : size;
+      XFsbl_Blake3Segment(&buf[off], (u32)n, off, cvs[i]);
+    }
+    XFsbl_Blake3Digest(buf, (u32)len, hash);
+    if ((count < 2U) ||
+        (XFsbl_Blake3Root(&cvs[0][0], count, root) != XFSBL_SUCCESS) ||
+        (memcmp(hash, root, sizeof(hash)) != 0)) {
+      if (failures < 10U) {
+        printf("FAIL BLAKE3 length %zu segment %zu\n", len, size);
+      }
+      failures++;
+    }
+  }
+  return (failures == 0U) ? 0 : -1;
+}
+
+static int check(const uint8_t *buf) {
+  unsigned failures = 0U;
+
+  if (XFsbl_Crc32C(0U, (const u8 *)"123456789", 9U) != 0xE3069283U) {
+    printf("FAIL check value\n");
+    failures++;
+  }
+  if (check_blake3(buf) != 0) {
+    failures++;
+  }
+
+  srand(1U);
+  for (unsigned run = 0U; run < CHECK_RUNS; run++) {
+    const size_t off = (size_t)rand() % 64U;
+    const size_t len = (size_t)rand() % CHECK_MAX_LEN;
+    const size_t split = (len == 0U) ? 0U : (size_t)rand() % len;
+    const uint32_t expect = bitwise_crc32c(0U, &buf[off], len);
+    const uint32_t whole = XFsbl_Crc32C(0U, &buf[off], (u32)len);
+    const uint32_t chained =
+        XFsbl_Crc32C(XFsbl_Crc32C(0U, &buf[off], (u32)split),
+                     &buf[off + split], (u32)(len - split));
+
+    if ((whole != expect) || (chained != expect)) {
+      if (failures < 10U) {
+        printf("FAIL CRC offset %zu length %zu split %zu\n", off, len, split);
+      }
+      failures++;
+    }
+
+    XFsblPs_Sha3 sha3;
+    u8 hash[XFSBL_SHA3_LEN];
+    uint8_t ref[SHA3_384_LEN];
+    const size_t sha3_len = len / 8U;
+    const size_t sha3_split = split / 8U;
+    XFsbl_Sha3Start(&sha3);
+    XFsbl_Sha3Update(&sha3, &buf[off], (u32)sha3_split);
+    XFsbl_Sha3Update(&sha3, &buf[off + sha3_split],
+                     (u32)(sha3_len - sha3_split));
+    XFsbl_Sha3Finish(&sha3, hash);
+    sha3_384(&buf[off], sha3_len, ref);
+    if (memcmp(hash, ref, sizeof(ref)) != 0) {
+      if (failures < 10U) {
+        printf("FAIL SHA3 offset %zu length %zu split %zu\n", off, sha3_len,
+               sha3_split);
+      }
+      failures++;
+    }
+  }
+  return (failures == 0U) ? 0 : -1;
+}
+
+int main(int argc, char **argv) {
+  static const struct {
+    const char *name;
+    void (*fn)(const uint8_t *buf, size_t len);
+  } fns[] = {
+      {"CRC32C, 3 lanes", run_crc},
+      {"CRC32C, 1 lane", run_crc_single},
+      {"CRC32C, bitwise", run_crc_bitwise},
+      {"SHA3-384", run_sha3},
+      {"SHA3-384, stream", run_sha3_stream},
+      {"SHA3-384, packer", run_sha3_reference},
+      {"BLAKE3", run_blake3},
+      {"BLAKE3, 1 thread", run_blake3_1},
+      {"BLAKE3, 2 threads", run_blake3_2},
+      {"BLAKE3, 4 threads", run_blake3_4},
+      {"word sum", run_word_sum},
+  };
+  unsigned iterations = 5U;
+  size_t size = DEFAULT_SIZE;
+
+  for (int i = 1; i < argc; i++) {
+    if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc)) {
+      iterations = (unsigned)strtoul(argv[++i], NULL, 0);
+    } else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc)) {
+      size = strtoul(argv[++i], NULL, 0) & ~(size_t)3U;
+    } else {
+      fprintf(stderr,
+              "usage: xfsbl_checksum_bench [-n iterations] [-s size]\n");
+      return 2;
+    }
+  }
+
+  const size_t buf_len = (size < CHECK_MAX_LEN + 64U) ? CHECK_MAX_LEN + 64U
+                                                       : size;
+  uint8_t *buf = malloc(buf_len);
+  if ((buf == NULL) || (iterations == 0U) || (size == 0U)) {
+    return 1;
+  }
+  for (size_t i = 0U; i < buf_len; i++) {
+    buf[i] = (uint8_t)(rand() >> 7);
+  }
+
+  if (check(buf) != 0) {
+    return 1;
+  }
+  printf("checks passed\n");
+
+  for (size_t f = 0U; f < sizeof(fns) / sizeof(fns[0]); f++) {
+    double best = 0.0;
+
+    for (unsigned n = 0U; n < iterations; n++) {
+      const double start = now();
+      fns[f].fn(buf, size);
+      const double elapsed = now() - start;
+      if ((best == 0.0) || (elapsed < best)) {
+        best = elapsed;
+      }
+    }
+    printf("%-18s %10.1f MB/s\n", fns[f].name,
+           (best > 0.0) ? (double)size / best / 1e6 : 0.0);
+  }
+
+  free(buf);
+  return 0;
+}
@@ -0,0 +1,198 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_decomp_bench.c
+ *
+ * Decompression throughput benchmark of the FSBL stream decoder.
+ *
+ *   xfsbl_decomp_bench [-b block_size] [-n iterations] [-f flash_MBps]
+ *                      [input]
+ *
+ * The input, or a synthetic image of code, zeroed data and noise, is packed
+ * and decoded through XFsbl_Decompress() with the FSBL staging buffer size.
+ * With -f the load time of the raw and the compressed partition is
+ * estimated for a boot device of the given read rate.
+ *
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "xfsbl_config.h"
+#include "xfsbl_decompress.h"
+#include "xfsbl_pack_lz4.h"
+
+#define SYNTHETIC_SIZE (8U * 1024U * 1024U)
+
+struct mem_source {
+  const uint8_t *base;
+};
+
+static u32 mem_read(void *context, u32 offset, u8 *buffer, u32 length) {
+  const struct mem_source *src = context;
+
+  memcpy(buffer, &src->base[offset], length);
+  return XFSBL_SUCCESS;
+}
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Instruction like words from a small vocabulary, zeroed data and noise */
+static uint8_t *synthetic_image(size_t *len) {
+  uint8_t *buf = malloc(SYNTHETIC_SIZE);
+  uint32_t seed = 0x12345678U;
+  uint32_t vocab[64];
+
+  if (buf == NULL) {
+    return NULL;
+  }
+  for (unsigned i = 0U; i < 64U; i++) {
+    seed = seed * 1103515245U + 12345U;
+    vocab[i] = seed;
+  }
+  for (size_t i = 0U; i < SYNTHETIC_SIZE; i += 4U) {
+    const size_t region = i / (SYNTHETIC_SIZE / 8U);
+    uint32_t word;
+
+    seed = seed * 1103515245U + 12345U;
+    if (region < 5U) {
+      word = vocab[(seed >> 16) & 63U] ^ ((seed >> 8) & 0x1FU);
+    } else if (region < 7U) {
+      word = 0U;
+    } else {
+      word = seed;
+    }
+    memcpy(&buf[i], &word, sizeof(word));
+  }
+  *len = SYNTHETIC_SIZE;
+  return buf;
+}
+
+static uint8_t *read_file(const char *name, size_t *len) {
+  FILE *f = fopen(name, "rb");
+  uint8_t *buf;
+  long size;
+
+  if ((f == NULL) || (fseek(f, 0, SEEK_END) != 0) || ((size = ftell(f)) < 0) ||
+      (fseek(f, 0, SEEK_SET) != 0)) {
+    perror(name);
+    exit(1);
+  }
+  buf = malloc((size_t)size + 1U);
+  if ((buf == NULL) || (fread(buf, 1U, (size_t)size, f) != (size_t)size)) {
+    perror(name);
+    exit(1);
+  }
+  fclose(f);
+  *len = (size_t)size;
+  return buf;
+}
+
+int main(int argc, char **argv) {
+  size_t block_size = XFZ_DEFAULT_BLOCK_SIZE;
+  unsigned iterations = 20U;
+  double flash_mbps = 0.0;
+  const char *input = NULL;
+  struct xfz_pack_stats pack_stats;
+  XFsblPs_DecompStats stats;
+  uint8_t *in;
+  size_t in_len;
+  size_t stored;
+  int i;
+
+  for (i = 1; i < argc; i++) {
+    if ((strcmp(argv[i], "-b") == 0) && (i + 1 < argc)) {
+      block_size = strtoul(argv[++i], NULL, 0);
+    } else if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc)) {
+      iterations = (unsigned)strtoul(argv[++i], NULL, 0);
+    } else if ((strcmp(argv[i], "-f") == 0) && (i + 1 < argc)) {
+      flash_mbps = strtod(argv[++i], NULL);
+    } else if (argv[i][0] != '-') {
+      input = argv[i];
+    } else {
+      fprintf(stderr,
+              "usage: xfsbl_decomp_bench [-b block_size] [-n iterations] "
+              "[-f flash_MBps] [input]\n");
+      return 2;
+    }
+  }
+
+  in = (input != NULL) ? read_file(input, &in_len) : synthetic_image(&in_len);
+  if ((in == NULL) || (iterations == 0U)) {
+    return 1;
+  }
+
+  double t = now();
+  uint8_t *packed = xfz_pack(in, in_len, block_size, &stored, &pack_stats);
+  const double pack_time = now() - t;
+  if (packed == NULL) {
+    fprintf(stderr, "xfsbl_decomp_bench: invalid block size 0x%zx\n",
+            block_size);
+    return 1;
+  }
+
+  static uint8_t staging[XFSBL_DECOMP_STAGING_SIZE]
+      __attribute__((aligned(XFSBL_DECOMP_READ_ALIGN)));
+  struct mem_source mem = {packed};
+  const XFsblPs_DecompSource source = {mem_read, &mem, (u32)stored, staging,
+                                       sizeof(staging)};
+  uint8_t *out = malloc(in_len + 1U);
+  if (out == NULL) {
+    return 1;
+  }
+
+  double best = 0.0;
+  for (unsigned n = 0U; n < iterations; n++) {
+    memset(out, 0xA5, in_len);
+    t = now();
+    const u32 status = XFsbl_Decompress(&source, out, (u32)in_len, &stats);
+    t = now() - t;
+    if ((status != XFSBL_SUCCESS) || (memcmp(out, in, in_len) != 0)) {
+      fprintf(stderr, "xfsbl_decomp_bench: decode failed 0x%x at 0x%x\n",
+              status, stats.OutputBytes);
+      return 1;
+    }
+    if ((n == 0U) || (t < best)) {
+      best = t;
+    }
+  }
+
+  const double mb = (double)in_len / (1024.0 * 1024.0);
+  const double stored_mb = (double)stored / (1024.0 * 1024.0);
+  printf("input      %s, 0x%zx bytes\n", (input != NULL) ? input : "synthetic",
+         in_len);
+  printf("stored     0x%zx bytes, ratio %.2fx, packed in %.1f ms\n", stored,
+         (double)in_len / (double)stored, pack_time * 1e3);
+  printf("blocks     %u lz4 %u raw %u zero (0x%x bytes), largest payload "
+         "0x%x\n",
+         pack_stats.lz4_blocks, pack_stats.raw_blocks, pack_stats.zero_blocks,
+         pack_stats.zero_bytes, pack_stats.max_payload);
+  printf("reads      %u of at most 0x%x bytes\n", stats.Reads,
+         XFSBL_DECOMP_STAGING_SIZE);
+  printf("decode     %.3f ms, %.1f MB/s output, %.1f MB/s stored (best of "
+         "%u)\n",
+         best * 1e3, mb / best, stored_mb / best, iterations);
+
+  if (flash_mbps > 0.0) {
+    const double raw_ms = mb / flash_mbps * 1e3;
+    const double comp_ms = stored_mb / flash_mbps * 1e3 + best * 1e3;
+    printf("flash      %.1f MB/s: raw load %.2f ms, compressed load %.2f ms "
+           "(host decode time)\n",
+           flash_mbps, raw_ms, comp_ms);
+  }
+
+  free(in);
+  free(packed);
+  free(out);
+  return 0;
+}
@@ -0,0 +1,517 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_pack.c
+ *
+ * Host side packer of compressed, CRC32C and BLAKE3 checksum partitions.
+ *
+ *   xfsbl_pack compress [-b block_size] <input> <output>
+ *     Pads the input to a word multiple and writes the compressed stream.
+ *     Add the stream to the BIF as a regular partition.
+ *
+ *   xfsbl_pack patch <boot.bin> <partition> <input>
+ *     Marks a partition of a boot image as compressed once bootgen placed
+ *     the stream. The stream is decoded and compared with the input, then
+ *     the compression attribute, the decompressed length, the partition
+ *     header checksum and, for SHA3 or CRC32C checksum partitions, the
+ *     checksum of the decompressed data are written to the boot image.
+ *
+ *   xfsbl_pack crc <boot.bin> <partition>
+ *     Replaces the checksum of a partition, typically the SHA3-384 bootgen
+ *     wrote for [checksum = sha3], by the CRC32C of the loaded data. The
+ *     CRC is written at the start of the checksum space and the checksum
+ *     attribute is set to CRC32C.
+ *
+ *   xfsbl_pack blake3 [-s shift] <boot.bin> <partition>
+ *     Replaces the checksum of a partition by the BLAKE3 record of the
+ *     loaded data, split in 2^shift byte segments that the FSBL verifies
+ *     as they land. The record and the segment chaining values do not fit
+ *     the checksum space of bootgen, they are appended to the boot image
+ *     and the checksum offset of the partition points to them. The default
+ *     shift is the smallest from 14 that gives at most 64 segments.
+ *
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xfsbl_config.h"
+#include "xfsbl_decompress.h"
+#include "xfsbl_checksum.h"
+#include "xfsbl_blake3.h"
+#include "xfsbl_pack_lz4.h"
+#include "xfsbl_pack_sha3.h"
+
+/* Boot image layout, see src/main/xfsbl_image_header.h */
+#define BH_IH_TABLE_OFFSET 0x98U
+#define IHT_NO_OF_PARTITIONS 1U
+#define IHT_PARTITION_HEADER_ADDRESS 2U
+#define PH_ENCRYPTED_LENGTH 0U
+#define PH_UNENCRYPTED_LENGTH 1U
+#define PH_TOTAL_LENGTH 2U
+#define PH_DATA_WORD_OFFSET 8U
+#define PH_ATTRIBUTES 9U
+#define PH_CHECKSUM_WORD_OFFSET 11U
+#define PH_CHECKSUM 15U
+#define PH_WORDS 16U
+
+#define ATTRB_COMPRESSION 0x1000000U
+#define ATTRB_RSA_SIGNATURE 0x8000U
+#define ATTRB_CHECKSUM_MASK 0x7000U
+#define ATTRB_HASH_SHA3 0x3000U
+#define ATTRB_CHECKSUM_CRC32C 0x4000U
+#define ATTRB_CHECKSUM_BLAKE3 0x5000U
+#define ATTRB_ENCRYPTION 0x80U
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: xfsbl_pack compress [-b block_size] <input> <output>\n"
+          "       xfsbl_pack patch <boot.bin> <partition> <input>\n"
+          "       xfsbl_pack crc <boot.bin> <partition>\n"
+          "       xfsbl_pack blake3 [-s shift] <boot.bin> <partition>\n");
+  exit(2);
+}
+
+static uint8_t *read_file(const char *name, size_t pad, size_t *len) {
+  FILE *f = fopen(name, "rb");
+  uint8_t *buf;
+  long size;
+
+  if ((f == NULL) || (fseek(f, 0, SEEK_END) != 0) || ((size = ftell(f)) < 0) ||
+      (fseek(f, 0, SEEK_SET) != 0)) {
+    perror(name);
+    exit(1);
+  }
+  *len = ((size_t)size + pad - 1U) / pad * pad;
+  buf = calloc(1U, *len + 1U);
+  if ((buf == NULL) || (fread(buf, 1U, (size_t)size, f) != (size_t)size)) {
+    perror(name);
+    exit(1);
+  }
+  fclose(f);
+  return buf;
+}
+
+static void write_file(const char *name, const uint8_t *buf, size_t len) {
+  FILE *f = fopen(name, "wb");
+
+  if ((f == NULL) || (fwrite(buf, 1U, len, f) != len) || (fclose(f) != 0)) {
+    perror(name);
+    exit(1);
+  }
+}
+
+static uint32_t get32(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+
+static void set32(uint8_t *p, uint32_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
+
+struct mem_source {
+  const uint8_t *base;
+};
+
+static u32 mem_read(void *context, u32 offset, u8 *buffer, u32 length) {
+  const struct mem_source *src = context;
+
+  memcpy(buffer, &src->base[offset], length);
+  return XFSBL_SUCCESS;
+}
+
+static int cmd_compress(int argc, char **argv) {
+  size_t block_size = XFZ_DEFAULT_BLOCK_SIZE;
+  struct xfz_pack_stats stats;
+  size_t in_len;
+  size_t out_len;
+  int i = 0;
+
+  if ((argc >= 2) && (strcmp(argv[0], "-b") == 0)) {
+    block_size = strtoul(argv[1], NULL, 0);
+    i = 2;
+  }
+  if (argc - i != 2) {
+    usage();
+  }
+
+  uint8_t *in = read_file(argv[i], sizeof(uint32_t), &in_len);
+  uint8_t *out = xfz_pack(in, in_len, block_size, &out_len, &stats);
+  if (out == NULL) {
+    fprintf(stderr, "xfsbl_pack: invalid block size 0x%zx\n", block_size);
+    return 1;
+  }
+  write_file(argv[i + 1], out, out_len);
+
+  printf("%s: 0x%zx -> 0x%zx bytes (%.2fx), %u lz4 %u raw %u zero blocks, "
+         "0x%x zero bytes, largest payload 0x%x\n",
+         argv[i + 1], in_len, out_len,
+         (out_len != 0U) ? (double)in_len / (double)out_len : 0.0,
+         stats.lz4_blocks, stats.raw_blocks, stats.zero_blocks,
+         stats.zero_bytes, stats.max_payload);
+  if (stats.max_payload + XFSBL_DECOMP_BLOCK_HDR_LEN + XFSBL_DECOMP_READ_ALIGN >
+      XFSBL_DECOMP_STAGING_SIZE) {
+    printf("note: needs XFSBL_DECOMP_STAGING_SIZE of at least 0x%x\n",
+           stats.max_payload + XFSBL_DECOMP_BLOCK_HDR_LEN +
+               XFSBL_DECOMP_READ_ALIGN);
+  }
+  free(in);
+  free(out);
+  return 0;
+}
+
+/* Returns the header of a partition of a boot image, exits if there is none */
+static uint8_t *partition_header(const char *name, uint8_t *image,
+                                 size_t image_len, uint32_t index) {
+  if (image_len < BH_IH_TABLE_OFFSET + 4U) {
+    fprintf(stderr, "%s: not a boot image\n", name);
+    exit(1);
+  }
+  const size_t iht = get32(&image[BH_IH_TABLE_OFFSET]);
+  if ((iht + 16U > image_len) ||
+      (index >= get32(&image[iht + 4U * IHT_NO_OF_PARTITIONS]))) {
+    fprintf(stderr, "%s: no partition %u\n", name, index);
+    exit(1);
+  }
+  const size_t ph_off =
+      (size_t)get32(&image[iht + 4U * IHT_PARTITION_HEADER_ADDRESS]) * 4U +
+      (size_t)index * PH_WORDS * 4U;
+  if (ph_off + PH_WORDS * 4U > image_len) {
+    fprintf(stderr, "%s: partition header out of range\n", name);
+    exit(1);
+  }
+  uint8_t *ph = &image[ph_off];
+  if ((get32(&ph[4U * PH_ATTRIBUTES]) &
+       (ATTRB_ENCRYPTION | ATTRB_RSA_SIGNATURE)) != 0U) {
+    fprintf(stderr, "%s: partition %u is encrypted or authenticated\n", name,
+            index);
+    exit(1);
+  }
+  return ph;
+}
+
+/* Decodes a compressed partition the way the FSBL does */
+static int decode(const uint8_t *stream, size_t stored, uint8_t *out,
+                  size_t out_len) {
+  uint8_t staging[XFSBL_DECOMP_STAGING_SIZE]
+      __attribute__((aligned(XFSBL_DECOMP_READ_ALIGN)));
+  struct mem_source mem = {stream};
+  const XFsblPs_DecompSource source = {mem_read, &mem, (u32)stored, staging,
+                                       sizeof(staging)};
+  XFsblPs_DecompStats stats;
+
+  return (XFsbl_Decompress(&source, out, (u32)out_len, &stats) ==
+          XFSBL_SUCCESS)
+             ? 0
+             : -1;
+}
+
+/* Space appended to the boot image for a BLAKE3 record of any length */
+#define BLAKE3_SPACE \
+  (XFSBL_BLAKE3_RECORD_LEN + XFSBL_BLAKE3_MAX_SEGMENTS * XFSBL_BLAKE3_LEN)
+#define BLAKE3_DEFAULT_SHIFT 14U
+
+/*
+ * Returns the requested segment shift, or the default one when it is 0, or
+ * 0 when the segments of the partition would not fit the record
+ */
+static uint32_t blake3_shift(size_t len, uint32_t shift) {
+  if (shift == 0U) {
+    shift = BLAKE3_DEFAULT_SHIFT;
+    while ((shift < XFSBL_BLAKE3_MAX_SEGMENT_SHIFT) &&
+           ((len - 1U) >> shift) >= XFSBL_BLAKE3_MAX_SEGMENTS) {
+      shift++;
+    }
+  }
+  if ((len == 0U) || (shift < XFSBL_BLAKE3_MIN_SEGMENT_SHIFT) ||
+      (shift > XFSBL_BLAKE3_MAX_SEGMENT_SHIFT) ||
+      (((len - 1U) >> shift) >= XFSBL_BLAKE3_MAX_SEGMENTS)) {
+    return 0U;
+  }
+  return shift;
+}
+
+/*
+ * Writes the BLAKE3 record and the segment chaining values of the loaded
+ * data, with the segment shift of the record already there if any
+ */
+static int write_blake3(const char *name, uint8_t *record, const uint8_t *data,
+                        size_t len) {
+  const uint32_t shift = blake3_shift(
+      len, (get32(&record[32]) == XFSBL_BLAKE3_MAGIC) ? get32(&record[36])
+                                                      : 0U);
+  if (shift == 0U) {
+    fprintf(stderr, "%s: no BLAKE3 segment size for 0x%zx bytes\n", name,
+            len);
+    return 1;
+  }
+
+  const uint32_t segments = (uint32_t)(((len - 1U) >> shift) + 1U);
+  uint8_t *cvs = &record[XFSBL_BLAKE3_RECORD_LEN];
+  memset(record, 0, BLAKE3_SPACE);
+  if (segments == 1U) {
+    XFsbl_Blake3Digest(data, (u32)len, record);
+  } else {
+    for (uint32_t i = 0U; i < segments; i++) {
+      const size_t off = (size_t)i << shift;
+      const size_t n = (len - off < ((size_t)1U << shift))
+                           ? len - off
+                           : ((size_t)1U << shift);
+      XFsbl_Blake3Segment(&data[off], (u32)n, off,
+                          &cvs[i * XFSBL_BLAKE3_LEN]);
+    }
+    XFsbl_Blake3Root(cvs, segments, record);
+  }
+  set32(&record[32], XFSBL_BLAKE3_MAGIC);
+  set32(&record[36], shift);
+  set32(&record[40], segments);
+  return 0;
+}
+
+/*
+ * Writes the partition checksum of the loaded data for the checksum type of
+ * the attributes, and the partition header checksum
+ */
+static int write_checksums(const char *name, uint8_t *image, size_t image_len,
+                           uint8_t *ph, const uint8_t *data, size_t len) {
+  const uint32_t type = get32(&ph[4U * PH_ATTRIBUTES]) & ATTRB_CHECKSUM_MASK;
+  const size_t sum_off = (size_t)get32(&ph[4U * PH_CHECKSUM_WORD_OFFSET]) * 4U;
+
+  if (type == ATTRB_HASH_SHA3) {
+    if (sum_off + SHA3_384_LEN > image_len) {
+      fprintf(stderr, "%s: partition checksum out of range\n", name);
+      return 1;
+    }
+    sha3_384(data, len, &image[sum_off]);
+  } else if (type == ATTRB_CHECKSUM_CRC32C) {
+    if (sum_off + XFSBL_CRC32C_LEN > image_len) {
+      fprintf(stderr, "%s: partition checksum out of range\n", name);
+      return 1;
+    }
+    set32(&image[sum_off], XFsbl_Crc32C(0U, data, (u32)len));
+  } else if (type == ATTRB_CHECKSUM_BLAKE3) {
+    if (sum_off + BLAKE3_SPACE > image_len) {
+      fprintf(stderr, "%s: partition checksum out of range\n", name);
+      return 1;
+    }
+    if (write_blake3(name, &image[sum_off], data, len) != 0) {
+      return 1;
+    }
+  }
+
+  uint32_t sum = 0U;
+  for (unsigned i = 0U; i < PH_CHECKSUM; i++) {
+    sum += get32(&ph[4U * i]);
+  }
+  set32(&ph[4U * PH_CHECKSUM], ~sum);
+  return 0;
+}
+
+static int cmd_patch(int argc, char **argv) {
+  size_t image_len;
+  size_t in_len;
+
+  if (argc != 3) {
+    usage();
+  }
+  uint8_t *image = read_file(argv[0], 1U, &image_len);
+  const uint32_t index = (uint32_t)strtoul(argv[1], NULL, 0);
+  uint8_t *in = read_file(argv[2], sizeof(uint32_t), &in_len);
+  uint8_t *ph = partition_header(argv[0], image, image_len, index);
+
+  const size_t data_off = (size_t)get32(&ph[4U * PH_DATA_WORD_OFFSET]) * 4U;
+  const size_t stored = (size_t)get32(&ph[4U * PH_TOTAL_LENGTH]) * 4U;
+  if (data_off + stored > image_len) {
+    fprintf(stderr, "%s: partition data out of range\n", argv[0]);
+    return 1;
+  }
+
+  uint8_t *out = malloc(in_len + 1U);
+  if ((out == NULL) || (decode(&image[data_off], stored, out, in_len) != 0) ||
+      (memcmp(out, in, in_len) != 0)) {
+    fprintf(stderr, "%s: partition %u does not decompress to %s\n", argv[0],
+            index, argv[2]);
+    return 1;
+  }
+
+  set32(&ph[4U * PH_ATTRIBUTES],
+        get32(&ph[4U * PH_ATTRIBUTES]) | ATTRB_COMPRESSION);
+  set32(&ph[4U * PH_UNENCRYPTED_LENGTH], (uint32_t)(in_len / 4U));
+  if (write_checksums(argv[0], image, image_len, ph, in, in_len) != 0) {
+    return 1;
+  }
+
+  write_file(argv[0], image, image_len);
+  printf("%s: partition %u is compressed, 0x%zx -> 0x%zx bytes\n", argv[0],
+         index, in_len, stored);
+  free(image);
+  free(in);
+  free(out);
+  return 0;
+}
+
+static int cmd_crc(int argc, char **argv) {
+  size_t image_len;
+
+  if (argc != 2) {
+    usage();
+  }
+  uint8_t *image = read_file(argv[0], 1U, &image_len);
+  const uint32_t index = (uint32_t)strtoul(argv[1], NULL, 0);
+  uint8_t *ph = partition_header(argv[0], image, image_len, index);
+  const uint32_t attr = get32(&ph[4U * PH_ATTRIBUTES]);
+
+  if ((attr & ATTRB_CHECKSUM_MASK) == 0U) {
+    fprintf(stderr, "%s: partition %u has no checksum to replace\n", argv[0],
+            index);
+    return 1;
+  }
+
+  const size_t data_off = (size_t)get32(&ph[4U * PH_DATA_WORD_OFFSET]) * 4U;
+  const size_t stored = (size_t)get32(&ph[4U * PH_TOTAL_LENGTH]) * 4U;
+  if (data_off + stored > image_len) {
+    fprintf(stderr, "%s: partition data out of range\n", argv[0]);
+    return 1;
+  }
+
+  /* The CRC covers the data as loaded, decompressed partitions decoded */
+  const uint8_t *data = &image[data_off];
+  size_t len = stored;
+  uint8_t *out = NULL;
+  if ((attr & ATTRB_COMPRESSION) != 0U) {
+    len = (size_t)get32(&ph[4U * PH_UNENCRYPTED_LENGTH]) * 4U;
+    out = malloc(len + 1U);
+    if ((out == NULL) || (decode(data, stored, out, len) != 0)) {
+      fprintf(stderr, "%s: partition %u does not decompress\n", argv[0],
+              index);
+      return 1;
+    }
+    data = out;
+  }
+
+  set32(&ph[4U * PH_ATTRIBUTES],
+        (attr & ~ATTRB_CHECKSUM_MASK) | ATTRB_CHECKSUM_CRC32C);
+  if (write_checksums(argv[0], image, image_len, ph, data, len) != 0) {
+    return 1;
+  }
+
+  write_file(argv[0], image, image_len);
+  printf("%s: partition %u CRC32C 0x%08x over 0x%zx bytes\n", argv[0], index,
+         get32(&image[(size_t)get32(&ph[4U * PH_CHECKSUM_WORD_OFFSET]) * 4U]),
+         len);
+  free(image);
+  free(out);
+  return 0;
+}
+
+static int cmd_blake3(int argc, char **argv) {
+  uint32_t shift = 0U;
+  size_t image_len;
+
+  if ((argc >= 2) && (strcmp(argv[0], "-s") == 0)) {
+    shift = (uint32_t)strtoul(argv[1], NULL, 0);
+    argc -= 2;
+    argv += 2;
+    if (shift == 0U) {
+      usage();
+    }
+  }
+  if (argc != 2) {
+    usage();
+  }
+  uint8_t *image = read_file(argv[0], 1U, &image_len);
+  const uint32_t index = (uint32_t)strtoul(argv[1], NULL, 0);
+  uint8_t *ph = partition_header(argv[0], image, image_len, index);
+  const uint32_t attr = get32(&ph[4U * PH_ATTRIBUTES]);
+
+  const size_t data_off = (size_t)get32(&ph[4U * PH_DATA_WORD_OFFSET]) * 4U;
+  const size_t stored = (size_t)get32(&ph[4U * PH_TOTAL_LENGTH]) * 4U;
+  if (data_off + stored > image_len) {
+    fprintf(stderr, "%s: partition data out of range\n", argv[0]);
+    return 1;
+  }
+
+  /* The record covers the data as loaded, decompressed partitions decoded */
+  const uint8_t *data = &image[data_off];
+  size_t len = stored;
+  uint8_t *out = NULL;
+  if ((attr & ATTRB_COMPRESSION) != 0U) {
+    len = (size_t)get32(&ph[4U * PH_UNENCRYPTED_LENGTH]) * 4U;
+    out = malloc(len + 1U);
+    if ((out == NULL) || (decode(data, stored, out, len) != 0)) {
+      fprintf(stderr, "%s: partition %u does not decompress\n", argv[0],
+              index);
+      return 1;
+    }
+    data = out;
+  }
+
+  /* A record already appended by a previous run is rewritten in place */
+  size_t sum_off = (size_t)get32(&ph[4U * PH_CHECKSUM_WORD_OFFSET]) * 4U;
+  if (((attr & ATTRB_CHECKSUM_MASK) != ATTRB_CHECKSUM_BLAKE3) ||
+      (sum_off + BLAKE3_SPACE > image_len)) {
+    sum_off = (image_len + 63U) & ~(size_t)63U;
+    uint8_t *grown = calloc(1U, sum_off + BLAKE3_SPACE);
+    if (grown == NULL) {
+      perror(argv[0]);
+      return 1;
+    }
+    memcpy(grown, image, image_len);
+    free(image);
+    image = grown;
+    image_len = sum_off + BLAKE3_SPACE;
+    ph = partition_header(argv[0], image, image_len, index);
+    set32(&ph[4U * PH_CHECKSUM_WORD_OFFSET], (uint32_t)(sum_off / 4U));
+  }
+  /* The image was copied */
+  if (out == NULL) {
+    data = &image[data_off];
+  }
+  if (shift != 0U) {
+    set32(&image[sum_off + 32U], XFSBL_BLAKE3_MAGIC);
+    set32(&image[sum_off + 36U], shift);
+  }
+
+  set32(&ph[4U * PH_ATTRIBUTES],
+        (attr & ~ATTRB_CHECKSUM_MASK) | ATTRB_CHECKSUM_BLAKE3);
+  if (write_checksums(argv[0], image, image_len, ph, data, len) != 0) {
+    return 1;
+  }
+
+  write_file(argv[0], image, image_len);
+  printf("%s: partition %u BLAKE3 over 0x%zx bytes, %u segments of 0x%x at "
+         "0x%zx\n",
+         argv[0], index, len, get32(&image[sum_off + 40U]),
+         1U << get32(&image[sum_off + 36U]), sum_off);
+  free(image);
+  free(out);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    usage();
+  }
+  if (strcmp(argv[1], "compress") == 0) {
+    return cmd_compress(argc - 2, &argv[2]);
+  }
+  if (strcmp(argv[1], "patch") == 0) {
+    return cmd_patch(argc - 2, &argv[2]);
+  }
+  if (strcmp(argv[1], "crc") == 0) {
+    return cmd_crc(argc - 2, &argv[2]);
+  }
+  if (strcmp(argv[1], "blake3") == 0) {
+    return cmd_blake3(argc - 2, &argv[2]);
+  }
+  usage();
+  return 2;
+}
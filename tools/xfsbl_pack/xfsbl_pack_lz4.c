@@ -0,0 +1,241 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_pack_lz4.c
+ *
+ * Greedy LZ4 block encoder and stream packer. The blocks follow the LZ4
+ * end of block rules, so any LZ4 block decoder accepts them.
+ *
+ ******************************************************************************/
+#include "xfsbl_pack_lz4.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "xfsbl_decompress.h"
+
+#define LZ4_MIN_MATCH 4U
+#define LZ4_MF_LIMIT 12U
+#define LZ4_LAST_LITERALS 5U
+#define LZ4_MAX_OFFSET 65535U
+#define LZ4_HASH_LOG 14U
+
+static uint32_t read32(const uint8_t *p) {
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static void write32(uint8_t *p, uint32_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t hash4(uint32_t v) {
+  return (v * 2654435761U) >> (32U - LZ4_HASH_LOG);
+}
+
+static int put_length(uint8_t *dst, size_t cap, size_t *op, size_t len) {
+  while (len >= 255U) {
+    if (*op >= cap) {
+      return -1;
+    }
+    dst[(*op)++] = 255U;
+    len -= 255U;
+  }
+  if (*op >= cap) {
+    return -1;
+  }
+  dst[(*op)++] = (uint8_t)len;
+  return 0;
+}
+
+/* Emits a sequence, match_len 0 is the final literals only sequence */
+static int put_sequence(uint8_t *dst, size_t cap, size_t *op,
+                        const uint8_t *lit, size_t lit_len, size_t offset,
+                        size_t match_len) {
+  size_t ml = (match_len != 0U) ? (match_len - LZ4_MIN_MATCH) : 0U;
+
+  if (*op >= cap) {
+    return -1;
+  }
+  dst[(*op)++] = (uint8_t)(((lit_len >= 15U) ? 15U : lit_len) << 4 |
+                           ((ml >= 15U) ? 15U : ml));
+  if ((lit_len >= 15U) && (put_length(dst, cap, op, lit_len - 15U) != 0)) {
+    return -1;
+  }
+  if (cap - *op < lit_len) {
+    return -1;
+  }
+  memcpy(&dst[*op], lit, lit_len);
+  *op += lit_len;
+
+  if (match_len == 0U) {
+    return 0;
+  }
+  if (cap - *op < 2U) {
+    return -1;
+  }
+  dst[(*op)++] = (uint8_t)offset;
+  dst[(*op)++] = (uint8_t)(offset >> 8);
+  if ((ml >= 15U) && (put_length(dst, cap, op, ml - 15U) != 0)) {
+    return -1;
+  }
+  return 0;
+}
+
+size_t xfz_lz4_compress(const uint8_t *src, size_t len, uint8_t *dst,
+                        size_t cap) {
+  static int32_t table[1U << LZ4_HASH_LOG];
+  size_t ip = 0U;
+  size_t anchor = 0U;
+  size_t op = 0U;
+
+  if (len > LZ4_MF_LIMIT) {
+    const size_t limit = len - LZ4_MF_LIMIT;
+    const size_t match_end = len - LZ4_LAST_LITERALS;
+
+    memset(table, 0xFF, sizeof(table));
+    while (ip < limit) {
+      const uint32_t seq = read32(&src[ip]);
+      const uint32_t h = hash4(seq);
+      const int32_t ref_pos = table[h];
+      table[h] = (int32_t)ip;
+
+      if ((ref_pos < 0) || ((ip - (size_t)ref_pos) > LZ4_MAX_OFFSET) ||
+          (read32(&src[ref_pos]) != seq)) {
+        ip++;
+        continue;
+      }
+
+      size_t ref = (size_t)ref_pos;
+      while ((ip > anchor) && (ref > 0U) && (src[ip - 1U] == src[ref - 1U])) {
+        ip--;
+        ref--;
+      }
+      size_t match_len = LZ4_MIN_MATCH;
+      while (((ip + match_len) < match_end) &&
+             (src[ip + match_len] == src[ref + match_len])) {
+        match_len++;
+      }
+
+      if (put_sequence(dst, cap, &op, &src[anchor], ip - anchor, ip - ref,
+                       match_len) != 0) {
+        return 0U;
+      }
+      ip += match_len;
+      anchor = ip;
+      if (ip < limit) {
+        table[hash4(read32(&src[ip - 2U]))] = (int32_t)(ip - 2U);
+      }
+    }
+  }
+
+  if (put_sequence(dst, cap, &op, &src[anchor], len - anchor, 0U, 0U) != 0) {
+    return 0U;
+  }
+  return op;
+}
+
+static size_t zero_run(const uint8_t *src, size_t len, size_t max) {
+  size_t n = 0U;
+
+  while ((n < len) && (n < max) && (src[n] == 0U)) {
+    n++;
+  }
+  return n;
+}
+
+uint8_t *xfz_pack(const uint8_t *src, size_t len, size_t block_size,
+                  size_t *out_len, struct xfz_pack_stats *stats) {
+  /* Worst case is one RAW block per block_size bytes */
+  const size_t cap = XFSBL_DECOMP_HDR_LEN + len + sizeof(uint32_t) +
+                     (len / block_size + 1U) * XFSBL_DECOMP_BLOCK_HDR_LEN;
+  uint8_t *out;
+  uint8_t *tmp;
+  size_t op = XFSBL_DECOMP_HDR_LEN;
+  size_t pos = 0U;
+
+  if ((block_size == 0U) || (block_size > XFSBL_DECOMP_BLOCK_LEN_MASK) ||
+      (len > UINT32_MAX)) {
+    return NULL;
+  }
+  out = calloc(1U, cap);
+  tmp = malloc(block_size);
+  if ((out == NULL) || (tmp == NULL)) {
+    free(out);
+    free(tmp);
+    return NULL;
+  }
+  memset(stats, 0, sizeof(*stats));
+
+  while (pos < len) {
+    size_t run = zero_run(&src[pos], len - pos, XFSBL_DECOMP_BLOCK_LEN_MASK);
+    uint32_t type;
+    size_t payload;
+
+    if (run >= XFZ_MIN_ZERO_RUN) {
+      write32(&out[op], (XFSBL_DECOMP_BLOCK_ZERO
+                         << XFSBL_DECOMP_BLOCK_TYPE_SHIFT) |
+                            (uint32_t)run);
+      write32(&out[op + 4U], 0U);
+      op += XFSBL_DECOMP_BLOCK_HDR_LEN;
+      pos += run;
+      stats->zero_blocks++;
+      stats->zero_bytes += (uint32_t)run;
+      continue;
+    }
+
+    /* Data block, it ends where the next long zero run starts */
+    size_t end = ((len - pos) > block_size) ? (pos + block_size) : len;
+    size_t i = pos;
+    while (i < end) {
+      if (src[i] != 0U) {
+        i++;
+        continue;
+      }
+      run = zero_run(&src[i], len - i, XFZ_MIN_ZERO_RUN);
+      if ((run >= XFZ_MIN_ZERO_RUN) && (i > pos)) {
+        end = i;
+        break;
+      }
+      i += run;
+    }
+
+    const size_t block = end - pos;
+    payload = xfz_lz4_compress(&src[pos], block, tmp, block - 1U);
+    if (payload != 0U) {
+      type = XFSBL_DECOMP_BLOCK_LZ4;
+      memcpy(&out[op + XFSBL_DECOMP_BLOCK_HDR_LEN], tmp, payload);
+      stats->lz4_blocks++;
+    } else {
+      type = XFSBL_DECOMP_BLOCK_RAW;
+      payload = block;
+      memcpy(&out[op + XFSBL_DECOMP_BLOCK_HDR_LEN], &src[pos], payload);
+      stats->raw_blocks++;
+    }
+    write32(&out[op],
+            (type << XFSBL_DECOMP_BLOCK_TYPE_SHIFT) | (uint32_t)block);
+    write32(&out[op + 4U], (uint32_t)payload);
+    op += XFSBL_DECOMP_BLOCK_HDR_LEN + payload;
+    pos = end;
+    if (payload > stats->max_payload) {
+      stats->max_payload = (uint32_t)payload;
+    }
+  }
+
+  write32(&out[0U], XFSBL_DECOMP_MAGIC);
+  write32(&out[4U], (uint32_t)len);
+  write32(&out[8U], stats->max_payload);
+  write32(&out[12U], 0U);
+
+  free(tmp);
+  *out_len = (op + 3U) & ~(size_t)3U;
+  return out;
+}
@@ -0,0 +1,49 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_pack_lz4.h
+ *
+ * Host side encoder of the compressed partition stream decoded by
+ * src/main/xfsbl_decompress.c
+ *
+ ******************************************************************************/
+#ifndef XFSBL_PACK_LZ4_H
+#define XFSBL_PACK_LZ4_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Default decompressed size of RAW and LZ4 blocks */
+#define XFZ_DEFAULT_BLOCK_SIZE (0x2000U)
+
+/* Zero runs of at least this length become ZERO blocks */
+#define XFZ_MIN_ZERO_RUN (256U)
+
+struct xfz_pack_stats {
+  uint32_t raw_blocks;
+  uint32_t lz4_blocks;
+  uint32_t zero_blocks;
+  uint32_t zero_bytes;
+  uint32_t max_payload;
+};
+
+/*
+ * Compresses src into one independent LZ4 block. Returns the block length,
+ * or 0 if it does not fit in cap bytes.
+ */
+size_t xfz_lz4_compress(const uint8_t *src, size_t len, uint8_t *dst,
+                        size_t cap);
+
+/*
+ * Packs src into a stream with blocks of at most block_size decompressed
+ * bytes. The stream is padded to a word multiple. Returns a malloc'ed
+ * buffer, or NULL on failure.
+ */
+uint8_t *xfz_pack(const uint8_t *src, size_t len, size_t block_size,
+                  size_t *out_len, struct xfz_pack_stats *stats);
+
+#endif /* XFSBL_PACK_LZ4_H */
@@ -0,0 +1,96 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_pack_sha3.c
+ *
+ * SHA3-384 of partitions with the SHA3 checksum attribute, used by the
+ * packer and the checksum benchmark.
+ *
+ ******************************************************************************/
+#include "xfsbl_pack_sha3.h"
+
+#include <string.h>
+
+static uint64_t rol64(uint64_t v, unsigned n) {
+  return (n == 0U) ? v : ((v << n) | (v >> (64U - n)));
+}
+
+static void keccak_f1600(uint64_t a[25]) {
+  static const uint64_t rc[24] = {
+      0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+      0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+      0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+      0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+      0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+      0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+      0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+      0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL};
+  static const unsigned rot[25] = {0,  1,  62, 28, 27, 36, 44, 6,  55,
+                                   20, 3,  10, 43, 25, 39, 41, 45, 15,
+                                   21, 8,  18, 2,  61, 56, 14};
+
+  for (unsigned round = 0U; round < 24U; round++) {
+    uint64_t c[5];
+    uint64_t b[25];
+
+    for (unsigned x = 0U; x < 5U; x++) {
+      c[x] = a[x] ^ a[x + 5U] ^ a[x + 10U] ^ a[x + 15U] ^ a[x + 20U];
+    }
+    for (unsigned x = 0U; x < 5U; x++) {
+      const uint64_t d = c[(x + 4U) % 5U] ^ rol64(c[(x + 1U) % 5U], 1U);
+      for (unsigned y = 0U; y < 25U; y += 5U) {
+        a[y + x] ^= d;
+      }
+    }
+    for (unsigned x = 0U; x < 5U; x++) {
+      for (unsigned y = 0U; y < 5U; y++) {
+        b[y + 5U * ((2U * x + 3U * y) % 5U)] = rol64(a[x + 5U * y],
+                                                     rot[x + 5U * y]);
+      }
+    }
+    for (unsigned y = 0U; y < 25U; y += 5U) {
+      for (unsigned x = 0U; x < 5U; x++) {
+        a[y + x] = b[y + x] ^ (~b[y + (x + 1U) % 5U] & b[y + (x + 2U) % 5U]);
+      }
+    }
+    a[0] ^= rc[round];
+  }
+}
+
+void sha3_384(const uint8_t *data, size_t len,
+                     uint8_t hash[SHA3_384_LEN]) {
+  uint64_t a[25] = {0};
+  uint8_t block[SHA3_384_RATE];
+
+  for (;;) {
+    const size_t n = (len < SHA3_384_RATE) ? len : SHA3_384_RATE;
+
+    memset(block, 0, sizeof(block));
+    memcpy(block, data, n);
+    if (n < SHA3_384_RATE) {
+      block[n] ^= 0x06U;
+      block[SHA3_384_RATE - 1U] ^= 0x80U;
+    }
+    for (unsigned i = 0U; i < SHA3_384_RATE / 8U; i++) {
+      uint64_t lane = 0U;
+      for (unsigned j = 0U; j < 8U; j++) {
+        lane |= (uint64_t)block[8U * i + j] << (8U * j);
+      }
+      a[i] ^= lane;
+    }
+    keccak_f1600(a);
+    if (n < SHA3_384_RATE) {
+      break;
+    }
+    data += n;
+    len -= n;
+  }
+
+  for (unsigned i = 0U; i < SHA3_384_LEN; i++) {
+    hash[i] = (uint8_t)(a[i / 8U] >> (8U * (i % 8U)));
+  }
+}
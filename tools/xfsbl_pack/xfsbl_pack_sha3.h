@@ -0,0 +1,24 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_pack_sha3.h
+ *
+ * Host side SHA3-384, the partition checksum of bootgen SHA3 partitions.
+ *
+ ******************************************************************************/
+#ifndef XFSBL_PACK_SHA3_H
+#define XFSBL_PACK_SHA3_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHA3_384_LEN 48U
+#define SHA3_384_RATE 104U
+
+void sha3_384(const uint8_t *data, size_t len, uint8_t hash[SHA3_384_LEN]);
+
+#endif /* XFSBL_PACK_SHA3_H */
@@ -0,0 +1,300 @@
+/******************************************************************************
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xil_mem_bench.c
+ *
+ * Microbenchmark of the xil memory functions.
+ *
+ *   xil_mem_bench [-n iterations] [-c cpu_MHz]
+ *
+ * The functions are first checked against libc for all source and
+ * destination alignments and lengths up to 320 bytes. Then the bytes per
+ * cycle of the xil functions and of the FSBL implementations they replace
+ * are measured for a range of copy sizes. Cycles are read from the time
+ * stamp counter on x86. Elsewhere the generic timer is used, scaled by -c
+ * when given, so an AArch64 build under QEMU reports bytes per timer tick.
+ *
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xil_types.h"
+#include "xil_mem.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define CHECK_MAX_LEN 320U
+#define BENCH_BUF_SIZE (1024U * 1024U)
+
+/* Byte loop of the former XFsbl_MemCpy */
+static void __attribute__((noinline))
+legacy_byte_copy(void *dst, const void *src, u32 len) {
+  volatile u8 *d = dst;
+  const u8 *s = src;
+
+  while (len != 0U) {
+    *d = *s;
+    d++;
+    s++;
+    len--;
+  }
+}
+
+/* Word loop of the former Xil_MemCpy */
+static void __attribute__((noinline))
+legacy_word_copy(void *dst, const void *src, u32 cnt) {
+  char *d = dst;
+  const char *s = src;
+
+  while (cnt >= sizeof(s32)) {
+    *(volatile s32 *)d = *(const s32 *)s;
+    d += sizeof(s32);
+    s += sizeof(s32);
+    cnt -= sizeof(s32);
+  }
+  while (cnt > 0U) {
+    *d = *s;
+    d += 1U;
+    s += 1U;
+    cnt -= 1U;
+  }
+}
+
+/* Word loop of the former Xil_SMemCmp_CT */
+static u32 __attribute__((noinline))
+legacy_cmp_ct(const void *src1, const void *src2, u32 cnt) {
+  volatile u32 data = 0U;
+  const u8 *s1 = src1;
+  const u8 *s2 = src2;
+
+  while (cnt >= sizeof(u32)) {
+    data |= (*(const u32 *)s1 ^ *(const u32 *)s2);
+    s1 += sizeof(u32);
+    s2 += sizeof(u32);
+    cnt -= sizeof(u32);
+  }
+  while (cnt > 0U) {
+    data |= (u32)(*s1 ^ *s2);
+    s1++;
+    s2++;
+    cnt--;
+  }
+  return data;
+}
+
+static void xil_memset_wrapper(void *dst, const void *src, u32 len) {
+  (void)src;
+  Xil_MemSet(dst, 0x5AU, len);
+}
+
+static void libc_memset_wrapper(void *dst, const void *src, u32 len) {
+  (void)src;
+  memset(dst, 0x5A, len);
+}
+
+static void libc_memcpy_wrapper(void *dst, const void *src, u32 len) {
+  memcpy(dst, src, len);
+}
+
+static void xil_cmp_ct_wrapper(void *dst, const void *src, u32 len) {
+  if (Xil_MemCmp_CT(dst, src, len) != 0U) {
+    abort();
+  }
+}
+
+static void legacy_cmp_ct_wrapper(void *dst, const void *src, u32 len) {
+  if (legacy_cmp_ct(dst, src, len) != 0U) {
+    abort();
+  }
+}
+
+static u64 counter(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  u64 val;
+
+  __asm__ volatile("isb; mrs %0, cntvct_el0" : "=r"(val));
+  return val;
+#else
+#  error "no cycle counter for this architecture"
+#endif
+}
+
+static u64 counter_freq(void) {
+#if defined(__aarch64__)
+  u64 val;
+
+  __asm__ volatile("mrs %0, cntfrq_el0" : "=r"(val));
+  return val;
+#else
+  return 0U;
+#endif
+}
+
+static unsigned failures;
+
+static void check(const char *name, int ok, u32 da, u32 sa, u32 len) {
+  if (!ok) {
+    if (failures < 10U) {
+      printf("FAIL %s dst+%u src+%u len %u\n", name, da, sa, len);
+    }
+    failures++;
+  }
+}
+
+static void check_all(void) {
+  static u8 src[CHECK_MAX_LEN + 64U] __attribute__((aligned(64)));
+  static u8 dst[CHECK_MAX_LEN + 64U] __attribute__((aligned(64)));
+  static u8 ref[CHECK_MAX_LEN + 64U] __attribute__((aligned(64)));
+
+  for (u32 i = 0U; i < sizeof(src); i++) {
+    src[i] = (u8)(i * 7U + 1U);
+  }
+
+  for (u32 da = 0U; da < 16U; da++) {
+    for (u32 sa = 0U; sa < 16U; sa++) {
+      for (u32 len = 0U; len <= CHECK_MAX_LEN; len++) {
+        memset(dst, 0xEE, sizeof(dst));
+        memset(ref, 0xEE, sizeof(ref));
+        Xil_MemCpy(&dst[da], &src[sa], len);
+        memcpy(&ref[da], &src[sa], len);
+        check("Xil_MemCpy", memcmp(dst, ref, sizeof(dst)) == 0, da, sa, len);
+
+        memset(dst, 0xEE, sizeof(dst));
+        memset(ref, 0xEE, sizeof(ref));
+        Xil_MemSet(&dst[da], (u8)sa, len);
+        memset(&ref[da], (int)sa, len);
+        check("Xil_MemSet", memcmp(dst, ref, sizeof(dst)) == 0, da, sa, len);
+
+        /* Overlapping moves inside one buffer */
+        memcpy(dst, src, sizeof(dst));
+        memcpy(ref, src, sizeof(ref));
+        Xil_MemMove(&dst[da * 3U], &dst[sa * 3U], len);
+        memmove(&ref[da * 3U], &ref[sa * 3U], len);
+        check("Xil_MemMove", memcmp(dst, ref, sizeof(dst)) == 0, da, sa, len);
+
+        /* Equal, then one differing byte at each position */
+        memcpy(&dst[da], &src[sa], len);
+        check("Xil_MemCompare", Xil_MemCompare(&dst[da], &src[sa], len) == 0,
+              da, sa, len);
+        check("Xil_MemCmp_CT", Xil_MemCmp_CT(&dst[da], &src[sa], len) == 0U,
+              da, sa, len);
+        for (u32 pos = 0U; pos < len; pos += 1U + (len / 8U)) {
+          dst[da + pos] ^= (u8)(1U << (pos & 7U));
+          const int expect = memcmp(&dst[da], &src[sa], len);
+          const s32 got = Xil_MemCompare(&dst[da], &src[sa], len);
+          check("Xil_MemCompare", (got < 0) == (expect < 0) && (got != 0), da,
+                sa, len);
+          check("Xil_MemCmp_CT", Xil_MemCmp_CT(&dst[da], &src[sa], len) != 0U,
+                da, sa, len);
+          dst[da + pos] ^= (u8)(1U << (pos & 7U));
+        }
+      }
+    }
+  }
+}
+
+typedef void (*copy_fn)(void *dst, const void *src, u32 len);
+
+static double measure(copy_fn fn, u8 *dst, const u8 *src, u32 len,
+                      unsigned iterations) {
+  u64 best = ~(u64)0U;
+
+  for (unsigned n = 0U; n < iterations; n++) {
+    const u32 reps = (BENCH_BUF_SIZE / len < 64U) ? 1U : 64U;
+    const u64 start = counter();
+    for (u32 r = 0U; r < reps; r++) {
+      fn(dst, src, len);
+    }
+    const u64 ticks = (counter() - start) / reps;
+    if (ticks < best) {
+      best = ticks;
+    }
+  }
+  return (best == 0U) ? 0.0 : (double)len / (double)best;
+}
+
+int main(int argc, char **argv) {
+  static const u32 sizes[] = {16U, 64U, 256U, 1024U, 4096U, 65536U,
+                              BENCH_BUF_SIZE};
+  static const struct {
+    const char *name;
+    copy_fn fn;
+  } fns[] = {
+      {"byte copy (old XFsbl_MemCpy)", legacy_byte_copy},
+      {"word copy (old Xil_MemCpy)", legacy_word_copy},
+      {"Xil_MemCpy", Xil_MemCpy},
+      {"libc memcpy", libc_memcpy_wrapper},
+      {"Xil_MemSet", xil_memset_wrapper},
+      {"libc memset", libc_memset_wrapper},
+      {"word CT compare (old)", legacy_cmp_ct_wrapper},
+      {"Xil_MemCmp_CT", xil_cmp_ct_wrapper},
+  };
+  unsigned iterations = 20U;
+  double mhz = 0.0;
+
+  for (int i = 1; i < argc; i++) {
+    if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc)) {
+      iterations = (unsigned)strtoul(argv[++i], NULL, 0);
+    } else if ((strcmp(argv[i], "-c") == 0) && (i + 1 < argc)) {
+      mhz = strtod(argv[++i], NULL);
+    } else {
+      fprintf(stderr, "usage: xil_mem_bench [-n iterations] [-c cpu_MHz]\n");
+      return 2;
+    }
+  }
+
+  check_all();
+  if (failures != 0U) {
+    printf("%u checks failed\n", failures);
+    return 1;
+  }
+  printf("checks     passed\n");
+
+  u8 *src = aligned_alloc(64U, BENCH_BUF_SIZE);
+  u8 *dst = aligned_alloc(64U, BENCH_BUF_SIZE);
+  if ((src == NULL) || (dst == NULL) || (iterations == 0U)) {
+    return 1;
+  }
+  memset(src, 0x11, BENCH_BUF_SIZE);
+  memset(dst, 0x11, BENCH_BUF_SIZE);
+
+  /* Timer ticks are converted to cycles with the clock given by -c */
+  double scale = 1.0;
+  const char *unit = "bytes/cycle";
+  const u64 freq = counter_freq();
+  if (freq != 0U) {
+    if (mhz > 0.0) {
+      scale = (double)freq / (mhz * 1e6);
+    } else {
+      unit = "bytes/timer tick";
+    }
+  }
+
+  printf("%-30s", unit);
+  for (size_t s = 0U; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    printf(" %9u", sizes[s]);
+  }
+  printf("\n");
+  for (size_t f = 0U; f < sizeof(fns) / sizeof(fns[0]); f++) {
+    memcpy(dst, src, BENCH_BUF_SIZE);
+    printf("%-30s", fns[f].name);
+    for (size_t s = 0U; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+      printf(" %9.2f",
+             measure(fns[f].fn, dst, src, sizes[s], iterations) * scale);
+    }
+    printf("\n");
+  }
+
+  free(src);
+  free(dst);
+  return 0;
+}